@@ -59,6 +59,14 @@ void Context::setDeterministicCuDNN(bool b) {
   deterministic_cudnn = b;
 }
 
+bool Context::deterministicCPUReduction() const {
+  return deterministic_cpu_reduction;
+}
+
+void Context::setDeterministicCPUReduction(bool b) {
+  deterministic_cpu_reduction = b;
+}
+
 bool Context::benchmarkCuDNN() const {
   return benchmark_cudnn;
 }
@@ -106,6 +106,12 @@ class CAFFE2_API Context {
   void setBenchmarkCuDNN(bool);
   bool deterministicCuDNN() const;
   void setDeterministicCuDNN(bool);
+  // When enabled, multi-threaded CPU reductions use a fixed chunk
+  // decomposition and a canonical combination tree, so results do not
+  // depend on the number of intra-op threads. See NOTE [ Deterministic
+  // parallel reduction ] in native/cpu/Reduce.h.
+  bool deterministicCPUReduction() const;
+  void setDeterministicCPUReduction(bool);
   at::QEngine qEngine() const;
   void setQEngine(at::QEngine e);
   const std::vector<at::QEngine>& supportedQEngines() const;
@@ -126,6 +132,7 @@ class CAFFE2_API Context {
   std::once_flag thh_init;
   bool enabled_cudnn = true;
   bool deterministic_cudnn = false;
+  bool deterministic_cpu_reduction = false;
   bool benchmark_cudnn = false;
   bool enabled_mkldnn = true;
   c10::optional<at::QEngine> quantized_engine = c10::nullopt;
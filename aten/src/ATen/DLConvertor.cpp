@@ -2,7 +2,9 @@
 #include <ATen/Functions.h>
 
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <vector>
 
 using namespace std;
 namespace at {
@@ -153,14 +155,61 @@ struct ATenDLMTensor {
   DLManagedTensor tensor;
 };
 
-void deleter(DLManagedTensor* arg) {
-  delete static_cast<ATenDLMTensor*>(arg->manager_ctx);
+void deleter(DLManagedTensor* arg);
+
+// NOTE [ Pooled DLPack slabs ]
+//
+// Each toDLPack call needs an ATenDLMTensor: the DLManagedTensor handed to
+// the consumer plus the Tensor that keeps the storage alive until the
+// consumer runs the deleter. Allocating one per call dominates the cost of
+// exchanging small tensors at high rates, so released slabs are recycled
+// through a bounded free list instead of being freed; steady-state
+// conversion then does no heap allocation. The deleter drops the Tensor
+// handle before a slab is pooled so recycling never pins storage.
+
+namespace {
+
+constexpr size_t kMaxPooledSlabs = 1024;
+
+struct SlabPool {
+  std::mutex mutex;
+  std::vector<ATenDLMTensor*> slabs;
+
+  ~SlabPool() {
+    for (ATenDLMTensor* slab : slabs) {
+      delete slab;
+    }
+  }
+};
+
+SlabPool& slabPool() {
+  static SlabPool pool;
+  return pool;
 }
 
-// This function returns a shared_ptr to memory managed DLpack tensor
-// constructed out of ATen tensor
-DLManagedTensor* toDLPack(const Tensor& src) {
-  ATenDLMTensor* atDLMTensor(new ATenDLMTensor);
+ATenDLMTensor* acquireSlab() {
+  auto& pool = slabPool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  if (pool.slabs.empty()) {
+    return new ATenDLMTensor;
+  }
+  ATenDLMTensor* slab = pool.slabs.back();
+  pool.slabs.pop_back();
+  return slab;
+}
+
+void releaseSlab(ATenDLMTensor* slab) {
+  slab->handle.reset();
+  auto& pool = slabPool();
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  if (pool.slabs.size() >= kMaxPooledSlabs) {
+    delete slab;
+    return;
+  }
+  pool.slabs.push_back(slab);
+}
+
+void fillDLMTensor(ATenDLMTensor* atDLMTensor, const Tensor& src) {
   atDLMTensor->handle = src;
   atDLMTensor->tensor.manager_ctx = atDLMTensor;
   atDLMTensor->tensor.deleter = &deleter;
@@ -177,9 +226,45 @@ DLManagedTensor* toDLPack(const Tensor& src) {
   atDLMTensor->tensor.dl_tensor.strides =
       const_cast<int64_t*>(src.strides().data());
   atDLMTensor->tensor.dl_tensor.byte_offset = 0;
+}
+
+} // namespace
+
+void deleter(DLManagedTensor* arg) {
+  releaseSlab(static_cast<ATenDLMTensor*>(arg->manager_ctx));
+}
+
+// This function returns a shared_ptr to memory managed DLpack tensor
+// constructed out of ATen tensor
+DLManagedTensor* toDLPack(const Tensor& src) {
+  ATenDLMTensor* atDLMTensor = acquireSlab();
+  fillDLMTensor(atDLMTensor, src);
   return &(atDLMTensor->tensor);
 }
 
+// Batched variant: converts a whole list while acquiring slabs from the
+// pool under a single lock. See NOTE [ Pooled DLPack slabs ].
+std::vector<DLManagedTensor*> toDLPack(TensorList src) {
+  std::vector<ATenDLMTensor*> slabs(src.size(), nullptr);
+  {
+    auto& pool = slabPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    for (size_t i = 0; i < slabs.size() && !pool.slabs.empty(); ++i) {
+      slabs[i] = pool.slabs.back();
+      pool.slabs.pop_back();
+    }
+  }
+  std::vector<DLManagedTensor*> result(src.size());
+  for (size_t i = 0; i < src.size(); ++i) {
+    if (slabs[i] == nullptr) {
+      slabs[i] = new ATenDLMTensor;
+    }
+    fillDLMTensor(slabs[i], src[i]);
+    result[i] = &(slabs[i]->tensor);
+  }
+  return result;
+}
+
 Tensor fromDLPack(const DLManagedTensor* src) {
   Device device = getATenDevice(src->dl_tensor.ctx);
   ScalarType stype = toScalarType(src->dl_tensor.dtype);
@@ -200,4 +285,13 @@ Tensor fromDLPack(const DLManagedTensor* src) {
       deleter,
       at::device(device).dtype(stype));
 }
+
+std::vector<Tensor> fromDLPack(ArrayRef<DLManagedTensor*> src) {
+  std::vector<Tensor> result;
+  result.reserve(src.size());
+  for (DLManagedTensor* tensor : src) {
+    result.push_back(fromDLPack(tensor));
+  }
+  return result;
+}
 } // namespace at
@@ -13,6 +13,11 @@ namespace at {
 CAFFE2_API ScalarType toScalarType(const DLDataType& dtype);
 CAFFE2_API DLManagedTensor* toDLPack(const Tensor& src);
 CAFFE2_API Tensor fromDLPack(const DLManagedTensor* src);
+// Batched variants for exchanging many (small) tensors at once; the
+// list form acquires all the DLManagedTensor slabs from the internal
+// pool under a single lock. See NOTE [ Pooled DLPack slabs ].
+CAFFE2_API std::vector<DLManagedTensor*> toDLPack(TensorList src);
+CAFFE2_API std::vector<Tensor> fromDLPack(ArrayRef<DLManagedTensor*> src);
 CAFFE2_API DLDataType getDLDataType(const Tensor& t);
 CAFFE2_API DLContext getDLContext(const Tensor& tensor, const int64_t& device_id);
 
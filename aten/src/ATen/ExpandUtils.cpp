@@ -1,13 +1,18 @@
 #include <ATen/ExpandUtils.h>
 
+#include <array>
+
 namespace at {
 
+namespace {
+
 // NOTE: are_expandable did a similar check, please keep them sync if change is needed
-std::vector<int64_t> infer_size(IntArrayRef a, IntArrayRef b) {
+template <typename Container>
+Container infer_size_impl(IntArrayRef a, IntArrayRef b) {
   size_t dimsA = a.size();
   size_t dimsB = b.size();
   size_t ndim = dimsA > dimsB ? dimsA : dimsB;
-  std::vector<int64_t> expandedSizes(ndim);
+  Container expandedSizes(ndim);
 
   // Use ptrdiff_t to ensure signed comparison.
   for (ptrdiff_t i = (ptrdiff_t)ndim - 1; i >= 0; --i) {
@@ -30,6 +35,56 @@ std::vector<int64_t> infer_size(IntArrayRef a, IntArrayRef b) {
   return expandedSizes;
 }
 
+// Direct-mapped, thread-local memo for infer_size_cached. Binary ops on
+// fixed-shape workloads resolve the same handful of shape pairs over and
+// over, so a repeated broadcast costs one hash probe instead of a loop over
+// dims with allocations. Invalid shape pairs throw before being inserted and
+// are never cached.
+constexpr size_t kInferSizeCacheSize = 64; // must be a power of two
+
+struct InferSizeCacheEntry {
+  DimVector a;
+  DimVector b;
+  DimVector result;
+  bool valid = false;
+};
+
+size_t shape_pair_hash(IntArrayRef a, IntArrayRef b) {
+  // FNV-1a over both shapes; the length of `a` disambiguates the boundary.
+  size_t hash = 0xcbf29ce484222325ull;
+  const auto mix = [&hash](int64_t value) {
+    hash = (hash ^ static_cast<size_t>(value)) * 0x100000001b3ull;
+  };
+  mix(a.size());
+  for (auto size : a) {
+    mix(size);
+  }
+  for (auto size : b) {
+    mix(size);
+  }
+  return hash;
+}
+
+} // anonymous namespace
+
+std::vector<int64_t> infer_size(IntArrayRef a, IntArrayRef b) {
+  return infer_size_impl<std::vector<int64_t>>(a, b);
+}
+
+DimVector infer_size_cached(IntArrayRef a, IntArrayRef b) {
+  thread_local std::array<InferSizeCacheEntry, kInferSizeCacheSize> cache;
+  auto& entry = cache[shape_pair_hash(a, b) & (kInferSizeCacheSize - 1)];
+  if (entry.valid && a.equals(entry.a) && b.equals(entry.b)) {
+    return entry.result;
+  }
+  entry.valid = false;
+  entry.result = infer_size_impl<DimVector>(a, b);
+  entry.a.assign(a.begin(), a.end());
+  entry.b.assign(b.begin(), b.end());
+  entry.valid = true;
+  return entry.result;
+}
+
 std::tuple<std::vector<int64_t>, std::vector<int64_t>> inferExpandGeometry(
     IntArrayRef tensor_sizes,
     IntArrayRef tensor_strides,
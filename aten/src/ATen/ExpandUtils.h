@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ATen/Tensor.h>
+#include <ATen/core/DimVector.h>
 #include <c10/util/Exception.h>
 
 #include <functional>
@@ -10,6 +11,10 @@
 namespace at {
 
 CAFFE2_API std::vector<int64_t> infer_size(IntArrayRef a, IntArrayRef b);
+// Like infer_size, but memoizes recent shape pairs in a thread-local cache
+// so that repeated broadcasts of the same shapes (e.g. binary ops in a
+// fixed-shape graph) resolve without re-running shape inference.
+CAFFE2_API DimVector infer_size_cached(IntArrayRef a, IntArrayRef b);
 CAFFE2_API std::tuple<std::vector<int64_t>, std::vector<int64_t>>
 inferExpandGeometry(
     IntArrayRef tensor_sizes,
@@ -2,6 +2,7 @@
 
 #include <ATen/Parallel.h>
 #include <c10/core/thread_pool.h>
+#include <c10/core/work_stealing_thread_pool.h>
 
 namespace at {
 
@@ -16,4 +17,17 @@ public:
       }) {}
 };
 
+// Work-stealing variant used for the inter-op pool behind at::launch; see
+// c10/core/work_stealing_thread_pool.h for the scheduling policy.
+class CAFFE2_API PTWorkStealingThreadPool : public c10::WorkStealingThreadPool {
+public:
+  explicit PTWorkStealingThreadPool(
+      int pool_size,
+      int numa_node_id = -1)
+    : c10::WorkStealingThreadPool(pool_size, numa_node_id, [](){
+        c10::setThreadName("PTThreadPool");
+        at::init_num_threads();
+      }) {}
+};
+
 } // namespace at
@@ -56,6 +56,59 @@ inline void parallel_for(
     const int64_t grain_size,
     const F& f);
 
+/*
+parallel_for_2d
+
+Collapses the two dimensional iteration space [begin0, end0) x [begin1, end1)
+into a single range and parallelizes over that, so work can be spread across
+all threads even when the outer extent alone is smaller than the thread count
+(e.g. flattened N*C loops with a small batch).
+
+grain_size: number of collapsed elements per chunk. When it spans more than
+one inner row it is rounded up to a whole number of rows, so most chunks hand
+complete inner ranges to f.
+
+f: user function applied in parallel to the chunks, signature:
+  void f(int64_t i0, int64_t begin1, int64_t end1)
+invoked for contiguous sub-ranges of the inner dimension at outer index i0.
+
+This is implemented on top of parallel_for, so it is available with every
+parallelization backend and the same warning applies: thread local states
+are NOT copied to the worker threads.
+*/
+template <class F>
+inline void parallel_for_2d(
+    const int64_t begin0,
+    const int64_t end0,
+    const int64_t begin1,
+    const int64_t end1,
+    const int64_t grain_size,
+    const F& f) {
+  TORCH_CHECK(grain_size >= 0);
+  if (begin0 >= end0 || begin1 >= end1) {
+    return;
+  }
+  const int64_t size1 = end1 - begin1;
+  // Divisible-grain policy: align the granularity to whole inner rows
+  // whenever the grain spans more than one of them.
+  int64_t grain = grain_size;
+  if (grain > size1) {
+    grain = divup(grain, size1) * size1;
+  }
+  parallel_for(
+      0, (end0 - begin0) * size1, grain, [&](int64_t begin, int64_t end) {
+        int64_t i = begin / size1;
+        int64_t j = begin - i * size1;
+        while (begin < end) {
+          const int64_t row_end = std::min(end - i * size1, size1);
+          f(begin0 + i, begin1 + j, begin1 + row_end);
+          begin += row_end - j;
+          ++i;
+          j = 0;
+        }
+      });
+}
+
 /*
 parallel_reduce
 
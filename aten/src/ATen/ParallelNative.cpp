@@ -9,7 +9,11 @@
 #include <caffe2/utils/threadpool/ThreadPoolMobile.h>
 #endif // C10_MOBILE
 
+#include <c10/util/numa.h>
+
 #include <atomic>
+#include <memory>
+#include <vector>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -65,22 +69,95 @@ int _num_pool_threads(int nthreads) {
   return nthreads - 1;
 }
 
+// Consumes the user-set thread count exactly once; all intra-op pools
+// (the default one and the per-NUMA-node ones) size themselves from this.
+int _intraop_pool_size() {
+  static int pool_size = _num_pool_threads(num_intraop_threads.exchange(CONSUMED));
+  return pool_size;
+}
+
 TaskThreadPoolBase& _get_intraop_pool() {
   static std::shared_ptr<TaskThreadPoolBase> pool =
       ThreadPoolRegistry()->Create(
           "C10",
           /* device_id */ 0,
-          /* pool_size */ _num_pool_threads(num_intraop_threads.exchange(CONSUMED)),
+          /* pool_size */ _intraop_pool_size(),
           /* create_new */ true); // create a separate thread pool for intra-op
   return *pool;
 }
 
+// Intra-op worker pool pinned to one NUMA node; threads get the same
+// initialization as PTThreadPool plus a NUMABind to their node.
+class PTNumaThreadPool : public c10::ThreadPool {
+ public:
+  PTNumaThreadPool(int pool_size, int numa_node_id)
+      : c10::ThreadPool(pool_size, numa_node_id, [numa_node_id]() {
+          c10::setThreadName("PTThreadPool");
+          at::init_num_threads();
+          c10::NUMABind(numa_node_id);
+        }) {}
+};
+
+// Locality hint for the next parallel region on this thread; see
+// at::internal::set_numa_locality_hint.
+thread_local const void* numa_hint_data = nullptr;
+thread_local size_t numa_hint_nbytes = 0;
+
+// Whether intra-op work should be scheduled on per-node pinned pools.
+// Decided once: the pinned pools cannot be re-laid-out after creation.
+// Requires at least one worker per node so every node can be targeted.
+bool _numa_mode() {
+  static bool enabled = c10::IsNUMAEnabled() &&
+      c10::GetNumNUMANodes() > 1 &&
+      _intraop_pool_size() >= c10::GetNumNUMANodes();
+  return enabled;
+}
+
+std::vector<std::unique_ptr<PTNumaThreadPool>>& _get_numa_pools() {
+  static std::vector<std::unique_ptr<PTNumaThreadPool>> pools = []() {
+    const int num_nodes = c10::GetNumNUMANodes();
+    const int nthreads = _intraop_pool_size();
+    std::vector<std::unique_ptr<PTNumaThreadPool>> ps;
+    for (int node = 0; node < num_nodes; ++node) {
+      // spread the workers evenly; the first nodes take the remainder
+      int share = nthreads / num_nodes + (node < nthreads % num_nodes ? 1 : 0);
+      ps.emplace_back(new PTNumaThreadPool(share, node));
+    }
+    return ps;
+  }();
+  return pools;
+}
+
 #endif // C10_MOBILE
 
 // Run lambda function `fn` over `task_id` in [0, `range`) with threadpool.
 // `fn` will be called with params: (thread_pool_task_id, task_id).
 void _run_with_pool(const std::function<void(int, size_t)>& fn, size_t range) {
 #ifndef C10_MOBILE
+  if (_numa_mode() && range > 1) {
+    auto& pools = _get_numa_pools();
+    const int num_nodes = (int)pools.size();
+    const char* hint_data = static_cast<const char*>(numa_hint_data);
+    const size_t hint_nbytes = numa_hint_nbytes;
+    numa_hint_data = nullptr;
+    numa_hint_nbytes = 0;
+    for (size_t i = 1; i < range; ++i) {
+      // Contiguous blocks of tasks per node by default, so threads on one
+      // node touch adjacent pages; with a locality hint, place each chunk
+      // on the node that owns the pages it will stream over.
+      int node = (int)((i * num_nodes) / range);
+      if (hint_data != nullptr) {
+        int data_node = c10::GetNUMANode(hint_data + (i * hint_nbytes) / range);
+        if (data_node >= 0 && data_node < num_nodes) {
+          node = data_node;
+        }
+      }
+      pools[node]->run([fn, i]() { fn((int)i, i); });
+    }
+    // Run the first task on the current thread directly.
+    fn(0, 0);
+    return;
+  }
   for (size_t i = 1; i < range; ++i) {
     _get_intraop_pool().run([fn, i]() { fn((int)i, i); });
   }
@@ -116,6 +193,19 @@ struct ParallelRegionGuard {
 
 namespace internal {
 
+void set_numa_locality_hint(const void* data, size_t nbytes) {
+#ifndef C10_MOBILE
+  if (!c10::IsNUMAEnabled()) {
+    return;
+  }
+  numa_hint_data = data;
+  numa_hint_nbytes = nbytes;
+#else
+  (void)data;
+  (void)nbytes;
+#endif // C10_MOBILE
+}
+
 void _parallel_run(
   const int64_t begin,
   const int64_t end,
@@ -184,7 +274,7 @@ void set_num_threads(int nthreads) {
     int stored_nthreads = num_intraop_threads.load();
     if (stored_nthreads <= 0) {
       // plus one because of master thread
-      stored_nthreads = _get_intraop_pool().size() + 1;
+      stored_nthreads = _intraop_pool_size() + 1;
     }
     if (stored_nthreads != nthreads) {
       TORCH_WARN(
@@ -209,7 +299,7 @@ int get_num_threads() {
     return intraop_default_num_threads();
   } else {
     TORCH_INTERNAL_ASSERT(nthreads == CONSUMED);
-    return _get_intraop_pool().size() + 1;
+    return _intraop_pool_size() + 1;
   }
 #else
   caffe2::ThreadPool* pool = caffe2::mobile_threadpool();
@@ -28,6 +28,14 @@ CAFFE2_API void _parallel_run(
   const int64_t grain_size,
   const std::function<void(int64_t, int64_t, size_t)>& f);
 
+// Hints that the next parallel region on this thread streams over
+// [data, data + nbytes).  With NUMA enabled on a multi-node machine, chunks
+// are then scheduled on the per-node pool whose node owns the corresponding
+// pages; without the hint, contiguous blocks of chunks go to each node.
+// The hint is consumed by the next parallel region and is a no-op when NUMA
+// is disabled or unavailable.
+CAFFE2_API void set_numa_locality_hint(const void* data, size_t nbytes);
+
 } // namespace internal
 
 template <class F>
@@ -39,7 +39,9 @@ std::shared_ptr<TaskThreadPoolBase> create_c10_threadpool(
   TORCH_CHECK(device_id == 0);
   // Create new thread pool
   TORCH_CHECK(create_new);
-  return std::make_shared<PTThreadPool>(pool_size);
+  // Work-stealing pool: keeps fine-grained fork/join tasks (prim::fork)
+  // from serializing on a single queue lock.
+  return std::make_shared<PTWorkStealingThreadPool>(pool_size);
 }
 
 } // namespace
@@ -113,6 +113,8 @@ void SparseTensorImpl::set_indices_and_values_unsafe(const Tensor& indices, cons
   AT_ASSERT(values_.device() == indices_.device());
 
   coalesced_ = false;
+  csr_cache_ = Tensor();
+  coalesced_prefix_ = 0;
 }
 
 
@@ -29,6 +29,24 @@ struct CAFFE2_API SparseTensorImpl : public TensorImpl {
   // because many algorithms proceed by merging two sorted lists (of indices).
   bool coalesced_ = false;
 
+  // Lazily built CSR row pointer array (shape: (size(0) + 1,), Long) for
+  // 2-dimensional coalesced tensors, where the sorted row indices make the
+  // conversion a single scan.  Kernels that repeatedly consume the same
+  // sparse tensor (e.g. addmm) cache the conversion here.  The cache is
+  // keyed on the version of indices_ at build time, so in-place mutation
+  // through _indices() invalidates it; functions that replace indices_
+  // wholesale must clear it explicitly.
+  mutable Tensor csr_cache_;
+  mutable uint32_t csr_cache_indices_version_ = 0;
+
+  // Number of leading nnz entries known to be sorted and duplicate-free
+  // (i.e. a coalesced prefix).  Operations that append entries to a
+  // coalesced tensor (e.g. sparse add via concatenation) record the length
+  // of the surviving prefix so that coalesce() only has to sort and merge
+  // the appended tail instead of re-sorting all nnz entries.  0 means no
+  // prefix is known.
+  int64_t coalesced_prefix_ = 0;
+
 public:
   // Public for now...
   explicit SparseTensorImpl(at::DispatchKeySet, const caffe2::TypeMeta&);
@@ -164,12 +182,41 @@ public:
     coalesced_ = coalesced;
   }
 
+  int64_t coalesced_prefix() const { return coalesced_prefix_; }
+
+  void set_coalesced_prefix(int64_t coalesced_prefix) {
+    TORCH_CHECK(allow_tensor_metadata_change(), "set_coalesced_prefix ", err_msg_tensor_metadata_change_not_allowed);
+    AT_ASSERT(coalesced_prefix >= 0 && coalesced_prefix <= nnz());
+    coalesced_prefix_ = coalesced_prefix;
+  }
+
   // NOTE: this function is only used internally and not exposed to Python frontend
   void set_nnz_and_narrow(int64_t new_nnz) {
     TORCH_CHECK(allow_tensor_metadata_change(), "set_nnz_and_narrow ", err_msg_tensor_metadata_change_not_allowed);
     AT_ASSERT(new_nnz <= nnz());
     indices_ = indices_.narrow(1, 0, new_nnz);
     values_ = values_.narrow(0, 0, new_nnz);
+    csr_cache_ = Tensor();
+    if (coalesced_prefix_ > new_nnz) {
+      coalesced_prefix_ = new_nnz;
+    }
+  }
+
+  // Returns the cached CSR row pointer array, or an undefined tensor if no
+  // cache is present or the indices changed since it was built.
+  Tensor csr_cache() const {
+    if (csr_cache_.defined() &&
+        csr_cache_indices_version_ ==
+            indices_.unsafeGetTensorImpl()->version_counter().current_version()) {
+      return csr_cache_;
+    }
+    return Tensor();
+  }
+
+  void set_csr_cache(const Tensor& csr) const {
+    csr_cache_ = csr;
+    csr_cache_indices_version_ =
+        indices_.unsafeGetTensorImpl()->version_counter().current_version();
   }
 
   // Takes indices and values and directly puts them into the sparse tensor, no copy.
@@ -238,6 +285,8 @@ private:
     dest_sparse_impl->indices_ = src_sparse_impl->indices();
     dest_sparse_impl->values_ = src_sparse_impl->values();
     dest_sparse_impl->coalesced_ = src_sparse_impl->coalesced();
+    dest_sparse_impl->csr_cache_ = Tensor();
+    dest_sparse_impl->coalesced_prefix_ = src_sparse_impl->coalesced_prefix();
   }
 };
 
@@ -0,0 +1,161 @@
+// Microbenchmarks for DispatchStub-selected CPU kernels.
+//
+// DispatchStub picks the fastest kernel variant the machine supports
+// (DEFAULT, AVX or AVX2), so a vectorization regression in one variant is
+// invisible as long as the others still win. This harness times each op
+// once per capability, by overriding the capability DispatchStub sees and
+// clearing the stub's cached choice between runs. Calls go through the
+// regular at:: entry points, so every variant pays the same (small, fixed)
+// dispatch overhead and differences between rows are differences in the
+// kernels themselves.
+//
+// Benchmark arguments are {capability, numel}, where capability is the
+// integer value of at::native::CPUCapability (0 = DEFAULT, 1 = AVX,
+// 2 = AVX2). The sweep is clamped to what the host actually supports;
+// running AVX2 code on a non-AVX2 machine would SIGILL, not fall back.
+//
+// Example:
+//   ./dispatch_stub_benchmark --benchmark_filter=BM_Add
+
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/BinaryOps.h>
+#include <ATen/native/DispatchStub.h>
+#include <ATen/native/ReduceOps.h>
+#include <ATen/native/UnaryOps.h>
+
+#include <benchmark/benchmark.h>
+
+namespace {
+
+using at::native::CPUCapability;
+
+// The capability the machine really has. Must be read before the first
+// override is installed, which the static below guarantees.
+CPUCapability detected_capability() {
+  static CPUCapability capability = at::native::get_cpu_capability();
+  return capability;
+}
+
+// Installs `capability` as the one DispatchStub reports and clears the
+// stub's cached kernel so the next call re-selects. Returns false (and
+// skips the benchmark) for capabilities beyond what this machine supports.
+template <typename Stub>
+bool override_capability(Stub& stub, benchmark::State& state) {
+  auto capability = static_cast<CPUCapability>(state.range(0));
+  if (capability > detected_capability()) {
+    state.SkipWithError("capability not supported on this machine");
+    return false;
+  }
+  at::native::set_cpu_capability_override(capability);
+  stub.reset_cpu_impl();
+  return true;
+}
+
+// Restores normal dispatch so that code running between benchmarks is not
+// affected by the last override.
+template <typename Stub>
+void restore_capability(Stub& stub) {
+  at::native::set_cpu_capability_override(CPUCapability::NUM_OPTIONS);
+  stub.reset_cpu_impl();
+}
+
+// {capability, numel} grid shared by all benchmarks. The shapes cover the
+// vector-width-bound small sizes through memory-bound large ones.
+void CapabilityShapeArgs(benchmark::internal::Benchmark* b) {
+  for (int capability = 0;
+       capability <= static_cast<int>(detected_capability());
+       ++capability) {
+    for (int64_t numel : {256, 4096, 65536, 1048576}) {
+      b->Args({capability, numel});
+    }
+  }
+}
+
+void BM_Add(benchmark::State& state) {
+  if (!override_capability(at::native::add_stub, state)) {
+    return;
+  }
+  const int64_t numel = state.range(1);
+  auto a = at::rand({numel});
+  auto b = at::rand({numel});
+  auto out = at::empty({numel}, a.options());
+  while (state.KeepRunning()) {
+    at::add_out(out, a, b);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * numel);
+  restore_capability(at::native::add_stub);
+}
+BENCHMARK(BM_Add)->Apply(CapabilityShapeArgs);
+
+void BM_Mul(benchmark::State& state) {
+  if (!override_capability(at::native::mul_stub, state)) {
+    return;
+  }
+  const int64_t numel = state.range(1);
+  auto a = at::rand({numel});
+  auto b = at::rand({numel});
+  auto out = at::empty({numel}, a.options());
+  while (state.KeepRunning()) {
+    at::mul_out(out, a, b);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * numel);
+  restore_capability(at::native::mul_stub);
+}
+BENCHMARK(BM_Mul)->Apply(CapabilityShapeArgs);
+
+void BM_Exp(benchmark::State& state) {
+  if (!override_capability(at::native::exp_stub, state)) {
+    return;
+  }
+  const int64_t numel = state.range(1);
+  auto a = at::rand({numel});
+  auto out = at::empty({numel}, a.options());
+  while (state.KeepRunning()) {
+    at::exp_out(out, a);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * numel);
+  restore_capability(at::native::exp_stub);
+}
+BENCHMARK(BM_Exp)->Apply(CapabilityShapeArgs);
+
+void BM_Sqrt(benchmark::State& state) {
+  if (!override_capability(at::native::sqrt_stub, state)) {
+    return;
+  }
+  const int64_t numel = state.range(1);
+  auto a = at::rand({numel});
+  auto out = at::empty({numel}, a.options());
+  while (state.KeepRunning()) {
+    at::sqrt_out(out, a);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * numel);
+  restore_capability(at::native::sqrt_stub);
+}
+BENCHMARK(BM_Sqrt)->Apply(CapabilityShapeArgs);
+
+void BM_Sum(benchmark::State& state) {
+  if (!override_capability(at::native::sum_stub, state)) {
+    return;
+  }
+  const int64_t numel = state.range(1);
+  auto a = at::rand({numel});
+  auto out = at::empty({}, a.options());
+  while (state.KeepRunning()) {
+    at::sum_out(out, a, /*dim=*/{0});
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * numel);
+  restore_capability(at::native::sum_stub);
+}
+BENCHMARK(BM_Sum)->Apply(CapabilityShapeArgs);
+
+} // namespace
+
+int main(int argc, char** argv) {
+  // Pin intra-op parallelism to one thread so we compare kernels, not the
+  // work partitioner.
+  at::set_num_threads(1);
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -62,7 +62,8 @@ inline size_t DictKeyHash::operator()(const IValue& ivalue) const {
   if (ivalue.isInt()) {
     return std::hash<int>()(ivalue.toInt());
   } else if (ivalue.isString()) {
-    return std::hash<std::string>()(ivalue.toStringRef());
+    // ConstantString caches its hash; see NOTE [ Interned IValue strings ]
+    return ivalue.toString()->hash();
   } else if (ivalue.isDouble()) {
     return std::hash<double>()(ivalue.toDouble());
   } else if (ivalue.isBool()) {
@@ -75,6 +76,19 @@ inline size_t DictKeyHash::operator()(const IValue& ivalue) const {
   }
 }
 
+inline bool DictKeyEqualTo::operator()(const IValue& lhs, const IValue& rhs) const {
+  if (lhs.isString() && rhs.isString()) {
+    // Interned strings share a single ConstantString (see
+    // NOTE [ Interned IValue strings ]), so equal keys usually compare
+    // equal as pointers without touching the characters.
+    if (lhs.internalToPointer() == rhs.internalToPointer()) {
+      return true;
+    }
+    return lhs.toStringRef() == rhs.toStringRef();
+  }
+  return impl::shallowEquals(lhs, rhs);
+}
+
 inline intrusive_ptr<DictImpl> DictImpl::copy() const {
   return make_intrusive<DictImpl>(dict, elementTypes);
 }
@@ -6,12 +6,18 @@
 #include <c10/util/intrusive_ptr.h>
 #include <c10/util/ArrayRef.h>
 #include <c10/util/Optional.h>
+#include <c10/util/SmallVector.h>
+#include <stdexcept>
 #include <vector>
 
 namespace at {
 class Tensor;
 }
 namespace c10 {
+// Note: ListImpl stores a few IValues inline, so IValue must be complete
+// when this header's body is parsed. Include <ATen/core/ivalue.h> before
+// this header; the usual path (ivalue.h -> ivalue_inl.h -> List.h) already
+// guarantees this.
 struct IValue;
 template<class T> class List;
 struct Type;
@@ -20,7 +26,10 @@ using TypePtr = std::shared_ptr<Type>;
 namespace detail {
 
 struct ListImpl final : public c10::intrusive_ptr_target {
-  using list_type = std::vector<IValue>;
+  // Small lists (e.g. 2-4 element prim::ListConstruct results, sizes and
+  // strides) dominate in practice; keeping a few elements inline in the
+  // ListImpl avoids a second heap allocation for them.
+  using list_type = c10::SmallVector<IValue, 4>;
 
   explicit ListImpl(list_type list_, TypePtr elementType_)
   : list(std::move(list_))
@@ -30,6 +39,21 @@ struct ListImpl final : public c10::intrusive_ptr_target {
 
   TypePtr elementType;
 
+  // bounds-checked access; SmallVector::at only asserts, but the List API
+  // promises std::out_of_range (which e.g. pybind translates to IndexError)
+  IValue& at(size_t pos) {
+    if (pos >= list.size()) {
+      throw std::out_of_range("list index out of range");
+    }
+    return list[pos];
+  }
+  const IValue& at(size_t pos) const {
+    if (pos >= list.size()) {
+      throw std::out_of_range("list index out of range");
+    }
+    return list[pos];
+  }
+
   intrusive_ptr<ListImpl> copy() const {
     return make_intrusive<ListImpl>(list, elementType);
   }
@@ -132,28 +132,28 @@ void swap(ListElementReference<T, Iterator>&& lhs, ListElementReference<T, Itera
 
 template<class T>
 void List<T>::set(size_type pos, const value_type& value) const {
-  impl_->list.at(pos) = detail::list_element_from<T>(value);
+  impl_->at(pos) = detail::list_element_from<T>(value);
 }
 
 template<class T>
 void List<T>::set(size_type pos, value_type&& value) const {
-  impl_->list.at(pos) = detail::list_element_from<T>(std::move(value));
+  impl_->at(pos) = detail::list_element_from<T>(std::move(value));
 }
 
 template<class T>
 typename List<T>::value_type List<T>::get(size_type pos) const {
-  return detail::list_element_to<T>(impl_->list.at(pos));
+  return detail::list_element_to<T>(impl_->at(pos));
 }
 
 template<class T>
 typename List<T>::internal_reference_type List<T>::operator[](size_type pos) const {
-  static_cast<void>(impl_->list.at(pos)); // Throw the exception if it is out of range.
+  static_cast<void>(impl_->at(pos)); // Throw the exception if it is out of range.
   return {impl_->list.begin() + pos};
 }
 
 template<class T>
 typename List<T>::value_type List<T>::extract(size_type pos) const {
-  auto& elem = impl_->list.at(pos);
+  auto& elem = impl_->at(pos);
   auto result = detail::list_element_to<T>(std::move(elem));
   // Reset the list element to a T() instead of None to keep it correctly typed
   elem = detail::list_element_from<T>(T{});
@@ -204,7 +204,11 @@ template<class T>
 template<class... Args>
 typename List<T>::iterator List<T>::emplace(iterator pos, Args&&... value) const {
   // TODO Use list_element_from?
-  return iterator { impl_->list.emplace(pos.iterator_, std::forward<Args>(value)...) };
+  // SmallVector has no emplace(pos, ...); constructing the element first is
+  // equivalent here since the list stores IValues by value anyway.
+  return iterator { impl_->list.insert(
+      pos.iterator_,
+      typename detail::ListImpl::list_type::value_type(std::forward<Args>(value)...)) };
 }
 
 template<class T>
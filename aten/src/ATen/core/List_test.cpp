@@ -1,3 +1,4 @@
+#include <ATen/core/ivalue.h>
 #include <ATen/core/List.h>
 #include <gtest/gtest.h>
 
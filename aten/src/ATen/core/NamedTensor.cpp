@@ -1,25 +1,27 @@
 #include <ATen/core/NamedTensor.h>
 
 #include <ATen/core/Tensor.h>
+#include <c10/core/impl/LocalDispatchKeySet.h>
 #include <c10/util/C++17.h>
 
 namespace at {
 
-bool NamedTensorMeta::has_names() const {
-  return !std::all_of(
+void NamedTensorMeta::refresh_has_names() {
+  has_names_ = !std::all_of(
       names_.begin(), names_.end(), [](const Dimname& n) {
         return n.type() == NameType::WILDCARD;
       });
 }
 
-thread_local bool NamesMode_enabled = true;
+// Stored (inverted) in the consolidated per-thread state block next to
+// the dispatch key sets and GradMode; see PODLocalState.
 
 bool NamesMode::is_enabled() {
-  return NamesMode_enabled;
+  return !c10::impl::tls_local_state_ptr()->names_mode_disabled;
 }
 
 void NamesMode::set_enabled(bool enabled) {
-   NamesMode_enabled = enabled;
+  c10::impl::tls_local_state_ptr()->names_mode_disabled = !enabled;
 }
 
 Tensor& internal_set_names_inplace(Tensor& tensor, optional<DimnameList> names) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ATen/core/Dimname.h>
+#include <ATen/core/DimVector.h>
 #include <c10/core/TensorImpl.h>
 #include <c10/util/C++17.h>
 
@@ -14,22 +15,35 @@ namespace at {
 // can be refactored out. The main blocker for that is that "c10::Symbol"
 // actually exists outside of c10 and needs to be moved in.
 
+// Inline storage for dimension names. Sized to match at::DimVector so that
+// tensors with up to kDimVectorStaticSize dims keep their names without
+// touching the heap.
+using DimnameVector = SmallVector<Dimname, kDimVectorStaticSize>;
+
 // TensorImpl has a unique_ptr<NamedTensorMetaInterface> field.
 // XXX: Ideally we would just put optional<vector<Dimname>> into TensorImpl.
 struct CAFFE2_API NamedTensorMeta : public c10::NamedTensorMetaInterface {
   explicit NamedTensorMeta(int64_t num_names)
-    : names_(std::vector<Dimname>(num_names, Dimname::wildcard())) {}
+    : names_(num_names, Dimname::wildcard()) {
+    refresh_has_names();
+  }
 
   explicit NamedTensorMeta(DimnameList names)
-    : names_(names.vec()) {}
+    : names_(names.begin(), names.end()) {
+    refresh_has_names();
+  }
   explicit NamedTensorMeta(std::vector<Dimname>&& names)
-    : names_(std::move(names)) {}
+    : names_(names.begin(), names.end()) {
+    refresh_has_names();
+  }
 
   std::unique_ptr<c10::NamedTensorMetaInterface> clone() const override {
-    return std::make_unique<NamedTensorMeta>(names_);
+    return std::make_unique<NamedTensorMeta>(names());
   }
 
-  bool has_names() const;
+  // Precomputed on every names change so that impl::has_names costs a flag
+  // load instead of a scan over names_.
+  bool has_names() const { return has_names_; }
   DimnameList names() const { return names_; }
 
   // Used for an assertion in TensorImpl.h
@@ -40,15 +54,20 @@ struct CAFFE2_API NamedTensorMeta : public c10::NamedTensorMetaInterface {
   void set_names(DimnameList new_names) {
     TORCH_INTERNAL_ASSERT(new_names.size() == names_.size());
     std::copy(new_names.begin(), new_names.end(), names_.begin());
+    refresh_has_names();
   }
 
   void set_names(std::vector<Dimname>&& new_names) {
     TORCH_INTERNAL_ASSERT(new_names.size() == names_.size());
-    names_ = std::move(new_names);
+    names_.assign(new_names.begin(), new_names.end());
+    refresh_has_names();
   }
 
  private:
-  std::vector<Dimname> names_;
+  void refresh_has_names();
+
+  DimnameVector names_;
+  bool has_names_;
 };
 
 // When NamesMode is disabled, then all operations ignore tensors' names fields.
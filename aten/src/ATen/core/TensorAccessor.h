@@ -15,12 +15,10 @@ struct DefaultPtrTraits {
   typedef T* PtrType;
 };
 
-#if defined(__CUDACC__) || defined(__HIPCC__)
 template <typename T>
 struct RestrictPtrTraits {
-  typedef T* __restrict__ PtrType;
+  typedef T* C10_RESTRICT PtrType;
 };
-#endif
 
 // TensorAccessorBase and TensorAccessor are used for both CPU and CUDA tensors.
 // For CUDA tensors it is used in device code (only). This means that we restrict ourselves
@@ -104,6 +102,79 @@ public:
 };
 
 
+// `TensorAccessor::operator[]` does no range checking, so indexing is already
+// as cheap as the stride multiply; the alias exists so call sites can spell
+// out the contract they rely on. Combine with `RestrictPtrTraits` to also
+// promise the compiler that the data does not alias other pointers in the
+// loop.
+template<typename T, size_t N, template <typename U> class PtrTraits = DefaultPtrTraits, typename index_t = int64_t>
+using TensorAccessorUnchecked = TensorAccessor<T, N, PtrTraits, index_t>;
+
+// `StaticTensorAccessor` fixes the full shape at compile time via template
+// arguments and assumes the tensor is contiguous, so the strides are
+// compile-time constants and element access lowers to raw pointer arithmetic
+// the vectorizer can reason about. Combined with `RestrictPtrTraits` the
+// inner loops carry no runtime size/stride state at all. Instantiate for CPU
+// `Tensor`s via `Tensor.static_accessor<T, Sizes...>()` (or
+// `static_restrict_accessor` for a `__restrict__` data pointer).
+template<typename T, template <typename U> class PtrTraits, size_t... Sizes>
+class StaticTensorAccessor;
+
+template<typename T, template <typename U> class PtrTraits, size_t Size0, size_t Size1, size_t... Sizes>
+class StaticTensorAccessor<T, PtrTraits, Size0, Size1, Sizes...> {
+public:
+  typedef typename PtrTraits<T>::PtrType PtrType;
+  typedef StaticTensorAccessor<T, PtrTraits, Size1, Sizes...> SubAccessor;
+  static constexpr size_t kSize = Size0;
+  static constexpr size_t kNumel = Size0 * SubAccessor::kNumel;
+
+  C10_HOST_DEVICE explicit StaticTensorAccessor(PtrType data_) : data_(data_) {}
+
+  C10_HOST_DEVICE SubAccessor operator[](size_t i) {
+    return SubAccessor(this->data_ + SubAccessor::kNumel * i);
+  }
+
+  C10_HOST_DEVICE const SubAccessor operator[](size_t i) const {
+    return SubAccessor(this->data_ + SubAccessor::kNumel * i);
+  }
+
+  C10_HOST_DEVICE PtrType data() {
+    return data_;
+  }
+  C10_HOST_DEVICE const PtrType data() const {
+    return data_;
+  }
+protected:
+  PtrType data_;
+};
+
+template<typename T, template <typename U> class PtrTraits, size_t Size0>
+class StaticTensorAccessor<T, PtrTraits, Size0> {
+public:
+  typedef typename PtrTraits<T>::PtrType PtrType;
+  static constexpr size_t kSize = Size0;
+  static constexpr size_t kNumel = Size0;
+
+  C10_HOST_DEVICE explicit StaticTensorAccessor(PtrType data_) : data_(data_) {}
+
+  C10_HOST_DEVICE T & operator[](size_t i) {
+    return this->data_[i];
+  }
+  C10_HOST_DEVICE const T & operator[](size_t i) const {
+    return this->data_[i];
+  }
+
+  C10_HOST_DEVICE PtrType data() {
+    return data_;
+  }
+  C10_HOST_DEVICE const PtrType data() const {
+    return data_;
+  }
+protected:
+  PtrType data_;
+};
+
+
 // GenericPackedTensorAccessorBase and GenericPackedTensorAccessor are used on for CUDA `Tensor`s on the host
 // and as
 // In contrast to `TensorAccessor`s, they copy the strides and sizes on instantiation (on the host)
@@ -26,6 +26,48 @@ using not_ok_to_box = guts::negation<guts::disjunction<
 
 // TODO boxing should be ok for all kernels. Then remove not_ok_to_box and supports_boxing.
 
+namespace detail {
+
+// RAII handle onto a thread-local pool of stack vectors whose capacity is
+// retained across boxed calls, so the per-call std::vector<IValue> heap
+// allocation is only paid the first few times an op is called on a thread.
+// A pool (rather than a single buffer) is needed because a boxed kernel may
+// itself make boxed calls; the pool depth is bounded by the call nesting
+// depth. The stack is cleared before being returned to the pool so no
+// IValues (e.g. tensors) are kept alive between calls.
+class BoxedStackGuard final {
+ public:
+  BoxedStackGuard() {
+    auto& pool = pool_();
+    if (!pool.empty()) {
+      stack_ = std::move(pool.back());
+      pool.pop_back();
+    }
+  }
+
+  ~BoxedStackGuard() {
+    stack_.clear();
+    pool_().push_back(std::move(stack_));
+  }
+
+  BoxedStackGuard(const BoxedStackGuard&) = delete;
+  BoxedStackGuard& operator=(const BoxedStackGuard&) = delete;
+
+  torch::jit::Stack& stack() {
+    return stack_;
+  }
+
+ private:
+  static std::vector<torch::jit::Stack>& pool_() {
+    static thread_local std::vector<torch::jit::Stack> pool;
+    return pool;
+  }
+
+  torch::jit::Stack stack_;
+};
+
+}
+
 template <class Result, class... Args>
 using supports_boxing =
   guts::negation<guts::disjunction<
@@ -44,8 +86,8 @@ Result boxAndCallBoxedFunc(KernelFunction::InternalBoxedKernelFunction* boxed_ke
 template<class Result, class... Args>
 std::enable_if_t<supports_boxing<Result, Args...>::value && !std::is_same<void, Result>::value, Result>
 boxAndCallBoxedFunc(KernelFunction::InternalBoxedKernelFunction* boxed_kernel_func, OperatorKernel* functor, const OperatorHandle& opHandle, Args... args) {
-  // TODO Reuse stack vector instead of allocating?
-  torch::jit::Stack stack;
+  detail::BoxedStackGuard stack_guard;
+  torch::jit::Stack& stack = stack_guard.stack();
   torch::jit::push(stack, std::forward<Args>(args)...);
 
   (*boxed_kernel_func)(functor, opHandle, &stack);
@@ -58,8 +100,8 @@ boxAndCallBoxedFunc(KernelFunction::InternalBoxedKernelFunction* boxed_kernel_fu
 template<class Result, class... Args>
 std::enable_if_t<supports_boxing<Result, Args...>::value && std::is_same<void, Result>::value, Result>
 boxAndCallBoxedFunc(KernelFunction::InternalBoxedKernelFunction* boxed_kernel_func, OperatorKernel* functor, const OperatorHandle& opHandle, Args... args) {
-  // TODO Reuse stack vector instead of allocating?
-  torch::jit::Stack stack;
+  detail::BoxedStackGuard stack_guard;
+  torch::jit::Stack& stack = stack_guard.stack();
   torch::jit::push(stack, std::forward<Args>(args)...);
 
   (*boxed_kernel_func)(functor, opHandle, &stack);
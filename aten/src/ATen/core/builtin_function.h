@@ -29,6 +29,13 @@ struct BuiltinOpFunction : public Function {
     callable_(stack);
   }
 
+  // Exposed so callers that have already established the callee never
+  // changes (e.g. the interpreter's per-callsite call cache) can invoke
+  // the underlying callable without virtual dispatch.
+  const std::function<void(Stack&)>& getCallable() const {
+    return callable_;
+  }
+
   at::IValue operator()(std::vector<at::IValue> stack, const Kwargs& kwargs)
       override {
     getSchema().checkAndNormalizeInputs(stack, kwargs);
@@ -96,6 +96,7 @@ class DispatchTable final {
    */
   void setKernel(DispatchKey dispatchKey, KernelFunction kernel) {
     auto result = kernels_.setKernel(dispatchKey, std::move(kernel));
+    invalidateKernelCache();
     dispatchKeyExtractor_.setOperatorHasKernelForBackend(dispatchKey, true);
     if (result == impl::KernelFunctionTable::SetKernelResult::OVERWROTE_EXISTING_KERNEL) {
       TORCH_WARN("Registered a kernel for operator ", operatorName_, " with dispatch key ", toString(dispatchKey), " that overwrote a previously registered kernel with the same dispatch key for the same operator.");
@@ -109,6 +110,7 @@ class DispatchTable final {
    */
   void removeKernelIfExists(DispatchKey dispatchKey) {
     kernels_.removeKernelIfExists(dispatchKey);
+    invalidateKernelCache();
     dispatchKeyExtractor_.setOperatorHasKernelForBackend(dispatchKey, false);
   }
 
@@ -123,6 +125,7 @@ class DispatchTable final {
       TORCH_WARN("Registered a catch-all kernel for operator ", operatorName_," that overwrote a previously registered catch-all kernel for the same operator.");
     }
     catchallKernel_ = std::move(kernel);
+    invalidateKernelCache();
   }
 
   /**
@@ -131,12 +134,17 @@ class DispatchTable final {
   void removeCatchallKernel() {
     TORCH_INTERNAL_ASSERT(catchallKernel_.isValid(), "Tried to remove the catch-all kernel for operator ", operatorName_," but there is no catch-all kernel registered.");
     catchallKernel_ = {};
+    invalidateKernelCache();
   }
 
   bool isEmpty() const {
     return !catchallKernel_.isValid() && kernels_.size() == 0;
   }
 
+  bool hasBackendKernels() const {
+    return kernels_.size() != 0;
+  }
+
   std::string listAllDispatchKeys() const {
     std::ostringstream str;
     str << "[";
@@ -188,12 +196,54 @@ class DispatchTable final {
     return operatorName_;
   }
 
+  // Inline cache of the last resolved (dispatch key, kernel) pair, so that
+  // steady-state dispatch of an operator repeatedly called with the same
+  // dispatch key is one compare plus an indirect call instead of the full
+  // kernel/backend-fallback/catchall resolution (see Dispatcher::dispatch_).
+  // Key and pointer are packed into one word (key in the high 8 bits,
+  // pointer in the low 56, which covers canonical addresses on the platforms
+  // we support) so that concurrent callers can read and refill the cache
+  // without locking or torn key/pointer pairs. Zero means empty. The cache
+  // is invalidated whenever this table or the backend fallback table
+  // changes, under the same assumption the rest of the dispatch table makes:
+  // kernel registration does not race with calls to the operator.
+
+  const KernelFunction* lookupCachedKernel(DispatchKey dispatchKey) const {
+    const uint64_t packed = resolvedKernelCache_.load(std::memory_order_relaxed);
+    if (packed != 0 && static_cast<DispatchKey>(packed >> kKernelCacheKeyShift) == dispatchKey) {
+      return reinterpret_cast<const KernelFunction*>(packed & kKernelCachePtrMask);
+    }
+    return nullptr;
+  }
+
+  void cacheKernel(DispatchKey dispatchKey, const KernelFunction* kernel) const {
+    const uint64_t ptr_bits = reinterpret_cast<uint64_t>(kernel);
+    if ((ptr_bits & ~kKernelCachePtrMask) != 0) {
+      // The pointer doesn't fit in the packed word; leave the cache empty.
+      return;
+    }
+    resolvedKernelCache_.store(
+        ptr_bits | (static_cast<uint64_t>(static_cast<uint8_t>(dispatchKey)) << kKernelCacheKeyShift),
+        std::memory_order_relaxed);
+  }
+
+  void invalidateKernelCache() const {
+    resolvedKernelCache_.store(0, std::memory_order_relaxed);
+  }
+
 private:
+  static constexpr int kKernelCacheKeyShift = 56;
+  static constexpr uint64_t kKernelCachePtrMask =
+      (static_cast<uint64_t>(1) << kKernelCacheKeyShift) - 1;
+  static_assert(
+      sizeof(DispatchKey) == 1,
+      "DispatchKey must fit in the high 8 bits of the packed kernel cache");
 
   impl::KernelFunctionTable kernels_;
   KernelFunction catchallKernel_;
   DispatchKeyExtractor dispatchKeyExtractor_;
   std::string operatorName_;
+  mutable std::atomic<uint64_t> resolvedKernelCache_{0};
 };
 
 } // namespace c10
@@ -133,6 +133,7 @@ RegistrationHandleRAII Dispatcher::registerBackendFallbackKernel(DispatchKey dis
   if (kernel.isFallthrough()) {
     backendsWithoutFallthrough_ = backendsWithoutFallthrough_.remove(dispatchKey);
   }
+  invalidateKernelCaches_();
 
   return RegistrationHandleRAII([this, dispatchKey] {
     deregisterBackendFallbackKernel_(dispatchKey);
@@ -143,6 +144,16 @@ void Dispatcher::deregisterBackendFallbackKernel_(DispatchKey dispatchKey) {
   auto result = backendFallbackKernels_.removeKernelIfExists(dispatchKey);
   backendsWithoutFallthrough_ = backendsWithoutFallthrough_.add(dispatchKey);
   TORCH_INTERNAL_ASSERT(result == impl::KernelFunctionTable::RemoveKernelIfExistsResult::REMOVED_KERNEL, "Tried to deregister a backend fallback kernel for ", dispatchKey, " but there was none registered.");
+  invalidateKernelCaches_();
+}
+
+void Dispatcher::invalidateKernelCaches_() {
+  // Cached resolutions may point into the backend fallback table, so any
+  // change to it invalidates every operator's inline cache.
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto& op : operators_) {
+    op.op.invalidateKernelCache();
+  }
 }
 
 RegistrationHandleRAII Dispatcher::registerKernel(const OperatorHandle& op, c10::optional<DispatchKey> dispatch_key, KernelFunction kernel) {
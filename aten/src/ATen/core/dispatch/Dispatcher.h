@@ -156,6 +156,7 @@ private:
 
   void deregisterSchema_(const OperatorHandle& op, const OperatorName& op_name);
   void deregisterBackendFallbackKernel_(DispatchKey dispatchKey);
+  void invalidateKernelCaches_();
   [[noreturn]] static void reportError(const DispatchTable& dispatchTable, DispatchKey dispatchKey);
 
   const KernelFunction& dispatch_(const DispatchTable& dispatchTable, DispatchKey dispatch_key) const;
@@ -201,6 +202,22 @@ public:
     c10::Dispatcher::singleton().callBoxed(*this, stack);
   }
 
+  /**
+   * If this operator's dispatch table consists of exactly one catch-all
+   * kernel and no backend kernels, resolution cannot depend on the
+   * arguments; returns that kernel so callers can bind it once instead of
+   * re-resolving on every call (see the mobile interpreter). Returns
+   * nullptr otherwise. The pointer stays valid for as long as the kernel's
+   * registration does.
+   */
+  const KernelFunction* singleCatchallKernel() const {
+    const auto& dispatchTable = operatorIterator_->op.dispatch_table();
+    if (dispatchTable.hasBackendKernels()) {
+      return nullptr;
+    }
+    return dispatchTable.lookupCatchallKernel();
+  }
+
 private:
   explicit OperatorHandle(std::list<Dispatcher::OperatorDef>::iterator operatorIterator)
   : operatorIterator_(std::move(operatorIterator)) {}
@@ -238,19 +255,29 @@ inline void Dispatcher::callBoxed(const OperatorHandle& op, Stack* stack) const
 }
 
 inline const KernelFunction& Dispatcher::dispatch_(const DispatchTable& dispatchTable, DispatchKey dispatchKey) const {
+  // Inline cache of the last resolution; see the notes on
+  // DispatchTable::lookupCachedKernel for layout and invalidation.
+  const KernelFunction* cachedKernel = dispatchTable.lookupCachedKernel(dispatchKey);
+  if (C10_LIKELY(nullptr != cachedKernel)) {
+    return *cachedKernel;
+  }
+
   const KernelFunction* backendKernel = dispatchTable.lookup(dispatchKey);
 
   if (nullptr != backendKernel) {
+    dispatchTable.cacheKernel(dispatchKey, backendKernel);
     return *backendKernel;
   }
 
   const auto& backendFallbackKernel = backendFallbackKernels_[dispatchKey];
   if (backendFallbackKernel.isValid()) {
+    dispatchTable.cacheKernel(dispatchKey, &backendFallbackKernel);
     return backendFallbackKernel;
   }
 
   const KernelFunction* catchallKernel = dispatchTable.lookupCatchallKernel();
   if (C10_LIKELY(nullptr != catchallKernel)) {
+    dispatchTable.cacheKernel(dispatchKey, catchallKernel);
     return *catchallKernel;
   }
 
@@ -31,6 +31,12 @@ public:
     return dispatchTable_;
   }
 
+  // Drops the resolved-kernel inline cache; called by the Dispatcher when the
+  // backend fallback table changes, since cached resolutions may refer to it.
+  void invalidateKernelCache() {
+    dispatchTable_.invalidateKernelCache();
+  }
+
   void prepareForDeregistration();
 
   RegistrationHandleRAII registerKernel(c10::optional<DispatchKey> dispatch_key, KernelFunction kernel);
@@ -1,5 +1,8 @@
 #include <ATen/core/grad_mode.h>
 
+#include <c10/core/InferenceMode.h>
+#include <c10/core/impl/LocalDispatchKeySet.h>
+
 #include <stdexcept>
 
 namespace at {
@@ -10,14 +13,20 @@ namespace at {
 /// is on.
 #if !defined(C10_MOBILE) || defined(FEATURE_TORCH_MOBILE)
 
-thread_local bool GradMode_enabled = true;
+// The flag lives in the consolidated per-thread state block (shared with
+// the dispatch key sets and NamesMode) so that hot paths pay for a single
+// TLS slot instead of one per mode; it is stored inverted because the
+// block is zero-initialized and grad mode defaults to enabled.
 
 bool GradMode::is_enabled() {
-  return GradMode_enabled;
+  // Under process-level inference mode gradients are never recorded,
+  // regardless of the thread local setting.
+  return !c10::impl::tls_local_state_ptr()->grad_mode_disabled &&
+      !c10::InferenceMode::is_enabled();
 }
 
 void GradMode::set_enabled(bool enabled) {
-  GradMode_enabled = enabled;
+  c10::impl::tls_local_state_ptr()->grad_mode_disabled = !enabled;
 }
 
 #else
@@ -35,6 +35,7 @@ namespace c10 {
   _(prim, FusionGroup)               \
   _(prim, CudaFusionGroup)           \
   _(prim, DifferentiableGraph)       \
+  _(prim, StreamSubgraph)            \
   _(prim, If)                        \
   _(prim, Jump) /* debug */          \
   _(prim, JumpNZ) /* debug */        \
@@ -90,6 +91,7 @@ namespace c10 {
   _(prim, ConstantChunk)             \
   _(prim, MMTreeReduce)              \
   _(prim, MMBatchSide)               \
+  _(prim, MMBatchStacked)            \
   _(prim, min)                       \
   _(prim, max)                       \
   _(prim, abs)                       \
@@ -253,7 +255,8 @@ namespace c10 {
   _(attr, types)                     \
   _(attr, scope)                     \
   _(attr, keepdims)                  \
-  _(attr, new_axis)
+  _(attr, new_axis)                  \
+  _(attr, profiled_trip_count)
 #else
 #define FORALL_NS_SYMBOLS(_) \
   _(namespaces, prim)              \
@@ -2,7 +2,10 @@
 #include <ATen/core/jit_type.h>
 #include <ATen/core/Formatting.h>
 #include <c10/util/StringUtil.h>
+#include <algorithm>
 #include <cmath>
+#include <mutex>
+#include <unordered_map>
 #include <ATen/core/Dict.h>
 
 namespace c10 {
@@ -21,9 +24,72 @@ void checkCustomClassType(TypePtr expected_type, TypePtr actual_type) {
               expected_type->python_str());
 }
 
+// NOTE [ Interned IValue strings ]
+//
+// Dict[str, ...] lookups hash and compare keys through DictKeyHash /
+// DictKeyEqualTo (Dict_inl.h). ConstantString caches its hash, and create()
+// interns short strings in a global atom table so that equal keys usually
+// share one ConstantString; the equality check in dict lookups then succeeds
+// on a pointer compare without touching the characters.
+//
+// The table holds weak references so interning never pins a string alive,
+// and entries whose strings have died are swept whenever the table has
+// doubled since the last sweep. Strings longer than kMaxInternedLength are
+// not interned: they are unlikely to be reused as keys and would pay the
+// table lock and key copy for nothing.
+
+namespace {
+
+constexpr size_t kMaxInternedLength = 256;
+
+struct InternedStrings {
+  std::mutex mutex;
+  std::unordered_map<std::string, c10::weak_intrusive_ptr<ConstantString>>
+      table;
+  size_t sweep_threshold = 256;
+};
+
+InternedStrings& internedStrings() {
+  static InternedStrings strings;
+  return strings;
+}
+
+void sweepExpired(InternedStrings& strings) {
+  for (auto it = strings.table.begin(); it != strings.table.end();) {
+    if (it->second.expired()) {
+      it = strings.table.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  strings.sweep_threshold = std::max<size_t>(256, strings.table.size() * 2);
+}
+
+} // namespace
+
 CAFFE2_API c10::intrusive_ptr<ConstantString> ConstantString::create(
     std::string str_) {
-  return c10::make_intrusive<ConstantString>(std::move(str_));
+  if (str_.size() > kMaxInternedLength) {
+    return c10::make_intrusive<ConstantString>(std::move(str_));
+  }
+  auto& strings = internedStrings();
+  std::lock_guard<std::mutex> lock(strings.mutex);
+  auto it = strings.table.find(str_);
+  if (it != strings.table.end()) {
+    auto interned = it->second.lock();
+    if (interned) {
+      return interned;
+    }
+    strings.table.erase(it);
+  }
+  auto interned = c10::make_intrusive<ConstantString>(std::move(str_));
+  strings.table.emplace(
+      interned->string(),
+      c10::weak_intrusive_ptr<ConstantString>(interned));
+  if (strings.table.size() >= strings.sweep_threshold) {
+    sweepExpired(strings);
+  }
+  return interned;
 }
 
 TupleTypePtr Tuple::type() const {
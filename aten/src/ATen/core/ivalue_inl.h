@@ -139,13 +139,20 @@ using Shared = c10::intrusive_ptr<T>;
 struct CAFFE2_API ConstantString final : c10::intrusive_ptr_target {
  private:
   const std::string str_;
+  const size_t hash_;
  public:
   ConstantString(std::string str)
-  : str_(std::move(str)) {}
+  : str_(std::move(str)), hash_(std::hash<std::string>()(str_)) {}
+  // create() interns: equal strings usually share a single ConstantString,
+  // so equality checks on interned strings are pointer compares. See
+  // NOTE [ Interned IValue strings ] in ivalue.cpp.
   static c10::intrusive_ptr<ConstantString> create(std::string str_);
   const std::string & string() const {
     return str_;
   }
+  size_t hash() const {
+    return hash_;
+  }
   operator const std::string & () const {
     return string();
   }
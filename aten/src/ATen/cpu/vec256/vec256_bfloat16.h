@@ -0,0 +1,572 @@
+#pragma once
+
+#include <ATen/cpu/vec256/intrinsics.h>
+#include <ATen/cpu/vec256/vec256_base.h>
+#include <c10/util/BFloat16.h>
+
+namespace at {
+namespace vec256 {
+// See Note [Acceptable use of anonymous namespace in header]
+namespace {
+
+#if defined(__AVX2__) && !defined(_MSC_VER)
+
+// Vec256<BFloat16> holds 16 bfloat16 lanes in a single __m256i. Arithmetic is
+// performed by widening to two __m256 float vectors (a bf16 value is just the
+// upper 16 bits of the corresponding float, so widening is a shift), computing
+// in float and narrowing back with round-to-nearest-even. This matches the
+// semantics of the scalar fallback, which also computes through float (see
+// c10/util/BFloat16.h), while vectorizing both the conversion and the math.
+
+static inline void cvtbf16_fp32(const __m256i& a, __m256& o1, __m256& o2) {
+  __m128i lo = _mm256_extractf128_si256(a, 0);
+  __m128i hi = _mm256_extractf128_si256(a, 1);
+  o1 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(lo), 16));
+  o2 = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(hi), 16));
+}
+
+static inline __m256i cvtfp32_bf16(const __m256& a, const __m256& b) {
+  __m256i lo = _mm256_castps_si256(a);
+  __m256i hi = _mm256_castps_si256(b);
+  __m256i nan = _mm256_set1_epi32(0xffff);
+  __m256i mask_lo = _mm256_castps_si256(_mm256_cmp_ps(a, a, _CMP_ORD_Q));
+  __m256i mask_hi = _mm256_castps_si256(_mm256_cmp_ps(b, b, _CMP_ORD_Q));
+  __m256i ones = _mm256_set1_epi32(0x1);
+  __m256i vec_bias = _mm256_set1_epi32(0x7fff);
+  // uint32_t lsb = (input >> 16) & 1;
+  auto t_lo = _mm256_and_si256(_mm256_srli_epi32(lo, 16), ones);
+  auto t_hi = _mm256_and_si256(_mm256_srli_epi32(hi, 16), ones);
+  // uint32_t rounding_bias = 0x7fff + lsb;
+  t_lo = _mm256_add_epi32(t_lo, vec_bias);
+  t_hi = _mm256_add_epi32(t_hi, vec_bias);
+  // input += rounding_bias;
+  t_lo = _mm256_add_epi32(t_lo, lo);
+  t_hi = _mm256_add_epi32(t_hi, hi);
+  // input = input >> 16;
+  t_lo = _mm256_srli_epi32(t_lo, 16);
+  t_hi = _mm256_srli_epi32(t_hi, 16);
+  // Check NaN before converting back to bf16
+  t_lo = _mm256_blendv_epi8(nan, t_lo, mask_lo);
+  t_hi = _mm256_blendv_epi8(nan, t_hi, mask_hi);
+
+  t_lo = _mm256_packus_epi32(t_lo, t_hi); // t_lo[4-7] t_hi[4-7] t_lo[0-4] t_hi[0-4]
+  return _mm256_permute4x64_epi64(t_lo, 0xd8); // 11 01 10 00
+}
+
+template <> class Vec256<BFloat16> {
+private:
+  __m256i values;
+public:
+  using value_type = BFloat16;
+  static constexpr int size() {
+    return 16;
+  }
+  Vec256() {}
+  Vec256(__m256i v) : values(v) {}
+  Vec256(BFloat16 val) {
+    value_type uw = val;
+    values = _mm256_set1_epi16(reinterpret_cast<int16_t&>(uw));
+  }
+  Vec256(BFloat16 val1, BFloat16 val2, BFloat16 val3, BFloat16 val4,
+         BFloat16 val5, BFloat16 val6, BFloat16 val7, BFloat16 val8,
+         BFloat16 val9, BFloat16 val10, BFloat16 val11, BFloat16 val12,
+         BFloat16 val13, BFloat16 val14, BFloat16 val15, BFloat16 val16) {
+    values = _mm256_setr_epi16(
+        val1.x, val2.x, val3.x, val4.x, val5.x, val6.x, val7.x, val8.x,
+        val9.x, val10.x, val11.x, val12.x, val13.x, val14.x, val15.x, val16.x);
+  }
+  operator __m256i() const {
+    return values;
+  }
+  template <int64_t mask>
+  static Vec256<BFloat16> blend(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+    __at_align32__ int16_t tmp_values[size()];
+    a.store(tmp_values);
+    if (mask & 0x01)
+      tmp_values[0] = _mm256_extract_epi16(b.values, 0);
+    if (mask & 0x02)
+      tmp_values[1] = _mm256_extract_epi16(b.values, 1);
+    if (mask & 0x04)
+      tmp_values[2] = _mm256_extract_epi16(b.values, 2);
+    if (mask & 0x08)
+      tmp_values[3] = _mm256_extract_epi16(b.values, 3);
+    if (mask & 0x10)
+      tmp_values[4] = _mm256_extract_epi16(b.values, 4);
+    if (mask & 0x20)
+      tmp_values[5] = _mm256_extract_epi16(b.values, 5);
+    if (mask & 0x40)
+      tmp_values[6] = _mm256_extract_epi16(b.values, 6);
+    if (mask & 0x80)
+      tmp_values[7] = _mm256_extract_epi16(b.values, 7);
+    if (mask & 0x100)
+      tmp_values[8] = _mm256_extract_epi16(b.values, 8);
+    if (mask & 0x200)
+      tmp_values[9] = _mm256_extract_epi16(b.values, 9);
+    if (mask & 0x400)
+      tmp_values[10] = _mm256_extract_epi16(b.values, 10);
+    if (mask & 0x800)
+      tmp_values[11] = _mm256_extract_epi16(b.values, 11);
+    if (mask & 0x1000)
+      tmp_values[12] = _mm256_extract_epi16(b.values, 12);
+    if (mask & 0x2000)
+      tmp_values[13] = _mm256_extract_epi16(b.values, 13);
+    if (mask & 0x4000)
+      tmp_values[14] = _mm256_extract_epi16(b.values, 14);
+    if (mask & 0x8000)
+      tmp_values[15] = _mm256_extract_epi16(b.values, 15);
+    return loadu(tmp_values);
+  }
+  static Vec256<BFloat16> blendv(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b,
+                                 const Vec256<BFloat16>& mask) {
+    return _mm256_blendv_epi8(a.values, b.values, mask.values);
+  }
+  static Vec256<BFloat16> arange(BFloat16 base = 0.f, BFloat16 step = 1.f) {
+    float base_f = base;
+    float step_f = step;
+    __m256 lo = _mm256_add_ps(
+        _mm256_set1_ps(base_f),
+        _mm256_mul_ps(_mm256_set1_ps(step_f),
+                      _mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7)));
+    __m256 hi = _mm256_add_ps(
+        _mm256_set1_ps(base_f),
+        _mm256_mul_ps(_mm256_set1_ps(step_f),
+                      _mm256_setr_ps(8, 9, 10, 11, 12, 13, 14, 15)));
+    return cvtfp32_bf16(lo, hi);
+  }
+  static Vec256<BFloat16> set(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b,
+                              int64_t count = size()) {
+    if (count == 0) {
+      return a;
+    } else if (count >= size()) {
+      return b;
+    }
+    __at_align32__ int16_t tmp_values[size()];
+    a.store(tmp_values);
+    __at_align32__ int16_t b_values[size()];
+    b.store(b_values);
+    for (int64_t i = 0; i < count; i++) {
+      tmp_values[i] = b_values[i];
+    }
+    return loadu(tmp_values);
+  }
+  static Vec256<BFloat16> loadu(const void* ptr, int64_t count = size()) {
+    if (count == size())
+      return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+    __at_align32__ int16_t tmp_values[size()];
+    // Ensure uninitialized memory does not change the output value
+    // See https://github.com/pytorch/pytorch/issues/32502 for more details.
+    for (auto i = 0; i < size(); ++i) {
+      tmp_values[i] = 0;
+    }
+    std::memcpy(tmp_values, ptr, count * sizeof(int16_t));
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(tmp_values));
+  }
+  void store(void* ptr, int64_t count = size()) const {
+    if (count == size()) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), values);
+    } else if (count > 0) {
+      __at_align32__ int16_t tmp_values[size()];
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(tmp_values), values);
+      std::memcpy(ptr, tmp_values, count * sizeof(int16_t));
+    }
+  }
+  const BFloat16& operator[](int idx) const = delete;
+  BFloat16& operator[](int idx) = delete;
+  int zero_mask() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    __m256 zero = _mm256_set1_ps(0.0f);
+    int lo_mask = _mm256_movemask_ps(_mm256_cmp_ps(lo, zero, _CMP_EQ_OQ));
+    int hi_mask = _mm256_movemask_ps(_mm256_cmp_ps(hi, zero, _CMP_EQ_OQ));
+    return lo_mask | (hi_mask << 8);
+  }
+  Vec256<BFloat16> map(float (*f)(float)) const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    __at_align32__ float tmp[size()];
+    _mm256_storeu_ps(tmp, lo);
+    _mm256_storeu_ps(tmp + 8, hi);
+    for (int64_t i = 0; i < size(); i++) {
+      tmp[i] = f(tmp[i]);
+    }
+    return cvtfp32_bf16(_mm256_loadu_ps(tmp), _mm256_loadu_ps(tmp + 8));
+  }
+  Vec256<BFloat16> abs() const {
+    // clear the sign bit
+    return _mm256_andnot_si256(_mm256_set1_epi16((int16_t)0x8000), values);
+  }
+  Vec256<BFloat16> angle() const {
+    return _mm256_setzero_si256();
+  }
+  Vec256<BFloat16> real() const {
+    return *this;
+  }
+  Vec256<BFloat16> imag() const {
+    return _mm256_setzero_si256();
+  }
+  Vec256<BFloat16> conj() const {
+    return *this;
+  }
+  Vec256<BFloat16> acos() const {
+    return map(std::acos);
+  }
+  Vec256<BFloat16> asin() const {
+    return map(std::asin);
+  }
+  Vec256<BFloat16> atan() const {
+    return map(std::atan);
+  }
+  Vec256<BFloat16> atan2(const Vec256<BFloat16>& b) const {
+    __m256 lo, hi, b_lo, b_hi;
+    cvtbf16_fp32(values, lo, hi);
+    cvtbf16_fp32(b.values, b_lo, b_hi);
+    __at_align32__ float tmp[size()];
+    __at_align32__ float tmp_b[size()];
+    _mm256_storeu_ps(tmp, lo);
+    _mm256_storeu_ps(tmp + 8, hi);
+    _mm256_storeu_ps(tmp_b, b_lo);
+    _mm256_storeu_ps(tmp_b + 8, b_hi);
+    for (int64_t i = 0; i < size(); i++) {
+      tmp[i] = std::atan2(tmp[i], tmp_b[i]);
+    }
+    return cvtfp32_bf16(_mm256_loadu_ps(tmp), _mm256_loadu_ps(tmp + 8));
+  }
+  Vec256<BFloat16> erf() const {
+    return map(std::erf);
+  }
+  Vec256<BFloat16> erfc() const {
+    return map(std::erfc);
+  }
+  Vec256<BFloat16> erfinv() const {
+    return map(calc_erfinv);
+  }
+  Vec256<BFloat16> exp() const {
+    return map(std::exp);
+  }
+  Vec256<BFloat16> expm1() const {
+    return map(std::expm1);
+  }
+  Vec256<BFloat16> fmod(const Vec256<BFloat16>& q) const {
+    __m256 lo, hi, q_lo, q_hi;
+    cvtbf16_fp32(values, lo, hi);
+    cvtbf16_fp32(q.values, q_lo, q_hi);
+    __at_align32__ float tmp[size()];
+    __at_align32__ float tmp_q[size()];
+    _mm256_storeu_ps(tmp, lo);
+    _mm256_storeu_ps(tmp + 8, hi);
+    _mm256_storeu_ps(tmp_q, q_lo);
+    _mm256_storeu_ps(tmp_q + 8, q_hi);
+    for (int64_t i = 0; i < size(); i++) {
+      tmp[i] = std::fmod(tmp[i], tmp_q[i]);
+    }
+    return cvtfp32_bf16(_mm256_loadu_ps(tmp), _mm256_loadu_ps(tmp + 8));
+  }
+  Vec256<BFloat16> log() const {
+    return map(std::log);
+  }
+  Vec256<BFloat16> log2() const {
+    return map(std::log2);
+  }
+  Vec256<BFloat16> log10() const {
+    return map(std::log10);
+  }
+  Vec256<BFloat16> log1p() const {
+    return map(std::log1p);
+  }
+  Vec256<BFloat16> frac() const;
+  Vec256<BFloat16> sin() const {
+    return map(std::sin);
+  }
+  Vec256<BFloat16> sinh() const {
+    return map(std::sinh);
+  }
+  Vec256<BFloat16> cos() const {
+    return map(std::cos);
+  }
+  Vec256<BFloat16> cosh() const {
+    return map(std::cosh);
+  }
+  Vec256<BFloat16> ceil() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    return cvtfp32_bf16(_mm256_ceil_ps(lo), _mm256_ceil_ps(hi));
+  }
+  Vec256<BFloat16> floor() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    return cvtfp32_bf16(_mm256_floor_ps(lo), _mm256_floor_ps(hi));
+  }
+  Vec256<BFloat16> neg() const {
+    // flip the sign bit
+    return _mm256_xor_si256(values, _mm256_set1_epi16((int16_t)0x8000));
+  }
+  Vec256<BFloat16> round() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    return cvtfp32_bf16(
+        _mm256_round_ps(lo, (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)),
+        _mm256_round_ps(hi, (_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)));
+  }
+  Vec256<BFloat16> tan() const {
+    return map(std::tan);
+  }
+  Vec256<BFloat16> tanh() const {
+    return map(std::tanh);
+  }
+  Vec256<BFloat16> trunc() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    return cvtfp32_bf16(
+        _mm256_round_ps(lo, (_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)),
+        _mm256_round_ps(hi, (_MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)));
+  }
+  Vec256<BFloat16> lgamma() const {
+    return map(std::lgamma);
+  }
+  Vec256<BFloat16> sqrt() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    return cvtfp32_bf16(_mm256_sqrt_ps(lo), _mm256_sqrt_ps(hi));
+  }
+  Vec256<BFloat16> reciprocal() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    __m256 ones = _mm256_set1_ps(1);
+    return cvtfp32_bf16(_mm256_div_ps(ones, lo), _mm256_div_ps(ones, hi));
+  }
+  Vec256<BFloat16> rsqrt() const {
+    __m256 lo, hi;
+    cvtbf16_fp32(values, lo, hi);
+    __m256 ones = _mm256_set1_ps(1);
+    return cvtfp32_bf16(
+        _mm256_div_ps(ones, _mm256_sqrt_ps(lo)),
+        _mm256_div_ps(ones, _mm256_sqrt_ps(hi)));
+  }
+  Vec256<BFloat16> pow(const Vec256<BFloat16>& b) const {
+    __m256 lo, hi, b_lo, b_hi;
+    cvtbf16_fp32(values, lo, hi);
+    cvtbf16_fp32(b.values, b_lo, b_hi);
+    __at_align32__ float tmp[size()];
+    __at_align32__ float tmp_b[size()];
+    _mm256_storeu_ps(tmp, lo);
+    _mm256_storeu_ps(tmp + 8, hi);
+    _mm256_storeu_ps(tmp_b, b_lo);
+    _mm256_storeu_ps(tmp_b + 8, b_hi);
+    for (int64_t i = 0; i < size(); i++) {
+      tmp[i] = std::pow(tmp[i], tmp_b[i]);
+    }
+    return cvtfp32_bf16(_mm256_loadu_ps(tmp), _mm256_loadu_ps(tmp + 8));
+  }
+
+  Vec256<BFloat16> operator==(const Vec256<BFloat16>& other) const;
+  Vec256<BFloat16> operator!=(const Vec256<BFloat16>& other) const;
+  Vec256<BFloat16> operator<(const Vec256<BFloat16>& other) const;
+  Vec256<BFloat16> operator<=(const Vec256<BFloat16>& other) const;
+  Vec256<BFloat16> operator>(const Vec256<BFloat16>& other) const;
+  Vec256<BFloat16> operator>=(const Vec256<BFloat16>& other) const;
+};
+
+template <typename Op>
+Vec256<BFloat16> static inline bfloat16_binary_op(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b, Op op) {
+  __m256 a_lo, a_hi, b_lo, b_hi;
+  cvtbf16_fp32(__m256i(a), a_lo, a_hi);
+  cvtbf16_fp32(__m256i(b), b_lo, b_hi);
+  return cvtfp32_bf16(op(a_lo, b_lo), op(a_hi, b_hi));
+}
+
+// Comparisons widen to float, compare there and narrow the resulting
+// all-ones/all-zeros lane masks back to 16 bits per lane.
+template <typename Op>
+Vec256<BFloat16> static inline bfloat16_compare_op(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b, Op op) {
+  __m256 a_lo, a_hi, b_lo, b_hi;
+  cvtbf16_fp32(__m256i(a), a_lo, a_hi);
+  cvtbf16_fp32(__m256i(b), b_lo, b_hi);
+  __m256i lo = _mm256_castps_si256(op(a_lo, b_lo));
+  __m256i hi = _mm256_castps_si256(op(a_hi, b_hi));
+  // pack the 32-bit masks into ordered 16-bit masks
+  __m256i packed = _mm256_packs_epi32(lo, hi);
+  return _mm256_permute4x64_epi64(packed, 0xd8);
+}
+
+Vec256<BFloat16> inline Vec256<BFloat16>::operator==(const Vec256<BFloat16>& other) const {
+  return bfloat16_compare_op(*this, other, [](__m256 x, __m256 y) {
+    return _mm256_cmp_ps(x, y, _CMP_EQ_OQ);
+  });
+}
+
+Vec256<BFloat16> inline Vec256<BFloat16>::operator!=(const Vec256<BFloat16>& other) const {
+  return bfloat16_compare_op(*this, other, [](__m256 x, __m256 y) {
+    return _mm256_cmp_ps(x, y, _CMP_NEQ_OQ);
+  });
+}
+
+Vec256<BFloat16> inline Vec256<BFloat16>::operator<(const Vec256<BFloat16>& other) const {
+  return bfloat16_compare_op(*this, other, [](__m256 x, __m256 y) {
+    return _mm256_cmp_ps(x, y, _CMP_LT_OQ);
+  });
+}
+
+Vec256<BFloat16> inline Vec256<BFloat16>::operator<=(const Vec256<BFloat16>& other) const {
+  return bfloat16_compare_op(*this, other, [](__m256 x, __m256 y) {
+    return _mm256_cmp_ps(x, y, _CMP_LE_OQ);
+  });
+}
+
+Vec256<BFloat16> inline Vec256<BFloat16>::operator>(const Vec256<BFloat16>& other) const {
+  return bfloat16_compare_op(*this, other, [](__m256 x, __m256 y) {
+    return _mm256_cmp_ps(x, y, _CMP_GT_OQ);
+  });
+}
+
+Vec256<BFloat16> inline Vec256<BFloat16>::operator>=(const Vec256<BFloat16>& other) const {
+  return bfloat16_compare_op(*this, other, [](__m256 x, __m256 y) {
+    return _mm256_cmp_ps(x, y, _CMP_GE_OQ);
+  });
+}
+
+template <>
+Vec256<BFloat16> inline operator+(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return bfloat16_binary_op(a, b, [](__m256 x, __m256 y) { return _mm256_add_ps(x, y); });
+}
+
+template <>
+Vec256<BFloat16> inline operator-(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return bfloat16_binary_op(a, b, [](__m256 x, __m256 y) { return _mm256_sub_ps(x, y); });
+}
+
+template <>
+Vec256<BFloat16> inline operator*(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return bfloat16_binary_op(a, b, [](__m256 x, __m256 y) { return _mm256_mul_ps(x, y); });
+}
+
+template <>
+Vec256<BFloat16> inline operator/(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return bfloat16_binary_op(a, b, [](__m256 x, __m256 y) { return _mm256_div_ps(x, y); });
+}
+
+// frac. Implement this here so we can use subtraction
+Vec256<BFloat16> Vec256<BFloat16>::frac() const {
+  return *this - this->trunc();
+}
+
+// Implements the IEEE 754 201X `maximum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vec256<BFloat16> inline maximum(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return bfloat16_binary_op(a, b, [](__m256 x, __m256 y) {
+    __m256 max = _mm256_max_ps(x, y);
+    __m256 isnan = _mm256_cmp_ps(x, y, _CMP_UNORD_Q);
+    // Exploit the fact that all-ones is a NaN.
+    return _mm256_or_ps(max, isnan);
+  });
+}
+
+// Implements the IEEE 754 201X `minimum` operation, which propagates NaN if
+// either input is a NaN.
+template <>
+Vec256<BFloat16> inline minimum(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return bfloat16_binary_op(a, b, [](__m256 x, __m256 y) {
+    __m256 min = _mm256_min_ps(x, y);
+    __m256 isnan = _mm256_cmp_ps(x, y, _CMP_UNORD_Q);
+    // Exploit the fact that all-ones is a NaN.
+    return _mm256_or_ps(min, isnan);
+  });
+}
+
+template <>
+Vec256<BFloat16> inline clamp(const Vec256<BFloat16>& a, const Vec256<BFloat16>& min, const Vec256<BFloat16>& max) {
+  __m256 a_lo, a_hi, min_lo, min_hi, max_lo, max_hi;
+  cvtbf16_fp32(__m256i(a), a_lo, a_hi);
+  cvtbf16_fp32(__m256i(min), min_lo, min_hi);
+  cvtbf16_fp32(__m256i(max), max_lo, max_hi);
+  return cvtfp32_bf16(
+      _mm256_min_ps(max_lo, _mm256_max_ps(min_lo, a_lo)),
+      _mm256_min_ps(max_hi, _mm256_max_ps(min_hi, a_hi)));
+}
+
+template <>
+Vec256<BFloat16> inline clamp_max(const Vec256<BFloat16>& a, const Vec256<BFloat16>& max) {
+  return bfloat16_binary_op(a, max, [](__m256 x, __m256 y) { return _mm256_min_ps(y, x); });
+}
+
+template <>
+Vec256<BFloat16> inline clamp_min(const Vec256<BFloat16>& a, const Vec256<BFloat16>& min) {
+  return bfloat16_binary_op(a, min, [](__m256 x, __m256 y) { return _mm256_max_ps(y, x); });
+}
+
+template <>
+Vec256<BFloat16> inline operator&(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return _mm256_and_si256(__m256i(a), __m256i(b));
+}
+
+template <>
+Vec256<BFloat16> inline operator|(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return _mm256_or_si256(__m256i(a), __m256i(b));
+}
+
+template <>
+Vec256<BFloat16> inline operator^(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b) {
+  return _mm256_xor_si256(__m256i(a), __m256i(b));
+}
+
+template <>
+inline void convert(const BFloat16* src, BFloat16* dst, int64_t n) {
+  int64_t i;
+#pragma unroll
+  for (i = 0; i <= (n - Vec256<BFloat16>::size()); i += Vec256<BFloat16>::size()) {
+    auto vsrc = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), vsrc);
+  }
+#pragma unroll
+  for (; i < n; i++) {
+    dst[i] = src[i];
+  }
+}
+
+template <>
+inline void convert(const BFloat16* src, float* dst, int64_t n) {
+  int64_t i;
+#pragma unroll
+  for (i = 0; i <= (n - Vec256<BFloat16>::size()); i += Vec256<BFloat16>::size()) {
+    __m256 lo, hi;
+    cvtbf16_fp32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), lo, hi);
+    _mm256_storeu_ps(dst + i, lo);
+    _mm256_storeu_ps(dst + i + 8, hi);
+  }
+#pragma unroll
+  for (; i < n; i++) {
+    dst[i] = static_cast<float>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const float* src, BFloat16* dst, int64_t n) {
+  int64_t i;
+#pragma unroll
+  for (i = 0; i <= (n - Vec256<BFloat16>::size()); i += Vec256<BFloat16>::size()) {
+    __m256 lo = _mm256_loadu_ps(src + i);
+    __m256 hi = _mm256_loadu_ps(src + i + 8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), cvtfp32_bf16(lo, hi));
+  }
+#pragma unroll
+  for (; i < n; i++) {
+    dst[i] = static_cast<BFloat16>(src[i]);
+  }
+}
+
+// Keeps the product in float and only narrows once after the addition, so
+// dot-product style accumulations through fmadd round once per step instead
+// of twice.
+template <>
+Vec256<BFloat16> inline fmadd(const Vec256<BFloat16>& a, const Vec256<BFloat16>& b, const Vec256<BFloat16>& c) {
+  __m256 a_lo, a_hi, b_lo, b_hi, c_lo, c_hi;
+  cvtbf16_fp32(__m256i(a), a_lo, a_hi);
+  cvtbf16_fp32(__m256i(b), b_lo, b_hi);
+  cvtbf16_fp32(__m256i(c), c_lo, c_hi);
+  return cvtfp32_bf16(
+      _mm256_fmadd_ps(a_lo, b_lo, c_lo), _mm256_fmadd_ps(a_hi, b_hi, c_hi));
+}
+
+#endif
+
+}}}
@@ -209,7 +209,8 @@ public:
     exp = _mm256_blend_pd(exp, _mm256_permute_pd(exp, 0x05), 0x0A);   //exp(a)           exp(a)
 
     auto sin_cos = Sleef_sincosd4_u10(values);                        //[sin(a), cos(a)] [sin(b), cos(b)]
-    auto cos_sin = _mm256_blend_pd(sin_cos.y, sin_cos.x, 0x0A);       //cos(b)           sin(b)
+    auto cos_sin = _mm256_blend_pd(_mm256_permute_pd(sin_cos.y, 0x05),
+                                   sin_cos.x, 0x0A);                  //cos(b)           sin(b)
     return _mm256_mul_pd(exp, cos_sin);
   }
   Vec256<std::complex<double>> expm1() const {
@@ -219,13 +220,23 @@ public:
     return map(std::sin);
   }
   Vec256<std::complex<double>> sinh() const {
-    return map(std::sinh);
+    //sinh(a + bi)
+    // = (exp(a + bi) - exp(-a - bi)) / 2
+    const __m256d half = _mm256_set1_pd(0.5);
+    auto z = exp();
+    auto z_inv = neg().exp();
+    return _mm256_mul_pd(_mm256_sub_pd(z, z_inv), half);
   }
   Vec256<std::complex<double>> cos() const {
     return map(std::cos);
   }
   Vec256<std::complex<double>> cosh() const {
-    return map(std::cosh);
+    //cosh(a + bi)
+    // = (exp(a + bi) + exp(-a - bi)) / 2
+    const __m256d half = _mm256_set1_pd(0.5);
+    auto z = exp();
+    auto z_inv = neg().exp();
+    return _mm256_mul_pd(_mm256_add_pd(z, z_inv), half);
   }
   Vec256<std::complex<double>> ceil() const {
     return _mm256_ceil_pd(values);
@@ -247,7 +247,8 @@ public:
     exp = _mm256_blend_ps(exp, _mm256_permute_ps(exp, 0xB1), 0xAA);   //exp(a)           exp(a)
 
     auto sin_cos = Sleef_sincosf8_u10(values);                        //[sin(a), cos(a)] [sin(b), cos(b)]
-    auto cos_sin = _mm256_blend_ps(sin_cos.y, sin_cos.x, 0xAA);       //cos(b)           sin(b)
+    auto cos_sin = _mm256_blend_ps(_mm256_permute_ps(sin_cos.y, 0xB1),
+                                   sin_cos.x, 0xAA);                  //cos(b)           sin(b)
     return _mm256_mul_ps(exp, cos_sin);
   }
   Vec256<std::complex<float>> expm1() const {
@@ -257,13 +258,23 @@ public:
     return map(std::sin);
   }
   Vec256<std::complex<float>> sinh() const {
-    return map(std::sinh);
+    //sinh(a + bi)
+    // = (exp(a + bi) - exp(-a - bi)) / 2
+    const __m256 half = _mm256_set1_ps(0.5);
+    auto z = exp();
+    auto z_inv = neg().exp();
+    return _mm256_mul_ps(_mm256_sub_ps(z, z_inv), half);
   }
   Vec256<std::complex<float>> cos() const {
     return map(std::cos);
   }
   Vec256<std::complex<float>> cosh() const {
-    return map(std::cosh);
+    //cosh(a + bi)
+    // = (exp(a + bi) + exp(-a - bi)) / 2
+    const __m256 half = _mm256_set1_ps(0.5);
+    auto z = exp();
+    auto z_inv = neg().exp();
+    return _mm256_mul_ps(_mm256_add_ps(z, z_inv), half);
   }
   Vec256<std::complex<float>> ceil() const {
     return _mm256_ceil_ps(values);
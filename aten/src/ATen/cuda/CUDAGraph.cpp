@@ -0,0 +1,111 @@
+#include <ATen/cuda/CUDAGraph.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/Exceptions.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAFunctions.h>
+#include <c10/cuda/CUDAGuard.h>
+
+namespace at {
+namespace cuda {
+
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10010 && \
+    !defined(__HIP_PLATFORM_HCC__)
+
+void CUDAGraph::capture_begin() {
+  TORCH_CHECK(!capturing_, "capture_begin called while already capturing");
+  TORCH_CHECK(!has_graph_exec_,
+      "this CUDAGraph already holds a captured graph; call reset() before "
+      "capturing again");
+
+  auto stream = c10::cuda::getCurrentCUDAStream();
+  TORCH_CHECK(stream != c10::cuda::getDefaultCUDAStream(),
+      "CUDA graphs must be captured on a non-default stream");
+  capture_stream_ = stream.stream();
+  capture_device_ = c10::cuda::current_device();
+
+  // Allocations during capture must be served from already-cached blocks;
+  // see notifyCaptureBegin in the caching allocator.
+  c10::cuda::CUDACachingAllocator::notifyCaptureBegin();
+
+  // Thread-local mode lets other threads keep launching ordinary work on
+  // other streams while this thread captures.
+  AT_CUDA_CHECK(cudaStreamBeginCapture(
+      capture_stream_, cudaStreamCaptureModeThreadLocal));
+  capturing_ = true;
+}
+
+void CUDAGraph::capture_end() {
+  TORCH_CHECK(capturing_, "capture_end called without capture_begin");
+  auto stream = c10::cuda::getCurrentCUDAStream();
+  TORCH_CHECK(stream.stream() == capture_stream_,
+      "capture_end must be called on the same stream as capture_begin");
+
+  AT_CUDA_CHECK(cudaStreamEndCapture(capture_stream_, &graph_));
+  capturing_ = false;
+  c10::cuda::CUDACachingAllocator::notifyCaptureEnd();
+
+  TORCH_CHECK(graph_ != nullptr, "stream capture produced no graph");
+  AT_CUDA_CHECK(cudaGraphInstantiate(
+      &graph_exec_, graph_, nullptr, nullptr, 0));
+  has_graph_exec_ = true;
+
+  // The executable graph is all replay needs; the capture graph itself can
+  // be released immediately.
+  AT_CUDA_CHECK(cudaGraphDestroy(graph_));
+  graph_ = nullptr;
+}
+
+void CUDAGraph::replay() {
+  TORCH_CHECK(has_graph_exec_,
+      "replay called without a captured graph; call capture_begin/capture_end "
+      "first");
+  c10::cuda::CUDAGuard device_guard(capture_device_);
+  AT_CUDA_CHECK(cudaGraphLaunch(
+      graph_exec_, c10::cuda::getCurrentCUDAStream().stream()));
+}
+
+void CUDAGraph::reset() {
+  if (capturing_) {
+    // Abandon an in-flight capture (e.g. when unwinding after an error in
+    // the captured region).
+    cudaGraph_t graph = nullptr;
+    cudaStreamEndCapture(capture_stream_, &graph);
+    cudaGetLastError(); // clear any capture invalidation error
+    if (graph != nullptr) {
+      cudaGraphDestroy(graph);
+    }
+    capturing_ = false;
+    c10::cuda::CUDACachingAllocator::notifyCaptureEnd();
+  }
+  if (has_graph_exec_) {
+    cudaGraphExecDestroy(graph_exec_);
+    graph_exec_ = nullptr;
+    has_graph_exec_ = false;
+  }
+}
+
+#else // CUDA_VERSION < 10010 or HIP
+
+void CUDAGraph::capture_begin() {
+  TORCH_CHECK(false, "CUDA graphs require CUDA >= 10.1");
+}
+
+void CUDAGraph::capture_end() {
+  TORCH_CHECK(false, "CUDA graphs require CUDA >= 10.1");
+}
+
+void CUDAGraph::replay() {
+  TORCH_CHECK(false, "CUDA graphs require CUDA >= 10.1");
+}
+
+void CUDAGraph::reset() {}
+
+#endif
+
+CUDAGraph::~CUDAGraph() {
+  reset();
+}
+
+} // namespace cuda
+} // namespace at
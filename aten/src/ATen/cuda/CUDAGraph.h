@@ -0,0 +1,55 @@
+#pragma once
+
+#include <ATen/cuda/ATenCUDAGeneral.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <cuda_runtime_api.h>
+
+namespace at {
+namespace cuda {
+
+// Records the work submitted to the current CUDA stream between
+// capture_begin() and capture_end() into a CUDA graph, which replay() then
+// relaunches with a single driver call. This amortizes per-kernel launch
+// overhead for shape-stable inference loops: run a warmup iteration first
+// (so the caching allocator has every block the captured region needs; new
+// device memory cannot be allocated during capture), capture one iteration,
+// then call replay() per step with fresh input data copied into the same
+// input tensors.
+//
+// Requires CUDA >= 10.1; all methods throw on older toolkits and on HIP.
+struct TORCH_CUDA_API CUDAGraph {
+  CUDAGraph() = default;
+  ~CUDAGraph();
+
+  CUDAGraph(const CUDAGraph&) = delete;
+  CUDAGraph& operator=(const CUDAGraph&) = delete;
+
+  // Begins capturing work submitted to the current stream, which must be a
+  // non-default stream. Puts the caching allocator into its capture-safe
+  // mode (allocations are served from cached blocks only).
+  void capture_begin();
+
+  // Ends capture and instantiates the executable graph.
+  void capture_end();
+
+  // Relaunches all captured work on the current stream.
+  void replay();
+
+  // Releases the instantiated graph. Called by the destructor.
+  void reset();
+
+ private:
+#if defined(CUDA_VERSION) && CUDA_VERSION >= 10010 && \
+    !defined(__HIP_PLATFORM_HCC__)
+  cudaGraph_t graph_ = nullptr;
+  cudaGraphExec_t graph_exec_ = nullptr;
+#endif
+  bool capturing_ = false;
+  bool has_graph_exec_ = false;
+  int capture_device_ = -1;
+  cudaStream_t capture_stream_ = nullptr;
+};
+
+} // namespace cuda
+} // namespace at
@@ -11,6 +11,8 @@
 #include <ATen/cuda/nvrtc_stub/ATenNVRTC.h>
 #include <ATen/detail/CUDAHooksInterface.h>
 #include <ATen/native/cuda/CuFFTPlanCache.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAStream.h>
 #include <c10/util/Exception.h>
 
 #include <THC/THC.h>
@@ -337,6 +339,17 @@ int CUDAHooks::getNumGPUs() const {
   return at::cuda::device_count();
 }
 
+c10::Stream CUDAHooks::getStreamFromPool(DeviceIndex device_index) const {
+  return c10::cuda::getStreamFromPool(/*isHighPriority=*/false, device_index);
+}
+
+void CUDAHooks::recordStreamOnDataPtr(
+    const c10::DataPtr& data_ptr,
+    c10::Stream stream) const {
+  c10::cuda::CUDACachingAllocator::recordStream(
+      data_ptr, c10::cuda::CUDAStream(stream));
+}
+
 // Sigh, the registry doesn't support namespaces :(
 using at::CUDAHooksRegistry;
 using at::RegistererCUDAHooksRegistry;
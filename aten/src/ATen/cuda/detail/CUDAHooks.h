@@ -35,6 +35,9 @@ struct CUDAHooks : public at::CUDAHooksInterface {
   int64_t cuFFTGetPlanCacheSize(int64_t device_index) const override;
   void cuFFTClearPlanCache(int64_t device_index) const override;
   int getNumGPUs() const override;
+  c10::Stream getStreamFromPool(DeviceIndex device_index) const override;
+  void recordStreamOnDataPtr(const c10::DataPtr& data_ptr, c10::Stream stream)
+      const override;
 };
 
 }}} // at::cuda::detail
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <c10/core/Allocator.h>
+#include <c10/core/Stream.h>
 #include <ATen/core/Generator.h>
 #include <c10/util/Exception.h>
 #include <c10/util/Optional.h>
@@ -155,6 +156,21 @@ struct CAFFE2_API CUDAHooksInterface {
   virtual int getNumGPUs() const {
     return 0;
   }
+
+  // Returns a side stream from the CUDA stream pool for the given device.
+  // Exposed through the hooks so that stream-scheduling code in the JIT can
+  // stay free of direct CUDA dependencies.
+  virtual c10::Stream getStreamFromPool(DeviceIndex device_index) const {
+    TORCH_CHECK(false, "Cannot get a CUDA stream without ATen_cuda library. ", CUDA_HELP);
+  }
+
+  // Informs the CUDA caching allocator that the allocation behind data_ptr
+  // is used on stream, so the block is not handed out again while that use
+  // may still be pending.
+  virtual void recordStreamOnDataPtr(const c10::DataPtr& data_ptr, c10::Stream stream)
+      const {
+    TORCH_CHECK(false, "Cannot record a CUDA stream without ATen_cuda library. ", CUDA_HELP);
+  }
 };
 
 // NB: dummy argument to suppress "ISO C++11 requires at least one argument
@@ -24,6 +24,9 @@ using elu_fn = void (*)(TensorIterator&, Scalar, Scalar, Scalar);
 using leaky_relu_fn = void (*)(TensorIterator&, Scalar);
 using leaky_relu_backward_fn = void (*)(TensorIterator&, Scalar);
 using log_sigmoid_cpu_fn = void (*)(Tensor& , Tensor&, const Tensor& );
+using prelu_cpu_fn = void (*)(Tensor&, const Tensor&, const Tensor&);
+using prelu_backward_cpu_fn =
+    void (*)(const Tensor&, const Tensor&, const Tensor&, Tensor&, Tensor&, Tensor&);
 
 DECLARE_DISPATCH(elu_fn, elu_stub);
 DECLARE_DISPATCH(elu_fn, elu_backward_stub);
@@ -44,6 +47,8 @@ DECLARE_DISPATCH(leaky_relu_fn, leaky_relu_stub);
 DECLARE_DISPATCH(leaky_relu_backward_fn, leaky_relu_backward_stub);
 DECLARE_DISPATCH(activation_fn, glu_stub);
 DECLARE_DISPATCH(activation_backward_fn, glu_backward_stub);
+DECLARE_DISPATCH(prelu_cpu_fn, prelu_cpu_stub);
+DECLARE_DISPATCH(prelu_backward_cpu_fn, prelu_backward_cpu_stub);
 
 } // namespace native
 
@@ -1,7 +1,10 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/functional.h>
+#include <ATen/cpu/vec256/vec256.h>
 #include <tuple>
+#include <vector>
 
 
 namespace at {
@@ -17,56 +20,108 @@ namespace {
     return (int)std::ceil((float)((a + 1) * c) / b);
   }
 
+  /* Precomputes the pooling window start and length for every output
+     position along one spatial axis. The bounds depend only on the input
+     and output extents, so they are computed once per call and shared by
+     every (batch, channel) plane instead of being recomputed inside the
+     innermost loops. */
+  static void make_index_table(
+      int64_t isize,
+      int64_t osize,
+      std::vector<int>& istart,
+      std::vector<int>& ksize)
+  {
+    istart.resize(osize);
+    ksize.resize(osize);
+    for (int64_t o = 0; o < osize; o++) {
+      istart[o] = start_index(o, osize, isize);
+      ksize[o] = end_index(o, osize, isize) - istart[o];
+    }
+  }
+
+  /* sums n unit-stride elements, Vec256 lanes plus a scalar tail */
+  template <typename scalar_t>
+  static inline scalar_t vec_sum_row(const scalar_t* row, int64_t n) {
+    using Vec = vec256::Vec256<scalar_t>;
+    Vec sum_vec(scalar_t(0));
+    int64_t i = 0;
+    for (; i + Vec::size() <= n; i += Vec::size()) {
+      sum_vec = sum_vec + Vec::loadu(row + i);
+    }
+    scalar_t sum = vec256::vec_reduce_all<scalar_t>(
+        [](Vec& x, Vec& y) { return x + y; }, sum_vec, Vec::size());
+    for (; i < n; i++) {
+      sum += row[i];
+    }
+    return sum;
+  }
+
+  /* averages one (batch, channel) plane using the precomputed tables */
+  template <typename scalar_t>
+  static inline void adaptive_avg_pool2d_plane(
+            const scalar_t *input_p,
+            scalar_t *output_p,
+            int64_t osizeH,
+            int64_t osizeW,
+            int64_t istrideH,
+            int64_t istrideW,
+            const int* istartH,
+            const int* kH,
+            const int* istartW,
+            const int* kW)
+  {
+    for (int64_t oh = 0; oh < osizeH; oh++)
+    {
+      const scalar_t *ip_h = input_p + istartH[oh]*istrideH;
+      scalar_t *op_h = output_p + oh*osizeW;
+      for (int64_t ow = 0; ow < osizeW; ow++)
+      {
+        const scalar_t *ip = ip_h + istartW[ow]*istrideW;
+
+        /* compute local average: */
+        scalar_t sum = 0;
+        if (istrideW == 1) {
+          for (int64_t ih = 0; ih < kH[oh]; ih++) {
+            sum += vec_sum_row(ip + ih*istrideH, kW[ow]);
+          }
+        } else {
+          for (int64_t ih = 0; ih < kH[oh]; ih++) {
+            for (int64_t iw = 0; iw < kW[ow]; iw++) {
+              sum += ip[ih*istrideH + iw*istrideW];
+            }
+          }
+        }
+
+        /* set output to local average */
+        op_h[ow] = sum / kW[ow] / kH[oh];
+      }
+    }
+  }
+
   template <typename scalar_t>
   static void adaptive_avg_pool2d_single_out_frame(
             scalar_t *input_p,
             scalar_t *output_p,
             int64_t sizeD,
-            int64_t isizeH,
-            int64_t isizeW,
             int64_t osizeH,
             int64_t osizeW,
             int64_t istrideD,
             int64_t istrideH,
-            int64_t istrideW)
+            int64_t istrideW,
+            const int* istartH,
+            const int* kH,
+            const int* istartW,
+            const int* kW)
   {
     at::parallel_for(0, sizeD, 0, [&](int64_t start, int64_t end) {
       for (auto d = start; d < end; d++)
       {
-        /* loop over output */
-        int64_t oh, ow;
-        for(oh = 0; oh < osizeH; oh++)
-        {
-          int istartH = start_index(oh, osizeH, isizeH);
-          int iendH   = end_index(oh, osizeH, isizeH);
-          int kH = iendH - istartH;
-
-          for(ow = 0; ow < osizeW; ow++)
-          {
-            int istartW = start_index(ow, osizeW, isizeW);
-            int iendW   = end_index(ow, osizeW, isizeW);
-            int kW = iendW - istartW;
-
-            /* local pointers */
-            scalar_t *ip = input_p   + d*istrideD + istartH*istrideH + istartW*istrideW;
-            scalar_t *op = output_p  + d*osizeH*osizeW + oh*osizeW + ow;
-
-            /* compute local average: */
-            scalar_t sum = 0;
-            int ih, iw;
-            for(ih = 0; ih < kH; ih++)
-            {
-              for(iw = 0; iw < kW; iw++)
-              {
-                scalar_t val = *(ip + ih*istrideH + iw*istrideW);
-                sum += val;
-              }
-            }
-
-            /* set output to local average */
-            *op = sum / kW / kH;
-          }
-        }
+        adaptive_avg_pool2d_plane<scalar_t>(
+          input_p + d*istrideD,
+          output_p + d*osizeH*osizeW,
+          osizeH, osizeW,
+          istrideH, istrideW,
+          istartH, kH, istartW, kW);
       }
     });
   }
@@ -77,26 +132,85 @@ namespace {
     scalar_t *output_p,
     int64_t sizeB,
     int64_t sizeD,
-    int64_t isizeH,
-    int64_t isizeW,
     int64_t osizeH,
     int64_t osizeW,
     int64_t istrideB,
     int64_t istrideD,
     int64_t istrideH,
-    int64_t istrideW)
+    int64_t istrideW,
+    const int* istartH,
+    const int* kH,
+    const int* istartW,
+    const int* kW)
   {
-    at::parallel_for(0, sizeB, 0, [&](int64_t start, int64_t end) {
-      for (auto b = start; b < end; b++)
+    /* flattened over batch x channels so small batches still fill the
+       intra-op pool */
+    at::parallel_for(0, sizeB * sizeD, 0, [&](int64_t start, int64_t end) {
+      for (auto bd = start; bd < end; bd++)
       {
-        adaptive_avg_pool2d_single_out_frame<scalar_t>(
-          input_p + b * istrideB,
-          output_p + b * sizeD * osizeH * osizeW,
-          sizeD,
-          isizeH, isizeW,
+        const int64_t b = bd / sizeD;
+        const int64_t d = bd % sizeD;
+        adaptive_avg_pool2d_plane<scalar_t>(
+          input_p + b*istrideB + d*istrideD,
+          output_p + (b*sizeD + d)*osizeH*osizeW,
           osizeH, osizeW,
-          istrideD,
-          istrideH, istrideW);
+          istrideH, istrideW,
+          istartH, kH, istartW, kW);
+      }
+    });
+  }
+
+  /* channels-last variant: the channel dimension is unit-stride, so the
+     accumulation vectorizes across C instead of W */
+  template <typename scalar_t>
+  void adaptive_avg_pool2d_channels_last_frame(
+    const scalar_t *input_p,
+    scalar_t *output_p,
+    int64_t sizeB,
+    int64_t sizeC,
+    int64_t isizeH,
+    int64_t isizeW,
+    int64_t osizeH,
+    int64_t osizeW,
+    const int* istartH,
+    const int* kH,
+    const int* istartW,
+    const int* kW)
+  {
+    using Vec = vec256::Vec256<scalar_t>;
+    at::parallel_for(0, sizeB * osizeH, 0, [&](int64_t start, int64_t end) {
+      for (auto i = start; i < end; i++)
+      {
+        const int64_t b = i / osizeH;
+        const int64_t oh = i % osizeH;
+        const scalar_t *in_b = input_p + b*isizeH*isizeW*sizeC;
+        scalar_t *out_row = output_p + (b*osizeH + oh)*osizeW*sizeC;
+        for (int64_t ow = 0; ow < osizeW; ow++)
+        {
+          const scalar_t *in_w = in_b + (istartH[oh]*isizeW + istartW[ow])*sizeC;
+          scalar_t *out_px = out_row + ow*sizeC;
+          const scalar_t factor = scalar_t(1) / (kH[oh] * kW[ow]);
+          int64_t c = 0;
+          for (; c + Vec::size() <= sizeC; c += Vec::size()) {
+            Vec acc(scalar_t(0));
+            for (int64_t ih = 0; ih < kH[oh]; ih++) {
+              const scalar_t *in_h = in_w + ih*isizeW*sizeC + c;
+              for (int64_t iw = 0; iw < kW[ow]; iw++) {
+                acc = acc + Vec::loadu(in_h + iw*sizeC);
+              }
+            }
+            (acc * Vec(factor)).store(out_px + c);
+          }
+          for (; c < sizeC; c++) {
+            scalar_t sum = 0;
+            for (int64_t ih = 0; ih < kH[oh]; ih++) {
+              for (int64_t iw = 0; iw < kW[ow]; iw++) {
+                sum += in_w[(ih*isizeW + iw)*sizeC + c];
+              }
+            }
+            out_px[c] = sum * factor;
+          }
+        }
       }
     });
   }
@@ -128,6 +242,29 @@ namespace {
     auto osizeH = output_size[0];
     auto osizeW = output_size[1];
 
+    /* pooling window bounds, shared by all (batch, channel) planes */
+    std::vector<int> istartH, kH, istartW, kW;
+    make_index_table(isizeH, osizeH, istartH, kH);
+    make_index_table(isizeW, osizeW, istartW, kW);
+
+    if (input.ndimension() == 4 &&
+        input.suggest_memory_format() == at::MemoryFormat::ChannelsLast)
+    {
+      Tensor input_cl = input.contiguous(at::MemoryFormat::ChannelsLast);
+      int64_t sizeB = input_cl.size(0);
+      output.resize_({sizeB, sizeD, osizeH, osizeW}, at::MemoryFormat::ChannelsLast);
+      AT_DISPATCH_FLOATING_TYPES_AND_HALF(input.scalar_type(), "adaptive_avg_pool2d_cpu", [&] {
+        adaptive_avg_pool2d_channels_last_frame<scalar_t>(
+          input_cl.data_ptr<scalar_t>(),
+          output.data_ptr<scalar_t>(),
+          sizeB, sizeD,
+          isizeH, isizeW,
+          osizeH, osizeW,
+          istartH.data(), kH.data(), istartW.data(), kW.data());
+      });
+      return;
+    }
+
     /* resize output */
     if (input.ndimension() == 3 || input.size(-4) == 1)
     {
@@ -143,10 +280,10 @@ namespace {
             input_data,
             output_data,
             sizeD,
-            isizeH, isizeW,
             osizeH, osizeW,
             istrideD,
-            istrideH, istrideW);
+            istrideH, istrideW,
+            istartH.data(), kH.data(), istartW.data(), kW.data());
         }
       );
     }
@@ -164,11 +301,11 @@ namespace {
           output_data,
           sizeB,
           sizeD,
-          isizeH, isizeW,
           osizeH, osizeW,
           istrideB,
           istrideD,
-          istrideH, istrideW);
+          istrideH, istrideW,
+          istartH.data(), kH.data(), istartW.data(), kW.data());
       });
     }
   }
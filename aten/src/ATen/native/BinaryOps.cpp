@@ -2,9 +2,11 @@
 #include <ATen/native/BinaryOps.h>
 
 #include <ATen/ATen.h>
+#include <ATen/CPUGenerator.h>
 #include <ATen/Dispatch.h>
 #include <ATen/MemoryOverlap.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/Utils.h>
 #include <ATen/native/TensorIterator.h>
 
 namespace at {
@@ -36,6 +38,7 @@ DEFINE_DISPATCH(max_elementwise_stub);
 DEFINE_DISPATCH(min_elementwise_stub);
 DEFINE_DISPATCH(fmod_stub);
 DEFINE_DISPATCH(fmod_scalar_stub);
+DEFINE_DISPATCH(stochastic_round_add_stub);
 
 Tensor& add_out(Tensor& result, const Tensor& self, const Tensor& other, Scalar alpha) {
   auto iter = TensorIterator::binary_op(result, self, other,
@@ -58,6 +61,37 @@ Tensor& add_(Tensor& self, const Tensor& other, Scalar alpha) {
   return native::add_out(self, self, other, alpha);
 }
 
+// Accumulates `other` into the BFloat16 tensor `self` with stochastic
+// rounding: the sum is computed in float and rounded up or down with
+// probability proportional to the discarded fraction, so repeated small
+// contributions don't systematically vanish the way they do under
+// round-to-nearest-even. Used by AccumulateGrad to keep gradients in a
+// compact bfloat16 buffer without an fp32 master copy.
+Tensor& _stochastic_round_add_(Tensor& self, const Tensor& other, Generator gen) {
+  TORCH_CHECK(self.scalar_type() == kBFloat16,
+              "_stochastic_round_add_ expects a BFloat16 tensor for self, but got ",
+              self.scalar_type());
+  TORCH_CHECK(other.scalar_type() == kBFloat16 || other.scalar_type() == kFloat,
+              "_stochastic_round_add_ expects a BFloat16 or Float tensor for other, but got ",
+              other.scalar_type());
+  TORCH_CHECK(self.sizes().equals(other.sizes()),
+              "_stochastic_round_add_ expects self and other to have the same shape, but got ",
+              self.sizes(), " and ", other.sizes());
+  TORCH_CHECK(self.is_contiguous(),
+              "_stochastic_round_add_ expects self to be contiguous");
+  Tensor other_contig = other.contiguous();
+  // Draws a single seed under the generator's lock; the kernel derives a
+  // Philox subsequence per block from it so it can run in parallel.
+  uint64_t seed;
+  {
+    CPUGenerator* generator = get_generator_or_default<CPUGenerator>(gen, detail::getDefaultCPUGenerator());
+    std::lock_guard<std::mutex> lock(generator->mutex_);
+    seed = generator->random64();
+  }
+  stochastic_round_add_stub(kCPU, self, other_contig, seed);
+  return self;
+}
+
 Tensor& div_out(Tensor& result, const Tensor& self, const Tensor& other) {
   if (isIntegralType(result.scalar_type(), /*includeBool=*/ true)) {
     TORCH_WARN_ONCE(
@@ -26,6 +26,7 @@ inline void sub_check(const Tensor& self, const Tensor& other) {
 
 using binary_fn_alpha = void(*)(TensorIterator&, Scalar alpha);
 using binary_fn = void(*)(TensorIterator&);
+using stochastic_round_add_fn = void(*)(Tensor&, const Tensor&, uint64_t seed);
 
 DECLARE_DISPATCH(binary_fn_alpha, add_stub);
 DECLARE_DISPATCH(binary_fn_alpha, sub_stub);
@@ -55,5 +56,6 @@ DECLARE_DISPATCH(binary_fn, tanh_backward_stub);
 DECLARE_DISPATCH(binary_fn, mse_stub);
 DECLARE_DISPATCH(binary_fn, fmod_stub);
 DECLARE_DISPATCH(binary_fn_alpha, fmod_scalar_stub);
+DECLARE_DISPATCH(stochastic_round_add_fn, stochastic_round_add_stub);
 
 }} // namespace at::native
@@ -1,12 +1,15 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/LegacyTHFunctionsCPU.h>
+#include <ATen/native/cpu/GroupedGemmKernel.h>
 
 // These are wrappers around the TH Linear Algebra / BLAS wrappers (mv, mm, bmm).
 
 namespace at {
 namespace native {
 
+DEFINE_DISPATCH(grouped_gemm_stub);
+
 Tensor & mv_cpu_out(Tensor & result, const Tensor & self, const Tensor & vec) {
   result.resize_({ self.size(0) });
   return legacy::cpu::_th_addmv_out(result, result, self, vec, 0, 1);
@@ -27,5 +30,61 @@ Tensor mm_cpu(const Tensor & self, const Tensor & mat2) {
   return mm_cpu_out(result, self, mat2);
 }
 
+// Multiplies each pair of matrices in two equally sized batches, with an
+// optional fused bias-add + relu epilogue. Small matrices (same threshold as
+// bmm's naive path) go through a single-pass vectorized microkernel that
+// applies the epilogue while each output block is hot; larger ones go through
+// bmm (MKL's cblas_?gemm_batch when available) followed by the epilogue.
+Tensor _grouped_mm_cpu(const Tensor& self, const Tensor& mat2, const Tensor& bias, bool relu) {
+  TORCH_CHECK(self.dim() == 3,
+    "_grouped_mm: expected 3-D batch of matrices, got ", self.dim(), "-D 'self'");
+  TORCH_CHECK(mat2.dim() == 3,
+    "_grouped_mm: expected 3-D batch of matrices, got ", mat2.dim(), "-D 'mat2'");
+  TORCH_CHECK(self.size(0) == mat2.size(0),
+    "_grouped_mm: batch sizes do not match: ", self.size(0), " != ", mat2.size(0));
+  TORCH_CHECK(self.size(2) == mat2.size(1),
+    "_grouped_mm: cannot multiply ", self.size(1), "x", self.size(2),
+    " and ", mat2.size(1), "x", mat2.size(2), " matrices");
+  TORCH_CHECK(mat2.scalar_type() == self.scalar_type(),
+    "_grouped_mm: expected both batches to have the same dtype, got ",
+    self.scalar_type(), " and ", mat2.scalar_type());
+  if (bias.defined()) {
+    TORCH_CHECK(bias.dim() == 1 && bias.size(0) == mat2.size(2),
+      "_grouped_mm: bias must be 1-D with ", mat2.size(2), " elements");
+    TORCH_CHECK(bias.scalar_type() == self.scalar_type(),
+      "_grouped_mm: expected bias to have dtype ", self.scalar_type(),
+      ", got ", bias.scalar_type());
+  }
+
+  int64_t bs = self.size(0);
+  int64_t is = self.size(1);
+  int64_t js = mat2.size(2);
+  int64_t ks = self.size(2);
+  Tensor result = at::empty({bs, is, js}, self.options());
+  if (result.numel() == 0) {
+    return result;
+  }
+
+  auto batch_items_contiguous = [](const Tensor& t) {
+    return t.stride(2) == 1 && t.stride(1) == t.size(2);
+  };
+  bool is_float = self.scalar_type() == kFloat || self.scalar_type() == kDouble;
+  if (is_float && is * js * ks < 400) {
+    auto a = batch_items_contiguous(self) ? self : self.contiguous();
+    auto b = batch_items_contiguous(mat2) ? mat2 : mat2.contiguous();
+    auto bias_ = bias.defined() ? bias.contiguous() : bias;
+    grouped_gemm_stub(kCPU, result, a, b, bias_, relu);
+  } else {
+    at::bmm_out(result, self, mat2);
+    if (bias.defined()) {
+      result.add_(bias);
+    }
+    if (relu) {
+      result.relu_();
+    }
+  }
+  return result;
+}
+
 } // namespace native
 } // namespace at
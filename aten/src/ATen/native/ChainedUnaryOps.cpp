@@ -0,0 +1,34 @@
+#include <ATen/native/ChainedUnaryOps.h>
+
+#include <ATen/ATen.h>
+#include <ATen/native/TensorIterator.h>
+
+namespace at { namespace native {
+
+DEFINE_DISPATCH(chained_unary_stub);
+
+Tensor& chained_unary_out(
+    Tensor& result,
+    const Tensor& self,
+    ArrayRef<ChainStage> stages) {
+  TORCH_CHECK(!stages.empty(), "chained_unary: expected at least one stage");
+  TORCH_CHECK(
+      static_cast<int64_t>(stages.size()) <= kMaxChainStages,
+      "chained_unary: got ", stages.size(), " stages, but at most ",
+      kMaxChainStages, " are supported");
+  TORCH_CHECK(
+      at::isFloatingType(self.scalar_type()),
+      "chained_unary: only floating point tensors are supported, got ",
+      self.scalar_type());
+  auto iter = TensorIterator::unary_op(result, self,
+    /*check_mem_overlap=*/true);
+  chained_unary_stub(iter.device_type(), iter, stages);
+  return result;
+}
+
+Tensor chained_unary(const Tensor& self, ArrayRef<ChainStage> stages) {
+  Tensor result = at::empty({0}, self.options());
+  return chained_unary_out(result, self, stages);
+}
+
+}} // namespace at::native
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+#include <c10/util/ArrayRef.h>
+
+namespace at { struct TensorIterator; }
+
+namespace at { namespace native {
+
+// A small runtime IR for chains of elementwise stages. Pipelines like
+// feature normalization (sub -> div -> clamp -> log1p) otherwise run as
+// one TensorIterator pass per op, re-reading the tensor from memory each
+// time; expressing the chain as a stage list lets the kernel apply all
+// stages to each element (and each Vec256 lane group) in a single pass.
+//
+// Each stage transforms the running value; `alpha` and `beta` carry the
+// stage's scalar operands (e.g. the subtrahend for SubScalar, or the
+// lower/upper bounds for Clamp) and are ignored by pure unary stages.
+struct ChainStage {
+  enum class Kind : uint8_t {
+    AddScalar, // x + alpha
+    SubScalar, // x - alpha
+    MulScalar, // x * alpha
+    DivScalar, // x / alpha
+    Clamp, // clamp(x, alpha, beta)
+    ClampMin, // max(x, alpha)
+    ClampMax, // min(x, alpha)
+    Neg,
+    Abs,
+    Reciprocal,
+    Sqrt,
+    Exp,
+    Log,
+    Log1p,
+    Sigmoid,
+    Relu,
+  };
+
+  Kind kind;
+  Scalar alpha = 0;
+  Scalar beta = 0;
+};
+
+constexpr int64_t kMaxChainStages = 8;
+
+using chained_unary_fn = void (*)(TensorIterator&, ArrayRef<ChainStage>);
+DECLARE_DISPATCH(chained_unary_fn, chained_unary_stub);
+
+// Applies the stages to `self` in order in a single elementwise pass.
+// Callable directly from C++ (and intended as the lowering target for
+// fusers that recognize such chains).
+CAFFE2_API Tensor chained_unary(const Tensor& self, ArrayRef<ChainStage> stages);
+CAFFE2_API Tensor& chained_unary_out(
+    Tensor& result,
+    const Tensor& self,
+    ArrayRef<ChainStage> stages);
+
+}} // namespace at::native
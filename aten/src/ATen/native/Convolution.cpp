@@ -1,6 +1,7 @@
 #include <limits>
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/core/grad_mode.h>
 #include <ATen/native/cpu/DepthwiseConvKernel.h>
 #include <ATen/native/utils/ParamUtils.h>
 #include <ATen/native/ConvUtils.h>
@@ -15,6 +16,7 @@ constexpr int MIOPEN_DIM_MAX = 5;
 namespace at { namespace native {
 
 DEFINE_DISPATCH(convolution_depthwise3x3_winograd_stub);
+DEFINE_DISPATCH(convolution_depthwise_direct_stub);
 
 struct ConvParams {
   std::vector<int64_t> stride;
@@ -36,6 +38,7 @@ struct ConvParams {
   bool is_stride_nonpos() const;
   void view1d_as_2d();
   bool use_cpu_depthwise3x3_winograd(const at::Tensor& input, const at::Tensor& weight) const;
+  bool use_cpu_depthwise_direct(const at::Tensor& input, const at::Tensor& weight) const;
   bool needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn(const at::Tensor& input, const at::Tensor& weight) const;
   bool use_cudnn_depthwise(const at::Tensor& input, const at::Tensor& weight) const;
@@ -149,6 +152,28 @@ auto ConvParams::use_cpu_depthwise3x3_winograd(
 #endif
 }
 
+// Direct CPU depthwise kernel for the configurations the Winograd kernel
+// does not cover (arbitrary kernel sizes, strides, dilations and the
+// channels-last layout). Only used when no gradient is required: the stub
+// computes the output directly and records no autograd ops. The generic
+// fallback for grouped CPU convolutions splits the input per group, which
+// for depthwise means one single-channel im2col convolution per channel.
+auto ConvParams::use_cpu_depthwise_direct(
+    const at::Tensor& input, const at::Tensor& weight) const -> bool {
+  return (input.ndimension() == 4) &&
+         (weight.ndimension() == 4) &&
+         (input.size(1) == groups) &&
+         (weight.size(0) == groups) &&
+         (weight.size(1) == 1) &&
+         (input.device().type() == c10::DeviceType::CPU) &&
+         (input.scalar_type() == at::kFloat) &&
+         (weight.device().type() == c10::DeviceType::CPU) &&
+         (weight.scalar_type() == at::kFloat) &&
+         !transposed &&
+         !is_padding_neg() &&
+         !at::GradMode::is_enabled();
+}
+
 auto ConvParams::needs_64bit_indexing_no_split(const at::Tensor& input, const at::Tensor& weight) const -> bool {
   constexpr int64_t int_max = std::numeric_limits<int>::max();
   int64_t numel_input = input.numel();
@@ -710,6 +735,9 @@ at::Tensor _convolution(
     if (params.use_cpu_depthwise3x3_winograd(input, weight)) {
       output = convolution_depthwise3x3_winograd_stub(
         input.device().type(), input, weight, bias, params.stride, params.padding, params.groups);
+    } else if (params.use_cpu_depthwise_direct(input, weight)) {
+      output = convolution_depthwise_direct_stub(
+        input.device().type(), input, weight, bias, params.stride, params.padding, params.dilation, params.groups);
     } else if (params.groups == 1) {
       output = at::_convolution_nogroup(
           input.contiguous(), weight, bias, params.stride, params.padding, params.dilation, params.transposed, params.output_padding);
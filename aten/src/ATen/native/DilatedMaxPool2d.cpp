@@ -3,12 +3,16 @@
 #include <ATen/NativeFunctions.h>
 #include <ATen/NamedTensorUtils.h>
 #include <ATen/native/Pool.h>
+#include <ATen/native/cpu/MaxPoolKernel.h>
 #include <tuple>
 
 
 namespace at {
 namespace native {
 
+DEFINE_DISPATCH(max_pool2d_channels_last_stub);
+DEFINE_DISPATCH(max_pool2d_backward_channels_last_stub);
+
 namespace {
 
 template <typename scalar_t>
@@ -171,8 +175,10 @@ void max_pool2d_with_indices_out_cpu_template(
     inputHeight, inputWidth,
     outputHeight, outputWidth);
 
-  /* get contiguous input */
-  Tensor input = input_.contiguous();
+  /* get contiguous input; channels-last inputs stay channels-last so that
+     conv -> pool -> conv chains avoid layout round trips */
+  const auto memory_format = input_.suggest_memory_format();
+  Tensor input = input_.contiguous(memory_format);
 
   /* resize output */
   if (input.ndimension() == 3)
@@ -203,9 +209,18 @@ void max_pool2d_with_indices_out_cpu_template(
   }
   else
   {
-    output.resize_({nbatch, nInputPlane, outputHeight, outputWidth});
+    output.resize_({nbatch, nInputPlane, outputHeight, outputWidth}, memory_format);
     /* indices will contain the locations for each output point */
-    indices.resize_({nbatch, nInputPlane, outputHeight, outputWidth});
+    indices.resize_({nbatch, nInputPlane, outputHeight, outputWidth}, memory_format);
+
+    if (memory_format == MemoryFormat::ChannelsLast) {
+      max_pool2d_channels_last_stub(
+        kCPU, output, indices, input,
+        kW, kH, dW, dH,
+        padW, padH,
+        dilationW, dilationH);
+      return;
+    }
 
     AT_DISPATCH_FLOATING_TYPES(input.scalar_type(),
       "max_pool2d_with_indices_cpu",
@@ -333,11 +348,12 @@ Tensor& max_pool2d_with_indices_backward_out_cpu_template(
   TORCH_CHECK((input.ndimension() == 3 || input.ndimension() == 4),
     "non-empty 3D or 4D (batch mode) tensor expected for input");
 
-  /* get contiguous gradOutput */
-  const Tensor gradOutput = gradOutput_.contiguous();
+  /* get contiguous gradOutput in the layout the forward pass produced */
+  const auto memory_format = input.suggest_memory_format();
+  const Tensor gradOutput = gradOutput_.contiguous(memory_format);
 
   /* resize */
-  gradInput.resize_as_(input);
+  gradInput.resize_(input.sizes(), memory_format);
   gradInput.zero_();
 
   /* sizes */
@@ -383,6 +399,11 @@ Tensor& max_pool2d_with_indices_backward_out_cpu_template(
       }
     );
   }
+  else if (memory_format == MemoryFormat::ChannelsLast)
+  {
+    max_pool2d_backward_channels_last_stub(
+      kCPU, gradInput, gradOutput, indices.contiguous(memory_format));
+  }
   else
   {
     AT_DISPATCH_FLOATING_TYPES(input.scalar_type(),
@@ -36,8 +36,18 @@ static CPUCapability compute_cpu_capability() {
   return CPUCapability::DEFAULT;
 }
 
+// NUM_OPTIONS means "no override"; see set_cpu_capability_override.
+static CPUCapability cpu_capability_override = CPUCapability::NUM_OPTIONS;
+
+void set_cpu_capability_override(CPUCapability capability) {
+  cpu_capability_override = capability;
+}
+
 CPUCapability get_cpu_capability() {
   static CPUCapability capability = compute_cpu_capability();
+  if (cpu_capability_override != CPUCapability::NUM_OPTIONS) {
+    return cpu_capability_override;
+  }
   return capability;
 }
 
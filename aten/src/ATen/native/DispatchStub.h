@@ -52,6 +52,15 @@ enum class CPUCapability {
 
 CPUCapability get_cpu_capability();
 
+// Overrides the capability reported by get_cpu_capability(). Only intended
+// for tests and benchmarks that want to compare the DEFAULT/AVX/AVX2
+// variants of a kernel within a single process. Stubs cache the kernel they
+// chose, so callers must also call reset_cpu_impl() on every stub they
+// exercise after changing the override. Pass CPUCapability::NUM_OPTIONS to
+// restore the detected capability. Overriding to a capability the machine
+// does not actually support will crash with SIGILL.
+CAFFE2_API void set_cpu_capability_override(CPUCapability capability);
+
 template <typename FnPtr, typename T>
 struct CAFFE2_API DispatchStub;
 
@@ -85,6 +94,13 @@ struct CAFFE2_API DispatchStub<rT (*)(Args...), T> {
     }
   }
 
+  // Clears the cached CPU kernel choice so that the next call goes through
+  // choose_cpu_impl() again. Only used together with
+  // set_cpu_capability_override().
+  void reset_cpu_impl() {
+    cpu_dispatch_ptr.store(nullptr, std::memory_order_relaxed);
+  }
+
   FnPtr choose_cpu_impl() {
     auto capability = static_cast<int>(get_cpu_capability());
     (void)capability;
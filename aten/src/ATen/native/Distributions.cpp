@@ -121,6 +121,7 @@ DEFINE_DISPATCH(multinomial_stub);
 DEFINE_DISPATCH(geometric_stub);
 DEFINE_DISPATCH(log_normal_stub);
 DEFINE_DISPATCH(normal_stub);
+DEFINE_DISPATCH(uniform_stub);
 DEFINE_DISPATCH(random_stub);
 DEFINE_DISPATCH(random_from_to_stub);
 DEFINE_DISPATCH(random_full_64_bits_range_stub);
@@ -219,6 +220,12 @@ Tensor& geometric_(Tensor& self, double p, Generator gen) {
   return self;
 }
 
+Tensor& uniform_cpu_(Tensor& self, double from, double to, Generator gen) {
+  TORCH_CHECK(from <= to, "uniform_ expects to return a [from, to) range, but found from=", from, " > to=", to);
+  uniform_stub(kCPU, self, from, to, gen);
+  return self;
+}
+
 Tensor& normal_cpu_(Tensor& self, double mean, double std, Generator gen) {
   TORCH_CHECK(std > 0.0, "normal_ expects std > 0.0, but found std=", std);
   normal_stub(kCPU, self, mean, std, gen);
@@ -443,4 +450,123 @@ Tensor multinomial(const Tensor& self, int64_t n_sample, bool with_replacement,
   return result;
 }
 
+// Walker alias method for repeated sampling from one fixed categorical
+// distribution: _multinomial_alias_setup builds the alias table (J) and the
+// acceptance probabilities (q, scaled by the number of categories) once in
+// O(K), after which _multinomial_alias_draw produces each sample with one
+// uniform draw and one table lookup instead of rebuilding the cumulative
+// distribution and binary searching like multinomial does.
+std::tuple<Tensor, Tensor> multinomial_alias_setup_cpu(const Tensor& probs) {
+  TORCH_CHECK(probs.dim() == 1,
+      "expected 1-D probability tensor, got ", probs.dim(), "-D probability tensor instead");
+  TORCH_CHECK(at::isFloatingType(probs.scalar_type()),
+      "multinomial alias setup only supports floating-point dtypes for probs, got: ", probs.scalar_type());
+  const int64_t K = probs.numel();
+  TORCH_CHECK(K > 0, "expected a non-empty probability tensor");
+  Tensor J = at::empty({K}, probs.options().dtype(kLong));
+  Tensor q = at::empty({K}, probs.options());
+
+  AT_DISPATCH_FLOATING_TYPES(probs.scalar_type(), "multinomial_alias_setup_cpu", [&] {
+    Tensor probs_contig = probs.contiguous();
+    const scalar_t* probs_ptr = probs_contig.data_ptr<scalar_t>();
+    int64_t* J_ptr = J.data_ptr<int64_t>();
+    scalar_t* q_ptr = q.data_ptr<scalar_t>();
+
+    // Partition the categories into those with less and those with at least
+    // the average probability mass.
+    std::vector<int64_t> smaller, larger;
+    smaller.reserve(K);
+    larger.reserve(K);
+    for (int64_t i = 0; i < K; i++) {
+      const scalar_t val = probs_ptr[i];
+      TORCH_CHECK(val >= 0,
+          "invalid multinomial distribution (encountering probability entry < 0)");
+      J_ptr[i] = -1;
+      q_ptr[i] = K * val;
+      if (q_ptr[i] < 1.0) {
+        smaller.push_back(i);
+      } else {
+        larger.push_back(i);
+      }
+    }
+
+    // Pair each small outcome with a large one: the large outcome fills up
+    // the remainder of the small outcome's equal-sized bucket.
+    while (!smaller.empty() && !larger.empty()) {
+      const int64_t large = larger.back();
+      const int64_t small = smaller.back();
+      smaller.pop_back();
+
+      J_ptr[small] = large;
+      q_ptr[large] -= 1.0 - q_ptr[small];
+
+      if (q_ptr[large] < 1.0) {
+        larger.pop_back();
+        smaller.push_back(large);
+      }
+    }
+
+    // Guard against rounding drift: scale acceptance probabilities back into
+    // [0, 1] and make buckets without an alias always accept.
+    scalar_t q_min = q_ptr[0];
+    scalar_t q_max = q_ptr[0];
+    for (int64_t i = 0; i < K; i++) {
+      q_min = std::min(q_min, q_ptr[i]);
+      q_max = std::max(q_max, q_ptr[i]);
+    }
+    TORCH_CHECK(q_min >= 0, "q_min is less than 0");
+    if (q_max > 1.0) {
+      for (int64_t i = 0; i < K; i++) {
+        q_ptr[i] /= q_max;
+      }
+    }
+    for (int64_t i = 0; i < K; i++) {
+      if (J_ptr[i] < 0) {
+        q_ptr[i] = 1.0;
+      }
+    }
+  });
+  return std::make_tuple(J, q);
+}
+
+Tensor multinomial_alias_draw_cpu(const Tensor& J, const Tensor& q, int64_t n_sample, Generator generator) {
+  TORCH_CHECK(J.dim() == 1,
+      "expected 1-D alias table, got ", J.dim(), "-D alias table instead");
+  TORCH_CHECK(q.dim() == 1,
+      "expected 1-D probability table, got ", q.dim(), "-D probability table instead");
+  TORCH_CHECK(J.scalar_type() == ScalarType::Long,
+      "expected Long alias table, got: ", J.scalar_type());
+  TORCH_CHECK(J.numel() == q.numel(),
+      "alias and probability tables must have the same number of categories, got ",
+      J.numel(), " and ", q.numel());
+  TORCH_CHECK(n_sample > 0, "cannot sample n_sample <= 0 samples");
+  const int64_t K = J.numel();
+  Tensor result = at::empty({n_sample}, J.options());
+
+  auto gen = get_generator_or_default<CPUGenerator>(generator, detail::getDefaultCPUGenerator());
+  // See Note [Acquire lock when using random generators]
+  std::lock_guard<std::mutex> lock(gen->mutex_);
+
+  AT_DISPATCH_FLOATING_TYPES(q.scalar_type(), "multinomial_alias_draw_cpu", [&] {
+    Tensor J_contig = J.contiguous();
+    Tensor q_contig = q.contiguous();
+    const int64_t* J_ptr = J_contig.data_ptr<int64_t>();
+    const scalar_t* q_ptr = q_contig.data_ptr<scalar_t>();
+    int64_t* result_ptr = result.data_ptr<int64_t>();
+
+    for (int64_t i = 0; i < n_sample; i++) {
+      // One uniform draw serves both decisions: the integer part picks the
+      // bucket and the fractional part is an independent uniform used for
+      // the accept/alias coin flip.
+      at::uniform_real_distribution<double> uniform(0, K);
+      const double u = uniform(gen);
+      const int64_t rand_ind = std::min(static_cast<int64_t>(u), K - 1);
+      const double frac = u - static_cast<double>(rand_ind);
+      result_ptr[i] =
+          frac < static_cast<double>(q_ptr[rand_ind]) ? rand_ind : J_ptr[rand_ind];
+    }
+  });
+  return result;
+}
+
 }} // namespace at::native
@@ -0,0 +1,91 @@
+#include <ATen/ATen.h>
+#include <ATen/native/ForeachOps.h>
+
+namespace at {
+namespace native {
+
+DEFINE_DISPATCH(foreach_add_scalar_stub);
+DEFINE_DISPATCH(foreach_mul_scalar_stub);
+DEFINE_DISPATCH(foreach_exp_stub);
+
+namespace {
+
+// The _foreach entry points amortize dispatch over a whole list: shapes and
+// layouts are validated here once, and a single kernel then sweeps every
+// tensor's data. The fast path requires contiguous dense CPU tensors of one
+// dtype; anything else (CUDA, strided views, mixed dtypes) falls back to
+// one regular op call per tensor, which is what callers would have written
+// by hand.
+bool can_use_fast_path(TensorList tensors, bool requires_floating) {
+  if (tensors.empty()) {
+    return false;
+  }
+  auto scalar_type = tensors[0].scalar_type();
+  if (requires_floating && !at::isFloatingType(scalar_type)) {
+    return false;
+  }
+  for (const auto& t : tensors) {
+    if (t.device().type() != DeviceType::CPU ||
+        t.layout() != at::kStrided || !t.is_contiguous() ||
+        t.scalar_type() != scalar_type) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::vector<Tensor> allocate_outputs(TensorList tensors) {
+  std::vector<Tensor> outputs;
+  outputs.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    outputs.push_back(at::empty_like(t, t.options()));
+  }
+  return outputs;
+}
+
+} // namespace
+
+std::vector<Tensor> _foreach_add(TensorList tensors, Scalar scalar) {
+  if (can_use_fast_path(tensors, /*requires_floating=*/false)) {
+    auto outputs = allocate_outputs(tensors);
+    foreach_add_scalar_stub(kCPU, outputs, tensors, scalar);
+    return outputs;
+  }
+  std::vector<Tensor> outputs;
+  outputs.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    outputs.push_back(t.add(scalar));
+  }
+  return outputs;
+}
+
+std::vector<Tensor> _foreach_mul(TensorList tensors, Scalar scalar) {
+  if (can_use_fast_path(tensors, /*requires_floating=*/false)) {
+    auto outputs = allocate_outputs(tensors);
+    foreach_mul_scalar_stub(kCPU, outputs, tensors, scalar);
+    return outputs;
+  }
+  std::vector<Tensor> outputs;
+  outputs.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    outputs.push_back(t.mul(scalar));
+  }
+  return outputs;
+}
+
+std::vector<Tensor> _foreach_exp(TensorList tensors) {
+  if (can_use_fast_path(tensors, /*requires_floating=*/true)) {
+    auto outputs = allocate_outputs(tensors);
+    foreach_exp_stub(kCPU, outputs, tensors);
+    return outputs;
+  }
+  std::vector<Tensor> outputs;
+  outputs.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    outputs.push_back(t.exp());
+  }
+  return outputs;
+}
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at {
+namespace native {
+
+// Kernels behind the _foreach op family. They are only called once the entry
+// points in ForeachOps.cpp have verified that every tensor is a contiguous
+// dense CPU tensor of the same dtype; inputs and outputs line up index for
+// index.
+using foreach_unary_fn = void (*)(TensorList outputs, TensorList inputs);
+using foreach_scalar_fn =
+    void (*)(TensorList outputs, TensorList inputs, Scalar scalar);
+
+DECLARE_DISPATCH(foreach_scalar_fn, foreach_add_scalar_stub);
+DECLARE_DISPATCH(foreach_scalar_fn, foreach_mul_scalar_stub);
+DECLARE_DISPATCH(foreach_unary_fn, foreach_exp_stub);
+
+} // namespace native
+} // namespace at
@@ -0,0 +1,292 @@
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+
+#include <cmath>
+
+namespace at { namespace native {
+
+namespace {
+
+// NOTE [ Foreach kernels ]
+//
+// The _foreach_* operators apply the same elementwise update to every tensor
+// in a list. Their purpose is to let callers that update many small tensors
+// (most importantly optimizer steps, which issue a handful of elementwise ops
+// per parameter) pay the dispatch and kernel setup cost once per list instead
+// of once per tensor.
+//
+// When all tensors in all argument lists live on CPU, are contiguous and
+// strided, share one floating point dtype and have matching sizes, we take a
+// fast path: a single parallel region over the tensors in the list, with a
+// plain elementwise loop per tensor. Work is split at tensor granularity,
+// which is the right trade-off for the many-small-tensors workloads these ops
+// are built for. Otherwise (CUDA, non-contiguous inputs, mixed dtypes, ...)
+// each op falls back to a per-tensor loop over the equivalent at:: call,
+// which keeps the semantics identical on every backend while still saving
+// the caller per-tensor dispatches on the fast path.
+
+void check_foreach_api_restrictions(TensorList tensors) {
+  TORCH_CHECK(tensors.size() > 0, "Tensor list must have at least one tensor.");
+}
+
+void check_foreach_api_restrictions(TensorList tensors1, TensorList tensors2) {
+  check_foreach_api_restrictions(tensors1);
+  TORCH_CHECK(tensors1.size() == tensors2.size(),
+              "Tensor lists must have the same number of tensors, got ",
+              tensors1.size(), " and ", tensors2.size());
+}
+
+void check_foreach_api_restrictions(TensorList tensors1, TensorList tensors2, TensorList tensors3) {
+  check_foreach_api_restrictions(tensors1, tensors2);
+  TORCH_CHECK(tensors1.size() == tensors3.size(),
+              "Tensor lists must have the same number of tensors, got ",
+              tensors1.size(), " and ", tensors3.size());
+}
+
+bool can_use_fast_route(ArrayRef<TensorList> lists) {
+  const auto expected_device = lists[0][0].device();
+  const auto expected_dtype = lists[0][0].scalar_type();
+  if (expected_device.type() != DeviceType::CPU ||
+      (expected_dtype != kFloat && expected_dtype != kDouble)) {
+    return false;
+  }
+  for (const auto& list : lists) {
+    for (size_t i = 0; i < list.size(); i++) {
+      const auto& t = list[i];
+      if (t.device() != expected_device ||
+          t.scalar_type() != expected_dtype ||
+          t.layout() != kStrided ||
+          !t.is_contiguous() ||
+          t.numel() != lists[0][i].numel()) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// The helpers below all parallelize at tensor granularity: each work item is
+// one whole tensor, processed with a simple elementwise loop.
+
+template <typename scalar_t, typename Op>
+void foreach_unary_cpu_(TensorList self, const Op& op) {
+  at::parallel_for(0, self.size(), 1, [&](int64_t begin, int64_t end) {
+    for (int64_t t = begin; t < end; t++) {
+      scalar_t* self_ptr = self[t].data_ptr<scalar_t>();
+      const int64_t n = self[t].numel();
+      for (int64_t i = 0; i < n; i++) {
+        self_ptr[i] = op(self_ptr[i]);
+      }
+    }
+  });
+}
+
+template <typename scalar_t, typename Op>
+void foreach_unary_cpu(TensorList result, TensorList self, const Op& op) {
+  at::parallel_for(0, self.size(), 1, [&](int64_t begin, int64_t end) {
+    for (int64_t t = begin; t < end; t++) {
+      scalar_t* result_ptr = result[t].data_ptr<scalar_t>();
+      const scalar_t* self_ptr = self[t].data_ptr<scalar_t>();
+      const int64_t n = self[t].numel();
+      for (int64_t i = 0; i < n; i++) {
+        result_ptr[i] = op(self_ptr[i]);
+      }
+    }
+  });
+}
+
+template <typename scalar_t, typename Op>
+void foreach_binary_cpu_(TensorList self, TensorList other, const Op& op) {
+  at::parallel_for(0, self.size(), 1, [&](int64_t begin, int64_t end) {
+    for (int64_t t = begin; t < end; t++) {
+      scalar_t* self_ptr = self[t].data_ptr<scalar_t>();
+      const scalar_t* other_ptr = other[t].data_ptr<scalar_t>();
+      const int64_t n = self[t].numel();
+      for (int64_t i = 0; i < n; i++) {
+        self_ptr[i] = op(self_ptr[i], other_ptr[i]);
+      }
+    }
+  });
+}
+
+template <typename scalar_t, typename Op>
+void foreach_binary_cpu(TensorList result, TensorList self, TensorList other, const Op& op) {
+  at::parallel_for(0, self.size(), 1, [&](int64_t begin, int64_t end) {
+    for (int64_t t = begin; t < end; t++) {
+      scalar_t* result_ptr = result[t].data_ptr<scalar_t>();
+      const scalar_t* self_ptr = self[t].data_ptr<scalar_t>();
+      const scalar_t* other_ptr = other[t].data_ptr<scalar_t>();
+      const int64_t n = self[t].numel();
+      for (int64_t i = 0; i < n; i++) {
+        result_ptr[i] = op(self_ptr[i], other_ptr[i]);
+      }
+    }
+  });
+}
+
+template <typename scalar_t, typename Op>
+void foreach_pointwise_cpu_(TensorList self, TensorList tensor1, TensorList tensor2, const Op& op) {
+  at::parallel_for(0, self.size(), 1, [&](int64_t begin, int64_t end) {
+    for (int64_t t = begin; t < end; t++) {
+      scalar_t* self_ptr = self[t].data_ptr<scalar_t>();
+      const scalar_t* tensor1_ptr = tensor1[t].data_ptr<scalar_t>();
+      const scalar_t* tensor2_ptr = tensor2[t].data_ptr<scalar_t>();
+      const int64_t n = self[t].numel();
+      for (int64_t i = 0; i < n; i++) {
+        self_ptr[i] = op(self_ptr[i], tensor1_ptr[i], tensor2_ptr[i]);
+      }
+    }
+  });
+}
+
+} // namespace
+
+std::vector<Tensor> _foreach_add(TensorList tensors1, TensorList tensors2, Scalar alpha) {
+  check_foreach_api_restrictions(tensors1, tensors2);
+
+  std::vector<Tensor> result;
+  result.reserve(tensors1.size());
+  if (!can_use_fast_route({tensors1, tensors2})) {
+    for (size_t i = 0; i < tensors1.size(); i++) {
+      result.push_back(tensors1[i].add(tensors2[i], alpha));
+    }
+    return result;
+  }
+
+  for (const auto& t : tensors1) {
+    result.push_back(at::empty_like(t));
+  }
+  AT_DISPATCH_FLOATING_TYPES(tensors1[0].scalar_type(), "_foreach_add", [&]() {
+    const scalar_t a = alpha.to<scalar_t>();
+    foreach_binary_cpu<scalar_t>(result, tensors1, tensors2,
+        [a](scalar_t x, scalar_t y) -> scalar_t { return x + a * y; });
+  });
+  return result;
+}
+
+void _foreach_add_(TensorList self, TensorList other, Scalar alpha) {
+  check_foreach_api_restrictions(self, other);
+
+  if (!can_use_fast_route({self, other})) {
+    for (size_t i = 0; i < self.size(); i++) {
+      self[i].add_(other[i], alpha);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(self[0].scalar_type(), "_foreach_add_", [&]() {
+    const scalar_t a = alpha.to<scalar_t>();
+    foreach_binary_cpu_<scalar_t>(self, other,
+        [a](scalar_t x, scalar_t y) -> scalar_t { return x + a * y; });
+  });
+}
+
+void _foreach_add_(TensorList self, Scalar scalar) {
+  check_foreach_api_restrictions(self);
+
+  if (!can_use_fast_route({self})) {
+    for (const auto& t : self) {
+      t.add_(scalar);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(self[0].scalar_type(), "_foreach_add_", [&]() {
+    const scalar_t s = scalar.to<scalar_t>();
+    foreach_unary_cpu_<scalar_t>(self,
+        [s](scalar_t x) -> scalar_t { return x + s; });
+  });
+}
+
+void _foreach_mul_(TensorList self, Scalar scalar) {
+  check_foreach_api_restrictions(self);
+
+  if (!can_use_fast_route({self})) {
+    for (const auto& t : self) {
+      t.mul_(scalar);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(self[0].scalar_type(), "_foreach_mul_", [&]() {
+    const scalar_t s = scalar.to<scalar_t>();
+    foreach_unary_cpu_<scalar_t>(self,
+        [s](scalar_t x) -> scalar_t { return x * s; });
+  });
+}
+
+void _foreach_div_(TensorList self, Scalar scalar) {
+  check_foreach_api_restrictions(self);
+
+  if (!can_use_fast_route({self})) {
+    for (const auto& t : self) {
+      t.div_(scalar);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(self[0].scalar_type(), "_foreach_div_", [&]() {
+    const scalar_t s = scalar.to<scalar_t>();
+    foreach_unary_cpu_<scalar_t>(self,
+        [s](scalar_t x) -> scalar_t { return x / s; });
+  });
+}
+
+std::vector<Tensor> _foreach_sqrt(TensorList tensors) {
+  check_foreach_api_restrictions(tensors);
+
+  std::vector<Tensor> result;
+  result.reserve(tensors.size());
+  if (!can_use_fast_route({tensors})) {
+    for (const auto& t : tensors) {
+      result.push_back(t.sqrt());
+    }
+    return result;
+  }
+
+  for (const auto& t : tensors) {
+    result.push_back(at::empty_like(t));
+  }
+  AT_DISPATCH_FLOATING_TYPES(tensors[0].scalar_type(), "_foreach_sqrt", [&]() {
+    foreach_unary_cpu<scalar_t>(result, tensors,
+        [](scalar_t x) -> scalar_t { return std::sqrt(x); });
+  });
+  return result;
+}
+
+void _foreach_addcmul_(TensorList self, TensorList tensor1, TensorList tensor2, Scalar value) {
+  check_foreach_api_restrictions(self, tensor1, tensor2);
+
+  if (!can_use_fast_route({self, tensor1, tensor2})) {
+    for (size_t i = 0; i < self.size(); i++) {
+      self[i].addcmul_(tensor1[i], tensor2[i], value);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(self[0].scalar_type(), "_foreach_addcmul_", [&]() {
+    const scalar_t v = value.to<scalar_t>();
+    foreach_pointwise_cpu_<scalar_t>(self, tensor1, tensor2,
+        [v](scalar_t x, scalar_t y, scalar_t z) -> scalar_t { return x + v * y * z; });
+  });
+}
+
+void _foreach_addcdiv_(TensorList self, TensorList tensor1, TensorList tensor2, Scalar value) {
+  check_foreach_api_restrictions(self, tensor1, tensor2);
+
+  if (!can_use_fast_route({self, tensor1, tensor2})) {
+    for (size_t i = 0; i < self.size(); i++) {
+      self[i].addcdiv_(tensor1[i], tensor2[i], value);
+    }
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(self[0].scalar_type(), "_foreach_addcdiv_", [&]() {
+    const scalar_t v = value.to<scalar_t>();
+    foreach_pointwise_cpu_<scalar_t>(self, tensor1, tensor2,
+        [v](scalar_t x, scalar_t y, scalar_t z) -> scalar_t { return x + v * y / z; });
+  });
+}
+
+}} // namespace at::native
@@ -392,6 +392,62 @@ Tensor grid_sampler_2d_cpu(const Tensor& input, const Tensor& grid,
 
 DEFINE_DISPATCH(grid_sampler_2d_cpu_kernel);
 
+// Compiles a sampling grid into a packed (offsets, weights) plan that can be
+// applied to successive inputs without redoing any coordinate math.
+// See NOTE [ Grid sample plans ] in cpu/GridSamplerKernel.cpp.
+std::tuple<Tensor, Tensor>
+grid_sampler_2d_compile_plan_cpu(const Tensor& grid, int64_t input_h, int64_t input_w,
+                                 int64_t interpolation_mode, int64_t padding_mode,
+                                 bool align_corners) {
+  TORCH_CHECK(
+    grid.dim() == 4 && grid.size(3) == 2,
+    "grid_sampler_2d_compile_plan(): expected 4D grid with last dimension 2, "
+    "but got grid with sizes ", grid.sizes());
+  TORCH_CHECK(
+    input_h > 0 && input_w > 0,
+    "grid_sampler_2d_compile_plan(): expected positive input height and width, "
+    "but got (", input_h, ", ", input_w, ")");
+  return grid_sampler_2d_compile_plan_cpu_kernel(
+    kCPU, grid, input_h, input_w, interpolation_mode, padding_mode, align_corners);
+}
+
+DEFINE_DISPATCH(grid_sampler_2d_compile_plan_cpu_kernel);
+
+// Applies a plan produced by grid_sampler_2d_compile_plan to an input batch.
+// This is the per-frame hot path: a pure gather-FMA kernel.
+// See NOTE [ Grid sample plans ] in cpu/GridSamplerKernel.cpp.
+Tensor grid_sampler_2d_apply_plan_cpu(const Tensor& input, const Tensor& offsets,
+                                      const Tensor& weights) {
+  TORCH_CHECK(
+    input.dim() == 4,
+    "grid_sampler_2d_apply_plan(): expected 4D input, but got input with sizes ",
+    input.sizes());
+  TORCH_CHECK(
+    offsets.dim() == 4 && offsets.size(1) == 4 && offsets.sizes() == weights.sizes(),
+    "grid_sampler_2d_apply_plan(): expected offsets and weights of shape "
+    "[N, 4, H_out, W_out], but got offsets with sizes ", offsets.sizes(),
+    " and weights with sizes ", weights.sizes());
+  TORCH_CHECK(
+    input.size(0) == offsets.size(0),
+    "grid_sampler_2d_apply_plan(): expected plan and input to have the same "
+    "batch size, but got input with sizes ", input.sizes(),
+    " and offsets with sizes ", offsets.sizes());
+  TORCH_CHECK(
+    weights.scalar_type() == input.scalar_type(),
+    "grid_sampler_2d_apply_plan(): expected weights to have the same dtype as "
+    "input, but got ", weights.scalar_type(), " weights and ",
+    input.scalar_type(), " input");
+  TORCH_CHECK(
+    offsets.scalar_type() == (input.scalar_type() == kFloat ? kInt : kLong),
+    "grid_sampler_2d_apply_plan(): expected ",
+    (input.scalar_type() == kFloat ? kInt : kLong),
+    " offsets for ", input.scalar_type(), " input, but got ",
+    offsets.scalar_type(), " offsets");
+  return grid_sampler_2d_apply_plan_cpu_kernel(kCPU, input, offsets, weights);
+}
+
+DEFINE_DISPATCH(grid_sampler_2d_apply_plan_cpu_kernel);
+
 
 // No shape checking needed here. See # NOTE [ grid_sampler Native Functions ].
 Tensor grid_sampler_3d_cpu(const Tensor& input, const Tensor& grid,
@@ -10,6 +10,7 @@
 #include <ATen/Dispatch.h>
 #include <ATen/Parallel.h>
 #include <ATen/TensorUtils.h>
+#include <ATen/cpu/vec256/vec256.h>
 
 #include <numeric>
 #include <type_traits>
@@ -101,6 +102,11 @@ std::tuple<Tensor, Tensor> ctc_loss_cpu_template(const Tensor& log_probs, const
   // first the default
   log_alpha.narrow(1, 0, 1).fill_(neginf);
   at::parallel_for(0, batch_size, 0, [&](int64_t start, int64_t end) {
+    // workspace reused across the batch elements of this chunk: the target
+    // primes and the eq (6) skip-connection mask depend only on s, not t,
+    // so they are computed once per batch element instead of per (t, s).
+    std::vector<int64_t> target_primes(2 * max_target_length + 1);
+    std::vector<unsigned char> has_skip(2 * max_target_length + 1);
     for (int64_t b = start; b < end; b++) {
       int64_t input_length = input_lengths[b];
       int64_t target_length = target_lengths[b];
@@ -108,15 +114,20 @@ std::tuple<Tensor, Tensor> ctc_loss_cpu_template(const Tensor& log_probs, const
       auto log_alpha_a = log_alpha_a_global[b];
       int64_t tg_batch_offset = tg_batch_offsets[b];
 
+      for (int64_t s = 0; s < 2 * target_length + 1; s++) {
+        target_primes[s] = get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s, BLANK);
+        has_skip[s] = (s > 1) && (target_primes[s - 2] != target_primes[s]);
+      }
+
       // the first two items of alpha_t above eq (6)
       log_alpha_a[0][0] = log_probs_a[0][BLANK];
       if (target_length > 0)
-        log_alpha_a[0][1] = log_probs_a[0][get_target_prime(targets_data, tg_batch_offset, tg_target_stride, 1, BLANK)];
+        log_alpha_a[0][1] = log_probs_a[0][target_primes[1]];
 
       // now the loop over the inputs
       for (int64_t t=1; t<input_length; t++) {
         for (int64_t s=0; s<2*target_length+1; s++) {
-          auto current_target_prime = get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s, BLANK);
+          auto current_target_prime = target_primes[s];
           // this loop over s could be parallel/vectorized, too, but the required items are one index apart
           // alternatively, one might consider moving s to the outer loop to cache current_target_prime more (but then it needs to be descending)
           // for the cuda implementation, that gave a speed boost.
@@ -132,8 +143,7 @@ std::tuple<Tensor, Tensor> ctc_loss_cpu_template(const Tensor& log_probs, const
           } else {
             la2 = neginf;
           }
-          if ((s > 1) && (get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s-2, BLANK) !=
-                          current_target_prime)) {
+          if (has_skip[s]) {
             la3 = log_alpha_a[t-1][s-2];
             if (la3 > lamax)
               lamax = la3;
@@ -203,7 +213,11 @@ Tensor ctc_loss_backward_cpu_template(const Tensor& grad_out, const Tensor& log_
     max_target_length = targets.size(1);
   }
 
-  Tensor log_beta = at::empty_like(log_alpha, LEGACY_CONTIGUOUS_MEMORY_FORMAT);  // could be optimized to use only 2 rows
+  // Only rows t and t+1 of beta are ever live (eq (10)/(11) and the grad
+  // accumulation both consume beta at the t they produce it), so a two-row
+  // ping-pong workspace per batch element suffices instead of a full
+  // batch x time x 2*max_target_length+1 buffer.
+  Tensor log_beta = at::empty({batch_size, 2, 2*max_target_length+1}, log_probs.options());
   auto lpp  = log_probs.permute({1,0,2});
   auto log_probs_a_global = lpp.accessor<scalar_t, 3>();
   auto log_alpha_a_global = log_alpha.accessor<scalar_t, 3>();
@@ -212,9 +226,20 @@ Tensor ctc_loss_backward_cpu_template(const Tensor& grad_out, const Tensor& log_
   auto grad_a_global = gp.accessor<scalar_t, 3>();
   auto targets_data = targets.data_ptr<target_t>();
 
+  auto neg_log_likelihood_a = neg_log_likelihood.accessor<scalar_t, 1>();
+  auto grad_out_a = grad_out.accessor<scalar_t, 1>();
+  // the final gradient wrap-up can use Vec256 only when the label dimension
+  // is unit-stride in log_probs (grad is freshly allocated and always is)
+  const bool log_probs_unit_stride = lpp.stride(2) == 1;
+
   at::parallel_for(0, batch_size, 0, [&](int64_t start, int64_t end) {
+    // see the forward for why the target primes are hoisted out of the
+    // (t, s) loops; the workspace is reused across this chunk's batch
+    // elements
+    std::vector<int64_t> target_primes(2 * max_target_length + 1);
+    std::vector<unsigned char> has_skip(2 * max_target_length + 1);
     for (int64_t b = start; b < end; b++) {
-      scalar_t nll = neg_log_likelihood.accessor<scalar_t, 1>()[b];
+      scalar_t nll = neg_log_likelihood_a[b];
       if (zero_infinity &&  nll == std::numeric_limits<scalar_t>::infinity()) {
         grad.narrow(1, b, 1).zero_();
         continue;
@@ -228,43 +253,54 @@ Tensor ctc_loss_backward_cpu_template(const Tensor& grad_out, const Tensor& log_
       int64_t target_length = target_lengths[b];
       int64_t tg_batch_offset = tg_batch_offsets[b];
 
+      for (int64_t s = 0; s < 2 * target_length + 1; s++) {
+        target_primes[s] = get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s, BLANK);
+        has_skip[s] = (s > 1) && (target_primes[s - 2] != target_primes[s]);
+      }
+
       // the initialization of beta before eq (10)
       // here we do the fill for each batch item separately, as the input lengths will differ, so the t in which
       // we start varies
       if (input_length > 0) {
-        log_beta.narrow(0, b, 1).narrow(1, input_length-1, 1).fill_(neginf);
-        log_beta_a[input_length-1][2*target_length] = log_probs_a[input_length-1][BLANK];
-        grad_a[input_length-1][BLANK] = log_alpha_a[input_length-1][2*target_length] + log_beta_a[input_length-1][2*target_length];
+        auto log_beta_last = log_beta_a[(input_length-1) & 1];
+        for (int64_t s = 0; s < 2*target_length+1; s++) {
+          log_beta_last[s] = neginf;
+        }
+        log_beta_last[2*target_length] = log_probs_a[input_length-1][BLANK];
+        grad_a[input_length-1][BLANK] = log_alpha_a[input_length-1][2*target_length] + log_beta_last[2*target_length];
 
         if (target_length > 0) {
-          auto current_target_prime = get_target_prime(targets_data, tg_batch_offset, tg_target_stride, 2*target_length-1, BLANK);
-          log_beta_a[input_length-1][2*target_length-1] = log_probs_a[input_length-1][current_target_prime];
+          auto current_target_prime = target_primes[2*target_length-1];
+          log_beta_last[2*target_length-1] = log_probs_a[input_length-1][current_target_prime];
 
           // the first two are a blank and a non-blank, so we know they are different and we don't need to do log+
-          grad_a[input_length-1][current_target_prime] = log_alpha_a[input_length-1][2*target_length-1] + log_beta_a[input_length-1][2*target_length-1];
+          grad_a[input_length-1][current_target_prime] = log_alpha_a[input_length-1][2*target_length-1] + log_beta_last[2*target_length-1];
         }
       }
 
       // now loop applying eq (10) / (11)
       for (int64_t t=input_length-2; t>=0; t--) {
+        auto log_beta_cur = log_beta_a[t & 1];
+        auto log_beta_next = log_beta_a[(t+1) & 1];
         // this loop over s could be parallel/vectorized and doesn't really need to be descending...
         // alternatively, one might consider moving s to the outer loop to cache current_target_prime more (but then it needs to be descending)
         // for the cuda implementation, that gave a speed boost.
         for (int64_t s=2*target_length; s>=0; s--) {
-          scalar_t lb1 = log_beta_a[t+1][s];
+          scalar_t lb1 = log_beta_next[s];
           scalar_t lbmax = lb1;
           scalar_t lb2, lb3;
-          auto current_target_prime = get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s, BLANK);
+          auto current_target_prime = target_primes[s];
           if (s < 2*target_length) {
-            lb2 = log_beta_a[t+1][s+1];
+            lb2 = log_beta_next[s+1];
             if (lb2 > lbmax)
               lbmax = lb2;
           } else {
             lb2 = neginf;
           }
-          if ((s < 2*target_length-1) && (get_target_prime(targets_data, tg_batch_offset, tg_target_stride, s+2, BLANK) !=
-                                          current_target_prime)) {
-            lb3 = log_beta_a[t+1][s+2];
+          // has_skip relates s to s-2; seen from s it also tells whether
+          // the s+2 transition of eq (11) is allowed
+          if ((s < 2*target_length-1) && has_skip[s+2]) {
+            lb3 = log_beta_next[s+2];
             if (lb3 > lbmax)
               lbmax = lb3;
           } else {
@@ -273,13 +309,13 @@ Tensor ctc_loss_backward_cpu_template(const Tensor& grad_out, const Tensor& log_
           if (lbmax == neginf)
             lbmax = 0;
 
-          log_beta_a[t][s] = std::log(std::exp(lb1-lbmax)+std::exp(lb2-lbmax)+std::exp(lb3-lbmax))+lbmax + log_probs_a[t][current_target_prime];
+          log_beta_cur[s] = std::log(std::exp(lb1-lbmax)+std::exp(lb2-lbmax)+std::exp(lb3-lbmax))+lbmax + log_probs_a[t][current_target_prime];
           // one might check whether one can vectorize this better when done after the t-loop...
           // now that we have beta, we fill in the sum of alpha*beta in eq (16)
           // in contrast to the cuda implementation, we only parallelize over the batch, so we don't have a concurrency
           // issue (several s can map to the same target character)
           // collected[b, t, target'[s]] "log+=" log_alpha[t, s]+log_beta[t, s]
-          scalar_t log_alpha_beta =  log_alpha_a[t][s] + log_beta_a[t][s];
+          scalar_t log_alpha_beta =  log_alpha_a[t][s] + log_beta_cur[s];
           scalar_t &lcab = grad_a[t][current_target_prime];
           if (lcab == neginf) {
             lcab = log_alpha_beta;
@@ -292,14 +328,34 @@ Tensor ctc_loss_backward_cpu_template(const Tensor& grad_out, const Tensor& log_
 
       // now grad has the sum of eq (16)
       // now we wrap up the calculation by adding in the remaining items of eq (16)
-      // this could be a great target for further vectorization.
       // grad is the output gradient, nll is the loss. Note that the likelihood -nll is the Z of eq (16)
-      scalar_t gr =  grad_out.accessor<scalar_t, 1>()[b];
-      for (int64_t t = 0; t < input_length; t++) { // or go for the full thing?
-        for (int64_t c = 0; c < num_labels; c++) {
-          scalar_t& res = grad_a[t][c];
-          scalar_t lp = log_probs_a[t][c];
-          res = (std::exp(lp)-std::exp(res + nll - lp)) * gr;
+      scalar_t gr = grad_out_a[b];
+      if (log_probs_unit_stride) {
+        using Vec = vec256::Vec256<scalar_t>;
+        const Vec nll_vec(nll);
+        const Vec gr_vec(gr);
+        for (int64_t t = 0; t < input_length; t++) {
+          scalar_t* grad_row = grad_a[t].data();
+          const scalar_t* lp_row = log_probs_a[t].data();
+          int64_t c = 0;
+          for (; c + Vec::size() <= num_labels; c += Vec::size()) {
+            const Vec lp = Vec::loadu(lp_row + c);
+            const Vec res = Vec::loadu(grad_row + c);
+            ((lp.exp() - (res + nll_vec - lp).exp()) * gr_vec).store(grad_row + c);
+          }
+          for (; c < num_labels; c++) {
+            scalar_t& res = grad_row[c];
+            scalar_t lp = lp_row[c];
+            res = (std::exp(lp)-std::exp(res + nll - lp)) * gr;
+          }
+        }
+      } else {
+        for (int64_t t = 0; t < input_length; t++) { // or go for the full thing?
+          for (int64_t c = 0; c < num_labels; c++) {
+            scalar_t& res = grad_a[t][c];
+            scalar_t lp = log_probs_a[t][c];
+            res = (std::exp(lp)-std::exp(res + nll - lp)) * gr;
+          }
         }
       }
       // zero the remainder
@@ -4,6 +4,9 @@
 #include <ATen/Parallel.h>
 #include <ATen/TensorUtils.h>
 
+#include <cmath>
+#include <limits>
+
 namespace at {
 namespace native {
 
@@ -323,6 +326,205 @@ void nll_loss_backward_out_cpu_template(
       });
 }
 
+template <typename scalar_t>
+static void cross_entropy_loss_forward_frame(
+    Tensor& output,
+    Tensor& logsumexp,
+    Tensor& total_weight,
+    const Tensor& input,
+    const Tensor& target,
+    const Tensor& weight,
+    int64_t reduction,
+    int64_t ignore_index) {
+  using accscalar_t = at::acc_type<scalar_t, false>;
+  const auto batch_size = input.size(0);
+  const auto n_classes = input.size(1);
+
+  auto weight_contiguous = optional_contiguous(weight);
+  const scalar_t* weight_data = optional_data<scalar_t>(weight_contiguous);
+
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  const int64_t* target_data = target.data_ptr<int64_t>();
+  scalar_t* logsumexp_data = logsumexp.data_ptr<scalar_t>();
+
+  // Per-sample losses; when reducing this is batch-sized scratch, far below
+  // the [batch, n_classes] log-probability intermediate the decomposed
+  // log_softmax + nll_loss form materializes.
+  Tensor losses = reduction == Reduction::None
+      ? output
+      : at::empty({batch_size}, input.options());
+  scalar_t* losses_data = losses.data_ptr<scalar_t>();
+
+  at::parallel_for(0, batch_size, 1, [&](int64_t start, int64_t end) {
+    for (auto i = start; i < end; i++) {
+      const scalar_t* row = input_data + i * n_classes;
+
+      // Single streaming pass over the logits: the running sum is rescaled
+      // whenever a new maximum is found (an online logsumexp), so each
+      // logit is read exactly once.
+      accscalar_t max = -std::numeric_limits<accscalar_t>::infinity();
+      accscalar_t sum = 0;
+      for (int64_t j = 0; j < n_classes; j++) {
+        const accscalar_t x = row[j];
+        if (x > max) {
+          sum = sum * std::exp(max - x) + 1;
+          max = x;
+        } else {
+          sum += std::exp(x - max);
+        }
+      }
+      const accscalar_t lse = max + std::log(sum);
+      logsumexp_data[i] = static_cast<scalar_t>(lse);
+
+      const auto cur_target = target_data[i];
+      if (cur_target == ignore_index) {
+        losses_data[i] = 0;
+        continue;
+      }
+      TORCH_CHECK_INDEX(
+          cur_target >= 0 && cur_target < n_classes,
+          "Target ",
+          cur_target,
+          " is out of bounds.");
+      const scalar_t cur_weight = weight_data != nullptr
+          ? weight_data[cur_target]
+          : static_cast<scalar_t>(1);
+      losses_data[i] = static_cast<scalar_t>(
+          (lse - static_cast<accscalar_t>(row[cur_target])) * cur_weight);
+    }
+  });
+
+  if (reduction == Reduction::None) {
+    *total_weight.data_ptr<scalar_t>() = 0;
+    return;
+  }
+
+  scalar_t output_val = 0;
+  scalar_t total_weight_val = 0;
+  for (int64_t i = 0; i < batch_size; i++) {
+    output_val += losses_data[i];
+    const auto cur_target = target_data[i];
+    if (cur_target != ignore_index) {
+      total_weight_val += weight_data != nullptr ? weight_data[cur_target]
+                                                 : static_cast<scalar_t>(1);
+    }
+  }
+
+  if (reduction == Reduction::Mean &&
+      (total_weight_val != 0 || input.numel() == 0)) {
+    // allow NaN result for total_weight_val == 0 case, see #15870
+    output_val /= total_weight_val;
+  }
+
+  *output.data_ptr<scalar_t>() = output_val;
+  *total_weight.data_ptr<scalar_t>() = total_weight_val;
+}
+
+template <typename scalar_t>
+static void cross_entropy_loss_backward_frame(
+    Tensor& grad_input,
+    const Tensor& grad_output,
+    const Tensor& input,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    const Tensor& weight,
+    int64_t reduction,
+    int64_t ignore_index,
+    const Tensor& total_weight) {
+  using accscalar_t = at::acc_type<scalar_t, false>;
+  const auto batch_size = input.size(0);
+  const auto n_classes = input.size(1);
+
+  auto weight_contiguous = optional_contiguous(weight);
+  const scalar_t* weight_data = optional_data<scalar_t>(weight_contiguous);
+
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  const int64_t* target_data = target.data_ptr<int64_t>();
+  const scalar_t* logsumexp_data = logsumexp.data_ptr<scalar_t>();
+  scalar_t* grad_input_data = grad_input.data_ptr<scalar_t>();
+
+  const scalar_t* grad_output_data = nullptr; // per-sample, Reduction::None
+  accscalar_t grad_scale = 1; // shared, Reduction::Sum / Reduction::Mean
+  if (reduction == Reduction::None) {
+    grad_output_data = grad_output.data_ptr<scalar_t>();
+  } else {
+    TORCH_CHECK(
+        grad_output.dim() <= 1 && grad_output.numel() == 1,
+        "Expected a single element grad_output tensor, but got: ",
+        grad_output.sizes());
+    grad_scale = *grad_output.data_ptr<scalar_t>();
+    if (reduction == Reduction::Mean) {
+      const scalar_t total_weight_value = *total_weight.data_ptr<scalar_t>();
+      if (total_weight_value <= 0) {
+        return;
+      }
+      grad_scale /= total_weight_value;
+    }
+  }
+
+  at::parallel_for(0, batch_size, 1, [&](int64_t start, int64_t end) {
+    for (auto i = start; i < end; i++) {
+      const auto cur_target = target_data[i];
+      if (cur_target == ignore_index) {
+        // grad_input is pre-zeroed
+        continue;
+      }
+      TORCH_CHECK_INDEX(
+          cur_target >= 0 && cur_target < n_classes,
+          "Target ",
+          cur_target,
+          " is out of bounds.");
+
+      const scalar_t* row = input_data + i * n_classes;
+      scalar_t* grad_row = grad_input_data + i * n_classes;
+
+      accscalar_t coeff = weight_data != nullptr
+          ? static_cast<accscalar_t>(weight_data[cur_target])
+          : static_cast<accscalar_t>(1);
+      coeff *= reduction == Reduction::None
+          ? static_cast<accscalar_t>(grad_output_data[i])
+          : grad_scale;
+
+      // Recover the softmax from the saved per-row logsumexp; the gradient
+      // of the fused loss is coeff * (softmax(x) - onehot(target)).
+      const accscalar_t lse = logsumexp_data[i];
+      for (int64_t j = 0; j < n_classes; j++) {
+        const accscalar_t p = std::exp(static_cast<accscalar_t>(row[j]) - lse);
+        grad_row[j] = static_cast<scalar_t>(
+            coeff * (p - static_cast<accscalar_t>(j == cur_target)));
+      }
+    }
+  });
+}
+
+void cross_entropy_loss_shape_check(
+    const Tensor& input,
+    const Tensor& target,
+    const Tensor& weight) {
+  TORCH_CHECK(
+      input.dim() == 2, "2D input tensor expected, got: ", input.sizes());
+  TORCH_CHECK(
+      target.dim() == 1,
+      "1D target tensor expected, multi-target not supported");
+  TORCH_CHECK(
+      input.size(0) == target.size(0),
+      "size mismatch (got input: ",
+      input.sizes(),
+      ", target: ",
+      target.sizes(),
+      ")")
+
+  const auto n_classes = input.size(-1);
+
+  TORCH_CHECK(
+      !weight.defined() || weight.numel() == n_classes,
+      "weight tensor should be defined either for all ",
+      n_classes,
+      " classes or no classes"
+      " but got weight tensor of shape: ",
+      weight.sizes());
+}
+
 } // namespace
 
 std::tuple<Tensor&, Tensor&> nll_loss_forward_out_cpu(
@@ -393,5 +595,99 @@ Tensor nll_loss_backward_cpu(
   return grad_input;
 }
 
+std::tuple<Tensor, Tensor, Tensor> cross_entropy_loss_forward_cpu(
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& weight,
+    int64_t reduction,
+    int64_t ignore_index) {
+  cross_entropy_loss_shape_check(self, target, weight);
+
+  auto input_contiguous = self.contiguous();
+  auto target_contiguous = target.contiguous();
+
+  auto logsumexp = at::empty({self.size(0)}, self.options());
+  auto total_weight = at::empty({}, self.options());
+  Tensor output = reduction == Reduction::None
+      ? at::empty({self.size(0)}, self.options())
+      : at::empty({}, self.options());
+
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      ScalarType::BFloat16,
+      self.scalar_type(),
+      "cross_entropy_loss_forward_cpu",
+      [&] {
+        cross_entropy_loss_forward_frame<scalar_t>(
+            output,
+            logsumexp,
+            total_weight,
+            input_contiguous,
+            target_contiguous,
+            weight,
+            reduction,
+            ignore_index);
+      });
+  return std::make_tuple(output, logsumexp, total_weight);
+}
+
+Tensor cross_entropy_loss_backward_cpu(
+    const Tensor& grad_output,
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    const Tensor& weight,
+    int64_t reduction,
+    int64_t ignore_index,
+    const Tensor& total_weight) {
+  cross_entropy_loss_shape_check(self, target, weight);
+  if (reduction == Reduction::None) {
+    check_dim_size(grad_output, 1, 0, self.size(0));
+  }
+
+  auto input_contiguous = self.contiguous();
+  auto target_contiguous = target.contiguous();
+  auto logsumexp_contiguous = logsumexp.contiguous();
+  auto grad_output_contiguous = grad_output.contiguous();
+
+  auto grad_input = at::zeros_like(self, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+
+  AT_DISPATCH_FLOATING_TYPES_AND(
+      ScalarType::BFloat16,
+      self.scalar_type(),
+      "cross_entropy_loss_backward_cpu",
+      [&] {
+        cross_entropy_loss_backward_frame<scalar_t>(
+            grad_input,
+            grad_output_contiguous,
+            input_contiguous,
+            target_contiguous,
+            logsumexp_contiguous,
+            weight,
+            reduction,
+            ignore_index,
+            total_weight);
+      });
+  return grad_input;
+}
+
+Tensor cross_entropy_loss(
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& weight,
+    int64_t reduction,
+    int64_t ignore_index) {
+  if (self.dim() == 2 && at::isFloatingType(self.scalar_type())) {
+    return std::get<0>(at::_cross_entropy_loss_forward(
+        self, target, weight, reduction, ignore_index));
+  }
+  // Shapes the fused kernel does not cover fall back to the decomposed form.
+  if (self.dim() == 4) {
+    return at::nll_loss2d(
+        at::log_softmax(self, 1), target, weight, reduction, ignore_index);
+  }
+  return at::nll_loss(
+      at::log_softmax(self, 1), target, weight, reduction, ignore_index);
+}
+
 } // namespace native
 } // namespace at
@@ -1,5 +1,8 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/Parallel.h>
+
+#include <cstring>
 
 namespace at { namespace native {
 
@@ -39,10 +42,84 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     }
   }
 
-  std::vector<at::Tensor> steps;
-  steps.reserve(batch_size);
   at::Tensor batch_sizes_t = at::empty(lengths[0], _lengths.options());
   int64_t * batch_sizes = batch_sizes_t.data_ptr<int64_t>();
+  {
+    // batch_sizes[t] == number of sequences still alive at time step t.
+    // Scanning the (descending) lengths from the shortest, every increase in
+    // length opens a run of steps whose batch size is the number of
+    // sequences not yet exhausted.
+    int64_t prev_l = 0;
+    int64_t * bs_out = batch_sizes;
+    for (int64_t i = 0; i < batch_size; ++i) {
+      int64_t l = lengths[batch_size - 1 - i];
+      if (l > prev_l) {
+        auto current_batch_size = batch_size - i;
+        for (int64_t j = 0; j < (l - prev_l); ++j) {
+          (*bs_out++) = current_batch_size;
+        }
+        prev_l = l;
+      }
+      TORCH_CHECK(l >= prev_l);
+    }
+  }
+
+  // Fused CPU fast path: with a contiguous input every valid row is a
+  // contiguous slab of bytes, so the whole gather reduces to one parallel
+  // pass of row copies driven by batch_sizes. This avoids the per-step
+  // slice/contiguous/cat of the generic path and, for batch-first input,
+  // gathers straight from the [B, T, ...] layout instead of materializing a
+  // transposed temporary.
+  if (_input.device().is_cpu() && _input.is_contiguous()) {
+    int64_t max_len = lengths[0];
+    int64_t total_rows = 0;
+    std::vector<int64_t> row_offsets(max_len);
+    for (int64_t t = 0; t < max_len; ++t) {
+      row_offsets[t] = total_rows;
+      total_rows += batch_sizes[t];
+    }
+
+    std::vector<int64_t> out_size; // == [total_rows, *input.shape[2:]]
+    {
+      auto s_input_sizes = input.sizes().slice(2);
+      out_size.reserve(s_input_sizes.size() + 1);
+      out_size.push_back(total_rows);
+      out_size.insert(out_size.end(), s_input_sizes.begin(), s_input_sizes.end());
+    }
+    Tensor out = at::empty(out_size, _input.options());
+
+    int64_t seq_len = input.size(0);
+    size_t row_bytes =
+        (_input.numel() / (seq_len * batch_size)) * _input.element_size();
+    const char* src = static_cast<const char*>(_input.data_ptr());
+    char* dst = static_cast<char*>(out.data_ptr());
+
+    at::parallel_for(0, max_len, 0, [&](int64_t begin, int64_t end) {
+      for (int64_t t = begin; t < end; ++t) {
+        char* dst_row = dst + row_offsets[t] * row_bytes;
+        if (batch_first) {
+          // the rows of step t live at input[b][t] for b < batch_sizes[t]
+          for (int64_t b = 0; b < batch_sizes[t]; ++b) {
+            memcpy(
+                dst_row + b * row_bytes,
+                src + ((size_t)b * seq_len + t) * row_bytes,
+                row_bytes);
+          }
+        } else {
+          // step t is a single contiguous slab of batch_sizes[t] rows
+          memcpy(
+              dst_row,
+              src + (size_t)t * batch_size * row_bytes,
+              batch_sizes[t] * row_bytes);
+        }
+      }
+    });
+
+    return std::make_tuple(out, batch_sizes_t);
+  }
+
+  std::vector<at::Tensor> steps;
+  steps.reserve(batch_size);
 
   std::vector<int64_t> step_shape; // == [-1, *input.shape[2:]]
   {
@@ -79,12 +156,8 @@ std::tuple<Tensor, Tensor> _pack_padded_sequence(const Tensor& _input, const Ten
     if (l > prev_l) {
       auto current_batch_size = batch_size - i;
       steps.push_back(input.slice(0, prev_l, l).slice(1, 0, current_batch_size).contiguous().view(step_shape));
-      for (int64_t j = 0; j < (l - prev_l); ++j) {
-        (*batch_sizes++) = current_batch_size;
-      }
       prev_l = l;
     }
-    TORCH_CHECK(l >= prev_l);
   }
 
   return std::make_tuple(at::cat(steps), batch_sizes_t);
@@ -134,6 +207,81 @@ std::tuple<Tensor, Tensor> _pad_packed_sequence(const Tensor& data, const Tensor
     max_seq_length = total_length;
   }
 
+  at::Tensor lengths_t = at::empty(max_batch_size, batch_sizes_t.options());
+  {
+    // lengths[b] == number of steps whose batch size still covers sequence b;
+    // walk batch_sizes once, emitting a length every time the batch shrinks.
+    int64_t * lengths = lengths_t.data_ptr<int64_t>() + max_batch_size - 1;
+    int64_t prev_batch_size = max_batch_size;
+    for (int64_t i = 0; i <= max_real_seq_length; ++i) {
+      int64_t batch_size = i != max_real_seq_length ? batch_sizes[i] : 0;
+      int64_t dec = prev_batch_size - batch_size;
+      for (int64_t j = 0; j < dec; ++j) {
+        (*lengths--) = i;
+      }
+      prev_batch_size = batch_size;
+    }
+  }
+
+  // Fused CPU fast path, mirroring the one in _pack_padded_sequence: the
+  // packed data is scattered back with one parallel pass of row copies, and
+  // batch-first output is produced directly in [B, T, ...] layout (and
+  // contiguous) instead of transposing a time-major copy.
+  if (data.device().is_cpu() && data.is_contiguous() && data.numel() > 0) {
+    std::vector<int64_t> out_size;
+    {
+      auto s_data_size = data.sizes().slice(1);
+      out_size.reserve(s_data_size.size() + 2);
+      if (batch_first) {
+        out_size.push_back(max_batch_size);
+        out_size.push_back(max_seq_length);
+      } else {
+        out_size.push_back(max_seq_length);
+        out_size.push_back(max_batch_size);
+      }
+      out_size.insert(out_size.end(), s_data_size.begin(), s_data_size.end());
+    }
+    auto output = at::full(out_size, padding_value, data.options());
+
+    std::vector<int64_t> row_offsets(max_real_seq_length);
+    int64_t total_rows = 0;
+    for (int64_t t = 0; t < max_real_seq_length; ++t) {
+      row_offsets[t] = total_rows;
+      total_rows += batch_sizes[t];
+    }
+
+    size_t row_bytes = (data.numel() / data.size(0)) * data.element_size();
+    const char* src = static_cast<const char*>(data.data_ptr());
+    char* dst = static_cast<char*>(output.data_ptr());
+    const int64_t * lengths = lengths_t.data_ptr<int64_t>();
+
+    if (batch_first) {
+      at::parallel_for(0, max_batch_size, 0, [&](int64_t begin, int64_t end) {
+        for (int64_t b = begin; b < end; ++b) {
+          char* dst_seq = dst + (size_t)b * max_seq_length * row_bytes;
+          for (int64_t t = 0; t < lengths[b]; ++t) {
+            memcpy(
+                dst_seq + t * row_bytes,
+                src + (row_offsets[t] + b) * row_bytes,
+                row_bytes);
+          }
+        }
+      });
+    } else {
+      at::parallel_for(0, max_real_seq_length, 0, [&](int64_t begin, int64_t end) {
+        for (int64_t t = begin; t < end; ++t) {
+          // step t is a single contiguous slab of batch_sizes[t] rows
+          memcpy(
+              dst + (size_t)t * max_batch_size * row_bytes,
+              src + row_offsets[t] * row_bytes,
+              batch_sizes[t] * row_bytes);
+        }
+      });
+    }
+
+    return std::make_tuple(output, lengths_t);
+  }
+
   std::vector<int64_t> output_size; // == [max_seq_length, max_batch_size, *var_data.size()[1:]]
   {
     output_size.reserve(data.dim() + 1);
@@ -147,8 +295,6 @@ std::tuple<Tensor, Tensor> _pad_packed_sequence(const Tensor& data, const Tensor
   // This will be modified at every iteration, but we reserve memory for it now.
   std::vector<int64_t> tmp_view_size = std::move(output_size); // == [-1, -1, *var_data.size()[1:]]
 
-  at::Tensor lengths_t = at::empty(max_batch_size, batch_sizes_t.options());
-  int64_t * lengths = lengths_t.data_ptr<int64_t>() + max_batch_size - 1;
   int64_t data_offset = 0;
   int64_t prev_batch_size = max_batch_size;
   int64_t prev_i = 0;
@@ -165,12 +311,6 @@ std::tuple<Tensor, Tensor> _pad_packed_sequence(const Tensor& data, const Tensor
       data_offset += l;
       prev_i = i;
     }
-    int64_t dec = prev_batch_size - batch_size;
-    if (dec > 0) {
-      for (int64_t j = 0; j < dec; ++j) {
-        (*lengths--) = i;
-      }
-    }
     prev_batch_size = batch_size;
   }
 
@@ -8,6 +8,7 @@ namespace native {
 
 DEFINE_DISPATCH(min_all_stub);
 DEFINE_DISPATCH(max_all_stub);
+DEFINE_DISPATCH(aminmax_all_stub);
 
 Tensor min(const Tensor &self) {
   TORCH_CHECK(self.numel() > 0, "operation does not have an identity.");
@@ -23,4 +24,12 @@ Tensor max(const Tensor &self) {
   return result;
 }
 
+std::tuple<Tensor, Tensor> _aminmax_all(const Tensor &self) {
+  TORCH_CHECK(self.numel() > 0, "operation does not have an identity.");
+  Tensor min_result = at::empty({}, self.options());
+  Tensor max_result = at::empty({}, self.options());
+  aminmax_all_stub(kCPU, min_result, max_result, self.contiguous());
+  return std::tuple<Tensor, Tensor>(min_result, max_result);
+}
+
 }} // namesapce at::native
@@ -9,4 +9,7 @@ using reduce_all_fn = void (*)(Tensor & result, const Tensor & self);
 DECLARE_DISPATCH(reduce_all_fn, min_all_stub);
 DECLARE_DISPATCH(reduce_all_fn, max_all_stub);
 
+using reduce_min_max_fn = void (*)(Tensor & min_result, Tensor & max_result, const Tensor & self);
+DECLARE_DISPATCH(reduce_min_max_fn, aminmax_all_stub);
+
 }}
@@ -35,6 +35,7 @@ DEFINE_DISPATCH(min_values_stub);
 DEFINE_DISPATCH(max_values_stub);
 DEFINE_DISPATCH(argmax_stub);
 DEFINE_DISPATCH(argmin_stub);
+DEFINE_DISPATCH(aminmax_stub);
 DEFINE_DISPATCH(cumsum_stub);
 DEFINE_DISPATCH(cumprod_stub);
 
@@ -921,6 +922,16 @@ std::tuple<Tensor,Tensor> var_mean(const Tensor& self, bool unbiased) {
   return at::native::var_mean_out(result1, result2, self, unbiased);
 }
 
+std::tuple<Tensor, Tensor> _aminmax(const Tensor& self, int64_t dim, bool keepdim) {
+  TORCH_CHECK(self.numel() > 0, "operation does not have an identity.");
+  Tensor min_result = at::empty({0}, self.options());
+  Tensor max_result = at::empty({0}, self.options());
+  auto iter = make_reduction("_aminmax", min_result, max_result, self, dim,
+                             keepdim, self.scalar_type());
+  aminmax_stub(iter.device_type(), iter);
+  return std::tuple<Tensor, Tensor>(min_result, max_result);
+}
+
 Tensor var(const Tensor& self, bool unbiased) {
   TORCH_CHECK(self.device().type() == DeviceType::CPU || self.device().type() == DeviceType::CUDA,
               "var only supports CPU AND CUDA device type, got: ", self.device().type());
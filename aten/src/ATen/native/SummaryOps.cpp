@@ -2,14 +2,56 @@
 
 #include <ATen/ATen.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/SummaryOps.h>
 
+#include <mutex>
 #include <tuple>
+#include <vector>
 
 namespace at { namespace native {
 
 ///////////////// bincount /////////////////
 namespace {
 
+// Above this many bins, per-thread privatized bin arrays cost more to
+// allocate and merge than the counting loop saves; fall back to the
+// serial loop instead.
+constexpr int64_t BINCOUNT_PRIVATIZE_MAX_BINS = 1 << 16;
+
+// Counting loop with per-thread privatized bin arrays merged under a
+// mutex, in the style of the histogram_observe kernel. `getval` maps an
+// element index to the value added to its bin (1 for plain counts, the
+// corresponding weight otherwise).
+template <typename input_t, typename output_t, typename F>
+void bincount_parallel(
+    const input_t* self_p,
+    output_t* output_p,
+    int64_t numel,
+    int64_t nbins,
+    const F& getval) {
+  if (numel < at::internal::GRAIN_SIZE ||
+      nbins > BINCOUNT_PRIVATIZE_MAX_BINS ||
+      at::get_num_threads() == 1) {
+    for (int64_t i = 0; i < numel; i++) {
+      output_p[self_p[i]] += getval(i);
+    }
+    return;
+  }
+  std::mutex merge_mutex;
+  at::parallel_for(
+      0, numel, at::internal::GRAIN_SIZE, [&](int64_t start, int64_t end) {
+        std::vector<output_t> local_bins(nbins, 0);
+        for (int64_t i = start; i < end; i++) {
+          local_bins[self_p[i]] += getval(i);
+        }
+        std::lock_guard<std::mutex> guard(merge_mutex);
+        for (int64_t b = 0; b < nbins; b++) {
+          output_p[b] += local_bins[b];
+        }
+      });
+}
+
 template <typename input_t, typename weights_t>
 Tensor _bincount_cpu_template(
     const Tensor& self,
@@ -35,19 +77,20 @@ Tensor _bincount_cpu_template(
   nbins = std::max(nbins, minlength); // at least minlength # of bins
 
   const input_t* self_p = self.data_ptr<input_t>();
+  const int64_t numel = self.size(0);
   if (has_weights) {
     output = native::zeros({nbins}, weights.options());
     weights_t* output_p = output.data_ptr<weights_t>();
     const weights_t* weights_p = weights.data_ptr<weights_t>();
-    for (int64_t i = 0; i < self.size(0); i++) {
-      output_p[self_p[i]] += weights_p[i];
-    }
+    bincount_parallel(
+        self_p, output_p, numel, nbins, [weights_p](int64_t i) {
+          return weights_p[i];
+        });
   } else {
     output = native::zeros({nbins}, kLong);
     int64_t* output_p = output.data_ptr<int64_t>();
-    for (int64_t i = 0; i < self.size(0); i++) {
-      output_p[self_p[i]] += 1L;
-    }
+    bincount_parallel(
+        self_p, output_p, numel, nbins, [](int64_t) { return int64_t{1}; });
   }
   return output;
 }
@@ -64,4 +107,40 @@ _bincount_cpu(const Tensor& self, const Tensor& weights, int64_t minlength) {
   });
 }
 
+///////////////// _histogram_observe /////////////////
+
+DEFINE_DISPATCH(histogram_observe_stub);
+
+// Fused helper for quantization histogram observers: computes the data
+// min/max and a fixed-bin histogram of `self` in one parallel kernel,
+// instead of separate min, max and (single-threaded) histc calls per
+// observed batch. Binning follows histc: when `min` == `max` the data range
+// is used, and elements outside [`min`, `max`] are ignored.
+std::tuple<Tensor, Tensor, Tensor> _histogram_observe_cpu(
+    const Tensor& self,
+    int64_t bins,
+    Scalar min,
+    Scalar max) {
+  TORCH_CHECK(bins > 0, "_histogram_observe: bins should be > 0, got ", bins);
+  TORCH_CHECK(
+      self.numel() > 0, "_histogram_observe: input tensor is empty");
+  TORCH_CHECK(
+      at::isFloatingType(self.scalar_type()),
+      "_histogram_observe only supports floating point inputs");
+  Tensor self_contig = self.contiguous();
+  Tensor hist = native::zeros({bins}, self.options());
+  Tensor out_min = at::empty({}, self.options());
+  Tensor out_max = at::empty({}, self.options());
+  histogram_observe_stub(
+      kCPU,
+      hist,
+      out_min,
+      out_max,
+      self_contig,
+      bins,
+      min.to<double>(),
+      max.to<double>());
+  return std::make_tuple(hist, out_min, out_max);
+}
+
 }} // namespace at::native
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at { namespace native {
+
+// Fills `hist` with a `bins`-bin histogram of `self` over [`min`, `max`]
+// and writes the binning range actually used into `out_min` and `out_max`.
+// When `min` == `max` the data minimum and maximum are computed in a
+// vectorized pass and used as the range; otherwise the given range is used
+// and the min/max pass is skipped.
+using histogram_observe_fn = void (*)(
+    Tensor& hist,
+    Tensor& out_min,
+    Tensor& out_max,
+    const Tensor& self,
+    int64_t bins,
+    double min,
+    double max);
+
+DECLARE_DISPATCH(histogram_observe_fn, histogram_observe_stub);
+
+}} // namespace at::native
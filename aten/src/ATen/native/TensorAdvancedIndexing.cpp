@@ -54,12 +54,15 @@
 #include <ATen/ATen.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/ExpandUtils.h>
+#include <ATen/LegacyTHFunctionsCPU.h>
+#include <ATen/NamedTensorUtils.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/BinaryOps.h>
 #include <ATen/native/Copy.h>
 #include <ATen/Parallel.h>
 
 #include <algorithm>
+#include <cstring>
 #include <functional>
 #include <numeric>
 #include <vector>
@@ -620,6 +623,216 @@ Tensor _gather_sparse_backward(const Tensor& self, int64_t dim, const Tensor& in
     return at::_sparse_coo_tensor_unsafe(sparse_ind, grad.reshape(-1), self.sizes());
 }
 
+namespace {
+
+// Counts nonzero bytes eight at a time: collapse each byte to 0x01/0x00 with
+// shift-or, then sum the eight lanes with a multiply whose top byte holds
+// the result. This is the hot loop for boolean masks.
+inline int64_t count_nonzero_bytes(const uint8_t* data, int64_t n) {
+  int64_t count = 0;
+  int64_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    uint64_t v;
+    std::memcpy(&v, data + i, sizeof(v));
+    v = (v | (v >> 4));
+    v = (v | (v >> 2));
+    v = (v | (v >> 1)) & 0x0101010101010101ull;
+    count += static_cast<int64_t>((v * 0x0101010101010101ull) >> 56);
+  }
+  for (; i < n; i++) {
+    count += (data[i] != 0);
+  }
+  return count;
+}
+
+template <typename scalar_t>
+int64_t count_nonzero_range(const scalar_t* data, int64_t begin, int64_t end) {
+  if (sizeof(scalar_t) == 1) {
+    return count_nonzero_bytes(
+        reinterpret_cast<const uint8_t*>(data) + begin, end - begin);
+  }
+  int64_t count = 0;
+  for (int64_t i = begin; i < end; i++) {
+    count += (data[i] != scalar_t(0));
+  }
+  return count;
+}
+
+// First pass shared by nonzero and masked_select: per-chunk nonzero counts,
+// turned in place into exclusive output offsets. Returns the total count.
+template <typename scalar_t>
+int64_t nonzero_chunk_offsets(
+    const scalar_t* data,
+    int64_t n,
+    int64_t chunk_size,
+    std::vector<int64_t>& offsets) {
+  const int64_t num_chunks = offsets.size();
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t chunk = begin; chunk < end; chunk++) {
+      offsets[chunk] = count_nonzero_range(
+          data, chunk * chunk_size, std::min(n, (chunk + 1) * chunk_size));
+    }
+  });
+  int64_t total = 0;
+  for (int64_t chunk = 0; chunk < num_chunks; chunk++) {
+    int64_t count = offsets[chunk];
+    offsets[chunk] = total;
+    total += count;
+  }
+  return total;
+}
+
+} // anonymous namespace
+
+Tensor& nonzero_out_cpu(Tensor& result, const Tensor& self) {
+  TORCH_CHECK(result.scalar_type() == kLong,
+      "nonzero: expected the output tensor to have long dtype, but got ",
+      result.scalar_type());
+  auto self_contig = self.contiguous();
+  const int64_t n = self_contig.numel();
+  const int64_t ndim = self.dim();
+  const int64_t chunk_size = at::internal::GRAIN_SIZE;
+  const int64_t num_chunks = (n + chunk_size - 1) / chunk_size;
+
+  AT_DISPATCH_ALL_TYPES_AND3(kBool, kHalf, kBFloat16,
+      self.scalar_type(), "nonzero_cpu", [&] {
+    const scalar_t* data = self_contig.data_ptr<scalar_t>();
+
+    std::vector<int64_t> offsets(num_chunks);
+    int64_t total = nonzero_chunk_offsets(data, n, chunk_size, offsets);
+
+    result.resize_({total, ndim});
+    if (total == 0 || ndim == 0) {
+      return;
+    }
+    // freshly resized, so the output is contiguous with strides {ndim, 1}
+    int64_t* out = result.data_ptr<int64_t>();
+    auto sizes = self_contig.sizes();
+
+    // Second pass: each chunk writes subscripts at its offset, maintaining
+    // the current subscript like an odometer instead of dividing per element
+    at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+      for (int64_t chunk = begin; chunk < end; chunk++) {
+        const int64_t i_begin = chunk * chunk_size;
+        const int64_t i_end = std::min(n, i_begin + chunk_size);
+        int64_t* out_ptr = out + offsets[chunk] * ndim;
+        DimVector idx(ndim);
+        int64_t rem = i_begin;
+        for (int64_t d = ndim - 1; d >= 0; d--) {
+          idx[d] = rem % sizes[d];
+          rem /= sizes[d];
+        }
+        for (int64_t i = i_begin; i < i_end; i++) {
+          if (data[i] != scalar_t(0)) {
+            for (int64_t d = 0; d < ndim; d++) {
+              out_ptr[d] = idx[d];
+            }
+            out_ptr += ndim;
+          }
+          for (int64_t d = ndim - 1; d >= 0; d--) {
+            if (++idx[d] < sizes[d]) {
+              break;
+            }
+            idx[d] = 0;
+          }
+        }
+      }
+    });
+  });
+  return result;
+}
+
+Tensor nonzero_cpu(const Tensor& self) {
+  Tensor result = at::empty({0, self.dim()}, self.options().dtype(kLong));
+  nonzero_out_cpu(result, self);
+  return result;
+}
+
+namespace {
+
+// True when masked_select can run the parallel two-pass compaction below
+// instead of going through TH.
+bool can_use_contiguous_masked_select(const Tensor& self, const Tensor& mask) {
+  return mask.scalar_type() == ScalarType::Bool &&
+      self.sizes().equals(mask.sizes()) &&
+      self.is_contiguous() && mask.is_contiguous();
+}
+
+// Parallel two-pass masked_select over contiguous same-shape inputs:
+// per-chunk mask counts give each chunk its output offset, then chunks
+// compact their survivors independently.
+template <typename scalar_t>
+void masked_select_contiguous_impl(
+    Tensor& result,
+    const Tensor& self,
+    const Tensor& mask) {
+  const int64_t n = self.numel();
+  const int64_t chunk_size = at::internal::GRAIN_SIZE;
+  const int64_t num_chunks = (n + chunk_size - 1) / chunk_size;
+  const bool* mask_data = mask.data_ptr<bool>();
+
+  std::vector<int64_t> offsets(num_chunks);
+  int64_t total = nonzero_chunk_offsets(
+      reinterpret_cast<const uint8_t*>(mask_data), n, chunk_size, offsets);
+
+  result.resize_({total});
+  if (total == 0) {
+    return;
+  }
+  const scalar_t* src = self.data_ptr<scalar_t>();
+  scalar_t* dst = result.data_ptr<scalar_t>();
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t chunk = begin; chunk < end; chunk++) {
+      const int64_t i_begin = chunk * chunk_size;
+      const int64_t i_end = std::min(n, i_begin + chunk_size);
+      scalar_t* out_ptr = dst + offsets[chunk];
+      for (int64_t i = i_begin; i < i_end; i++) {
+        if (mask_data[i]) {
+          *out_ptr++ = src[i];
+        }
+      }
+    }
+  });
+}
+
+} // anonymous namespace
+
+Tensor masked_select_cpu(const Tensor & self, const Tensor & mask) {
+  namedinference::compute_broadcast_outnames(self, mask);
+  if (can_use_contiguous_masked_select(self, mask)) {
+    Tensor result = at::empty({0}, self.options());
+    AT_DISPATCH_ALL_TYPES_AND3(kBool, kHalf, kBFloat16,
+        self.scalar_type(), "masked_select_cpu", [&] {
+      masked_select_contiguous_impl<scalar_t>(result, self, mask);
+    });
+    return result;
+  }
+  if (mask.dtype() == at::ScalarType::Byte) {
+    TORCH_WARN("masked_select received a mask with dtype torch.uint8, this behavior is now deprecated," \
+            "please use a mask with dtype torch.bool instead.");
+    return legacy::cpu::_th_masked_select(self, mask);
+  } else {
+    return legacy::cpu::_th_masked_select_bool(self, mask);
+  }
+}
+
+Tensor & masked_select_out_cpu(Tensor & result, const Tensor & self, const Tensor & mask) {
+  namedinference::compute_broadcast_outnames(self, mask);
+  if (can_use_contiguous_masked_select(self, mask) &&
+      result.scalar_type() == self.scalar_type() && result.is_contiguous()) {
+    AT_DISPATCH_ALL_TYPES_AND3(kBool, kHalf, kBFloat16,
+        self.scalar_type(), "masked_select_out_cpu", [&] {
+      masked_select_contiguous_impl<scalar_t>(result, self, mask);
+    });
+    return result;
+  }
+  if (mask.dtype() == at::ScalarType::Bool) {
+    return legacy::cpu::_th_masked_select_bool_out(result, self, mask);
+  } else {
+    return legacy::cpu::_th_masked_select_out(result, self, mask);
+  }
+}
+
 std::vector<Tensor> nonzero_numpy(const Tensor& self) {
   // special case scalar for compatibility with numpy:
   //
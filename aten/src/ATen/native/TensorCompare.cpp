@@ -12,6 +12,7 @@
 namespace at { namespace native {
 
 DEFINE_DISPATCH(where_kernel);
+DEFINE_DISPATCH(clamp_where_kernel);
 DEFINE_DISPATCH(max_kernel);
 DEFINE_DISPATCH(min_kernel);
 
@@ -137,6 +138,41 @@ Tensor _s_where(const Tensor& condition, const Tensor& self, const Tensor& other
   return ret;
 }
 
+// Fused clamp(where(condition, self, other), min, max) in a single pass.
+// Select-then-clamp is a common post-processing epilogue; run as two ops the
+// selected tensor makes a full round-trip through memory before the clamp
+// reads it back, while the fused kernel clamps each value while it is still
+// in registers.
+Tensor _clamp_where(
+    const Tensor& condition,
+    const Tensor& self,
+    const Tensor& other,
+    Scalar min,
+    Scalar max) {
+  TORCH_CHECK(condition.device() == self.device() && self.device() == other.device(),
+              "expected condition, x and y to be on the same device, but condition is on ",
+              condition.device(), " and x and y are on ", self.device(), " and ", other.device(),
+              " respectively");
+  if (condition.scalar_type() != ScalarType::Byte && condition.scalar_type() != ScalarType::Bool) {
+    AT_ERROR("Expected condition to have ScalarType Byte, but got ScalarType ",
+                  toString(condition.scalar_type()));
+  }
+  TORCH_CHECK(self.dtype() == other.dtype(), "expected scalar type ", self.dtype(), " but found ", other.dtype());
+  Tensor b_condition, b_self, b_other;
+  std::tie(b_condition, b_self, b_other) = expand_outplace(condition, self, other, "_clamp_where");
+  Tensor ret = at::empty(b_self.sizes(), b_self.options());
+  auto iter = at::TensorIterator();
+  iter.set_check_mem_overlap(true);
+  iter.add_output(ret);
+  iter.add_input(b_condition);
+  iter.add_input(b_self);
+  iter.add_input(b_other);
+  iter.dont_compute_common_dtype();
+  iter.build();
+  clamp_where_kernel(iter.device_type(), iter, b_condition.scalar_type(), min, max);
+  return ret;
+}
+
 std::tuple<Tensor, Tensor> mode(const Tensor& self, int64_t dim, bool keepdim) {
   Tensor values = at::empty({0}, self.options());
   Tensor indices = at::empty({0}, self.options().dtype(kLong));
@@ -138,6 +138,40 @@ Tensor empty_cpu(IntArrayRef size, const TensorOptions& options_, c10::optional<
   return tensor;
 }
 
+Tensor empty_cached(IntArrayRef size, const c10::CachedTensorOptions& cached) {
+  // Only dense CPU tensors with a pre-resolved allocator take the fast path;
+  // everything else (other devices, pinned or quantized storage, tensors that
+  // require grad) goes back through the dispatched factory.
+  if (cached.allocator() == nullptr || cached.options().requires_grad()) {
+    return at::empty(size, cached.options());
+  }
+  check_size_nonnegative(size);
+
+  auto* allocator = cached.allocator();
+  int64_t nelements = prod_intlist(size);
+  auto dtype = cached.dtype();
+  auto storage_impl = c10::make_intrusive<StorageImpl>(
+    dtype,
+    nelements,
+    allocator->allocate(nelements * dtype.itemsize()),
+    allocator,
+    /*resizeable=*/true);
+
+  auto tensor = detail::make_tensor<TensorImpl>(std::move(storage_impl), cached.dispatch_key());
+  // Default TensorImpl has size [0]
+  if (size.size() != 1 || size[0] != 0) {
+    tensor.unsafeGetTensorImpl()->set_sizes_contiguous(size);
+  }
+
+  // set_sizes_contiguous already produced contiguous strides; only restride
+  // for the non-default memory formats.
+  if (cached.memory_format() != MemoryFormat::Contiguous) {
+    tensor.unsafeGetTensorImpl()->empty_tensor_restride(cached.memory_format());
+  }
+
+  return tensor;
+}
+
 Tensor empty(
     IntArrayRef size,
     at::optional<DimnameList> names,
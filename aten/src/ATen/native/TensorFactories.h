@@ -3,6 +3,16 @@
 #include <c10/core/TensorOptions.h>
 
 namespace at { namespace native {
+
+// Allocates an uninitialized tensor like at::empty, but takes a
+// c10::CachedTensorOptions whose dispatch key, dtype meta and allocator have
+// been resolved ahead of time, so the per-call option decoding is skipped.
+// Dense CPU tensors are constructed directly; any other configuration falls
+// back to the dispatched at::empty.
+CAFFE2_API Tensor empty_cached(
+    IntArrayRef size,
+    const c10::CachedTensorOptions& cached);
+
 // Different combinations of row, col, and offset can lead to two cases:
 //
 // Case 1 - Trapezoid (Triangle as a special case): row + offset <= col
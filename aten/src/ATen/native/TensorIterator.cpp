@@ -1,12 +1,236 @@
 #include <ATen/native/TensorIterator.h>
 
 #include <array>
+#include <atomic>
+#include <unordered_map>
 #include <ATen/ExpandUtils.h>
 #include <ATen/Parallel.h>
 #include <ATen/native/TypeProperties.h>
 
 namespace at {
 
+// See Note [Arithmetic intensity counters] in TensorIterator.h
+namespace {
+std::atomic<bool> op_intensity_tracking{false};
+thread_local OpIntensityCounters thread_intensity_counters;
+} // namespace
+
+void set_op_intensity_tracking_enabled(bool enabled) {
+  op_intensity_tracking.store(enabled, std::memory_order_relaxed);
+}
+
+bool op_intensity_tracking_enabled() {
+  return op_intensity_tracking.load(std::memory_order_relaxed);
+}
+
+OpIntensityCounters thread_op_intensity_counters() {
+  return thread_intensity_counters;
+}
+
+namespace {
+
+// Memoization of the output of build(): elementwise ops in inference
+// workloads tend to see the same handful of (shape, stride, dtype, device)
+// combinations over and over, and the shape/type propagation, dimension
+// reordering and coalescing in build() dominate small-op latency. The cache
+// stores the finished iteration plan keyed on operand metadata so repeat
+// calls can skip straight to setting data pointers.
+//
+// The cache is thread-local to avoid a global lock on the elementwise hot
+// path. Entries are only recorded for builds that did not mutate any operand
+// (no output resize, no cast-by-copy, no allocation), which makes replaying
+// a plan equivalent to re-running build().
+
+struct IterationPlan {
+  DimVector shape;
+  SmallVector<TensorIterator::StrideVector, 4> stride_bytes;
+  ScalarType common_dtype;
+  bool has_coalesced_dimensions;
+  bool all_ops_same_shape;
+  // bookkeeping for the operand prepack stage; see the note below
+  int64_t hits = 0;
+  uint32_t prepack_mask = 0;
+};
+
+using PlanKey = SmallVector<int64_t, 32>;
+
+struct PlanKeyHash {
+  size_t operator()(const PlanKey& key) const {
+    // FNV-1a over the packed metadata words
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (int64_t value : key) {
+      hash = (hash ^ static_cast<uint64_t>(value)) * 0x100000001b3ULL;
+    }
+    return static_cast<size_t>(hash);
+  }
+};
+
+struct PlanKeyEqual {
+  bool operator()(const PlanKey& a, const PlanKey& b) const {
+    return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+  }
+};
+
+using PlanCache = std::unordered_map<PlanKey, IterationPlan, PlanKeyHash, PlanKeyEqual>;
+
+// Bounded so that shape-polymorphic workloads cannot grow the cache without
+// limit; when full the cache is simply dropped and rebuilt.
+constexpr size_t kPlanCacheMaxSize = 512;
+
+PlanCache& plan_cache() {
+  static thread_local PlanCache cache;
+  return cache;
+}
+
+bool is_plan_cacheable(at::ArrayRef<OperandInfo> operands, bool is_reduction) {
+  if (is_reduction) {
+    return false;
+  }
+  for (auto& op : operands) {
+    if (!op.tensor.defined() || op.tensor.has_names()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+PlanKey compute_plan_key(
+    at::ArrayRef<OperandInfo> operands,
+    int num_outputs,
+    CommonDTypeStrategy strategy,
+    bool resize_outputs) {
+  PlanKey key;
+  key.push_back(num_outputs);
+  key.push_back(static_cast<int64_t>(strategy));
+  key.push_back(resize_outputs);
+  for (auto& op : operands) {
+    auto sizes = op.tensor.sizes();
+    auto strides = op.tensor.strides();
+    key.push_back(sizes.size());
+    key.insert(key.end(), sizes.begin(), sizes.end());
+    key.insert(key.end(), strides.begin(), strides.end());
+    key.push_back(static_cast<int64_t>(op.tensor.scalar_type()));
+    key.push_back(static_cast<int64_t>(op.tensor.device().type()));
+    key.push_back(op.tensor.device().index());
+  }
+  return key;
+}
+
+// Operand prepack: when a cached plan keeps being replayed with an input
+// whose innermost stride defeats the vectorized inner loop (e.g. the same
+// transposed weight view used on every step), it is cheaper to materialize
+// the input contiguously once and iterate over the copy. The copy is cached
+// keyed on the source TensorImpl and is invalidated when the source tensor
+// is written to (version counter bump), changes geometry, or is freed (the
+// weak reference no longer locks).
+
+constexpr int64_t kPrepackHitThreshold = 3;
+constexpr int64_t kPrepackMinNumel = 1024;
+// Entries hold whole tensors, so keep this far smaller than the plan cache.
+constexpr size_t kPrepackCacheMaxSize = 64;
+
+struct PrepackEntry {
+  c10::weak_intrusive_ptr<TensorImpl, UndefinedTensorImpl> source;
+  uint32_t version;
+  DimVector src_sizes;
+  DimVector src_strides;
+  Tensor contiguous;
+};
+
+using PrepackCache = std::unordered_map<const TensorImpl*, PrepackEntry>;
+
+PrepackCache& prepack_cache() {
+  static thread_local PrepackCache cache;
+  return cache;
+}
+
+Tensor prepacked_contiguous(const Tensor& input) {
+  auto& cache = prepack_cache();
+  auto* impl = input.unsafeGetTensorImpl();
+  const auto version = impl->version_counter().current_version();
+  auto it = cache.find(impl);
+  if (it != cache.end()) {
+    auto& entry = it->second;
+    if (entry.source.lock().get() == impl && entry.version == version &&
+        input.sizes().equals(entry.src_sizes) &&
+        input.strides().equals(entry.src_strides) &&
+        input.scalar_type() == entry.contiguous.scalar_type()) {
+      return entry.contiguous;
+    }
+    cache.erase(it);
+  }
+  if (cache.size() >= kPrepackCacheMaxSize) {
+    cache.clear();
+  }
+  Tensor contiguous = input.contiguous();
+  PrepackEntry entry{
+      c10::weak_intrusive_ptr<TensorImpl, UndefinedTensorImpl>(input.getIntrusivePtr()),
+      version,
+      DimVector(input.sizes().begin(), input.sizes().end()),
+      DimVector(input.strides().begin(), input.strides().end()),
+      contiguous};
+  cache.emplace(impl, std::move(entry));
+  return contiguous;
+}
+
+// Guards against recursing through the copy issued by contiguous(), which
+// itself builds a TensorIterator over the hostile input.
+thread_local bool in_prepack = false;
+
+bool maybe_prepack_inputs(
+    SmallVector<OperandInfo, 4>& operands,
+    uint32_t prepack_mask) {
+  if (in_prepack) {
+    return false;
+  }
+  in_prepack = true;
+  for (size_t i = 0; i < operands.size(); i++) {
+    if (prepack_mask & (1u << i)) {
+      operands[i].tensor = prepacked_contiguous(operands[i].tensor);
+    }
+  }
+  in_prepack = false;
+  return true;
+}
+
+// Picks the inputs worth prepacking for a finished plan: read-only inputs
+// whose innermost stride is not the element size (so the inner loop can't
+// vectorize), large enough to amortize the copy, and not sharing storage
+// with an output (writes through the output would not bump the input's
+// version counter).
+uint32_t compute_prepack_mask(
+    at::ArrayRef<OperandInfo> operands,
+    int num_outputs) {
+  uint32_t mask = 0;
+  for (size_t i = num_outputs; i < operands.size(); i++) {
+    auto& op = operands[i];
+    const auto& tensor = op.tensor;
+    if (op.is_output || tensor.is_contiguous() ||
+        tensor.layout() != kStrided || tensor.numel() < kPrepackMinNumel) {
+      continue;
+    }
+    if (op.stride_bytes.empty() || op.stride_bytes[0] == 0 ||
+        op.stride_bytes[0] == static_cast<int64_t>(tensor.element_size())) {
+      continue;
+    }
+    bool aliases_output = false;
+    for (int j = 0; j < num_outputs; j++) {
+      if (operands[j].tensor.defined() &&
+          operands[j].tensor.storage().unsafeGetStorageImpl() ==
+              tensor.storage().unsafeGetStorageImpl()) {
+        aliases_output = true;
+        break;
+      }
+    }
+    if (!aliases_output) {
+      mask |= (1u << i);
+    }
+  }
+  return mask;
+}
+
+}  // namespace
+
 using DimMask = TensorIterator::DimMask;
 using PtrVector = TensorIterator::PtrVector;
 using loop_t = TensorIterator::loop_t;
@@ -18,7 +242,7 @@ void TensorIterator::reorder_dimensions() {
   // at the front. NOTE: that this inverts the order of C-contiguous tensors.
   // strides[0] is the fastest moving dimension instead of strides[ndim - 1].
 
-  perm_.resize(ndim());
+  perm_.resize_for_overwrite(ndim());
   if (ndim() == 1) {
     perm_[0] = 0;
     return;
@@ -791,7 +1015,7 @@ void TensorIterator::compute_shape() {
       shape_ = shape;
     } else if (!shape.equals(shape_)) {
       all_ops_same_shape_ = false;
-      shape_ = DimVector(infer_size(shape_, shape));
+      shape_ = infer_size_cached(shape_, shape);
     }
   }
   // Outputs cannot be broadcasted. Check that the shape of the outputs matches
@@ -831,7 +1055,7 @@ void TensorIterator::compute_strides() {
       if (offset > 0)
           op.stride_bytes.resize(ndim(), 0);
       else
-          op.stride_bytes.resize(ndim());
+          op.stride_bytes.resize_for_overwrite(ndim());
       for (size_t i = 0; i < original_shape.size(); i++) {
         if (original_shape[i] == 1) {
           op.stride_bytes[offset + i] = 0;
@@ -1040,7 +1264,70 @@ FastSetupType TensorIterator::compute_fast_setup_type() {
   return FastSetupType::NONE;
 }
 
+void TensorIterator::accumulate_intensity_counters() {
+  if (!op_intensity_tracking_enabled()) {
+    return;
+  }
+  auto& counters = thread_intensity_counters;
+  for (auto& op : operands_) {
+    const uint64_t bytes =
+        static_cast<uint64_t>(op.tensor.numel()) * op.tensor.element_size();
+    if (op.is_output) {
+      counters.bytes_written += bytes;
+      if (op.is_read_write) {
+        counters.bytes_read += bytes;
+      }
+    } else {
+      counters.bytes_read += bytes;
+    }
+  }
+  counters.flops += static_cast<uint64_t>(numel()) * ninputs();
+}
+
 void TensorIterator::build() {
+  // try to replay a previously computed iteration plan for these operand
+  // shapes/strides/dtypes; see the note on the plan cache at the top of this
+  // file
+  bool cacheable = is_plan_cacheable(operands_, is_reduction_);
+  PlanKey plan_key;
+  if (cacheable) {
+    plan_key = compute_plan_key(
+        operands_, num_outputs_, common_dtype_strategy_, resize_outputs_);
+    auto& cache = plan_cache();
+    auto it = cache.find(plan_key);
+    if (it != cache.end()) {
+      auto& plan = it->second;
+      plan.hits++;
+      // a plan that keeps being replayed with vectorization-hostile inputs
+      // is worth a one-time contiguous materialization of those inputs; the
+      // substituted operands then replay (or record) their own plan
+      if (plan.prepack_mask != 0 && plan.hits >= kPrepackHitThreshold &&
+          maybe_prepack_inputs(operands_, plan.prepack_mask)) {
+        plan_key = compute_plan_key(
+            operands_, num_outputs_, common_dtype_strategy_, resize_outputs_);
+        it = cache.find(plan_key);
+      }
+      if (it != cache.end()) {
+        const auto& hit = it->second;
+        // flags and overlap checks depend on tensor identity / data pointers,
+        // not just metadata, so they are re-run on a hit
+        mark_outputs();
+        check_mem_overlaps();
+        shape_ = hit.shape;
+        for (int i = 0; i < ntensors(); i++) {
+          operands_[i].stride_bytes = hit.stride_bytes[i];
+          operands_[i].data = operands_[i].tensor.data_ptr();
+        }
+        common_dtype_ = hit.common_dtype;
+        has_coalesced_dimensions_ = hit.has_coalesced_dimensions;
+        all_ops_same_shape_ = hit.all_ops_same_shape;
+        view_offsets_ = DimVector(ndim(), 0);
+        accumulate_intensity_counters();
+        return;
+      }
+    }
+  }
+
   // check input tensors memory format to use it during output allocation
   analyze_memory_format();
   // set is_output and is_read_write flags on appropriate tensors
@@ -1075,6 +1362,32 @@ void TensorIterator::build() {
 
   // zero out offsets
   view_offsets_ = DimVector(ndim(), 0);
+
+  accumulate_intensity_counters();
+
+  // Record the finished plan, but only if build() left every operand's
+  // metadata untouched (no resize, cast-by-copy or allocation); otherwise
+  // replaying the plan would skip those side effects.
+  if (cacheable && names_.empty()) {
+    auto post_key = compute_plan_key(
+        operands_, num_outputs_, common_dtype_strategy_, resize_outputs_);
+    if (PlanKeyEqual()(plan_key, post_key)) {
+      auto& cache = plan_cache();
+      if (cache.size() >= kPlanCacheMaxSize) {
+        cache.clear();
+      }
+      IterationPlan plan;
+      plan.shape = shape_;
+      for (auto& op : operands_) {
+        plan.stride_bytes.push_back(op.stride_bytes);
+      }
+      plan.common_dtype = common_dtype_;
+      plan.has_coalesced_dimensions = has_coalesced_dimensions_;
+      plan.all_ops_same_shape = all_ops_same_shape_;
+      plan.prepack_mask = compute_prepack_mask(operands_, num_outputs_);
+      cache.emplace(std::move(plan_key), std::move(plan));
+    }
+  }
 }
 
 SplitUntil32Bit TensorIterator::with_32bit_indexing() const {
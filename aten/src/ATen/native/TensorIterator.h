@@ -57,6 +57,31 @@
 
 namespace at {
 
+// Note [Arithmetic intensity counters]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// When enabled, every TensorIterator build adds the operation's planned
+// memory traffic and an arity-based FLOP estimate to per-thread,
+// monotonically increasing counters. Observers (e.g. the autograd profiler)
+// snapshot the counters around an op and attribute the delta to it, which is
+// enough to place the op on a roofline without knowing its kernel.
+//
+// bytes_read / bytes_written count each operand's storage once, so broadcast
+// re-reads that stay in cache are not overcounted. flops is estimated as one
+// operation per input element visited (loop extent times number of inputs);
+// it is a heuristic for bandwidth- vs compute-bound classification, not an
+// exact count. Tracking is off by default and costs a single relaxed atomic
+// load per build when disabled.
+struct OpIntensityCounters {
+  uint64_t bytes_read = 0;
+  uint64_t bytes_written = 0;
+  uint64_t flops = 0;
+};
+
+CAFFE2_API void set_op_intensity_tracking_enabled(bool enabled);
+CAFFE2_API bool op_intensity_tracking_enabled();
+/// Returns the calling thread's current counter totals.
+CAFFE2_API OpIntensityCounters thread_op_intensity_counters();
+
 struct DimCounter {
   DimCounter(IntArrayRef shape, Range range);
 
@@ -375,6 +400,8 @@ protected:
   void propagate_names_to_outputs();
   void coalesce_dimensions();
   void analyze_memory_format();
+  // See Note [Arithmetic intensity counters]
+  void accumulate_intensity_counters();
 
 protected:
   DimVector shape_;
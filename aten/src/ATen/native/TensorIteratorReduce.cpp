@@ -1,4 +1,5 @@
 #include <ATen/native/TensorIterator.h>
+#include <ATen/Context.h>
 #include <ATen/Parallel.h>
 #include <algorithm>
 #include <memory>
@@ -11,6 +12,9 @@ using loop2d_t = TensorIterator::loop2d_t;
 
 static bool use_two_pass_reduction(TensorIterator& iter);
 static void two_pass_reduction(TensorIterator& iter, loop2d_t loop);
+static void deterministic_two_pass_reduction(TensorIterator& iter, loop2d_t loop);
+static bool use_chunked_dim_reduction(TensorIterator& iter);
+static void chunked_dim_reduction(TensorIterator& iter, loop2d_t loop);
 static void parallel_dim_reduction(TensorIterator& iter, loop2d_t loop);
 
 void TensorIterator::parallel_reduce(loop2d_t loop) {
@@ -20,7 +24,18 @@ void TensorIterator::parallel_reduce(loop2d_t loop) {
       at::in_parallel_region()) {
     serial_for_each(loop, {0, numel});
   } else if (use_two_pass_reduction(*this)) {
-    two_pass_reduction(*this, loop);
+    if (at::globalContext().deterministicCPUReduction()) {
+      deterministic_two_pass_reduction(*this, loop);
+    } else {
+      two_pass_reduction(*this, loop);
+    }
+  } else if (use_chunked_dim_reduction(*this) &&
+             !at::globalContext().deterministicCPUReduction()) {
+    // chunked_dim_reduction assigns slices of the reduced dimension to
+    // threads, so its combination order depends on the thread count;
+    // parallel_dim_reduction sweeps each output element serially and is
+    // deterministic by construction.
+    chunked_dim_reduction(*this, loop);
   } else {
     parallel_dim_reduction(*this, loop);
   }
@@ -30,13 +45,30 @@ static bool use_two_pass_reduction(TensorIterator& iter) {
   return iter.output(0).numel() == 1;
 }
 
+// Target working-set size for one block of the reduced dimension. Roughly a
+// per-core L2 cache, so each block of input is streamed through while the
+// accumulator slice stays resident.
+constexpr int64_t kReductionBlockBytes = 256 * 1024;
+
+// Per-thread accumulator workspace (`max_threads` copies of the output) used
+// by the two-pass strategies. Cached per calling thread so that repeated
+// reductions of the same shape do not reallocate it on every call.
+static Tensor& reduction_workspace(int max_threads, const Tensor& dst) {
+  static thread_local Tensor workspace;
+  auto shape = DimVector(dst.sizes());
+  shape.insert(shape.begin(), max_threads);
+  if (!workspace.defined() || workspace.scalar_type() != dst.scalar_type() ||
+      workspace.device() != dst.device() || !workspace.sizes().equals(shape)) {
+    workspace = at::empty(shape, dst.options());
+  }
+  return workspace;
+}
+
 static void two_pass_reduction(TensorIterator& iter, loop2d_t loop) {
   int max_threads = at::get_num_threads();
 
   auto dst = iter.output(0);
-  auto buffer_shape = DimVector(dst.sizes());
-  buffer_shape.insert(buffer_shape.begin(), max_threads);
-  auto buffer = at::empty(buffer_shape, dst.options());
+  auto buffer = reduction_workspace(max_threads, dst);
 
   std::unique_ptr<bool[]> written(new bool[max_threads]);
   std::fill(written.get(), written.get() + max_threads, false);
@@ -63,6 +95,124 @@ static void two_pass_reduction(TensorIterator& iter, loop2d_t loop) {
   final_reduce.for_each(loop);
 }
 
+// See NOTE [ Deterministic parallel reduction ] in cpu/Reduce.h. Every chunk
+// of GRAIN_SIZE input elements is accumulated from the identity into its own
+// workspace slice regardless of which thread runs it, and the slices are
+// combined serially in chunk order, so the floating point result is a
+// function of numel alone.
+static void deterministic_two_pass_reduction(TensorIterator& iter, loop2d_t loop) {
+  int64_t numel = iter.numel();
+  int64_t num_chunks = divup(numel, internal::GRAIN_SIZE);
+
+  auto dst = iter.output(0);
+  auto shape = DimVector(dst.sizes());
+  shape.insert(shape.begin(), num_chunks);
+  auto buffer = at::empty(shape, dst.options());
+
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      auto slice = buffer[i];
+      slice.copy_(dst);
+
+      auto sub_iter = TensorIterator::reduce_op(slice, iter.input(0));
+      sub_iter.serial_for_each(
+          loop,
+          {i * internal::GRAIN_SIZE,
+           std::min((i + 1) * internal::GRAIN_SIZE, numel)});
+    }
+  });
+
+  auto unsqueezed = dst.unsqueeze(0);
+  auto final_reduce = TensorIterator::reduce_op(unsqueezed, buffer);
+  final_reduce.serial_for_each(loop, {0, final_reduce.numel()});
+}
+
+/// Picks the reduced dimension with the largest extent, or -1 if there is
+/// no reduced dimension.
+static int find_largest_reduced_dim(TensorIterator& iter) {
+  auto shape = iter.shape();
+  int best_dim = -1;
+  for (int dim = 0; dim < iter.ndim(); dim++) {
+    if (iter.is_dim_reduced(dim) &&
+        (best_dim < 0 || shape[dim] > shape[best_dim])) {
+      best_dim = dim;
+    }
+  }
+  return best_dim;
+}
+
+// For long-and-skinny reductions (e.g. summing a [8, 10M] tensor over dim 1)
+// splitting only a non-reduced dimension leaves most cores idle. In that case
+// split the largest reduced dimension across threads instead, with each
+// thread accumulating into its own copy of the output, and combine the
+// per-thread partials in a second pass, like two_pass_reduction.
+static bool use_chunked_dim_reduction(TensorIterator& iter) {
+  int num_threads = at::get_num_threads();
+  auto shape = iter.shape();
+
+  // If a non-reduced dimension is big enough to occupy every thread,
+  // parallel_dim_reduction handles it without extra workspace traffic.
+  for (int dim = iter.ndim() - 1; dim >= 0 && !iter.is_dim_reduced(dim); dim--) {
+    if (shape[dim] >= num_threads) {
+      return false;
+    }
+  }
+
+  // The per-thread accumulators substitute for the output by swapping data
+  // pointers, so the output must share the workspace's (contiguous) layout.
+  if (!iter.output(0).is_contiguous()) {
+    return false;
+  }
+
+  int dim = find_largest_reduced_dim(iter);
+  return dim >= 0 && shape[dim] >= 2 * num_threads;
+}
+
+static void chunked_dim_reduction(TensorIterator& iter, loop2d_t loop) {
+  int max_threads = at::get_num_threads();
+
+  auto dst = iter.output(0);
+  auto buffer = reduction_workspace(max_threads, dst);
+
+  std::unique_ptr<bool[]> written(new bool[max_threads]);
+  std::fill(written.get(), written.get() + max_threads, false);
+
+  int dim = find_largest_reduced_dim(iter);
+  int64_t cols = iter.shape()[dim];
+  // Block the reduced dimension so that one block of input fits in L2.
+  int64_t bytes_per_col =
+      std::max<int64_t>(1, iter.numel() / cols * iter.element_size(1));
+  int64_t block_size =
+      std::max<int64_t>(1, kReductionBlockBytes / bytes_per_col);
+
+  at::parallel_for(0, cols, 1, [&](int64_t begin, int64_t end) {
+    int thread_num = at::get_thread_num();
+    auto slice = buffer[thread_num];
+    if (!written[thread_num]) {
+      written[thread_num] = true;
+      slice.copy_(dst);
+    }
+    for (int64_t block = begin; block < end; block += block_size) {
+      int64_t size = std::min(block_size, end - block);
+      auto sub_iter = TensorIterator(iter);
+      sub_iter.unsafe_replace_operand(0, slice.data_ptr());
+      sub_iter.narrow(dim, block, size);
+      sub_iter.serial_for_each(loop, {0, sub_iter.numel()});
+    }
+  });
+
+  // fill any unwritten slices of the buffer with the identity
+  for (int thread_num = 0; thread_num < max_threads; thread_num++) {
+    if (!written[thread_num]) {
+      buffer[thread_num].copy_(dst);
+    }
+  }
+
+  auto unsqueezed = dst.unsqueeze(0);
+  auto final_reduce = TensorIterator::reduce_op(unsqueezed, buffer);
+  final_reduce.for_each(loop);
+}
+
 /// Chooses a dimension over which to parallelize. Prefers the outer-most
 /// dimension thats larger than the number of available threads.
 static int find_split_dim(TensorIterator& iter) {
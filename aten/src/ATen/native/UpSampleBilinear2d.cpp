@@ -188,6 +188,21 @@ static void upsample_bilinear2d_out_cpu_template(
       output_height,
       output_width);
 
+  // Channels-last inputs take the vectorized kernel, which interpolates the C
+  // contiguous channels of each output pixel at once; see
+  // cpu/UpSampleKernel.cpp.
+  if (input_.is_contiguous(at::MemoryFormat::ChannelsLast)) {
+    output.resize_(
+        {nbatch, channels, output_height, output_width},
+        at::MemoryFormat::ChannelsLast);
+    AT_ASSERT(
+        input_height > 0 && input_width > 0 && output_height > 0 &&
+        output_width > 0);
+    upsample_bilinear2d_kernel(
+        kCPU, output, input_, align_corners, scales_h, scales_w);
+    return;
+  }
+
   auto input = input_.contiguous();
 
   output.resize_({nbatch, channels, output_height, output_width});
@@ -10,7 +10,12 @@ namespace native {
 using batch_norm_fn = void (*)(Tensor&, const Tensor&, const Tensor&,
     const Tensor&, const Tensor&, const Tensor&, double);
 
+// Computes the per-channel mean and the sum of squared deviations from it
+// (not yet divided by the element count) in a single pass over the input.
+using batch_norm_collect_stats_fn = void (*)(Tensor&, Tensor&, const Tensor&);
+
 DECLARE_DISPATCH(batch_norm_fn, batch_norm_cpu_inference_contiguous_stub);
+DECLARE_DISPATCH(batch_norm_collect_stats_fn, batch_norm_cpu_collect_stats_contiguous_stub);
 
 } // namespace native
 
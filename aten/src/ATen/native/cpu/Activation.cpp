@@ -8,6 +8,7 @@
 
 #include <ATen/ATen.h>
 #include <ATen/Config.h>
+#include <ATen/cpu/vec256/functional.h>
 #include <ATen/cpu/vec256/vec256.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
@@ -492,6 +493,169 @@ void softplus_backward_kernel(TensorIterator& iter, Scalar beta_, Scalar thresho
   });
 }
 
+// Applies prelu over one contiguous block with a single weight scalar, so
+// the weight is broadcast into a vector once per channel block.
+template <typename scalar_t>
+inline void _vec_prelu_block(
+    scalar_t* out,
+    const scalar_t* in,
+    int64_t size,
+    scalar_t weight_val) {
+  using Vec = Vec256<scalar_t>;
+  const Vec weight_vec(weight_val);
+  const Vec zero_vec(scalar_t(0));
+  int64_t d = 0;
+  for (; d < size - (size % Vec::size()); d += Vec::size()) {
+    Vec in_vec = Vec::loadu(in + d);
+    Vec::blendv(in_vec * weight_vec, in_vec, in_vec > zero_vec).store(out + d);
+  }
+  if (size - d > 0) {
+    Vec in_vec = Vec::loadu(in + d, size - d);
+    Vec::blendv(in_vec * weight_vec, in_vec, in_vec > zero_vec)
+        .store(out + d, size - d);
+  }
+}
+
+void prelu_cpu_kernel(Tensor& result, const Tensor& input, const Tensor& weight) {
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "prelu_cpu", [&] {
+    scalar_t* result_data = result.data_ptr<scalar_t>();
+    const scalar_t* input_data = input.data_ptr<scalar_t>();
+    const scalar_t* weight_data = weight.data_ptr<scalar_t>();
+    if (weight.numel() == 1) {
+      scalar_t weight_val = weight_data[0];
+      parallel_for(0, input.numel(), 1000, [&](int64_t begin, int64_t end) {
+        _vec_prelu_block(
+            result_data + begin, input_data + begin, end - begin, weight_val);
+      });
+    } else {
+      // one weight per channel: input is contiguous [dim0][channel][inner]
+      int64_t input_dim0_size = input.size(0);
+      int64_t channel_size = input.size(1);
+      int64_t inner_size = input.strides()[1];
+      auto loop = [&](int64_t start, int64_t end) {
+        for (auto i = start; i < end; i++) {
+          for (auto j = 0; j < channel_size; j++) {
+            int64_t offset = (i * channel_size + j) * inner_size;
+            _vec_prelu_block(
+                result_data + offset,
+                input_data + offset,
+                inner_size,
+                weight_data[j]);
+          }
+        }
+      };
+      if (input.numel() > 1000) {
+        parallel_for(0, input_dim0_size, 0, loop);
+      } else {
+        loop(0, input_dim0_size);
+      }
+    }
+  });
+}
+
+template <typename scalar_t>
+inline void _vec_prelu_backward_block(
+    scalar_t* input_grad,
+    scalar_t* weight_grad_collector,
+    const scalar_t* in,
+    const scalar_t* grad_out,
+    int64_t size,
+    scalar_t weight_val) {
+  using Vec = Vec256<scalar_t>;
+  const Vec weight_vec(weight_val);
+  const Vec zero_vec(scalar_t(0));
+  int64_t d = 0;
+  for (; d < size - (size % Vec::size()); d += Vec::size()) {
+    Vec in_vec = Vec::loadu(in + d);
+    Vec grad_vec = Vec::loadu(grad_out + d);
+    Vec mask = in_vec > zero_vec;
+    Vec::blendv(grad_vec * weight_vec, grad_vec, mask).store(input_grad + d);
+    Vec::blendv(in_vec * grad_vec, zero_vec, mask)
+        .store(weight_grad_collector + d);
+  }
+  if (size - d > 0) {
+    Vec in_vec = Vec::loadu(in + d, size - d);
+    Vec grad_vec = Vec::loadu(grad_out + d, size - d);
+    Vec mask = in_vec > zero_vec;
+    Vec::blendv(grad_vec * weight_vec, grad_vec, mask)
+        .store(input_grad + d, size - d);
+    Vec::blendv(in_vec * grad_vec, zero_vec, mask)
+        .store(weight_grad_collector + d, size - d);
+  }
+}
+
+void prelu_backward_cpu_kernel(
+    const Tensor& input,
+    const Tensor& weight,
+    const Tensor& grad_out,
+    Tensor& input_grad,
+    Tensor& weight_grad,
+    Tensor& weight_grad_collector) {
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "prelu_backward_cpu", [&] {
+    using Vec = Vec256<scalar_t>;
+    const scalar_t* input_data = input.data_ptr<scalar_t>();
+    const scalar_t* weight_data = weight.data_ptr<scalar_t>();
+    const scalar_t* grad_out_data = grad_out.data_ptr<scalar_t>();
+    scalar_t* input_grad_data = input_grad.data_ptr<scalar_t>();
+    if (weight.numel() == 1) {
+      scalar_t weight_val = weight_data[0];
+      const Vec weight_vec(weight_val);
+      const Vec zero_vec(scalar_t(0));
+      scalar_t sum = at::parallel_reduce(0, input.numel(), 1000, scalar_t(0),
+          [&](int64_t begin, int64_t end, scalar_t ident) -> scalar_t {
+        // lanes of a partial vector load are zero-filled, so they contribute
+        // nothing to the weight-grad sum
+        Vec sum_vec(scalar_t(0));
+        int64_t size = end - begin;
+        int64_t d = 0;
+        for (; d < size - (size % Vec::size()); d += Vec::size()) {
+          Vec in_vec = Vec::loadu(input_data + begin + d);
+          Vec grad_vec = Vec::loadu(grad_out_data + begin + d);
+          Vec mask = in_vec > zero_vec;
+          Vec::blendv(grad_vec * weight_vec, grad_vec, mask)
+              .store(input_grad_data + begin + d);
+          sum_vec = sum_vec + Vec::blendv(in_vec * grad_vec, zero_vec, mask);
+        }
+        if (size - d > 0) {
+          Vec in_vec = Vec::loadu(input_data + begin + d, size - d);
+          Vec grad_vec = Vec::loadu(grad_out_data + begin + d, size - d);
+          Vec mask = in_vec > zero_vec;
+          Vec::blendv(grad_vec * weight_vec, grad_vec, mask)
+              .store(input_grad_data + begin + d, size - d);
+          sum_vec = sum_vec + Vec::blendv(in_vec * grad_vec, zero_vec, mask);
+        }
+        return ident + vec256::vec_reduce_all<scalar_t>(
+            [](Vec& x, Vec& y) { return x + y; }, sum_vec, Vec::size());
+      }, std::plus<scalar_t>());
+      weight_grad.data_ptr<scalar_t>()[0] = sum;
+    } else {
+      scalar_t* collector_data = weight_grad_collector.data_ptr<scalar_t>();
+      int64_t input_dim0_size = input.size(0);
+      int64_t channel_size = input.size(1);
+      int64_t inner_size = input.strides()[1];
+      auto loop = [&](int64_t start, int64_t end) {
+        for (auto i = start; i < end; i++) {
+          for (auto j = 0; j < channel_size; j++) {
+            int64_t offset = (i * channel_size + j) * inner_size;
+            _vec_prelu_backward_block(
+                input_grad_data + offset,
+                collector_data + offset,
+                input_data + offset,
+                grad_out_data + offset,
+                inner_size,
+                weight_data[j]);
+          }
+        }
+      };
+      if (input.numel() > 1000) {
+        parallel_for(0, input_dim0_size, 0, loop);
+      } else {
+        loop(0, input_dim0_size);
+      }
+    }
+  });
+}
+
 void glu_kernel(TensorIterator& iter) {
   AT_DISPATCH_FLOATING_TYPES(iter.dtype(), "glu_cpu", [&] {
     using Vec = Vec256<scalar_t>;
@@ -547,6 +711,8 @@ REGISTER_DISPATCH(softplus_stub, &softplus_kernel);
 REGISTER_DISPATCH(softplus_backward_stub, &softplus_backward_kernel);
 REGISTER_DISPATCH(glu_stub, &glu_kernel);
 REGISTER_DISPATCH(glu_backward_stub, &glu_backward_kernel);
+REGISTER_DISPATCH(prelu_cpu_stub, &prelu_cpu_kernel);
+REGISTER_DISPATCH(prelu_backward_cpu_stub, &prelu_backward_cpu_kernel);
 
 } // namespace native
 } // namespace at
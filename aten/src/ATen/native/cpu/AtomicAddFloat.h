@@ -30,4 +30,25 @@ static inline void cpu_atomic_add_float(float* dst, float fvalue)
   }
 }
 
+static inline void cpu_atomic_add_double(double* dst, double dvalue)
+{
+  typedef union {
+    unsigned long long intV;
+    double doubleV;
+  } uf64_t;
+
+  uf64_t new_value, old_value;
+  std::atomic<unsigned long long>* dst_intV = (std::atomic<unsigned long long>*)(dst);
+
+  old_value.doubleV = *dst;
+  new_value.doubleV = old_value.doubleV + dvalue;
+
+  unsigned long long* old_intV = (unsigned long long*)(&old_value.intV);
+  while (!std::atomic_compare_exchange_strong(dst_intV, old_intV, new_value.intV)) {
+    _mm_pause();
+    old_value.doubleV = *dst;
+    new_value.doubleV = old_value.doubleV + dvalue;
+  }
+}
+
 #endif
@@ -1,6 +1,7 @@
 #include <ATen/ATen.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <ATen/cpu/vec256/functional.h>
 #include <ATen/cpu/vec256/vec256.h>
@@ -12,14 +13,17 @@ namespace {
 struct InputMeta {
   void* data_ptr;
   int64_t inner_size;
+  // Element offset of this input's slice within one outer row of the result.
+  int64_t offset;
 
-  InputMeta(const Tensor& t, int64_t dim, int64_t inner)
+  InputMeta(const Tensor& t, int64_t dim, int64_t inner, int64_t offset)
     : data_ptr(t.data_ptr())
-    , inner_size(t.size(dim) * inner) {}
+    , inner_size(t.size(dim) * inner)
+    , offset(offset) {}
 };
 
 template <typename scalar_t>
-void cat_serial_kernel_impl(Tensor& result, TensorList tensors, int64_t dim) {
+void cat_contig_kernel_impl(Tensor& result, TensorList tensors, int64_t dim) {
   auto size = result.sizes().vec();
   int64_t outer = 1, inner = 1;
   for (int64_t i = 0; i < dim; i++) {
@@ -32,15 +36,29 @@ void cat_serial_kernel_impl(Tensor& result, TensorList tensors, int64_t dim) {
   int64_t ninputs = tensors.size();
   std::vector<InputMeta> inputs;
   inputs.reserve(ninputs);
+  int64_t total_inner = 0;
   for (auto const &tensor : tensors) {
-    inputs.emplace_back(tensor, dim, inner);
+    inputs.emplace_back(tensor, dim, inner, total_inner);
+    total_inner += inputs.back().inner_size;
   }
- 
+
   using Vec = vec256::Vec256<scalar_t>;
-  int64_t offset = 0;
-  for (int64_t i = 0; i < outer; i++) {
-    for (int64_t j = 0; j < ninputs; j++) {
-      scalar_t* result_ptr = result_data + offset;
+  // One work item copies one input's slice for one outer index. The work
+  // items are partitioned across the intra-op pool; the destination ranges
+  // are disjoint, so each thread first-touches the output pages it writes,
+  // which keeps the copy local on NUMA systems when the result was freshly
+  // allocated. The grain is chosen so each task moves roughly GRAIN_SIZE
+  // elements, which also makes small concatenations run inline on the
+  // calling thread.
+  const int64_t avg_inner =
+      std::max(int64_t(1), total_inner / std::max(int64_t(1), ninputs));
+  const int64_t grain =
+      std::max(int64_t(1), divup(at::internal::GRAIN_SIZE, avg_inner));
+  at::parallel_for(0, outer * ninputs, grain, [&](int64_t begin, int64_t end) {
+    for (int64_t w = begin; w < end; w++) {
+      const int64_t i = w / ninputs;
+      const int64_t j = w % ninputs;
+      scalar_t* result_ptr = result_data + i * total_inner + inputs[j].offset;
       int64_t local_inner = inputs[j].inner_size;
       scalar_t* input_ptr = (scalar_t*)(inputs[j].data_ptr) + i * local_inner;
       if (local_inner < Vec::size()) {
@@ -57,19 +75,18 @@ void cat_serial_kernel_impl(Tensor& result, TensorList tensors, int64_t dim) {
             input_ptr,
             local_inner);
       }
-      offset += local_inner;
     }
-  }
+  });
 }
 
-void cat_serial_kernel(Tensor& result, TensorList tensors, int64_t dim) {
-  AT_DISPATCH_FLOATING_TYPES(result.scalar_type(), "cat_serial_kernel", [&]() {
-    cat_serial_kernel_impl<scalar_t>(result, tensors, dim);
+void cat_contig_kernel(Tensor& result, TensorList tensors, int64_t dim) {
+  AT_DISPATCH_FLOATING_TYPES(result.scalar_type(), "cat_contig_kernel", [&]() {
+    cat_contig_kernel_impl<scalar_t>(result, tensors, dim);
   });
 }
 
 } // anonymous namespace
 
-REGISTER_DISPATCH(cat_serial_stub, &cat_serial_kernel);
+REGISTER_DISPATCH(cat_contig_stub, &cat_contig_kernel);
 
 }} // at::native
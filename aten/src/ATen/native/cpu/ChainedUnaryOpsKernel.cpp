@@ -0,0 +1,365 @@
+#include <ATen/native/ChainedUnaryOps.h>
+
+#include <cmath>
+
+#include <ATen/Dispatch.h>
+#include <ATen/cpu/vec256/vec256.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/cpu/Loops.h>
+
+namespace at { namespace native {
+namespace {
+
+using namespace vec256;
+
+// Each stage is a pair of scalar/vector evaluators selected by a
+// compile-time Kind, so a whole chain can be folded into straight-line
+// code by the pre-instantiated paths below while the generic path reuses
+// the same evaluators behind a per-stage switch.
+template <ChainStage::Kind kind>
+struct StageOp;
+
+template <>
+struct StageOp<ChainStage::Kind::AddScalar> {
+  template <typename T>
+  static inline T apply(T x, T alpha, T /*beta*/) {
+    return x + alpha;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T alpha, T /*beta*/) {
+    return x + Vec256<T>(alpha);
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::SubScalar> {
+  template <typename T>
+  static inline T apply(T x, T alpha, T /*beta*/) {
+    return x - alpha;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T alpha, T /*beta*/) {
+    return x - Vec256<T>(alpha);
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::MulScalar> {
+  template <typename T>
+  static inline T apply(T x, T alpha, T /*beta*/) {
+    return x * alpha;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T alpha, T /*beta*/) {
+    return x * Vec256<T>(alpha);
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::DivScalar> {
+  template <typename T>
+  static inline T apply(T x, T alpha, T /*beta*/) {
+    return x / alpha;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T alpha, T /*beta*/) {
+    return x / Vec256<T>(alpha);
+  }
+};
+
+// The clamp stages use the same formulation as clamp_kernel in
+// UnaryOpsKernel.cpp, so a fused chain matches the unfused ops exactly.
+template <>
+struct StageOp<ChainStage::Kind::Clamp> {
+  template <typename T>
+  static inline T apply(T x, T alpha, T beta) {
+    return x < alpha ? alpha : (x > beta ? beta : x);
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T alpha, T beta) {
+    return clamp(x, Vec256<T>(alpha), Vec256<T>(beta));
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::ClampMin> {
+  template <typename T>
+  static inline T apply(T x, T alpha, T /*beta*/) {
+    return x < alpha ? alpha : x;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T alpha, T /*beta*/) {
+    return clamp_min(x, Vec256<T>(alpha));
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::ClampMax> {
+  template <typename T>
+  static inline T apply(T x, T alpha, T /*beta*/) {
+    return x > alpha ? alpha : x;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T alpha, T /*beta*/) {
+    return clamp_max(x, Vec256<T>(alpha));
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Neg> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return -x;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return Vec256<T>(T(0)) - x;
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Abs> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return std::abs(x);
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return x.abs();
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Reciprocal> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return T(1) / x;
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return x.reciprocal();
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Sqrt> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return std::sqrt(x);
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return x.sqrt();
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Exp> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return std::exp(x);
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return x.exp();
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Log> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return std::log(x);
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return x.log();
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Log1p> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return std::log1p(x);
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return x.log1p();
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Sigmoid> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return T(1) / (T(1) + std::exp(-x));
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    x = Vec256<T>(T(0)) - x;
+    x = x.exp();
+    x = Vec256<T>(T(1)) + x;
+    return x.reciprocal();
+  }
+};
+
+template <>
+struct StageOp<ChainStage::Kind::Relu> {
+  template <typename T>
+  static inline T apply(T x, T /*alpha*/, T /*beta*/) {
+    return maximum(x, T(0));
+  }
+  template <typename T>
+  static inline Vec256<T> apply(Vec256<T> x, T /*alpha*/, T /*beta*/) {
+    return maximum(x, Vec256<T>(T(0)));
+  }
+};
+
+// The stage list with its Scalar operands lowered to the kernel dtype.
+template <typename scalar_t>
+struct StageArgs {
+  ChainStage::Kind kind;
+  scalar_t alpha;
+  scalar_t beta;
+};
+
+// Compile-time evaluation of a chain whose kinds are template arguments;
+// the per-stage dispatch disappears entirely and the compiler sees the
+// whole chain as one straight-line expression.
+template <typename scalar_t>
+inline scalar_t apply_static(scalar_t x, const StageArgs<scalar_t>* /*args*/) {
+  return x;
+}
+
+template <typename scalar_t, ChainStage::Kind kind, ChainStage::Kind... rest>
+inline scalar_t apply_static(scalar_t x, const StageArgs<scalar_t>* args) {
+  return apply_static<scalar_t, rest...>(
+      StageOp<kind>::apply(x, args->alpha, args->beta), args + 1);
+}
+
+template <typename scalar_t>
+inline Vec256<scalar_t> apply_static_vec(
+    Vec256<scalar_t> x,
+    const StageArgs<scalar_t>* /*args*/) {
+  return x;
+}
+
+template <typename scalar_t, ChainStage::Kind kind, ChainStage::Kind... rest>
+inline Vec256<scalar_t> apply_static_vec(
+    Vec256<scalar_t> x,
+    const StageArgs<scalar_t>* args) {
+  return apply_static_vec<scalar_t, rest...>(
+      StageOp<kind>::apply(x, args->alpha, args->beta), args + 1);
+}
+
+// Generic evaluation of an arbitrary chain. `X` is either scalar_t or
+// Vec256<scalar_t>; the switch runs once per stage per vector, not per
+// element, so even unmatched chains stay a single memory pass.
+template <typename scalar_t, typename X>
+inline X apply_dynamic(X x, const StageArgs<scalar_t>* args, int64_t n) {
+  for (int64_t i = 0; i < n; i++) {
+    const auto& stage = args[i];
+    switch (stage.kind) {
+#define CHAIN_STAGE_CASE(K)                                          \
+  case ChainStage::Kind::K:                                          \
+    x = StageOp<ChainStage::Kind::K>::apply(                         \
+        x, stage.alpha, stage.beta);                                 \
+    break;
+      CHAIN_STAGE_CASE(AddScalar)
+      CHAIN_STAGE_CASE(SubScalar)
+      CHAIN_STAGE_CASE(MulScalar)
+      CHAIN_STAGE_CASE(DivScalar)
+      CHAIN_STAGE_CASE(Clamp)
+      CHAIN_STAGE_CASE(ClampMin)
+      CHAIN_STAGE_CASE(ClampMax)
+      CHAIN_STAGE_CASE(Neg)
+      CHAIN_STAGE_CASE(Abs)
+      CHAIN_STAGE_CASE(Reciprocal)
+      CHAIN_STAGE_CASE(Sqrt)
+      CHAIN_STAGE_CASE(Exp)
+      CHAIN_STAGE_CASE(Log)
+      CHAIN_STAGE_CASE(Log1p)
+      CHAIN_STAGE_CASE(Sigmoid)
+      CHAIN_STAGE_CASE(Relu)
+#undef CHAIN_STAGE_CASE
+    }
+  }
+  return x;
+}
+
+// Runs the chain through a fully unrolled instantiation if the runtime
+// stage kinds match the template pattern; returns false otherwise.
+template <typename scalar_t, ChainStage::Kind... kinds>
+bool try_static_chain(
+    TensorIterator& iter,
+    const StageArgs<scalar_t> (&args)[kMaxChainStages],
+    int64_t n) {
+  constexpr ChainStage::Kind pattern[] = {kinds...};
+  constexpr int64_t len = sizeof...(kinds);
+  if (n != len) {
+    return false;
+  }
+  for (int64_t i = 0; i < len; i++) {
+    if (args[i].kind != pattern[i]) {
+      return false;
+    }
+  }
+  cpu_kernel_vec(
+      iter,
+      [=](scalar_t a) -> scalar_t {
+        return apply_static<scalar_t, kinds...>(a, args);
+      },
+      [=](Vec256<scalar_t> a) {
+        return apply_static_vec<scalar_t, kinds...>(a, args);
+      });
+  return true;
+}
+
+static void chained_unary_kernel(
+    TensorIterator& iter,
+    ArrayRef<ChainStage> stages) {
+  AT_DISPATCH_FLOATING_TYPES(iter.dtype(), "chained_unary_cpu", [&]() {
+    const int64_t n = stages.size();
+    StageArgs<scalar_t> args[kMaxChainStages] = {};
+    for (int64_t i = 0; i < n; i++) {
+      args[i] = {
+          stages[i].kind,
+          stages[i].alpha.to<scalar_t>(),
+          stages[i].beta.to<scalar_t>()};
+    }
+
+    using K = ChainStage::Kind;
+    // Pre-instantiated fast paths for the chains we see most often (the
+    // normalization pipelines and affine/activation pairs); each is one
+    // cpu_kernel_vec pass with no per-stage dispatch.
+    if (try_static_chain<scalar_t, K::SubScalar, K::DivScalar, K::Clamp, K::Log1p>(iter, args, n) ||
+        try_static_chain<scalar_t, K::SubScalar, K::DivScalar, K::Clamp>(iter, args, n) ||
+        try_static_chain<scalar_t, K::SubScalar, K::DivScalar>(iter, args, n) ||
+        try_static_chain<scalar_t, K::MulScalar, K::AddScalar>(iter, args, n) ||
+        try_static_chain<scalar_t, K::MulScalar, K::AddScalar, K::Relu>(iter, args, n) ||
+        try_static_chain<scalar_t, K::MulScalar, K::AddScalar, K::Sigmoid>(iter, args, n) ||
+        try_static_chain<scalar_t, K::Clamp, K::Log1p>(iter, args, n) ||
+        try_static_chain<scalar_t, K::DivScalar, K::Log1p>(iter, args, n) ||
+        try_static_chain<scalar_t, K::AddScalar, K::Log>(iter, args, n) ||
+        try_static_chain<scalar_t, K::MulScalar, K::Relu>(iter, args, n)) {
+      return;
+    }
+
+    // Generic path: interpret the stage list once per vector.
+    cpu_kernel_vec(
+        iter,
+        [=](scalar_t a) -> scalar_t {
+          return apply_dynamic<scalar_t>(a, args, n);
+        },
+        [=](Vec256<scalar_t> a) {
+          return apply_dynamic<scalar_t>(a, args, n);
+        });
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(chained_unary_stub, &chained_unary_kernel);
+
+}} // namespace at::native
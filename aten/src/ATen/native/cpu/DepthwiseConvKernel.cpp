@@ -1,6 +1,10 @@
 #include <ATen/native/cpu/DepthwiseConvKernel.h>
 #include <ATen/ATen.h>
 #include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+#include <algorithm>
+#include <vector>
 
 #ifdef __ARM_NEON__
 #include <arm_neon.h>
@@ -297,9 +301,289 @@ Tensor _convolution_depthwise3x3_winograd(
   return output;
 }
 
+// Direct depthwise convolution for arbitrary kernel sizes, strides and
+// dilations. Unlike the im2col fallback this never materializes column
+// buffers: each output value is accumulated straight from the input plane,
+// with the kernel taps held in registers across one vector of outputs.
+// Both contiguous (NCHW) and channels-last (NHWC) layouts are handled; the
+// former vectorizes along output columns, the latter along channels.
+
+struct DirectArguments final {
+  int64_t in_rows;
+  int64_t in_cols;
+  int64_t out_rows;
+  int64_t out_cols;
+  int64_t kernel_rows;
+  int64_t kernel_cols;
+  int64_t stride_rows;
+  int64_t stride_cols;
+  int64_t pad_rows;
+  int64_t pad_cols;
+  int64_t dilation_rows;
+  int64_t dilation_cols;
+};
+
+// Computes one output plane of a single channel in NCHW layout.
+void convolution_depthwise_direct_nchw_impl(
+    const DirectArguments& args,
+    const float* const input,
+    const float* const kernel,
+    const float bias,
+    float* const output) {
+  using Vec = vec256::Vec256<float>;
+  const int64_t kh = args.kernel_rows;
+  const int64_t kw = args.kernel_cols;
+  const int64_t dh = args.dilation_rows;
+  const int64_t dw = args.dilation_cols;
+  const int64_t sh = args.stride_rows;
+  const int64_t sw = args.stride_cols;
+
+  // Output columns whose every kernel tap is in-bounds horizontally:
+  //   0 <= ow * sw - pad + s * dw < in_cols  for all s in [0, kw)
+  const int64_t interior_begin = std::min(
+      args.out_cols, (args.pad_cols + sw - 1) / sw);
+  const int64_t interior_end = std::max(
+      interior_begin,
+      std::min(
+          args.out_cols,
+          (args.in_cols - (kw - 1) * dw - 1 + args.pad_cols) / sw + 1));
+
+  for (int64_t oh = 0; oh < args.out_rows; ++oh) {
+    float* const out_row = output + oh * args.out_cols;
+    const int64_t ih0 = oh * sh - args.pad_rows;
+    // Kernel rows whose input row is in-bounds for this output row.
+    int64_t r_begin = 0;
+    while (r_begin < kh && ih0 + r_begin * dh < 0) {
+      ++r_begin;
+    }
+    int64_t r_end = kh;
+    while (r_end > r_begin && ih0 + (r_end - 1) * dh >= args.in_rows) {
+      --r_end;
+    }
+
+    const auto compute_edge = [&](int64_t ow) {
+      float acc = bias;
+      const int64_t iw0 = ow * sw - args.pad_cols;
+      for (int64_t r = r_begin; r < r_end; ++r) {
+        const float* const in_row = input + (ih0 + r * dh) * args.in_cols;
+        const float* const k_row = kernel + r * kw;
+        for (int64_t s = 0; s < kw; ++s) {
+          const int64_t iw = iw0 + s * dw;
+          if (iw >= 0 && iw < args.in_cols) {
+            acc += in_row[iw] * k_row[s];
+          }
+        }
+      }
+      out_row[ow] = acc;
+    };
+
+    for (int64_t ow = 0; ow < interior_begin; ++ow) {
+      compute_edge(ow);
+    }
+    int64_t ow = interior_begin;
+    if (sw == 1) {
+      const Vec bias_vec(bias);
+      for (; ow + Vec::size() <= interior_end; ow += Vec::size()) {
+        Vec acc = bias_vec;
+        const int64_t iw0 = ow - args.pad_cols;
+        for (int64_t r = r_begin; r < r_end; ++r) {
+          const float* const in_row =
+              input + (ih0 + r * dh) * args.in_cols + iw0;
+          const float* const k_row = kernel + r * kw;
+          for (int64_t s = 0; s < kw; ++s) {
+            acc = vec256::fmadd(Vec::loadu(in_row + s * dw), Vec(k_row[s]), acc);
+          }
+        }
+        acc.store(out_row + ow);
+      }
+    }
+    for (; ow < interior_end; ++ow) {
+      float acc = bias;
+      const int64_t iw0 = ow * sw - args.pad_cols;
+      for (int64_t r = r_begin; r < r_end; ++r) {
+        const float* const in_row = input + (ih0 + r * dh) * args.in_cols;
+        const float* const k_row = kernel + r * kw;
+        for (int64_t s = 0; s < kw; ++s) {
+          acc += in_row[iw0 + s * dw] * k_row[s];
+        }
+      }
+      out_row[ow] = acc;
+    }
+    for (; ow < args.out_cols; ++ow) {
+      compute_edge(ow);
+    }
+  }
+}
+
+// Computes one batch image in channels-last layout, vectorizing over the
+// channel dimension. `kernel` is pre-packed as (kh * kw, channels) so tap
+// loads are contiguous.
+void convolution_depthwise_direct_nhwc_impl(
+    const DirectArguments& args,
+    const int64_t channels,
+    const float* const input,
+    const float* const kernel,
+    const float* const bias,
+    float* const output) {
+  using Vec = vec256::Vec256<float>;
+  const int64_t kw = args.kernel_cols;
+
+  for (int64_t oh = 0; oh < args.out_rows; ++oh) {
+    for (int64_t ow = 0; ow < args.out_cols; ++ow) {
+      float* const out_px =
+          output + (oh * args.out_cols + ow) * channels;
+      const int64_t ih0 = oh * args.stride_rows - args.pad_rows;
+      const int64_t iw0 = ow * args.stride_cols - args.pad_cols;
+      int64_t c = 0;
+      for (; c + Vec::size() <= channels; c += Vec::size()) {
+        Vec acc = Vec::loadu(bias + c);
+        for (int64_t r = 0; r < args.kernel_rows; ++r) {
+          const int64_t ih = ih0 + r * args.dilation_rows;
+          if (ih < 0 || ih >= args.in_rows) {
+            continue;
+          }
+          for (int64_t s = 0; s < kw; ++s) {
+            const int64_t iw = iw0 + s * args.dilation_cols;
+            if (iw < 0 || iw >= args.in_cols) {
+              continue;
+            }
+            acc = vec256::fmadd(
+                Vec::loadu(input + (ih * args.in_cols + iw) * channels + c),
+                Vec::loadu(kernel + (r * kw + s) * channels + c),
+                acc);
+          }
+        }
+        acc.store(out_px + c);
+      }
+      for (; c < channels; ++c) {
+        float acc = bias[c];
+        for (int64_t r = 0; r < args.kernel_rows; ++r) {
+          const int64_t ih = ih0 + r * args.dilation_rows;
+          if (ih < 0 || ih >= args.in_rows) {
+            continue;
+          }
+          for (int64_t s = 0; s < kw; ++s) {
+            const int64_t iw = iw0 + s * args.dilation_cols;
+            if (iw < 0 || iw >= args.in_cols) {
+              continue;
+            }
+            acc += input[(ih * args.in_cols + iw) * channels + c] *
+                kernel[(r * kw + s) * channels + c];
+          }
+        }
+        out_px[c] = acc;
+      }
+    }
+  }
+}
+
+Tensor _convolution_depthwise_direct(
+    const Tensor& input,
+    const Tensor& kernel,
+    const Tensor& bias_potentially_undefined,
+    const IntArrayRef stride,
+    const IntArrayRef padding,
+    const IntArrayRef dilation,
+    const int64_t groups) {
+  const int64_t batch = input.size(0);
+  const int64_t channels = input.size(1);
+  const int64_t kernel_rows = kernel.size(2);
+  const int64_t kernel_cols = kernel.size(3);
+  TORCH_INTERNAL_ASSERT(
+      groups == channels, "direct depthwise expects one group per channel");
+
+  const auto calc_output_dimension = [](
+      const int64_t in, const int64_t k, const int64_t s, const int64_t p,
+      const int64_t d) {
+    return (in + 2 * p - d * (k - 1) - 1) / s + 1;
+  };
+
+  const DirectArguments args {
+      input.size(2),
+      input.size(3),
+      calc_output_dimension(
+          input.size(2), kernel_rows, stride[0], padding[0], dilation[0]),
+      calc_output_dimension(
+          input.size(3), kernel_cols, stride[1], padding[1], dilation[1]),
+      kernel_rows,
+      kernel_cols,
+      stride[0],
+      stride[1],
+      padding[0],
+      padding[1],
+      dilation[0],
+      dilation[1],
+  };
+
+  const bool channels_last =
+      input.suggest_memory_format() == MemoryFormat::ChannelsLast;
+  const auto memory_format =
+      channels_last ? MemoryFormat::ChannelsLast : MemoryFormat::Contiguous;
+
+  const Tensor input_contig = input.contiguous(memory_format);
+  const Tensor kernel_contig = kernel.contiguous();
+  const Tensor bias = bias_potentially_undefined.defined()
+      ? bias_potentially_undefined.contiguous()
+      : at::zeros({channels}, input.options());
+
+  Tensor output = at::empty(
+      {batch, channels, args.out_rows, args.out_cols},
+      input.options(),
+      memory_format);
+  if (output.numel() == 0) {
+    return output;
+  }
+
+  const float* const input_data = input_contig.data_ptr<float>();
+  const float* const kernel_data = kernel_contig.data_ptr<float>();
+  const float* const bias_data = bias.data_ptr<float>();
+  float* const output_data = output.data_ptr<float>();
+
+  const int64_t input_hxw = args.in_rows * args.in_cols;
+  const int64_t output_hxw = args.out_rows * args.out_cols;
+
+  if (channels_last) {
+    // Re-pack the kernel from (C, 1, kh, kw) to (kh * kw, C) so channel
+    // vectors load contiguously.
+    std::vector<float> packed_kernel(kernel_rows * kernel_cols * channels);
+    for (int64_t c = 0; c < channels; ++c) {
+      for (int64_t t = 0; t < kernel_rows * kernel_cols; ++t) {
+        packed_kernel[t * channels + c] =
+            kernel_data[c * kernel_rows * kernel_cols + t];
+      }
+    }
+    at::parallel_for(0, batch, 0, [&](int64_t start, int64_t end) {
+      for (int64_t n = start; n < end; ++n) {
+        convolution_depthwise_direct_nhwc_impl(
+            args,
+            channels,
+            input_data + n * input_hxw * channels,
+            packed_kernel.data(),
+            bias_data,
+            output_data + n * output_hxw * channels);
+      }
+    });
+  } else {
+    at::parallel_for(0, batch * channels, 0, [&](int64_t start, int64_t end) {
+      for (int64_t k = start; k < end; ++k) {
+        const int64_t c = k % channels;
+        convolution_depthwise_direct_nchw_impl(
+            args,
+            input_data + k * input_hxw,
+            kernel_data + c * kernel_rows * kernel_cols,
+            bias_data[c],
+            output_data + k * output_hxw);
+      }
+    });
+  }
+
+  return output;
+}
+
 }  // namespace
 
 REGISTER_DISPATCH(convolution_depthwise3x3_winograd_stub, &_convolution_depthwise3x3_winograd);
+REGISTER_DISPATCH(convolution_depthwise_direct_stub, &_convolution_depthwise_direct);
 
 }  // namespace native
 }  // namespace at
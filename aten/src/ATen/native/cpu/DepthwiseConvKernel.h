@@ -4,7 +4,8 @@
 #include <ATen/native/DispatchStub.h>
 
 /*
-  Depthwise 3x3 Winograd convolution operator
+  Depthwise convolution operators: a 3x3 Winograd kernel (NEON only) and a
+  direct kernel covering arbitrary kernel sizes, strides and dilations.
 */
 
 namespace at {
@@ -15,5 +16,10 @@ using convolution_depthwise3x3_winograd_fn =
 
 DECLARE_DISPATCH(convolution_depthwise3x3_winograd_fn, convolution_depthwise3x3_winograd_stub);
 
+using convolution_depthwise_direct_fn =
+    Tensor (*)(const Tensor &, const Tensor &, const Tensor &, IntArrayRef, IntArrayRef, IntArrayRef, int64_t);
+
+DECLARE_DISPATCH(convolution_depthwise_direct_fn, convolution_depthwise_direct_stub);
+
 }  // namespace native
 }  // namespace at
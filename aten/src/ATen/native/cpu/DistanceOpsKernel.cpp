@@ -207,36 +207,38 @@ struct Dist {
     int64_t size1 = r1 * m;
     int64_t size2 = r2 * m;
 
-    parallel_for(0, combs * d, internal::GRAIN_SIZE / (16 * m), [=](int64_t start, int64_t end) {
-      scalar_t * res = res_start + start;
-      const scalar_t * const res_end = res_start + end;
-      int64_t l = start / combs;
-      int64_t k = start % combs;
-      int64_t i = k / r2;
-      int64_t j = k % r2;
-      i = i * m;
-      j = j * m;
-
-      while (res != res_end) {
-        const scalar_t * self_i = t1_start + size1 * l + i;
-        const scalar_t * self_j = t2_start + size2 * l + j;
-
-        scalar_t agg = 0;
-        for (int x = 0; x < m; x++) {
-          scalar_t a = *(self_i + x);
-          scalar_t b = *(self_j + x);
-          agg = F::red(agg, F::map(std::abs(a-b), p));
-        }
-        *res = F::finish(agg, p);
-
-        res += 1;
-        j += m;
-        if (j == size2) {
-          j = 0;
-          i += m;
-          if (i == size1) {
-            i = 0;
-            l += 1;
+    // Block both point sets so that a tile of rows from each stays resident in
+    // L2 while all of the tile pair's distances are computed, instead of
+    // streaming the whole second set past every row of the first. Each tile
+    // pair owns a disjoint block of the result, so the pairs can be processed
+    // fully in parallel without locking.
+    constexpr int64_t TILE_BYTES = 128 * 1024;  // roughly half a typical L2
+    const int64_t rows_per_tile = std::min<int64_t>(
+      256, std::max<int64_t>(1, TILE_BYTES / (2 * m * static_cast<int64_t>(sizeof(scalar_t)))));
+    const int64_t tiles1 = (r1 + rows_per_tile - 1) / rows_per_tile;
+    const int64_t tiles2 = (r2 + rows_per_tile - 1) / rows_per_tile;
+    const int64_t tile_pairs = tiles1 * tiles2;
+    const int64_t grain_size = std::max<int64_t>(
+      1, internal::GRAIN_SIZE / (rows_per_tile * rows_per_tile * m));
+
+    parallel_for(0, d * tile_pairs, grain_size, [=](int64_t begin, int64_t end) {
+      const Vec pvec(p);
+      for (int64_t t = begin; t < end; t++) {
+        int64_t l = t / tile_pairs;
+        int64_t ti = (t % tile_pairs) / tiles2;
+        int64_t tj = t % tiles2;
+        int64_t i_end = std::min((ti + 1) * rows_per_tile, r1);
+        int64_t j_start = tj * rows_per_tile;
+        int64_t j_end = std::min(j_start + rows_per_tile, r2);
+
+        for (int64_t i = ti * rows_per_tile; i < i_end; i++) {
+          const scalar_t * self_i = t1_start + size1 * l + i * m;
+          const scalar_t * self_j = t2_start + size2 * l + j_start * m;
+          scalar_t * res = res_start + combs * l + i * r2 + j_start;
+          for (int64_t j = j_start; j < j_end; j++, self_j += m, res += 1) {
+            *res = F::finish(vec256::map2_reduce_all<scalar_t>(
+              [&pvec](Vec a, Vec b) { return F::map((a - b).abs(), pvec); },
+              F::red, self_i, self_j, m), p);
           }
         }
       }
@@ -245,15 +247,15 @@ struct Dist {
 
   static void apply_cdist(Tensor& result, const Tensor& x1, const Tensor& x2, const scalar_t p) {
     if (p == 0.0) {
-      run_parallel_cdist<zdist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<zdist_calc<Vec>>(result, x1, x2, p);
     } else if (p == 1.0) {
-      run_parallel_cdist<odist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<odist_calc<Vec>>(result, x1, x2, p);
     } else if (p == 2.0) {
-      run_parallel_cdist<tdist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<tdist_calc<Vec>>(result, x1, x2, p);
     } else if (std::isinf(p)) {
-      run_parallel_cdist<idist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<idist_calc<Vec>>(result, x1, x2, p);
     } else {
-      run_parallel_cdist<pdist_calc<scalar_t>>(result, x1, x2, p);
+      run_parallel_cdist<pdist_calc<Vec>>(result, x1, x2, p);
     }
   }
 
@@ -1,7 +1,9 @@
 #pragma once
 
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/PhiloxRNGEngine.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
 #include <limits>
@@ -12,6 +14,45 @@ namespace native {
 namespace templates {
 namespace cpu {
 
+// NOTE [ Parallel Philox sampling ]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The MT19937 engine behind CPUGenerator is inherently serial: every draw
+// mutates the generator state, so bulk fills hold the generator mutex and
+// run on a single thread. Philox is counter-based - the i-th 32-bit random
+// is a pure function of (seed, counter) - which lets a bulk fill split the
+// output across the intra-op pool with per-chunk counter offsets while
+// staying deterministic for a given generator state. philox_parallel_fill
+// draws a fresh 64-bit Philox seed from the generator's own stream (which
+// both keys the fill to the current RNG state and advances it, so
+// consecutive fills produce independent values and manual_seed/set_state
+// still control the result), then hands each element's raw randoms to the
+// transform. `draws_per_sample` is how many 32-bit randoms the transform
+// consumes per element (1 for float, 2 for double).
+template <int draws_per_sample, typename scalar_t, typename RNG, typename transform_t>
+void philox_parallel_fill(scalar_t* data, int64_t size, RNG generator, const transform_t& transform) {
+  uint64_t seed;
+  {
+    std::lock_guard<std::mutex> lock(generator->mutex_);
+    const uint64_t hi = generator->random();
+    const uint64_t lo = generator->random();
+    seed = hi << 32 | lo;
+  }
+  at::parallel_for(0, size, at::internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    // Each 128-bit Philox counter yields four 32-bit randoms, so starting
+    // the engine at counter first_draw / 4 and discarding first_draw % 4
+    // outputs aligns it to element `begin` no matter how the range was
+    // chunked.
+    const uint64_t first_draw = static_cast<uint64_t>(begin) * draws_per_sample;
+    at::Philox4_32_10 engine(seed, 0, first_draw / 4);
+    for (uint64_t k = first_draw % 4; k > 0; --k) {
+      engine();
+    }
+    for (int64_t i = begin; i < end; ++i) {
+      data[i] = transform(engine);
+    }
+  });
+}
+
 template<typename RNG>
 void random_from_to_kernel(TensorIterator& iter, uint64_t range, int64_t base, RNG generator) {
   AT_DISPATCH_ALL_TYPES_AND3(at::ScalarType::Bool, at::ScalarType::Half, at::ScalarType::BFloat16, iter.dtype(), "random_from_to_kernel_cpu", [&] {
@@ -0,0 +1,115 @@
+#include <ATen/native/ForeachOps.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/functional.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace at {
+namespace native {
+namespace {
+
+// One task entry per tensor of the list; `offset` is the tensor's position
+// in the flattened element space all tensors share, so one parallel_for can
+// split the whole list into balanced ranges regardless of how the elements
+// are distributed over tensors.
+template <typename scalar_t>
+struct ForeachEntry {
+  const scalar_t* input;
+  scalar_t* output;
+  int64_t numel;
+  int64_t offset;
+};
+
+template <typename scalar_t, typename vec_fun_t>
+void foreach_elementwise(
+    TensorList outputs,
+    TensorList inputs,
+    const vec_fun_t& vec_fun) {
+  std::vector<ForeachEntry<scalar_t>> entries;
+  entries.reserve(inputs.size());
+  int64_t total = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    int64_t numel = inputs[i].numel();
+    if (numel == 0) {
+      continue;
+    }
+    entries.push_back(ForeachEntry<scalar_t>{
+        inputs[i].data_ptr<scalar_t>(),
+        outputs[i].data_ptr<scalar_t>(),
+        numel,
+        total});
+    total += numel;
+  }
+
+  at::parallel_for(
+      0, total, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        // locate the tensor containing `begin`, then walk forward
+        auto it = std::upper_bound(
+            entries.begin(),
+            entries.end(),
+            begin,
+            [](int64_t pos, const ForeachEntry<scalar_t>& e) {
+              return pos < e.offset;
+            });
+        for (size_t t = it - entries.begin() - 1;
+             t < entries.size() && entries[t].offset < end;
+             ++t) {
+          const auto& e = entries[t];
+          int64_t local_begin = std::max<int64_t>(begin - e.offset, 0);
+          int64_t local_end = std::min(e.numel, end - e.offset);
+          vec256::map(
+              vec_fun,
+              e.output + local_begin,
+              e.input + local_begin,
+              local_end - local_begin);
+        }
+      });
+}
+
+void foreach_add_scalar_kernel(
+    TensorList outputs,
+    TensorList inputs,
+    Scalar scalar) {
+  AT_DISPATCH_ALL_TYPES(
+      inputs[0].scalar_type(), "foreach_add_scalar_cpu", [&] {
+        using Vec = vec256::Vec256<scalar_t>;
+        scalar_t a = scalar.to<scalar_t>();
+        foreach_elementwise<scalar_t>(
+            outputs, inputs, [a](Vec x) { return x + Vec(a); });
+      });
+}
+
+void foreach_mul_scalar_kernel(
+    TensorList outputs,
+    TensorList inputs,
+    Scalar scalar) {
+  AT_DISPATCH_ALL_TYPES(
+      inputs[0].scalar_type(), "foreach_mul_scalar_cpu", [&] {
+        using Vec = vec256::Vec256<scalar_t>;
+        scalar_t a = scalar.to<scalar_t>();
+        foreach_elementwise<scalar_t>(
+            outputs, inputs, [a](Vec x) { return x * Vec(a); });
+      });
+}
+
+void foreach_exp_kernel(TensorList outputs, TensorList inputs) {
+  AT_DISPATCH_FLOATING_TYPES(
+      inputs[0].scalar_type(), "foreach_exp_cpu", [&] {
+        using Vec = vec256::Vec256<scalar_t>;
+        foreach_elementwise<scalar_t>(
+            outputs, inputs, [](Vec x) { return x.exp(); });
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(foreach_add_scalar_stub, &foreach_add_scalar_kernel);
+REGISTER_DISPATCH(foreach_mul_scalar_stub, &foreach_mul_scalar_kernel);
+REGISTER_DISPATCH(foreach_exp_stub, &foreach_exp_kernel);
+
+} // namespace native
+} // namespace at
@@ -9,7 +9,9 @@
 #include <c10/util/C++17.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <limits>
 #include <type_traits>
 
 namespace at { namespace native { namespace {
@@ -1025,10 +1027,191 @@ grid_sampler_2d_backward_cpu_kernel_impl(const Tensor& grad_output_,
   return std::make_tuple(grad_input, grad_grid);
 }
 
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~ Grid Sample Plans ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+/**  NOTE [ Grid sample plans ]
+ *
+ *   Pipelines that warp every frame with the same static grid pay the full
+ *   coordinate math (unnormalization, padding, weight computation) on every
+ *   call even though the grid never changes.  A plan bakes that math into two
+ *   tables computed once from the grid:
+ *
+ *     offsets  [N, 4, H_out, W_out]  int32 for float data, int64 for double
+ *     weights  [N, 4, H_out, W_out]  same dtype as the data
+ *
+ *   For each output pixel, tap k holds an element offset into the input's
+ *   contiguous H_in * W_in spatial plane and the interpolation weight of that
+ *   tap.  Out-of-bounds taps are stored as offset 0 with weight 0, so padding
+ *   needs no branches at apply time.  Nearest mode uses tap 0 with weight 1
+ *   (or 0 if out of bounds) and zeroes taps 1-3.  Applying a plan is then a
+ *   pure gather-FMA loop over the N * C input planes; since the offset lanes
+ *   have the same width as the data lanes, `gather` (see vec256) maps onto
+ *   the hardware gather instructions directly.
+ *
+ *   Nearest mode rounds with std::nearbyint, which in the default rounding
+ *   mode matches the Vec256 round() used by the direct kernel, so applying a
+ *   plan reproduces grid_sampler_2d bit for bit.
+ */
+
+template<typename scalar_t>
+std::tuple<Tensor, Tensor>
+grid_sampler_2d_compile_plan_impl(const Tensor& grid,
+                                  int64_t inp_H, int64_t inp_W,
+                                  GridSamplerInterpolation interpolation_mode,
+                                  GridSamplerPadding padding_mode,
+                                  bool align_corners) {
+  using integer_t = int_same_size_t<scalar_t>;
+  auto N = grid.size(0);
+  auto out_H = grid.size(1);
+  auto out_W = grid.size(2);
+  TORCH_CHECK(inp_H * inp_W <= std::numeric_limits<integer_t>::max(),
+              "grid_sampler_2d_compile_plan(): input plane of ", inp_H, " x ",
+              inp_W, " elements overflows the plan's index type");
+  auto offsets = at::empty({N, 4, out_H, out_W},
+                           grid.options().dtype(std::is_same<scalar_t, float>::value ? kInt : kLong));
+  auto weights = at::empty({N, 4, out_H, out_W}, grid.options());
+  auto spatial_size = out_H * out_W;
+  auto grain_size = spatial_size == 0 ? (N + 1)
+                                      : at::divup(at::internal::GRAIN_SIZE, spatial_size * 4 /* 2d * 2 tensors*/);
+
+  auto grid_acc = grid.accessor<scalar_t, 4>();
+  auto off_acc = offsets.accessor<integer_t, 4>();
+  auto wgt_acc = weights.accessor<scalar_t, 4>();
+  parallel_for(0, N, grain_size, [&](int64_t begin, int64_t end) {
+    for (int64_t n = begin; n < end; n++) {
+      auto grid_slice = grid_acc[n];
+      auto off_slice = off_acc[n];
+      auto wgt_slice = wgt_acc[n];
+      for (int64_t h = 0; h < out_H; h++) {
+        for (int64_t w = 0; w < out_W; w++) {
+          scalar_t ix = grid_sampler_compute_source_index(
+            grid_slice[h][w][0], inp_W, padding_mode, align_corners);
+          scalar_t iy = grid_sampler_compute_source_index(
+            grid_slice[h][w][1], inp_H, padding_mode, align_corners);
+          if (interpolation_mode == GridSamplerInterpolation::Bilinear) {
+            // get NW pixel and the fractional distances to it
+            int64_t ix_nw = static_cast<int64_t>(std::floor(ix));
+            int64_t iy_nw = static_cast<int64_t>(std::floor(iy));
+            scalar_t tx = ix - ix_nw;
+            scalar_t ty = iy - iy_nw;
+            int64_t tap_x[4] = {ix_nw, ix_nw + 1, ix_nw,     ix_nw + 1};
+            int64_t tap_y[4] = {iy_nw, iy_nw,     iy_nw + 1, iy_nw + 1};
+            scalar_t tap_w[4] = {(static_cast<scalar_t>(1) - tx) * (static_cast<scalar_t>(1) - ty),
+                                 tx * (static_cast<scalar_t>(1) - ty),
+                                 (static_cast<scalar_t>(1) - tx) * ty,
+                                 tx * ty};
+            for (int64_t k = 0; k < 4; k++) {
+              if (within_bounds_2d(tap_y[k], tap_x[k], inp_H, inp_W)) {
+                off_slice[k][h][w] = static_cast<integer_t>(tap_y[k] * inp_W + tap_x[k]);
+                wgt_slice[k][h][w] = tap_w[k];
+              } else {
+                off_slice[k][h][w] = static_cast<integer_t>(0);
+                wgt_slice[k][h][w] = static_cast<scalar_t>(0);
+              }
+            }
+          } else {  // interpolation_mode == GridSamplerInterpolation::Nearest
+            int64_t ix_nearest = static_cast<int64_t>(std::nearbyint(ix));
+            int64_t iy_nearest = static_cast<int64_t>(std::nearbyint(iy));
+            if (within_bounds_2d(iy_nearest, ix_nearest, inp_H, inp_W)) {
+              off_slice[0][h][w] = static_cast<integer_t>(iy_nearest * inp_W + ix_nearest);
+              wgt_slice[0][h][w] = static_cast<scalar_t>(1);
+            } else {
+              off_slice[0][h][w] = static_cast<integer_t>(0);
+              wgt_slice[0][h][w] = static_cast<scalar_t>(0);
+            }
+            for (int64_t k = 1; k < 4; k++) {
+              off_slice[k][h][w] = static_cast<integer_t>(0);
+              wgt_slice[k][h][w] = static_cast<scalar_t>(0);
+            }
+          }
+        }
+      }
+    }
+  });
+  return std::make_tuple(offsets, weights);
+}
+
+std::tuple<Tensor, Tensor>
+grid_sampler_2d_compile_plan_cpu_kernel_impl(const Tensor& grid,
+                                             int64_t input_h, int64_t input_w,
+                                             int64_t interpolation_mode,
+                                             int64_t padding_mode,
+                                             bool align_corners) {
+  return AT_DISPATCH_FLOATING_TYPES(grid.scalar_type(), "grid_sampler_2d_compile_plan_cpu_kernel_impl", [&] {
+    return grid_sampler_2d_compile_plan_impl<scalar_t>(
+      grid, input_h, input_w,
+      static_cast<GridSamplerInterpolation>(interpolation_mode),
+      static_cast<GridSamplerPadding>(padding_mode), align_corners);
+  });
+}
+
+template<typename scalar_t>
+Tensor grid_sampler_2d_apply_plan_impl(const Tensor& input_,
+                                       const Tensor& offsets_,
+                                       const Tensor& weights_) {
+  using integer_t = int_same_size_t<scalar_t>;
+  using Vec = Vec256<scalar_t>;
+  using iVec = Vec256<integer_t>;
+  auto input = input_.contiguous();
+  auto offsets = offsets_.contiguous();
+  auto weights = weights_.contiguous();
+  auto N = input.size(0);
+  auto C = input.size(1);
+  auto inp_plane = input.size(2) * input.size(3);
+  auto out_H = offsets.size(2);
+  auto out_W = offsets.size(3);
+  auto output = at::empty({N, C, out_H, out_W}, input.options());
+  auto spatial_size = out_H * out_W;
+  auto grain_size = spatial_size == 0 ? (N * C + 1)
+                                      : at::divup(at::internal::GRAIN_SIZE, spatial_size * 4 /* 4 taps */);
+
+  auto inp_ptr = input.data_ptr<scalar_t>();
+  auto off_ptr = offsets.data_ptr<integer_t>();
+  auto wgt_ptr = weights.data_ptr<scalar_t>();
+  auto out_ptr = output.data_ptr<scalar_t>();
+  parallel_for(0, N * C, grain_size, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      int64_t n = i / C;
+      const scalar_t *inp_slice = inp_ptr + i * inp_plane;
+      const integer_t *off_slice = off_ptr + n * 4 * spatial_size;
+      const scalar_t *wgt_slice = wgt_ptr + n * 4 * spatial_size;
+      scalar_t *out_slice = out_ptr + i * spatial_size;
+      int64_t p = 0;
+      for (; p + Vec::size() <= spatial_size; p += Vec::size()) {
+        auto acc = gather<sizeof(scalar_t)>(inp_slice, iVec::loadu(off_slice + p))
+                   * Vec::loadu(wgt_slice + p);
+        for (int64_t k = 1; k < 4; k++) {
+          acc = fmadd(
+            gather<sizeof(scalar_t)>(inp_slice, iVec::loadu(off_slice + k * spatial_size + p)),
+            Vec::loadu(wgt_slice + k * spatial_size + p), acc);
+        }
+        acc.store(out_slice + p);
+      }
+      for (; p < spatial_size; p++) {
+        scalar_t acc = inp_slice[off_slice[p]] * wgt_slice[p];
+        for (int64_t k = 1; k < 4; k++) {
+          acc += inp_slice[off_slice[k * spatial_size + p]] * wgt_slice[k * spatial_size + p];
+        }
+        out_slice[p] = acc;
+      }
+    }
+  });
+  return output;
+}
+
+Tensor grid_sampler_2d_apply_plan_cpu_kernel_impl(const Tensor& input,
+                                                  const Tensor& offsets,
+                                                  const Tensor& weights) {
+  return AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "grid_sampler_2d_apply_plan_cpu_kernel_impl", [&] {
+    return grid_sampler_2d_apply_plan_impl<scalar_t>(input, offsets, weights);
+  });
+}
+
 }
 
 REGISTER_DISPATCH(grid_sampler_2d_cpu_kernel, &grid_sampler_2d_cpu_kernel_impl);
 REGISTER_DISPATCH(grid_sampler_2d_backward_cpu_kernel, &grid_sampler_2d_backward_cpu_kernel_impl);
+REGISTER_DISPATCH(grid_sampler_2d_compile_plan_cpu_kernel, &grid_sampler_2d_compile_plan_cpu_kernel_impl);
+REGISTER_DISPATCH(grid_sampler_2d_apply_plan_cpu_kernel, &grid_sampler_2d_apply_plan_cpu_kernel_impl);
 
 
 }}  // namespace at::native
@@ -12,7 +12,12 @@ namespace at { namespace native {
 
 using forward_2d_fn = Tensor(*)(const Tensor &, const Tensor &, int64_t, int64_t, bool);
 using backward_2d_fn = std::tuple<Tensor, Tensor>(*)(const Tensor &, const Tensor &, const Tensor &, int64_t, int64_t, bool);
+// See NOTE [ Grid sample plans ] in GridSamplerKernel.cpp.
+using compile_plan_2d_fn = std::tuple<Tensor, Tensor>(*)(const Tensor &, int64_t, int64_t, int64_t, int64_t, bool);
+using apply_plan_2d_fn = Tensor(*)(const Tensor &, const Tensor &, const Tensor &);
 DECLARE_DISPATCH(forward_2d_fn, grid_sampler_2d_cpu_kernel);
 DECLARE_DISPATCH(backward_2d_fn, grid_sampler_2d_backward_cpu_kernel);
+DECLARE_DISPATCH(compile_plan_2d_fn, grid_sampler_2d_compile_plan_cpu_kernel);
+DECLARE_DISPATCH(apply_plan_2d_fn, grid_sampler_2d_apply_plan_cpu_kernel);
 
 }}  // namespace at::native
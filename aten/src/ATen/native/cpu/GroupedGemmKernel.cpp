@@ -0,0 +1,94 @@
+#include <ATen/ATen.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+#include <ATen/native/cpu/GroupedGemmKernel.h>
+
+namespace at { namespace native {
+
+namespace {
+
+// Computes one output row at a time as sum_k A[i,k] * B[k,:], accumulating a
+// column block in vector registers, and applies the optional bias-add and
+// relu epilogue while the block is still in registers. Batch items of self
+// and mat2 must be contiguous; the batch strides may be zero (broadcast).
+template <typename scalar_t>
+void grouped_gemm_impl(
+    Tensor& result,
+    const Tensor& self,
+    const Tensor& mat2,
+    const Tensor& bias,
+    bool relu) {
+  using Vec = Vec256<scalar_t>;
+  int64_t bs = result.size(0);
+  int64_t is = result.size(1);
+  int64_t js = result.size(2);
+  int64_t ks = self.size(2);
+
+  const scalar_t* a_data = self.data_ptr<scalar_t>();
+  const scalar_t* b_data = mat2.data_ptr<scalar_t>();
+  const scalar_t* bias_data = bias.defined() ? bias.data_ptr<scalar_t>() : nullptr;
+  scalar_t* r_data = result.data_ptr<scalar_t>();
+  int64_t a_batch_stride = self.stride(0);
+  int64_t b_batch_stride = mat2.stride(0);
+
+  const Vec zero_vec(scalar_t(0));
+  int64_t grain_size = std::max(
+      internal::GRAIN_SIZE / std::max(is * js * ks, (int64_t)1), (int64_t)1);
+  parallel_for(0, bs, grain_size, [&](int64_t b_begin, int64_t b_end) {
+    for (int64_t b = b_begin; b < b_end; b++) {
+      const scalar_t* A = a_data + b * a_batch_stride;
+      const scalar_t* B = b_data + b * b_batch_stride;
+      scalar_t* R = r_data + b * is * js;
+      for (int64_t i = 0; i < is; i++) {
+        const scalar_t* a_row = A + i * ks;
+        scalar_t* r_row = R + i * js;
+        int64_t d = 0;
+        for (; d < js - (js % Vec::size()); d += Vec::size()) {
+          Vec acc(scalar_t(0));
+          for (int64_t k = 0; k < ks; k++) {
+            acc = vec256::fmadd(Vec(a_row[k]), Vec::loadu(B + k * js + d), acc);
+          }
+          if (bias_data) {
+            acc = acc + Vec::loadu(bias_data + d);
+          }
+          if (relu) {
+            acc = vec256::maximum(acc, zero_vec);
+          }
+          acc.store(r_row + d);
+        }
+        if (js - d > 0) {
+          Vec acc(scalar_t(0));
+          for (int64_t k = 0; k < ks; k++) {
+            acc = vec256::fmadd(
+                Vec(a_row[k]), Vec::loadu(B + k * js + d, js - d), acc);
+          }
+          if (bias_data) {
+            acc = acc + Vec::loadu(bias_data + d, js - d);
+          }
+          if (relu) {
+            acc = vec256::maximum(acc, zero_vec);
+          }
+          acc.store(r_row + d, js - d);
+        }
+      }
+    }
+  });
+}
+
+void grouped_gemm_kernel(
+    Tensor& result,
+    const Tensor& self,
+    const Tensor& mat2,
+    const Tensor& bias,
+    bool relu) {
+  AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "_grouped_mm", [&] {
+    grouped_gemm_impl<scalar_t>(result, self, mat2, bias, relu);
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(grouped_gemm_stub, &grouped_gemm_kernel);
+
+}}  // namespace at::native
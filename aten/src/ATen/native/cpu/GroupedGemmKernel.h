@@ -0,0 +1,11 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at { namespace native {
+
+using grouped_gemm_fn = void(*)(Tensor&, const Tensor&, const Tensor&, const Tensor&, bool);
+DECLARE_DISPATCH(grouped_gemm_fn, grouped_gemm_stub);
+
+}}  // namespace at::native
@@ -0,0 +1,128 @@
+#include <ATen/native/SummaryOps.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/functional.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace at { namespace native {
+namespace {
+
+using namespace vec256;
+
+// Computes the minimum and maximum of `data` in a single vectorized pass.
+template <typename scalar_t>
+std::pair<scalar_t, scalar_t> vec_minmax(const scalar_t* data, int64_t size) {
+  using Vec = Vec256<scalar_t>;
+  scalar_t min_val = data[0];
+  scalar_t max_val = data[0];
+  int64_t d = 0;
+  if (size >= Vec::size()) {
+    Vec min_vec = Vec::loadu(data);
+    Vec max_vec = min_vec;
+    for (d = Vec::size(); d + Vec::size() <= size; d += Vec::size()) {
+      Vec data_vec = Vec::loadu(data + d);
+      min_vec = vec256::minimum(min_vec, data_vec);
+      max_vec = vec256::maximum(max_vec, data_vec);
+    }
+    min_val = vec_reduce_all<scalar_t>(
+        [](Vec& x, Vec& y) { return vec256::minimum(x, y); },
+        min_vec,
+        Vec::size());
+    max_val = vec_reduce_all<scalar_t>(
+        [](Vec& x, Vec& y) { return vec256::maximum(x, y); },
+        max_vec,
+        Vec::size());
+  }
+  for (; d < size; d++) {
+    min_val = std::min(min_val, data[d]);
+    max_val = std::max(max_val, data[d]);
+  }
+  return {min_val, max_val};
+}
+
+template <typename scalar_t>
+void histogram_observe_kernel_impl(
+    Tensor& hist,
+    Tensor& out_min,
+    Tensor& out_max,
+    const Tensor& self,
+    int64_t bins,
+    double min,
+    double max) {
+  const scalar_t* self_data = self.data_ptr<scalar_t>();
+  const int64_t numel = self.numel();
+
+  scalar_t min_val = static_cast<scalar_t>(min);
+  scalar_t max_val = static_cast<scalar_t>(max);
+  if (min_val == max_val) {
+    std::pair<scalar_t, scalar_t> result = at::parallel_reduce(
+        0,
+        numel,
+        internal::GRAIN_SIZE,
+        std::make_pair(self_data[0], self_data[0]),
+        [&](int64_t start, int64_t end, std::pair<scalar_t, scalar_t> /* unused */)
+            -> std::pair<scalar_t, scalar_t> {
+          return vec_minmax(self_data + start, end - start);
+        },
+        [](std::pair<scalar_t, scalar_t> a, std::pair<scalar_t, scalar_t> b) {
+          return std::make_pair(
+              std::min(a.first, b.first), std::max(a.second, b.second));
+        });
+    min_val = result.first;
+    max_val = result.second;
+  }
+  // Matches histc: a degenerate range (e.g. a constant tensor) is widened
+  // so every element lands in a valid bin.
+  if (min_val == max_val) {
+    min_val = min_val - 1;
+    max_val = max_val + 1;
+  }
+  out_min.fill_(min_val);
+  out_max.fill_(max_val);
+
+  scalar_t* hist_data = hist.data_ptr<scalar_t>();
+  const scalar_t bin_scale =
+      static_cast<scalar_t>(bins) / (max_val - min_val);
+  std::mutex merge_mutex;
+  at::parallel_for(0, numel, internal::GRAIN_SIZE, [&](int64_t start, int64_t end) {
+    std::vector<scalar_t> local_hist(bins, 0);
+    for (int64_t i = start; i < end; i++) {
+      const scalar_t val = self_data[i];
+      if (val >= min_val && val <= max_val) {
+        const int64_t bin = std::min(
+            static_cast<int64_t>((val - min_val) * bin_scale), bins - 1);
+        local_hist[bin] += 1;
+      }
+    }
+    std::lock_guard<std::mutex> guard(merge_mutex);
+    for (int64_t b = 0; b < bins; b++) {
+      hist_data[b] += local_hist[b];
+    }
+  });
+}
+
+void histogram_observe_kernel(
+    Tensor& hist,
+    Tensor& out_min,
+    Tensor& out_max,
+    const Tensor& self,
+    int64_t bins,
+    double min,
+    double max) {
+  AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "histogram_observe", [&]() {
+    histogram_observe_kernel_impl<scalar_t>(
+        hist, out_min, out_max, self, bins, min, max);
+  });
+}
+
+} // namespace
+
+REGISTER_DISPATCH(histogram_observe_stub, &histogram_observe_kernel);
+
+}} // namespace at::native
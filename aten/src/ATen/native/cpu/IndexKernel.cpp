@@ -58,9 +58,14 @@ static bool is_constant_index(int ntensor, const int64_t* strides) {
   return true;
 }
 
-template <typename scalar_t, typename func_t>
-void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
-                      const func_t& f, bool serial_execution=false)
+// Analogous to cpu_kernel_vec in Loops.h: `f` handles one element, `vf`
+// handles a run of `n` unit-stride elements sharing one index offset and is
+// where the Vec256 code lives.  The vectorized path only fires in the
+// constant index specialization, since that is the only case where both
+// operands are known to be contiguous runs.
+template <typename scalar_t, typename func_t, typename vec_func_t>
+void cpu_index_kernel_vec(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
+                          const func_t& f, const vec_func_t& vf, bool serial_execution=false)
 {
   int ntensor = iter.ntensors();
   // When launch the index parallel version, set a relative samll grain size less than the INTERNAL::GRAIN_SIZE
@@ -75,9 +80,7 @@ void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
       // specialization for when every element uses the same index
       int64_t offset = indexer.get(0);
       if (strides[0] == sizeof(scalar_t) && strides[1] == sizeof(scalar_t)) {
-        for (int64_t i = 0; i < n; i++) {
-          f(dst + strides[0] * i, src + strides[1] * i, offset);
-        }
+        vf(dst, src, offset, n);
       } else {
         for (int64_t i = 0; i < n; i++) {
           f(dst + strides[0] * i, src + strides[1] * i, offset);
@@ -97,11 +100,34 @@ void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
   }
 }
 
+template <typename scalar_t, typename func_t>
+void cpu_index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride,
+                      const func_t& f, bool serial_execution=false)
+{
+  cpu_index_kernel_vec<scalar_t>(iter, index_size, index_stride, f,
+    [&f](char* dst, char* src, int64_t offset, int64_t n) {
+      for (int64_t i = 0; i < n; i++) {
+        f(dst + sizeof(scalar_t) * i, src + sizeof(scalar_t) * i, offset);
+      }
+    }, serial_execution);
+}
+
 void index_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef index_stride) {
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(at::ScalarType::Half, at::ScalarType::Bool, at::ScalarType::BFloat16,
     iter.dtype(), "index_cpu", [&] {
-    cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+    cpu_index_kernel_vec<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
       *(scalar_t*)dst = *(scalar_t*)(src + offset);
+    }, [](char* dst, char* src, int64_t offset, int64_t n) {
+      using Vec = Vec256<scalar_t>;
+      scalar_t* dst_ = (scalar_t*)dst;
+      scalar_t* src_ = (scalar_t*)(src + offset);
+      int64_t i = 0;
+      for (; i <= n - Vec::size(); i += Vec::size()) {
+        Vec::loadu(src_ + i).store(dst_ + i);
+      }
+      for (; i < n; i++) {
+        dst_[i] = src_[i];
+      }
     });
   });
 }
@@ -116,16 +142,45 @@ void index_put_kernel(TensorIterator& iter, IntArrayRef index_size, IntArrayRef
         cpu_index_kernel<float>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
           cpu_atomic_add_float((float*)(dst + offset), *(float*)src);
         });
+      } else if (iter.dtype() == at::ScalarType::Double && use_parallel_for) {
+        cpu_index_kernel<double>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+          cpu_atomic_add_double((double*)(dst + offset), *(double*)src);
+        });
       } else {
-        // TODO: investigate parallelization of the accumulate kernel. Unlike the non-accumulate case,
-        // this needs to be thread-safe.
-        cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+        // TODO: investigate parallelization of the accumulate kernel for the
+        // remaining dtypes. Unlike the non-accumulate case, this needs to be
+        // thread-safe. Constant index runs are still vectorized: within one
+        // run the destination addresses are distinct, so a plain vector add
+        // is safe under serial execution.
+        cpu_index_kernel_vec<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
           *(scalar_t*)(dst + offset) += *(scalar_t*)src;
+        }, [](char* dst, char* src, int64_t offset, int64_t n) {
+          using Vec = Vec256<scalar_t>;
+          scalar_t* dst_ = (scalar_t*)(dst + offset);
+          scalar_t* src_ = (scalar_t*)src;
+          int64_t i = 0;
+          for (; i <= n - Vec::size(); i += Vec::size()) {
+            (Vec::loadu(dst_ + i) + Vec::loadu(src_ + i)).store(dst_ + i);
+          }
+          for (; i < n; i++) {
+            dst_[i] += src_[i];
+          }
         }, /*serial_execution=*/true);
       }
     } else {
-      cpu_index_kernel<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
+      cpu_index_kernel_vec<scalar_t>(iter, index_size, index_stride, [](char* dst, char* src, int64_t offset) {
         *(scalar_t*)(dst + offset) = *(scalar_t*)src;
+      }, [](char* dst, char* src, int64_t offset, int64_t n) {
+        using Vec = Vec256<scalar_t>;
+        scalar_t* dst_ = (scalar_t*)(dst + offset);
+        scalar_t* src_ = (scalar_t*)src;
+        int64_t i = 0;
+        for (; i <= n - Vec::size(); i += Vec::size()) {
+          Vec::loadu(src_ + i).store(dst_ + i);
+        }
+        for (; i < n; i++) {
+          dst_[i] = src_[i];
+        }
       });
     }
   });
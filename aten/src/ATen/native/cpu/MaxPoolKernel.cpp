@@ -0,0 +1,200 @@
+#include <ATen/ATen.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/native/cpu/MaxPoolKernel.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+namespace at { namespace native {
+
+namespace {
+
+// Channels-last (NHWC) max pooling. Channels are innermost and contiguous,
+// so each kernel-window step loads one contiguous row of C values; the max
+// and its comparison mask are computed Vec256-wide and only lanes whose max
+// actually changed update their (scalar) index slot. Indices hold the same
+// h * iW + w spatial offsets as the NCHW kernel in DilatedMaxPool2d.cpp, so
+// the two layouts stay interchangeable for unpooling and backward.
+template <typename scalar_t>
+void max_pool2d_channels_last_frame(
+    scalar_t* input_data,
+    scalar_t* output_data,
+    int64_t* indices_data,
+    int64_t nbatch,
+    int64_t channels,
+    int64_t iW,
+    int64_t iH,
+    int64_t oW,
+    int64_t oH,
+    int kW,
+    int kH,
+    int dW,
+    int dH,
+    int padW,
+    int padH,
+    int dilationW,
+    int dilationH) {
+  using Vec = vec256::Vec256<scalar_t>;
+  constexpr int64_t kVecSize = Vec::size();
+  constexpr int kFullMask = (1 << kVecSize) - 1;
+
+  at::parallel_for(0, nbatch * oH, 0, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      const int64_t n = i / oH;
+      const int64_t oh = i % oH;
+      scalar_t* input_n = input_data + n * iH * iW * channels;
+      for (int64_t ow = 0; ow < oW; ow++) {
+        int64_t hstart = oh * dH - padH;
+        int64_t wstart = ow * dW - padW;
+        const int64_t hend =
+            std::min(hstart + (kH - 1) * dilationH + 1, iH);
+        const int64_t wend =
+            std::min(wstart + (kW - 1) * dilationW + 1, iW);
+        while (hstart < 0)
+          hstart += dilationH;
+        while (wstart < 0)
+          wstart += dilationW;
+
+        scalar_t* out =
+            output_data + ((n * oH + oh) * oW + ow) * channels;
+        int64_t* ind =
+            indices_data + ((n * oH + oh) * oW + ow) * channels;
+
+        int64_t c = 0;
+        for (; c + kVecSize <= channels; c += kVecSize) {
+          Vec maxvec(-std::numeric_limits<scalar_t>::infinity());
+          int64_t ind_buf[kVecSize];
+          for (int64_t l = 0; l < kVecSize; l++) {
+            ind_buf[l] = hstart * iW + wstart;
+          }
+          for (int64_t y = hstart; y < hend; y += dilationH) {
+            for (int64_t x = wstart; x < wend; x += dilationW) {
+              const Vec val =
+                  Vec::loadu(input_n + (y * iW + x) * channels + c);
+              // update where val is greater or NaN, like the NCHW kernel
+              const Vec mask = (val > maxvec) | (val != val);
+              // zero_mask marks the lanes whose max did not change
+              const int unchanged = mask.zero_mask();
+              if (unchanged != kFullMask) {
+                maxvec = Vec::blendv(maxvec, val, mask);
+                const int64_t index = y * iW + x;
+                for (int64_t l = 0; l < kVecSize; l++) {
+                  if (!(unchanged & (1 << l))) {
+                    ind_buf[l] = index;
+                  }
+                }
+              }
+            }
+          }
+          maxvec.store(out + c);
+          for (int64_t l = 0; l < kVecSize; l++) {
+            ind[c + l] = ind_buf[l];
+          }
+        }
+        // channel tail
+        for (; c < channels; c++) {
+          int64_t maxindex = hstart * iW + wstart;
+          scalar_t maxval = -std::numeric_limits<scalar_t>::infinity();
+          for (int64_t y = hstart; y < hend; y += dilationH) {
+            for (int64_t x = wstart; x < wend; x += dilationW) {
+              const scalar_t val = input_n[(y * iW + x) * channels + c];
+              if ((val > maxval) || std::isnan(val)) {
+                maxval = val;
+                maxindex = y * iW + x;
+              }
+            }
+          }
+          out[c] = maxval;
+          ind[c] = maxindex;
+        }
+      }
+    }
+  });
+}
+
+void max_pool2d_channels_last_kernel_impl(
+    const Tensor& output,
+    const Tensor& indices,
+    const Tensor& input,
+    int kW,
+    int kH,
+    int dW,
+    int dH,
+    int padW,
+    int padH,
+    int dilationW,
+    int dilationH) {
+  const int64_t nbatch = input.size(0);
+  const int64_t channels = input.size(1);
+  const int64_t iH = input.size(2);
+  const int64_t iW = input.size(3);
+  const int64_t oH = output.size(2);
+  const int64_t oW = output.size(3);
+
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(),
+    "max_pool2d_channels_last_cpu",
+    [&] {
+      max_pool2d_channels_last_frame<scalar_t>(
+        input.data_ptr<scalar_t>(),
+        output.data_ptr<scalar_t>(),
+        indices.data_ptr<int64_t>(),
+        nbatch, channels,
+        iW, iH, oW, oH,
+        kW, kH, dW, dH,
+        padW, padH,
+        dilationW, dilationH);
+    });
+}
+
+// Backward routes each gradOutput value to its recorded max location. The
+// destinations scatter across spatial positions, so the channel loop stays
+// scalar, but the reads are contiguous across C and batches parallelize
+// without atomics (each n owns its gradInput image).
+void max_pool2d_backward_channels_last_kernel_impl(
+    const Tensor& grad_input,
+    const Tensor& grad_output,
+    const Tensor& indices) {
+  const int64_t nbatch = grad_input.size(0);
+  const int64_t channels = grad_input.size(1);
+  const int64_t iH = grad_input.size(2);
+  const int64_t iW = grad_input.size(3);
+  const int64_t oH = grad_output.size(2);
+  const int64_t oW = grad_output.size(3);
+
+  AT_DISPATCH_FLOATING_TYPES(grad_input.scalar_type(),
+    "max_pool2d_backward_channels_last_cpu",
+    [&] {
+      scalar_t* grad_input_data = grad_input.data_ptr<scalar_t>();
+      scalar_t* grad_output_data = grad_output.data_ptr<scalar_t>();
+      int64_t* indices_data = indices.data_ptr<int64_t>();
+
+      at::parallel_for(0, nbatch, 0, [&](int64_t begin, int64_t end) {
+        for (int64_t n = begin; n < end; n++) {
+          scalar_t* grad_input_n = grad_input_data + n * iH * iW * channels;
+          scalar_t* grad_output_n =
+              grad_output_data + n * oH * oW * channels;
+          int64_t* indices_n = indices_data + n * oH * oW * channels;
+          for (int64_t p = 0; p < oH * oW; p++) {
+            for (int64_t c = 0; c < channels; c++) {
+              const int64_t maxp = indices_n[p * channels + c];
+              if (maxp != -1) {
+                grad_input_n[maxp * channels + c] +=
+                    grad_output_n[p * channels + c];
+              }
+            }
+          }
+        }
+      });
+    });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(
+    max_pool2d_channels_last_stub,
+    &max_pool2d_channels_last_kernel_impl);
+REGISTER_DISPATCH(
+    max_pool2d_backward_channels_last_stub,
+    &max_pool2d_backward_channels_last_kernel_impl);
+
+}} // namespace at::native
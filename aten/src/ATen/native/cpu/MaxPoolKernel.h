@@ -0,0 +1,21 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at { namespace native {
+
+using max_pool2d_channels_last_fn = void(*)(
+    const Tensor& output, const Tensor& indices, const Tensor& input,
+    int kW, int kH, int dW, int dH, int padW, int padH,
+    int dilationW, int dilationH);
+DECLARE_DISPATCH(max_pool2d_channels_last_fn, max_pool2d_channels_last_stub);
+
+using max_pool2d_backward_channels_last_fn = void(*)(
+    const Tensor& grad_input, const Tensor& grad_output,
+    const Tensor& indices);
+DECLARE_DISPATCH(
+    max_pool2d_backward_channels_last_fn,
+    max_pool2d_backward_channels_last_stub);
+
+}}  // namespace at::native
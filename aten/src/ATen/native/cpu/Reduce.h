@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ATen/native/cpu/Loops.h>
+#include <ATen/Context.h>
 #include <ATen/Parallel.h>
 #include <c10/util/TypeList.h>
 
@@ -221,6 +222,38 @@ void binary_kernel_reduce(TensorIterator& iter, ops_t ops, init_t init) {
     if (numel < at::internal::GRAIN_SIZE || at::get_num_threads() == 1 ||
         at::in_parallel_region()) {
       total_acc = reduction_body(total_acc, 0, numel);
+    } else if (at::globalContext().deterministicCPUReduction()) {
+      // NOTE [ Deterministic parallel reduction ]
+      //
+      // The default parallel path accumulates into one buffer slot per
+      // thread, so which input ranges meet in which accumulator depends on
+      // how the scheduler hands out chunks - floating point results vary
+      // from run to run with the thread count and timing. In deterministic
+      // mode every chunk of GRAIN_SIZE elements is reduced on its own from
+      // the identity into a fixed slot, and the per-chunk results are
+      // combined in a canonical pairwise tree, so the combination order is
+      // a function of numel alone no matter how many threads ran.
+      static_assert(
+        !std::is_same<acc_t, bool>::value,
+        "Concurrently modifying different references into std::vector<bool> is UB."
+      );
+      int64_t num_chunks = divup(numel, internal::GRAIN_SIZE);
+      std::vector<acc_t> buffer((unsigned)num_chunks, init);
+      at::parallel_for(0, num_chunks, 1,
+        [&](int64_t begin, int64_t end) {
+          for (int64_t i = begin; i < end; ++i) {
+            int64_t chunk_begin = i * internal::GRAIN_SIZE;
+            int64_t chunk_end = std::min(chunk_begin + internal::GRAIN_SIZE, numel);
+            buffer[i] = reduction_body(init, chunk_begin, chunk_end);
+          }
+        }
+      );
+      for (int64_t width = 1; width < num_chunks; width *= 2) {
+        for (int64_t i = 0; i + width < num_chunks; i += 2 * width) {
+          buffer[i] = ops.combine(buffer[i], buffer[i + width]);
+        }
+      }
+      total_acc = ops.combine(total_acc, buffer[0]);
     } else {
       int max_threads = at::get_num_threads();
       AT_ASSERT(max_threads > 0);
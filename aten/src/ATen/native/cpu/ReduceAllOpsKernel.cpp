@@ -58,6 +58,57 @@ inline void reduce_all_impl(
   output.fill_(result);
 }
 
+// Fused two-output reduction (e.g. min+max), reading the input once.
+template <typename scalar_t, typename func_t1, typename func_t2>
+inline void reduce_all_impl_two_outputs(
+    Tensor& output1,
+    Tensor& output2,
+    const Tensor& input,
+    const std::pair<scalar_t, scalar_t>& ident_v,
+    func_t1 reduce_chunk_func,
+    func_t2 reduce_acc_func) {
+  using scalar_t_pair = std::pair<scalar_t, scalar_t>;
+  const int64_t input_numel = input.numel();
+  auto input_data = input.data_ptr<scalar_t>();
+  scalar_t_pair result = at::parallel_reduce(0, input_numel, internal::GRAIN_SIZE, ident_v,
+    [&](int64_t start, int64_t end, const scalar_t_pair& ident) -> scalar_t_pair {
+      scalar_t_pair partial_out(ident);
+      for (int64_t i = start; i < end; i++) {
+         partial_out = reduce_chunk_func(partial_out, input_data[i]);
+      }
+      return partial_out;
+    }, reduce_acc_func);
+  output1.fill_(result.first);
+  output2.fill_(result.second);
+}
+
+template <typename scalar_t, typename func_t, typename vec_func_t1, typename vec_func_t2>
+inline void reduce_all_impl_vec_two_outputs(
+    Tensor& output1,
+    Tensor& output2,
+    const Tensor& input,
+    const std::pair<scalar_t, scalar_t>& ident_v,
+    func_t reduce_acc_func,
+    vec_func_t1 reduce_chunk_func1,
+    vec_func_t2 reduce_chunk_func2) {
+  using Vec = Vec256<scalar_t>;
+  using scalar_t_pair = std::pair<scalar_t, scalar_t>;
+  const int64_t input_numel = input.numel();
+  auto input_data = input.data_ptr<scalar_t>();
+  // NOTE: parallel_reduce not support bool type
+  scalar_t_pair result = at::parallel_reduce(0, input_numel, internal::GRAIN_SIZE, ident_v,
+    [&](int64_t start, int64_t end, const scalar_t_pair& /* ident */) -> scalar_t_pair {
+      scalar_t_pair partial_out = vec256::reduce2_all<scalar_t>(
+        [=](Vec x, Vec y) { return reduce_chunk_func1(x, y); },
+        [=](Vec x, Vec y) { return reduce_chunk_func2(x, y); },
+        input_data + start,
+        end - start);
+      return partial_out;
+    }, reduce_acc_func);
+  output1.fill_(result.first);
+  output2.fill_(result.second);
+}
+
 static void min_all_kernel_impl(Tensor& result, const Tensor& input) {
   if (input.scalar_type() == ScalarType::Bool) {
     TensorIterator iter = TensorIterator();
@@ -108,9 +159,47 @@ static void max_all_kernel_impl(Tensor& result, const Tensor& input) {
   }
 }
 
+static void min_max_all_kernel_impl(Tensor& min_result, Tensor& max_result,
+    const Tensor& input) {
+  if (input.scalar_type() == ScalarType::Long) {
+    // for int64_t, vectorized implementation have performance issue,
+    // just use scalar path
+    using int64_t_pair = std::pair<int64_t, int64_t>;
+    reduce_all_impl_two_outputs<int64_t>(min_result, max_result, input,
+      int64_t_pair(upper_bound<int64_t>(), lower_bound<int64_t>()),
+      // reduce over chunk
+      [=](int64_t_pair a, int64_t b) -> int64_t_pair {
+        return int64_t_pair(min_impl(a.first, b), max_impl(a.second, b));
+      },
+      // combine two inputs
+      [=](int64_t_pair a, int64_t_pair b) -> int64_t_pair {
+        return int64_t_pair(min_impl(a.first, b.first), max_impl(a.second, b.second));
+      }
+    );
+  } else {
+    AT_DISPATCH_ALL_TYPES(input.scalar_type(), "aminmax_all", [&] {
+      using Vec = vec256::Vec256<scalar_t>;
+      using scalar_t_pair = std::pair<scalar_t, scalar_t>;
+      reduce_all_impl_vec_two_outputs<scalar_t>(
+        min_result,
+        max_result,
+        input,
+        scalar_t_pair(upper_bound<scalar_t>(), lower_bound<scalar_t>()),
+        [=] (scalar_t_pair a , scalar_t_pair b) -> scalar_t_pair {
+          return scalar_t_pair(
+            min_impl(a.first, b.first), max_impl(a.second, b.second));
+        },
+        [=](Vec a, Vec b) -> Vec { return minimum(a, b); },
+        [=](Vec a, Vec b) -> Vec { return maximum(a, b); }
+      );
+    });
+  }
+}
+
 } // namespace
 
 REGISTER_DISPATCH(min_all_stub, &min_all_kernel_impl);
 REGISTER_DISPATCH(max_all_stub, &max_all_kernel_impl);
+REGISTER_DISPATCH(aminmax_all_stub, &min_max_all_kernel_impl);
 
 }}
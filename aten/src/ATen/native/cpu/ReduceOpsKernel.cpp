@@ -135,6 +135,16 @@ static void std_var_kernel_impl(TensorIterator &iter, bool unbiased, bool take_s
   });
 }
 
+static void min_max_kernel_impl(TensorIterator& iter) {
+  AT_DISPATCH_ALL_TYPES(iter.dtype(), "_aminmax_cpu", [&] {
+    binary_kernel_reduce(
+      iter,
+      MinMaxOps<scalar_t, scalar_t, int64_t>{},
+      std::pair<scalar_t, scalar_t>(upper_bound<scalar_t>(), lower_bound<scalar_t>())
+    );
+  });
+}
+
 static void prod_kernel_impl(TensorIterator& iter) {
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX(iter.dtype(), "prod_cpu", [&] {
     binary_kernel_reduce_vec(
@@ -287,6 +297,7 @@ static void argmin_kernel_impl(TensorIterator &iter) {
 
 REGISTER_DISPATCH(sum_stub, &sum_kernel_impl);
 REGISTER_DISPATCH(std_var_stub, &std_var_kernel_impl);
+REGISTER_DISPATCH(aminmax_stub, &min_max_kernel_impl);
 REGISTER_DISPATCH(prod_stub, &prod_kernel_impl);
 REGISTER_DISPATCH(mean_stub, &mean_kernel_impl);
 REGISTER_DISPATCH(norm_stub, &norm_kernel_tensor_iterator_impl);
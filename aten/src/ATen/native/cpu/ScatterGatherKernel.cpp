@@ -3,6 +3,8 @@
 #include <ATen/native/TensorIterator.h>
 #include <ATen/Parallel.h>
 
+#include <cstring>
+
 namespace at { namespace native {
 
 namespace {
@@ -166,6 +168,46 @@ void gather_cpu_kernel(Tensor& result, const Tensor& self, int64_t dim, const Te
       const auto* index_data, auto index_dim_stride,
       const auto* self_data, auto self_dim_stride
     ) {
+      using scalar_t = typename std::remove_pointer<decltype(result_data)>::type;
+      // Fast path for unit strides along `dim`: stretches of consecutive
+      // indices (common for sorted indices from graph workloads) collapse
+      // into block copies, and the traversal of `dim` is split across
+      // threads. When already inside a parallel region (the outer iterator
+      // parallelizes over the remaining dims), parallel_for runs inline.
+      if (result_dim_stride == 1 && index_dim_stride == 1 &&
+          self_dim_stride == 1) {
+        at::parallel_for(0, index_dim_size, internal::GRAIN_SIZE,
+          [&](int64_t begin, int64_t end) {
+            int64_t i = begin;
+            while (i < end) {
+              int64_t idx_dim = index_data[i];
+              // we are not putting idx_dim in the error message because it
+              // disables loop optimization in clang-7
+              TORCH_CHECK(idx_dim >= 0 && idx_dim < self_dim_size,
+                          "index ", index_data[i], " is out of bounds for dimension ", dim,
+                          " with size ", self_dim_size);
+              // extend the run while the indices stay consecutive; every
+              // index in the run is bounded by the check below
+              int64_t run_end = i + 1;
+              while (run_end < end && index_data[run_end] == idx_dim + (run_end - i)) {
+                ++run_end;
+              }
+              int64_t run_length = run_end - i;
+              TORCH_CHECK(idx_dim + run_length <= self_dim_size,
+                          "index ", index_data[run_end - 1], " is out of bounds for dimension ", dim,
+                          " with size ", self_dim_size);
+              if (run_length == 1) {
+                result_data[i] = self_data[idx_dim];
+              } else {
+                std::memcpy(result_data + i, self_data + idx_dim,
+                            run_length * sizeof(scalar_t));
+              }
+              i = run_end;
+            }
+          }
+        );
+        return;
+      }
       for (int64_t i = 0; i < index_dim_size; ++i) {
         int64_t idx_dim = index_data[i * index_dim_stride];
         // we are not putting idx_dim in the error message because it disables
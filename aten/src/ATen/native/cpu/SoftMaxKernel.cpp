@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <numeric>
+#include <vector>
 
 #include <ATen/Dispatch.h>
 #include <ATen/Parallel.h>
@@ -92,6 +94,130 @@ inline void _vec_log_softmax_lastdim(
       });
 }
 
+// exp of one scalar through the vector unit; plain std::exp is off limits
+// here, see [Note AVX-SSE transitions]
+template <typename scalar_t>
+inline scalar_t _vec_exp_scalar(scalar_t x) {
+  using Vec = vec256::Vec256<scalar_t>;
+  scalar_t result[Vec::size()];
+  Vec(x).exp().store(result);
+  return result[0];
+}
+
+// Online (single-pass) softmax statistics: one traversal of the data keeps a
+// running vector maximum and a running sum of exponentials that is rescaled
+// by exp(old_max - new_max) whenever the maximum grows, so max and sum come
+// out of the same sweep instead of two.
+template <typename scalar_t>
+inline void _vec_online_max_sum(
+    const scalar_t* data,
+    int64_t size,
+    scalar_t& max,
+    scalar_t& sum) {
+  using Vec = vec256::Vec256<scalar_t>;
+  max = -std::numeric_limits<scalar_t>::infinity();
+  sum = 0;
+  int64_t d = size - size % Vec::size();
+  if (d > 0) {
+    Vec max_vec = Vec::loadu(data);
+    Vec sum_vec = Vec(static_cast<scalar_t>(1));
+    for (int64_t i = Vec::size(); i < d; i += Vec::size()) {
+      Vec v = Vec::loadu(data + i);
+      Vec new_max = vec256::maximum(max_vec, v);
+      sum_vec = sum_vec * (max_vec - new_max).exp() + (v - new_max).exp();
+      max_vec = new_max;
+    }
+    max = vec256::vec_reduce_all<scalar_t>(
+        [](Vec& x, Vec& y) { return vec256::maximum(x, y); },
+        max_vec,
+        Vec::size());
+    sum = vec256::vec_reduce_all<scalar_t>(
+        [](Vec& x, Vec& y) { return x + y; },
+        sum_vec * (max_vec - Vec(max)).exp(),
+        Vec::size());
+  }
+  for (int64_t i = d; i < size; ++i) {
+    scalar_t x = data[i];
+    if (x > max) {
+      sum *= _vec_exp_scalar(max - x);
+      max = x;
+    }
+    sum += _vec_exp_scalar(x - max);
+  }
+}
+
+// Intra-row parallel softmax for shapes with too few rows to occupy the
+// thread pool (e.g. attention over [batch*heads, 16k] on a many-core host).
+// Each row is split into chunks; chunks are reduced in parallel with the
+// online update above, the per-chunk (max, sum) pairs are merged per row
+// with the same rescaling rule, and a second parallel sweep normalizes.
+template <typename scalar_t>
+inline void _vec_softmax_lastdim_split(
+    scalar_t* input_data_base,
+    scalar_t* output_data_base,
+    int64_t outer_size,
+    int64_t dim_size) {
+  using Vec = vec256::Vec256<scalar_t>;
+  // per-chunk work in the same ballpark as one grain of the row-parallel
+  // path (16 is the rough computations-per-element estimate from the note
+  // on grainsize above)
+  int64_t chunk_size = std::max<int64_t>(
+      internal::GRAIN_SIZE / 16, Vec::size());
+  int64_t num_chunks = (dim_size + chunk_size - 1) / chunk_size;
+
+  std::vector<scalar_t> chunk_max(outer_size * num_chunks);
+  std::vector<scalar_t> chunk_sum(outer_size * num_chunks);
+  parallel_for(
+      0, outer_size * num_chunks, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t task = begin; task < end; ++task) {
+          int64_t row = task / num_chunks;
+          int64_t chunk = task % num_chunks;
+          scalar_t* input_data =
+              input_data_base + row * dim_size + chunk * chunk_size;
+          int64_t size = std::min(chunk_size, dim_size - chunk * chunk_size);
+          _vec_online_max_sum(
+              input_data, size, chunk_max[task], chunk_sum[task]);
+        }
+      });
+
+  // merge the chunk statistics per row; outer_size is small here, so this
+  // stays serial
+  std::vector<scalar_t> row_max(outer_size);
+  std::vector<scalar_t> row_inv_sum(outer_size);
+  for (int64_t row = 0; row < outer_size; ++row) {
+    scalar_t max = -std::numeric_limits<scalar_t>::infinity();
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      max = std::max(max, chunk_max[row * num_chunks + chunk]);
+    }
+    scalar_t sum = 0;
+    for (int64_t chunk = 0; chunk < num_chunks; ++chunk) {
+      sum += chunk_sum[row * num_chunks + chunk] *
+          _vec_exp_scalar(chunk_max[row * num_chunks + chunk] - max);
+    }
+    row_max[row] = max;
+    row_inv_sum[row] = 1 / sum;
+  }
+
+  parallel_for(
+      0, outer_size * num_chunks, 1, [&](int64_t begin, int64_t end) {
+        for (int64_t task = begin; task < end; ++task) {
+          int64_t row = task / num_chunks;
+          int64_t chunk = task % num_chunks;
+          int64_t offset = row * dim_size + chunk * chunk_size;
+          int64_t size = std::min(chunk_size, dim_size - chunk * chunk_size);
+          scalar_t max_input = row_max[row];
+          scalar_t inv_sum = row_inv_sum[row];
+          vec256::map(
+              [max_input, inv_sum](Vec x) {
+                return (x - Vec(max_input)).exp() * Vec(inv_sum);
+              },
+              output_data_base + offset,
+              input_data_base + offset,
+              size);
+        }
+      });
+}
+
 template <typename scalar_t>
 inline void _vec_softmax_lastdim(
     scalar_t* input_data_base,
@@ -99,6 +225,15 @@ inline void _vec_softmax_lastdim(
     int64_t outer_size,
     int64_t dim_size) {
   using Vec = vec256::Vec256<scalar_t>;
+  // with fewer rows than threads and rows long enough to be worth slicing,
+  // parallelize inside the rows instead of across them
+  int64_t chunk_size = std::max<int64_t>(
+      internal::GRAIN_SIZE / 16, Vec::size());
+  if (outer_size < at::get_num_threads() && dim_size >= 2 * chunk_size) {
+    _vec_softmax_lastdim_split(
+        input_data_base, output_data_base, outer_size, dim_size);
+    return;
+  }
   int64_t grain_size = internal::GRAIN_SIZE / (16 * dim_size);
   if (grain_size < 1)
     grain_size = 1;
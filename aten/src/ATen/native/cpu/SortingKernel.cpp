@@ -9,6 +9,103 @@ namespace at { namespace native {
 
 namespace {
 
+// Below this k the per-chunk selection keeps a sorted insertion buffer
+// instead of a binary heap; shifting a handful of elements is cheaper than
+// heap maintenance.
+constexpr int64_t kSmallTopK = 16;
+
+// Collects the top k of input[begin, end) into out (a caller-provided buffer
+// of capacity k); comp(x, y) == true means x ranks ahead of y. Returns the
+// number of elements written, which is < k only when the range is shorter
+// than k. The result is unordered except on the small-k path.
+template <typename scalar_t, typename comp_t>
+int64_t topk_select_chunk(
+    const TensorAccessor<scalar_t, 1>& input,
+    int64_t begin,
+    int64_t end,
+    int64_t k,
+    const comp_t& comp,
+    std::pair<scalar_t, int64_t>* out) {
+  using elem_t = std::pair<scalar_t, int64_t>;
+  int64_t size = 0;
+  if (k <= kSmallTopK) {
+    for (int64_t j = begin; j < end; j++) {
+      elem_t e(input[j], j);
+      if (size == k) {
+        if (!comp(e, out[k - 1])) {
+          continue;
+        }
+        size--;
+      }
+      int64_t pos = size++;
+      while (pos > 0 && comp(e, out[pos - 1])) {
+        out[pos] = out[pos - 1];
+        pos--;
+      }
+      out[pos] = e;
+    }
+    return size;
+  }
+  // bounded heap ordered by comp, so the worst kept element sits at out[0]
+  for (int64_t j = begin; j < end; j++) {
+    elem_t e(input[j], j);
+    if (size < k) {
+      out[size++] = e;
+      if (size == k) {
+        std::make_heap(out, out + k, comp);
+      }
+    } else if (comp(e, out[0])) {
+      std::pop_heap(out, out + k, comp);
+      out[k - 1] = e;
+      std::push_heap(out, out + k, comp);
+    }
+  }
+  return size;
+}
+
+// Parallel top-k over one long slice: each chunk reduces to at most k
+// candidates with a bounded selection, then the surviving
+// (num_chunks * k) candidates are merged serially. Unlike the serial path
+// this never materializes the full (value, index) queue.
+template <typename scalar_t, typename comp_t>
+void parallel_topk_impl(
+    const TensorAccessor<scalar_t, 1>& input,
+    TensorAccessor<scalar_t, 1> values,
+    TensorAccessor<int64_t, 1> indices,
+    int64_t k,
+    const comp_t& comp) {
+  using elem_t = std::pair<scalar_t, int64_t>;
+  const int64_t n = input.size(0);
+  const int64_t grain = std::max(static_cast<int64_t>(internal::GRAIN_SIZE), k);
+  const int64_t num_chunks = (n + grain - 1) / grain;
+  std::vector<elem_t> candidates(num_chunks * k);
+  std::vector<int64_t> counts(num_chunks);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t begin, int64_t end) {
+    for (int64_t chunk = begin; chunk < end; chunk++) {
+      counts[chunk] = topk_select_chunk(
+          input,
+          chunk * grain,
+          std::min(n, (chunk + 1) * grain),
+          k,
+          comp,
+          candidates.data() + chunk * k);
+    }
+  });
+  std::vector<elem_t> merged;
+  merged.reserve(num_chunks * k);
+  for (int64_t chunk = 0; chunk < num_chunks; chunk++) {
+    merged.insert(
+        merged.end(),
+        candidates.begin() + chunk * k,
+        candidates.begin() + chunk * k + counts[chunk]);
+  }
+  std::partial_sort(merged.begin(), merged.begin() + k, merged.end(), comp);
+  for (int64_t j = 0; j < k; j++) {
+    values[j] = merged[j].first;
+    indices[j] = merged[j].second;
+  }
+}
+
 static void topk_kernel(
     Tensor& values,
     Tensor& indices,
@@ -30,6 +127,24 @@ static void topk_kernel(
           auto use_partial_sort = k * 64 <= n;
 
           using elem_t = std::pair<scalar_t, int64_t>;
+
+          // A single long slice with a small k gets the parallel path; the
+          // merge result is always sorted, so `sorted` is satisfied for free.
+          if (k > 0 && k * 16 <= n && n >= 2 * internal::GRAIN_SIZE) {
+            if (largest) {
+              parallel_topk_impl(tmp_values, mode_values, mode_indices, k,
+                [](const elem_t& x, const elem_t& y) -> bool {
+                  return ((_isnan<scalar_t>(x.first) && !_isnan<scalar_t>(y.first)) || (x.first > y.first));
+                });
+            } else {
+              parallel_topk_impl(tmp_values, mode_values, mode_indices, k,
+                [](const elem_t& x, const elem_t& y) -> bool {
+                  return ((!_isnan<scalar_t>(x.first) && _isnan<scalar_t>(y.first)) || (x.first < y.first));
+                });
+            }
+            return;
+          }
+
           std::vector<elem_t> queue(n);
           for (int64_t j = 0; j < n; j++) {
             queue[j].first = tmp_values[j];
@@ -0,0 +1,82 @@
+#include <ATen/native/sparse/SparseTensorMath.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/vec256.h>
+
+namespace at { namespace native { namespace {
+
+template <typename scalar_t>
+void sparse_dense_mm_kernel(
+    Tensor& r,
+    const Tensor& csr,
+    const Tensor& columns,
+    const Tensor& values,
+    const Tensor& dense,
+    Scalar alpha) {
+  int64_t dim_i = r.size(0);
+  int64_t dim_k = r.size(1);
+
+  scalar_t cast_alpha = alpha.to<scalar_t>();
+  const int64_t* csr_ptr = csr.data_ptr<int64_t>();
+  const int64_t* columns_ptr = columns.data_ptr<int64_t>();
+  const scalar_t* values_ptr = values.data_ptr<scalar_t>();
+  const scalar_t* dense_ptr = dense.data_ptr<scalar_t>();
+  scalar_t* r_ptr = r.data_ptr<scalar_t>();
+
+  int64_t dense_stride0 = dense.stride(0);
+  int64_t dense_stride1 = dense.stride(1);
+  int64_t r_stride0 = r.stride(0);
+  int64_t r_stride1 = r.stride(1);
+
+  using Vec = vec256::Vec256<scalar_t>;
+  bool vectorize = dense_stride1 == 1 && r_stride1 == 1;
+
+  // Each output row is owned by exactly one task, so the nnz entries of a
+  // row can accumulate into it without synchronization.
+  int64_t grain_size = std::max(
+      internal::GRAIN_SIZE / std::max(dim_k, (int64_t)1), (int64_t)1);
+  at::parallel_for(0, dim_i, grain_size, [&](int64_t start, int64_t end) {
+    for (auto row = start; row < end; row++) {
+      scalar_t* r_row = r_ptr + row * r_stride0;
+      for (int64_t i = csr_ptr[row]; i < csr_ptr[row + 1]; i++) {
+        scalar_t val = cast_alpha * values_ptr[i];
+        const scalar_t* dense_row = dense_ptr + columns_ptr[i] * dense_stride0;
+        if (vectorize) {
+          Vec val_vec(val);
+          int64_t k = 0;
+          for (; k <= dim_k - Vec::size(); k += Vec::size()) {
+            auto out = vec256::fmadd(
+                val_vec, Vec::loadu(dense_row + k), Vec::loadu(r_row + k));
+            out.store(r_row + k);
+          }
+          for (; k < dim_k; k++) {
+            r_row[k] += val * dense_row[k];
+          }
+        } else {
+          for (int64_t k = 0; k < dim_k; k++) {
+            r_row[k * r_stride1] += val * dense_row[k * dense_stride1];
+          }
+        }
+      }
+    }
+  });
+}
+
+void sparse_dense_mm_kernel_impl(
+    Tensor& r,
+    const Tensor& csr,
+    const Tensor& columns,
+    const Tensor& values,
+    const Tensor& dense,
+    Scalar alpha) {
+  AT_DISPATCH_ALL_TYPES(values.scalar_type(), "sparse_dense_mm", [&] {
+    sparse_dense_mm_kernel<scalar_t>(r, csr, columns, values, dense, alpha);
+  });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(sparse_dense_mm_stub, &sparse_dense_mm_kernel_impl);
+
+}} // namespace at::native
@@ -0,0 +1,126 @@
+#include <ATen/native/BinaryOps.h>
+
+#include <ATen/Parallel.h>
+#include <ATen/core/PhiloxRNGEngine.h>
+#include <ATen/cpu/vec256/vec256.h>
+#include <c10/util/BFloat16.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace at { namespace native {
+namespace {
+
+// Stochastic rounding of a float to bfloat16: the low 16 bits of the float
+// representation are the fraction discarded by truncation, so adding a
+// uniform 16-bit value and truncating rounds up with exactly that fraction
+// as probability, making the rounding unbiased in expectation. NaN and Inf
+// keep the round-to-nearest result (perturbing their bits could turn Inf
+// into NaN).
+inline BFloat16 stochastic_round_bf16(float val, uint32_t rand) {
+  uint32_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  if ((bits & 0x7f800000u) == 0x7f800000u) {
+    return BFloat16(val);
+  }
+  bits += rand & 0xffffu;
+  return BFloat16(static_cast<uint16_t>(bits >> 16), BFloat16::from_bits());
+}
+
+#if defined(__AVX2__) && !defined(_MSC_VER)
+
+// Vectorized counterpart of stochastic_round_bf16 for two float vectors
+// (matching the lane layout of cvtfp32_bf16 in vec256_bfloat16.h). NaN maps
+// to 0xffff like cvtfp32_bf16; the random bias is masked off on NaN/Inf
+// lanes so Inf stays Inf.
+inline __m256i stochastic_round_fp32_bf16(
+    const __m256& a,
+    const __m256& b,
+    const __m256i& rand_lo,
+    const __m256i& rand_hi) {
+  __m256i lo = _mm256_castps_si256(a);
+  __m256i hi = _mm256_castps_si256(b);
+  const __m256i nan = _mm256_set1_epi32(0xffff);
+  const __m256i mask16 = _mm256_set1_epi32(0xffff);
+  const __m256i exp_mask = _mm256_set1_epi32(0x7f800000);
+  __m256i special_lo = _mm256_cmpeq_epi32(_mm256_and_si256(lo, exp_mask), exp_mask);
+  __m256i special_hi = _mm256_cmpeq_epi32(_mm256_and_si256(hi, exp_mask), exp_mask);
+  __m256i bias_lo = _mm256_andnot_si256(special_lo, _mm256_and_si256(rand_lo, mask16));
+  __m256i bias_hi = _mm256_andnot_si256(special_hi, _mm256_and_si256(rand_hi, mask16));
+  __m256i t_lo = _mm256_srli_epi32(_mm256_add_epi32(lo, bias_lo), 16);
+  __m256i t_hi = _mm256_srli_epi32(_mm256_add_epi32(hi, bias_hi), 16);
+  __m256i ord_lo = _mm256_castps_si256(_mm256_cmp_ps(a, a, _CMP_ORD_Q));
+  __m256i ord_hi = _mm256_castps_si256(_mm256_cmp_ps(b, b, _CMP_ORD_Q));
+  t_lo = _mm256_blendv_epi8(nan, t_lo, ord_lo);
+  t_hi = _mm256_blendv_epi8(nan, t_hi, ord_hi);
+  t_lo = _mm256_packus_epi32(t_lo, t_hi); // t_lo[0-3] t_hi[0-3] t_lo[4-7] t_hi[4-7]
+  return _mm256_permute4x64_epi64(t_lo, 0xd8); // 11 01 10 00
+}
+
+inline void load_fp32(const float* ptr, __m256& lo, __m256& hi) {
+  lo = _mm256_loadu_ps(ptr);
+  hi = _mm256_loadu_ps(ptr + 8);
+}
+
+inline void load_fp32(const BFloat16* ptr, __m256& lo, __m256& hi) {
+  __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+  vec256::cvtbf16_fp32(values, lo, hi);
+}
+
+#endif
+
+template <typename other_t>
+void stochastic_round_add_impl(Tensor& self, const Tensor& other, uint64_t seed) {
+  BFloat16* self_data = self.data_ptr<BFloat16>();
+  const other_t* other_data = other.data_ptr<other_t>();
+  const int64_t numel = self.numel();
+  // Each 16-element block draws from its own Philox subsequence so the
+  // result is independent of the parallel grain size.
+  constexpr int64_t kBlock = 16;
+  const int64_t num_blocks = (numel + kBlock - 1) / kBlock;
+  at::parallel_for(0, num_blocks, internal::GRAIN_SIZE / kBlock,
+      [&](int64_t begin, int64_t end) {
+    for (int64_t block = begin; block < end; block++) {
+      at::Philox4_32_10 engine(seed, static_cast<uint64_t>(block), 0);
+      int64_t i = block * kBlock;
+      const int64_t block_end = std::min(i + kBlock, numel);
+#if defined(__AVX2__) && !defined(_MSC_VER)
+      if (block_end - i == kBlock) {
+        alignas(32) uint32_t rand[kBlock];
+        for (auto& r : rand) {
+          r = engine();
+        }
+        __m256 a_lo, a_hi, b_lo, b_hi;
+        load_fp32(self_data + i, a_lo, a_hi);
+        load_fp32(other_data + i, b_lo, b_hi);
+        auto result = stochastic_round_fp32_bf16(
+            _mm256_add_ps(a_lo, b_lo),
+            _mm256_add_ps(a_hi, b_hi),
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(rand)),
+            _mm256_load_si256(reinterpret_cast<const __m256i*>(rand + 8)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(self_data + i), result);
+        continue;
+      }
+#endif
+      for (; i < block_end; i++) {
+        const auto sum = static_cast<float>(self_data[i]) +
+            static_cast<float>(other_data[i]);
+        self_data[i] = stochastic_round_bf16(sum, engine());
+      }
+    }
+  });
+}
+
+void stochastic_round_add_kernel(Tensor& self, const Tensor& other, uint64_t seed) {
+  if (other.scalar_type() == kFloat) {
+    stochastic_round_add_impl<float>(self, other, seed);
+  } else {
+    stochastic_round_add_impl<BFloat16>(self, other, seed);
+  }
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(stochastic_round_add_stub, &stochastic_round_add_kernel);
+
+}} // namespace at::native
@@ -102,21 +102,104 @@ static void min_kernel_impl(
   });
 }
 
+// Vectorized select shared by where and _clamp_where. The condition tensor
+// has 1-byte elements (Bool or Byte both read as nonzero uint8_t) while the
+// value tensors have sizeof(scalar_t)-byte ones, so cpu_kernel_vec cannot
+// vectorize it; instead the contiguous inner loop widens the condition bytes
+// to lane-width 0/1 values and selects branchlessly with Vec256::blendv.
+// scalar_op/vec_op apply an epilogue to the selected value (identity for
+// where, clamp for _clamp_where).
+template <typename scalar_t, typename scalar_op_t, typename vec_op_t>
+void select_kernel_vec(TensorIterator& iter, scalar_op_t scalar_op, vec_op_t vec_op) {
+  using Vec = vec256::Vec256<scalar_t>;
+  iter.for_each([&](char** data, const int64_t* strides, int64_t n) {
+    char* out_bytes = data[0];
+    const char* cond_bytes = data[1];
+    const char* self_bytes = data[2];
+    const char* other_bytes = data[3];
+    if (strides[0] == sizeof(scalar_t) && strides[1] == 1 &&
+        strides[2] == sizeof(scalar_t) && strides[3] == sizeof(scalar_t)) {
+      scalar_t* out = reinterpret_cast<scalar_t*>(out_bytes);
+      const uint8_t* cond = reinterpret_cast<const uint8_t*>(cond_bytes);
+      const scalar_t* self = reinterpret_cast<const scalar_t*>(self_bytes);
+      const scalar_t* other = reinterpret_cast<const scalar_t*>(other_bytes);
+      const Vec zero_vec(static_cast<scalar_t>(0));
+      scalar_t mask_buf[Vec::size()];
+      int64_t i = 0;
+      for (; i + Vec::size() <= n; i += Vec::size()) {
+        for (int64_t j = 0; j < Vec::size(); ++j) {
+          mask_buf[j] = static_cast<scalar_t>(cond[i + j] != 0);
+        }
+        const Vec mask_vec = Vec::loadu(mask_buf) != zero_vec;
+        const Vec self_vec = Vec::loadu(self + i);
+        const Vec other_vec = Vec::loadu(other + i);
+        vec_op(Vec::blendv(other_vec, self_vec, mask_vec)).store(out + i);
+      }
+      for (; i < n; ++i) {
+        out[i] = scalar_op(cond[i] != 0 ? self[i] : other[i]);
+      }
+    } else {
+      // broadcast (stride 0) or otherwise strided operands
+      for (int64_t i = 0; i < n; ++i) {
+        const bool cond_val =
+            *reinterpret_cast<const uint8_t*>(cond_bytes + i * strides[1]) != 0;
+        const scalar_t self_val =
+            *reinterpret_cast<const scalar_t*>(self_bytes + i * strides[2]);
+        const scalar_t other_val =
+            *reinterpret_cast<const scalar_t*>(other_bytes + i * strides[3]);
+        *reinterpret_cast<scalar_t*>(out_bytes + i * strides[0]) =
+            scalar_op(cond_val ? self_val : other_val);
+      }
+    }
+  });
+}
+
 static void where_kernel_impl(TensorIterator &iter, ScalarType condition_type) {
-  AT_DISPATCH_ALL_TYPES_AND_COMPLEX(iter.dtype(), "where_cpu", [&] {
-    if (condition_type == at::ScalarType::Byte) {
-      at::native::cpu_kernel(
+  if (isComplexType(iter.dtype())) {
+    // complex lanes have no branchless select; keep the scalar path
+    AT_DISPATCH_COMPLEX_TYPES(iter.dtype(), "where_cpu", [&] {
+      if (condition_type == at::ScalarType::Byte) {
+        at::native::cpu_kernel(
+          iter,
+          [=](uint8_t cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
+            return cond_val ? self_val : other_val;
+          });
+      } else {
+        at::native::cpu_kernel(
+          iter,
+          [=](bool cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
+            return cond_val ? self_val : other_val;
+          });
+      }
+    });
+    return;
+  }
+  AT_DISPATCH_ALL_TYPES(iter.dtype(), "where_cpu", [&] {
+    select_kernel_vec<scalar_t>(
         iter,
-        [=](uint8_t cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
-          return cond_val ? self_val : other_val;
-        });
-    } else {
-      at::native::cpu_kernel(
+        [](scalar_t a) -> scalar_t { return a; },
+        [](vec256::Vec256<scalar_t> a) { return a; });
+  });
+}
+
+static void clamp_where_kernel_impl(
+    TensorIterator& iter,
+    ScalarType condition_type,
+    Scalar min_scalar,
+    Scalar max_scalar) {
+  AT_DISPATCH_ALL_TYPES(iter.dtype(), "clamp_where_cpu", [&] {
+    const auto min = min_scalar.to<scalar_t>();
+    const auto max = max_scalar.to<scalar_t>();
+    const vec256::Vec256<scalar_t> min_vec(min);
+    const vec256::Vec256<scalar_t> max_vec(max);
+    select_kernel_vec<scalar_t>(
         iter,
-        [=](bool cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
-          return cond_val ? self_val : other_val;
+        [=](scalar_t a) -> scalar_t {
+          return a < min ? min : (a > max ? max : a);
+        },
+        [=](vec256::Vec256<scalar_t> a) {
+          return vec256::clamp(a, min_vec, max_vec);
         });
-    }
   });
 }
 
@@ -125,5 +208,6 @@ static void where_kernel_impl(TensorIterator &iter, ScalarType condition_type) {
 REGISTER_DISPATCH(max_kernel, &max_kernel_impl);
 REGISTER_DISPATCH(min_kernel, &min_kernel_impl);
 REGISTER_DISPATCH(where_kernel, &where_kernel_impl);
+REGISTER_DISPATCH(clamp_where_kernel, &clamp_where_kernel_impl);
 
 }} // namespace at::native
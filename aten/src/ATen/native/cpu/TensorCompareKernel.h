@@ -16,4 +16,7 @@ DECLARE_DISPATCH(reduce_fn, min_kernel);
 using where_fn = void (*)(TensorIterator &, ScalarType);
 DECLARE_DISPATCH(where_fn, where_kernel);
 
+using clamp_where_fn = void (*)(TensorIterator &, ScalarType, Scalar, Scalar);
+DECLARE_DISPATCH(clamp_where_fn, clamp_where_kernel);
+
 }} // namespace at::native
@@ -0,0 +1,195 @@
+#include <ATen/ATen.h>
+
+#include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
+#include <ATen/cpu/vec256/intrinsics.h>
+#include <ATen/native/cpu/TransposeCopyKernel.h>
+
+namespace at { namespace native {
+
+namespace {
+
+// Materializes a transposed matrix into a contiguous tensor. The input is
+// addressed column-major (element (r, c) at src[r + c * ld_src]), the output
+// row-major, so a naive loop strides through one of the two with no reuse.
+// The kernel walks kBlockSize^2 cache blocks instead, and within a block
+// uses 8x8 in-register tiles where the ISA provides them.
+
+constexpr int64_t kBlockSize = 64;
+
+#if defined(CPU_CAPABILITY_AVX2)
+// Transposes a full 8x8 float tile entirely in ymm registers: unpack pairs
+// of columns, interleave quads, then exchange 128-bit lanes.
+inline void transpose_tile_8x8_ps(
+    const float* src,
+    int64_t ld_src,
+    float* dst,
+    int64_t ld_dst) {
+  __m256 c0 = _mm256_loadu_ps(src + 0 * ld_src);
+  __m256 c1 = _mm256_loadu_ps(src + 1 * ld_src);
+  __m256 c2 = _mm256_loadu_ps(src + 2 * ld_src);
+  __m256 c3 = _mm256_loadu_ps(src + 3 * ld_src);
+  __m256 c4 = _mm256_loadu_ps(src + 4 * ld_src);
+  __m256 c5 = _mm256_loadu_ps(src + 5 * ld_src);
+  __m256 c6 = _mm256_loadu_ps(src + 6 * ld_src);
+  __m256 c7 = _mm256_loadu_ps(src + 7 * ld_src);
+
+  __m256 t0 = _mm256_unpacklo_ps(c0, c1);
+  __m256 t1 = _mm256_unpackhi_ps(c0, c1);
+  __m256 t2 = _mm256_unpacklo_ps(c2, c3);
+  __m256 t3 = _mm256_unpackhi_ps(c2, c3);
+  __m256 t4 = _mm256_unpacklo_ps(c4, c5);
+  __m256 t5 = _mm256_unpackhi_ps(c4, c5);
+  __m256 t6 = _mm256_unpacklo_ps(c6, c7);
+  __m256 t7 = _mm256_unpackhi_ps(c6, c7);
+
+  __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+  _mm256_storeu_ps(dst + 0 * ld_dst, _mm256_permute2f128_ps(u0, u4, 0x20));
+  _mm256_storeu_ps(dst + 1 * ld_dst, _mm256_permute2f128_ps(u1, u5, 0x20));
+  _mm256_storeu_ps(dst + 2 * ld_dst, _mm256_permute2f128_ps(u2, u6, 0x20));
+  _mm256_storeu_ps(dst + 3 * ld_dst, _mm256_permute2f128_ps(u3, u7, 0x20));
+  _mm256_storeu_ps(dst + 4 * ld_dst, _mm256_permute2f128_ps(u0, u4, 0x31));
+  _mm256_storeu_ps(dst + 5 * ld_dst, _mm256_permute2f128_ps(u1, u5, 0x31));
+  _mm256_storeu_ps(dst + 6 * ld_dst, _mm256_permute2f128_ps(u2, u6, 0x31));
+  _mm256_storeu_ps(dst + 7 * ld_dst, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+
+// Transposes a full 4x4 double tile in ymm registers.
+inline void transpose_tile_4x4_pd(
+    const double* src,
+    int64_t ld_src,
+    double* dst,
+    int64_t ld_dst) {
+  __m256d c0 = _mm256_loadu_pd(src + 0 * ld_src);
+  __m256d c1 = _mm256_loadu_pd(src + 1 * ld_src);
+  __m256d c2 = _mm256_loadu_pd(src + 2 * ld_src);
+  __m256d c3 = _mm256_loadu_pd(src + 3 * ld_src);
+
+  __m256d t0 = _mm256_unpacklo_pd(c0, c1);
+  __m256d t1 = _mm256_unpackhi_pd(c0, c1);
+  __m256d t2 = _mm256_unpacklo_pd(c2, c3);
+  __m256d t3 = _mm256_unpackhi_pd(c2, c3);
+
+  _mm256_storeu_pd(dst + 0 * ld_dst, _mm256_permute2f128_pd(t0, t2, 0x20));
+  _mm256_storeu_pd(dst + 1 * ld_dst, _mm256_permute2f128_pd(t1, t3, 0x20));
+  _mm256_storeu_pd(dst + 2 * ld_dst, _mm256_permute2f128_pd(t0, t2, 0x31));
+  _mm256_storeu_pd(dst + 3 * ld_dst, _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+#endif
+
+// Transposes an nr x nc block. The scalar fallback; loads stride through the
+// source columns, but the whole block stays resident in L1.
+template <typename scalar_t>
+inline void transpose_block(
+    const scalar_t* src,
+    int64_t ld_src,
+    scalar_t* dst,
+    int64_t ld_dst,
+    int64_t nr,
+    int64_t nc) {
+  for (int64_t r = 0; r < nr; r++) {
+    for (int64_t c = 0; c < nc; c++) {
+      dst[r * ld_dst + c] = src[r + c * ld_src];
+    }
+  }
+}
+
+#if defined(CPU_CAPABILITY_AVX2)
+inline void transpose_block(
+    const float* src,
+    int64_t ld_src,
+    float* dst,
+    int64_t ld_dst,
+    int64_t nr,
+    int64_t nc) {
+  int64_t r = 0;
+  for (; r + 8 <= nr; r += 8) {
+    int64_t c = 0;
+    for (; c + 8 <= nc; c += 8) {
+      transpose_tile_8x8_ps(
+          src + r + c * ld_src, ld_src, dst + r * ld_dst + c, ld_dst);
+    }
+    if (c < nc) {
+      transpose_block<float>(
+          src + r + c * ld_src, ld_src, dst + r * ld_dst + c, ld_dst, 8, nc - c);
+    }
+  }
+  if (r < nr) {
+    transpose_block<float>(src + r, ld_src, dst + r * ld_dst, ld_dst, nr - r, nc);
+  }
+}
+
+inline void transpose_block(
+    const double* src,
+    int64_t ld_src,
+    double* dst,
+    int64_t ld_dst,
+    int64_t nr,
+    int64_t nc) {
+  int64_t r = 0;
+  for (; r + 4 <= nr; r += 4) {
+    int64_t c = 0;
+    for (; c + 4 <= nc; c += 4) {
+      transpose_tile_4x4_pd(
+          src + r + c * ld_src, ld_src, dst + r * ld_dst + c, ld_dst);
+    }
+    if (c < nc) {
+      transpose_block<double>(
+          src + r + c * ld_src, ld_src, dst + r * ld_dst + c, ld_dst, 4, nc - c);
+    }
+  }
+  if (r < nr) {
+    transpose_block<double>(src + r, ld_src, dst + r * ld_dst, ld_dst, nr - r, nc);
+  }
+}
+#endif
+
+template <typename scalar_t>
+void transpose_copy_kernel_impl(Tensor& self, const Tensor& src) {
+  const bool batched = src.dim() == 3;
+  const int64_t B = batched ? src.size(0) : 1;
+  const int64_t NR = src.size(batched ? 1 : 0);
+  const int64_t NC = src.size(batched ? 2 : 1);
+  const scalar_t* sp = src.data_ptr<scalar_t>();
+  scalar_t* rp = self.data_ptr<scalar_t>();
+
+  // Parallelize over (batch, row block) pairs; each task transposes full
+  // rows of blocks so its output writes are contiguous.
+  const int64_t row_blocks = divup(NR, kBlockSize);
+  const int64_t grain =
+      std::max(int64_t(1), divup(at::internal::GRAIN_SIZE, kBlockSize * NC));
+  at::parallel_for(0, B * row_blocks, grain, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      const int64_t b = i / row_blocks;
+      const int64_t R = (i % row_blocks) * kBlockSize;
+      const scalar_t* sb = sp + b * NR * NC;
+      scalar_t* rb = rp + b * NR * NC;
+      const int64_t nr = std::min(NR - R, kBlockSize);
+      for (int64_t C = 0; C < NC; C += kBlockSize) {
+        const int64_t nc = std::min(NC - C, kBlockSize);
+        transpose_block(sb + R + C * NR, NR, rb + R * NC + C, NC, nr, nc);
+      }
+    }
+  });
+}
+
+void transpose_copy_kernel(Tensor& self, const Tensor& src) {
+  AT_DISPATCH_ALL_TYPES_AND3(
+      kHalf, kBool, kBFloat16, self.scalar_type(), "transpose_copy", [&] {
+        transpose_copy_kernel_impl<scalar_t>(self, src);
+      });
+}
+
+} // anonymous namespace
+
+REGISTER_DISPATCH(transpose_copy_stub, &transpose_copy_kernel);
+
+}}  // namespace at::native
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <ATen/ATen.h>
+#include <ATen/native/DispatchStub.h>
+
+namespace at { namespace native {
+
+using transpose_copy_fn = void (*)(Tensor&, const Tensor&);
+DECLARE_DISPATCH(transpose_copy_fn, transpose_copy_stub);
+
+}}  // namespace at::native
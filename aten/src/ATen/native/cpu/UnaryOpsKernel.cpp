@@ -181,17 +181,19 @@ static void sign_kernel(TensorIterator& iter){
 
 static void sinh_kernel(TensorIterator& iter) {
   AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES(iter.dtype(), "sinh_cpu", [&]() {
-    cpu_kernel(
+    cpu_kernel_vec(
         iter,
-        [=](scalar_t a) -> scalar_t { return std::sinh(a); });
+        [=](scalar_t a) -> scalar_t { return std::sinh(a); },
+        [=](Vec256<scalar_t> self_vec){return self_vec.sinh();});
   });
 }
 
 static void cosh_kernel(TensorIterator& iter) {
   AT_DISPATCH_FLOATING_AND_COMPLEX_TYPES(iter.dtype(), "cosh_cpu", [&]() {
-    cpu_kernel(
+    cpu_kernel_vec(
         iter,
-        [=](scalar_t a) -> scalar_t { return std::cosh(a); });
+        [=](scalar_t a) -> scalar_t { return std::cosh(a); },
+        [=](Vec256<scalar_t> self_vec){return self_vec.cosh();});
   });
 }
 
@@ -473,6 +475,42 @@ void normal_kernel(Tensor& self, double mean, double std, Generator gen) {
   }
 }
 
+static void uniform_kernel(Tensor& self, double from, double to, Generator gen) {
+  CPUGenerator* generator = get_generator_or_default<CPUGenerator>(gen, detail::getDefaultCPUGenerator());
+  auto size = self.numel();
+  AT_DISPATCH_FLOATING_TYPES(self.scalar_type(), "uniform_cpu", [&]() {
+    if (self.is_contiguous() && size >= at::internal::GRAIN_SIZE) {
+      // See NOTE [ Parallel Philox sampling ] in cpu/DistributionTemplates.h
+      scalar_t* data = self.data_ptr<scalar_t>();
+      const scalar_t a = static_cast<scalar_t>(from);
+      const scalar_t span = static_cast<scalar_t>(to - from);
+      if (std::is_same<scalar_t, double>::value) {
+        templates::cpu::philox_parallel_fill<2>(
+            data, size, generator, [a, span](at::Philox4_32_10& engine) -> scalar_t {
+              const uint64_t hi = engine();
+              const uint64_t lo = engine();
+              const uint64_t bits = hi << 32 | lo;
+              return static_cast<scalar_t>(
+                  (bits & DOUBLE_MASK) * DOUBLE_DIVISOR * span + a);
+            });
+      } else {
+        templates::cpu::philox_parallel_fill<1>(
+            data, size, generator, [a, span](at::Philox4_32_10& engine) -> scalar_t {
+              return static_cast<scalar_t>(
+                  (engine() & FLOAT_MASK) * FLOAT_DIVISOR * span + a);
+            });
+      }
+    } else {
+      auto iter = TensorIterator::nullary_op(self);
+      std::lock_guard<std::mutex> lock(generator->mutex_);
+      cpu_serial_kernel(iter, [from, to, generator]() -> scalar_t {
+        at::uniform_real_distribution<scalar_t> uniform(from, to);
+        return static_cast<scalar_t>(uniform(generator));
+      });
+    }
+  });
+}
+
 static void random_from_to_kernel(TensorIterator& iter, uint64_t range, int64_t base, Generator gen) {
   CPUGenerator* generator = get_generator_or_default<CPUGenerator>(gen, detail::getDefaultCPUGenerator());
   templates::cpu::random_from_to_kernel(iter, range, base, generator);
@@ -576,6 +614,7 @@ REGISTER_DISPATCH(exponential_stub, &exponential_kernel);
 REGISTER_DISPATCH(geometric_stub, &geometric_kernel);
 REGISTER_DISPATCH(log_normal_stub, &log_normal_kernel);
 REGISTER_DISPATCH(normal_stub, &normal_kernel);
+REGISTER_DISPATCH(uniform_stub, &uniform_kernel);
 REGISTER_DISPATCH(random_from_to_stub, &random_from_to_kernel);
 REGISTER_DISPATCH(random_full_64_bits_range_stub, &random_full_64_bits_range_kernel);
 REGISTER_DISPATCH(random_stub, &random_kernel);
@@ -151,6 +151,46 @@ void unfolded2d_acc_kernel(
       });
 }
 
+// Copies one output row for a single (kh, kw) kernel offset. The write is
+// sequential; the read is strided by dW (contiguous when dW == 1).
+template <typename scalar_t>
+static inline void unfolded2d_copy_row(
+    scalar_t* dst_row,
+    const scalar_t* src,
+    int64_t iy,
+    int64_t kw,
+    int64_t kW,
+    int64_t dW,
+    int64_t padW,
+    int64_t input_width,
+    int64_t output_width) {
+  if (dW == 1) {
+    int64_t ix = 0 - padW + kw;
+    int64_t lpad = std::max<int64_t>(0, padW - kw);
+    int64_t rpad = std::max<int64_t>(0, padW - (kW - kw - 1));
+    if (output_width - rpad - lpad <= 0) {
+      memset(dst_row, 0, sizeof(scalar_t) * output_width);
+    } else {
+      if (lpad > 0)
+        memset(dst_row, 0, sizeof(scalar_t) * lpad);
+      memcpy(
+          dst_row + lpad,
+          src + (size_t)iy * input_width + ix + lpad,
+          sizeof(scalar_t) * (output_width - rpad - lpad));
+      if (rpad > 0)
+        memset(
+            dst_row + output_width - rpad, 0, sizeof(scalar_t) * rpad);
+    }
+  } else {
+    const scalar_t* src_row = src + (size_t)iy * input_width;
+    for (int64_t x = 0; x < output_width; x++) {
+      int64_t ix = (int64_t)x * dW - padW + kw;
+      dst_row[x] =
+          (ix < 0 || ix >= input_width) ? scalar_t(0) : src_row[ix];
+    }
+  }
+}
+
 template <typename scalar_t>
 static void unfolded2d_copy(
     scalar_t* input_data,
@@ -166,90 +206,53 @@ static void unfolded2d_copy(
     int64_t input_width,
     int64_t output_height,
     int64_t output_width) {
+  if (output_height <= 0 || output_width <= 0) {
+    return;
+  }
+  // Tile the output rows so that all kH*kW kernel offsets of a tile are
+  // applied while its input rows are still in cache, instead of sweeping the
+  // whole input plane once per offset. Each (kh, kw) of a tile writes one
+  // sequential run of at least a page.
+  const int64_t kPageElems =
+      std::max<int64_t>(int64_t(1), int64_t(4096 / sizeof(scalar_t)));
+  int64_t tile_rows = std::max<int64_t>(int64_t(1), kPageElems / output_width);
+  tile_rows = std::min(tile_rows, output_height);
+  int64_t n_tiles = (output_height + tile_rows - 1) / tile_rows;
   at::parallel_for(
-      0, (int64_t)n_input_plane * kH * kW, 0, [&](int64_t start, int64_t end) {
-        for (auto k = start; k < end; k++) {
-          int64_t nip = k / (kH * kW);
-          int64_t rest = k % (kH * kW);
-          int64_t kh = rest / kW;
-          int64_t kw = rest % kW;
-          int64_t x, y;
-          int64_t ix, iy;
-          scalar_t* dst = finput_data +
-              nip * ((size_t)kH * kW * output_height * output_width) +
-              kh * ((size_t)kW * output_height * output_width) +
-              kw * ((size_t)output_height * output_width);
-          scalar_t* src =
+      0, n_input_plane * n_tiles, 0, [&](int64_t start, int64_t end) {
+        for (auto t = start; t < end; t++) {
+          int64_t nip = t / n_tiles;
+          int64_t y_begin = (t % n_tiles) * tile_rows;
+          int64_t y_end = std::min(y_begin + tile_rows, output_height);
+          const scalar_t* src =
               input_data + nip * ((size_t)input_height * input_width);
-          if (padW > 0 || padH > 0) {
-            int64_t lpad, rpad;
-            for (y = 0; y < output_height; y++) {
-              iy = (int64_t)y * dH - padH + kh;
-              if (iy < 0 || iy >= input_height) {
-                memset(
-                    dst + (size_t)y * output_width,
-                    0,
-                    sizeof(scalar_t) * output_width);
-              } else {
-                if (dW == 1) {
-                  ix = 0 - padW + kw;
-                  lpad = std::max<int64_t>(0, padW - kw);
-                  rpad = std::max<int64_t>(0, padW - (kW - kw - 1));
-                  if (output_width - rpad - lpad <= 0) {
-                    memset(
-                        dst + (size_t)y * output_width,
-                        0,
-                        sizeof(scalar_t) * output_width);
-                  } else {
-                    if (lpad > 0)
-                      memset(
-                          dst + (size_t)y * output_width,
-                          0,
-                          sizeof(scalar_t) * lpad);
-                    memcpy(
-                        dst + (size_t)y * output_width + lpad,
-                        src + (size_t)iy * input_width + ix + lpad,
-                        sizeof(scalar_t) * (output_width - rpad - lpad));
-                    if (rpad > 0)
-                      memset(
-                          dst + (size_t)y * output_width + output_width - rpad,
-                          0,
-                          sizeof(scalar_t) * rpad);
-                  }
+          for (int64_t kh = 0; kh < kH; kh++) {
+            for (int64_t kw = 0; kw < kW; kw++) {
+              scalar_t* dst = finput_data +
+                  nip * ((size_t)kH * kW * output_height * output_width) +
+                  kh * ((size_t)kW * output_height * output_width) +
+                  kw * ((size_t)output_height * output_width);
+              for (int64_t y = y_begin; y < y_end; y++) {
+                int64_t iy = (int64_t)y * dH - padH + kh;
+                if (iy < 0 || iy >= input_height) {
+                  memset(
+                      dst + (size_t)y * output_width,
+                      0,
+                      sizeof(scalar_t) * output_width);
                 } else {
-                  for (x = 0; x < output_width; x++) {
-                    ix = (int64_t)x * dW - padW + kw;
-                    if (ix < 0 || ix >= input_width)
-                      memset(
-                          dst + (size_t)y * output_width + x,
-                          0,
-                          sizeof(scalar_t) * 1);
-                    else
-                      memcpy(
-                          dst + (size_t)y * output_width + x,
-                          src + (size_t)iy * input_width + ix,
-                          sizeof(scalar_t) * (1));
-                  }
+                  unfolded2d_copy_row(
+                      dst + (size_t)y * output_width,
+                      src,
+                      iy,
+                      kw,
+                      kW,
+                      dW,
+                      padW,
+                      input_width,
+                      output_width);
                 }
               }
             }
-          } else {
-            for (y = 0; y < output_height; y++) {
-              iy = (int64_t)y * dH + kh;
-              ix = 0 + kw;
-              if (dW == 1)
-                memcpy(
-                    dst + (size_t)y * output_width,
-                    src + (size_t)iy * input_width + ix,
-                    sizeof(scalar_t) * output_width);
-              else {
-                for (x = 0; x < output_width; x++)
-                  memcpy(
-                      dst + (size_t)y * output_width + x,
-                      src + (size_t)iy * input_width + ix + (int64_t)x * dW,
-                      sizeof(scalar_t) * (1));
-              }
-            }
           }
         }
       });
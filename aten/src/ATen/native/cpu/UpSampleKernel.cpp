@@ -1,9 +1,12 @@
 #include <ATen/ATen.h>
 
 #include <ATen/Dispatch.h>
+#include <ATen/cpu/vec256/vec256.h>
 #include <ATen/native/UpSample.h>
 #include <ATen/Parallel.h>
 
+#include <vector>
+
 namespace at {
 namespace native {
 namespace {
@@ -233,6 +236,123 @@ void cpu_upsample_nearest_channels_last(
   }
 }
 
+template <typename scalar_t, typename scale_type>
+void cpu_upsample_bilinear_channels_last(
+    Tensor& output_,
+    const Tensor& input_,
+    bool align_corners,
+    const scale_type& scales) {
+  TORCH_CHECK(input_.dtype() == output_.dtype(), "expected dtype ", input_.dtype(),
+              " for `output` but got dtype ", output_.dtype());
+
+  auto input_sizes = input_.sizes().vec();
+  auto output_sizes = output_.sizes().vec();
+  TORCH_CHECK(input_sizes.size() == 4,
+              "Bilinear upsample with NHWC format supports tensors with 4 dims.")
+
+  auto channels_last_memory_format = at::MemoryFormat::ChannelsLast;
+  auto input = input_.contiguous(channels_last_memory_format);
+  auto output = output_.contiguous(channels_last_memory_format);
+
+  auto input_data = input.data_ptr<scalar_t>();
+  auto output_data = output.data_ptr<scalar_t>();
+
+  int64_t num_batches = input_sizes[0];
+  int64_t channels = input_sizes[1];
+  int64_t input_height = input_sizes[2];
+  int64_t input_width = input_sizes[3];
+  int64_t output_height = output_sizes[2];
+  int64_t output_width = output_sizes[3];
+
+  using Vec = vec256::Vec256<scalar_t>;
+
+  const scalar_t rheight = area_pixel_compute_scale<scalar_t>(
+      input_height, output_height, align_corners, scales[0]);
+  const scalar_t rwidth = area_pixel_compute_scale<scalar_t>(
+      input_width, output_width, align_corners, scales[1]);
+
+  // Column indices and lambdas depend only on ow; compute them once up front
+  // and reuse them for every output row.
+  std::vector<int64_t> iw0(output_width);
+  std::vector<int64_t> iw1(output_width);
+  std::vector<scalar_t> w0lambda(output_width);
+  std::vector<scalar_t> w1lambda(output_width);
+  for (int64_t ow = 0; ow < output_width; ow++) {
+    const scalar_t w1r = area_pixel_compute_source_index<scalar_t>(
+        rwidth, ow, align_corners, /*cubic=*/false);
+    iw0[ow] = static_cast<int64_t>(w1r);
+    iw1[ow] = iw0[ow] + ((iw0[ow] < input_width - 1) ? 1 : 0);
+    w1lambda[ow] = w1r - iw0[ow];
+    w0lambda[ow] = static_cast<scalar_t>(1.) - w1lambda[ow];
+  }
+
+  int64_t input_row_stride = input_width * channels;
+  int64_t input_slice_size = input_height * input_row_stride;
+  int64_t output_row_stride = output_width * channels;
+
+  // One work item per output row, so the source rows and row lambdas are
+  // derived once per row instead of once per pixel. In channels-last layout
+  // the C channels of each pixel are contiguous, so the four-tap
+  // interpolation vectorizes across channels.
+  auto loop2d = [&](int64_t start, int64_t end) {
+    int64_t n = 0;
+    int64_t oh = 0;
+    data_index_init(start, n, num_batches, oh, output_height);
+
+    for (int64_t i = start; i < end; i++) {
+      const scalar_t h1r = area_pixel_compute_source_index<scalar_t>(
+          rheight, oh, align_corners, /*cubic=*/false);
+      const int64_t ih0 = static_cast<int64_t>(h1r);
+      const int64_t ih1 = ih0 + ((ih0 < input_height - 1) ? 1 : 0);
+      const scalar_t h1lambda = h1r - ih0;
+      const scalar_t h0lambda = static_cast<scalar_t>(1.) - h1lambda;
+
+      const scalar_t* row0 =
+          input_data + n * input_slice_size + ih0 * input_row_stride;
+      const scalar_t* row1 =
+          input_data + n * input_slice_size + ih1 * input_row_stride;
+      scalar_t* out = output_data + i * output_row_stride;
+
+      for (int64_t ow = 0; ow < output_width; ow++) {
+        const scalar_t* p00 = row0 + iw0[ow] * channels;
+        const scalar_t* p01 = row0 + iw1[ow] * channels;
+        const scalar_t* p10 = row1 + iw0[ow] * channels;
+        const scalar_t* p11 = row1 + iw1[ow] * channels;
+
+        const scalar_t c00 = h0lambda * w0lambda[ow];
+        const scalar_t c01 = h0lambda * w1lambda[ow];
+        const scalar_t c10 = h1lambda * w0lambda[ow];
+        const scalar_t c11 = h1lambda * w1lambda[ow];
+        const Vec v00(c00), v01(c01), v10(c10), v11(c11);
+
+        int64_t c = 0;
+        for (; c <= channels - Vec::size(); c += Vec::size()) {
+          Vec acc = v00 * Vec::loadu(p00 + c);
+          acc = vec256::fmadd(v01, Vec::loadu(p01 + c), acc);
+          acc = vec256::fmadd(v10, Vec::loadu(p10 + c), acc);
+          acc = vec256::fmadd(v11, Vec::loadu(p11 + c), acc);
+          acc.store(out + c);
+        }
+        for (; c < channels; c++) {
+          out[c] = c00 * p00[c] + c01 * p01[c] + c10 * p10[c] + c11 * p11[c];
+        }
+        out += channels;
+      }
+      data_index_step(n, num_batches, oh, output_height);
+    }
+  };
+
+  at::parallel_for(
+      0,
+      num_batches * output_height,
+      at::internal::GRAIN_SIZE / output_row_stride,
+      loop2d);
+
+  if (!output_.is_contiguous(channels_last_memory_format)) {
+    output_.copy_(output);
+  }
+}
+
 template <typename scalar_t, typename scale_type>
 void cpu_upsample_nearest_backward(
     Tensor& grad_input_,
@@ -367,6 +487,17 @@ void upsample_nearest3d_kernel_impl(
   }
 }
 
+void upsample_bilinear2d_kernel_impl(
+    Tensor& output,
+    const Tensor& input,
+    bool align_corners,
+    c10::optional<double> scales_h,
+    c10::optional<double> scales_w) {
+  AT_DISPATCH_FLOATING_TYPES_AND_HALF(input.scalar_type(), "upsample_bilinear2d_channels_last", [&] {
+    cpu_upsample_bilinear_channels_last<scalar_t, scale_t>(output, input, align_corners, {scales_h, scales_w});
+  });
+}
+
 void upsample_nearest1d_backward_kernel_impl(
     Tensor& grad_input,
     const Tensor& grad_output,
@@ -406,6 +537,7 @@ REGISTER_DISPATCH(upsample_nearest3d_kernel, &upsample_nearest3d_kernel_impl);
 REGISTER_DISPATCH(upsample_nearest1d_backward_kernel, &upsample_nearest1d_backward_kernel_impl);
 REGISTER_DISPATCH(upsample_nearest2d_backward_kernel, &upsample_nearest2d_backward_kernel_impl);
 REGISTER_DISPATCH(upsample_nearest3d_backward_kernel, &upsample_nearest3d_backward_kernel_impl);
+REGISTER_DISPATCH(upsample_bilinear2d_kernel, &upsample_bilinear2d_kernel_impl);
 
 } // namespace native
 } // namespace at
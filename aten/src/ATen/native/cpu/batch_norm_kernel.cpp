@@ -1,8 +1,10 @@
 #include <ATen/native/batch_norm.h>
 
 #include <ATen/ATen.h>
+#include <ATen/AccumulateType.h>
 #include <ATen/CPUApplyUtils.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cpu/Loops.h>
 
@@ -100,6 +102,116 @@ void batch_norm_cpu_inference_contiguous_impl(Tensor& output,
   }
 }
 
+/// Merges the Welford partial (count_b, mean_b, m2_b) into
+/// (count_a, mean_a, m2_a) using Chan's parallel combination formula.
+template<typename accscalar_t>
+inline void welford_merge(
+    accscalar_t& count_a, accscalar_t& mean_a, accscalar_t& m2_a,
+    accscalar_t count_b, accscalar_t mean_b, accscalar_t m2_b) {
+  if (count_b == 0) {
+    return;
+  }
+  accscalar_t count = count_a + count_b;
+  accscalar_t delta = mean_b - mean_a;
+  mean_a += delta * count_b / count;
+  m2_a += m2_b + delta * delta * count_a * count_b / count;
+  count_a = count;
+}
+
+/// Computes per-channel mean and sum of squared deviations in a single pass
+/// over a contiguous NCHW input.  Each thread runs a vectorized Welford
+/// update over its slice of the collapsed (batch, channel) space, with the
+/// vector lanes acting as independent accumulators; the lane partials and the
+/// per-thread partials are then merged with Chan's formula, so the whole
+/// tensor is read once while keeping Welford's numerical stability.
+template<typename scalar_t>
+void batch_norm_cpu_collect_stats_contiguous_impl(
+    Tensor& mean, Tensor& var_sum, const Tensor& input) {
+
+  using Vec = Vec256<scalar_t>;
+  using accscalar_t = at::acc_type<scalar_t, false>;
+  int64_t n_batch = input.size(0);
+  int64_t n_channel = input.size(1);
+  int64_t image_size = input.numel() / n_batch / n_channel;
+
+  const scalar_t* input_data = input.data_ptr<scalar_t>();
+  scalar_t* mean_data = mean.data_ptr<scalar_t>();
+  scalar_t* var_sum_data = var_sum.data_ptr<scalar_t>();
+
+  int num_threads = at::get_num_threads();
+  // Per-thread Welford partials, laid out as [count, mean, m2] per channel.
+  // accscalar_t is double for every floating input type on CPU.
+  Tensor buffer = at::zeros({num_threads, 3, n_channel}, input.options().dtype(kDouble));
+  accscalar_t* buffer_data = buffer.data_ptr<accscalar_t>();
+
+  // Collapse (batch, channel) so all threads stay busy even when the batch
+  // alone is smaller than the thread count; any partition of the collapsed
+  // space is valid because the partials are merged per channel below.
+  at::parallel_for_2d(0, n_batch, 0, n_channel, 1, [&](int64_t n, int64_t c_begin, int64_t c_end) {
+    accscalar_t* count_ptr = buffer_data + at::get_thread_num() * 3 * n_channel;
+    accscalar_t* mean_ptr = count_ptr + n_channel;
+    accscalar_t* m2_ptr = mean_ptr + n_channel;
+
+    for (int64_t c = c_begin; c < c_end; c++) {
+      Vec lane_mean(0);
+      Vec lane_m2(0);
+      int64_t lane_count = 0;
+      accscalar_t tail_count = 0, tail_mean = 0, tail_m2 = 0;
+      const int64_t loop_size = image_size - (image_size % Vec::size());
+      const scalar_t* channel_data =
+          input_data + n * n_channel * image_size + c * image_size;
+      int64_t d = 0;
+      for (; d < loop_size; d += Vec::size()) {
+        lane_count++;
+        Vec data_vec = Vec::loadu(channel_data + d);
+        Vec delta = data_vec - lane_mean;
+        lane_mean = lane_mean + delta * Vec(scalar_t(1) / lane_count);
+        lane_m2 = lane_m2 + delta * (data_vec - lane_mean);
+      }
+      for (; d < image_size; d++) {
+        tail_count += 1;
+        accscalar_t data = channel_data[d];
+        accscalar_t delta = data - tail_mean;
+        tail_mean += delta / tail_count;
+        tail_m2 += delta * (data - tail_mean);
+      }
+
+      // Horizontally fuse the lane partials into the scalar tail partial.
+      __at_align32__ scalar_t lane_mean_arr[Vec::size()];
+      __at_align32__ scalar_t lane_m2_arr[Vec::size()];
+      lane_mean.store(lane_mean_arr);
+      lane_m2.store(lane_m2_arr);
+      for (int64_t i = 0; i < Vec::size(); i++) {
+        welford_merge<accscalar_t>(
+            tail_count, tail_mean, tail_m2,
+            lane_count, lane_mean_arr[i], lane_m2_arr[i]);
+      }
+      welford_merge<accscalar_t>(
+          count_ptr[c], mean_ptr[c], m2_ptr[c],
+          tail_count, tail_mean, tail_m2);
+    }
+  });
+
+  for (int64_t c = 0; c < n_channel; c++) {
+    accscalar_t count = 0, mean_acc = 0, m2 = 0;
+    for (int64_t t = 0; t < num_threads; t++) {
+      accscalar_t* count_ptr = buffer_data + t * 3 * n_channel;
+      welford_merge<accscalar_t>(
+          count, mean_acc, m2,
+          count_ptr[c], count_ptr[n_channel + c], count_ptr[2 * n_channel + c]);
+    }
+    mean_data[c] = mean_acc;
+    var_sum_data[c] = m2;
+  }
+}
+
+void batch_norm_cpu_collect_stats_contiguous_kernel(
+    Tensor& mean, Tensor& var_sum, const Tensor& input) {
+  AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "batch_norm_cpu_collect_stats_contiguous", [&] {
+    batch_norm_cpu_collect_stats_contiguous_impl<scalar_t>(mean, var_sum, input);
+  });
+}
+
 void batch_norm_cpu_inference_contiguous_kernel(Tensor& output, const Tensor& input,
     const Tensor& weight, const Tensor& bias, const Tensor& mean, const Tensor& variance, double eps) {
   AT_DISPATCH_FLOATING_TYPES(input.scalar_type(), "batch_norm_cpu_inference_contiguous", [&] {
@@ -110,5 +222,6 @@ void batch_norm_cpu_inference_contiguous_kernel(Tensor& output, const Tensor& in
 }// anonymous namespace
 
 REGISTER_DISPATCH(batch_norm_cpu_inference_contiguous_stub, &batch_norm_cpu_inference_contiguous_kernel);
+REGISTER_DISPATCH(batch_norm_cpu_collect_stats_contiguous_stub, &batch_norm_cpu_collect_stats_contiguous_kernel);
 
 }} // namespace at::native
@@ -82,6 +82,213 @@ void LayerNormKernelImpl(
   });
 }
 
+template <typename T>
+void ResidualLayerNormKernelImplInternal(
+    const Tensor& X,
+    const Tensor& R,
+    const Tensor& mask,
+    T dropout_scale,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    T eps,
+    Tensor* Y) {
+  DCHECK_EQ(X.numel(), M * N);
+  DCHECK_EQ(R.numel(), M * N);
+  DCHECK(!mask.defined() || mask.numel() == M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  const T* X_data = X.data_ptr<T>();
+  const T* R_data = R.data_ptr<T>();
+  const T* mask_data = mask.defined() ? mask.data_ptr<T>() : nullptr;
+  const T* gamma_data = gamma.defined() ? gamma.data_ptr<T>() : nullptr;
+  const T* beta_data = beta.defined() ? beta.data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  const T c = T(1) / static_cast<T>(N);
+  const bool mask_null = mask_data == nullptr;
+  const bool gamma_null = gamma_data == nullptr;
+  const bool beta_null = beta_data == nullptr;
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i) {
+      const T* X_ptr = X_data + i * N;
+      const T* R_ptr = R_data + i * N;
+      const T* mask_ptr = mask_null ? nullptr : mask_data + i * N;
+      T* Y_ptr = Y_data + i * N;
+      T sum1 = T(0);
+      T sum2 = T(0);
+      // Materialize dropout + residual add into the output row, accumulating
+      // the moments on the fly so each row is read exactly once.
+      for (int64_t j = 0; j < N; ++j) {
+        const T x =
+            mask_null ? X_ptr[j] : X_ptr[j] * mask_ptr[j] * dropout_scale;
+        const T z = x + R_ptr[j];
+        Y_ptr[j] = z;
+        sum1 += z;
+        sum2 += z * z;
+      }
+      const T mean_val = sum1 * c;
+      T rstd_val = std::max(sum2 * c - mean_val * mean_val, T(0));
+      rstd_val = T(1) / std::sqrt(rstd_val + eps);
+      const T scale = rstd_val;
+      const T bias = -rstd_val * mean_val;
+      for (int64_t j = 0; j < N; ++j) {
+        const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+        const T beta_v = beta_null ? T(0) : beta_data[j];
+        Y_ptr[j] = (Y_ptr[j] * scale + bias) * gamma_v + beta_v;
+      }
+    }
+  });
+}
+
+void ResidualLayerNormKernelImpl(
+    const Tensor& X,
+    const Tensor& R,
+    const Tensor& mask,
+    double dropout_scale,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y) {
+  AT_DISPATCH_FLOATING_TYPES(
+      X.scalar_type(), "ResidualLayerNormKernelImpl", [&]() {
+        ResidualLayerNormKernelImplInternal<scalar_t>(
+            X,
+            R,
+            mask,
+            static_cast<scalar_t>(dropout_scale),
+            gamma,
+            beta,
+            M,
+            N,
+            static_cast<scalar_t>(eps),
+            Y);
+      });
+}
+
+template <typename T>
+void EmbeddingLayerNormKernelImplInternal(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    int64_t L,
+    T eps,
+    Tensor* Y) {
+  using Vec = vec256::Vec256<T>;
+  DCHECK_EQ(indices.numel(), M);
+  DCHECK_EQ(weight.size(1), N);
+  DCHECK(!pos_weight.defined() || pos_weight.size(1) == N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  const T* weight_data = weight.data_ptr<T>();
+  const int64_t* indices_data = indices.data_ptr<int64_t>();
+  const T* pos_data = pos_weight.defined() ? pos_weight.data_ptr<T>() : nullptr;
+  const T* gamma_data = gamma.defined() ? gamma.data_ptr<T>() : nullptr;
+  const T* beta_data = beta.defined() ? beta.data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  const int64_t num_weights = weight.size(0);
+  const T c = T(1) / static_cast<T>(N);
+  const bool pos_null = pos_data == nullptr;
+  const bool gamma_null = gamma_data == nullptr;
+  const bool beta_null = beta_data == nullptr;
+  const int64_t loop_size = N - (N % Vec::size());
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (int64_t i = start; i < end; ++i) {
+      const int64_t idx = indices_data[i];
+      TORCH_CHECK(
+          idx >= 0 && idx < num_weights,
+          "_embedding_layer_norm: index out of range, got ",
+          idx,
+          " for weight of size ",
+          num_weights);
+      const T* W_ptr = weight_data + idx * N;
+      const T* P_ptr = pos_null ? nullptr : pos_data + (i % L) * N;
+      T* Y_ptr = Y_data + i * N;
+      // Gather the embedding row and add the positional row straight into
+      // the output, accumulating the moments on the fly so the row never
+      // round-trips through an intermediate tensor.
+      Vec sum1_vec(0);
+      Vec sum2_vec(0);
+      int64_t j = 0;
+      for (; j < loop_size; j += Vec::size()) {
+        Vec z_vec = Vec::loadu(W_ptr + j);
+        if (!pos_null) {
+          z_vec = z_vec + Vec::loadu(P_ptr + j);
+        }
+        z_vec.store(Y_ptr + j);
+        sum1_vec = sum1_vec + z_vec;
+        sum2_vec = sum2_vec + z_vec * z_vec;
+      }
+      T sum1 = vec256::vec_reduce_all<T>(
+          [](Vec& x, Vec& y) { return x + y; }, sum1_vec, Vec::size());
+      T sum2 = vec256::vec_reduce_all<T>(
+          [](Vec& x, Vec& y) { return x + y; }, sum2_vec, Vec::size());
+      for (; j < N; ++j) {
+        const T z = pos_null ? W_ptr[j] : W_ptr[j] + P_ptr[j];
+        Y_ptr[j] = z;
+        sum1 += z;
+        sum2 += z * z;
+      }
+      const T mean_val = sum1 * c;
+      T rstd_val = std::max(sum2 * c - mean_val * mean_val, T(0));
+      rstd_val = T(1) / std::sqrt(rstd_val + eps);
+      const Vec scale_vec(rstd_val);
+      const Vec bias_vec(-rstd_val * mean_val);
+      j = 0;
+      for (; j < loop_size; j += Vec::size()) {
+        Vec y_vec = Vec::loadu(Y_ptr + j) * scale_vec + bias_vec;
+        if (!gamma_null) {
+          y_vec = y_vec * Vec::loadu(gamma_data + j);
+        }
+        if (!beta_null) {
+          y_vec = y_vec + Vec::loadu(beta_data + j);
+        }
+        y_vec.store(Y_ptr + j);
+      }
+      const T scale = rstd_val;
+      const T bias = -rstd_val * mean_val;
+      for (; j < N; ++j) {
+        const T gamma_v = gamma_null ? T(1) : gamma_data[j];
+        const T beta_v = beta_null ? T(0) : beta_data[j];
+        Y_ptr[j] = (Y_ptr[j] * scale + bias) * gamma_v + beta_v;
+      }
+    }
+  });
+}
+
+void EmbeddingLayerNormKernelImpl(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    int64_t L,
+    double eps,
+    Tensor* Y) {
+  AT_DISPATCH_FLOATING_TYPES(
+      weight.scalar_type(), "EmbeddingLayerNormKernelImpl", [&]() {
+        EmbeddingLayerNormKernelImplInternal<scalar_t>(
+            weight,
+            indices,
+            pos_weight,
+            gamma,
+            beta,
+            M,
+            N,
+            L,
+            static_cast<scalar_t>(eps),
+            Y);
+      });
+}
+
 template <typename T>
 void LayerNormBackwardKernelImplInternal(
     const Tensor& dY,
@@ -94,6 +301,7 @@ void LayerNormBackwardKernelImplInternal(
     Tensor* dX,
     Tensor* dgamma,
     Tensor* dbeta) {
+  using Vec = vec256::Vec256<T>;
   DCHECK_EQ(dY.numel(), M * N);
   DCHECK_EQ(X.numel(), M * N);
   DCHECK_EQ(mean.numel(), M);
@@ -107,47 +315,111 @@ void LayerNormBackwardKernelImplInternal(
       gamma.defined() ? gamma.template data_ptr<T>() : nullptr;
   T* dX_data = dX->defined() ? dX->template data_ptr<T>() : nullptr;
   T* dgamma_data = dgamma->defined() ? dgamma->template data_ptr<T>() : nullptr;
-  if (dgamma_data != nullptr) {
-    std::memset(dgamma_data, 0, N * sizeof(T));
-  }
   T* dbeta_data = dbeta->defined() ? dbeta->template data_ptr<T>() : nullptr;
-  if (dbeta_data != nullptr) {
-    std::memset(dbeta_data, 0, N * sizeof(T));
-  }
   const T scale = T(1) / static_cast<T>(N);
   const bool gamma_null = gamma_data == nullptr;
-  for (int64_t i = 0; i < M; ++i) {
-    const T* dY_ptr = dY_data + i * N;
-    const T* X_ptr = X_data + i * N;
-    if (dX_data != nullptr) {
-      T* dX_ptr = dX_data + i * N;
-      T ds = 0;
-      T db = 0;
-      for (int64_t j = 0; j < N; ++j) {
-        const T gamma_v = gamma_null ? T(1) : gamma_data[j];
-        ds += dY_ptr[j] * X_ptr[j] * gamma_v;
-        db += dY_ptr[j] * gamma_v;
-      }
+  const int64_t loop_size = N - (N % Vec::size());
+
+  // dX rows are independent, but dgamma and dbeta accumulate across rows, so
+  // each thread sums into its own [dgamma, dbeta] partial and the partials
+  // are reduced after the parallel region.
+  int num_threads = at::get_num_threads();
+  Tensor buffer;
+  T* buffer_data = nullptr;
+  if (dgamma_data != nullptr || dbeta_data != nullptr) {
+    buffer = at::zeros({num_threads, 2, N}, X.options());
+    buffer_data = buffer.template data_ptr<T>();
+  }
+
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    T* dgamma_buffer_ptr = buffer_data == nullptr
+        ? nullptr
+        : buffer_data + at::get_thread_num() * 2 * N;
+    T* dbeta_buffer_ptr =
+        dgamma_buffer_ptr == nullptr ? nullptr : dgamma_buffer_ptr + N;
+    for (int64_t i = start; i < end; ++i) {
+      const T* dY_ptr = dY_data + i * N;
+      const T* X_ptr = X_data + i * N;
       const T a = rstd_data[i];
-      const T b = (db * mean_data[i] - ds) * a * a * a * scale;
-      const T c = -b * mean_data[i] - db * a * scale;
-      for (int64_t j = 0; j < N; ++j) {
-        const T gamma_v = gamma_null ? T(1) : gamma_data[j];
-        dX_ptr[j] = a * dY_ptr[j] * gamma_v + b * X_ptr[j] + c;
+      if (dX_data != nullptr) {
+        T* dX_ptr = dX_data + i * N;
+        Vec ds_vec(0);
+        Vec db_vec(0);
+        int64_t j = 0;
+        for (; j < loop_size; j += Vec::size()) {
+          const Vec dy_vec = gamma_null
+              ? Vec::loadu(dY_ptr + j)
+              : Vec::loadu(dY_ptr + j) * Vec::loadu(gamma_data + j);
+          ds_vec = ds_vec + dy_vec * Vec::loadu(X_ptr + j);
+          db_vec = db_vec + dy_vec;
+        }
+        T ds = vec256::vec_reduce_all<T>(
+            [](Vec& x, Vec& y) { return x + y; }, ds_vec, Vec::size());
+        T db = vec256::vec_reduce_all<T>(
+            [](Vec& x, Vec& y) { return x + y; }, db_vec, Vec::size());
+        for (; j < N; ++j) {
+          const T dy_v = gamma_null ? dY_ptr[j] : dY_ptr[j] * gamma_data[j];
+          ds += dy_v * X_ptr[j];
+          db += dy_v;
+        }
+        const T b = (db * mean_data[i] - ds) * a * a * a * scale;
+        const T c = -b * mean_data[i] - db * a * scale;
+        const Vec a_vec(a);
+        const Vec b_vec(b);
+        const Vec c_vec(c);
+        j = 0;
+        for (; j < loop_size; j += Vec::size()) {
+          const Vec dy_vec = gamma_null
+              ? Vec::loadu(dY_ptr + j)
+              : Vec::loadu(dY_ptr + j) * Vec::loadu(gamma_data + j);
+          const Vec dx_vec =
+              a_vec * dy_vec + b_vec * Vec::loadu(X_ptr + j) + c_vec;
+          dx_vec.store(dX_ptr + j);
+        }
+        for (; j < N; ++j) {
+          const T dy_v = gamma_null ? dY_ptr[j] : dY_ptr[j] * gamma_data[j];
+          dX_ptr[j] = a * dy_v + b * X_ptr[j] + c;
+        }
       }
-    }
-    if (dgamma_data != nullptr) {
-      const T a = rstd_data[i];
-      const T b = -a * mean_data[i];
-      for (int64_t j = 0; j < N; ++j) {
-        dgamma_data[j] += dY_ptr[j] * (a * X_ptr[j] + b);
+      if (dgamma_buffer_ptr != nullptr) {
+        const Vec a_vec(a);
+        const Vec b_vec(-a * mean_data[i]);
+        int64_t j = 0;
+        for (; j < loop_size; j += Vec::size()) {
+          const Vec dg_vec = Vec::loadu(dgamma_buffer_ptr + j) +
+              Vec::loadu(dY_ptr + j) *
+                  (a_vec * Vec::loadu(X_ptr + j) + b_vec);
+          dg_vec.store(dgamma_buffer_ptr + j);
+          const Vec db_vec =
+              Vec::loadu(dbeta_buffer_ptr + j) + Vec::loadu(dY_ptr + j);
+          db_vec.store(dbeta_buffer_ptr + j);
+        }
+        const T b = -a * mean_data[i];
+        for (; j < N; ++j) {
+          dgamma_buffer_ptr[j] += dY_ptr[j] * (a * X_ptr[j] + b);
+          dbeta_buffer_ptr[j] += dY_ptr[j];
+        }
       }
     }
-    if (dbeta_data != nullptr) {
-      for (int64_t j = 0; j < N; ++j) {
-        dbeta_data[j] += dY_ptr[j];
+  });
+
+  if (buffer_data != nullptr) {
+    at::parallel_for(0, N, 1, [&](int64_t start, int64_t end) {
+      for (int64_t j = start; j < end; ++j) {
+        T dgamma_v = 0;
+        T dbeta_v = 0;
+        for (int64_t t = 0; t < num_threads; ++t) {
+          dgamma_v += buffer_data[t * 2 * N + j];
+          dbeta_v += buffer_data[t * 2 * N + N + j];
+        }
+        if (dgamma_data != nullptr) {
+          dgamma_data[j] = dgamma_v;
+        }
+        if (dbeta_data != nullptr) {
+          dbeta_data[j] = dbeta_v;
+        }
       }
-    }
+    });
   }
 }
 
@@ -173,6 +445,8 @@ void LayerNormBackwardKernelImpl(
 
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+REGISTER_DISPATCH(ResidualLayerNormKernel, &ResidualLayerNormKernelImpl);
+REGISTER_DISPATCH(EmbeddingLayerNormKernel, &EmbeddingLayerNormKernelImpl);
 
 } // namespace native
 } // namespace at
@@ -4,6 +4,7 @@
 #include <ATen/cuda/CUDAContext.h>
 #include <ATen/cuda/CUDAEvent.h>
 #include <c10/cuda/CUDAStream.h>
+#include <c10/cuda/CUDACachingAllocator.h>
 #include <ATen/native/Copy.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cuda/Loops.cuh>
@@ -14,6 +15,193 @@ namespace native {
 
 using namespace at::cuda;
 
+namespace {
+
+// NOTE [ Chunked cross-device copies ]
+//
+// A single large cudaMemcpyAsync issued on the source device's current
+// stream occupies that stream for the whole transfer, so kernels enqueued
+// behind it cannot start until the last byte has moved. For the
+// multi-gigabyte activation transfers of model-parallel workloads this
+// serializes the copy with compute on both devices. Instead, transfers at
+// or above kChunkedD2DCopyThreshold are split into kD2DCopyChunkSize
+// pieces issued round-robin across a small set of streams drawn from the
+// source device's stream pool, so the copy engine is fed from streams the
+// compute kernels never run on and consecutive chunks can pipeline.
+//
+// Ordering is preserved on the way in by fanning the chunk streams out
+// from an event recorded on the source's current stream (which the caller
+// has already made wait on the destination's current stream), and on the
+// way out by making the destination's current stream wait on a completion
+// event from every chunk stream. For blocking copies the source's current
+// stream waits for completion as well, matching the single-memcpy
+// behavior exactly. For non_blocking copies it does not; the caching
+// allocator is informed via recordStream instead, so the source block is
+// not handed out to another user before the chunk streams drain, and
+// compute enqueued on the source's current stream overlaps the transfer.
+constexpr size_t kD2DCopyChunkSize = 32 * 1024 * 1024;
+constexpr size_t kChunkedD2DCopyThreshold = 2 * kD2DCopyChunkSize;
+constexpr int kD2DCopyStreams = 2;
+
+void copy_device_to_device_chunked(
+    TensorIterator& iter,
+    void* dst,
+    void* src,
+    size_t size,
+    bool non_blocking) {
+  Device dst_device = iter.device(0);
+  Device src_device = iter.device(1);
+  CUDAStream copy_stream = getCurrentCUDAStream(src_device.index());
+
+  // Fan out: the chunk streams inherit both the production of src and the
+  // barrier against the destination's current stream set up by our caller.
+  CUDAEvent src_ready;
+  src_ready.record(copy_stream);
+
+  std::vector<CUDAStream> chunk_streams;
+  chunk_streams.reserve(kD2DCopyStreams);
+  for (int i = 0; i < kD2DCopyStreams; i++) {
+    chunk_streams.push_back(
+        getStreamFromPool(/*isHighPriority=*/false, src_device.index()));
+    src_ready.block(chunk_streams[i]);
+  }
+
+  char* dst_bytes = static_cast<char*>(dst);
+  char* src_bytes = static_cast<char*>(src);
+  size_t chunk_index = 0;
+  for (size_t offset = 0; offset < size; offset += kD2DCopyChunkSize) {
+    size_t chunk = std::min(kD2DCopyChunkSize, size - offset);
+    AT_CUDA_CHECK(cudaMemcpyAsync(
+        dst_bytes + offset,
+        src_bytes + offset,
+        chunk,
+        cudaMemcpyDeviceToDevice,
+        chunk_streams[chunk_index++ % kD2DCopyStreams]));
+  }
+
+  // Fan in. The destination's current stream always waits for every chunk;
+  // the caller's trailing barrier only covers copy_stream, which no chunk
+  // runs on.
+  CUDAStream dst_stream = getCurrentCUDAStream(dst_device.index());
+  for (int i = 0; i < kD2DCopyStreams; i++) {
+    CUDAEvent chunks_done;
+    chunks_done.record(chunk_streams[i]);
+    chunks_done.block(dst_stream);
+    if (!non_blocking) {
+      chunks_done.block(copy_stream);
+    }
+  }
+  if (non_blocking) {
+    // The source's current stream does not wait for the chunks, so keep
+    // the allocator from reusing the source block while the transfer is in
+    // flight. The destination block needs no recordStream: its reuse is
+    // ordered by the waits inserted on dst_stream above.
+    const auto& src_data = iter.tensor(1).storage().data_ptr();
+    for (int i = 0; i < kD2DCopyStreams; i++) {
+      c10::cuda::CUDACachingAllocator::recordStream(
+          src_data, chunk_streams[i]);
+    }
+  }
+}
+
+// NOTE [ Pinned staging for pageable host copies ]
+//
+// cudaMemcpyAsync to or from pageable host memory falls back to the
+// driver's internal staging buffers and serializes at a fraction of the
+// pinned-path bandwidth. Workloads that continuously copy activations to
+// pageable CPU tensors (logging, checkpointing) pay that tax on every
+// transfer. Transfers at or above kHostStagingThreshold are instead
+// staged through two pinned chunks drawn from the caching host allocator
+// and double-buffered: while the copy engine moves chunk k between the
+// device and one pinned buffer, the host memcpys chunk k-1 (device-to-
+// host) or k+1 (host-to-device) between the other pinned buffer and the
+// pageable tensor, so DMA and the host-side copy overlap and the
+// effective bandwidth approaches the pinned path without any user code
+// changes.
+//
+// The device-to-host direction drains completely before returning (the
+// host memcpy of the last chunk is the final step), so it needs no
+// further synchronization. The host-to-device direction returns with the
+// last DMA still in flight on `stream`; the staging buffers are handed
+// back to the caching host allocator with a recorded event, which defers
+// their reuse until the DMA has drained - the same mechanism the
+// non_blocking path uses for pinned source tensors.
+constexpr size_t kHostStagingChunkSize = 4 * 1024 * 1024;
+constexpr size_t kHostStagingThreshold = 2 * kHostStagingChunkSize;
+
+void copy_staged_through_pinned(
+    void* dst,
+    void* src,
+    size_t size,
+    cudaMemcpyKind kind,
+    CUDAStream stream) {
+  auto* allocator = at::cuda::getPinnedMemoryAllocator();
+  at::DataPtr staging[2] = {
+      allocator->allocate(kHostStagingChunkSize),
+      allocator->allocate(kHostStagingChunkSize)};
+  CUDAEvent events[2];
+
+  char* dst_bytes = static_cast<char*>(dst);
+  char* src_bytes = static_cast<char*>(src);
+  const size_t num_chunks =
+      (size + kHostStagingChunkSize - 1) / kHostStagingChunkSize;
+  const auto chunk_size = [size](size_t i) {
+    return std::min(kHostStagingChunkSize, size - i * kHostStagingChunkSize);
+  };
+
+  if (kind == cudaMemcpyDeviceToHost) {
+    const auto issue = [&](size_t i) {
+      AT_CUDA_CHECK(cudaMemcpyAsync(
+          staging[i % 2].get(),
+          src_bytes + i * kHostStagingChunkSize,
+          chunk_size(i),
+          cudaMemcpyDeviceToHost,
+          stream));
+      events[i % 2].record(stream);
+    };
+    issue(0);
+    for (size_t i = 0; i < num_chunks; i++) {
+      // Chunk i+1 reuses the buffer of chunk i-1, which the host memcpy
+      // of the previous iteration has already consumed.
+      if (i + 1 < num_chunks) {
+        issue(i + 1);
+      }
+      events[i % 2].synchronize();
+      memcpy(
+          dst_bytes + i * kHostStagingChunkSize,
+          staging[i % 2].get(),
+          chunk_size(i));
+    }
+  } else {
+    TORCH_INTERNAL_ASSERT(kind == cudaMemcpyHostToDevice);
+    for (size_t i = 0; i < num_chunks; i++) {
+      if (i >= 2) {
+        // Wait for the buffer's previous DMA before overwriting it.
+        events[i % 2].synchronize();
+      }
+      memcpy(
+          staging[i % 2].get(),
+          src_bytes + i * kHostStagingChunkSize,
+          chunk_size(i));
+      AT_CUDA_CHECK(cudaMemcpyAsync(
+          dst_bytes + i * kHostStagingChunkSize,
+          staging[i % 2].get(),
+          chunk_size(i),
+          cudaMemcpyHostToDevice,
+          stream));
+      events[i % 2].record(stream);
+    }
+    // Keep the allocator from reusing the staging buffers while the last
+    // DMAs are in flight.
+    for (int i = 0; i < 2; i++) {
+      AT_CUDA_CHECK(
+          THCCachingHostAllocator_recordEvent(staging[i].get(), stream));
+    }
+  }
+}
+
+} // namespace
+
 // device-to-device copy, does type conversion
 void copy_device_to_device(TensorIterator& iter, bool non_blocking) {
   int64_t numel = iter.numel();
@@ -54,11 +242,16 @@ void copy_device_to_device(TensorIterator& iter, bool non_blocking) {
     void *src = iter.data_ptr(1);
     size_t size = numel * iter.element_size(0);
     if (src != dst || src_device != dst_device) {
-      // Perform the copy
-      AT_CUDA_CHECK(cudaMemcpyAsync(
-          dst, src, size,
-          cudaMemcpyDeviceToDevice,
-          copy_stream));
+      if (src_device != dst_device && size >= kChunkedD2DCopyThreshold) {
+        // See NOTE [ Chunked cross-device copies ]
+        copy_device_to_device_chunked(iter, dst, src, size, non_blocking);
+      } else {
+        // Perform the copy
+        AT_CUDA_CHECK(cudaMemcpyAsync(
+            dst, src, size,
+            cudaMemcpyDeviceToDevice,
+            copy_stream));
+      }
     }
   } else {
     AT_DISPATCH_ALL_TYPES_AND3(kHalf, kBool, kBFloat16, iter.dtype(0), "copy_", [&] {
@@ -177,6 +370,20 @@ static void copy_kernel_cuda(TensorIterator& iter, bool non_blocking) {
   int64_t nbytes = iter.numel() * iter.element_size(0);
   CUDAStream stream = getCurrentCUDAStream();
 
+  // See NOTE [ Pinned staging for pageable host copies ]
+  const auto& cpu_tensor =
+      dst_device.is_cpu() ? iter.tensor(0) : iter.tensor(1);
+  if (static_cast<size_t>(nbytes) >= kHostStagingThreshold &&
+      !cpu_tensor.is_pinned()) {
+    copy_staged_through_pinned(dst, src, nbytes, kind, stream);
+    if (!non_blocking && kind == cudaMemcpyHostToDevice) {
+      AT_CUDA_CHECK(cudaStreamSynchronize(stream));
+    }
+    // The device-to-host direction has fully drained; there is nothing
+    // left to synchronize or record in either mode.
+    return;
+  }
+
   AT_CUDA_CHECK(cudaMemcpyAsync(dst, src, nbytes, kind, stream));
 
   if (non_blocking) {
@@ -1,7 +1,10 @@
 #include <ATen/ATen.h>
+#include <ATen/AccumulateType.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/Dispatch.h>
+#include <ATen/TensorUtils.h>
 #include <ATen/cuda/CUDAApplyUtils.cuh>
+#include <ATen/cuda/CUDAContext.h>
 #include <ATen/native/TensorIterator.h>
 #include <ATen/native/cuda/Loops.cuh>
 
@@ -40,6 +43,134 @@ void binary_cross_entropy_backward_out_kernel(Tensor& grad_input, const Tensor&
   });
 }
 
+// One block per sample. Each thread keeps an online logsumexp over its
+// strided slice of the logits (rescaling the running sum whenever a new
+// maximum is found), so the row is read exactly once and no
+// [n_classes]-sized intermediate is materialized; the per-thread partials
+// are then combined in shared memory.
+template <typename scalar_t, typename accscalar_t>
+__global__ void cross_entropy_loss_forward_kernel(
+    scalar_t* __restrict__ losses,
+    scalar_t* __restrict__ logsumexp,
+    const scalar_t* __restrict__ input,
+    const int64_t* __restrict__ target,
+    const scalar_t* __restrict__ weights,
+    int64_t n_classes,
+    int64_t ignore_index) {
+  extern __shared__ unsigned char smem[];
+  accscalar_t* shared_max = reinterpret_cast<accscalar_t*>(smem);
+  accscalar_t* shared_sum = shared_max + blockDim.x;
+
+  const int64_t row = blockIdx.x;
+  const scalar_t* input_row = input + row * n_classes;
+
+  accscalar_t max = -INFINITY;
+  accscalar_t sum = 0;
+  for (int64_t j = threadIdx.x; j < n_classes; j += blockDim.x) {
+    const accscalar_t x = static_cast<accscalar_t>(input_row[j]);
+    if (x > max) {
+      sum = sum * ::exp(max - x) + static_cast<accscalar_t>(1);
+      max = x;
+    } else {
+      sum += ::exp(x - max);
+    }
+  }
+  shared_max[threadIdx.x] = max;
+  shared_sum[threadIdx.x] = sum;
+  __syncthreads();
+  for (unsigned int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+    if (threadIdx.x < stride) {
+      const accscalar_t other_max = shared_max[threadIdx.x + stride];
+      const accscalar_t other_sum = shared_sum[threadIdx.x + stride];
+      if (other_max > shared_max[threadIdx.x]) {
+        shared_sum[threadIdx.x] = shared_sum[threadIdx.x] *
+                ::exp(shared_max[threadIdx.x] - other_max) +
+            other_sum;
+        shared_max[threadIdx.x] = other_max;
+      } else if (other_sum != static_cast<accscalar_t>(0)) {
+        // the guard keeps exp(-inf - -inf) out of empty partials
+        shared_sum[threadIdx.x] +=
+            other_sum * ::exp(other_max - shared_max[threadIdx.x]);
+      }
+    }
+    __syncthreads();
+  }
+  if (threadIdx.x == 0) {
+    const accscalar_t lse = shared_max[0] + ::log(shared_sum[0]);
+    logsumexp[row] = static_cast<scalar_t>(lse);
+    const int64_t cur_target = target[row];
+    if (cur_target == ignore_index) {
+      losses[row] = static_cast<scalar_t>(0);
+      return;
+    }
+    CUDA_KERNEL_ASSERT(cur_target >= 0 && cur_target < n_classes);
+    const accscalar_t w = weights != nullptr
+        ? static_cast<accscalar_t>(weights[cur_target])
+        : static_cast<accscalar_t>(1);
+    losses[row] = static_cast<scalar_t>(
+        (lse - static_cast<accscalar_t>(input_row[cur_target])) * w);
+  }
+}
+
+template <typename scalar_t, typename accscalar_t>
+__global__ void cross_entropy_loss_backward_kernel(
+    scalar_t* __restrict__ grad_input,
+    const scalar_t* __restrict__ grad_coeff, // per-sample, or a single element
+    bool per_sample,
+    const scalar_t* __restrict__ input,
+    const int64_t* __restrict__ target,
+    const scalar_t* __restrict__ logsumexp,
+    const scalar_t* __restrict__ weights,
+    int64_t n_classes,
+    int64_t numel,
+    int64_t ignore_index) {
+  for (int64_t idx = blockIdx.x * blockDim.x + threadIdx.x; idx < numel;
+       idx += static_cast<int64_t>(gridDim.x) * blockDim.x) {
+    const int64_t row = idx / n_classes;
+    const int64_t j = idx % n_classes;
+    const int64_t cur_target = target[row];
+    if (cur_target == ignore_index) {
+      grad_input[idx] = static_cast<scalar_t>(0);
+      continue;
+    }
+    accscalar_t coeff = weights != nullptr
+        ? static_cast<accscalar_t>(weights[cur_target])
+        : static_cast<accscalar_t>(1);
+    coeff *= static_cast<accscalar_t>(per_sample ? grad_coeff[row] : *grad_coeff);
+    // softmax recovered from the saved per-row logsumexp
+    const accscalar_t p = ::exp(
+        static_cast<accscalar_t>(input[idx]) -
+        static_cast<accscalar_t>(logsumexp[row]));
+    grad_input[idx] = static_cast<scalar_t>(
+        coeff * (p - static_cast<accscalar_t>(j == cur_target)));
+  }
+}
+
+void cross_entropy_loss_shape_check(
+    const Tensor& input,
+    const Tensor& target,
+    const Tensor& weight) {
+  TORCH_CHECK(
+      input.dim() == 2, "2D input tensor expected, got: ", input.sizes());
+  TORCH_CHECK(
+      target.dim() == 1,
+      "1D target tensor expected, multi-target not supported");
+  TORCH_CHECK(
+      input.size(0) == target.size(0),
+      "size mismatch (got input: ",
+      input.sizes(),
+      ", target: ",
+      target.sizes(),
+      ")")
+  TORCH_CHECK(
+      !weight.defined() || weight.numel() == input.size(-1),
+      "weight tensor should be defined either for all ",
+      input.size(-1),
+      " classes or no classes"
+      " but got weight tensor of shape: ",
+      weight.sizes());
+}
+
 } // namespace
 
 namespace at { namespace native {
@@ -130,4 +261,120 @@ Tensor& binary_cross_entropy_backward_out_cuda(Tensor& grad_input, const Tensor&
   return grad_input;
 }
 
+std::tuple<Tensor, Tensor, Tensor> cross_entropy_loss_forward_cuda(
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& weight,
+    int64_t reduction,
+    int64_t ignore_index) {
+  cross_entropy_loss_shape_check(self, target, weight);
+
+  const auto batch_size = self.size(0);
+  const auto n_classes = self.size(1);
+
+  auto input_contiguous = self.contiguous();
+  auto target_contiguous = target.contiguous();
+  auto weight_contiguous = weight.defined() ? weight.contiguous() : weight;
+
+  auto losses = at::empty({batch_size}, self.options());
+  auto logsumexp = at::empty({batch_size}, self.options());
+
+  if (batch_size > 0) {
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+    AT_DISPATCH_FLOATING_TYPES_AND_HALF(
+        self.scalar_type(), "cross_entropy_loss_forward_cuda", [&] {
+          using accscalar_t = at::acc_type<scalar_t, true>;
+          constexpr int threads = 1024;
+          cross_entropy_loss_forward_kernel<scalar_t, accscalar_t>
+              <<<batch_size,
+                 threads,
+                 2 * threads * sizeof(accscalar_t),
+                 stream>>>(
+                  losses.data_ptr<scalar_t>(),
+                  logsumexp.data_ptr<scalar_t>(),
+                  input_contiguous.data_ptr<scalar_t>(),
+                  target_contiguous.data_ptr<int64_t>(),
+                  weight.defined() ? weight_contiguous.data_ptr<scalar_t>()
+                                   : nullptr,
+                  n_classes,
+                  ignore_index);
+          AT_CUDA_CHECK(cudaGetLastError()); // catch launch errors
+        });
+  }
+
+  if (reduction == Reduction::None) {
+    return std::make_tuple(losses, logsumexp, at::zeros({}, self.options()));
+  }
+
+  // batch-sized reduction glue; all [batch, n_classes] traffic stays in the
+  // kernel above
+  auto valid = target_contiguous.ne(ignore_index);
+  Tensor total_weight = weight.defined()
+      ? weight_contiguous
+            .index_select(0, target_contiguous.masked_select(valid))
+            .sum()
+      : valid.sum().to(self.scalar_type());
+  Tensor output = losses.sum();
+  if (reduction == Reduction::Mean) {
+    output = output / total_weight;
+  }
+  return std::make_tuple(output, logsumexp, total_weight);
+}
+
+Tensor cross_entropy_loss_backward_cuda(
+    const Tensor& grad_output,
+    const Tensor& self,
+    const Tensor& target,
+    const Tensor& logsumexp,
+    const Tensor& weight,
+    int64_t reduction,
+    int64_t ignore_index,
+    const Tensor& total_weight) {
+  cross_entropy_loss_shape_check(self, target, weight);
+
+  auto input_contiguous = self.contiguous();
+  auto target_contiguous = target.contiguous();
+  auto logsumexp_contiguous = logsumexp.contiguous();
+  auto weight_contiguous = weight.defined() ? weight.contiguous() : weight;
+
+  const bool per_sample = reduction == Reduction::None;
+  Tensor grad_coeff;
+  if (per_sample) {
+    check_dim_size(grad_output, 1, 0, self.size(0));
+    grad_coeff = grad_output.contiguous();
+  } else if (reduction == Reduction::Mean) {
+    grad_coeff = (grad_output / total_weight).contiguous();
+  } else {
+    grad_coeff = grad_output.contiguous();
+  }
+
+  auto grad_input = at::empty_like(self, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  const int64_t numel = grad_input.numel();
+  if (numel > 0) {
+    cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+    AT_DISPATCH_FLOATING_TYPES_AND_HALF(
+        self.scalar_type(), "cross_entropy_loss_backward_cuda", [&] {
+          using accscalar_t = at::acc_type<scalar_t, true>;
+          constexpr int threads = 512;
+          const int blocks = static_cast<int>(
+              std::min<int64_t>((numel + threads - 1) / threads, 4096));
+          cross_entropy_loss_backward_kernel<scalar_t, accscalar_t>
+              <<<blocks, threads, 0, stream>>>(
+                  grad_input.data_ptr<scalar_t>(),
+                  grad_coeff.data_ptr<scalar_t>(),
+                  per_sample,
+                  input_contiguous.data_ptr<scalar_t>(),
+                  target_contiguous.data_ptr<int64_t>(),
+                  logsumexp_contiguous.data_ptr<scalar_t>(),
+                  weight.defined() ? weight_contiguous.data_ptr<scalar_t>()
+                                   : nullptr,
+                  self.size(1),
+                  numel,
+                  ignore_index);
+          AT_CUDA_CHECK(cudaGetLastError()); // catch launch errors
+        });
+  }
+  return grad_input;
+}
+
 }}  // namespace at::native
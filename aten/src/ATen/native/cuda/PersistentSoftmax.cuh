@@ -30,6 +30,31 @@ struct Max {
   }
 };
 
+// Generates a single vectorized load/store instruction when N > 1. The
+// pointers must be aligned to N * sizeof(T); the host-side dispatch methods
+// below only select the vectorized kernels when that holds.
+template <typename T, int N>
+struct alignas(sizeof(T) * N) aligned_vector {
+    T val[N];
+};
+
+template <typename T, int N>
+__device__ __forceinline__ void copy_vector(T *dst, const T *src) {
+    *reinterpret_cast<aligned_vector<T, N>*>(dst) =
+        *reinterpret_cast<const aligned_vector<T, N>*>(src);
+}
+
+// How many elements a thread moves per load/store instruction. Must divide
+// WARP_ITERATIONS; capped at 16 bytes, the widest CUDA memory transaction.
+// The host-side dispatch methods mirror this computation to decide whether a
+// row satisfies the divisibility and alignment requirements.
+template <typename input_t>
+C10_HOST_DEVICE constexpr int elements_per_ldg_stg(int warp_iterations, bool is_aligned) {
+    return !is_aligned ? 1
+        : (warp_iterations % 4 == 0 && sizeof(input_t) * 4 <= 16) ? 4
+        : (warp_iterations % 2 == 0) ? 2 : 1;
+}
+
 template <typename acc_t, int WARP_BATCH, int WARP_SIZE, template<typename> class ReduceOp>
 __device__ __forceinline__ void warp_reduce(acc_t* sum) {
     ReduceOp<acc_t> r;
@@ -61,7 +86,7 @@ __device__ __forceinline__ void warp_reduce(acc_t* sum) {
 // input_t=half,  acc_t=float, output_t=float => read half tensor, float accumulators, write float tensor.
 // input_t_float, acc_t=float, output_t=half  => read float tensor, float accumulators, write half tensor.
 
-template <typename input_t, typename output_t, typename acc_t, int log2_elements, bool is_log_softmax>
+template <typename input_t, typename output_t, typename acc_t, int log2_elements, bool is_log_softmax, bool is_aligned>
 __global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batch_size, int stride, int element_count)
 {
     // WARP_SIZE and WARP_BATCH must match the return values batches_per_warp and warp_size of method warp_softmax_forward_kernel.
@@ -69,6 +94,8 @@ __global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batc
     constexpr int WARP_SIZE = (next_power_of_two < C10_WARP_SIZE) ? next_power_of_two : C10_WARP_SIZE;
     constexpr int WARP_ITERATIONS = next_power_of_two / WARP_SIZE;
     constexpr int WARP_BATCH = (next_power_of_two <= 128) ? 2 : 1;
+    constexpr int ELEMENTS_PER_LDG_STG =
+        elements_per_ldg_stg<input_t>(WARP_ITERATIONS, is_aligned);
 
     int first_batch = (blockDim.y * blockIdx.x + threadIdx.y) * WARP_BATCH;
 
@@ -81,8 +108,10 @@ __global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batc
     // there might be multiple batches per warp. compute the index within the batch
     int local_idx = threadIdx.x;
 
-    src += first_batch * stride + local_idx;
-    dst += first_batch * stride + local_idx;
+    // with vectorized accesses each thread owns ELEMENTS_PER_LDG_STG
+    // consecutive elements per iteration instead of a single strided one
+    src += first_batch * stride + ELEMENTS_PER_LDG_STG * local_idx;
+    dst += first_batch * stride + ELEMENTS_PER_LDG_STG * local_idx;
 
     // The nested loops over WARP_BATCH and then WARP_ITERATIONS can be simplified to one loop,
     // but I think doing so would obfuscate the logic of the algorithm, thus I chose to keep
@@ -91,14 +120,25 @@ __global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batc
 
     // load data from global memory
     acc_t elements[WARP_BATCH][WARP_ITERATIONS];
+    aligned_vector<input_t, ELEMENTS_PER_LDG_STG> temp_data;
     for (int i = 0;  i < WARP_BATCH;  ++i) {
         int batch_element_count = (i >= local_batches) ? 0 : element_count;
-        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
-            int element_index = local_idx + it * WARP_SIZE;
+        for (int it = 0;  it < WARP_ITERATIONS;  it += ELEMENTS_PER_LDG_STG) {
+            int element_index = ELEMENTS_PER_LDG_STG * local_idx + it * WARP_SIZE;
+            // when vectorized, element_count is a multiple of
+            // ELEMENTS_PER_LDG_STG, so whole vectors are in or out of bounds
             if (element_index < batch_element_count) {
-                elements[i][it] = src[i*element_count+it*WARP_SIZE];
+                copy_vector<input_t, ELEMENTS_PER_LDG_STG>(
+                    temp_data.val, src + i * element_count + it * WARP_SIZE);
+                #pragma unroll
+                for (int element = 0;  element < ELEMENTS_PER_LDG_STG;  ++element) {
+                    elements[i][it + element] = temp_data.val[element];
+                }
             } else {
-                elements[i][it] = -std::numeric_limits<acc_t>::infinity();
+                #pragma unroll
+                for (int element = 0;  element < ELEMENTS_PER_LDG_STG;  ++element) {
+                    elements[i][it + element] = -std::numeric_limits<acc_t>::infinity();
+                }
             }
         }
     }
@@ -131,20 +171,26 @@ __global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batc
     warp_reduce<acc_t, WARP_BATCH, WARP_SIZE, Add>(sum);
 
     // store result
+    aligned_vector<output_t, ELEMENTS_PER_LDG_STG> temp_out;
     #pragma unroll
     for (int i = 0;  i < WARP_BATCH;  ++i) {
         if (i >= local_batches)
             break;
         if (is_log_softmax) sum[i] = max_value[i] + std::log(sum[i]);
         #pragma unroll
-        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
-            int element_index = local_idx + it * WARP_SIZE;
+        for (int it = 0;  it < WARP_ITERATIONS;  it += ELEMENTS_PER_LDG_STG) {
+            int element_index = ELEMENTS_PER_LDG_STG * local_idx + it * WARP_SIZE;
             if (element_index < element_count) {
-                if (is_log_softmax) {
-                    dst[i*element_count+it*WARP_SIZE] = elements[i][it] - sum[i];
-                } else {
-                    dst[i*element_count+it*WARP_SIZE] = elements[i][it] / sum[i];
+                #pragma unroll
+                for (int element = 0;  element < ELEMENTS_PER_LDG_STG;  ++element) {
+                    if (is_log_softmax) {
+                        temp_out.val[element] = elements[i][it + element] - sum[i];
+                    } else {
+                        temp_out.val[element] = elements[i][it + element] / sum[i];
+                    }
                 }
+                copy_vector<output_t, ELEMENTS_PER_LDG_STG>(
+                    dst + i * element_count + it * WARP_SIZE, temp_out.val);
             } else {
                 break;
             }
@@ -152,7 +198,7 @@ __global__ void softmax_warp_forward(output_t *dst, const input_t *src, int batc
     }
 }
 
-template <typename input_t, typename output_t, typename acc_t, int log2_elements, bool is_log_softmax>
+template <typename input_t, typename output_t, typename acc_t, int log2_elements, bool is_log_softmax, bool is_aligned>
 __global__ void softmax_warp_backward(output_t *gradInput, const input_t *grad, const input_t *output, int batch_size, int stride, int element_count)
 {
     // WARP_SIZE and WARP_BATCH must match the return values batches_per_warp and warp_size of method warp_softmax_backward_kernel.
@@ -160,6 +206,8 @@ __global__ void softmax_warp_backward(output_t *gradInput, const input_t *grad,
     constexpr int WARP_SIZE = (next_power_of_two < C10_WARP_SIZE) ? next_power_of_two : C10_WARP_SIZE;
     constexpr int WARP_ITERATIONS = next_power_of_two / WARP_SIZE;
     constexpr int WARP_BATCH = (next_power_of_two <= 128) ? 2 : 1;
+    constexpr int ELEMENTS_PER_LDG_STG =
+        elements_per_ldg_stg<input_t>(WARP_ITERATIONS, is_aligned);
 
     int first_batch = (blockDim.y * blockIdx.x + threadIdx.y) * WARP_BATCH;
 
@@ -172,8 +220,10 @@ __global__ void softmax_warp_backward(output_t *gradInput, const input_t *grad,
     // there might be multiple batches per warp. compute the index within the batch
     int local_idx = threadIdx.x % WARP_SIZE;
 
-    // the first element to process by the current thread
-    int thread_offset = first_batch * stride + local_idx;
+    // the first element to process by the current thread; with vectorized
+    // accesses each thread owns ELEMENTS_PER_LDG_STG consecutive elements
+    // per iteration instead of a single strided one
+    int thread_offset = first_batch * stride + ELEMENTS_PER_LDG_STG * local_idx;
     grad += thread_offset;
     output += thread_offset;
     gradInput += thread_offset;
@@ -186,16 +236,30 @@ __global__ void softmax_warp_backward(output_t *gradInput, const input_t *grad,
     // load data from global memory
     acc_t grad_reg[WARP_BATCH][WARP_ITERATIONS];
     acc_t output_reg[WARP_BATCH][WARP_ITERATIONS];
+    aligned_vector<input_t, ELEMENTS_PER_LDG_STG> temp_grad;
+    aligned_vector<input_t, ELEMENTS_PER_LDG_STG> temp_output;
     for (int i = 0;  i < WARP_BATCH;  ++i) {
         int batch_element_count = (i >= local_batches) ? 0 : element_count;
-        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
-            int element_index = local_idx + it * WARP_SIZE;
+        for (int it = 0;  it < WARP_ITERATIONS;  it += ELEMENTS_PER_LDG_STG) {
+            int element_index = ELEMENTS_PER_LDG_STG * local_idx + it * WARP_SIZE;
+            // when vectorized, element_count is a multiple of
+            // ELEMENTS_PER_LDG_STG, so whole vectors are in or out of bounds
             if (element_index < batch_element_count) {
-                grad_reg[i][it] = grad[i*element_count+it*WARP_SIZE];
-                output_reg[i][it] = output[i*element_count+it*WARP_SIZE];
+                copy_vector<input_t, ELEMENTS_PER_LDG_STG>(
+                    temp_grad.val, grad + i * element_count + it * WARP_SIZE);
+                copy_vector<input_t, ELEMENTS_PER_LDG_STG>(
+                    temp_output.val, output + i * element_count + it * WARP_SIZE);
+                #pragma unroll
+                for (int element = 0;  element < ELEMENTS_PER_LDG_STG;  ++element) {
+                    grad_reg[i][it + element] = temp_grad.val[element];
+                    output_reg[i][it + element] = temp_output.val[element];
+                }
             } else {
-                grad_reg[i][it] = acc_t(0);
-                output_reg[i][it] = acc_t(0);
+                #pragma unroll
+                for (int element = 0;  element < ELEMENTS_PER_LDG_STG;  ++element) {
+                    grad_reg[i][it + element] = acc_t(0);
+                    output_reg[i][it + element] = acc_t(0);
+                }
             }
         }
     }
@@ -212,20 +276,26 @@ __global__ void softmax_warp_backward(output_t *gradInput, const input_t *grad,
     warp_reduce<acc_t, WARP_BATCH, WARP_SIZE, Add>(sum);
 
     // store result
+    aligned_vector<output_t, ELEMENTS_PER_LDG_STG> temp_out;
     #pragma unroll
     for (int i = 0;  i < WARP_BATCH;  ++i) {
         if (i >= local_batches)
             break;
         #pragma unroll
-        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
-            int element_index = local_idx + it * WARP_SIZE;
+        for (int it = 0;  it < WARP_ITERATIONS;  it += ELEMENTS_PER_LDG_STG) {
+            int element_index = ELEMENTS_PER_LDG_STG * local_idx + it * WARP_SIZE;
             if (element_index < element_count) {
                 // compute gradients
-                if (is_log_softmax) {
-                    gradInput[i*element_count+it*WARP_SIZE] = (grad_reg[i][it] - std::exp(output_reg[i][it]) * sum[i]);
-                } else {
-                    gradInput[i*element_count+it*WARP_SIZE] = (grad_reg[i][it] - output_reg[i][it] * sum[i]);
+                #pragma unroll
+                for (int element = 0;  element < ELEMENTS_PER_LDG_STG;  ++element) {
+                    if (is_log_softmax) {
+                        temp_out.val[element] = (grad_reg[i][it + element] - std::exp(output_reg[i][it + element]) * sum[i]);
+                    } else {
+                        temp_out.val[element] = (grad_reg[i][it + element] - output_reg[i][it + element] * sum[i]);
+                    }
                 }
+                copy_vector<output_t, ELEMENTS_PER_LDG_STG>(
+                    gradInput + i * element_count + it * WARP_SIZE, temp_out.val);
             }
         }
     }
@@ -256,55 +326,46 @@ void dispatch_softmax_forward(output_t *dst, const input_t *src, int softmax_ele
         int batches_per_block = warps_per_block * batches_per_warp;
         int blocks = (batch_count + batches_per_block - 1) / batches_per_block;
         dim3 threads(warp_size, warps_per_block, 1);
+
+        // This value must match the ELEMENTS_PER_LDG_STG constexpr value
+        // computed inside softmax_warp_forward; vectorized accesses are only
+        // correct when rows are contiguous, a whole number of vectors long
+        // and the pointers are vector-aligned.
+        int warp_iterations = next_power_of_two / warp_size;
+        int elements_per_ldg = elements_per_ldg_stg<input_t>(warp_iterations, true);
+        bool is_aligned = softmax_elements % elements_per_ldg == 0 &&
+            softmax_elements_stride == softmax_elements &&
+            reinterpret_cast<uintptr_t>(src) % (elements_per_ldg * sizeof(input_t)) == 0 &&
+            reinterpret_cast<uintptr_t>(dst) % (elements_per_ldg * sizeof(output_t)) == 0;
+
         // Launch code would be more elegant if C++ supported FOR CONSTEXPR
-        switch (log2_elements) {
-            case 0: // 1
-                softmax_warp_forward<input_t, output_t, acc_t, 0, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 1: // 2
-                softmax_warp_forward<input_t, output_t, acc_t, 1, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 2: // 4
-                softmax_warp_forward<input_t, output_t, acc_t, 2, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 3: // 8
-                softmax_warp_forward<input_t, output_t, acc_t, 3, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 4: // 16
-                softmax_warp_forward<input_t, output_t, acc_t, 4, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 5: // 32
-                softmax_warp_forward<input_t, output_t, acc_t, 5, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 6: // 64
-                softmax_warp_forward<input_t, output_t, acc_t, 6, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 7: // 128
-                softmax_warp_forward<input_t, output_t, acc_t, 7, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 8: // 256
-                softmax_warp_forward<input_t, output_t, acc_t, 8, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 9: // 512
-                softmax_warp_forward<input_t, output_t, acc_t, 9, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 10: // 1024
-                softmax_warp_forward<input_t, output_t, acc_t, 10, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements);
+        #define LAUNCH_SOFTMAX_WARP_FORWARD(L2E)                                   \
+            case L2E:                                                              \
+                if (is_aligned) {                                                  \
+                    softmax_warp_forward<input_t, output_t, acc_t, L2E, is_log_softmax, true>  \
+                        <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements); \
+                } else {                                                           \
+                    softmax_warp_forward<input_t, output_t, acc_t, L2E, is_log_softmax, false> \
+                        <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst, src, batch_count, softmax_elements_stride, softmax_elements); \
+                }                                                                  \
                 break;
+
+        switch (log2_elements) {
+            LAUNCH_SOFTMAX_WARP_FORWARD(0);  // 1
+            LAUNCH_SOFTMAX_WARP_FORWARD(1);  // 2
+            LAUNCH_SOFTMAX_WARP_FORWARD(2);  // 4
+            LAUNCH_SOFTMAX_WARP_FORWARD(3);  // 8
+            LAUNCH_SOFTMAX_WARP_FORWARD(4);  // 16
+            LAUNCH_SOFTMAX_WARP_FORWARD(5);  // 32
+            LAUNCH_SOFTMAX_WARP_FORWARD(6);  // 64
+            LAUNCH_SOFTMAX_WARP_FORWARD(7);  // 128
+            LAUNCH_SOFTMAX_WARP_FORWARD(8);  // 256
+            LAUNCH_SOFTMAX_WARP_FORWARD(9);  // 512
+            LAUNCH_SOFTMAX_WARP_FORWARD(10); // 1024
             default:
                 break;
         }
+        #undef LAUNCH_SOFTMAX_WARP_FORWARD
     }
 }
 
@@ -331,55 +392,47 @@ void dispatch_softmax_backward(output_t *grad_input, const input_t *grad, const
         int batches_per_block = warps_per_block * batches_per_warp;
         int blocks = (batch_count + batches_per_block - 1) / batches_per_block;
         dim3 threads(warp_size, warps_per_block, 1);
+
+        // This value must match the ELEMENTS_PER_LDG_STG constexpr value
+        // computed inside softmax_warp_backward; vectorized accesses are only
+        // correct when rows are contiguous, a whole number of vectors long
+        // and the pointers are vector-aligned.
+        int warp_iterations = next_power_of_two / warp_size;
+        int elements_per_ldg = elements_per_ldg_stg<input_t>(warp_iterations, true);
+        bool is_aligned = softmax_elements % elements_per_ldg == 0 &&
+            softmax_elements_stride == softmax_elements &&
+            reinterpret_cast<uintptr_t>(grad) % (elements_per_ldg * sizeof(input_t)) == 0 &&
+            reinterpret_cast<uintptr_t>(output) % (elements_per_ldg * sizeof(input_t)) == 0 &&
+            reinterpret_cast<uintptr_t>(grad_input) % (elements_per_ldg * sizeof(output_t)) == 0;
+
         // Launch code would be more elegant if C++ supported FOR CONSTEXPR
-        switch (log2_elements) {
-            case 0: // 1
-                softmax_warp_backward<input_t, output_t, acc_t, 0, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 1: // 2
-                softmax_warp_backward<input_t, output_t, acc_t, 1, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 2: // 4
-                softmax_warp_backward<input_t, output_t, acc_t, 2, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 3: // 8
-                softmax_warp_backward<input_t, output_t, acc_t, 3, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 4: // 16
-                softmax_warp_backward<input_t, output_t, acc_t, 4, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 5: // 32
-                softmax_warp_backward<input_t, output_t, acc_t, 5, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 6: // 64
-                softmax_warp_backward<input_t, output_t, acc_t, 6, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 7: // 128
-                softmax_warp_backward<input_t, output_t, acc_t, 7, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 8: // 256
-                softmax_warp_backward<input_t, output_t, acc_t, 8, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 9: // 512
-                softmax_warp_backward<input_t, output_t, acc_t, 9, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
-                break;
-            case 10: // 1024
-                softmax_warp_backward<input_t, output_t, acc_t, 10, is_log_softmax>
-                    <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements);
+        #define LAUNCH_SOFTMAX_WARP_BACKWARD(L2E)                                  \
+            case L2E:                                                              \
+                if (is_aligned) {                                                  \
+                    softmax_warp_backward<input_t, output_t, acc_t, L2E, is_log_softmax, true>  \
+                        <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements); \
+                } else {                                                           \
+                    softmax_warp_backward<input_t, output_t, acc_t, L2E, is_log_softmax, false> \
+                        <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(grad_input, grad, output, batch_count, softmax_elements_stride, softmax_elements); \
+                }                                                                  \
                 break;
+
+        switch (log2_elements) {
+            LAUNCH_SOFTMAX_WARP_BACKWARD(0);  // 1
+            LAUNCH_SOFTMAX_WARP_BACKWARD(1);  // 2
+            LAUNCH_SOFTMAX_WARP_BACKWARD(2);  // 4
+            LAUNCH_SOFTMAX_WARP_BACKWARD(3);  // 8
+            LAUNCH_SOFTMAX_WARP_BACKWARD(4);  // 16
+            LAUNCH_SOFTMAX_WARP_BACKWARD(5);  // 32
+            LAUNCH_SOFTMAX_WARP_BACKWARD(6);  // 64
+            LAUNCH_SOFTMAX_WARP_BACKWARD(7);  // 128
+            LAUNCH_SOFTMAX_WARP_BACKWARD(8);  // 256
+            LAUNCH_SOFTMAX_WARP_BACKWARD(9);  // 512
+            LAUNCH_SOFTMAX_WARP_BACKWARD(10); // 1024
             default:
                 break;
         }
+        #undef LAUNCH_SOFTMAX_WARP_BACKWARD
     }
 }
 
@@ -10,6 +10,9 @@ namespace at { namespace native {
 using where_fn = void (*)(TensorIterator &, ScalarType);
 DECLARE_DISPATCH(where_fn, where_kernel);
 
+using clamp_where_fn = void (*)(TensorIterator &, ScalarType, Scalar, Scalar);
+DECLARE_DISPATCH(clamp_where_fn, clamp_where_kernel);
+
 namespace {
 
 void where_kernel_impl(TensorIterator &iter, ScalarType condition_type) {
@@ -30,9 +33,36 @@ void where_kernel_impl(TensorIterator &iter, ScalarType condition_type) {
   });
 }
 
+void clamp_where_kernel_impl(
+    TensorIterator& iter,
+    ScalarType condition_type,
+    Scalar min_scalar,
+    Scalar max_scalar) {
+  AT_DISPATCH_ALL_TYPES_AND(kHalf, iter.dtype(), "clamp_where_cuda", [&] {
+    const scalar_t min_val = min_scalar.to<scalar_t>();
+    const scalar_t max_val = max_scalar.to<scalar_t>();
+    if (condition_type == at::ScalarType::Byte) {
+      gpu_kernel(
+        iter,
+        [=] GPU_LAMBDA (uint8_t cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
+          const scalar_t v = cond_val ? self_val : other_val;
+          return v < min_val ? min_val : (v > max_val ? max_val : v);
+        });
+    } else {
+      gpu_kernel(
+        iter,
+        [=] GPU_LAMBDA (bool cond_val, scalar_t self_val, scalar_t other_val) -> scalar_t {
+          const scalar_t v = cond_val ? self_val : other_val;
+          return v < min_val ? min_val : (v > max_val ? max_val : v);
+        });
+    }
+  });
+}
+
 } // anonymous namespace
 
 
 REGISTER_DISPATCH(where_kernel, &where_kernel_impl);
+REGISTER_DISPATCH(clamp_where_kernel, &clamp_where_kernel_impl);
 
 }} // namespace at::native
@@ -1,10 +1,13 @@
 #include <ATen/ATen.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDACachingAllocator.h>
 #include <THC/THCGeneral.h>
 #include <THC/THCThrustAllocator.cuh>
 #include <thrust/execution_policy.h>
 
+#include <limits>
 #include <tuple>
+#include <type_traits>
 #include <iterator>
 #include <thrust/adjacent_difference.h>
 #include <thrust/unique.h>
@@ -12,11 +15,199 @@
 #include <thrust/scan.h>
 #include <thrust/scatter.h>
 
+#include <cub/cub.cuh>
+
 namespace at {
 namespace native{
 
 namespace {
 
+// Runs a two-phase cub device-wide algorithm. The temporary storage comes
+// from the caching allocator, whose stream-local free list hands the same
+// block back on every iteration of a steady-state loop (e.g. a unique()
+// call per training step), so no cudaMalloc or synchronization is paid
+// after warmup.
+#define CUB_WRAPPER(func, ...)                                            \
+  do {                                                                    \
+    size_t temp_storage_bytes = 0;                                        \
+    AT_CUDA_CHECK(func(nullptr, temp_storage_bytes, __VA_ARGS__));        \
+    auto temp_storage =                                                   \
+        c10::cuda::CUDACachingAllocator::get()->allocate(                 \
+            temp_storage_bytes);                                          \
+    AT_CUDA_CHECK(func(temp_storage.get(), temp_storage_bytes,            \
+                       __VA_ARGS__));                                     \
+  } while (false)
+
+// cub's radix sort handles the types it has bit-twiddling Traits for:
+// integral keys and IEEE float/double. at::Half stays on the thrust
+// comparison sort.
+template <typename scalar_t>
+using cub_sortable = std::integral_constant<
+    bool,
+    std::is_integral<scalar_t>::value ||
+        std::is_same<scalar_t, float>::value ||
+        std::is_same<scalar_t, double>::value>;
+
+constexpr int kUniqueBlockSize = 512;
+
+template <typename scalar_t>
+__global__ void unique_inv_flags_kernel(
+    const scalar_t* data,
+    const int64_t num_inp,
+    int64_t* flags) {
+  const int64_t i =
+      static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i < num_inp) {
+    flags[i] = (i > 0 && data[i] != data[i - 1]) ? 1 : 0;
+  }
+}
+
+__global__ void unique_scatter_inv_kernel(
+    const int64_t* inv_loc,
+    const int64_t* sorted_indices,
+    const int64_t num_inp,
+    int64_t* inverse_indices) {
+  const int64_t i =
+      static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+  if (i < num_inp) {
+    inverse_indices[sorted_indices[i]] = inv_loc[i];
+  }
+}
+
+// cub-based flat unique: DeviceRadixSort for the sort,
+// DeviceSelect::Unique/DeviceRunLengthEncode::Encode for the
+// unique/counts pass. Unlike the thrust path, which synchronizes in every
+// algorithm it calls, this path synchronizes exactly once, to read back
+// the number of unique elements.
+template <typename scalar_t>
+std::tuple<Tensor, Tensor, Tensor> unique_cuda_cub_template(
+  const Tensor& self,
+  const bool consecutive,
+  const bool return_inverse,
+  const bool return_counts
+) {
+  cudaStream_t stream = at::cuda::getCurrentCUDAStream();
+  auto options = self.options().dtype(kLong);
+  Tensor input = self.clone(at::MemoryFormat::Contiguous).reshape(-1);
+  int64_t num_inp = input.numel();
+
+  if (num_inp == 0) {
+    Tensor output = at::empty({0}, self.options());
+    Tensor inverse_indices = at::empty({0}, options);
+    if (return_inverse) {
+      inverse_indices.resize_(self.sizes());
+    }
+    Tensor counts = at::empty({0}, options);
+    return std::tuple<Tensor, Tensor, Tensor>(output, inverse_indices, counts);
+  }
+
+  const int num_items = static_cast<int>(num_inp);
+
+  // Sorts the data (and, if the inverse mapping is requested, an index
+  // tensor alongside it). The radix sort does not work in place, so the
+  // sorted run lands in a second buffer.
+  Tensor sorted;
+  Tensor sorted_indices;
+  if (consecutive) {
+    sorted = input;
+    if (return_inverse) {
+      sorted_indices = at::arange(0, num_inp, options);
+    }
+  } else {
+    sorted = at::empty_like(input);
+    if (return_inverse) {
+      Tensor range = at::arange(0, num_inp, options);
+      sorted_indices = at::empty({num_inp}, options);
+      CUB_WRAPPER(
+          cub::DeviceRadixSort::SortPairs,
+          input.data_ptr<scalar_t>(),
+          sorted.data_ptr<scalar_t>(),
+          range.data_ptr<int64_t>(),
+          sorted_indices.data_ptr<int64_t>(),
+          num_items,
+          0,
+          sizeof(scalar_t) * 8,
+          stream);
+    } else {
+      CUB_WRAPPER(
+          cub::DeviceRadixSort::SortKeys,
+          input.data_ptr<scalar_t>(),
+          sorted.data_ptr<scalar_t>(),
+          num_items,
+          0,
+          sizeof(scalar_t) * 8,
+          stream);
+    }
+  }
+  scalar_t* sorted_data = sorted.data_ptr<scalar_t>();
+
+  // inverse indices: flag run boundaries, prefix-sum the flags into dense
+  // ids and scatter them back through the sort permutation
+  Tensor inverse_indices;
+  if (!return_inverse) {
+    inverse_indices = at::empty({0}, options);
+  } else {
+    const int64_t num_blocks =
+        (num_inp + kUniqueBlockSize - 1) / kUniqueBlockSize;
+    Tensor inv_loc = at::empty({num_inp}, options);
+    inverse_indices = at::empty({num_inp}, options);
+    int64_t* inv_loc_ptr = inv_loc.data_ptr<int64_t>();
+    unique_inv_flags_kernel<scalar_t>
+        <<<num_blocks, kUniqueBlockSize, 0, stream>>>(
+            sorted_data, num_inp, inv_loc_ptr);
+    CUB_WRAPPER(
+        cub::DeviceScan::InclusiveSum,
+        inv_loc_ptr,
+        inv_loc_ptr,
+        num_items,
+        stream);
+    unique_scatter_inv_kernel<<<num_blocks, kUniqueBlockSize, 0, stream>>>(
+        inv_loc_ptr,
+        sorted_indices.data_ptr<int64_t>(),
+        num_inp,
+        inverse_indices.data_ptr<int64_t>());
+  }
+
+  // unique values and counts
+  Tensor output = at::empty({num_inp}, self.options());
+  Tensor counts = at::empty({0}, options);
+  Tensor num_out_tensor = at::empty({1}, self.options().dtype(kInt));
+  int* num_out_ptr = num_out_tensor.data_ptr<int>();
+  if (!return_counts) {
+    CUB_WRAPPER(
+        cub::DeviceSelect::Unique,
+        sorted_data,
+        output.data_ptr<scalar_t>(),
+        num_out_ptr,
+        num_items,
+        stream);
+  } else {
+    counts.resize_(num_inp);
+    CUB_WRAPPER(
+        cub::DeviceRunLengthEncode::Encode,
+        sorted_data,
+        output.data_ptr<scalar_t>(),
+        counts.data_ptr<int64_t>(),
+        num_out_ptr,
+        num_items,
+        stream);
+  }
+  AT_CUDA_CHECK(cudaGetLastError());
+
+  // The only synchronization of this path: the output sizes are
+  // data-dependent, so the run count has to come back to the host.
+  const int64_t num_out = num_out_tensor.item<int>();
+  output.resize_(num_out);
+  if (return_counts) {
+    counts.resize_(num_out);
+  }
+  if (return_inverse) {
+    inverse_indices.resize_(self.sizes());
+  }
+
+  return std::tuple<Tensor, Tensor, Tensor>(output, inverse_indices, counts);
+}
+
 
 template <
   typename policy_t, typename scalar_t,
@@ -72,7 +263,7 @@ std::tuple<Tensor, Tensor, int64_t> compute_unique(
 }
 
 template <typename scalar_t>
-std::tuple<Tensor, Tensor, Tensor> unique_cuda_template(
+std::tuple<Tensor, Tensor, Tensor> unique_cuda_thrust_template(
   const Tensor& self,
   const bool consecutive,
   const bool return_inverse,
@@ -118,6 +309,39 @@ std::tuple<Tensor, Tensor, Tensor> unique_cuda_template(
   return std::tuple<Tensor, Tensor, Tensor>(output, inverse_indices, counts);
 }
 
+// Flat unique takes the cub path whenever the radix sort understands the
+// key type; cub's device-wide entry points take int sizes, so inputs past
+// INT_MAX elements (and at::Half) fall back to thrust.
+template <
+    typename scalar_t,
+    typename std::enable_if<cub_sortable<scalar_t>::value, int>::type = 0>
+std::tuple<Tensor, Tensor, Tensor> unique_cuda_template(
+  const Tensor& self,
+  const bool consecutive,
+  const bool return_inverse,
+  const bool return_counts
+) {
+  if (self.numel() <= std::numeric_limits<int>::max()) {
+    return unique_cuda_cub_template<scalar_t>(
+        self, consecutive, return_inverse, return_counts);
+  }
+  return unique_cuda_thrust_template<scalar_t>(
+      self, consecutive, return_inverse, return_counts);
+}
+
+template <
+    typename scalar_t,
+    typename std::enable_if<!cub_sortable<scalar_t>::value, int>::type = 0>
+std::tuple<Tensor, Tensor, Tensor> unique_cuda_template(
+  const Tensor& self,
+  const bool consecutive,
+  const bool return_inverse,
+  const bool return_counts
+) {
+  return unique_cuda_thrust_template<scalar_t>(
+      self, consecutive, return_inverse, return_counts);
+}
+
 template <typename scalar_t>
 std::tuple<Tensor, Tensor, Tensor> unique_dim_cuda_template(
   const Tensor& self,
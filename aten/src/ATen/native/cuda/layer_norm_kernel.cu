@@ -96,6 +96,87 @@ __global__ void LayerNormForwardCUDAKernel(
   }
 }
 
+template <typename T>
+__global__ void ResidualRowwiseMomentsCUDAKernel(
+    int64_t N,
+    T eps,
+    const T* X,
+    const T* R,
+    const T* mask,
+    acc_type<T, true> dropout_scale,
+    T* Z,
+    T* mean,
+    T* rstd) {
+  using T_ACC = acc_type<T, true>;
+  __shared__ T_ACC m_shared[C10_WARP_SIZE];
+  __shared__ T_ACC v_shared[C10_WARP_SIZE];
+  const int64_t i = blockIdx.x;
+  T_ACC sum1 = 0;
+  T_ACC sum2 = 0;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    const int64_t index = i * N + j;
+    T_ACC z = static_cast<T_ACC>(X[index]);
+    if (mask != nullptr) {
+      z *= static_cast<T_ACC>(mask[index]) * dropout_scale;
+    }
+    z += static_cast<T_ACC>(R[index]);
+    Z[index] = z;
+    sum1 += z;
+    sum2 += z * z;
+  }
+  sum1 = BlockReduceSum<T_ACC>(sum1, m_shared);
+  sum2 = BlockReduceSum<T_ACC>(sum2, v_shared);
+  if (threadIdx.x == 0) {
+    const T_ACC scale = T_ACC(1) / static_cast<T_ACC>(N);
+    sum1 *= scale;
+    sum2 = c10::cuda::compat::max(sum2 * scale - sum1 * sum1, T_ACC(0));
+    mean[i] = sum1;
+    rstd[i] = c10::cuda::compat::rsqrt(sum2 + static_cast<T_ACC>(eps));
+  }
+}
+
+template <typename T>
+__global__ void EmbeddingRowwiseMomentsCUDAKernel(
+    int64_t N,
+    int64_t L,
+    int64_t num_weights,
+    T eps,
+    const T* weight,
+    const int64_t* indices,
+    const T* pos_weight,
+    T* Z,
+    T* mean,
+    T* rstd) {
+  using T_ACC = acc_type<T, true>;
+  __shared__ T_ACC m_shared[C10_WARP_SIZE];
+  __shared__ T_ACC v_shared[C10_WARP_SIZE];
+  const int64_t i = blockIdx.x;
+  const int64_t idx = indices[i];
+  CUDA_KERNEL_ASSERT(idx >= 0 && idx < num_weights);
+  const T* W_row = weight + idx * N;
+  const T* P_row = pos_weight == nullptr ? nullptr : pos_weight + (i % L) * N;
+  T_ACC sum1 = 0;
+  T_ACC sum2 = 0;
+  for (int64_t j = threadIdx.x; j < N; j += blockDim.x) {
+    T_ACC z = static_cast<T_ACC>(W_row[j]);
+    if (P_row != nullptr) {
+      z += static_cast<T_ACC>(P_row[j]);
+    }
+    Z[i * N + j] = z;
+    sum1 += z;
+    sum2 += z * z;
+  }
+  sum1 = BlockReduceSum<T_ACC>(sum1, m_shared);
+  sum2 = BlockReduceSum<T_ACC>(sum2, v_shared);
+  if (threadIdx.x == 0) {
+    const T_ACC scale = T_ACC(1) / static_cast<T_ACC>(N);
+    sum1 *= scale;
+    sum2 = c10::cuda::compat::max(sum2 * scale - sum1 * sum1, T_ACC(0));
+    mean[i] = sum1;
+    rstd[i] = c10::cuda::compat::rsqrt(sum2 + static_cast<T_ACC>(eps));
+  }
+}
+
 template <typename T>
 __global__ void ComputeInternalGradientsCUDAKernel(
     int64_t N,
@@ -325,6 +406,157 @@ void LayerNormKernelImpl(
       });
 }
 
+template <typename T>
+void ResidualLayerNormKernelImplInternal(
+    const Tensor& X,
+    const Tensor& R,
+    const Tensor& mask,
+    double dropout_scale,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    T eps,
+    Tensor* Y) {
+  using T_ACC = acc_type<T, true>;
+  DCHECK_EQ(X.numel(), M * N);
+  DCHECK_EQ(R.numel(), M * N);
+  DCHECK(!mask.defined() || mask.numel() == M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  const T* X_data = X.data_ptr<T>();
+  const T* R_data = R.data_ptr<T>();
+  const T* mask_data = mask.defined() ? mask.data_ptr<T>() : nullptr;
+  const T* gamma_data = gamma.defined() ? gamma.data_ptr<T>() : nullptr;
+  const T* beta_data = beta.defined() ? beta.data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  Tensor mean = at::empty({M}, X.options());
+  Tensor rstd = at::empty({M}, X.options());
+  T* mean_data = mean.data_ptr<T>();
+  T* rstd_data = rstd.data_ptr<T>();
+  cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+  // The moments kernel materializes dropout + residual add into Y while
+  // reducing, then the forward kernel normalizes Y in place, so the fused
+  // row only makes one extra trip through memory instead of two full
+  // intermediate tensors.
+  ResidualRowwiseMomentsCUDAKernel<T>
+      <<<M, kCUDABlockReduceNumThreads, 0, cuda_stream>>>(
+          N,
+          eps,
+          X_data,
+          R_data,
+          mask_data,
+          static_cast<T_ACC>(dropout_scale),
+          Y_data,
+          mean_data,
+          rstd_data);
+  LayerNormForwardCUDAKernel<T><<<M, kCUDANumThreads, 0, cuda_stream>>>(
+      N, Y_data, mean_data, rstd_data, gamma_data, beta_data, Y_data);
+  AT_CUDA_CHECK(cudaGetLastError());
+}
+
+void ResidualLayerNormKernelImpl(
+    const Tensor& X,
+    const Tensor& R,
+    const Tensor& mask,
+    double dropout_scale,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y) {
+  AT_DISPATCH_FLOATING_TYPES_AND_HALF(
+      X.scalar_type(), "ResidualLayerNormKernelImpl", [&]() {
+        ResidualLayerNormKernelImplInternal<scalar_t>(
+            X,
+            R,
+            mask,
+            dropout_scale,
+            gamma,
+            beta,
+            M,
+            N,
+            static_cast<scalar_t>(eps),
+            Y);
+      });
+}
+
+template <typename T>
+void EmbeddingLayerNormKernelImplInternal(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    int64_t L,
+    T eps,
+    Tensor* Y) {
+  DCHECK_EQ(indices.numel(), M);
+  DCHECK_EQ(weight.size(1), N);
+  DCHECK(!pos_weight.defined() || pos_weight.size(1) == N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  const T* weight_data = weight.data_ptr<T>();
+  const int64_t* indices_data = indices.data_ptr<int64_t>();
+  const T* pos_data = pos_weight.defined() ? pos_weight.data_ptr<T>() : nullptr;
+  const T* gamma_data = gamma.defined() ? gamma.data_ptr<T>() : nullptr;
+  const T* beta_data = beta.defined() ? beta.data_ptr<T>() : nullptr;
+  T* Y_data = Y->data_ptr<T>();
+  Tensor mean = at::empty({M}, weight.options());
+  Tensor rstd = at::empty({M}, weight.options());
+  T* mean_data = mean.data_ptr<T>();
+  T* rstd_data = rstd.data_ptr<T>();
+  cudaStream_t cuda_stream = at::cuda::getCurrentCUDAStream();
+  // The moments kernel gathers the embedding row and adds the positional row
+  // straight into Y while reducing, then the forward kernel normalizes Y in
+  // place, so the fused stage never materializes the pre-norm activations.
+  EmbeddingRowwiseMomentsCUDAKernel<T>
+      <<<M, kCUDABlockReduceNumThreads, 0, cuda_stream>>>(
+          N,
+          L,
+          weight.size(0),
+          eps,
+          weight_data,
+          indices_data,
+          pos_data,
+          Y_data,
+          mean_data,
+          rstd_data);
+  LayerNormForwardCUDAKernel<T><<<M, kCUDANumThreads, 0, cuda_stream>>>(
+      N, Y_data, mean_data, rstd_data, gamma_data, beta_data, Y_data);
+  AT_CUDA_CHECK(cudaGetLastError());
+}
+
+void EmbeddingLayerNormKernelImpl(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    int64_t L,
+    double eps,
+    Tensor* Y) {
+  AT_DISPATCH_FLOATING_TYPES_AND_HALF(
+      weight.scalar_type(), "EmbeddingLayerNormKernelImpl", [&]() {
+        EmbeddingLayerNormKernelImplInternal<scalar_t>(
+            weight,
+            indices,
+            pos_weight,
+            gamma,
+            beta,
+            M,
+            N,
+            L,
+            static_cast<scalar_t>(eps),
+            Y);
+      });
+}
+
 template <typename T>
 void LayerNormBackwardKernelImplInternal(
     const Tensor& dY,
@@ -488,6 +720,8 @@ std::tuple<Tensor, Tensor, Tensor> layer_norm_backward_cuda(
 
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+REGISTER_DISPATCH(ResidualLayerNormKernel, &ResidualLayerNormKernelImpl);
+REGISTER_DISPATCH(EmbeddingLayerNormKernel, &EmbeddingLayerNormKernelImpl);
 
 } // namespace native
 } // namespace at
@@ -12,6 +12,7 @@
 #include <ATen/Config.h>
 #include <ATen/NativeFunctions.h>
 #include <ATen/Parallel.h>
+#include <ATen/TensorUtils.h>
 
 namespace at {
 namespace native {
@@ -122,8 +123,183 @@ Tensor layer_norm(
   return std::get<0>(at::native_layer_norm(X, gamma, beta, M, N, eps));
 }
 
+// Fused dropout + residual add + layer_norm, i.e. the epilogue of a
+// transformer residual block:
+//
+//   layer_norm(dropout(input, dropout_p, train) + residual)
+//
+// Run as separate ops this trio dispatches three kernels and materializes
+// two full intermediate tensors; the fused kernel reads each row once and
+// writes only the final output. The dropout mask is still sampled with the
+// regular bernoulli_ path so RNG behavior matches at::dropout.
+Tensor _residual_layer_norm(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const Tensor& weight /* optional */,
+    const Tensor& bias /* optional */,
+    double eps,
+    double dropout_p,
+    bool train) {
+  const int normalized_ndim = normalized_shape.size();
+  TORCH_CHECK(
+      normalized_ndim >= 1,
+      "Expected normalized_shape to be at least 1-dimensional, i.e., ",
+      "containing at least one element, but got normalized_shape = ",
+      normalized_shape);
+  TORCH_CHECK(
+      !weight.defined() || weight.sizes().equals(normalized_shape),
+      "Expected weight to be of same shape as normalized_shape, but got ",
+      "weight of shape ",
+      weight.sizes(),
+      " and normalized_shape = ",
+      normalized_shape);
+  TORCH_CHECK(
+      !bias.defined() || bias.sizes().equals(normalized_shape),
+      "Expected bias to be of same shape as normalized_shape, but got ",
+      "bias of shape ",
+      bias.sizes(),
+      " and normalized_shape = ",
+      normalized_shape);
+  TORCH_CHECK(
+      residual.sizes().equals(input.sizes()),
+      "Expected residual to be of same shape as input, but got residual of ",
+      "shape ",
+      residual.sizes(),
+      " and input of shape ",
+      input.sizes());
+  TORCH_CHECK(
+      dropout_p >= 0 && dropout_p <= 1,
+      "dropout probability has to be between 0 and 1, but got ",
+      dropout_p);
+
+  const auto input_shape = input.sizes();
+  const auto input_ndim = input.dim();
+
+  if (input_ndim < normalized_ndim ||
+      !input_shape.slice(input_ndim - normalized_ndim)
+           .equals(normalized_shape)) {
+    std::stringstream ss;
+    ss << "Given normalized_shape=" << normalized_shape
+       << ", expected input with shape [*";
+    for (auto size : normalized_shape) {
+      ss << ", " << size;
+    }
+    ss << "], but got input of size" << input_shape;
+    AT_ERROR(ss.str());
+  }
+
+  const int axis = input_ndim - normalized_ndim;
+  const int64_t M = std::accumulate(
+      input_shape.cbegin(),
+      input_shape.cbegin() + axis,
+      1LL,
+      std::multiplies<int64_t>());
+  const int64_t N = std::accumulate(
+      input_shape.cbegin() + axis,
+      input_shape.cend(),
+      1LL,
+      std::multiplies<int64_t>());
+
+  const auto& X = input.is_contiguous() ? input : input.contiguous();
+  const auto& R = residual.is_contiguous() ? residual : residual.contiguous();
+  const auto& gamma = weight.is_contiguous() ? weight : weight.contiguous();
+  const auto& beta = bias.is_contiguous() ? bias : bias.contiguous();
+
+  Tensor mask;
+  double dropout_scale = 1.0;
+  if (train && dropout_p > 0) {
+    mask = at::empty_like(X, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+    mask.bernoulli_(1 - dropout_p);
+    dropout_scale = dropout_p == 1 ? 0.0 : 1.0 / (1.0 - dropout_p);
+  }
+
+  Tensor Y = at::native::empty_like(X, LEGACY_CONTIGUOUS_MEMORY_FORMAT);
+  if (M > 0) {
+    ResidualLayerNormKernel(
+        X.device().type(), X, R, mask, dropout_scale, gamma, beta, M, N, eps, &Y);
+  }
+  return Y;
+}
+
+// Fused embedding lookup + positional add + layer_norm, i.e. the input stage
+// of a transformer:
+//
+//   layer_norm(embedding(indices, weight) + pos_weight[:L], [N])
+//
+// Run as separate ops this stage materializes the [*, N] gathered rows and
+// the positional sum before layer_norm reads them back; the fused kernel
+// gathers each row straight from the tables, adds the positional row and
+// normalizes in one pass, writing only the final output. pos_weight is an
+// optional [max_len, N] table; row i of the (flattened) output adds pos row
+// i % L, where L is the size of the last indices dimension.
+Tensor _embedding_layer_norm(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& pos_weight /* optional */,
+    const Tensor& gamma /* optional */,
+    const Tensor& beta /* optional */,
+    double eps) {
+  auto indices_arg = TensorArg(indices, "indices", 2);
+  checkScalarType("_embedding_layer_norm", indices_arg, kLong);
+  TORCH_CHECK(
+      weight.dim() == 2,
+      "Expected weight to be 2-dimensional, but got weight of shape ",
+      weight.sizes());
+  TORCH_CHECK(
+      indices.dim() >= 1,
+      "Expected indices to be at least 1-dimensional, but got indices of ",
+      "shape ",
+      indices.sizes());
+
+  const int64_t N = weight.size(1);
+  const int64_t M = indices.numel();
+  const int64_t L = indices.size(indices.dim() - 1);
+
+  TORCH_CHECK(
+      !pos_weight.defined() ||
+          (pos_weight.dim() == 2 && pos_weight.size(1) == N &&
+           pos_weight.size(0) >= L),
+      "Expected pos_weight to be of shape [max_len >= ",
+      L,
+      ", ",
+      N,
+      "], but got pos_weight of shape ",
+      pos_weight.sizes());
+  TORCH_CHECK(
+      !gamma.defined() || gamma.numel() == N,
+      "Expected weight (gamma) to have ",
+      N,
+      " elements, but got gamma of shape ",
+      gamma.sizes());
+  TORCH_CHECK(
+      !beta.defined() || beta.numel() == N,
+      "Expected bias (beta) to have ",
+      N,
+      " elements, but got beta of shape ",
+      beta.sizes());
+
+  const auto& W = weight.is_contiguous() ? weight : weight.contiguous();
+  const Tensor flat_indices = indices.reshape(-1).contiguous();
+  const auto& P =
+      pos_weight.is_contiguous() ? pos_weight : pos_weight.contiguous();
+  const auto& G = gamma.is_contiguous() ? gamma : gamma.contiguous();
+  const auto& B = beta.is_contiguous() ? beta : beta.contiguous();
+
+  auto output_size = indices.sizes().vec();
+  output_size.push_back(N);
+  Tensor Y = at::empty(output_size, weight.options());
+  if (M > 0) {
+    EmbeddingLayerNormKernel(
+        W.device().type(), W, flat_indices, P, G, B, M, N, L, eps, &Y);
+  }
+  return Y;
+}
+
 DEFINE_DISPATCH(LayerNormKernel);
 DEFINE_DISPATCH(LayerNormBackwardKernel);
+DEFINE_DISPATCH(ResidualLayerNormKernel);
+DEFINE_DISPATCH(EmbeddingLayerNormKernel);
 
 } // namespace native
 } // namespace at
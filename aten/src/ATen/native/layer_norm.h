@@ -29,8 +29,34 @@ using backward_fn = void (*)(
     Tensor* /* dgamma */,
     Tensor* /* dbeta */);
 
+using residual_forward_fn = void (*)(
+    const Tensor& /* X */,
+    const Tensor& /* R */,
+    const Tensor& /* mask, undefined when dropout is off */,
+    double /* dropout_scale */,
+    const Tensor& /* gamma */,
+    const Tensor& /* beta */,
+    int64_t /* M */,
+    int64_t /* N */,
+    double /* eps */,
+    Tensor* /* Y */);
+
+using embedding_forward_fn = void (*)(
+    const Tensor& /* weight */,
+    const Tensor& /* indices, flattened and contiguous */,
+    const Tensor& /* pos_weight, undefined when absent */,
+    const Tensor& /* gamma */,
+    const Tensor& /* beta */,
+    int64_t /* M */,
+    int64_t /* N */,
+    int64_t /* L, sequence length; output row i uses pos row i % L */,
+    double /* eps */,
+    Tensor* /* Y */);
+
 DECLARE_DISPATCH(forward_fn, LayerNormKernel);
 DECLARE_DISPATCH(backward_fn, LayerNormBackwardKernel);
+DECLARE_DISPATCH(residual_forward_fn, ResidualLayerNormKernel);
+DECLARE_DISPATCH(embedding_forward_fn, EmbeddingLayerNormKernel);
 
 } // namespace native
 } // namespace at
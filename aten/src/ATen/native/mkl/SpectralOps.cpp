@@ -15,6 +15,22 @@ Tensor _fft_mkl(const Tensor& input, int64_t signal_ndim,
   AT_ERROR("fft: ATen not compiled with MKL support");
 }
 
+int64_t _mkl_fft_get_plan_cache_size() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+int64_t _mkl_fft_get_plan_cache_max_size() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+void _mkl_fft_set_plan_cache_max_size(int64_t max_size) {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
+void _mkl_fft_clear_plan_cache() {
+  AT_ERROR("fft: ATen not compiled with MKL support");
+}
+
 }}
 
 #else // AT_MKL_ENABLED
@@ -25,8 +41,12 @@ Tensor _fft_mkl(const Tensor& input, int64_t signal_ndim,
 #include <ATen/NativeFunctions.h>
 #include <ATen/Parallel.h>
 #include <ATen/Utils.h>
+#include <ATen/native/utils/ParamsHash.h>
 
 #include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <numeric>
 #include <cmath>
@@ -144,13 +164,284 @@ static inline void _fft_fill_with_conjugate_symmetry_(Tensor& input,
   });
 }
 
+// MKL DFTI descriptor construction and commit costs far more than the
+// transform itself for the small batched FFTs common in STFT workloads, so
+// committed descriptors are kept in an LRU plan cache. A descriptor is fully
+// determined by the signal geometry, layout and configuration below, which
+// together form the cache key. Warming up a shape is just a matter of running
+// the transform once; the next call with the same key reuses the committed
+// descriptor.
+
+constexpr int64_t mkl_max_signal_ndim = 3;
+
+// This POD struct is the **key** to the plan cache, hashed bytewise.
+// See native/cuda/CuFFTPlanCache.h for the analogous cuFFT structure.
+struct DftiParams
+{
+  at::ScalarType scalar_type_;
+  int64_t input_sizes_[mkl_max_signal_ndim + 2];
+  int64_t input_strides_[mkl_max_signal_ndim + 2];
+  int64_t output_strides_[mkl_max_signal_ndim + 2];
+  int64_t signal_sizes_[mkl_max_signal_ndim];
+  uint8_t signal_ndim_;  // between 1 and mkl_max_signal_ndim
+  bool complex_input_;
+  bool complex_output_;
+  bool inverse_;
+  bool normalized_;
+  // MKL threads the transform internally, and the thread limit is committed
+  // into the descriptor, so it is part of the key.
+  int64_t num_threads_;
+};
+
+// NB: This can't be a constructor, because then DftiParams
+// would not be a POD anymore.
+static inline void setDftiParams(DftiParams* params,
+    const Tensor& input, int64_t signal_ndim, bool complex_input,
+    bool complex_output, bool inverse, IntArrayRef checked_signal_sizes,
+    bool normalized, IntArrayRef output_strides, int64_t num_threads) {
+
+  memset(params, 0, sizeof(DftiParams));
+  params->scalar_type_ = input.scalar_type();
+  for (int64_t i = 0; i != input.dim(); ++i) {
+    params->input_sizes_[i] = input.size(i);
+    if (input.size(i) != 1) {
+      params->input_strides_[i] = input.stride(i);
+    }
+  }
+  for (size_t i = 0; i != output_strides.size(); ++i) {
+    params->output_strides_[i] = output_strides[i];
+  }
+  for (size_t i = 0; i != checked_signal_sizes.size(); ++i) {
+    params->signal_sizes_[i] = checked_signal_sizes[i];
+  }
+  params->signal_ndim_ = (uint8_t) signal_ndim;
+  params->complex_input_ = complex_input;
+  params->complex_output_ = complex_output;
+  params->inverse_ = inverse;
+  params->normalized_ = normalized;
+  params->num_threads_ = num_threads;
+}
+
+// A committed DFTI descriptor, ready to be passed to DftiCompute{For,Back}ward.
+// This class will be the **value** in the plan cache.
+class DftiConfig {
+public:
+
+  // Concurrent compute calls may share a committed descriptor, but it must not
+  // be reconfigured, so remove copy constructor and assignment op.
+  DftiConfig(const DftiConfig&) = delete;
+  DftiConfig& operator=(DftiConfig const&) = delete;
+
+  explicit DftiConfig(const Tensor& input, int64_t signal_ndim,
+      bool complex_input, bool complex_output, bool inverse,
+      IntArrayRef checked_signal_sizes, bool normalized,
+      IntArrayRef output_strides, int64_t num_threads) {
+    int64_t batch = input.size(0);
+    // precision
+    DFTI_CONFIG_VALUE prec;
+    if (input.scalar_type() == ScalarType::Float) {
+      prec = DFTI_SINGLE;
+    } else if (input.scalar_type() == ScalarType::Double) {
+      prec = DFTI_DOUBLE;
+    } else {
+      std::ostringstream ss;
+      ss << "MKL FFT doesn't support tensor of type: "
+         << toString(input.scalar_type());
+      AT_ERROR(ss.str());
+    }
+    // signal type
+    DFTI_CONFIG_VALUE signal_type;
+    if (!inverse) {
+      signal_type = complex_input ? DFTI_COMPLEX : DFTI_REAL;
+    } else {
+      signal_type = complex_output ? DFTI_COMPLEX : DFTI_REAL;
+    }
+    // create descriptor with signal size
+    std::vector<MKL_LONG> mkl_signal_sizes(checked_signal_sizes.begin(), checked_signal_sizes.end());
+    descriptor_.init(prec, signal_type, signal_ndim, mkl_signal_sizes.data());
+    // out of place FFT
+    MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_PLACEMENT, DFTI_NOT_INPLACE));
+    // batch mode
+    MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_NUMBER_OF_TRANSFORMS, batch));
+    // bound the number of threads MKL may use for this plan
+    MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_THREAD_LIMIT, (MKL_LONG) num_threads));
+
+    auto istrides = input.strides();
+    auto ostrides = output_strides;
+    // batch dim stride, i.e., dist between each data
+    MKL_LONG idist = complex_input ? istrides[0] >> 1 : istrides[0];
+    MKL_LONG odist = complex_output ? ostrides[0] >> 1 : ostrides[0];
+    MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_INPUT_DISTANCE, idist));
+    MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_OUTPUT_DISTANCE, odist));
+    // signal strides
+    // first val is offset, set to zero (ignored)
+    std::vector<MKL_LONG> mkl_istrides(1 + signal_ndim, 0), mkl_ostrides(1 + signal_ndim, 0);
+    for (int64_t i = 1; i <= signal_ndim; i++) {
+      mkl_istrides[i] = complex_input ? istrides[i] >> 1 : istrides[i];
+      mkl_ostrides[i] = complex_output ? ostrides[i] >> 1 : ostrides[i];
+    }
+    MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_INPUT_STRIDES, mkl_istrides.data()));
+    MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_OUTPUT_STRIDES, mkl_ostrides.data()));
+    // if conjugate domain of real is involved, set standard CCE storage type
+    // this will become default in MKL in future
+    if (!complex_input || !complex_output) {
+      MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(), DFTI_CONJUGATE_EVEN_STORAGE, DFTI_COMPLEX_COMPLEX));
+    }
+    // rescale if needed by normalized flag or inverse transform
+    if (normalized || inverse) {
+      auto signal_numel = at::prod_intlist(checked_signal_sizes);
+      double double_scale;
+      if (normalized) {
+        double_scale = 1.0 / std::sqrt(static_cast<double>(signal_numel));
+      } else {
+        double_scale = 1.0 / static_cast<double>(signal_numel);
+      }
+      MKL_DFTI_CHECK(DftiSetValue(descriptor_.get(),
+        inverse ? DFTI_BACKWARD_SCALE : DFTI_FORWARD_SCALE,
+        prec == DFTI_DOUBLE ? double_scale : static_cast<float>(double_scale)));
+    }
+    // finalize
+    MKL_DFTI_CHECK(DftiCommitDescriptor(descriptor_.get()));
+  }
+
+  DFTI_DESCRIPTOR *get() const { return descriptor_.get(); }
+
+private:
+  DftiDescriptor descriptor_;
+};
+
+// The default max cache size is arbitrary; it comfortably covers the distinct
+// shapes seen by STFT-style workloads while bounding descriptor memory. Users
+// can always configure it via _mkl_fft_set_plan_cache_max_size.
+constexpr size_t MKL_FFT_DEFAULT_CACHE_SIZE = 1024;
+
+// This cache assumes that the mapping from key to value never changes.
+// This is **NOT** thread-safe. Please use a mutex when using it **AND** the
+// value returned from try_emplace_value.
+// The contract of using this cache is that try_emplace_value should only be
+// used when the max_size is positive.
+class DftiParamsLRUCache {
+public:
+  using kv_t = typename std::pair<DftiParams, DftiConfig>;
+  using map_t = typename std::unordered_map<std::reference_wrapper<DftiParams>,
+                                            typename std::list<kv_t>::iterator,
+                                            ParamsHash<DftiParams>,
+                                            ParamsEqual<DftiParams>>;
+  using map_kkv_iter_t = typename map_t::iterator;
+
+  DftiParamsLRUCache() : DftiParamsLRUCache(MKL_FFT_DEFAULT_CACHE_SIZE) {}
+
+  DftiParamsLRUCache(int64_t max_size) {
+    _set_max_size(max_size);
+  }
+
+  // If key is in this cache, return the cached config. Otherwise, emplace the
+  // config in this cache using value_args and return it.
+  // Return const reference because DftiConfig shouldn't be tampered with once
+  // created.
+  template<typename K, class ...VArgs>
+  const DftiConfig &try_emplace_value(K&& key, VArgs&&... value_args) {
+    AT_ASSERT(_max_size > 0);
+
+    map_kkv_iter_t map_it = _cache_map.find(key);
+    // Hit, put to list front
+    if (map_it != _cache_map.end()) {
+      _usage_list.splice(_usage_list.begin(), _usage_list, map_it->second);
+      return map_it->second->second;
+    }
+
+    // Miss
+    // remove if needed
+    if (_usage_list.size() >= _max_size) {
+      auto last = _usage_list.end();
+      last--;
+      _cache_map.erase(last->first);
+      _usage_list.pop_back();
+    }
+
+    // construct new plan at list front, then insert into _cache_map
+    _usage_list.emplace_front(std::piecewise_construct,
+                       std::forward_as_tuple(key),
+                       std::forward_as_tuple(value_args...));
+    auto kv_it = _usage_list.begin();
+    _cache_map.emplace(std::piecewise_construct,
+                std::forward_as_tuple(kv_it->first),
+                std::forward_as_tuple(kv_it));
+    return kv_it->second;
+  }
+
+  void clear() {
+    _cache_map.clear();
+    _usage_list.clear();
+  }
+
+  void resize(int64_t new_size) {
+    _set_max_size(new_size);
+    auto cur_size = _usage_list.size();
+    if (cur_size > _max_size) {
+      auto delete_it = _usage_list.end();
+      for (size_t i = 0; i < cur_size - _max_size; i++) {
+        delete_it--;
+        _cache_map.erase(delete_it->first);
+      }
+      _usage_list.erase(delete_it, _usage_list.end());
+    }
+  }
+
+  size_t size() const { return _cache_map.size(); }
+
+  size_t max_size() const noexcept { return _max_size; }
+
+  std::mutex mutex;
+
+private:
+  // Only sets size and does value check. Does not resize the data structures.
+  void _set_max_size(int64_t new_size) {
+    TORCH_CHECK(new_size >= 0,
+             "MKL FFT plan cache size must be non-negative, but got ", new_size);
+    _max_size = static_cast<size_t>(new_size);
+  }
+
+  std::list<kv_t> _usage_list;
+  map_t _cache_map;
+  size_t _max_size;
+};
+
+static DftiParamsLRUCache &mkl_fft_get_plan_cache() {
+  static DftiParamsLRUCache plan_cache;
+  return plan_cache;
+}
+
+int64_t _mkl_fft_get_plan_cache_size() {
+  auto &plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  return plan_cache.size();
+}
+
+int64_t _mkl_fft_get_plan_cache_max_size() {
+  auto &plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  return plan_cache.max_size();
+}
+
+void _mkl_fft_set_plan_cache_max_size(int64_t max_size) {
+  auto &plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  plan_cache.resize(max_size);
+}
+
+void _mkl_fft_clear_plan_cache() {
+  auto &plan_cache = mkl_fft_get_plan_cache();
+  std::lock_guard<std::mutex> guard(plan_cache.mutex);
+  plan_cache.clear();
+}
+
 // MKL DFTI
 Tensor _fft_mkl(const Tensor& self, int64_t signal_ndim,
                 bool complex_input, bool complex_output,
                 bool inverse, IntArrayRef checked_signal_sizes,
                 bool normalized, bool onesided,
                 IntArrayRef output_sizes) {
-  int64_t batch = self.size(0);
   Tensor input = self;
   // real/imag dimension must aligned when viewed as of complex type
   if (complex_input) {
@@ -194,75 +485,40 @@ Tensor _fft_mkl(const Tensor& self, int64_t signal_ndim,
   }
   Tensor output = at::empty(output_sizes, input.options());
 
-  // precision
-  DFTI_CONFIG_VALUE prec;
-  if (input.scalar_type() == ScalarType::Float) {
-    prec = DFTI_SINGLE;
-  } else if (input.scalar_type() == ScalarType::Double) {
-    prec = DFTI_DOUBLE;
-  } else {
-    std::ostringstream ss;
-    ss << "MKL FFT doesn't support tensor of type: "
-       << toString(input.scalar_type());
-    AT_ERROR(ss.str());
-  }
-  // signal type
-  DFTI_CONFIG_VALUE signal_type;
-  if (!inverse) {
-    signal_type = complex_input ? DFTI_COMPLEX : DFTI_REAL;
-  } else {
-    signal_type = complex_output ? DFTI_COMPLEX : DFTI_REAL;
-  }
-  // create descriptor with signal size
-  std::vector<MKL_LONG> mkl_signal_sizes(checked_signal_sizes.begin(), checked_signal_sizes.end());
-  DftiDescriptor descriptor;
-  descriptor.init(prec, signal_type, signal_ndim, mkl_signal_sizes.data());
-  // out of place FFT
-  MKL_DFTI_CHECK(DftiSetValue(descriptor.get(), DFTI_PLACEMENT, DFTI_NOT_INPLACE));
-  // batch mode
-  MKL_DFTI_CHECK(DftiSetValue(descriptor.get(), DFTI_NUMBER_OF_TRANSFORMS, batch));
-
-  auto istrides = input.strides();
-  auto ostrides = output.strides();
-  // batch dim stride, i.e., dist between each data
-  MKL_LONG idist = complex_input ? istrides[0] >> 1 : istrides[0];
-  MKL_LONG odist = complex_output ? ostrides[0] >> 1 : ostrides[0];
-  MKL_DFTI_CHECK(DftiSetValue(descriptor.get(), DFTI_INPUT_DISTANCE, idist));
-  MKL_DFTI_CHECK(DftiSetValue(descriptor.get(), DFTI_OUTPUT_DISTANCE, odist));
-  // signal strides
-  // first val is offset, set to zero (ignored)
-  std::vector<MKL_LONG> mkl_istrides(1 + signal_ndim, 0), mkl_ostrides(1 + signal_ndim, 0);
-  for (int64_t i = 1; i <= signal_ndim; i++) {
-    mkl_istrides[i] = complex_input ? istrides[i] >> 1 : istrides[i];
-    mkl_ostrides[i] = complex_output ? ostrides[i] >> 1 : ostrides[i];
-  }
-  MKL_DFTI_CHECK(DftiSetValue(descriptor.get(), DFTI_INPUT_STRIDES, mkl_istrides.data()));
-  MKL_DFTI_CHECK(DftiSetValue(descriptor.get(), DFTI_OUTPUT_STRIDES, mkl_ostrides.data()));
-  // if conjugate domain of real is involved, set standard CCE storage type
-  // this will become default in MKL in future
-  if (!complex_input || !complex_output) {
-    MKL_DFTI_CHECK(DftiSetValue(descriptor.get(), DFTI_CONJUGATE_EVEN_STORAGE, DFTI_COMPLEX_COMPLEX));
-  }
-  // rescale if needed by normalized flag or inverse transform
-  if (normalized || inverse) {
-    auto signal_numel = at::prod_intlist(checked_signal_sizes);
-    double double_scale;
-    if (normalized) {
-      double_scale = 1.0 / std::sqrt(static_cast<double>(signal_numel));
-    } else {
-      double_scale = 1.0 / static_cast<double>(signal_numel);
+  int64_t num_threads = at::get_num_threads();
+  DftiParams params;
+  setDftiParams(&params, input, signal_ndim, complex_input, complex_output,
+                inverse, checked_signal_sizes, normalized, output.strides(),
+                num_threads);
+
+  auto &plan_cache = mkl_fft_get_plan_cache();
+  std::unique_lock<std::mutex> guard(plan_cache.mutex, std::defer_lock);
+  c10::optional<DftiConfig> uncached_plan;
+  const DftiConfig *config = nullptr;
+
+  if (plan_cache.max_size() > 0) {
+    guard.lock();
+    if (plan_cache.max_size() > 0) {  // re-check after acquiring the lock
+      config = &plan_cache.try_emplace_value(std::move(params),
+                                             input, signal_ndim, complex_input,
+                                             complex_output, inverse,
+                                             checked_signal_sizes, normalized,
+                                             output.strides(), num_threads);
     }
-    MKL_DFTI_CHECK(DftiSetValue(descriptor.get(),
-      inverse ? DFTI_BACKWARD_SCALE : DFTI_FORWARD_SCALE,
-      prec == DFTI_DOUBLE ? double_scale : static_cast<float>(double_scale)));
   }
-  // finalize
-  MKL_DFTI_CHECK(DftiCommitDescriptor(descriptor.get()));
+
+  if (config == nullptr) {
+    uncached_plan.emplace(input, signal_ndim, complex_input, complex_output,
+                          inverse, checked_signal_sizes, normalized,
+                          output.strides(), num_threads);
+    config = &uncached_plan.value();
+  }
+
   // run
   if (!inverse) {
-    MKL_DFTI_CHECK(DftiComputeForward(descriptor.get(), input.data_ptr(), output.data_ptr()));
+    MKL_DFTI_CHECK(DftiComputeForward(config->get(), input.data_ptr(), output.data_ptr()));
   } else {
-    MKL_DFTI_CHECK(DftiComputeBackward(descriptor.get(), input.data_ptr(), output.data_ptr()));
+    MKL_DFTI_CHECK(DftiComputeBackward(config->get(), input.data_ptr(), output.data_ptr()));
   }
   // now if needed, fill out the other half using Hermitian symmetry dim
   if (!complex_input && complex_output && !onesided) {
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <ATen/ATen.h>
+
+namespace at {
+namespace native {
+
+// Pre-builds everything mkldnn_convolution would otherwise build lazily on
+// the first call for this (weight, conv attrs, input shape) combination:
+// the blocked weight in the process-level reorder cache and the underlying
+// MKL-DNN primitive. Intended to be called at model load for the shape set
+// a service expects; see NOTE [ MKLDNN conv weight cache ] in Conv.cpp.
+CAFFE2_API void mkldnn_conv2d_warmup(
+    const Tensor& weight,
+    const Tensor& bias,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups,
+    IntArrayRef input_size);
+
+// mkldnn_convolution with the ReLU fused in as an MKL-DNN post-op, for the
+// frozen-graph conv+bn+relu fusion pass.
+CAFFE2_API Tensor mkldnn_convolution_relu(
+    const Tensor& input,
+    const Tensor& weight,
+    const Tensor& bias,
+    IntArrayRef padding,
+    IntArrayRef stride,
+    IntArrayRef dilation,
+    int64_t groups);
+
+} // namespace native
+} // namespace at
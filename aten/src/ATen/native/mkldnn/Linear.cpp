@@ -1,6 +1,7 @@
 #include <ATen/ATen.h>
 #include <ATen/Config.h>
 #include <ATen/NativeFunctions.h>
+#include <ATen/native/mkldnn/Linear.h>
 
 #if !AT_MKLDNN_ENABLED()
 
@@ -14,6 +15,17 @@ Tensor mkldnn_linear(
   AT_ERROR("mkldnn_linear: ATen not compiled with MKLDNN support");
 }
 
+Tensor mkldnn_reorder_linear_weight(const Tensor& weight) {
+  AT_ERROR("mkldnn_reorder_linear_weight: ATen not compiled with MKLDNN support");
+}
+
+Tensor mkldnn_prepacked_linear(
+    const Tensor& input,
+    const Tensor& packed_weight,
+    const Tensor& bias) {
+  AT_ERROR("mkldnn_prepacked_linear: ATen not compiled with MKLDNN support");
+}
+
 } // namespace native
 } // namespace at
 
@@ -58,6 +70,71 @@ Tensor mkldnn_linear(
   return new_with_itensor_mkldnn(std::move(y), self.options());
 }
 
+Tensor mkldnn_reorder_linear_weight(const Tensor& weight) {
+  TORCH_CHECK(weight.dim() == 2,
+      "mkldnn_reorder_linear_weight: expected a 2-d weight, got dim ", weight.dim());
+  TORCH_CHECK(!weight.is_mkldnn() && weight.device().is_cpu() &&
+      weight.scalar_type() == ScalarType::Float,
+      "mkldnn_reorder_linear_weight: expected a dense float CPU weight");
+
+  auto weight_contig = weight.contiguous();
+  ideep::tensor w = itensor_view_from_dense(weight_contig);
+  ideep::tensor::descriptor desc =
+      ideep::inner_product_forward::expected_weights_descriptor(
+          w.get_dims(), w.get_data_type());
+  ideep::tensor result;
+  result.init<AllocForMKLDNN>(desc);
+  result.feed_from(w);
+
+  return new_with_itensor_mkldnn(std::move(result), weight.options());
+}
+
+Tensor mkldnn_prepacked_linear(
+    const Tensor& input,
+    const Tensor& packed_weight,
+    const Tensor& bias) {
+  TORCH_CHECK(input.dim() >= 2,
+      "mkldnn_prepacked_linear: input needs to has dim at least 2, input dim ",
+      input.dim());
+  TORCH_CHECK(!input.is_mkldnn() && input.device().is_cpu() &&
+      input.scalar_type() == ScalarType::Float,
+      "mkldnn_prepacked_linear: expected a dense float CPU input");
+  TORCH_CHECK(packed_weight.is_mkldnn(),
+      "mkldnn_prepacked_linear: packed_weight needs to be mkldnn layout "
+      "(from mkldnn_reorder_linear_weight)");
+
+  // reshape first if input dim is greater than 2 and the reshape will cost a memory copy.
+  auto self_reshaped =
+      input.dim() > 2 ? input.reshape({-1, input.size(input.dim() - 1)}) : input;
+  auto self_contig = self_reshaped.contiguous();
+  // zero-copy views of the dense activation (and bias); only the weight is
+  // in the blocked format, which is exactly what was reordered up front
+  const ideep::tensor x = itensor_view_from_dense(self_contig);
+  const ideep::tensor& w = itensor_from_mkldnn(packed_weight);
+
+  ideep::tensor y;
+  if (bias.defined()) {
+    TORCH_CHECK(!bias.is_mkldnn() && bias.scalar_type() == ScalarType::Float,
+        "mkldnn_prepacked_linear: expected a dense float CPU bias");
+    auto bias_contig = bias.contiguous();
+    const ideep::tensor b = itensor_view_from_dense(bias_contig);
+    ideep::inner_product_forward::compute(x, w, b, y);
+  } else {
+    ideep::inner_product_forward::compute(x, w, y);
+  }
+
+  auto input_size = input.sizes();
+  std::vector<int64_t> output_size(input_size.begin(), input_size.end() - 1);
+  output_size.push_back(packed_weight.size(0));
+
+  auto output = mkldnn_to_dense(
+      new_with_itensor_mkldnn(std::move(y), input.options()));
+  if (input.dim() > 2) {
+    output = output.reshape(output_size);
+  }
+  return output;
+}
+
 } // namespace native
 } // namespace at
 
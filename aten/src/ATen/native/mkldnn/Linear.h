@@ -0,0 +1,24 @@
+#pragma once
+
+#include <ATen/ATen.h>
+
+namespace at {
+namespace native {
+
+// Reorders a dense fp32 [out_features, in_features] weight into the blocked
+// MKL-DNN inner-product format once, so the per-call GEMM can skip the
+// implicit reorder ideep would otherwise do on every compute. Returns an
+// opaque mkldnn-layout tensor; consumed by mkldnn_prepacked_linear.
+CAFFE2_API Tensor mkldnn_reorder_linear_weight(const Tensor& weight);
+
+// Linear over a dense fp32 CPU activation with a pre-reordered weight from
+// mkldnn_reorder_linear_weight; emitted by the frozen-graph linear prepack
+// pass (torch/csrc/jit/passes/frozen_linear_prepack.cpp). The activation is
+// consumed as a zero-copy view, so no layout conversion happens per call.
+CAFFE2_API Tensor mkldnn_prepacked_linear(
+    const Tensor& input,
+    const Tensor& packed_weight,
+    const Tensor& bias);
+
+} // namespace native
+} // namespace at
@@ -10,6 +10,10 @@
 #include <c10/core/QScheme.h>
 #include <c10/core/TensorOptions.h>
 
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
 namespace at {
 namespace native {
 namespace fbgemm_utils {
@@ -192,6 +196,69 @@ Tensor ConvertToChannelsLast3dTensor(const Tensor& src) {
   return dst;
 }
 
+namespace {
+
+struct PackedWeightCacheEntry {
+  // pins the source storage while any packed holder is alive, so a cache
+  // key can never alias a different tensor at a recycled address
+  at::Tensor weight;
+  std::shared_ptr<void> packed;
+};
+
+struct PackedWeightCache {
+  std::mutex mutex;
+  std::unordered_map<std::string, std::weak_ptr<PackedWeightCacheEntry>>
+      entries;
+};
+
+PackedWeightCache& GetPackedWeightCache() {
+  static PackedWeightCache cache;
+  return cache;
+}
+
+std::string PackedWeightCacheKey(
+    const at::Tensor& weight,
+    const std::string& tag) {
+  std::ostringstream oss;
+  oss << weight.data_ptr() << "/" << tag;
+  for (const auto s : weight.sizes()) {
+    oss << "/" << s;
+  }
+  return oss.str();
+}
+
+} // namespace
+
+std::shared_ptr<void> LookupOrCreatePackedWeight(
+    const at::Tensor& weight,
+    const std::string& tag,
+    const std::function<std::shared_ptr<void>()>& factory) {
+  const auto key = PackedWeightCacheKey(weight, tag);
+  auto& cache = GetPackedWeightCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  auto it = cache.entries.find(key);
+  if (it != cache.entries.end()) {
+    if (auto entry = it->second.lock()) {
+      // aliasing shared_ptr: holders of the packed matrix keep the whole
+      // entry (and thus the source tensor) alive
+      return std::shared_ptr<void>(entry, entry->packed.get());
+    }
+  }
+  auto entry = std::make_shared<PackedWeightCacheEntry>();
+  entry->weight = weight;
+  entry->packed = factory();
+  cache.entries[key] = entry;
+  // drop entries whose holders have all gone away
+  for (auto stale = cache.entries.begin(); stale != cache.entries.end();) {
+    if (stale->second.expired()) {
+      stale = cache.entries.erase(stale);
+    } else {
+      ++stale;
+    }
+  }
+  return std::shared_ptr<void>(entry, entry->packed.get());
+}
+
 } // namespace fbgemm_utils
 } // namespace native
 } // namespace at
@@ -8,6 +8,10 @@
 #include <ATen/Tensor.h>
 #include <c10/core/QScheme.h>
 
+#include <functional>
+#include <memory>
+#include <string>
+
 // The struct for the packed weight matrix (PackBMatrix) and the corresponding
 // column offsets used for the fully connect layer, which are both prepared in
 // the prepacking step to save the computations in the inference. Note the
@@ -18,7 +22,10 @@
 // (affine quantization) of input matrix.
 // Note that in JIT mode we can think of a way to fuse col_offsets with bias.
 struct CAFFE2_API PackedLinearWeight {
-  std::unique_ptr<fbgemm::PackBMatrix<int8_t>> w;
+  // shared so that concurrent sessions prepacking the same weight tensor hit
+  // one resident packed copy (see LookupOrCreatePackedWeight); the packed
+  // matrix is never mutated after construction
+  std::shared_ptr<fbgemm::PackBMatrix<int8_t>> w;
   c10::optional<at::Tensor> bias;
   std::vector<int32_t> col_offsets;
   std::vector<float> w_scale;
@@ -27,7 +34,8 @@ struct CAFFE2_API PackedLinearWeight {
 };
 
 struct CAFFE2_API PackedLinearWeightFp16 {
-  std::unique_ptr<fbgemm::PackedGemmMatrixFP16> w;
+  // shared across sessions, see PackedLinearWeight::w
+  std::shared_ptr<fbgemm::PackedGemmMatrixFP16> w;
   c10::optional<at::Tensor> bias;
 };
 
@@ -108,6 +116,22 @@ Tensor MakeEmptyPerChannelAffineQuantizedChannelsLast3dTensor(
 
 Tensor ConvertToChannelsLast3dTensor(const Tensor& src);
 
+// Process-wide cache of packed weight matrices, keyed by the source weight
+// tensor's storage address, sizes and a per-format tag. When several
+// sessions of the same model prepack the same weight tensor, they all
+// receive the same resident packed copy instead of each packing their own.
+// Returns the cached packed matrix for `weight` or invokes `factory` to
+// build (and cache) it. The cache entry keeps the source tensor alive,
+// which pins its address so a key cannot alias a different tensor, and
+// entries are dropped once the last prepacked holder goes away. Packed
+// matrices are immutable after construction, so the sharing is read-only;
+// in-place mutation of the source tensor requires re-prepacking, exactly
+// as it did with per-session packed copies.
+CAFFE2_API std::shared_ptr<void> LookupOrCreatePackedWeight(
+    const at::Tensor& weight,
+    const std::string& tag,
+    const std::function<std::shared_ptr<void>()>& factory);
+
 } // namespace fbgemm_utils
 } // namespace native
 } // namespace at
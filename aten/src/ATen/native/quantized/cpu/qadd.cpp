@@ -142,8 +142,6 @@ Tensor qnnpack_add(Tensor qa, Tensor qb, double scale, int64_t zero_point) {
 
   initQNNPACK();
 
-  pytorch_qnnp_operator_t qnnpack_operator{nullptr};
-
   size_t num_elems = qa_contig.numel() / qa_contig.size(0);
   auto output_min = ReLUFused
       ? activationLimits(scale, zero_point, Activation::RELU)
@@ -153,25 +151,32 @@ Tensor qnnpack_add(Tensor qa, Tensor qb, double scale, int64_t zero_point) {
       ? activationLimits(scale, zero_point, Activation::RELU)
             .second
       : std::numeric_limits<uint8_t>::max();
-  const pytorch_qnnp_status createStatus = pytorch_qnnp_create_add_nc_q8(
-      num_elems /* input size */,
-      a_zero_point /* a zero_point */,
-      a_scale /* a scale */,
-      b_zero_point /* b zero_point */,
-      b_scale /* b scale */,
-      static_cast<uint8_t>(zero_point) /* sum zero_point */,
-      scale /* sum scale */,
-      output_min /* output min */,
-      output_max /* output max */,
-      0 /* flags */,
-      &qnnpack_operator);
-
-  TORCH_INTERNAL_ASSERT(
-      createStatus == pytorch_qnnp_status_success,
-      "failed to create QNNPACK Add operator");
+  static thread_local QnnpackOperatorCache cache;
+  if (!cache.matches({(double)num_elems, (double)a_zero_point, a_scale,
+                      (double)b_zero_point, b_scale, (double)zero_point,
+                      scale})) {
+    pytorch_qnnp_operator_t op{nullptr};
+    const pytorch_qnnp_status createStatus = pytorch_qnnp_create_add_nc_q8(
+        num_elems /* input size */,
+        a_zero_point /* a zero_point */,
+        a_scale /* a scale */,
+        b_zero_point /* b zero_point */,
+        b_scale /* b scale */,
+        static_cast<uint8_t>(zero_point) /* sum zero_point */,
+        scale /* sum scale */,
+        output_min /* output min */,
+        output_max /* output max */,
+        0 /* flags */,
+        &op);
 
-  std::unique_ptr<pytorch_qnnp_operator, QnnpackOperatorDeleter>
-      qnnpack_uniq_ptr(qnnpack_operator);
+    TORCH_INTERNAL_ASSERT(
+        createStatus == pytorch_qnnp_status_success,
+        "failed to create QNNPACK Add operator");
+    cache.reset({(double)num_elems, (double)a_zero_point, a_scale,
+                 (double)b_zero_point, b_scale, (double)zero_point,
+                 scale}, op);
+  }
+  pytorch_qnnp_operator_t qnnpack_operator = cache.get();
 
   const pytorch_qnnp_status setupStatus = pytorch_qnnp_setup_add_nc_q8(
       qnnpack_operator /* add op */,
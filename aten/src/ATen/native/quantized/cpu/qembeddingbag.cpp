@@ -0,0 +1,250 @@
+#include <ATen/ATen.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/op_registration/op_registration.h>
+#include <c10/util/Half.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace at {
+namespace native {
+namespace {
+
+// NOTE [ Sub-byte packed embedding tables ]
+//
+// Embedding tables are memory-bound: int4 rows halve (and int2 rows
+// quarter) the footprint of int8 with little ranking-quality loss. A real
+// sub-byte ScalarType would have to ripple through every kernel and the
+// whole serialization stack, so instead the packed table lives in a plain
+// 2-D uint8 tensor, one packed row per embedding row:
+//
+//   row := [group 0 data][fp16 scale][fp16 min] [group 1 data][...] ...
+//
+// Each group of `group_size` consecutive columns shares one scale/min
+// pair; its values are quantized to bit_width bits against that pair and
+// packed low-bits-first (the first element of a byte occupies the least
+// significant bits). group_size = -1 means one group spanning the whole
+// row. The lookup kernel fuses dequantization into the bag sum so the
+// unpacked row never materializes.
+
+template <int bit_width>
+Tensor embedding_bag_prepack(const Tensor& weight, int64_t group_size) {
+  static_assert(bit_width == 4 || bit_width == 2, "unsupported bit width");
+  constexpr int elems_per_byte = 8 / bit_width;
+  constexpr int max_q = (1 << bit_width) - 1;
+  TORCH_CHECK(
+      weight.dim() == 2,
+      "embedding_bag_prepack: expected a 2-D weight, got ",
+      weight.dim(),
+      " dims");
+  TORCH_CHECK(
+      weight.scalar_type() == kFloat,
+      "embedding_bag_prepack: expected a float weight, got ",
+      weight.scalar_type());
+  const auto weight_contig = weight.contiguous();
+  const int64_t num_rows = weight_contig.size(0);
+  const int64_t num_cols = weight_contig.size(1);
+  if (group_size == -1) {
+    group_size = num_cols;
+  }
+  TORCH_CHECK(
+      group_size > 0 && num_cols % group_size == 0,
+      "embedding_bag_prepack: group_size (",
+      group_size,
+      ") must evenly divide the number of columns (",
+      num_cols,
+      ")");
+  TORCH_CHECK(
+      group_size % elems_per_byte == 0,
+      "embedding_bag_prepack: group_size (",
+      group_size,
+      ") must be a multiple of ",
+      elems_per_byte,
+      " for ",
+      bit_width,
+      "-bit packing");
+  const int64_t num_groups = num_cols / group_size;
+  const int64_t group_bytes =
+      group_size / elems_per_byte + 2 * sizeof(at::Half);
+  const int64_t row_bytes = num_groups * group_bytes;
+
+  auto packed =
+      at::empty({num_rows, row_bytes}, weight_contig.options().dtype(kByte));
+  const float* weight_data = weight_contig.data_ptr<float>();
+  uint8_t* packed_data = packed.data_ptr<uint8_t>();
+
+  at::parallel_for(0, num_rows, 1, [&](int64_t start, int64_t end) {
+    for (int64_t row = start; row < end; ++row) {
+      const float* src = weight_data + row * num_cols;
+      uint8_t* dst = packed_data + row * row_bytes;
+      for (int64_t g = 0; g < num_groups; ++g) {
+        const float* group_src = src + g * group_size;
+        uint8_t* group_dst = dst + g * group_bytes;
+        const float min_elem =
+            *std::min_element(group_src, group_src + group_size);
+        const float max_elem =
+            *std::max_element(group_src, group_src + group_size);
+        // Round the parameters through fp16 before quantizing, so the
+        // values stored in the row are exactly what the lookup kernel
+        // dequantizes with.
+        const float min_val = static_cast<float>(static_cast<at::Half>(min_elem));
+        float scale = (max_elem - min_val) / max_q;
+        // fp16 rounding of min can leave a degenerate (or slightly
+        // negative) range; fall back to an identity scale in that case
+        if (scale <= 0.f) {
+          scale = 1.f;
+        }
+        scale = static_cast<float>(static_cast<at::Half>(scale));
+        const float inv_scale = 1.f / scale;
+        for (int64_t j = 0; j < group_size; j += elems_per_byte) {
+          uint8_t packed_byte = 0;
+          for (int k = 0; k < elems_per_byte; ++k) {
+            const float x = group_src[j + k];
+            int32_t q =
+                static_cast<int32_t>(std::nearbyint((x - min_val) * inv_scale));
+            q = std::min(std::max(q, 0), max_q);
+            packed_byte |= static_cast<uint8_t>(q) << (k * bit_width);
+          }
+          group_dst[j / elems_per_byte] = packed_byte;
+        }
+        at::Half* params =
+            reinterpret_cast<at::Half*>(group_dst + group_size / elems_per_byte);
+        params[0] = static_cast<at::Half>(scale);
+        params[1] = static_cast<at::Half>(min_val);
+      }
+    }
+  });
+  return packed;
+}
+
+template <int bit_width>
+Tensor embedding_bag_rowwise_offsets(
+    const Tensor& weight,
+    const Tensor& indices,
+    const Tensor& offsets,
+    int64_t group_size) {
+  constexpr int elems_per_byte = 8 / bit_width;
+  constexpr int mask = (1 << bit_width) - 1;
+  TORCH_CHECK(
+      weight.dim() == 2 && weight.scalar_type() == kByte,
+      "embedding_bag_rowwise_offsets: expected a 2-D uint8 packed weight");
+  TORCH_CHECK(
+      indices.scalar_type() == kLong && offsets.scalar_type() == kLong,
+      "embedding_bag_rowwise_offsets: expected int64 indices and offsets");
+  const auto weight_contig = weight.contiguous();
+  const auto indices_contig = indices.contiguous();
+  const auto offsets_contig = offsets.contiguous();
+  const int64_t num_rows = weight_contig.size(0);
+  const int64_t row_bytes = weight_contig.size(1);
+  // Recover the unpacked width from the packed layout; see
+  // NOTE [ Sub-byte packed embedding tables ] for the row format.
+  int64_t num_groups;
+  if (group_size == -1) {
+    num_groups = 1;
+    group_size = (row_bytes - 2 * (int64_t)sizeof(at::Half)) * elems_per_byte;
+  } else {
+    const int64_t group_bytes =
+        group_size / elems_per_byte + 2 * sizeof(at::Half);
+    TORCH_CHECK(
+        group_size > 0 && group_size % elems_per_byte == 0 &&
+            row_bytes % group_bytes == 0,
+        "embedding_bag_rowwise_offsets: group_size (",
+        group_size,
+        ") does not match the packed row layout");
+    num_groups = row_bytes / group_bytes;
+  }
+  const int64_t group_bytes = group_size / elems_per_byte + 2 * sizeof(at::Half);
+  const int64_t num_cols = num_groups * group_size;
+  const int64_t num_indices = indices_contig.numel();
+  const int64_t num_bags = offsets_contig.numel();
+
+  auto output =
+      at::empty({num_bags, num_cols}, weight_contig.options().dtype(kFloat));
+  const uint8_t* weight_data = weight_contig.data_ptr<uint8_t>();
+  const int64_t* indices_data = indices_contig.data_ptr<int64_t>();
+  const int64_t* offsets_data = offsets_contig.data_ptr<int64_t>();
+  float* output_data = output.data_ptr<float>();
+
+  at::parallel_for(0, num_bags, 1, [&](int64_t start, int64_t end) {
+    for (int64_t bag = start; bag < end; ++bag) {
+      const int64_t bag_begin = offsets_data[bag];
+      const int64_t bag_end =
+          bag == num_bags - 1 ? num_indices : offsets_data[bag + 1];
+      TORCH_CHECK(
+          bag_begin >= 0 && bag_begin <= bag_end && bag_end <= num_indices,
+          "embedding_bag_rowwise_offsets: invalid offsets");
+      float* out = output_data + bag * num_cols;
+      std::memset(out, 0, num_cols * sizeof(float));
+      for (int64_t i = bag_begin; i < bag_end; ++i) {
+        const int64_t idx = indices_data[i];
+        TORCH_CHECK(
+            idx >= 0 && idx < num_rows,
+            "embedding_bag_rowwise_offsets: index ",
+            idx,
+            " is out of range for a table with ",
+            num_rows,
+            " rows");
+        const uint8_t* row = weight_data + idx * row_bytes;
+        for (int64_t g = 0; g < num_groups; ++g) {
+          const uint8_t* group_data = row + g * group_bytes;
+          const at::Half* params = reinterpret_cast<const at::Half*>(
+              group_data + group_size / elems_per_byte);
+          const float scale = static_cast<float>(params[0]);
+          const float min_val = static_cast<float>(params[1]);
+          float* group_out = out + g * group_size;
+          for (int64_t j = 0; j < group_size; j += elems_per_byte) {
+            uint8_t packed_byte = group_data[j / elems_per_byte];
+            for (int k = 0; k < elems_per_byte; ++k) {
+              const int32_t q = (packed_byte >> (k * bit_width)) & mask;
+              group_out[j + k] += q * scale + min_val;
+            }
+          }
+        }
+      }
+    }
+  });
+  return output;
+}
+
+template <int bit_width>
+class QEmbeddingBagPrepack final : public c10::OperatorKernel {
+ public:
+  Tensor operator()(Tensor weight, int64_t group_size) {
+    return embedding_bag_prepack<bit_width>(weight, group_size);
+  }
+};
+
+template <int bit_width>
+class QEmbeddingBagRowwiseOffsets final : public c10::OperatorKernel {
+ public:
+  Tensor operator()(
+      Tensor weight,
+      Tensor indices,
+      Tensor offsets,
+      int64_t group_size) {
+    return embedding_bag_rowwise_offsets<bit_width>(
+        weight, indices, offsets, group_size);
+  }
+};
+
+static auto registry =
+    torch::RegisterOperators()
+        .op("quantized::embedding_bag_4bit_prepack(Tensor weight, int group_size=-1) -> Tensor",
+            torch::RegisterOperators::options()
+                .kernel<QEmbeddingBagPrepack<4>>(DispatchKey::CPUTensorId))
+        .op("quantized::embedding_bag_2bit_prepack(Tensor weight, int group_size=-1) -> Tensor",
+            torch::RegisterOperators::options()
+                .kernel<QEmbeddingBagPrepack<2>>(DispatchKey::CPUTensorId))
+        .op("quantized::embedding_bag_4bit_rowwise_offsets(Tensor weight, Tensor indices, Tensor offsets, int group_size=-1) -> Tensor",
+            torch::RegisterOperators::options()
+                .kernel<QEmbeddingBagRowwiseOffsets<4>>(
+                    DispatchKey::CPUTensorId))
+        .op("quantized::embedding_bag_2bit_rowwise_offsets(Tensor weight, Tensor indices, Tensor offsets, int group_size=-1) -> Tensor",
+            torch::RegisterOperators::options()
+                .kernel<QEmbeddingBagRowwiseOffsets<2>>(
+                    DispatchKey::CPUTensorId));
+
+} // namespace
+} // namespace native
+} // namespace at
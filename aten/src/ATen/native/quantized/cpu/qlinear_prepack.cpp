@@ -105,15 +105,23 @@ class QLinearPackWeightInt8 final : public c10::OperatorKernel {
           "bias should have N elements: " + std::to_string(N));
       bias_contig = bias->contiguous();
     }
+    // Packed copies are shared process-wide: concurrent sessions prepacking
+    // the same weight tensor all end up with one resident PackBMatrix.
+    auto packed_w = std::static_pointer_cast<fbgemm::PackBMatrix<int8_t>>(
+        fbgemm_utils::LookupOrCreatePackedWeight(
+            weight_contig, "linear_int8", [&]() -> std::shared_ptr<void> {
+              return std::make_shared<fbgemm::PackBMatrix<int8_t>>(
+                  /*trans=*/fbgemm::matrix_op_t::Transpose,
+                  /*nRow=*/K,
+                  /*nCol=*/N,
+                  /*smat=*/weight_ptr_int8,
+                  /*ld=*/K,
+                  /*pmat=*/nullptr, // PackBMatrix manages ownership of pmat
+                  /*groups=*/1);
+            }));
+
     auto ret_ptr = std::make_unique<PackedLinearWeight>(PackedLinearWeight{
-        std::make_unique<fbgemm::PackBMatrix<int8_t>>(
-            /*trans=*/fbgemm::matrix_op_t::Transpose,
-            /*nRow=*/K,
-            /*nCol=*/N,
-            /*smat=*/weight_ptr_int8,
-            /*ld=*/K,
-            /*pmat=*/nullptr, // PackBMatrix manages ownership of pmat
-            /*groups=*/1),
+        std::move(packed_w),
         bias_contig,
         col_offsets,
         weight_scales_float,
@@ -212,10 +220,16 @@ class QLinearPackWeightFp16 final : public c10::OperatorKernel {
     // TypeMetaData::deleteFn in this function. This is perfectly fine if the
     // tensors are created and freed within this translation unit. It might be
     // very problematic if that tensor flows across dll boundaries.
+    // See fbgemm_linear_prepack: one resident packed copy per weight tensor.
+    auto packed_w = std::static_pointer_cast<fbgemm::PackedGemmMatrixFP16>(
+        fbgemm_utils::LookupOrCreatePackedWeight(
+            weight_contig, "linear_fp16", [&]() -> std::shared_ptr<void> {
+              return std::make_shared<fbgemm::PackedGemmMatrixFP16>(
+                  fbgemm::matrix_op_t::Transpose, K, N, 1, weight_contig_ptr);
+            }));
+
     auto ptr = std::make_unique<PackedLinearWeightFp16>(PackedLinearWeightFp16{
-        std::make_unique<fbgemm::PackedGemmMatrixFP16>(
-            fbgemm::matrix_op_t::Transpose, K, N, 1, weight_contig_ptr),
-        bias});
+        std::move(packed_w), bias});
     return cpp_custom_type_hack::create(std::move(ptr), weight.options());
   }
 #endif
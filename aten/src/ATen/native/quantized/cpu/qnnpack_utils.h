@@ -10,6 +10,43 @@ struct QnnpackOperatorDeleter {
   }
 };
 
+// QNNPACK operator creation computes requantization parameters and, for the
+// lookup-table based operators (sigmoid, tanh), fills a 256-entry table.
+// Steady-state mobile inference repeats the same shapes and quantization
+// parameters every frame, so kernels keep the most recently created operator
+// per call site and only re-create it when the creation arguments change;
+// setup (data pointers and batch size) stays per-call. Operator handles are
+// stateful across setup/run, so the caches must be thread-local.
+//
+// Usage:
+//   static thread_local QnnpackOperatorCache cache;
+//   if (!cache.matches({num_elems, zero_point, scale})) {
+//     pytorch_qnnp_operator_t op{nullptr};
+//     /* pytorch_qnnp_create_*(..., &op) and check the status */
+//     cache.reset({num_elems, zero_point, scale}, op);
+//   }
+//   pytorch_qnnp_operator_t op = cache.get();
+class QnnpackOperatorCache {
+ public:
+  bool matches(std::initializer_list<double> key) const {
+    return op_ != nullptr && key.size() == key_.size() &&
+        std::equal(key.begin(), key.end(), key_.begin());
+  }
+
+  void reset(std::initializer_list<double> key, pytorch_qnnp_operator_t op) {
+    key_.assign(key.begin(), key.end());
+    op_.reset(op);
+  }
+
+  pytorch_qnnp_operator_t get() const {
+    return op_.get();
+  }
+
+ private:
+  std::vector<double> key_;
+  std::unique_ptr<pytorch_qnnp_operator, QnnpackOperatorDeleter> op_;
+};
+
 // PackedWeight struct for QNNPACK stores the original Weight and Bias as
 // QNNPACK currently does not support an unpack function. Possible optimization -
 // For PyTorch Mobile, once the model is scripted and serialized we don't need
@@ -37,21 +37,21 @@ Tensor qnnpack_relu(Tensor input) {
     num_elems_x *= input_contig.size(i);
   }
 
-  pytorch_qnnp_operator_t qnnpack_operator{nullptr};
-
-  const pytorch_qnnp_status createStatus = pytorch_qnnp_create_clamp_nc_u8(
-      num_elems_x /* channels */,
-      zero_point /* output min */,
-      std::numeric_limits<uint8_t>::max() /* output max */,
-      0 /* flags */,
-      &qnnpack_operator);
-
-  std::unique_ptr<pytorch_qnnp_operator, QnnpackOperatorDeleter>
-      qnnpack_uniq_ptr(qnnpack_operator);
-
-  TORCH_INTERNAL_ASSERT(
-      createStatus == pytorch_qnnp_status_success,
-      "failed to create QNNPACK Relu operator");
+  static thread_local QnnpackOperatorCache cache;
+  if (!cache.matches({(double)num_elems_x, (double)zero_point})) {
+    pytorch_qnnp_operator_t op{nullptr};
+    const pytorch_qnnp_status createStatus = pytorch_qnnp_create_clamp_nc_u8(
+        num_elems_x /* channels */,
+        zero_point /* output min */,
+        std::numeric_limits<uint8_t>::max() /* output max */,
+        0 /* flags */,
+        &op);
+    TORCH_INTERNAL_ASSERT(
+        createStatus == pytorch_qnnp_status_success,
+        "failed to create QNNPACK Relu operator");
+    cache.reset({(double)num_elems_x, (double)zero_point}, op);
+  }
+  pytorch_qnnp_operator_t qnnpack_operator = cache.get();
 
   qy = at::_empty_affine_quantized(
       input_contig.sizes(),
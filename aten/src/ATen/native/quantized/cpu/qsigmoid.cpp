@@ -34,19 +34,24 @@ Tensor qnnpack_sigmoid(Tensor input) {
   const auto zero_point = input_contig.q_zero_point();
   const auto scale = input_contig.q_scale();
 
-  pytorch_qnnp_operator_t sigmoid_op{nullptr};
-  const pytorch_qnnp_status createStatus = pytorch_qnnp_create_sigmoid_nc_q8(
-    num_elems /* channels */,
-    zero_point /* input zero point */,
-    scale /* input scale */,
-    output_zero_point /* output zero point */,
-    output_scale /* output scale */,
-    std::numeric_limits<uint8_t>::min() /* output min */,
-    std::numeric_limits<uint8_t>::max() /* output max */,
-    0 /* flags */,
-    &sigmoid_op);
-  TORCH_INTERNAL_ASSERT(createStatus == pytorch_qnnp_status_success,
-                        "failed to create QNNPACK sigmoid operator");
+  static thread_local QnnpackOperatorCache cache;
+  if (!cache.matches({(double)num_elems, (double)zero_point, scale})) {
+    pytorch_qnnp_operator_t op{nullptr};
+    const pytorch_qnnp_status createStatus = pytorch_qnnp_create_sigmoid_nc_q8(
+      num_elems /* channels */,
+      zero_point /* input zero point */,
+      scale /* input scale */,
+      output_zero_point /* output zero point */,
+      output_scale /* output scale */,
+      std::numeric_limits<uint8_t>::min() /* output min */,
+      std::numeric_limits<uint8_t>::max() /* output max */,
+      0 /* flags */,
+      &op);
+    TORCH_INTERNAL_ASSERT(createStatus == pytorch_qnnp_status_success,
+                          "failed to create QNNPACK sigmoid operator");
+    cache.reset({(double)num_elems, (double)zero_point, scale}, op);
+  }
+  pytorch_qnnp_operator_t sigmoid_op = cache.get();
   qy = at::_empty_affine_quantized(
     input_contig.sizes(),
     input.options(),
@@ -385,7 +385,40 @@ SparseTensor coalesce_sparse_cpu(const SparseTensor& self) {
 
   LongTensor indicesBuffer;
   LongTensor indicesPermutation;
-  std::tie(indicesBuffer, indicesPermutation) = indices_scalar.sort(0);
+  int64_t coalesced_prefix = get_sparse_impl(self)->coalesced_prefix();
+  if (coalesced_prefix > 0 && coalesced_prefix < nnz) {
+    // The first `coalesced_prefix` entries are already sorted and
+    // duplicate-free (see coalesced_prefix_ in SparseTensorImpl.h), so we
+    // only sort the appended tail and merge the two sorted runs.
+    LongTensor tailBuffer;
+    LongTensor tailPermutation;
+    std::tie(tailBuffer, tailPermutation) =
+        indices_scalar.narrow(0, coalesced_prefix, nnz - coalesced_prefix).sort(0);
+    indicesBuffer = at::empty({nnz}, indices_scalar.options());
+    indicesPermutation = at::empty({nnz}, indices_scalar.options());
+    auto scalarAccessor = indices_scalar.accessor<int64_t, 1>();
+    auto tailBufferAccessor = tailBuffer.accessor<int64_t, 1>();
+    auto tailPermutationAccessor = tailPermutation.accessor<int64_t, 1>();
+    auto bufferAccessor = indicesBuffer.accessor<int64_t, 1>();
+    auto permutationAccessor = indicesPermutation.accessor<int64_t, 1>();
+    int64_t p_i = 0;
+    int64_t s_i = 0;
+    for (int64_t j = 0; j < nnz; j++) {
+      if (s_i >= nnz - coalesced_prefix ||
+          (p_i < coalesced_prefix &&
+           scalarAccessor[p_i] <= tailBufferAccessor[s_i])) {
+        bufferAccessor[j] = scalarAccessor[p_i];
+        permutationAccessor[j] = p_i;
+        p_i++;
+      } else {
+        bufferAccessor[j] = tailBufferAccessor[s_i];
+        permutationAccessor[j] = coalesced_prefix + tailPermutationAccessor[s_i];
+        s_i++;
+      }
+    }
+  } else {
+    std::tie(indicesBuffer, indicesPermutation) = indices_scalar.sort(0);
+  }
   // NB: The accessor accesses here rely on self._nnz() > 0 (tested earlier in this function)
   auto newIndicesAccessor = newIndices.accessor<int64_t, 2>();
   auto indicesAccessor = indices.accessor<int64_t, 2>();
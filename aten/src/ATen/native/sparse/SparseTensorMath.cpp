@@ -15,6 +15,9 @@
 namespace at { namespace native {
 
 using namespace at::sparse;
+
+DEFINE_DISPATCH(sparse_dense_mm_stub);
+
 // --------------------------------------------------------------------
 // Utility functions
 // --------------------------------------------------------------------
@@ -488,6 +491,13 @@ SparseTensor& add_out_sparse_non_contiguous(SparseTensor& r, const SparseTensor&
     Tensor r_values = at::cat({t_values, s_values}, 0).to(r.scalar_type());
     alias_into_sparse(r, r_indices, r_values);
 
+    // The leading t._nnz() entries of the concatenation keep t's order, so
+    // if t was coalesced, a later coalesce() only needs to sort and merge
+    // the appended tail.
+    if (t.is_coalesced()) {
+      get_sparse_impl(r)->set_coalesced_prefix(t._nnz());
+    }
+
     return r;
 }
 
@@ -821,6 +831,49 @@ Tensor& s_addmm_out_sparse_dense_cpu(
   LongTensor indices = sparse_._indices();
   Tensor values      = sparse_._values();
 
+  // For coalesced tensors the nnz entries are sorted by row, so we can
+  // convert to CSR (caching the row pointer on the SparseTensorImpl for
+  // reuse) and parallelize over output rows instead of walking the nnz
+  // entries serially.
+  if (sparse_.is_coalesced()) {
+    indices = indices.contiguous();
+
+    auto rows = indices.select(0, 0);
+    auto columns = indices.select(0, 1);
+    int64_t row_min = rows.min().item<int64_t>();
+    int64_t row_max = rows.max().item<int64_t>();
+    int64_t col_min = columns.min().item<int64_t>();
+    int64_t col_max = columns.max().item<int64_t>();
+    if (col_min < 0 || col_max >= dim_j) {
+      AT_ERROR("addmm: index out of column bound: ", (col_min < 0 ? col_min : col_max), " not between 1 and ", dim_j);
+    }
+    if (row_min < 0 || row_max >= dim_i) {
+      AT_ERROR("addmm: index out of row bound: ", (row_min < 0 ? row_min : row_max), " not between 1 and ", dim_i);
+    }
+
+    auto* sparse_impl = get_sparse_impl(sparse_);
+    LongTensor csr = sparse_impl->csr_cache();
+    if (!csr.defined()) {
+      csr = _to_csr(rows.data_ptr<int64_t>(), dim_i, nnz);
+      sparse_impl->set_csr_cache(csr);
+    }
+
+    // r = beta * t; the kernel accumulates alpha * mm(S, dense) on top.
+    double cast_beta = beta.toDouble();
+    if (cast_beta == 0) {
+      r.zero_();
+    } else if (cast_beta == 1) {
+      if (!is_same_tensor(r, t)) {
+        r.copy_(t);
+      }
+    } else {
+      at::mul_out(r, t, scalar_to_tensor(beta));
+    }
+
+    sparse_dense_mm_stub(kCPU, r, csr, columns, values, dense, alpha);
+    return r;
+  }
+
   AT_DISPATCH_ALL_TYPES(
       values.scalar_type(), "addmm_sparse_dense", [&] {
         s_addmm_out_sparse_dense_worker<scalar_t>(nnz, dim_i, dim_j, dim_k, r, beta, t, alpha, indices, values, dense);
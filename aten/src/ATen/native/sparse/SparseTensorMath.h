@@ -2,10 +2,23 @@
 
 #include <ATen/ATen.h>
 #include <ATen/SparseTensorUtils.h>
+#include <ATen/native/DispatchStub.h>
 
 namespace at { namespace native {
 
 TORCH_API sparse::SparseTensor& mul_out_sparse_scalar(sparse::SparseTensor& r, const sparse::SparseTensor& t, Scalar value);
 TORCH_API sparse::SparseTensor& mul_out_sparse_zerodim(sparse::SparseTensor& r, const sparse::SparseTensor& t, const Tensor& value);
 
+// r += alpha * mm(S, dense), with S given in CSR form: `csr` is the row
+// pointer array (shape: (r.size(0) + 1,)), `columns` and `values` hold the
+// column index and value of each nnz entry.
+using sparse_dense_mm_fn = void (*)(
+    Tensor& r,
+    const Tensor& csr,
+    const Tensor& columns,
+    const Tensor& values,
+    const Tensor& dense,
+    Scalar alpha);
+DECLARE_DISPATCH(sparse_dense_mm_fn, sparse_dense_mm_stub);
+
 }}
@@ -359,6 +359,32 @@ class CAFFE2_API Tensor {
   template<typename T, size_t N>
   TensorAccessor<T,N> accessor() && = delete;
 
+  // Return a `StaticTensorAccessor` for a contiguous CPU `Tensor` whose full
+  // shape is known at compile time, e.g. `t.static_accessor<float, 4, 16>()`.
+  // The extents are checked against the tensor once here; inside the accessor
+  // they are compile-time constants, so indexing compiles to raw pointer
+  // arithmetic. Use `static_restrict_accessor` to additionally mark the data
+  // pointer as non-aliasing.
+  template<typename T, size_t... Sizes>
+  StaticTensorAccessor<T,DefaultPtrTraits,Sizes...> static_accessor() const& {
+    check_static_accessor_sizes<Sizes...>();
+    return StaticTensorAccessor<T,DefaultPtrTraits,Sizes...>(data_ptr<T>());
+  }
+  template<typename T, size_t... Sizes>
+  StaticTensorAccessor<T,DefaultPtrTraits,Sizes...> static_accessor() && = delete;
+
+  // Like `static_accessor`, but casts the data pointer to a `__restrict__`
+  // pointer, promising the compiler that it does not alias any other pointer
+  // in the kernel.
+  template<typename T, size_t... Sizes>
+  StaticTensorAccessor<T,RestrictPtrTraits,Sizes...> static_restrict_accessor() const& {
+    check_static_accessor_sizes<Sizes...>();
+    return StaticTensorAccessor<T,RestrictPtrTraits,Sizes...>(
+        static_cast<typename RestrictPtrTraits<T>::PtrType>(data_ptr<T>()));
+  }
+  template<typename T, size_t... Sizes>
+  StaticTensorAccessor<T,RestrictPtrTraits,Sizes...> static_restrict_accessor() && = delete;
+
   // Return a `GenericPackedTensorAccessor` for CUDA `Tensor`s. You have to specify scalar type and
   // dimension. You can optionally specify RestrictPtrTraits as a template parameter to
   // cast the data pointer to a __restrict__ pointer.
@@ -539,6 +565,20 @@ public:
 protected:
   friend class ::caffe2::Tensor;
 
+  // Shared validation for static_accessor / static_restrict_accessor.
+  template<size_t... Sizes>
+  void check_static_accessor_sizes() const {
+    static_assert(sizeof...(Sizes) > 0, "accessor is used for indexing tensor, for scalars use *data_ptr<T>()");
+    TORCH_CHECK(dim() == sizeof...(Sizes), "expected ", sizeof...(Sizes), " dims but tensor has ", dim());
+    TORCH_CHECK(is_contiguous(), "static_accessor expects a contiguous tensor");
+    const int64_t expected_sizes[] = {static_cast<int64_t>(Sizes)...};
+    for (size_t i = 0; i < sizeof...(Sizes); i++) {
+      TORCH_CHECK(sizes()[i] == expected_sizes[i],
+                  "expected size ", expected_sizes[i], " in dim ", i,
+                  " but tensor has size ", sizes()[i]);
+    }
+  }
+
   void enforce_invariants();
   c10::intrusive_ptr<TensorImpl, UndefinedTensorImpl> impl_;
 };
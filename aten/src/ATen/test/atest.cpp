@@ -106,3 +106,24 @@ TEST(atest, atest) {
     ASSERT_EQ(t_.device(), at::Device(kCUDA, 0));
   }
 }
+
+TEST(atest, static_accessor) {
+  float data[] = {1, 2, 3, 4, 5, 6};
+  auto f = from_blob(data, {1, 2, 3});
+
+  auto f_a = f.static_accessor<float, 1, 2, 3>();
+  static_assert(decltype(f_a)::kNumel == 6, "static numel");
+  static_assert(decltype(f_a)::kSize == 1, "static leading extent");
+  ASSERT_EQ(f_a[0][0][0], 1.0);
+  ASSERT_EQ(f_a[0][1][1], 5.0);
+  f_a[0][1][2] = 7.0;
+  ASSERT_EQ(data[5], 7.0);
+
+  auto f_r = f.static_restrict_accessor<float, 1, 2, 3>();
+  ASSERT_EQ(f_r[0][0][2], 3.0);
+
+  // Static extents are validated against the tensor once at construction.
+  ASSERT_THROW(f.static_accessor<float, 2, 3>(), std::exception);
+  ASSERT_THROW(f.static_accessor<float, 1, 3, 2>(), std::exception);
+  ASSERT_THROW(f.transpose(1, 2).static_accessor<float, 1, 3, 2>(), std::exception);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/native/TensorFactories.h>
+
+using namespace at;
+
+TEST(CachedTensorOptionsTest, ResolvesCPUOptions) {
+  c10::CachedTensorOptions cached(at::device(kCPU).dtype(kFloat));
+  ASSERT_EQ(cached.dispatch_key(), DispatchKey::CPUTensorId);
+  ASSERT_EQ(cached.dtype(), caffe2::TypeMeta::Make<float>());
+  ASSERT_EQ(cached.device(), Device(kCPU));
+  ASSERT_EQ(cached.memory_format(), MemoryFormat::Contiguous);
+  ASSERT_NE(cached.allocator(), nullptr);
+  ASSERT_TRUE(cached.key_set().has(DispatchKey::CPUTensorId));
+}
+
+TEST(CachedTensorOptionsTest, SnapshotsDefaultDtype) {
+  // An unspecified dtype is resolved at cache-construction time and pinned
+  // into options(), so the fast and fallback paths agree.
+  c10::CachedTensorOptions cached{TensorOptions()};
+  ASSERT_EQ(cached.dtype(), get_default_dtype());
+  ASSERT_TRUE(cached.options().has_dtype());
+}
+
+TEST(CachedTensorOptionsTest, EmptyCachedMatchesEmpty) {
+  for (auto dtype : {kFloat, kDouble, kLong, kByte}) {
+    c10::CachedTensorOptions cached(at::device(kCPU).dtype(dtype));
+    auto a = at::native::empty_cached({2, 3, 4}, cached);
+    auto b = at::empty({2, 3, 4}, cached.options());
+    ASSERT_EQ(a.sizes(), b.sizes());
+    ASSERT_EQ(a.strides(), b.strides());
+    ASSERT_EQ(a.dtype(), b.dtype());
+    ASSERT_EQ(a.device(), b.device());
+    ASSERT_TRUE(a.is_contiguous());
+  }
+}
+
+TEST(CachedTensorOptionsTest, EmptyCachedZeroDim) {
+  c10::CachedTensorOptions cached(at::device(kCPU).dtype(kFloat));
+  auto a = at::native::empty_cached({0}, cached);
+  ASSERT_EQ(a.numel(), 0);
+  auto b = at::native::empty_cached({}, cached);
+  ASSERT_EQ(b.dim(), 0);
+  ASSERT_EQ(b.numel(), 1);
+}
+
+TEST(CachedTensorOptionsTest, EmptyCachedChannelsLast) {
+  c10::CachedTensorOptions cached(
+      at::device(kCPU).dtype(kFloat).memory_format(MemoryFormat::ChannelsLast));
+  auto a = at::native::empty_cached({2, 3, 4, 5}, cached);
+  ASSERT_TRUE(a.is_contiguous(MemoryFormat::ChannelsLast));
+}
+
+TEST(CachedTensorOptionsTest, EmptyCachedWritable) {
+  c10::CachedTensorOptions cached(at::device(kCPU).dtype(kFloat));
+  auto a = at::native::empty_cached({8}, cached);
+  a.fill_(2.0);
+  ASSERT_TRUE(at::equal(a, at::full({8}, 2.0)));
+}
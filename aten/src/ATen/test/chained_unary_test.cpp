@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/native/ChainedUnaryOps.h>
+
+using namespace at;
+using native::ChainStage;
+using Kind = native::ChainStage::Kind;
+
+// The fused chain must produce the same values as running the ops one
+// TensorIterator pass at a time.
+
+TEST(ChainedUnaryTest, PreInstantiatedChain) {
+  manual_seed(123);
+  // odd sizes exercise the non-vectorized tail
+  auto input = rand({37, 11}) * 10;
+  std::vector<ChainStage> stages = {
+      {Kind::SubScalar, 2.5},
+      {Kind::DivScalar, 3.0},
+      {Kind::Clamp, 0.0, 4.0},
+      {Kind::Log1p}};
+  auto result = native::chained_unary(input, stages);
+  auto expected = ((input - 2.5) / 3.0).clamp(0.0, 4.0).log1p();
+  ASSERT_TRUE(result.allclose(expected));
+}
+
+TEST(ChainedUnaryTest, InterpretedChain) {
+  manual_seed(123);
+  // a chain that is not in the pre-instantiated list takes the generic
+  // interpreted path
+  auto input = rand({129}, kDouble) - 0.5;
+  std::vector<ChainStage> stages = {
+      {Kind::Abs},
+      {Kind::AddScalar, 1.0},
+      {Kind::Log},
+      {Kind::Neg},
+      {Kind::MulScalar, 0.5}};
+  auto result = native::chained_unary(input, stages);
+  auto expected = -(input.abs() + 1.0).log() * 0.5;
+  ASSERT_TRUE(result.allclose(expected));
+}
+
+TEST(ChainedUnaryTest, OutVariant) {
+  auto input = ones({4, 4});
+  auto result = empty({0});
+  std::vector<ChainStage> stages = {{Kind::MulScalar, 2.0}, {Kind::AddScalar, 1.0}};
+  native::chained_unary_out(result, input, stages);
+  ASSERT_TRUE(result.equal(input * 2.0 + 1.0));
+}
+
+TEST(ChainedUnaryTest, InvalidChains) {
+  auto input = rand({4});
+  ASSERT_ANY_THROW(native::chained_unary(input, {}));
+  std::vector<ChainStage> too_long(
+      native::kMaxChainStages + 1, ChainStage{Kind::Neg});
+  ASSERT_ANY_THROW(native::chained_unary(input, too_long));
+  auto ints = ones({4}, kInt);
+  ASSERT_ANY_THROW(native::chained_unary(ints, {{Kind::Neg}}));
+}
@@ -4,6 +4,7 @@
 #include <ATen/DLConvertor.h>
 #include <ATen/Parallel.h>
 
+#include <atomic>
 #include <iostream>
 #include <string.h>
 #include <sstream>
@@ -36,6 +37,37 @@ TEST(TestParallel, NestedParallel) {
   });
 }
 
+TEST(TestParallel, Parallel2d) {
+  // every (i0, i1) pair must be visited exactly once, for both whole and
+  // split inner ranges
+  for (int64_t grain : {1, 4, 1000}) {
+    std::vector<int> visits(6 * 10, 0);
+    at::parallel_for_2d(0, 6, 0, 10, grain,
+        [&](int64_t i0, int64_t begin1, int64_t end1) {
+      for (int64_t i1 = begin1; i1 < end1; i1++) {
+        visits[i0 * 10 + i1]++;
+      }
+    });
+    for (auto count : visits) {
+      ASSERT_EQ(count, 1);
+    }
+  }
+
+  // non-zero offsets and empty ranges
+  std::atomic<int64_t> sum{0};
+  at::parallel_for_2d(2, 4, 3, 5, 1000,
+      [&](int64_t i0, int64_t begin1, int64_t end1) {
+    for (int64_t i1 = begin1; i1 < end1; i1++) {
+      sum += i0 * i1;
+    }
+  });
+  ASSERT_EQ(sum, 2 * 3 + 2 * 4 + 3 * 3 + 3 * 4);
+  at::parallel_for_2d(0, 4, 0, 0, 1,
+      [&](int64_t, int64_t, int64_t) {
+    ASSERT_TRUE(false);
+  });
+}
+
 TEST(TestParallel, Exceptions) {
   // parallel case
   ASSERT_THROW(
@@ -170,11 +170,11 @@ void* THRealloc(void *ptr, ptrdiff_t size)
   if(size < 0)
     THError("$ Torch: invalid memory size -- maybe an overflow?");
 
-  void *newptr = realloc(ptr, size);
+  void *newptr = c10::realloc_cpu(ptr, size);
 
   if(!newptr && torchGCFunction) {
     torchGCFunction(torchGCData);
-    newptr = realloc(ptr, size);
+    newptr = c10::realloc_cpu(ptr, size);
   }
 
   if(!newptr)
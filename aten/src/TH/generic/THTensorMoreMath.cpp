@@ -580,6 +580,91 @@ static void THTensor_(quicksortdescend)(scalar_t *arr, int64_t *idx, int64_t ele
 #undef MAX_LEVELS
 #undef M_SMALL
 
+/* Minimum number of elements a thread must get for the parallel sort to be
+   worth the partitioning and merge overhead. */
+#define TH_SORT_MIN_PER_THREAD 65536
+
+/* Sorts a contiguous slice by splitting it into per-thread partitions,
+   quicksorting each independently on the intra-op pool and then merging
+   sorted runs pairwise (also in parallel) until one run remains. Used for
+   the few-large-slices case where the per-slice quicksort leaves all but
+   one core idle. */
+static void THTensor_(parallelsort)(scalar_t *arr, int64_t *idx, int64_t elements, int descendingOrder)
+{
+  int64_t nparts = std::min<int64_t>(
+      at::get_num_threads(),
+      std::max<int64_t>(elements / TH_SORT_MIN_PER_THREAD, 1));
+  if (nparts <= 1) {
+    if (descendingOrder) {
+      THTensor_(quicksortdescend)(arr, idx, elements, 1);
+    } else {
+      THTensor_(quicksortascend)(arr, idx, elements, 1);
+    }
+    return;
+  }
+
+  std::vector<int64_t> bounds(nparts + 1);
+  for (int64_t p = 0; p <= nparts; p++) {
+    bounds[p] = elements * p / nparts;
+  }
+
+  at::parallel_for(0, nparts, 1, [&](int64_t pbegin, int64_t pend) {
+    for (int64_t p = pbegin; p < pend; p++) {
+      if (descendingOrder) {
+        THTensor_(quicksortdescend)(arr + bounds[p], idx + bounds[p], bounds[p + 1] - bounds[p], 1);
+      } else {
+        THTensor_(quicksortascend)(arr + bounds[p], idx + bounds[p], bounds[p + 1] - bounds[p], 1);
+      }
+    }
+  });
+
+  /* Merge pairs of adjacent runs per round, ping-ponging between the input
+     and a scratch buffer; runs double in size each round. */
+  std::vector<scalar_t> scratch_arr(elements);
+  std::vector<int64_t> scratch_idx(elements);
+  scalar_t *src_arr = arr, *dst_arr = scratch_arr.data();
+  int64_t *src_idx = idx, *dst_idx = scratch_idx.data();
+
+  for (int64_t width = 1; width < nparts; width *= 2) {
+    int64_t npairs = (nparts + 2 * width - 1) / (2 * width);
+    at::parallel_for(0, npairs, 1, [&](int64_t gbegin, int64_t gend) {
+      for (int64_t g = gbegin; g < gend; g++) {
+        int64_t lo = bounds[std::min(nparts, g * 2 * width)];
+        int64_t mid = bounds[std::min(nparts, g * 2 * width + width)];
+        int64_t hi = bounds[std::min(nparts, g * 2 * width + 2 * width)];
+        int64_t i = lo, j = mid, k = lo;
+        while (i < mid && j < hi) {
+          int take_right = descendingOrder
+              ? GT_OR_NAN(src_arr[j], src_arr[i])
+              : GT_OR_NAN(src_arr[i], src_arr[j]);
+          if (take_right) {
+            dst_arr[k] = src_arr[j];
+            dst_idx[k++] = src_idx[j++];
+          } else {
+            dst_arr[k] = src_arr[i];
+            dst_idx[k++] = src_idx[i++];
+          }
+        }
+        for (; i < mid; i++) {
+          dst_arr[k] = src_arr[i];
+          dst_idx[k++] = src_idx[i];
+        }
+        for (; j < hi; j++) {
+          dst_arr[k] = src_arr[j];
+          dst_idx[k++] = src_idx[j];
+        }
+      }
+    });
+    std::swap(src_arr, dst_arr);
+    std::swap(src_idx, dst_idx);
+  }
+
+  if (src_arr != arr) {
+    memcpy(arr, src_arr, elements * sizeof(scalar_t));
+    memcpy(idx, src_idx, elements * sizeof(int64_t));
+  }
+}
+
 void THTensor_(sort)(THTensor *rt_, THLongTensor *ri_, THTensor *t, int dimension, int descendingOrder)
 {
   dimension = at::maybe_wrap_dim(dimension, t);
@@ -592,13 +677,24 @@ void THTensor_(sort)(THTensor *rt_, THLongTensor *ri_, THTensor *t, int dimensio
   at::native::copy_(rt__wrap, t_wrap);
   THLongTensor_resize(ri_, t->sizes(), {});
 
+  /* With fewer slices than threads the per-slice quicksort cannot occupy
+     the machine; sort the (contiguous) slices themselves in parallel. */
+  int64_t numel = THTensor_(nElement)(t);
+  int64_t size_dim = THTensor_sizeLegacyNoScalars(t, dimension);
+  int use_parallel_sort = size_dim > 0 &&
+      numel / size_dim < at::get_num_threads() &&
+      size_dim >= 2 * TH_SORT_MIN_PER_THREAD;
+
   if(descendingOrder)
   {
     TH_TENSOR_DIM_APPLY2(scalar_t, rt_, int64_t, ri_, dimension,
                          int64_t i;
                          for(i = 0; i < ri__size; i++)
                            ri__data[i*ri__stride] = i;
-                         THTensor_(quicksortdescend)(rt__data, ri__data, rt__size, rt__stride);)
+                         if (use_parallel_sort && rt__stride == 1 && ri__stride == 1)
+                           THTensor_(parallelsort)(rt__data, ri__data, rt__size, 1);
+                         else
+                           THTensor_(quicksortdescend)(rt__data, ri__data, rt__size, rt__stride);)
       }
   else
   {
@@ -606,10 +702,15 @@ void THTensor_(sort)(THTensor *rt_, THLongTensor *ri_, THTensor *t, int dimensio
                          int64_t i;
                          for(i = 0; i < ri__size; i++)
                            ri__data[i*ri__stride] = i;
-                         THTensor_(quicksortascend)(rt__data, ri__data, rt__size, rt__stride);)
+                         if (use_parallel_sort && rt__stride == 1 && ri__stride == 1)
+                           THTensor_(parallelsort)(rt__data, ri__data, rt__size, 0);
+                         else
+                           THTensor_(quicksortascend)(rt__data, ri__data, rt__size, rt__stride);)
       }
 }
 
+#undef TH_SORT_MIN_PER_THREAD
+
 /* Implementation of the Quickselect algorithm, based on Nicolas Devillard's
 public domain implementation at http://ndevilla.free.fr/median/median/
 Adapted similarly to the above Quicksort algorithm. */
@@ -42,6 +42,31 @@ static bool BlockComparator(const BlockSize& a, const BlockSize& b)
   return (uintptr_t)a.ptr < (uintptr_t)b.ptr;
 }
 
+// Round allocation sizes into buckets so that continuously re-pinned batches
+// of slightly varying size land in the same bucket and reuse cached blocks,
+// instead of every exact size populating its own entry. Small sizes use
+// power-of-two buckets; large ones are rounded up to 1MB multiples to bound
+// the overshoot.
+static size_t roundSize(size_t size)
+{
+  constexpr size_t kMinBlockSize = 4096;
+  constexpr size_t kLargeBucket = 1048576;
+  if (size == 0) {
+    return 0;
+  }
+  if (size <= kMinBlockSize) {
+    return kMinBlockSize;
+  }
+  if (size <= kLargeBucket) {
+    size_t rounded = kMinBlockSize;
+    while (rounded < size) {
+      rounded *= 2;
+    }
+    return rounded;
+  }
+  return ((size + kLargeBucket - 1) / kLargeBucket) * kLargeBucket;
+}
+
 struct HostAllocator
 {
   typedef bool (*Comparison)(const BlockSize&, const BlockSize&);
@@ -58,6 +83,10 @@ struct HostAllocator
   // outstanding cuda events
   std::deque<std::pair<cudaEvent_t, void*>> cuda_events;
 
+  // allocation counters (see THCCachingHostAllocatorStats)
+  uint64_t num_allocs = 0;
+  uint64_t num_cache_hits = 0;
+
   HostAllocator() : available(BlockComparator) {}
 
   cudaError_t malloc(void** ptr, size_t size)
@@ -70,15 +99,21 @@ struct HostAllocator
       return err;
     }
 
-    // search for the smallest block which can hold this allocation
+    size = roundSize(size);
+    num_allocs++;
+
+    // search for a cached block in the same size bucket. Since all blocks
+    // are allocated with rounded sizes, an exact match is the common case;
+    // requiring it avoids handing a much larger block to a small request.
     BlockSize search_key(size);
     auto it = available.lower_bound(search_key);
-    if (it != available.end()) {
+    if (it != available.end() && it->size == size) {
       Block& block = blocks.at(it->ptr);
       THAssert(!block.allocated && block.event_count == 0);
       block.allocated = true;
       *ptr = block.ptr;
       available.erase(it);
+      num_cache_hits++;
       return cudaSuccess;
     }
 
@@ -224,6 +259,24 @@ struct HostAllocator
     }
   }
 
+  THCCachingHostAllocatorStats getStats()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    THCCachingHostAllocatorStats stats = {num_allocs, num_cache_hits, 0, 0, 0, 0};
+    for (const auto& entry : blocks) {
+      const Block& block = entry.second;
+      if (block.allocated) {
+        stats.inuse_bytes += block.size;
+        stats.inuse_blocks++;
+      } else {
+        stats.cached_bytes += block.size;
+        stats.cached_blocks++;
+      }
+    }
+    return stats;
+  }
+
   cudaError_t insertEvents(Block& block)
   {
     cudaError_t err;
@@ -267,6 +320,11 @@ void THCCachingHostAllocator_emptyCache()
   allocator.emptyCache();
 }
 
+THCCachingHostAllocatorStats THCCachingHostAllocator_getStats()
+{
+  return allocator.getStats();
+}
+
 static void THCCachingHostDeleter(void* ptr) {
   allocator.free(ptr);
 }
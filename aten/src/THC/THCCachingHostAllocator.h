@@ -30,4 +30,17 @@ THC_API cudaError_t THCCachingHostAllocator_recordEvent(void *ptr, at::cuda::CUD
 // Releases cached pinned memory allocations via cudaHostFree
 THC_API void THCCachingHostAllocator_emptyCache(void);
 
+// Statistics for the caching host allocator, the pinned-memory counterpart
+// of c10::cuda::CUDACachingAllocator's DeviceStats.
+struct THCCachingHostAllocatorStats {
+  uint64_t num_allocs;     // total allocation requests
+  uint64_t num_cache_hits; // requests served from a cached block
+  size_t inuse_bytes;      // bytes in blocks currently handed out
+  size_t inuse_blocks;
+  size_t cached_bytes;     // bytes in blocks held for reuse
+  size_t cached_blocks;
+};
+
+THC_API THCCachingHostAllocatorStats THCCachingHostAllocator_getStats(void);
+
 #endif
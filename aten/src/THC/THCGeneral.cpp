@@ -145,6 +145,18 @@ int THCState_getPeerToPeerAccess(THCState* state, int dev, int devToAccess)
   return state->p2pAccessEnabled[dev][devToAccess];
 }
 
+void THCState_setupPeerToPeerAccess(THCState* state)
+{
+  // Walk every ordered pair once; THCState_getPeerToPeerAccess enables
+  // access where possible and caches the answer, so later copies only do
+  // a table lookup.
+  for (int dev = 0; dev < state->numDevices; ++dev) {
+    for (int devToAccess = 0; devToAccess < state->numDevices; ++devToAccess) {
+      THCState_getPeerToPeerAccess(state, dev, devToAccess);
+    }
+  }
+}
+
 c10::Allocator* THCState_getCudaHostAllocator(THCState* state)
 {
   return state->cudaHostAllocator;
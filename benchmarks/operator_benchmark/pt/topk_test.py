@@ -0,0 +1,51 @@
+from __future__ import absolute_import
+from __future__ import division
+from __future__ import print_function
+from __future__ import unicode_literals
+
+import operator_benchmark as op_bench
+import torch
+
+
+"""Microbenchmarks for topk operator."""
+
+# An example input from this configuration is N=512, k=16.
+topk_configs_short = op_bench.config_list(
+    attr_names=["N", "k"],
+    attrs=[
+        [512, 16],
+        [65536, 100],
+    ],
+    cross_product_configs={
+        'device': ['cpu', 'cuda'],
+    },
+    tags=["short"]
+)
+
+
+# The long shapes cover the retrieval use case: a small k selected out of
+# one very long row of scores.
+topk_configs_long = op_bench.cross_product_configs(
+    N=[1048576, 50000000],
+    k=[16, 100, 1024],
+    device=['cpu', 'cuda'],
+    tags=["long"]
+)
+
+
+class TopKBenchmark(op_bench.TorchBenchmarkBase):
+    def init(self, N, k, device):
+        self.input_one = torch.rand(N, device=device)
+        self.k = k
+        self.set_module_name("topk")
+
+    def forward(self):
+        return torch.topk(self.input_one, self.k)
+
+
+op_bench.generate_pt_test(topk_configs_short + topk_configs_long,
+                          TopKBenchmark)
+
+
+if __name__ == "__main__":
+    op_bench.benchmark_runner.main()
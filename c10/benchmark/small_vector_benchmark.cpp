@@ -0,0 +1,97 @@
+#include <c10/util/SmallVector.h>
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+using c10::SmallVector;
+
+namespace {
+
+// DimVector in ATen is SmallVector<int64_t, 5>; these benchmarks track the
+// shape-handling patterns TensorIterator leans on (copying, appending and
+// resizing small int64_t vectors), so regressions in the POD fast paths of
+// SmallVector show up here instead of as diffuse overhead in operator
+// benchmarks. The std::vector variants are reference points, not targets.
+using BenchDimVector = SmallVector<int64_t, 5>;
+
+static void BM_SmallVectorPushBackInline(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    BenchDimVector v;
+    for (int64_t i = 0; i < 4; i++) {
+      v.push_back(i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+BENCHMARK(BM_SmallVectorPushBackInline);
+
+static void BM_SmallVectorPushBackGrow(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  while (state.KeepRunning()) {
+    BenchDimVector v;
+    for (int64_t i = 0; i < n; i++) {
+      v.push_back(i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+BENCHMARK(BM_SmallVectorPushBackGrow)->Arg(16)->Arg(64)->Arg(256);
+
+static void BM_StdVectorPushBackGrow(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  while (state.KeepRunning()) {
+    std::vector<int64_t> v;
+    for (int64_t i = 0; i < n; i++) {
+      v.push_back(i);
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+BENCHMARK(BM_StdVectorPushBackGrow)->Arg(16)->Arg(64)->Arg(256);
+
+static void BM_SmallVectorCopy(benchmark::State& state) {
+  BenchDimVector src;
+  for (int64_t i = 0; i < state.range(0); i++) {
+    src.push_back(i);
+  }
+  while (state.KeepRunning()) {
+    BenchDimVector dst = src;
+    benchmark::DoNotOptimize(dst.data());
+  }
+}
+BENCHMARK(BM_SmallVectorCopy)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_SmallVectorAppendRange(benchmark::State& state) {
+  std::vector<int64_t> src(state.range(0), 7);
+  while (state.KeepRunning()) {
+    BenchDimVector v;
+    v.append(src.data(), src.data() + src.size());
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+BENCHMARK(BM_SmallVectorAppendRange)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_SmallVectorResize(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  while (state.KeepRunning()) {
+    BenchDimVector v;
+    v.resize(n);
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+BENCHMARK(BM_SmallVectorResize)->Arg(4)->Arg(16)->Arg(64);
+
+static void BM_SmallVectorResizeForOverwrite(benchmark::State& state) {
+  const int64_t n = state.range(0);
+  while (state.KeepRunning()) {
+    BenchDimVector v;
+    v.resize_for_overwrite(n);
+    benchmark::DoNotOptimize(v.data());
+  }
+}
+BENCHMARK(BM_SmallVectorResizeForOverwrite)->Arg(4)->Arg(16)->Arg(64);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -1,6 +1,11 @@
 #include <c10/core/CPUAllocator.h>
 #include <c10/core/DeviceType.h>
 
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 // TODO: rename flags to C10
 C10_DEFINE_bool(
     caffe2_report_cpu_memory_usage,
@@ -17,8 +22,140 @@ C10_DEFINE_bool(
     false,
     "If set, fill memory with deterministic junk when allocating on CPU");
 
+C10_DEFINE_bool(
+    caffe2_cpu_small_alloc_cache,
+    true,
+    "If set, cache small CPU allocations in per-thread free lists instead of "
+    "returning them to the system allocator");
+
 namespace c10 {
 
+namespace {
+
+// Per-thread caching of small allocations. Workloads that create many small
+// tensors (e.g. step-by-step RNN decoding) spend a noticeable fraction of
+// their time in posix_memalign/free; blocks up to kSmallAllocLimit bytes are
+// instead rounded up to a power-of-two size class and recycled through a
+// free list owned by the freeing thread.
+//
+// free_cpu() only receives a pointer, so the size class of live cached
+// blocks is tracked in a sharded global map. The map is only updated when a
+// block enters or permanently leaves the cache; in steady state an
+// allocation is a lock-free pop from the thread-local free list and a
+// deallocation is one sharded lookup plus a push.
+
+constexpr size_t kSmallAllocLimit = 4096;
+constexpr size_t kMinSizeClass = 64;
+constexpr size_t kNumSizeClasses = 7; // 64, 128, ..., 4096
+constexpr size_t kMaxBlocksPerClass = 64;
+constexpr size_t kNumShards = 64;
+
+size_t size_class_index(size_t nbytes) {
+  size_t index = 0;
+  size_t size = kMinSizeClass;
+  while (size < nbytes) {
+    size <<= 1;
+    index++;
+  }
+  return index;
+}
+
+size_t size_class_bytes(size_t index) {
+  return kMinSizeClass << index;
+}
+
+struct SizeClassMap {
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<void*, uint8_t> classes;
+  };
+
+  Shard& shard(void* ptr) {
+    // discard the alignment bits before sharding
+    auto hash = reinterpret_cast<uintptr_t>(ptr) / gAlignment;
+    return shards_[hash % kNumShards];
+  }
+
+  void insert(void* ptr, size_t index) {
+    auto& s = shard(ptr);
+    std::lock_guard<std::mutex> guard(s.mutex);
+    s.classes[ptr] = static_cast<uint8_t>(index);
+  }
+
+  // Returns the size class of ptr, or -1 if ptr is not a cached block.
+  int lookup(void* ptr) {
+    auto& s = shard(ptr);
+    std::lock_guard<std::mutex> guard(s.mutex);
+    auto it = s.classes.find(ptr);
+    return it == s.classes.end() ? -1 : static_cast<int>(it->second);
+  }
+
+  void erase(void* ptr) {
+    auto& s = shard(ptr);
+    std::lock_guard<std::mutex> guard(s.mutex);
+    s.classes.erase(ptr);
+  }
+
+  std::array<Shard, kNumShards> shards_;
+};
+
+SizeClassMap& size_class_map() {
+  static SizeClassMap* map = new SizeClassMap();
+  return *map;
+}
+
+void* raw_alloc_cpu(size_t nbytes);
+void raw_free_cpu(void* data);
+
+struct ThreadLocalFreeLists {
+  std::array<std::vector<void*>, kNumSizeClasses> lists;
+
+  // Returns a cached block or nullptr.
+  void* get(size_t index) {
+    auto& list = lists[index];
+    if (list.empty()) {
+      return nullptr;
+    }
+    void* ptr = list.back();
+    list.pop_back();
+    return ptr;
+  }
+
+  // Takes ownership of ptr; returns false if the list is full and the caller
+  // should free the block for real.
+  bool put(size_t index, void* ptr) {
+    auto& list = lists[index];
+    if (list.size() >= kMaxBlocksPerClass) {
+      return false;
+    }
+    list.push_back(ptr);
+    return true;
+  }
+
+  ~ThreadLocalFreeLists() {
+    for (auto& list : lists) {
+      for (void* ptr : list) {
+        size_class_map().erase(ptr);
+        raw_free_cpu(ptr);
+      }
+    }
+  }
+};
+
+ThreadLocalFreeLists& free_lists() {
+  static thread_local ThreadLocalFreeLists lists;
+  return lists;
+}
+
+// A single relaxed add per allocation; cheap enough to keep unconditional.
+std::atomic<size_t> g_cpu_allocated_bytes_total{0};
+
+} // namespace
+
+size_t cpu_allocated_bytes_total() {
+  return g_cpu_allocated_bytes_total.load(std::memory_order_relaxed);
+}
+
 void memset_junk(void* data, size_t num) {
   // This garbage pattern is NaN when interpreted as floating point values,
   // or as very large integer values.
@@ -36,16 +173,9 @@ void memset_junk(void* data, size_t num) {
   }
 }
 
-void* alloc_cpu(size_t nbytes) {
-  if (nbytes == 0) {
-    return nullptr;
-  }
-  // We might have clowny upstream code that tries to alloc a negative number
-  // of bytes. Let's catch it early.
-  CAFFE_ENFORCE(
-    ((ptrdiff_t)nbytes) >= 0,
-    "alloc_cpu() seems to have been called with negative number: ", nbytes);
+namespace {
 
+void* raw_alloc_cpu(size_t nbytes) {
   void* data;
 #ifdef __ANDROID__
   data = memalign(gAlignment, nbytes);
@@ -70,9 +200,18 @@ void* alloc_cpu(size_t nbytes) {
       "DefaultCPUAllocator: not enough memory: you tried to allocate ",
       nbytes,
       " bytes. Buy new RAM!");
+  return data;
+}
 
-  // move data to a thread's NUMA node
-  NUMAMove(data, nbytes, GetCurrentNUMANode());
+void raw_free_cpu(void* data) {
+#ifdef _MSC_VER
+  _aligned_free(data);
+#else
+  free(data);
+#endif
+}
+
+void fill_if_needed(void* data, size_t nbytes) {
   CHECK(
       !FLAGS_caffe2_cpu_allocator_do_zero_fill ||
       !FLAGS_caffe2_cpu_allocator_do_junk_fill)
@@ -82,16 +221,73 @@ void* alloc_cpu(size_t nbytes) {
   } else if (FLAGS_caffe2_cpu_allocator_do_junk_fill) {
     memset_junk(data, nbytes);
   }
+}
+
+} // namespace
+
+void* alloc_cpu(size_t nbytes) {
+  if (nbytes == 0) {
+    return nullptr;
+  }
+  // We might have clowny upstream code that tries to alloc a negative number
+  // of bytes. Let's catch it early.
+  CAFFE_ENFORCE(
+    ((ptrdiff_t)nbytes) >= 0,
+    "alloc_cpu() seems to have been called with negative number: ", nbytes);
+
+  g_cpu_allocated_bytes_total.fetch_add(nbytes, std::memory_order_relaxed);
+
+  if (FLAGS_caffe2_cpu_small_alloc_cache && nbytes <= kSmallAllocLimit) {
+    size_t index = size_class_index(nbytes);
+    size_t rounded = size_class_bytes(index);
+    void* data = free_lists().get(index);
+    if (data == nullptr) {
+      data = raw_alloc_cpu(rounded);
+      size_class_map().insert(data, index);
+      NUMAMove(data, rounded, GetCurrentNUMANode());
+    }
+    fill_if_needed(data, rounded);
+    return data;
+  }
+
+  void* data = raw_alloc_cpu(nbytes);
+
+  // move data to a thread's NUMA node
+  NUMAMove(data, nbytes, GetCurrentNUMANode());
+  fill_if_needed(data, nbytes);
 
   return data;
 }
 
 void free_cpu(void* data) {
+  if (data == nullptr) {
+    return;
+  }
+  if (FLAGS_caffe2_cpu_small_alloc_cache) {
+    int index = size_class_map().lookup(data);
+    if (index >= 0) {
+      if (free_lists().put(index, data)) {
+        return;
+      }
+      size_class_map().erase(data);
+    }
+  }
+  raw_free_cpu(data);
+}
+
+void* realloc_cpu(void* data, size_t nbytes) {
+  if (data != nullptr) {
+    // A cached block must leave the cache's bookkeeping before realloc()
+    // moves it; otherwise a later allocation at the same address would be
+    // misclassified.
+    size_class_map().erase(data);
+  }
 #ifdef _MSC_VER
-  _aligned_free(data);
+  void* newptr = _aligned_realloc(data, nbytes, gAlignment);
 #else
-  free(data);
+  void* newptr = realloc(data, nbytes);
 #endif
+  return newptr;
 }
 
 // A virtual struct that is used to report C10's memory allocation and
@@ -11,6 +11,7 @@
 C10_DECLARE_bool(caffe2_report_cpu_memory_usage);
 C10_DECLARE_bool(caffe2_cpu_allocator_do_zero_fill);
 C10_DECLARE_bool(caffe2_cpu_allocator_do_junk_fill);
+C10_DECLARE_bool(caffe2_cpu_small_alloc_cache);
 
 namespace c10 {
 
@@ -29,6 +30,17 @@ C10_API void memset_junk(void* data, size_t num);
 
 C10_API void* alloc_cpu(size_t nbytes);
 C10_API void free_cpu(void* data);
+// Reallocation counterpart of alloc_cpu; required instead of plain realloc()
+// so that blocks tracked by the small-allocation cache are released from its
+// bookkeeping before the underlying storage is reallocated.
+C10_API void* realloc_cpu(void* data, size_t nbytes);
+
+// Monotonic count of bytes requested through alloc_cpu() since process
+// start.  Deliberately cumulative rather than "currently live": free_cpu()
+// only receives a pointer, so tracking live bytes would need a size table
+// lookup on every free.  Consumers (e.g. the JIT per-node instrumentation)
+// read this before and after a region of interest and attribute the delta.
+C10_API size_t cpu_allocated_bytes_total();
 
 // Get the CPU Allocator.
 C10_API at::Allocator* GetCPUAllocator();
@@ -0,0 +1,20 @@
+#include <c10/core/InferenceMode.h>
+
+#include <atomic>
+
+namespace c10 {
+
+// Unlike GradMode this is deliberately not thread local: inference mode
+// describes the whole process. Relaxed atomics keep the checks on tensor
+// construction and version bumps essentially free.
+static std::atomic<bool> InferenceMode_enabled{false};
+
+bool InferenceMode::is_enabled() {
+  return InferenceMode_enabled.load(std::memory_order_relaxed);
+}
+
+void InferenceMode::set_enabled(bool enabled) {
+  InferenceMode_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+} // namespace c10
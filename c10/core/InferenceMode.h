@@ -0,0 +1,25 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+
+namespace c10 {
+
+/// Process-level inference mode for deployments that never run autograd.
+///
+/// While enabled, newly constructed tensors skip the allocation of their
+/// shared version counter, so in-place operations on them elide the atomic
+/// version bump, and `at::GradMode::is_enabled()` reports false on every
+/// thread, so operator wrappers never set up gradient recording.
+///
+/// This is a process-wide switch, not a scoped guard like `NoGradGuard`:
+/// it is meant to be flipped once at startup of a pure-inference process,
+/// before tensors are created. Tensors that existed before the switch keep
+/// their version counters. The escape hatch for the rare tensor that needs
+/// autograd tracking anyway is `requires_grad_(true)`, which materializes a
+/// version counter on demand (see `VariableVersion::materialize()`).
+struct C10_API InferenceMode {
+  static bool is_enabled();
+  static void set_enabled(bool enabled);
+};
+
+} // namespace c10
@@ -248,6 +248,12 @@ AutogradMetaInterface::~AutogradMetaInterface() {}
 void TensorImpl::set_requires_grad(bool requires_grad) {
   if (!requires_grad && !autograd_meta_) return;
   if (!autograd_meta_) autograd_meta_ = impl::GetAutogradMetaFactory()->make();
+  if (requires_grad) {
+    // A tensor constructed under inference mode has no version counter;
+    // give it one when it opts back into autograd so in-place
+    // modifications are tracked again.
+    version_counter_.materialize();
+  }
   // NB: In principle, setting requires_grad to false could result in
   // the AutogradMeta becoming equal to a default constructed state,
   // in which case we could apply the nullptr AutogradMeta optimization
@@ -5,6 +5,7 @@
 #include <numeric>
 
 #include <c10/core/Backend.h>
+#include <c10/core/InferenceMode.h>
 #include <c10/core/MemoryFormat.h>
 #include <c10/core/Storage.h>
 #include <c10/core/TensorOptions.h>
@@ -225,20 +226,38 @@ struct C10_API VariableVersion {
 
  public:
   bool unique() const {
-    return 1 == version_counter_.use_count();
+    return !version_counter_ || 1 == version_counter_.use_count();
   }
   // NOTE: As of C++11 and 14, default-constructing a std::atomic variable
   // leaves it in a persistently undefined state. See
   // https://cplusplus.github.io/LWG/issue2334.
-  VariableVersion(uint32_t version = 0)
-      : version_counter_(c10::make_intrusive<VersionCounter>(version)) {}
+  VariableVersion(uint32_t version = 0) {
+    // Under process-level inference mode tensors carry no version counter
+    // at all, so in-place ops skip the shared atomic bump entirely. A
+    // nonzero initial version always allocates: it records history that
+    // must not be dropped (e.g. a counter forwarded from another tensor).
+    if (version != 0 || !InferenceMode::is_enabled()) {
+      version_counter_ = c10::make_intrusive<VersionCounter>(version);
+    }
+  }
+
+  // Escape hatch for tensors created under inference mode that opt back
+  // into autograd tracking (see TensorImpl::set_requires_grad): allocates
+  // the counter this tensor was constructed without.
+  void materialize() {
+    if (!version_counter_) {
+      version_counter_ = c10::make_intrusive<VersionCounter>(0);
+    }
+  }
 
   void bump() noexcept {
-    ++version_counter_->version_;
+    if (version_counter_) {
+      ++version_counter_->version_;
+    }
   }
 
   uint32_t current_version() const noexcept {
-    return version_counter_->version_;
+    return version_counter_ ? version_counter_->version_.load() : 0;
   }
 };
 
@@ -1347,6 +1366,22 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
             strides_[i] = strides_[i + 1] * std::max<int64_t>(sizes_[i + 1], 1);
           }
         }
+        // The channels last bookkeeping in refresh_contiguous() inspects
+        // actual stride values, so 4-D and 5-D tensors take the eager path
+        // below.  For every other rank the contiguity flags for default
+        // contiguous strides are known constants, so the allocation hot path
+        // skips recomputing them.
+        if (dim_ != 4 && dim_ != 5) {
+          // These match what refresh_contiguous() computes for default
+          // contiguous strides at these ranks.
+          is_contiguous_ = true;
+          is_channels_last_contiguous_ = false;
+          is_channels_last_3d_contiguous_ = false;
+          is_channels_last_ = false;
+          is_channels_last_3d_ = false;
+          is_non_overlapping_and_dense_ = true;
+          return;
+        }
         break;
       }
       case MemoryFormat::ChannelsLast: {
@@ -1589,8 +1624,13 @@ protected:
   // since their size is redundant, and if we need to overflow the buffer space
   // we could keep the two pointers together. However, that would require
   // implementing another struct from scratch, so only do this if we're desperate.
-  SmallVector<int64_t,5> sizes_;
-  SmallVector<int64_t,5> strides_;
+  //
+  // Eight elements keep the deepest common shapes inline: 5-D video tensors
+  // plus the extra dims unfold/group transformations introduce. Overflowing
+  // to the heap here puts an allocation on every view/reshape of such
+  // tensors, which costs far more than the few extra inline words.
+  SmallVector<int64_t,8> sizes_;
+  SmallVector<int64_t,8> strides_;
 
   int64_t storage_offset_ = 0;
   // If sizes and strides are empty, the numel is 1!!  However, most of the
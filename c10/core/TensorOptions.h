@@ -1,5 +1,6 @@
 #pragma once
 
+#include <c10/core/Allocator.h>
 #include <c10/core/DefaultDtype.h>
 #include <c10/core/Backend.h>
 #include <c10/core/Layout.h>
@@ -546,6 +547,84 @@ struct C10_API TensorOptions {
 static_assert( sizeof(TensorOptions) <= sizeof(int64_t) * 2,
                "TensorOptions must fit in 128-bits" );
 
+/// A `TensorOptions` whose resolution has been precomputed.
+///
+/// Every factory call that takes a `TensorOptions` re-runs the
+/// layout/device/dtype switches in `computeDispatchKey()`, the default-dtype
+/// lookup, and an allocator lookup, even though most callers construct
+/// tensors with a handful of distinct option sets.  Callers on a hot path
+/// can build a `CachedTensorOptions` once and hand it to factory overloads
+/// that accept it (e.g. `at::native::empty_cached`), skipping the
+/// option-decoding branches on every allocation.
+///
+/// The cache snapshots resolution at construction time: build it *after*
+/// any `set_default_dtype()` or `SetAllocator()` calls it should observe.
+struct C10_API CachedTensorOptions {
+  explicit CachedTensorOptions(const TensorOptions& options)
+      // Pin the (possibly defaulted) dtype into the stored options so that
+      // fallback paths taking `options()` resolve identically to the cache.
+      : options_(options.dtype(options.dtype())),
+        dtype_(options.dtype()),
+        device_(options.device()),
+        dispatch_key_(options.computeDispatchKey()),
+        key_set_(options.key_set()),
+        memory_format_(options.memory_format_opt().value_or(MemoryFormat::Contiguous)),
+        pinned_memory_(options.pinned_memory()),
+        allocator_(nullptr) {
+    // The pinned-memory allocator lives behind the CUDA hooks and device
+    // allocators are stream-aware, so only the plain CPU allocator can be
+    // resolved here; everything else is left to the dispatched factory.
+    if (dispatch_key_ == DispatchKey::CPUTensorId && !pinned_memory_) {
+      allocator_ = GetAllocator(DeviceType::CPU);
+    }
+  }
+
+  /// Returns the normalized `TensorOptions` this cache was built from.
+  const TensorOptions& options() const noexcept {
+    return options_;
+  }
+
+  caffe2::TypeMeta dtype() const noexcept {
+    return dtype_;
+  }
+
+  Device device() const noexcept {
+    return device_;
+  }
+
+  DispatchKey dispatch_key() const noexcept {
+    return dispatch_key_;
+  }
+
+  DispatchKeySet key_set() const noexcept {
+    return key_set_;
+  }
+
+  MemoryFormat memory_format() const noexcept {
+    return memory_format_;
+  }
+
+  bool pinned_memory() const noexcept {
+    return pinned_memory_;
+  }
+
+  /// Returns the pre-resolved allocator, or nullptr if the allocator could
+  /// not be resolved ahead of time (non-CPU device or pinned memory).
+  Allocator* allocator() const noexcept {
+    return allocator_;
+  }
+
+ private:
+  TensorOptions options_;
+  caffe2::TypeMeta dtype_;
+  Device device_;
+  DispatchKey dispatch_key_;
+  DispatchKeySet key_set_;
+  MemoryFormat memory_format_;
+  bool pinned_memory_;
+  Allocator* allocator_;
+};
+
 /// Convenience function that returns a `TensorOptions` object with the `dtype`
 /// set to the given one.
 inline TensorOptions dtype(caffe2::TypeMeta dtype) {
@@ -14,29 +14,33 @@ namespace {
 #ifndef CAFFE2_FB_LIMITED_MOBILE_CAPABILITY
 
 // NB: POD, zero initialized!
-thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
+thread_local PODLocalState raw_local_state;
 
 #else // defined(CAFFE2_FB_LIMITED_MOBILE_CAPABILITY)
 
-static PODLocalDispatchKeySet raw_local_dispatch_key_set;
+static PODLocalState raw_local_state;
 
 #endif
 
 } // anonymous namespace
 
+PODLocalState* tls_local_state_ptr() {
+  return &raw_local_state;
+}
+
 LocalDispatchKeySet tls_local_dispatch_key_set() {
   // Hack until variable performance is fixed
   //
   // ezyang: I'm pretty unhappy about this implementation, it looks wrong
   // to me, as it seems to be performing a mutation on
-  // raw_local_dispatch_key_set.  I can't conveniently test the correct
+  // raw_local_state.dispatch_keys.  I can't conveniently test the correct
   // version though...
   if (FLAGS_disable_variable_dispatch) {
-    raw_local_dispatch_key_set.set_excluded(
-      raw_local_dispatch_key_set.excluded().add(
+    raw_local_state.dispatch_keys.set_excluded(
+      raw_local_state.dispatch_keys.excluded().add(
         DispatchKey::VariableTensorId));
   }
-  return raw_local_dispatch_key_set;
+  return raw_local_state.dispatch_keys;
 }
 
 // An RAII guard could snapshot and restore the entire state (entire DispatchKeySet) as
@@ -56,7 +60,7 @@ LocalDispatchKeySet tls_local_dispatch_key_set() {
 // RAII API
 
 IncludeDispatchKeyGuard::IncludeDispatchKeyGuard(DispatchKey x)
-  : tls_(&raw_local_dispatch_key_set)
+  : tls_(&raw_local_state.dispatch_keys)
   , id_(x)
   // NB: prev_state_ == true on Undefined makes the guard no-op
   , prev_state_(x == DispatchKey::Undefined ? true : tls_->included().has(x)) {
@@ -72,7 +76,7 @@ IncludeDispatchKeyGuard::~IncludeDispatchKeyGuard() {
 }
 
 ExcludeDispatchKeyGuard::ExcludeDispatchKeyGuard(DispatchKey x)
-  : tls_(&raw_local_dispatch_key_set)
+  : tls_(&raw_local_state.dispatch_keys)
   , id_(x)
   // NB: prev_state_ == true on Undefined makes the guard no-op
   , prev_state_(x == DispatchKey::Undefined ? true : tls_->excluded().has(x)) {
@@ -91,11 +95,11 @@ ExcludeDispatchKeyGuard::~ExcludeDispatchKeyGuard() {
 // Please prefer using the RAII API. See declarations in LocalDispatchKeySet.h for details.
 
 bool tls_is_dispatch_key_excluded(DispatchKey x) {
-  return raw_local_dispatch_key_set.excluded().has(x);
+  return raw_local_state.dispatch_keys.excluded().has(x);
 }
 
 void tls_set_dispatch_key_excluded(DispatchKey x, bool desired_state) {
-  auto* tls = &raw_local_dispatch_key_set;
+  auto* tls = &raw_local_state.dispatch_keys;
   bool current_state = tls->excluded().has(x);
   if (desired_state != current_state) {
     if (desired_state) {
@@ -107,12 +111,12 @@ void tls_set_dispatch_key_excluded(DispatchKey x, bool desired_state) {
 }
 
 bool tls_is_dispatch_key_included(DispatchKey x) {
-  return raw_local_dispatch_key_set.included().has(x);
+  return raw_local_state.dispatch_keys.included().has(x);
 
 }
 
 void tls_set_dispatch_key_included(DispatchKey x, bool desired_state) {
-  auto* tls = &raw_local_dispatch_key_set;
+  auto* tls = &raw_local_state.dispatch_keys;
   bool current_state = tls->included().has(x);
   if (desired_state != current_state) {
     if (desired_state) {
@@ -47,6 +47,38 @@ struct C10_API PODLocalDispatchKeySet {
 };
 static_assert(std::is_pod<PODLocalDispatchKeySet>::value, "PODLocalDispatchKeySet must be a POD type.");
 
+// Consolidated per-thread interpreter state. The dispatch key sets and the
+// grad/names mode flags used to live in separate TLS slots, each paying its
+// own tls_get_addr on every op call; packing them into one cache-aligned
+// block means a single TLS address computation serves all of them, and the
+// common "everything still at its default?" query is a handful of loads
+// from one cache line (see tls_local_state_is_default below).
+//
+// All fields are chosen so that the zero-initialized state TLS gives us is
+// the default state; this is why the mode flags are stored inverted (grad
+// and names modes default to enabled).
+struct C10_API alignas(64) PODLocalState {
+  PODLocalDispatchKeySet dispatch_keys;
+  // 1 when GradMode is disabled on this thread
+  uint8_t grad_mode_disabled;
+  // 1 when NamesMode is disabled on this thread
+  uint8_t names_mode_disabled;
+};
+static_assert(std::is_pod<PODLocalState>::value, "PODLocalState must be a POD type.");
+
+// Returns the consolidated TLS block for the current thread. GradMode and
+// NamesMode in ATen store their flags here instead of in their own slots.
+C10_API PODLocalState* tls_local_state_ptr();
+
+// True iff every piece of consolidated per-thread state still has its
+// default value: no included or excluded dispatch keys, grad mode and
+// names mode enabled.
+inline bool tls_local_state_is_default() {
+  PODLocalState* tls = tls_local_state_ptr();
+  return (tls->dispatch_keys.included_ | tls->dispatch_keys.excluded_ |
+          tls->grad_mode_disabled | tls->names_mode_disabled) == 0;
+}
+
 struct C10_API LocalDispatchKeySet {
   /* implicit */ LocalDispatchKeySet(PODLocalDispatchKeySet x)
     : included_(x.included()), excluded_(x.excluded()) {}
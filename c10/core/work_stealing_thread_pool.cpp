@@ -0,0 +1,143 @@
+#include <c10/core/work_stealing_thread_pool.h>
+#include <c10/util/Logging.h>
+
+namespace c10 {
+
+namespace {
+// Worker index of the pool the current thread belongs to. Each thread can
+// belong to at most one pool, so a single thread-local is sufficient.
+thread_local WorkStealingThreadPool* tls_pool = nullptr;
+thread_local int tls_worker_index = -1;
+} // namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(
+    int pool_size,
+    int numa_node_id,
+    std::function<void()> init_thread)
+    : workers_(pool_size < 0 ? defaultNumThreads() : pool_size),
+      threads_(workers_.size()),
+      running_(true),
+      pending_(0),
+      available_(workers_.size()),
+      next_queue_(0) {
+  (void)numa_node_id;
+  for (std::size_t i = 0; i < workers_.size(); ++i) {
+    workers_[i] = std::unique_ptr<Worker>(new Worker());
+  }
+  for (std::size_t i = 0; i < threads_.size(); ++i) {
+    threads_[i] = std::thread([this, i, init_thread]() {
+      if (init_thread) {
+        init_thread();
+      }
+      tls_pool = this;
+      tls_worker_index = static_cast<int>(i);
+      this->main_loop(i);
+    });
+  }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    running_ = false;
+    condition_.notify_all();
+  }
+
+  for (auto& t : threads_) {
+    try {
+      t.join();
+    } catch (const std::exception&) {
+    }
+  }
+}
+
+size_t WorkStealingThreadPool::size() const {
+  return threads_.size();
+}
+
+size_t WorkStealingThreadPool::numAvailable() const {
+  return available_.load();
+}
+
+bool WorkStealingThreadPool::inThreadPool() const {
+  return tls_pool == this;
+}
+
+int WorkStealingThreadPool::current_worker_index() const {
+  return tls_pool == this ? tls_worker_index : -1;
+}
+
+void WorkStealingThreadPool::run(const std::function<void()>& func) {
+  if (threads_.size() == 0) {
+    throw std::runtime_error("No threads to run a task");
+  }
+  int index = current_worker_index();
+  if (index < 0) {
+    // External submission: spread across deques round-robin.
+    index = next_queue_++ % workers_.size();
+  }
+  {
+    auto& worker = *workers_[index];
+    std::lock_guard<std::mutex> guard(worker.mutex);
+    worker.tasks.push_back(func);
+  }
+  pending_++;
+  // Only take the wakeup lock if someone might be sleeping.
+  if (available_.load() > 0) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.notify_one();
+  }
+}
+
+bool WorkStealingThreadPool::try_get_task(
+    std::size_t index,
+    std::function<void()>& task) {
+  // Own deque first, LIFO: the most recently forked task is the one whose
+  // inputs are still in cache.
+  {
+    auto& own = *workers_[index];
+    std::lock_guard<std::mutex> guard(own.mutex);
+    if (!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+  // Steal FIFO from peers, starting at the next deque so that victims are
+  // spread out instead of everyone hammering worker 0.
+  for (std::size_t i = 1; i < workers_.size(); ++i) {
+    auto& victim = *workers_[(index + i) % workers_.size()];
+    std::lock_guard<std::mutex> guard(victim.mutex);
+    if (!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void WorkStealingThreadPool::main_loop(std::size_t index) {
+  while (running_) {
+    std::function<void()> task;
+    if (try_get_task(index, task)) {
+      pending_--;
+      available_--;
+      try {
+        task();
+      } catch (const std::exception& e) {
+        LOG(ERROR) << "Exception in thread pool task: " << e.what();
+      } catch (...) {
+        LOG(ERROR) << "Exception in thread pool task: unknown";
+      }
+      available_++;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [&]() {
+      return pending_.load() > 0 || !running_;
+    });
+  }
+}
+
+} // namespace c10
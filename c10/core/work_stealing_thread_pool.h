@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <c10/core/thread_pool.h>
+
+namespace c10 {
+
+// A task pool with one deque per worker thread instead of the single
+// mutex-protected FIFO in ThreadPool. Tasks submitted from a pool thread go
+// to that thread's own deque and are popped LIFO, which keeps fork/join
+// chains (e.g. TorchScript prim::fork trees) hot in cache; idle workers
+// steal FIFO from the other end of peer deques. This avoids serializing all
+// workers on a single queue lock, which is what limits the FIFO pool past
+// ~16 cores under fine-grained inter-op parallelism.
+//
+// Each deque has its own lock; this is not a lock-free Chase-Lev deque, but
+// contention is now per-deque and the common push/pop path only touches the
+// owner's lock.
+class C10_API WorkStealingThreadPool : public c10::TaskThreadPoolBase {
+ public:
+  WorkStealingThreadPool() = delete;
+
+  explicit WorkStealingThreadPool(
+      int pool_size,
+      int numa_node_id = -1,
+      std::function<void()> init_thread = nullptr);
+
+  ~WorkStealingThreadPool() override;
+
+  size_t size() const override;
+
+  size_t numAvailable() const override;
+
+  bool inThreadPool() const override;
+
+  void run(const std::function<void()>& func) override;
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  // @brief Entry point for pool threads.
+  void main_loop(std::size_t index);
+
+  // @brief Pop a task from the worker's own deque (LIFO) or steal one from
+  // a peer (FIFO). Returns false if no work was found anywhere.
+  bool try_get_task(std::size_t index, std::function<void()>& task);
+
+  // Index of the worker deque owned by the current thread, or -1 if the
+  // current thread is not part of this pool.
+  int current_worker_index() const;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+
+  // Guards sleeping/wakeup only; task deques have their own locks.
+  mutable std::mutex mutex_;
+  std::condition_variable condition_;
+  std::atomic_bool running_;
+  std::atomic<std::size_t> pending_;
+  std::atomic<std::size_t> available_;
+  std::atomic<std::size_t> next_queue_;
+};
+
+class C10_API WorkStealingTaskThreadPool : public c10::WorkStealingThreadPool {
+ public:
+  explicit WorkStealingTaskThreadPool(
+      std::size_t pool_size,
+      int numa_node_id = -1)
+      : WorkStealingThreadPool(pool_size, numa_node_id, [numa_node_id](){
+        setThreadName("CaffeTaskThread");
+        NUMABind(numa_node_id);
+      }) {}
+};
+
+} // namespace c10
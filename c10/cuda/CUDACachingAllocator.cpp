@@ -7,7 +7,9 @@
 
 #include <cuda_runtime_api.h>
 #include <algorithm>
+#include <atomic>
 #include <bitset>
+#include <cstdlib>
 #include <deque>
 #include <iterator>
 #include <map>
@@ -63,6 +65,72 @@ constexpr size_t kSmallBuffer = 2097152;    // "small" allocations are packed in
 constexpr size_t kLargeBuffer = 20971520;   // "large" allocations may be packed in 20 MiB blocks
 constexpr size_t kMinLargeAlloc = 10485760; // allocations between 1 and 10 MiB may use kLargeBuffer
 constexpr size_t kRoundLarge = 2097152;     // round up large allocs to 2 MiB
+constexpr size_t kEventPoolSize = 64;       // max idle cudaEvents cached per device
+
+// NOTE [ Large allocation rounding ]
+//
+// By default requested sizes are rounded to multiples of kMinBlockSize
+// (512 bytes). Workloads whose tensor sizes vary from step to step (e.g.
+// serving with variable sequence lengths) then populate the large pool with
+// thousands of distinct block sizes; a cached block is only reused when a
+// request fits in it, so the pool steadily fragments until a large request
+// fails even though plenty of free bytes remain (visible as a low
+// largest_free_block in FragmentationStats).
+//
+// Setting PYTORCH_CUDA_ALLOC_ROUNDUP_POWER2_DIVISIONS=N (or calling
+// CUDACachingAllocator::setRoundupPower2Divisions) instead rounds sizes
+// above kSmallSize up to a bucket boundary: each power-of-two interval
+// [2^k, 2^(k+1)) is split into N equal buckets, so N=1 rounds to the next
+// power of two and larger values of N trade less padding for more distinct
+// sizes. N must be a power of two no greater than kSmallSize / kMinBlockSize
+// so that buckets stay kMinBlockSize-aligned. This wastes up to 1/N of each
+// allocation but keeps the set of block sizes small and stable, which lets
+// long-running processes keep reusing cached blocks.
+constexpr size_t kMaxRoundupDivisions = kSmallSize / kMinBlockSize;
+
+bool valid_roundup_divisions(size_t divisions) {
+  // zero (disabled) and powers of two up to kMaxRoundupDivisions
+  return (divisions & (divisions - 1)) == 0 &&
+      divisions <= kMaxRoundupDivisions;
+}
+
+size_t parse_roundup_power2_divisions() {
+  const char* val = std::getenv("PYTORCH_CUDA_ALLOC_ROUNDUP_POWER2_DIVISIONS");
+  if (val == nullptr) {
+    return 0;
+  }
+  char* end = nullptr;
+  const size_t divisions = std::strtoul(val, &end, 10);
+  if (end == val || *end != '\0' || !valid_roundup_divisions(divisions)) {
+    TORCH_WARN(
+        "PYTORCH_CUDA_ALLOC_ROUNDUP_POWER2_DIVISIONS must be a power of two "
+        "no greater than ", kMaxRoundupDivisions, " (got \"", val,
+        "\"); bucketed rounding is disabled.");
+    return 0;
+  }
+  return divisions;
+}
+
+std::atomic<size_t>& roundup_power2_divisions() {
+  static std::atomic<size_t> divisions(parse_roundup_power2_divisions());
+  return divisions;
+}
+
+size_t roundup_bucketed(size_t size, size_t divisions) {
+  // Finds the power-of-two interval [interval, 2 * interval) containing
+  // size, then rounds up to the next multiple of interval / divisions.
+  // Callers only pass size > kSmallSize, so the bucket width is at least
+  // kSmallSize / kMaxRoundupDivisions == kMinBlockSize.
+  size_t interval = kSmallSize;
+  while (interval <= size / 2) {
+    interval *= 2;
+  }
+  if (size == interval) {
+    return size;
+  }
+  const size_t bucket = interval / divisions;
+  return bucket * ((size + bucket - 1) / bucket);
+}
 
 typedef std::bitset<static_cast<size_t>(StatType::NUM_TYPES)> StatTypes;
 
@@ -141,6 +209,46 @@ static bool BlockComparator(const Block* a, const Block* b)
   return (uintptr_t)a->ptr < (uintptr_t)b->ptr;
 }
 
+// NOTE [ Named allocation pools ]
+//
+// By default all allocations on a device share one pair of block pools, so
+// when several clients share a process (e.g. a server running many models
+// per GPU) one client's allocation burst can evict every other client's
+// cached blocks: a failed cudaMalloc falls back to synchronize-and-free of
+// the entire cache. A named pool gives a client its own pair of block pools
+// with independent caching and an optional reservation quota:
+//
+//   - blocks cached in one pool are never handed to allocations routed to
+//     another pool, and a failed cudaMalloc first frees only the requesting
+//     pool's cached blocks, touching other pools only if that is still not
+//     enough to satisfy the request;
+//   - a nonzero quota caps the bytes a pool may keep reserved on each
+//     device, so one client cannot grow past its share of the GPU;
+//   - a pool can be pre-warmed at client load time (preWarmPool) so its
+//     steady-state allocations are served from cache.
+//
+// Pools are created with createMemPool and selected by placing a
+// MemPoolGuard on the allocating thread. Frees always route a block back to
+// its owning pool, so no guard is needed when memory is released. Pools are
+// never destroyed; they live for the lifetime of the process.
+struct MemPool {
+  std::string name;
+  size_t quota;            // max reserved bytes per device; 0 = unlimited
+  BlockPool large_blocks;  // unallocated cached blocks larger than 1 MB
+  BlockPool small_blocks;  // unallocated cached blocks 1 MB or smaller
+  std::unordered_map<int, size_t> reserved_bytes;  // segment bytes per device
+
+  MemPool(std::string name, size_t quota)
+      : name(std::move(name)),
+        quota(quota),
+        large_blocks(BlockComparator),
+        small_blocks(BlockComparator) {}
+};
+
+// The pool serving this thread's allocations; nullptr selects the default
+// pool. Written only by MemPoolGuard.
+thread_local MemPool* active_pool = nullptr;
+
 static std::string format_size(uint64_t size) {
   std::ostringstream os;
   os.precision(2);
@@ -175,23 +283,46 @@ class THCCachingAllocator {
   // device statistics
   std::vector<DeviceStats> device_stats;
 
-  // unallocated cached blocks larger than 1 MB
-  BlockPool large_blocks;
+  // pool serving allocations made outside any MemPoolGuard
+  MemPool default_pool;
+
+  // named per-client pools; see NOTE [ Named allocation pools ]
+  std::unordered_map<std::string, std::unique_ptr<MemPool>> named_pools;
 
-  // unallocated cached blocks 1 MB or smaller
-  BlockPool small_blocks;
+  // maps a BlockPool back to its owning MemPool and stat type in O(1). A
+  // Block only stores its BlockPool*, and this is consulted on every free.
+  std::unordered_map<const BlockPool*, std::pair<MemPool*, StatType>>
+      pool_index;
 
   // allocated blocks by device pointer
   std::unordered_map<void*, Block*> allocated_blocks;
 
   // outstanding cuda events
-  std::deque<std::pair<cudaEvent_t, Block*>> cuda_events;
+  struct OutstandingEvent {
+    cudaEvent_t event;
+    Block* block;
+    int device;  // device the event was created on; keys the event pool
+  };
+  std::deque<OutstandingEvent> cuda_events;
+
+  // Idle cudaEvents kept per device for reuse, so that cross-stream frees
+  // do not pay a cudaEventCreate/cudaEventDestroy round trip per block. At
+  // most kEventPoolSize events are kept per device; the rest are destroyed
+  // as they retire, and emptyCache drains the pools entirely.
+  std::vector<std::vector<cudaEvent_t>> event_pools;
+
+  // Number of CUDA graph captures currently underway; see
+  // notifyCaptureBegin. While nonzero, the allocator must not call any
+  // CUDA API that is illegal during stream capture (cudaMalloc, cudaFree,
+  // event queries), so allocations are served strictly from cached blocks
+  // and event processing is deferred.
+  int capture_underway = 0;
 
  public:
 
-  THCCachingAllocator() :
-      large_blocks(BlockComparator),
-      small_blocks(BlockComparator) {}
+  THCCachingAllocator() : default_pool("", 0) {
+    register_pool(default_pool);
+  }
 
   std::mutex* getCudaFreeMutex() const {
     return &cuda_free_mutex;
@@ -208,13 +339,17 @@ class THCCachingAllocator {
     int device;
     C10_CUDA_CHECK(cudaGetDevice(&device));
 
-    // process outstanding cudaEvents
-    process_events();
+    // process outstanding cudaEvents (deferred during graph capture, since
+    // event queries are not capture safe)
+    if (capture_underway == 0) {
+      process_events();
+    }
 
     size = round_size(size);
 
     Block search_key(device, stream, size);
-    auto& pool = get_pool(size);
+    MemPool& mempool = active_pool != nullptr ? *active_pool : default_pool;
+    auto& pool = get_pool(mempool, size);
 
     DeviceStats& stats = get_stats_for_device(device);
     StatTypes stat_types;
@@ -233,7 +368,7 @@ class THCCachingAllocator {
     };
 
     Block* block = find_free_block();
-    if (block == nullptr) {
+    if (block == nullptr && capture_underway == 0) {
       bool freed_memory = false;
       for (const auto& name : FreeCudaMemoryCallbacksRegistry()->Keys()) {
         freed_memory |=
@@ -244,12 +379,33 @@ class THCCachingAllocator {
       }
     }
     if (block == nullptr) {
+      TORCH_CHECK(capture_underway == 0,
+          "CUDACachingAllocator: cannot allocate a new device memory segment "
+          "during CUDA graph capture. Run a warmup iteration of the captured "
+          "region before capture so all allocations are served from the "
+          "pre-reserved cache (requested size: ", size, " bytes).");
       void* ptr;
       size_t alloc_size = get_allocation_size(size);
-      cudaError_t err = cuda_malloc_with_retry(device, &ptr, alloc_size);
+      if (mempool.quota != 0 &&
+          mempool.reserved_bytes[device] + alloc_size > mempool.quota) {
+        // Try to make room under the quota by returning the pool's own
+        // cached segments to the driver. A fitting cached block would have
+        // been found above, so this can only shrink reserved_bytes.
+        free_cached_blocks_in_pool(mempool, device);
+        TORCH_CHECK_WITH(CUDAOutOfMemoryError,
+            mempool.reserved_bytes[device] + alloc_size <= mempool.quota,
+            "CUDA out of memory. Allocation pool \"", mempool.name,
+            "\" would exceed its quota of ", format_size(mempool.quota),
+            " on GPU ", device, " (",
+            format_size(mempool.reserved_bytes[device]),
+            " currently reserved; tried to allocate ",
+            format_size(alloc_size), ")");
+      }
+      cudaError_t err = cuda_malloc_with_retry(device, &ptr, alloc_size, mempool);
 
       if (err == cudaSuccess) {
         block = new Block(device, stream, alloc_size, &pool, ptr);
+        mempool.reserved_bytes[device] += alloc_size;
         update_stat_array(stats.segment, 1, stat_types);
         update_stat_array(stats.reserved_bytes, alloc_size, stat_types);
       } else if (err == cudaErrorMemoryAllocation) {
@@ -278,6 +434,11 @@ class THCCachingAllocator {
         // Note that at this point cuda_malloc_with_retry has already returned all
         // possible "cached" memory to the driver. The only remaining "cached"
         // memory is split from a larger block that is partially in-use.
+        FragmentationStats frag;
+        for (MemPool* p : all_pools()) {
+          fragmentation_stats_aux(p->large_blocks, device, frag);
+          fragmentation_stats_aux(p->small_blocks, device, frag);
+        }
         TORCH_CHECK_WITH(CUDAOutOfMemoryError, false,
           "CUDA out of memory. Tried to allocate ", format_size(alloc_size),
           " (GPU ", device, "; ",
@@ -286,7 +447,8 @@ class THCCachingAllocator {
           " already allocated; ",
           format_size(device_free), " free; ",
           format_size(stats.reserved_bytes[static_cast<size_t>(StatType::AGGREGATE)].current),
-          " reserved in total by PyTorch)");
+          " reserved in total by PyTorch; largest cached free block is ",
+          format_size(frag.largest_free_block), ")");
       } else {
         C10_CUDA_CHECK(err);
       }
@@ -344,6 +506,14 @@ class THCCachingAllocator {
       return;
     }
 
+    // Retire completed cross-stream events here as well as in malloc, so
+    // that blocks deferred by recordStream() become reusable as soon as any
+    // allocator traffic happens instead of waiting for the next malloc.
+    // Deferred during graph capture (event queries are not capture safe).
+    if (capture_underway == 0) {
+      process_events();
+    }
+
     auto it = allocated_blocks.find(ptr);
     if (it == allocated_blocks.end()) {
       AT_ERROR("invalid device pointer: ", ptr);
@@ -361,6 +531,10 @@ class THCCachingAllocator {
     update_stat_array(stats.allocated_bytes, -block->size, {stat_types});
 
     if (!block->stream_uses.empty()) {
+      TORCH_CHECK(capture_underway == 0,
+          "CUDACachingAllocator: freeing a block that was recorded on "
+          "another stream (recordStream) is not supported during CUDA graph "
+          "capture.");
       insert_events(block);
     } else {
       free_block(block);
@@ -416,19 +590,94 @@ class THCCachingAllocator {
     block->stream_uses.insert(stream);
   }
 
+  /** notifies the allocator that a CUDA graph capture is beginning on this
+   *  process; while any capture is underway, allocations are served strictly
+   *  from cached blocks and no CUDA memory or event API is called **/
+  void notifyCaptureBegin() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    ++capture_underway;
+  }
+
+  /** notifies the allocator that a CUDA graph capture has ended **/
+  void notifyCaptureEnd() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    TORCH_INTERNAL_ASSERT(capture_underway > 0,
+        "notifyCaptureEnd without a matching notifyCaptureBegin");
+    --capture_underway;
+  }
+
+  /** creates a named allocation pool; see NOTE [ Named allocation pools ] **/
+  void createPool(const std::string& name, size_t quota) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    TORCH_CHECK(!name.empty(), "allocation pool name must be non-empty");
+    TORCH_CHECK(named_pools.count(name) == 0,
+        "allocation pool \"", name, "\" already exists");
+    auto pool = std::unique_ptr<MemPool>(new MemPool(name, quota));
+    register_pool(*pool);
+    named_pools.emplace(name, std::move(pool));
+  }
+
+  /** looks up a named allocation pool, which must have been created **/
+  MemPool* getPool(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = named_pools.find(name);
+    TORCH_CHECK(it != named_pools.end(),
+        "allocation pool \"", name, "\" does not exist; "
+        "create it with createMemPool first");
+    return it->second.get();
+  }
+
+  /** returns the named pool's cached blocks to the system allocator **/
+  void emptyPoolCache(const std::string& name) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    TORCH_CHECK(capture_underway == 0,
+        "CUDACachingAllocator: emptyPoolCache is not supported during CUDA "
+        "graph capture.");
+    auto it = named_pools.find(name);
+    TORCH_CHECK(it != named_pools.end(),
+        "allocation pool \"", name, "\" does not exist");
+    MemPool& pool = *(it->second);
+    synchronize_and_free_events(nullopt);
+    free_blocks(pool.large_blocks, pool.large_blocks.begin(), pool.large_blocks.end());
+    free_blocks(pool.small_blocks, pool.small_blocks.begin(), pool.small_blocks.end());
+  }
+
+  /** bytes the named pool has reserved (cached + in use) on the device **/
+  size_t getPoolReservedBytes(const std::string& name, int device) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    auto it = named_pools.find(name);
+    TORCH_CHECK(it != named_pools.end(),
+        "allocation pool \"", name, "\" does not exist");
+    auto res = it->second->reserved_bytes.find(device);
+    return res != it->second->reserved_bytes.end() ? res->second : 0;
+  }
+
   /** returns cached blocks to the system allocator **/
   void emptyCache() {
     std::lock_guard<std::recursive_mutex> lock(mutex);
+    TORCH_CHECK(capture_underway == 0,
+        "CUDACachingAllocator: emptyCache is not supported during CUDA "
+        "graph capture.");
     synchronize_and_free_events(nullopt);
-    free_blocks(large_blocks, large_blocks.begin(), large_blocks.end());
-    free_blocks(small_blocks, small_blocks.begin(), small_blocks.end());
+    for (MemPool* pool : all_pools()) {
+      free_blocks(pool->large_blocks, pool->large_blocks.begin(), pool->large_blocks.end());
+      free_blocks(pool->small_blocks, pool->small_blocks.begin(), pool->small_blocks.end());
+    }
+    for (auto& event_pool : event_pools) {
+      for (cudaEvent_t event : event_pool) {
+        C10_CUDA_CHECK(cudaEventDestroy(event));
+      }
+      event_pool.clear();
+    }
   }
 
   /** Retrieves info (total size + largest block) of the memory cache **/
   void cacheInfo(int dev_id, size_t* total, size_t* largest) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
-    cache_info_aux(large_blocks, dev_id, total, largest);
-    cache_info_aux(small_blocks, dev_id, total, largest);
+    for (MemPool* pool : all_pools()) {
+      cache_info_aux(pool->large_blocks, dev_id, total, largest);
+      cache_info_aux(pool->small_blocks, dev_id, total, largest);
+    }
   }
 
   /** Returns a copy of the memory allocator stats for the device **/
@@ -437,6 +686,17 @@ class THCCachingAllocator {
     return get_stats_for_device(dev_id);
   }
 
+  /** Returns fragmentation telemetry (free-block layout) for the device **/
+  FragmentationStats getFragmentationStats(int dev_id) {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+    FragmentationStats stats;
+    for (MemPool* pool : all_pools()) {
+      fragmentation_stats_aux(pool->large_blocks, dev_id, stats);
+      fragmentation_stats_aux(pool->small_blocks, dev_id, stats);
+    }
+    return stats;
+  }
+
   /** Resets the historical accumulation stats for the device **/
   void resetAccumulatedStats(int dev_id) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -455,6 +715,8 @@ class THCCachingAllocator {
 
     stats.num_alloc_retries = 0;
     stats.num_ooms = 0;
+    stats.num_events_created = 0;
+    stats.num_events_reused = 0;
   }
 
   /** Resets the historical peak stats for the device **/
@@ -489,7 +751,8 @@ class THCCachingAllocator {
       SegmentInfo& segment_info = result.back();
       segment_info.device = head_block->device;
       segment_info.address = reinterpret_cast<int64_t>(head_block->ptr);
-      segment_info.is_large = (head_block->pool == &large_blocks);
+      segment_info.is_large =
+          (get_stat_type_for_pool(*head_block->pool) == StatType::LARGE_POOL);
 
       const Block* block = head_block;
       while (block != nullptr) {
@@ -534,10 +797,35 @@ class THCCachingAllocator {
     return device_stats.at(device);
   }
 
+  // indexes both of a pool's BlockPools for O(1) owner/kind lookup
+  void register_pool(MemPool& pool) {
+    pool_index.emplace(
+        &pool.small_blocks, std::make_pair(&pool, StatType::SMALL_POOL));
+    pool_index.emplace(
+        &pool.large_blocks, std::make_pair(&pool, StatType::LARGE_POOL));
+  }
+
+  std::vector<MemPool*> all_pools() {
+    std::vector<MemPool*> pools;
+    pools.reserve(1 + named_pools.size());
+    pools.push_back(&default_pool);
+    for (auto& item : named_pools) {
+      pools.push_back(item.second.get());
+    }
+    return pools;
+  }
+
   std::vector<const Block*> get_all_blocks() const {
     std::vector<const Block*> blocks;
-    blocks.insert(blocks.end(), small_blocks.begin(), small_blocks.end());
-    blocks.insert(blocks.end(), large_blocks.begin(), large_blocks.end());
+    const auto append_pool = [&](const BlockPool& pool) {
+      blocks.insert(blocks.end(), pool.begin(), pool.end());
+    };
+    append_pool(default_pool.small_blocks);
+    append_pool(default_pool.large_blocks);
+    for (const auto& item : named_pools) {
+      append_pool(item.second->small_blocks);
+      append_pool(item.second->large_blocks);
+    }
     for (const auto& item : allocated_blocks) {
       blocks.push_back(item.second);
     }
@@ -611,41 +899,50 @@ class THCCachingAllocator {
     return subsumed_size;
   }
 
-  BlockPool& get_pool(size_t size) {
+  BlockPool& get_pool(MemPool& mempool, size_t size) {
     if (size <= kSmallSize) {
-      return small_blocks;
+      return mempool.small_blocks;
     } else {
-      return large_blocks;
+      return mempool.large_blocks;
     }
   }
 
-  StatType get_stat_type_for_pool(const BlockPool& pool) {
-    if (&pool == &small_blocks) {
-      return StatType::SMALL_POOL;
-    } else if (&pool == &large_blocks) {
-      return StatType::LARGE_POOL;
-    } else {
+  StatType get_stat_type_for_pool(const BlockPool& pool) const {
+    auto it = pool_index.find(&pool);
+    if (it == pool_index.end()) {
       AT_ERROR("get_stat_type_for_pool: invalid pool");
     }
+    return it->second.second;
+  }
+
+  MemPool& get_owning_mempool(const BlockPool& pool) {
+    auto it = pool_index.find(&pool);
+    if (it == pool_index.end()) {
+      AT_ERROR("get_owning_mempool: invalid pool");
+    }
+    return *it->second.first;
   }
 
   bool should_split(const Block* block, size_t size) {
     size_t remaining = block->size - size;
-    if (block->pool == &small_blocks) {
+    if (get_stat_type_for_pool(*block->pool) == StatType::SMALL_POOL) {
       return remaining >= kMinBlockSize;
-    } else if (block->pool == &large_blocks) {
-      return remaining > kSmallSize;
     } else {
-      AT_ERROR("should_split: invalid pool");
+      return remaining > kSmallSize;
     }
   }
 
   size_t round_size(size_t size) {
     if (size < kMinBlockSize) {
       return kMinBlockSize;
-    } else {
-      return kMinBlockSize * ((size + kMinBlockSize - 1) / kMinBlockSize);
     }
+    // See NOTE [ Large allocation rounding ]
+    const size_t divisions =
+        roundup_power2_divisions().load(std::memory_order_relaxed);
+    if (divisions != 0 && size > kSmallSize) {
+      return roundup_bucketed(size, divisions);
+    }
+    return kMinBlockSize * ((size + kMinBlockSize - 1) / kMinBlockSize);
   }
 
   size_t get_allocation_size(size_t size) {
@@ -658,24 +955,31 @@ class THCCachingAllocator {
     }
   }
 
-  cudaError_t cuda_malloc_with_retry(int device, void** devPtr, size_t size)
+  cudaError_t cuda_malloc_with_retry(int device, void** devPtr, size_t size, MemPool& mempool)
   {
-    // Try cudaMalloc. If cudaMalloc fails, frees all non-split cached blocks
-    // and retries.
+    // Try cudaMalloc. If cudaMalloc fails, frees the requesting pool's
+    // non-split cached blocks and retries; only if that is still not enough
+    // are the other pools' caches freed as well, so one client's burst does
+    // not evict another pool's cache unless the alternative is an OOM.
     cudaError_t err = cudaMalloc(devPtr, size);
 
     if (err != cudaSuccess) {
+      DeviceStats& stats = get_stats_for_device(device);
+      stats.num_alloc_retries += 1;
+      cudaGetLastError();  // reset the last CUDA error
+      free_cached_blocks_in_pool(mempool, device);
+      err = cudaMalloc(devPtr, size);
+    }
+
+    if (err != cudaSuccess && !named_pools.empty()) {
       DeviceStats& stats = get_stats_for_device(device);
       stats.num_alloc_retries += 1;
       cudaGetLastError();  // reset the last CUDA error
       free_cached_blocks(device);
       err = cudaMalloc(devPtr, size);
-      if (err != cudaSuccess) {
-        return err;
-      }
     }
 
-    return cudaSuccess;
+    return err;
   }
 
   void free_cached_blocks(int device)
@@ -684,27 +988,45 @@ class THCCachingAllocator {
     // outstanding events are returned to the pool.
     synchronize_and_free_events(device);
 
-    // Free all non-split cached blocks on device
+    for (MemPool* pool : all_pools()) {
+      free_pool_blocks_on_device(*pool, device);
+    }
+  }
+
+  void free_cached_blocks_in_pool(MemPool& pool, int device)
+  {
+    // First ensure that all blocks that can't currently be allocated due to
+    // outstanding events are returned to the pool.
+    synchronize_and_free_events(device);
+
+    free_pool_blocks_on_device(pool, device);
+  }
+
+  void free_pool_blocks_on_device(MemPool& pool, int device)
+  {
+    // Free all non-split cached blocks of the pool on device
     Block lower_bound(device, nullptr, 0);
     Block upper_bound(device + 1, nullptr, 0);
 
     free_blocks(
-        large_blocks,
-        large_blocks.lower_bound(&lower_bound),
-        large_blocks.lower_bound(&upper_bound));
+        pool.large_blocks,
+        pool.large_blocks.lower_bound(&lower_bound),
+        pool.large_blocks.lower_bound(&upper_bound));
     free_blocks(
-        small_blocks,
-        small_blocks.lower_bound(&lower_bound),
-        small_blocks.lower_bound(&upper_bound));
+        pool.small_blocks,
+        pool.small_blocks.lower_bound(&lower_bound),
+        pool.small_blocks.lower_bound(&upper_bound));
   }
 
   void free_blocks(BlockPool& blocks, BlockPool::iterator it, BlockPool::iterator end)
   {
     // Frees all non-split blocks between `it` and `end`
+    MemPool& mempool = get_owning_mempool(blocks);
     while (it != end) {
       Block* block = *it;
       if (!block->prev && !block->next) {
         C10_CUDA_CHECK(cudaFree((void*)block->ptr));
+        mempool.reserved_bytes[block->device] -= block->size;
 
         DeviceStats& stats = get_stats_for_device(block->device);
         StatTypes stat_types;
@@ -730,19 +1052,17 @@ class THCCachingAllocator {
     auto remaining_events = decltype(cuda_events)();
 
     for (auto& e : cuda_events) {
-      cudaEvent_t event = e.first;
-      Block* block = e.second;
-      if (device.has_value() && block->device != *device) {
+      if (device.has_value() && e.block->device != *device) {
         remaining_events.push_back(e);
         continue;
       }
 
-      C10_CUDA_CHECK(cudaEventSynchronize(event));
-      C10_CUDA_CHECK(cudaEventDestroy(event));
+      C10_CUDA_CHECK(cudaEventSynchronize(e.event));
+      release_event(e.event, e.device);
 
-      block->event_count--;
-      if (block->event_count == 0) {
-        free_block(block);
+      e.block->event_count--;
+      if (e.block->event_count == 0) {
+        free_block(e.block);
       }
     }
 
@@ -757,6 +1077,42 @@ class THCCachingAllocator {
     return it->second;
   }
 
+  /** takes an idle event from the device's pool, creating one on a miss.
+   *  The current CUDA device must already be `device` (set by insert_events
+   *  before recording). **/
+  cudaEvent_t acquire_event(int device) {
+    auto& event_pool = get_event_pool(device);
+    if (!event_pool.empty()) {
+      cudaEvent_t event = event_pool.back();
+      event_pool.pop_back();
+      get_stats_for_device(device).num_events_reused += 1;
+      return event;
+    }
+    cudaEvent_t event;
+    C10_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    get_stats_for_device(device).num_events_created += 1;
+    return event;
+  }
+
+  /** returns a retired event to the device's pool, destroying it if the
+   *  pool is already full **/
+  void release_event(cudaEvent_t event, int device) {
+    auto& event_pool = get_event_pool(device);
+    if (event_pool.size() < kEventPoolSize) {
+      event_pool.push_back(event);
+    } else {
+      C10_CUDA_CHECK(cudaEventDestroy(event));
+    }
+  }
+
+  std::vector<cudaEvent_t>& get_event_pool(int device) {
+    TORCH_CHECK(device >= 0);
+    if ((size_t) device >= event_pools.size()) {
+      event_pools.resize(device + 1);
+    }
+    return event_pools.at(device);
+  }
+
   void insert_events(Block* block)
   {
     int prev_device;
@@ -767,12 +1123,11 @@ class THCCachingAllocator {
     for (auto it = streams.begin(); it != streams.end(); ++it) {
       C10_CUDA_CHECK(cudaSetDevice(it->device_index()));
 
-      cudaEvent_t event;
-      C10_CUDA_CHECK(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+      cudaEvent_t event = acquire_event(it->device_index());
       C10_CUDA_CHECK(cudaEventRecord(event, it->stream()));
 
       block->event_count++;
-      cuda_events.emplace_back(event, block);
+      cuda_events.push_back({event, block, it->device_index()});
     }
 
     C10_CUDA_CHECK(cudaSetDevice(prev_device));
@@ -787,10 +1142,8 @@ class THCCachingAllocator {
     // the processing of some events may be delayed.
     while (!cuda_events.empty()) {
       auto& e = cuda_events.front();
-      cudaEvent_t event = e.first;
-      Block* block = e.second;
 
-      cudaError_t err = cudaEventQuery(event);
+      cudaError_t err = cudaEventQuery(e.event);
       if (err == cudaErrorNotReady) {
         // ignore and clear the error if not ready
         cudaGetLastError();
@@ -799,16 +1152,33 @@ class THCCachingAllocator {
         C10_CUDA_CHECK(err);
       }
 
-      C10_CUDA_CHECK(cudaEventDestroy(event));
+      release_event(e.event, e.device);
 
-      block->event_count--;
-      if (block->event_count == 0) {
-        free_block(block);
+      e.block->event_count--;
+      if (e.block->event_count == 0) {
+        free_block(e.block);
       }
       cuda_events.pop_front();
     }
   }
 
+  // Accumulates fragmentation telemetry for given device in given pool
+  void fragmentation_stats_aux(BlockPool& blocks, int dev_id, FragmentationStats& stats)
+  {
+    Block search_key(dev_id, 0, 0);
+    auto it = blocks.lower_bound(&search_key);
+    for (; it != blocks.end() && *it && (*it)->device == dev_id; ++it) {
+      const Block* block = *it;
+      int64_t blocksize = block->size;
+      stats.free_bytes += blocksize;
+      stats.num_free_blocks += 1;
+      stats.largest_free_block = std::max(stats.largest_free_block, blocksize);
+      if (block->is_split()) {
+        stats.free_split_bytes += blocksize;
+      }
+    }
+  }
+
   // Accumulates sizes of all memory blocks for given device in given pool
   void cache_info_aux(BlockPool& blocks, int dev_id, size_t* total, size_t* largest)
   {
@@ -855,6 +1225,71 @@ void emptyCache(void) {
   caching_allocator.emptyCache();
 }
 
+void notifyCaptureBegin(void) {
+  caching_allocator.notifyCaptureBegin();
+}
+
+void notifyCaptureEnd(void) {
+  caching_allocator.notifyCaptureEnd();
+}
+
+void createMemPool(const std::string& name, size_t quota_bytes) {
+  caching_allocator.createPool(name, quota_bytes);
+}
+
+void emptyPoolCache(const std::string& name) {
+  caching_allocator.emptyPoolCache(name);
+}
+
+size_t getPoolReservedBytes(const std::string& name, int device) {
+  return caching_allocator.getPoolReservedBytes(name, device);
+}
+
+void preWarmPool(const std::string& name, const std::vector<size_t>& sizes) {
+  int device;
+  C10_CUDA_CHECK(cudaGetDevice(&device));
+  cudaStream_t stream = cuda::getCurrentCUDAStream(device);
+
+  // Allocate everything before freeing anything, so the pool ends up caching
+  // one block per requested size rather than reusing or splitting the block
+  // warmed by an earlier iteration. Freeing in reverse re-merges neighbors
+  // in the order they were split.
+  MemPoolGuard guard(name);
+  std::vector<void*> ptrs;
+  ptrs.reserve(sizes.size());
+  for (size_t size : sizes) {
+    if (size == 0) {
+      continue;
+    }
+    void* ptr = nullptr;
+    caching_allocator.malloc(&ptr, size, stream);
+    ptrs.push_back(ptr);
+  }
+  for (auto it = ptrs.rbegin(); it != ptrs.rend(); ++it) {
+    caching_allocator.free(*it);
+  }
+}
+
+MemPoolGuard::MemPoolGuard(const std::string& name)
+    : prev_pool_(active_pool) {
+  active_pool = caching_allocator.getPool(name);
+}
+
+MemPoolGuard::~MemPoolGuard() {
+  active_pool = static_cast<MemPool*>(prev_pool_);
+}
+
+void setRoundupPower2Divisions(size_t divisions) {
+  TORCH_CHECK(valid_roundup_divisions(divisions),
+      "roundup divisions must be zero (disabled) or a power of two no "
+      "greater than ", kMaxRoundupDivisions, ", but got ", divisions);
+  roundup_power2_divisions().store(divisions, std::memory_order_relaxed);
+}
+
+size_t roundupPower2Divisions(void) {
+  return roundup_power2_divisions().load(std::memory_order_relaxed);
+}
+
 void cacheInfo(int dev_id, size_t* cachedAndFree, size_t* largestBlock) {
   caching_allocator.cacheInfo(dev_id, cachedAndFree, largestBlock);
 }
@@ -884,6 +1319,11 @@ DeviceStats getDeviceStats(int device) {
   return caching_allocator.getStatsForDevice(device);
 }
 
+FragmentationStats getFragmentationStats(int device) {
+  assertValidDevice(device);
+  return caching_allocator.getFragmentationStats(device);
+}
+
 void resetAccumulatedStats(int device) {
   assertValidDevice(device);
   caching_allocator.resetAccumulatedStats(device);
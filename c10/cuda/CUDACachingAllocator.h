@@ -85,6 +85,28 @@ struct DeviceStats {
 
   // COUNT: total number of OOMs (i.e. failed calls to CUDA after cache flush)
   int64_t num_ooms = 0;
+
+  // COUNT: cudaEvents created for cross-stream frees (event pool misses)
+  int64_t num_events_created = 0;
+  // COUNT: cudaEvents reused from the event pool (event pool hits)
+  int64_t num_events_reused = 0;
+};
+
+// Fragmentation telemetry for a device: summarizes how the memory the
+// allocator holds is carved up. A reserved pool that is mostly free but has
+// only small largest_free_block values is badly fragmented and will OOM on
+// large requests even though free_bytes is high.
+struct FragmentationStats {
+  // SUM: bytes in cached (unallocated) blocks
+  int64_t free_bytes = 0;
+  // COUNT: cached (unallocated) blocks
+  int64_t num_free_blocks = 0;
+  // MAX: size of the largest cached block; an upper bound on the largest
+  // request servable without a new cudaMalloc
+  int64_t largest_free_block = 0;
+  // SUM: bytes in cached blocks that are split from a segment and therefore
+  // cannot be returned to the driver
+  int64_t free_split_bytes = 0;
 };
 
 // Struct containing info of an allocation block (i.e. a fractional part of a cudaMalloc)..
@@ -111,10 +133,57 @@ C10_CUDA_API void raw_delete(void* ptr);
 
 C10_CUDA_API Allocator* get();
 C10_CUDA_API void emptyCache();
+// Marks the beginning/end of a CUDA graph capture. While a capture is
+// underway the allocator serves allocations from cached blocks only and
+// defers all CUDA memory and event API calls, which are illegal during
+// stream capture. See at::cuda::CUDAGraph.
+C10_CUDA_API void notifyCaptureBegin();
+C10_CUDA_API void notifyCaptureEnd();
+// Named allocation pools give clients sharing a process (e.g. several models
+// served from one GPU) independently cached memory: blocks cached in one
+// pool are never evicted to satisfy another pool's allocations unless the
+// alternative is an OOM, and a nonzero quota_bytes caps the bytes the pool
+// may keep reserved on each device. Allocations are routed to a pool by
+// placing a MemPoolGuard on the allocating thread; frees always return a
+// block to its owning pool. Pools live for the lifetime of the process. See
+// NOTE [ Named allocation pools ] in CUDACachingAllocator.cpp.
+C10_CUDA_API void createMemPool(const std::string& name, size_t quota_bytes = 0);
+// Returns the named pool's cached blocks to the system allocator.
+C10_CUDA_API void emptyPoolCache(const std::string& name);
+// Bytes the named pool has reserved (cached + in use) on the device.
+C10_CUDA_API size_t getPoolReservedBytes(const std::string& name, int device);
+// Allocates each of `sizes` bytes from the named pool on the current stream
+// and frees them again, leaving the pool's cache warm so the client's
+// steady-state allocations are served without cudaMalloc. Intended to be
+// called once at client (e.g. model) load time.
+C10_CUDA_API void preWarmPool(const std::string& name, const std::vector<size_t>& sizes);
+
+// RAII guard that routes the current thread's allocations to a named pool,
+// which must already have been created with createMemPool.
+struct C10_CUDA_API MemPoolGuard {
+  explicit MemPoolGuard(const std::string& name);
+  ~MemPoolGuard();
+  MemPoolGuard(const MemPoolGuard&) = delete;
+  MemPoolGuard& operator=(const MemPoolGuard&) = delete;
+
+ private:
+  // previously active pool, restored on destruction; the pool type is
+  // internal to CUDACachingAllocator.cpp
+  void* prev_pool_;
+};
+// Configures rounding of large (>1 MiB) allocations: each power-of-two size
+// interval is split into `divisions` buckets and requests are rounded up to
+// the next bucket boundary, bounding the number of distinct block sizes the
+// large pool can fragment into. Zero (the default) keeps plain 512-byte
+// rounding; also settable via PYTORCH_CUDA_ALLOC_ROUNDUP_POWER2_DIVISIONS.
+// See NOTE [ Large allocation rounding ] in CUDACachingAllocator.cpp.
+C10_CUDA_API void setRoundupPower2Divisions(size_t divisions);
+C10_CUDA_API size_t roundupPower2Divisions();
 C10_CUDA_API void cacheInfo(int dev_id, size_t* cachedAndFree, size_t* largestBlock);
 C10_CUDA_API void* getBaseAllocation(void *ptr, size_t *size);
 C10_CUDA_API void recordStream(const DataPtr&, CUDAStream stream);
 C10_CUDA_API DeviceStats getDeviceStats(int device);
+C10_CUDA_API FragmentationStats getFragmentationStats(int device);
 C10_CUDA_API void resetAccumulatedStats(int device);
 C10_CUDA_API void resetPeakStats(int device);
 C10_CUDA_API std::vector<SegmentInfo> snapshot();
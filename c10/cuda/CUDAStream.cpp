@@ -3,10 +3,14 @@
 #include <c10/cuda/CUDAGuard.h>
 #include <c10/util/Exception.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cstdint>
+#include <cstdlib>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <iostream>
@@ -39,16 +43,21 @@ struct LeakyStreamInternals {
 
 // Global stream state and constants
 static DeviceIndex num_gpus = -1;
-static constexpr int kStreamsPerPoolBits = 5;
-static constexpr int kStreamsPerPool = 1 << kStreamsPerPoolBits;
+// Compile-time upper bounds; the actual pool size and number of priority
+// pools are chosen at first use, see initGlobalStreamState.
+static constexpr int kStreamIndexBits = 7;
+static constexpr int kMaxStreamsPerPool = 1 << kStreamIndexBits;
+static constexpr int kMaxPriorityPools = 4;
 static constexpr unsigned int kDefaultFlags = cudaStreamNonBlocking;
 
-// Note: stream priority is not supported by HIP
-// Note: lower numbers are higher priorities, zero is default priority
-#ifndef __HIP_PLATFORM_HCC__
-static int kHighPriority = -1;
-static int kLowPriority = 0;
-#endif // __HIP_PLATFORM_HCC__
+// Streams per priority pool, configurable via PYTORCH_CUDA_STREAMS_PER_POOL
+// up to kMaxStreamsPerPool.
+static int streams_per_pool = 32;
+// Number of priority pools; pool p is created with CUDA priority -p (lower
+// numbers are higher priorities, zero is default priority).  Determined from
+// the range the device reports.  Priority is not supported by HIP, where all
+// pools get default-priority streams.
+static int num_priority_pools = 2;
 
 // Default streams
 static std::once_flag init_flag;
@@ -56,34 +65,48 @@ static LeakyStreamInternals default_streams[C10_COMPILE_TIME_MAX_GPUS];
 
 // Non-default streams
 // Note: the number of CUDA devices is determined at run time,
-// and the low and high priority pools are lazily initialized
-// when the first stream is requested for a device.
+// and the priority pools are lazily initialized when the first
+// stream is requested for a device.
 // The device flags track the initialization of each device, while
-// the low and high priority counters track, for each device, the next stream
+// the counters track, for each device and priority, the next stream
 // in the pool to be returned when a stream is requested (round-robin fashion
 // , see the note in CUDAStream.h).
-//
-// unique_ptr<T[]> is used instead of vector<T> because T might be non-moveable
-// and non-copyable.
 static std::once_flag device_flags[C10_COMPILE_TIME_MAX_GPUS];
-static std::atomic<uint32_t> low_priority_counters[C10_COMPILE_TIME_MAX_GPUS];
-static std::atomic<uint32_t> high_priority_counters[C10_COMPILE_TIME_MAX_GPUS];
-static std::array<LeakyStreamInternals, kStreamsPerPool>
-    low_priority_streams[C10_COMPILE_TIME_MAX_GPUS];
-static std::array<LeakyStreamInternals, kStreamsPerPool>
-    high_priority_streams[C10_COMPILE_TIME_MAX_GPUS];
+static std::atomic<uint32_t>
+    priority_counters[kMaxPriorityPools][C10_COMPILE_TIME_MAX_GPUS];
+static std::array<LeakyStreamInternals, kMaxStreamsPerPool>
+    priority_streams[kMaxPriorityPools][C10_COMPILE_TIME_MAX_GPUS];
+
+// Named stream groups: each group owns a contiguous slice at the tail of one
+// priority pool; reserved_counts[p] is how many streams at the tail of pool p
+// belong to groups and are therefore skipped by the anonymous round-robin.
+struct StreamGroup {
+  StreamGroup(int pool, int start, int size)
+      : pool(pool), start(start), size(size) {
+    for (auto& c : counters) {
+      c = 0;
+    }
+  }
+
+  int pool;
+  int start;
+  int size;
+  std::array<std::atomic<uint32_t>, C10_COMPILE_TIME_MAX_GPUS> counters;
+};
+static std::mutex group_mutex;
+static std::unordered_map<std::string, StreamGroup> stream_groups;
+static std::atomic<int> reserved_counts[kMaxPriorityPools];
 
 // Note [StreamId assignment]
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~
 // How do we assign stream IDs?
 //
-// -- 25 bits -- -- 2 bits --  -- 5 bits -----
+// -- 22 bits -- -- 3 bits --  -- 7 bits -----
 // zeros         StreamIdType  stream id index
 //
 // Where StreamIdType:
-//  00 = default stream
-//  01 = low priority stream
-//  10 = high priority stream
+//  0 = default stream
+//  t > 0 = stream from priority pool t - 1
 //
 // This is not really for efficiency; it's just easier to write the code
 // to extract the index if we do this with bitmasks :)
@@ -100,44 +123,20 @@ static std::array<LeakyStreamInternals, kStreamsPerPool>
 // https://stackoverflow.com/questions/13150449/efficient-unsigned-to-signed-cast-avoiding-implementation-defined-behavior
 // but it seems a bit overkill for this.
 
-enum class StreamIdType : uint8_t {
-  DEFAULT = 0x0,
-  LOW = 0x1,
-  HIGH = 0x2,
-};
-
-std::ostream& operator<<(std::ostream& stream, StreamIdType s) {
-  switch (s) {
-    case StreamIdType::DEFAULT:
-      stream << "DEFAULT";
-      break;
-    case StreamIdType::LOW:
-      stream << "LOW";
-      break;
-    case StreamIdType::HIGH:
-      stream << "HIGH";
-      break;
-    default:
-      stream << static_cast<uint8_t>(s);
-      break;
-  }
-  return stream;
-}
-
 // StreamId is 32-bit, so we can just rely on regular promotion rules.
 // We rely on streamIdIndex and streamIdType being non-negative;
 // see Note [Hazard when concatenating signed integers]
 
-static inline StreamIdType streamIdType(StreamId s) {
-  return static_cast<StreamIdType>(s >> kStreamsPerPoolBits);
+static inline int streamIdType(StreamId s) {
+  return static_cast<int>(s >> kStreamIndexBits);
 }
 
 static inline size_t streamIdIndex(StreamId s) {
-  return static_cast<size_t>(s & ((1 << kStreamsPerPoolBits) - 1));
+  return static_cast<size_t>(s & (kMaxStreamsPerPool - 1));
 }
 
-StreamId makeStreamId(StreamIdType st, size_t si) {
-  return (static_cast<StreamId>(st) << kStreamsPerPoolBits) |
+StreamId makeStreamId(int st, size_t si) {
+  return (static_cast<StreamId>(st) << kStreamIndexBits) |
       static_cast<StreamId>(si);
 }
 
@@ -158,24 +157,19 @@ static StreamId CUDAStream_getStreamId(const LeakyStreamInternals* ptr) {
 
   // Check if it's the default stream
   if (ptr == &default_streams[device_index]) {
-    return makeStreamId(StreamIdType::DEFAULT, 0);
+    return makeStreamId(0, 0);
   }
 
-  // Check if it's a low priority stream
+  // Check if it's a stream from one of the priority pools
   // NB: Because ptr may not necessarily lie within the array, we must use
   // std::less and similar templates to avoid UB that arises when
   // doing an operator< comparison.
-  if (pointer_within<LeakyStreamInternals>(
-          ptr, low_priority_streams[device_index])) {
-    return makeStreamId(
-        StreamIdType::LOW, ptr - low_priority_streams[device_index].data());
-  }
-
-  // Check if it's a high priority stream
-  if (pointer_within<LeakyStreamInternals>(
-          ptr, high_priority_streams[device_index])) {
-    return makeStreamId(
-        StreamIdType::HIGH, ptr - high_priority_streams[device_index].data());
+  for (int p = 0; p < num_priority_pools; ++p) {
+    if (pointer_within<LeakyStreamInternals>(
+            ptr, priority_streams[p][device_index])) {
+      return makeStreamId(
+          p + 1, ptr - priority_streams[p][device_index].data());
+    }
   }
 
   AT_ASSERTM(
@@ -207,39 +201,65 @@ static void initGlobalStreamState() {
       C10_COMPILE_TIME_MAX_GPUS,
       "). Increase that and recompile.");
 
+  // Pool size is read once, so that the StreamId <-> pool slot mapping
+  // never changes after streams have been handed out.
+  const char* pool_size_env = getenv("PYTORCH_CUDA_STREAMS_PER_POOL");
+  if (pool_size_env != nullptr) {
+    int requested = atoi(pool_size_env);
+    if (requested < 1 || requested > kMaxStreamsPerPool) {
+      TORCH_WARN(
+          "PYTORCH_CUDA_STREAMS_PER_POOL must be between 1 and ",
+          kMaxStreamsPerPool,
+          ", got ",
+          requested,
+          "; using ",
+          streams_per_pool);
+    } else {
+      streams_per_pool = requested;
+    }
+  }
+
+#ifndef __HIP_PLATFORM_HCC__
+  // One pool per supported priority level, up to kMaxPriorityPools.  Pool p
+  // is created with priority -p, so pool 0 keeps the old "low priority"
+  // behavior and pool 1 the old "high priority" one.
+  int least_priority = 0;
+  int greatest_priority = 0;
+  if (cudaDeviceGetStreamPriorityRange(&least_priority, &greatest_priority) ==
+      cudaSuccess) {
+    num_priority_pools = std::min(
+        std::max(least_priority - greatest_priority + 1, 1), kMaxPriorityPools);
+  }
+#endif // __HIP_PLATFORM_HCC__
+
   // Initializes default streams
   for (auto i = decltype(num_gpus){0}; i < num_gpus; ++i) {
     default_streams[i].device_index = i;
-    low_priority_counters[i] = 0;
-    high_priority_counters[i] = 0;
+    for (int p = 0; p < num_priority_pools; ++p) {
+      priority_counters[p][i] = 0;
+    }
   }
 }
 
-// Creates the low and high priority stream pools for the specified device
+// Creates the priority stream pools for the specified device
 // Warning: only call once per device!
 static void initDeviceStreamState(DeviceIndex device_index) {
   // Switches to the requested device so streams are properly associated
   // with it.
   CUDAGuard device_guard{device_index};
 
-  for (auto i = decltype(kStreamsPerPool){0}; i < kStreamsPerPool; ++i) {
-    auto& lowpri_stream = low_priority_streams[device_index][i];
-    auto& hipri_stream = high_priority_streams[device_index][i];
-
-    lowpri_stream.device_index = device_index;
-    hipri_stream.device_index = device_index;
+  for (int p = 0; p < num_priority_pools; ++p) {
+    for (int i = 0; i < streams_per_pool; ++i) {
+      auto& stream = priority_streams[p][device_index][i];
+      stream.device_index = device_index;
 
 #ifndef __HIP_PLATFORM_HCC__
-    C10_CUDA_CHECK(cudaStreamCreateWithPriority(
-        &lowpri_stream.stream, kDefaultFlags, kLowPriority));
-    C10_CUDA_CHECK(cudaStreamCreateWithPriority(
-        &hipri_stream.stream, kDefaultFlags, kHighPriority));
+      C10_CUDA_CHECK(cudaStreamCreateWithPriority(
+          &stream.stream, kDefaultFlags, /* priority */ -p));
 #else
-    C10_CUDA_CHECK(
-        cudaStreamCreateWithFlags(&lowpri_stream.stream, kDefaultFlags));
-    C10_CUDA_CHECK(
-        cudaStreamCreateWithFlags(&hipri_stream.stream, kDefaultFlags));
+      C10_CUDA_CHECK(cudaStreamCreateWithFlags(&stream.stream, kDefaultFlags));
 #endif // __HIP_PLATFORM_HCC__
+    }
   }
 }
 
@@ -265,43 +285,46 @@ static inline void check_gpu(DeviceIndex device_index) {
   AT_ASSERT(device_index >= 0 && device_index < num_gpus);
 }
 
-// Helper to determine the index of the stream to return
+// Helper to determine the index of the stream to return from pool `pool`.
+// Streams reserved for named groups sit at the tail of the pool and are
+// skipped here.
 // Note: Streams are returned round-robin (see note in CUDAStream.h)
-static uint32_t get_idx(std::atomic<uint32_t>& counter) {
-  auto raw_idx = counter++;
-  return raw_idx % kStreamsPerPool;
+static uint32_t get_idx(int pool, DeviceIndex device_index) {
+  auto raw_idx = priority_counters[pool][device_index]++;
+  return raw_idx % (streams_per_pool - reserved_counts[pool].load());
+}
+
+// Maps a CUDA priority (lower is higher priority, zero is default) to a
+// priority pool index, clamping to the available pools.
+static int priority_to_pool(int priority) {
+  return std::min(std::max(-priority, 0), num_priority_pools - 1);
 }
 
 // See Note [StreamId assignment]
 LeakyStreamInternals* CUDAStream_internals(CUDAStream s) {
   c10::DeviceIndex device_index = s.device_index();
-  StreamIdType st = streamIdType(s.unwrap().id());
+  int st = streamIdType(s.unwrap().id());
   size_t si = streamIdIndex(s.unwrap().id());
-  switch (st) {
-    case StreamIdType::DEFAULT:
-      AT_ASSERTM(
-          si == 0,
-          "Unrecognized stream ",
-          s.unwrap(),
-          " (I think this should be the default stream, but I got a non-zero index ",
-          si,
-          ").",
-          " Did you manufacture the StreamId yourself?  Don't do that; use the",
-          " official API like c10::cuda::getStreamFromPool() to get a new stream.");
-      return &default_streams[device_index];
-    case StreamIdType::LOW:
-      return &low_priority_streams[device_index][si];
-    case StreamIdType::HIGH:
-      return &high_priority_streams[device_index][si];
-    default:
-      AT_ASSERTM(
-          0,
-          "Unrecognized stream ",
-          s.unwrap(),
-          " (I didn't recognize the stream type, ",
-          st,
-          ")");
+  if (st == 0) {
+    AT_ASSERTM(
+        si == 0,
+        "Unrecognized stream ",
+        s.unwrap(),
+        " (I think this should be the default stream, but I got a non-zero index ",
+        si,
+        ").",
+        " Did you manufacture the StreamId yourself?  Don't do that; use the",
+        " official API like c10::cuda::getStreamFromPool() to get a new stream.");
+    return &default_streams[device_index];
   }
+  AT_ASSERTM(
+      st <= num_priority_pools && si < static_cast<size_t>(streams_per_pool),
+      "Unrecognized stream ",
+      s.unwrap(),
+      " (I didn't recognize the stream type, ",
+      st,
+      ")");
+  return &priority_streams[st - 1][device_index][si];
 }
 
 CUDAStream CUDAStream_fromInternals(const LeakyStreamInternals* ptr) {
@@ -327,6 +350,10 @@ cudaStream_t CUDAStream::stream() const {
 CUDAStream getStreamFromPool(
     const bool isHighPriority,
     DeviceIndex device_index) {
+  return getStreamFromPool(isHighPriority ? -1 : 0, device_index);
+}
+
+CUDAStream getStreamFromPool(const int priority, DeviceIndex device_index) {
   initCUDAStreamsOnce();
   if (device_index == -1)
     device_index = current_device();
@@ -336,13 +363,66 @@ CUDAStream getStreamFromPool(
   std::call_once(
       device_flags[device_index], initDeviceStreamState, device_index);
 
-  if (isHighPriority) {
-    const auto idx = get_idx(high_priority_counters[device_index]);
-    return CUDAStream_fromInternals(&high_priority_streams[device_index][idx]);
-  }
+  const int pool = priority_to_pool(priority);
+  const auto idx = get_idx(pool, device_index);
+  return CUDAStream_fromInternals(&priority_streams[pool][device_index][idx]);
+}
+
+void createStreamGroup(const std::string& name, int count, int priority) {
+  initCUDAStreamsOnce();
+  TORCH_CHECK(count > 0, "Expected a positive stream count, got ", count);
+  const int pool = priority_to_pool(priority);
+
+  std::lock_guard<std::mutex> guard(group_mutex);
+  TORCH_CHECK(
+      stream_groups.find(name) == stream_groups.end(),
+      "Stream group '",
+      name,
+      "' already exists");
+  int reserved = reserved_counts[pool].load();
+  TORCH_CHECK(
+      reserved + count < streams_per_pool,
+      "Cannot reserve ",
+      count,
+      " streams for group '",
+      name,
+      "': ",
+      streams_per_pool - reserved,
+      " unreserved streams left in the priority pool, and at least one must ",
+      "remain outside of groups");
+  // Groups take slices from the tail of the pool; the anonymous round-robin
+  // in get_idx wraps before the reserved region.
+  int start = streams_per_pool - reserved - count;
+  stream_groups.emplace(
+      std::piecewise_construct,
+      std::forward_as_tuple(name),
+      std::forward_as_tuple(pool, start, count));
+  reserved_counts[pool] += count;
+}
 
-  const auto idx = get_idx(low_priority_counters[device_index]);
-  return CUDAStream_fromInternals(&low_priority_streams[device_index][idx]);
+CUDAStream getStreamFromGroup(const std::string& name, DeviceIndex device_index) {
+  initCUDAStreamsOnce();
+  if (device_index == -1)
+    device_index = current_device();
+  check_gpu(device_index);
+
+  // Initializes the stream pools (once)
+  std::call_once(
+      device_flags[device_index], initDeviceStreamState, device_index);
+
+  StreamGroup* group = nullptr;
+  {
+    std::lock_guard<std::mutex> guard(group_mutex);
+    auto it = stream_groups.find(name);
+    TORCH_CHECK(
+        it != stream_groups.end(), "Unknown stream group '", name, "'");
+    // Groups are never erased, so the pointer stays valid after unlocking.
+    group = &it->second;
+  }
+  const auto idx =
+      group->start + group->counters[device_index]++ % group->size;
+  return CUDAStream_fromInternals(
+      &priority_streams[group->pool][device_index][idx]);
 }
 
 CUDAStream getDefaultCUDAStream(DeviceIndex device_index) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 #include <utility>
 
 #include <cuda_runtime_api.h>
@@ -23,26 +24,28 @@
 * The first pool contains only the default stream. When the default stream
 * is requested it's returned.
 *
-* The second pool is the "low priority" or "default priority" streams. In
-* HIP builds there is no distinction between streams in this pool and streams
-* in the third pool (below). There are 32 of these streams per device, and
-* when a stream is requested one of these streams is returned round-robin.
-* That is, the first stream requested is at index 0, the second at index 1...
-* to index 31, then index 0 again.
+* The remaining pools hold the non-default streams, one pool per priority
+* level. Pool 0 is the "low priority" or "default priority" streams; each
+* further pool is created with the next higher CUDA priority, up to the
+* range the device reports. In HIP builds priorities are not supported and
+* all such pools behave like pool 0. Each pool holds 32 streams per device
+* by default; the size can be changed with the PYTORCH_CUDA_STREAMS_PER_POOL
+* environment variable (read once, at first use). When a stream is requested
+* one of these streams is returned round-robin. That is, the first stream
+* requested is at index 0, the second at index 1... to the last index, then
+* index 0 again.
 *
-* This means that if 33 low priority streams are requested, the first and
-* last streams requested are actually the same stream (under the covers)
-* and kernels enqueued on them cannot run concurrently.
-*
-* The third pool is the "high priority" streams. The third pool acts like
-* the second pool except the streams are created with a higher priority.
+* This means that if one more stream is requested than the pool holds, the
+* first and last streams requested are actually the same stream (under the
+* covers) and kernels enqueued on them cannot run concurrently.
 *
 * These pools suggest that stream users should prefer many short-lived streams,
-* as the cost of acquiring and releasing streams is effectively zero. If
-* many longer-lived streams are required in performance critical scenarios
-* then the functionality here may need to be extended to allow, for example,
-* "reserving" a subset of the pool so that other streams do not accidentally
-* overlap the performance critical streams.
+* as the cost of acquiring and releasing streams is effectively zero.
+*
+* For longer-lived streams in performance critical scenarios, a subset of a
+* pool can be reserved as a named stream group (see createStreamGroup).
+* Streams in a group are never returned by the anonymous round-robin, so
+* work scheduled through a group never shares a stream with other traffic.
 *
 * Note: although the notion of "current stream for device" is thread local
 * (every OS thread has a separate current stream, as one might expect),
@@ -184,6 +187,38 @@ private:
 CAFFE2_API CUDAStream
 getStreamFromPool(const bool isHighPriority = false, DeviceIndex device = -1);
 
+/**
+ * Get a new stream from the pool with the given CUDA priority (lower numbers
+ * are higher priorities, zero is the default priority).  Priorities outside
+ * the range supported by the device are clamped to the nearest supported
+ * level.  Like the overload above, streams are returned round-robin.
+ */
+CAFFE2_API CUDAStream
+getStreamFromPool(const int priority, DeviceIndex device = -1);
+
+/**
+ * Reserve `count` streams of the given CUDA priority as a named group.
+ * Grouped streams are taken out of the anonymous round-robin rotation on
+ * every device, so requests served through getStreamFromGroup never share a
+ * stream with other traffic.  Groups should be created at startup, before
+ * the anonymous pool is in steady use; each priority pool must keep at
+ * least one stream outside of groups.  Throws if the name is already taken
+ * or not enough unreserved streams remain.
+ */
+CAFFE2_API void createStreamGroup(
+    const std::string& name,
+    int count,
+    int priority = 0);
+
+/**
+ * Get a stream from the named group created with createStreamGroup, for the
+ * passed CUDA device (or the current device if none is passed).  Streams
+ * within a group are returned round-robin.
+ */
+CAFFE2_API CUDAStream getStreamFromGroup(
+    const std::string& name,
+    DeviceIndex device = -1);
+
 /**
  * Get the default CUDA stream, for the passed CUDA device, or for the
  * current device if no device index is passed.  The default stream is
@@ -259,6 +259,18 @@ class SmallVectorTemplateBase : public SmallVectorTemplateCommon<T> {
     std::uninitialized_copy(Iit, Eit, Dest);
   }
 
+  /// Value-initialize elements in the uninitialized range [S, E).
+  static void uninitialized_value_construct(T* S, T* E) {
+    for (; S != E; ++S)
+      ::new ((void*)S) T();
+  }
+
+  /// Default-initialize elements in the uninitialized range [S, E).
+  static void uninitialized_default_construct(T* S, T* E) {
+    for (; S != E; ++S)
+      ::new ((void*)S) T;
+  }
+
   /// Grow the allocated memory (without initializing new elements), doubling
   /// the size of the allocated memory. Guarantees space for at least one more
   /// element, or MinSize more elements if specified.
@@ -357,8 +369,18 @@ class SmallVectorTemplateBase<T, true> : public SmallVectorTemplateCommon<T> {
       memcpy(Dest, Iit, (Eit - Iit) * sizeof(T));
   }
 
+  /// Value-initializing trivially copyable elements is a zero fill.
+  static void uninitialized_value_construct(T* S, T* E) {
+    if (S != E)
+      memset(S, 0, (E - S) * sizeof(T));
+  }
+
+  /// Default-initializing trivially copyable elements is a no-op.
+  static void uninitialized_default_construct(T*, T*) {}
+
   /// Double the size of the allocated memory, guaranteeing space for at
-  /// least one more element or MinSize if specified.
+  /// least one more element or MinSize if specified. Grows via realloc-style
+  /// bulk copy (grow_pod), so no per-element work is done.
   void grow(size_t MinSize = 0) {
     this->grow_pod(MinSize * sizeof(T), sizeof(T));
   }
@@ -418,9 +440,23 @@ class SmallVectorImpl
     } else if (N > this->size()) {
       if (this->capacity() < N)
         this->grow(N);
-      auto Iit = this->end();
-      for (auto Eit = this->begin() + N; Iit != Eit; ++Iit)
-        new (&*Iit) T();
+      this->uninitialized_value_construct(this->end(), this->begin() + N);
+      this->setEnd(this->begin() + N);
+    }
+  }
+
+  /// Like resize, but new elements are default- instead of value-initialized:
+  /// for trivially copyable T the grown tail is left uninitialized. This is
+  /// the right call when every element is about to be assigned anyway, as in
+  /// shape computations that fill a DimVector dimension by dimension.
+  void resize_for_overwrite(size_type N) {
+    if (N < this->size()) {
+      this->destroy_range(this->begin() + N, this->end());
+      this->setEnd(this->begin() + N);
+    } else if (N > this->size()) {
+      if (this->capacity() < N)
+        this->grow(N);
+      this->uninitialized_default_construct(this->end(), this->begin() + N);
       this->setEnd(this->begin() + N);
     }
   }
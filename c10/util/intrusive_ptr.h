@@ -141,6 +141,41 @@ struct intrusive_target_default_null_type final {
   }
 };
 
+// Note [ intrusive_ptr memory ordering ]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Refcount bumps don't need the default sequentially-consistent ordering
+// (which costs a full barrier on weakly-ordered architectures and pessimizes
+// compiler reordering everywhere):
+//
+//  - Increments can be relaxed. Whoever gives us the reference we are
+//    copying from already keeps the object alive and provides the
+//    happens-before edge to its contents; the increment itself carries no
+//    payload another thread could observe early.
+//
+//  - Decrements must be release, so that all of this thread's accesses to
+//    the object happen-before the count reaches zero, and the final
+//    decrement must additionally be acquire, so the thread that runs the
+//    destructor sees every other thread's writes. fetch_sub with acq_rel
+//    gives us both.
+//
+// This mirrors the scheme used by libstdc++'s and libc++'s shared_ptr
+// control blocks.
+inline size_t atomic_refcount_increment(std::atomic<size_t>& refcount) {
+  return refcount.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+inline size_t atomic_weakcount_increment(std::atomic<size_t>& weakcount) {
+  return weakcount.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+inline size_t atomic_refcount_decrement(std::atomic<size_t>& refcount) {
+  return refcount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+}
+
+inline size_t atomic_weakcount_decrement(std::atomic<size_t>& weakcount) {
+  return weakcount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+}
+
 template<class TTarget, class ToNullType, class FromNullType>
 TTarget* assign_ptr_(TTarget* rhs) {
   if (FromNullType::singleton() == rhs) {
@@ -184,7 +219,7 @@ class intrusive_ptr final {
 
   void retain_() {
     if (target_ != NullType::singleton()) {
-      size_t new_refcount = ++target_->refcount_;
+      size_t new_refcount = detail::atomic_refcount_increment(target_->refcount_);
       TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
           new_refcount != 1,
           "intrusive_ptr: Cannot increase refcount after it reached zero.");
@@ -192,7 +227,8 @@ class intrusive_ptr final {
   }
 
   void reset_() noexcept {
-    if (target_ != NullType::singleton() && --target_->refcount_ == 0) {
+    if (target_ != NullType::singleton() &&
+        detail::atomic_refcount_decrement(target_->refcount_) == 0) {
       // justification for const_cast: release_resources is basically a destructor
       // and a destructor always mutates the object, even for const objects.
       const_cast<std::remove_const_t<TTarget>*>(target_)->release_resources();
@@ -200,7 +236,7 @@ class intrusive_ptr final {
       // See comment above about weakcount. As long as refcount>0,
       // weakcount is one larger than the actual number of weak references.
       // So we need to decrement it here.
-      if (--target_->weakcount_ == 0) {
+      if (detail::atomic_weakcount_decrement(target_->weakcount_) == 0) {
         delete target_;
       }
     }
@@ -356,8 +392,8 @@ class intrusive_ptr final {
     // We can't use retain_(), because we also have to increase weakcount
     // and because we allow raising these values from 0, which retain_()
     // has an assertion against.
-    ++result.target_->refcount_;
-    ++result.target_->weakcount_;
+    detail::atomic_refcount_increment(result.target_->refcount_);
+    detail::atomic_weakcount_increment(result.target_->weakcount_);
 
     return result;
   }
@@ -441,7 +477,8 @@ class weak_intrusive_ptr final {
 
   void retain_() {
     if (target_ != NullType::singleton()) {
-      size_t new_weakcount = ++target_->weakcount_;
+      size_t new_weakcount =
+          detail::atomic_weakcount_increment(target_->weakcount_);
       TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
           new_weakcount != 1,
           "weak_intrusive_ptr: Cannot increase weakcount after it reached zero.");
@@ -449,7 +486,8 @@ class weak_intrusive_ptr final {
   }
 
   void reset_() noexcept {
-    if (target_ != NullType::singleton() && --target_->weakcount_ == 0) {
+    if (target_ != NullType::singleton() &&
+        detail::atomic_weakcount_decrement(target_->weakcount_) == 0) {
       delete target_;
     }
     target_ = NullType::singleton();
@@ -692,7 +730,7 @@ namespace intrusive_ptr {
   // NullType::singleton to this function
   inline void incref(intrusive_ptr_target* self) {
     if (self) {
-      ++self->refcount_;
+      detail::atomic_refcount_increment(self->refcount_);
     }
   }
 
@@ -726,7 +764,7 @@ namespace intrusive_ptr {
 namespace weak_intrusive_ptr {
 
   inline void incref(weak_intrusive_ptr_target* self) {
-    ++self->weakcount_;
+    detail::atomic_weakcount_increment(self->weakcount_);
   }
 
   inline void decref(weak_intrusive_ptr_target* self) {
@@ -0,0 +1,362 @@
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include "caffe2/core/common.h"
+#include "caffe2/core/logging.h"
+#include "caffe2/serialize/chunked_container.h"
+#include "caffe2/utils/murmur_hash3.h"
+
+namespace caffe2 {
+namespace serialize {
+
+namespace {
+
+// 16 bytes including the trailing NUL.
+constexpr char kFileMagic[16] = "PYTORCH_CHUNKED";
+constexpr uint64_t kChunkMagic = 0x304b4e5548435450; // "PTCHUNK0"
+constexpr uint64_t kFooterMagic = 0x3054534648435450; // "PTCHFST0"
+
+// All integers in the container are stored in the native byte order, like
+// the tensor payloads themselves.
+struct ChunkHeader {
+  uint64_t magic;
+  uint64_t size;
+  uint64_t digest[2];
+};
+
+struct Footer {
+  uint64_t magic;
+  uint64_t manifest_size;
+  uint64_t prev_footer_offset;
+  uint64_t generation;
+  // Offset one past the end of this footer; lets the reader detect a save
+  // that was torn mid-append.
+  uint64_t file_size;
+};
+
+static_assert(
+    sizeof(ChunkHeader) == 32 && sizeof(Footer) == 40,
+    "chunked container layout must not have padding");
+
+void chunkDigest(const void* data, size_t size, uint64_t out[2]) {
+  AT_ASSERT(size <= (size_t)std::numeric_limits<int>::max());
+  MurmurHash3_x64_128(data, (int)size, /*seed=*/0, out);
+}
+
+// Bounds-checked cursor over a manifest buffer.
+struct ManifestCursor {
+  const char* data;
+  size_t size;
+  size_t pos = 0;
+
+  uint64_t u64() {
+    AT_ASSERTM(pos + sizeof(uint64_t) <= size, "truncated manifest");
+    uint64_t value;
+    memcpy(&value, data + pos, sizeof(uint64_t));
+    pos += sizeof(uint64_t);
+    return value;
+  }
+
+  std::string str(size_t len) {
+    AT_ASSERTM(pos + len <= size, "truncated manifest");
+    std::string value(data + pos, len);
+    pos += len;
+    return value;
+  }
+};
+
+void pushUint64(std::vector<char>& buf, uint64_t value) {
+  const char* p = reinterpret_cast<const char*>(&value);
+  buf.insert(buf.end(), p, p + sizeof(uint64_t));
+}
+
+} // namespace
+
+ChunkedStreamReader::ChunkedStreamReader(const std::string& file_name)
+    : file_name_(file_name) {
+  file_.open(file_name_, std::ifstream::in | std::ifstream::binary);
+  if (!file_) {
+    CAFFE_THROW("file in chunked format not found: ", file_name_);
+  }
+  file_.seekg(0, std::ios::end);
+  const auto file_size = (uint64_t)file_.tellg();
+  AT_ASSERTM(
+      file_size >= sizeof(kFileMagic) + sizeof(Footer),
+      "file too short to be a chunked archive: ",
+      file_name_);
+
+  char magic[sizeof(kFileMagic)];
+  read(0, magic, sizeof(magic));
+  AT_ASSERTM(
+      memcmp(magic, kFileMagic, sizeof(kFileMagic)) == 0,
+      "not a chunked archive: ",
+      file_name_);
+
+  Footer footer;
+  footer_offset_ = file_size - sizeof(Footer);
+  read(footer_offset_, &footer, sizeof(footer));
+  AT_ASSERTM(
+      footer.magic == kFooterMagic,
+      "chunked archive has no manifest footer (torn write?): ",
+      file_name_);
+  if (footer.file_size != file_size) {
+    CAFFE_THROW(
+        "chunked archive size does not match its footer (torn write?): ",
+        file_name_);
+  }
+  generation_ = footer.generation;
+
+  AT_ASSERTM(
+      footer.manifest_size <= footer_offset_ - sizeof(kFileMagic),
+      "manifest size out of bounds: ",
+      file_name_);
+  std::vector<char> manifest(footer.manifest_size);
+  read(footer_offset_ - footer.manifest_size, manifest.data(), manifest.size());
+
+  ManifestCursor cursor{manifest.data(), manifest.size()};
+  const uint64_t num_records = cursor.u64();
+  for (uint64_t i = 0; i < num_records; ++i) {
+    const uint64_t name_len = cursor.u64();
+    std::string name = cursor.str(name_len);
+    detail::ChunkedRecord record;
+    record.total_size = cursor.u64();
+    const uint64_t num_chunks = cursor.u64();
+    record.chunks.reserve(num_chunks);
+    for (uint64_t j = 0; j < num_chunks; ++j) {
+      detail::ChunkRef chunk;
+      chunk.offset = cursor.u64();
+      chunk.size = cursor.u64();
+      chunk.digest[0] = cursor.u64();
+      chunk.digest[1] = cursor.u64();
+      AT_ASSERTM(
+          chunk.offset + chunk.size <= footer_offset_,
+          "chunk out of bounds in manifest: ",
+          file_name_);
+      record.chunks.push_back(chunk);
+    }
+    records_.emplace(std::move(name), std::move(record));
+  }
+}
+
+void ChunkedStreamReader::read(uint64_t pos, void* buf, size_t n) {
+  file_.seekg(pos);
+  file_.read(static_cast<char*>(buf), n);
+  if (!file_) {
+    CAFFE_THROW("failed reading chunked archive: ", file_name_);
+  }
+}
+
+const detail::ChunkedRecord& ChunkedStreamReader::getRecordEntry(
+    const std::string& name) {
+  auto it = records_.find(name);
+  if (it == records_.end()) {
+    CAFFE_THROW("record not found in chunked archive: ", name);
+  }
+  return it->second;
+}
+
+std::tuple<at::DataPtr, size_t> ChunkedStreamReader::getRecord(
+    const std::string& name) {
+  const auto& record = getRecordEntry(name);
+  void* ptr = malloc(record.total_size);
+  at::DataPtr retval(ptr, ptr, free, at::kCPU);
+  char* dst = static_cast<char*>(ptr);
+  for (const auto& chunk : record.chunks) {
+    read(chunk.offset, dst, chunk.size);
+    uint64_t digest[2];
+    chunkDigest(dst, chunk.size, digest);
+    if (digest[0] != chunk.digest[0] || digest[1] != chunk.digest[1]) {
+      CAFFE_THROW(
+          "chunk checksum mismatch reading record ",
+          name,
+          " from ",
+          file_name_);
+    }
+    dst += chunk.size;
+  }
+  return std::make_tuple(std::move(retval), record.total_size);
+}
+
+size_t ChunkedStreamReader::readRecord(
+    const std::string& name,
+    uint64_t offset,
+    void* dst,
+    size_t n) {
+  const auto& record = getRecordEntry(name);
+  if (offset >= record.total_size) {
+    return 0;
+  }
+  const uint64_t end = std::min<uint64_t>(offset + n, record.total_size);
+  char* out = static_cast<char*>(dst);
+  uint64_t chunk_begin = 0;
+  for (const auto& chunk : record.chunks) {
+    const uint64_t chunk_end = chunk_begin + chunk.size;
+    if (chunk_end > offset && chunk_begin < end) {
+      const uint64_t from = std::max(chunk_begin, offset);
+      const uint64_t to = std::min(chunk_end, end);
+      read(chunk.offset + (from - chunk_begin), out + (from - offset), to - from);
+    }
+    if (chunk_end >= end) {
+      break;
+    }
+    chunk_begin = chunk_end;
+  }
+  return end - offset;
+}
+
+bool ChunkedStreamReader::hasRecord(const std::string& name) {
+  return records_.count(name) != 0;
+}
+
+std::vector<std::string> ChunkedStreamReader::getAllRecords() {
+  std::vector<std::string> out;
+  out.reserve(records_.size());
+  for (const auto& entry : records_) {
+    out.push_back(entry.first);
+  }
+  return out;
+}
+
+size_t ChunkedStreamReader::getRecordSize(const std::string& name) {
+  return getRecordEntry(name).total_size;
+}
+
+ChunkedStreamWriter::ChunkedStreamWriter(
+    const std::string& file_name,
+    size_t chunk_size)
+    : file_name_(file_name), chunk_size_(chunk_size) {
+  CAFFE_ENFORCE(
+      chunk_size_ > 0 &&
+          chunk_size_ <= (size_t)std::numeric_limits<int>::max(),
+      "invalid chunk size: ",
+      chunk_size_);
+  file_.open(
+      file_name_,
+      std::fstream::in | std::fstream::out | std::fstream::binary);
+  if (!file_) {
+    // The file does not exist yet; create it and start a fresh archive.
+    file_.clear();
+    file_.open(file_name_, std::fstream::out | std::fstream::binary);
+    valid("creating file");
+    append(kFileMagic, sizeof(kFileMagic));
+    return;
+  }
+  file_.seekg(0, std::ios::end);
+  const auto file_size = (uint64_t)file_.tellg();
+  if (file_size == 0) {
+    append(kFileMagic, sizeof(kFileMagic));
+    return;
+  }
+  // Appending to an existing archive: load its manifest to continue the
+  // generation chain and to seed the chunk dedup index, so records whose
+  // content did not change reference the chunks already in the file.
+  ChunkedStreamReader reader(file_name_);
+  generation_ = reader.generation() + 1;
+  prev_footer_offset_ = reader.footer_offset_;
+  end_pos_ = file_size;
+  for (const auto& entry : reader.records_) {
+    for (const auto& chunk : entry.second.chunks) {
+      chunk_index_.emplace(DigestKey{chunk.digest[0], chunk.digest[1]}, chunk);
+    }
+  }
+}
+
+void ChunkedStreamWriter::valid(const char* what) {
+  if (!file_) {
+    CAFFE_THROW("ChunkedStreamWriter failed ", what, ": ", file_name_);
+  }
+}
+
+void ChunkedStreamWriter::append(const void* buf, size_t n) {
+  file_.seekp(end_pos_);
+  file_.write(static_cast<const char*>(buf), n);
+  valid("writing file");
+  end_pos_ += n;
+}
+
+void ChunkedStreamWriter::padToAlignment() {
+  // Pad so the payload following the chunk header lands on the alignment
+  // boundary.
+  const uint64_t payload_pos = end_pos_ + sizeof(ChunkHeader);
+  const uint64_t pad =
+      (kChunkAlignment - payload_pos % kChunkAlignment) % kChunkAlignment;
+  if (pad != 0) {
+    char zeros[kChunkAlignment] = {};
+    append(zeros, pad);
+  }
+}
+
+detail::ChunkRef ChunkedStreamWriter::appendChunk(
+    const void* data,
+    size_t size) {
+  uint64_t digest[2];
+  chunkDigest(data, size, digest);
+  auto it = chunk_index_.find(DigestKey{digest[0], digest[1]});
+  if (it != chunk_index_.end() && it->second.size == size) {
+    return it->second;
+  }
+  padToAlignment();
+  ChunkHeader header{kChunkMagic, size, {digest[0], digest[1]}};
+  append(&header, sizeof(header));
+  detail::ChunkRef chunk{end_pos_, size, {digest[0], digest[1]}};
+  append(data, size);
+  chunk_index_.emplace(DigestKey{digest[0], digest[1]}, chunk);
+  return chunk;
+}
+
+void ChunkedStreamWriter::writeRecord(
+    const std::string& name,
+    const void* data,
+    size_t size,
+    bool compress) {
+  AT_ASSERT(!finalized_);
+  CAFFE_ENFORCE(
+      !compress, "the chunked container does not support compressed records");
+  detail::ChunkedRecord record;
+  record.total_size = size;
+  const char* src = static_cast<const char*>(data);
+  for (size_t pos = 0; pos < size; pos += chunk_size_) {
+    record.chunks.push_back(
+        appendChunk(src + pos, std::min(chunk_size_, size - pos)));
+  }
+  records_.emplace_back(name, std::move(record));
+}
+
+void ChunkedStreamWriter::writeEndOfFile() {
+  AT_ASSERT(!finalized_);
+  std::vector<char> manifest;
+  pushUint64(manifest, records_.size());
+  for (const auto& entry : records_) {
+    pushUint64(manifest, entry.first.size());
+    manifest.insert(manifest.end(), entry.first.begin(), entry.first.end());
+    pushUint64(manifest, entry.second.total_size);
+    pushUint64(manifest, entry.second.chunks.size());
+    for (const auto& chunk : entry.second.chunks) {
+      pushUint64(manifest, chunk.offset);
+      pushUint64(manifest, chunk.size);
+      pushUint64(manifest, chunk.digest[0]);
+      pushUint64(manifest, chunk.digest[1]);
+    }
+  }
+  append(manifest.data(), manifest.size());
+  Footer footer{
+      kFooterMagic,
+      manifest.size(),
+      prev_footer_offset_,
+      generation_,
+      end_pos_ + sizeof(Footer)};
+  append(&footer, sizeof(footer));
+  file_.flush();
+  valid("flushing file");
+  finalized_ = true;
+}
+
+ChunkedStreamWriter::~ChunkedStreamWriter() {
+  if (!finalized_) {
+    writeEndOfFile();
+  }
+}
+
+} // namespace serialize
+} // namespace caffe2
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <c10/core/Allocator.h>
+
+// The chunked container is an appendable companion to the zip container in
+// inline_container.h, meant for checkpoints that are saved many times with
+// few changes between saves. The zip container must be rewritten in full on
+// every save; the chunked container only appends what changed.
+//
+// A chunked archive is a single file with the following layout:
+//
+//    [16-byte file magic]
+//    [chunk block]*      # appended over the lifetime of the file
+//    [manifest block]    # one per completed save ("generation")
+//    [chunk block]*
+//    [manifest block]
+//    ...
+//
+// A chunk block stores a slice of record data, preceded by a fixed header
+// carrying its size and the MurmurHash3_x64_128 digest of its payload. The
+// payload itself starts on a kChunkAlignment boundary, so mmap-based readers
+// get aligned pointers to tensor data, like the zip container guarantees.
+//
+// A manifest block describes every record of one generation as a list of
+// chunk references (absolute offset, size, digest). It is terminated by a
+// fixed-size footer at the very end of the file, so a reader needs a single
+// seek to find the current manifest. The footer also records the offset of
+// the previous generation's footer and the expected file size (to detect a
+// torn append).
+//
+// Chunks are content-addressed: when a record is written, each chunk's
+// digest is looked up among the chunks already present in the file, and
+// matching chunks are referenced instead of rewritten. A save where <5% of
+// tensors changed therefore appends only the changed chunks plus a new
+// manifest. Records absent from a save are absent from its manifest; their
+// chunks stay in the file (referenced by earlier manifests) but are not
+// resurrected.
+//
+// ChunkedStreamWriter and ChunkedStreamReader mirror the record-level API of
+// PyTorchStreamWriter/PyTorchStreamReader (writeRecord/writeEndOfFile and
+// getRecord/hasRecord/getAllRecords), so serialization code can target
+// either container. The reader additionally supports range reads of a
+// record, for loading a slice of a large tensor without touching the rest.
+
+namespace caffe2 {
+namespace serialize {
+
+constexpr uint64_t kChunkedFormatVersion = 0x1L;
+
+// Nominal chunk payload size records are split into.
+constexpr size_t kDefaultChunkSize = 1024 * 1024;
+
+// Chunk payloads start on this boundary (matches kFieldAlignment of the zip
+// container).
+constexpr uint64_t kChunkAlignment = 64;
+
+namespace detail {
+
+// One chunk reference inside a manifest: where the payload lives in the
+// file, how long it is, and the MurmurHash3_x64_128 digest of its contents.
+struct ChunkRef {
+  uint64_t offset;
+  uint64_t size;
+  uint64_t digest[2];
+};
+
+struct ChunkedRecord {
+  uint64_t total_size;
+  std::vector<ChunkRef> chunks;
+};
+
+} // namespace detail
+
+class CAFFE2_API ChunkedStreamReader final {
+ public:
+  explicit ChunkedStreamReader(const std::string& file_name);
+
+  // Returns dataptr, size. The chunk digests are verified while reading.
+  std::tuple<at::DataPtr, size_t> getRecord(const std::string& name);
+
+  // Range read: copies up to `n` bytes of the record starting at byte
+  // `offset` into `dst`, touching only the chunks that overlap the range.
+  // Returns the number of bytes copied (less than `n` only at the end of
+  // the record).
+  size_t readRecord(
+      const std::string& name,
+      uint64_t offset,
+      void* dst,
+      size_t n);
+
+  bool hasRecord(const std::string& name);
+  std::vector<std::string> getAllRecords();
+  size_t getRecordSize(const std::string& name);
+
+  // Index of the manifest this reader loaded; increases by one with every
+  // completed save to the archive.
+  uint64_t generation() const {
+    return generation_;
+  }
+
+  uint64_t version() const {
+    return kChunkedFormatVersion;
+  }
+
+ private:
+  friend class ChunkedStreamWriter;
+
+  const detail::ChunkedRecord& getRecordEntry(const std::string& name);
+  void read(uint64_t pos, void* buf, size_t n);
+
+  std::string file_name_;
+  std::ifstream file_;
+  uint64_t generation_ = 0;
+  uint64_t footer_offset_ = 0;
+  std::unordered_map<std::string, detail::ChunkedRecord> records_;
+};
+
+class CAFFE2_API ChunkedStreamWriter final {
+ public:
+  // Opens (or creates) the archive for appending. If the file already holds
+  // a manifest, its chunks seed the content-addressed dedup table, so
+  // unchanged records written to this generation reference existing data
+  // instead of being appended again.
+  explicit ChunkedStreamWriter(
+      const std::string& file_name,
+      size_t chunk_size = kDefaultChunkSize);
+
+  // Compression is not supported by the chunked format (payloads are stored
+  // raw so they can be referenced across generations and range-read);
+  // `compress` must be false.
+  void writeRecord(
+      const std::string& name,
+      const void* data,
+      size_t size,
+      bool compress = false);
+
+  // Appends the manifest and footer for this generation and flushes.
+  void writeEndOfFile();
+
+  bool finalized() const {
+    return finalized_;
+  }
+
+  const std::string& archiveName() {
+    return file_name_;
+  }
+
+  ~ChunkedStreamWriter();
+
+ private:
+  struct DigestKey {
+    uint64_t lo;
+    uint64_t hi;
+    bool operator==(const DigestKey& other) const {
+      return lo == other.lo && hi == other.hi;
+    }
+  };
+  struct DigestKeyHash {
+    size_t operator()(const DigestKey& key) const {
+      return static_cast<size_t>(key.lo ^ key.hi);
+    }
+  };
+
+  void append(const void* buf, size_t n);
+  void padToAlignment();
+  detail::ChunkRef appendChunk(const void* data, size_t size);
+  void valid(const char* what);
+
+  std::string file_name_;
+  std::fstream file_;
+  size_t chunk_size_;
+  uint64_t end_pos_ = 0;
+  uint64_t generation_ = 0;
+  uint64_t prev_footer_offset_ = 0;
+  bool finalized_ = false;
+  // Digest -> location of an identical chunk already in the file.
+  std::unordered_map<DigestKey, detail::ChunkRef, DigestKeyHash> chunk_index_;
+  // Records written to this generation, in write order.
+  std::vector<std::pair<std::string, detail::ChunkedRecord>> records_;
+};
+
+} // namespace serialize
+} // namespace caffe2
@@ -0,0 +1,146 @@
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <c10/util/tempfile.h>
+
+#include "caffe2/serialize/chunked_container.h"
+
+namespace caffe2 {
+namespace serialize {
+namespace {
+
+std::vector<char> makeData(size_t size, char seed) {
+  std::vector<char> data(size);
+  for (size_t i = 0; i < size; ++i) {
+    data[i] = (char)((i + seed) % 251);
+  }
+  return data;
+}
+
+uint64_t fileSize(const std::string& file_name) {
+  std::ifstream file(file_name, std::ifstream::binary | std::ifstream::ate);
+  return (uint64_t)file.tellg();
+}
+
+TEST(ChunkedStreamWriterAndReader, SaveAndLoad) {
+  auto tmp = c10::make_tempfile();
+  // Small chunk size so the larger record spans several chunks.
+  constexpr size_t kChunkSize = 128;
+  auto data1 = makeData(127, 1);
+  auto data2 = makeData(kChunkSize * 3 + 17, 2);
+  {
+    ChunkedStreamWriter writer(tmp.name, kChunkSize);
+    writer.writeRecord("key1", data1.data(), data1.size());
+    writer.writeRecord("key2", data2.data(), data2.size());
+    writer.writeEndOfFile();
+    ASSERT_TRUE(writer.finalized());
+  }
+
+  ChunkedStreamReader reader(tmp.name);
+  ASSERT_EQ(reader.generation(), 0);
+  ASSERT_TRUE(reader.hasRecord("key1"));
+  ASSERT_TRUE(reader.hasRecord("key2"));
+  ASSERT_FALSE(reader.hasRecord("key3"));
+  ASSERT_EQ(reader.getAllRecords().size(), 2);
+
+  at::DataPtr ptr;
+  size_t size;
+  std::tie(ptr, size) = reader.getRecord("key1");
+  ASSERT_EQ(size, data1.size());
+  ASSERT_EQ(memcmp(ptr.get(), data1.data(), size), 0);
+  // Chunk payloads are aligned in the file, which is not observable through
+  // getRecord; check the data of the multi-chunk record instead.
+  std::tie(ptr, size) = reader.getRecord("key2");
+  ASSERT_EQ(size, data2.size());
+  ASSERT_EQ(memcmp(ptr.get(), data2.data(), size), 0);
+
+  ASSERT_THROW(reader.getRecord("key3"), c10::Error);
+}
+
+TEST(ChunkedStreamWriterAndReader, DeltaSaveReferencesPriorChunks) {
+  auto tmp = c10::make_tempfile();
+  constexpr size_t kChunkSize = 256;
+  auto big = makeData(kChunkSize * 64, 3);
+  auto small = makeData(100, 4);
+  {
+    ChunkedStreamWriter writer(tmp.name, kChunkSize);
+    writer.writeRecord("big", big.data(), big.size());
+    writer.writeRecord("small", small.data(), small.size());
+  }
+  const auto size_after_full = fileSize(tmp.name);
+
+  // Second generation: "big" is unchanged, "small" is rewritten with new
+  // contents. Only the changed chunk and a new manifest should be appended.
+  auto small2 = makeData(100, 5);
+  {
+    ChunkedStreamWriter writer(tmp.name, kChunkSize);
+    writer.writeRecord("big", big.data(), big.size());
+    writer.writeRecord("small", small2.data(), small2.size());
+  }
+  const auto size_after_delta = fileSize(tmp.name);
+  ASSERT_LT(size_after_delta - size_after_full, big.size());
+
+  ChunkedStreamReader reader(tmp.name);
+  ASSERT_EQ(reader.generation(), 1);
+  at::DataPtr ptr;
+  size_t size;
+  std::tie(ptr, size) = reader.getRecord("big");
+  ASSERT_EQ(size, big.size());
+  ASSERT_EQ(memcmp(ptr.get(), big.data(), size), 0);
+  std::tie(ptr, size) = reader.getRecord("small");
+  ASSERT_EQ(size, small2.size());
+  ASSERT_EQ(memcmp(ptr.get(), small2.data(), size), 0);
+}
+
+TEST(ChunkedStreamWriterAndReader, RecordsNotRewrittenAreDropped) {
+  auto tmp = c10::make_tempfile();
+  auto data = makeData(64, 6);
+  {
+    ChunkedStreamWriter writer(tmp.name);
+    writer.writeRecord("keep", data.data(), data.size());
+    writer.writeRecord("drop", data.data(), data.size());
+  }
+  {
+    ChunkedStreamWriter writer(tmp.name);
+    writer.writeRecord("keep", data.data(), data.size());
+  }
+  ChunkedStreamReader reader(tmp.name);
+  ASSERT_TRUE(reader.hasRecord("keep"));
+  ASSERT_FALSE(reader.hasRecord("drop"));
+  ASSERT_EQ(reader.getAllRecords().size(), 1);
+}
+
+TEST(ChunkedStreamWriterAndReader, RangeRead) {
+  auto tmp = c10::make_tempfile();
+  constexpr size_t kChunkSize = 128;
+  auto data = makeData(kChunkSize * 4 + 32, 7);
+  {
+    ChunkedStreamWriter writer(tmp.name, kChunkSize);
+    writer.writeRecord("key", data.data(), data.size());
+  }
+  ChunkedStreamReader reader(tmp.name);
+  ASSERT_EQ(reader.getRecordSize("key"), data.size());
+
+  std::vector<char> buf(data.size());
+  // A range crossing chunk boundaries.
+  size_t n = reader.readRecord("key", kChunkSize - 10, buf.data(), 3 * kChunkSize);
+  ASSERT_EQ(n, 3 * kChunkSize);
+  ASSERT_EQ(memcmp(buf.data(), data.data() + kChunkSize - 10, n), 0);
+  // A range inside a single chunk.
+  n = reader.readRecord("key", 5, buf.data(), 20);
+  ASSERT_EQ(n, 20);
+  ASSERT_EQ(memcmp(buf.data(), data.data() + 5, n), 0);
+  // A range clamped by the end of the record.
+  n = reader.readRecord("key", data.size() - 10, buf.data(), 100);
+  ASSERT_EQ(n, 10);
+  ASSERT_EQ(memcmp(buf.data(), data.data() + data.size() - 10, n), 0);
+  // A range past the end of the record.
+  ASSERT_EQ(reader.readRecord("key", data.size(), buf.data(), 1), 0);
+}
+
+} // namespace
+} // namespace serialize
+} // namespace caffe2
@@ -1,28 +1,141 @@
 #include "caffe2/serialize/file_adapter.h"
 #include <c10/util/Exception.h>
+#include <algorithm>
+#include <cstring>
 #include "caffe2/core/common.h"
 
 namespace caffe2 {
 namespace serialize {
 
+namespace {
+// Size of one readahead chunk and how many of them the background thread
+// keeps prefetched ahead of the reader.
+constexpr uint64_t kReadaheadChunkSize = 4 * 1024 * 1024;
+constexpr size_t kReadaheadDepth = 4;
+} // namespace
+
 FileAdapter::FileAdapter(const std::string& file_name) {
   file_stream_.open(file_name, std::ifstream::in | std::ifstream::binary);
   if (!file_stream_) {
     AT_ERROR("open file failed, file path: ", file_name);
   }
   istream_adapter_ = std::make_unique<IStreamAdapter>(&file_stream_);
+  size_ = istream_adapter_->size();
+  // Only files larger than one chunk benefit from the pipeline; if the
+  // second stream cannot be opened we silently stay on the direct path.
+  if (size_ > kReadaheadChunkSize) {
+    readahead_stream_.open(
+        file_name, std::ifstream::in | std::ifstream::binary);
+    if (readahead_stream_) {
+      readahead_thread_ = std::thread([this] { readaheadLoop(); });
+    }
+  }
 }
 
 size_t FileAdapter::size() const {
-  return istream_adapter_->size();
+  return size_;
+}
+
+void FileAdapter::readaheadLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (!shutdown_) {
+    if (!active_ || window_.size() >= kReadaheadDepth ||
+        window_next_ >= size_) {
+      cv_.wait(lock);
+      continue;
+    }
+    const uint64_t offset = window_next_;
+    const size_t want = std::min(kReadaheadChunkSize, size_ - offset);
+    lock.unlock();
+    std::vector<char> data(want);
+    readahead_stream_.clear();
+    readahead_stream_.seekg(offset);
+    readahead_stream_.read(data.data(), want);
+    const size_t got = readahead_stream_.bad()
+        ? 0
+        : static_cast<size_t>(readahead_stream_.gcount());
+    lock.lock();
+    if (got == 0) {
+      // I/O trouble; retire the pipeline and let all reads go through the
+      // synchronous path
+      active_ = false;
+      continue;
+    }
+    // the reader may have retargeted the window while we were off the lock;
+    // only publish data that still extends it
+    if (active_ && window_next_ == offset) {
+      data.resize(got);
+      window_.push_back(Chunk{offset, std::move(data)});
+      window_next_ = offset + got;
+    }
+  }
 }
 
 size_t FileAdapter::read(uint64_t pos, void* buf, size_t n, const char* what)
     const {
-  return istream_adapter_->read(pos, buf, n, what);
+  if (!readahead_thread_.joinable()) {
+    return istream_adapter_->read(pos, buf, n, what);
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  char* out = static_cast<char*>(buf);
+  const uint64_t end = pos + n;
+  uint64_t cur = pos;
+  // drop chunks wholly behind this read; the reader has moved past them
+  bool popped = false;
+  while (!window_.empty() &&
+         window_.front().offset + window_.front().data.size() <= cur) {
+    window_.pop_front();
+    popped = true;
+  }
+  // copy the prefix the pipeline already has in memory
+  while (!window_.empty() && cur < end && cur >= window_.front().offset) {
+    const Chunk& chunk = window_.front();
+    const size_t begin = cur - chunk.offset;
+    const size_t avail =
+        std::min<uint64_t>(chunk.data.size() - begin, end - cur);
+    std::memcpy(out + (cur - pos), chunk.data.data() + begin, avail);
+    cur += avail;
+    if (cur < chunk.offset + chunk.data.size()) {
+      break;
+    }
+    window_.pop_front();
+    popped = true;
+  }
+  const bool sequential = cur > pos || pos == last_read_end_;
+  last_read_end_ = end;
+  if (cur == end) {
+    if (popped) {
+      cv_.notify_one();
+    }
+    return n;
+  }
+  // Not fully covered. Retarget the window to follow the reader when the
+  // access looks sequential, so the next records are in flight while this
+  // one is CRC-checked and unpickled; leave the window alone for random
+  // probes such as central directory lookups.
+  if (sequential) {
+    window_.clear();
+    window_next_ = std::min(end, size_);
+    active_ = true;
+    cv_.notify_one();
+  } else if (popped) {
+    cv_.notify_one();
+  }
+  lock.unlock();
+  istream_adapter_->read(cur, out + (cur - pos), end - cur, what);
+  return n;
 }
 
-FileAdapter::~FileAdapter() {}
+FileAdapter::~FileAdapter() {
+  if (readahead_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      shutdown_ = true;
+    }
+    cv_.notify_all();
+    readahead_thread_.join();
+  }
+}
 
 } // namespace serialize
 } // namespace caffe2
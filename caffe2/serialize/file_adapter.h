@@ -1,7 +1,12 @@
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "c10/macros/Macros.h"
 #include "caffe2/serialize/istream_adapter.h"
@@ -20,8 +25,33 @@ class CAFFE2_API FileAdapter final : public ReadAdapterInterface {
   ~FileAdapter();
 
  private:
+  // One chunk of the file prefetched by the readahead thread. Chunks in the
+  // window are contiguous and sorted by offset.
+  struct Chunk {
+    uint64_t offset;
+    std::vector<char> data;
+  };
+
+  void readaheadLoop();
+
   std::ifstream file_stream_;
   std::unique_ptr<IStreamAdapter> istream_adapter_;
+  uint64_t size_;
+
+  // Readahead pipeline: a background thread keeps a small window of the
+  // file prefetched ahead of the last sequential read, overlapping disk
+  // latency with the CRC checks and unpickling done between record reads.
+  // The fields below are guarded by mutex_; the worker reads through its
+  // own stream so it never contends on file_stream_.
+  mutable std::mutex mutex_;
+  mutable std::condition_variable cv_;
+  mutable std::deque<Chunk> window_;
+  mutable uint64_t window_next_ = 0;
+  mutable bool active_ = false;
+  mutable uint64_t last_read_end_ = 0;
+  bool shutdown_ = false;
+  std::ifstream readahead_stream_;
+  std::thread readahead_thread_;
 };
 
 } // namespace serialize
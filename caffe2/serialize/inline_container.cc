@@ -17,6 +17,12 @@
 
 #include "miniz.h"
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace caffe2 {
 namespace serialize {
 
@@ -52,7 +58,8 @@ size_t PyTorchStreamReader::read(uint64_t pos, char* buf, size_t n) {
 
 PyTorchStreamReader::PyTorchStreamReader(const std::string& file_name)
     : ar_(std::make_unique<mz_zip_archive>()),
-      in_(std::make_unique<FileAdapter>(file_name)) {
+      in_(std::make_unique<FileAdapter>(file_name)),
+      file_name_(file_name) {
   init();
 }
 
@@ -180,6 +187,7 @@ static size_t getPadding(
 }
 
 bool PyTorchStreamReader::hasRecord(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
   std::string ss = archive_name_plus_slash_ + name;
   mz_zip_reader_locate_file(ar_.get(), ss.c_str(), nullptr, 0);
   bool result = ar_->m_last_error != MZ_ZIP_FILE_NOT_FOUND;
@@ -191,6 +199,7 @@ bool PyTorchStreamReader::hasRecord(const std::string& name) {
 }
 
 std::vector<std::string> PyTorchStreamReader::getAllRecords() {
+  std::lock_guard<std::mutex> guard(reader_lock_);
   mz_uint num_files = mz_zip_reader_get_num_files(ar_.get());
   std::vector<std::string> out;
   char buf[MZ_ZIP_MAX_ARCHIVE_FILENAME_SIZE];
@@ -211,12 +220,60 @@ size_t PyTorchStreamReader::getRecordID(const std::string& name) {
   return result;
 }
 
+// Map the underlying file into memory once, on first use. Only possible when
+// the reader was constructed from a file name. The mapping is private
+// (copy-on-write), so callers are free to mutate the returned tensor data
+// without affecting the file.
+bool PyTorchStreamReader::maybeMmap() {
+#ifdef _WIN32
+  return false;
+#else
+  if (!tried_mmap_) {
+    tried_mmap_ = true;
+    size_t size = in_->size();
+    if (!file_name_.empty() && size > 0) {
+      int fd = open(file_name_.c_str(), O_RDONLY);
+      if (fd != -1) {
+        void* addr =
+            mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr != MAP_FAILED) {
+          mmap_size_ = size;
+          mmap_region_ =
+              std::shared_ptr<void>(addr, [size](void* p) { munmap(p, size); });
+        }
+      }
+    }
+  }
+  return mmap_region_ != nullptr;
+#endif
+}
+
 // return dataptr, size
 std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
   size_t key = getRecordID(name);
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+
+  // Stored (uncompressed) records can be returned as views into a private
+  // mapping of the file: loading becomes page-fault driven instead of
+  // copying every record through miniz into a fresh allocation.
+  if (stat.m_method == 0 && maybeMmap()) {
+    size_t offset = getRecordOffsetUnlocked(name);
+    AT_ASSERT(offset + stat.m_uncomp_size <= mmap_size_);
+    // Each DataPtr keeps its own reference to the mapping so the mapping
+    // outlives this reader if need be.
+    auto* region = new std::shared_ptr<void>(mmap_region_);
+    at::DataPtr retval(
+        static_cast<char*>(region->get()) + offset,
+        region,
+        [](void* ctx) { delete static_cast<std::shared_ptr<void>*>(ctx); },
+        at::kCPU);
+    return std::make_tuple(std::move(retval), stat.m_uncomp_size);
+  }
+
   void * ptr = malloc(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, ptr, stat.m_uncomp_size, 0);
   valid("reading file ", name.c_str());
@@ -230,6 +287,11 @@ static int64_t read_le_16(uint8_t* buf) {
 }
 
 size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  return getRecordOffsetUnlocked(name);
+}
+
+size_t PyTorchStreamReader::getRecordOffsetUnlocked(const std::string& name) {
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
   valid("retrieving file meta-data for ", name.c_str());
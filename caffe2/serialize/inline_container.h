@@ -5,6 +5,7 @@
 #include <cstring>
 #include <fstream>
 #include <istream>
+#include <mutex>
 #include <ostream>
 
 #include <c10/core/Allocator.h>
@@ -104,6 +105,9 @@ class CAFFE2_API PyTorchStreamReader final {
   explicit PyTorchStreamReader(std::unique_ptr<ReadAdapterInterface> in);
 
   // return dataptr, size
+  // The record accessors below are safe to call concurrently from multiple
+  // threads; they serialize on an internal lock around the underlying
+  // archive and file reads.
   std::tuple<at::DataPtr, size_t> getRecord(const std::string& name);
   size_t getRecordOffset(const std::string& name);
   bool hasRecord(const std::string& name);
@@ -119,6 +123,8 @@ class CAFFE2_API PyTorchStreamReader final {
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordOffsetUnlocked(const std::string& name);
+  bool maybeMmap();
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -127,6 +133,15 @@ class CAFFE2_API PyTorchStreamReader final {
   std::string archive_name_plus_slash_;
   std::unique_ptr<ReadAdapterInterface> in_;
   int64_t version_;
+  // Guards the (stateful) miniz archive and the file reads it issues.
+  std::mutex reader_lock_;
+  // Lazily-created private mapping of the underlying file, when the reader
+  // was constructed from a file name. Shared with the DataPtrs handed out by
+  // getRecord so the mapping stays alive as long as any of them do.
+  std::string file_name_;
+  std::shared_ptr<void> mmap_region_;
+  size_t mmap_size_ = 0;
+  bool tried_mmap_ = false;
 };
 
 class CAFFE2_API PyTorchStreamWriter final {
@@ -4,6 +4,7 @@
 
 #include <gtest/gtest.h>
 
+#include "caffe2/serialize/file_adapter.h"
 #include "caffe2/serialize/inline_container.h"
 
 namespace caffe2 {
@@ -63,6 +64,41 @@ TEST(PyTorchStreamWriterAndReader, SaveAndLoad) {
   ASSERT_EQ(memcmp(the_file.c_str() + off2, data2.data(), data2.size()), 0);
 }
 
+TEST(FileAdapterTest, ReadaheadMatchesDirectReads) {
+  // big enough that the readahead thread engages (> one chunk)
+  const size_t kFileSize = 9 * 1024 * 1024 + 123;
+  std::string contents(kFileSize, '\0');
+  for (size_t i = 0; i < kFileSize; ++i) {
+    contents[i] = static_cast<char>((i * 31 + 7) & 0xff);
+  }
+  std::string file_name = "file_adapter_test.bin";
+  std::ofstream out(file_name, std::ios::binary);
+  out.write(contents.data(), contents.size());
+  out.close();
+
+  FileAdapter adapter(file_name);
+  ASSERT_EQ(adapter.size(), kFileSize);
+
+  std::vector<char> buf(1024 * 1024);
+  // sequential reads of varying sizes, mimicking record loads
+  const size_t sizes[] = {64, 4096, 1024 * 1024, 300000, 777};
+  uint64_t pos = 0;
+  size_t step = 0;
+  while (pos < kFileSize) {
+    size_t n = std::min<uint64_t>(sizes[step++ % 5], kFileSize - pos);
+    ASSERT_EQ(adapter.read(pos, buf.data(), n), n);
+    ASSERT_EQ(memcmp(buf.data(), contents.data() + pos, n), 0);
+    pos += n;
+  }
+  // random probes in between must stay consistent with the window
+  const uint64_t probes[] = {0, kFileSize - 100, 12345, 5 * 1024 * 1024};
+  for (uint64_t probe : probes) {
+    ASSERT_EQ(adapter.read(probe, buf.data(), 100), 100);
+    ASSERT_EQ(memcmp(buf.data(), contents.data() + probe, 100), 0);
+  }
+  std::remove(file_name.c_str());
+}
+
 } // namespace
 } // namespace serialize
 } // namespace caffe2
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 
 #include <torch/torch.h>
+#include <torch/csrc/autograd/functions/accumulate_grad.h>
+#include <torch/csrc/autograd/functions/checkpoint.h>
 
 #include <test/cpp/api/support.h>
 
@@ -58,6 +60,62 @@ TEST(AutogradAPITests, GradSimpleTest) {
   ASSERT_VARIABLE_EQ(grad_res[1], x + torch::ones({2, 2}) * 2);
 }
 
+TEST(AutogradAPITests, CheckpointTest) {
+  Variable x = torch::randn({2, 2}, torch::requires_grad());
+  Variable y = torch::randn({2, 2}, torch::requires_grad());
+
+  auto segment = [](const variable_list& inputs) -> variable_list {
+    return {simple_fn(inputs[0], inputs[1])};
+  };
+  auto outputs = checkpoint(segment, {x, y});
+  ASSERT_EQ(outputs.size(), 1);
+  ASSERT_TRUE(outputs[0].requires_grad());
+  // no activations from the segment body are kept, only the node itself
+  ASSERT_EQ(graph_desc(outputs[0].grad_fn()),
+            "CheckpointNode(AccumulateGrad()AccumulateGrad())");
+
+  backward({outputs[0]}, {torch::ones({2, 2})});
+  ASSERT_VARIABLE_EQ(x.grad(), y + torch::ones({2, 2}));
+  ASSERT_VARIABLE_EQ(y.grad(), x + torch::ones({2, 2}) * 2);
+}
+
+TEST(AutogradAPITests, CheckpointChainedSegmentsTest) {
+  Variable x = torch::randn({2, 2}, torch::requires_grad());
+  Variable y = torch::randn({2, 2}, torch::requires_grad());
+
+  auto segment = [](const variable_list& inputs) -> variable_list {
+    return {simple_fn(inputs[0], inputs[1])};
+  };
+  auto mid = checkpoint(segment, {x, y});
+  auto out = checkpoint(segment, {mid[0], y});
+  auto checkpointed_grads = grad({out[0]}, {x, y}, {torch::ones({2, 2})});
+
+  auto expected = simple_fn(simple_fn(x, y), y);
+  auto expected_grads = grad({expected}, {x, y}, {torch::ones({2, 2})});
+
+  ASSERT_VARIABLE_EQ(checkpointed_grads[0], expected_grads[0]);
+  ASSERT_VARIABLE_EQ(checkpointed_grads[1], expected_grads[1]);
+}
+
+TEST(AutogradAPITests, AccumulateGradBFloat16Test) {
+  AccumulateGrad::setAccumulateDtype(at::kBFloat16);
+  Variable x = torch::randn({2, 2}, torch::requires_grad());
+  Variable y = torch::randn({2, 2}, torch::requires_grad());
+  auto res = simple_fn(x, y);
+  backward({res.sum()}, {});
+
+  // grads are kept in a compact bfloat16 buffer
+  ASSERT_EQ(x.grad().scalar_type(), at::kBFloat16);
+  ASSERT_EQ(y.grad().scalar_type(), at::kBFloat16);
+  ASSERT_TRUE(torch::allclose(
+      x.grad().to(at::kFloat), y + torch::ones({2, 2}), /*rtol=*/1e-2, /*atol=*/1e-2));
+  ASSERT_TRUE(torch::allclose(
+      y.grad().to(at::kFloat), x + torch::ones({2, 2}) * 2, /*rtol=*/1e-2, /*atol=*/1e-2));
+
+  AccumulateGrad::setAccumulateDtype(c10::nullopt);
+  ASSERT_FALSE(AccumulateGrad::accumulateDtype().has_value());
+}
+
 TEST(AutogradAPITests, GradTest) {
   Variable x = torch::randn({2, 2}, torch::requires_grad());
   Variable y = torch::randn({2, 2}, torch::requires_grad());
@@ -89,6 +89,23 @@ void testCompleteArgumentSpec() {
   Stack stack = {var(CF, {1, 2}, true), 3, var(CF, {1, 2}, true)};
   CompleteArgumentSpec with_const(true, stack);
   ASSERT_EQ(with_const.at(2).sizes().size(), 2);
+
+  // bucketed specs collapse a whole power-of-two shape family into one key
+  auto seq100 = createStack({var(CF, {8, 100, 512}, false)});
+  auto seq120 = createStack({var(CF, {8, 120, 512}, false)});
+  auto seq200 = createStack({var(CF, {8, 200, 512}, false)});
+  CompleteArgumentSpec bucketed100(false, seq100, /*bucket_dims=*/true);
+  CompleteArgumentSpec bucketed120(false, seq120, /*bucket_dims=*/true);
+  CompleteArgumentSpec bucketed200(false, seq200, /*bucket_dims=*/true);
+  ASSERT_EQ(bucketed100, bucketed120);
+  ASSERT_EQ(bucketed100.hashCode(), bucketed120.hashCode());
+  ASSERT_FALSE(bucketed100 == bucketed200);
+  // exact specs still tell the same inputs apart
+  ASSERT_FALSE(
+      CompleteArgumentSpec(false, seq100) ==
+      CompleteArgumentSpec(false, seq120));
+  // recorded dims in a bucketed spec are the upper bound of the class
+  ASSERT_EQ(bucketed100.at(0).sizes()[1], 128);
 }
 
 size_t hashCode(const TensorTypePtr& ptr) {
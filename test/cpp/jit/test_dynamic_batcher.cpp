@@ -0,0 +1,97 @@
+#include <torch/csrc/jit/runtime/dynamic_batcher.h>
+#include "test/cpp/jit/test_base.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+void testDynamicBatcher() {
+  // A full batch of concurrent submissions runs a single forward and each
+  // caller gets back its own slice.
+  {
+    std::atomic<int> forward_calls{0};
+    DynamicBatcherOptions options;
+    options.max_batch_size = 4;
+    options.batch_timeout = std::chrono::milliseconds(1000);
+    DynamicBatcher batcher(
+        [&](const at::Tensor& batch) -> at::Tensor {
+          forward_calls++;
+          return batch * 2;
+        },
+        options);
+
+    std::vector<at::Tensor> samples;
+    std::vector<c10::intrusive_ptr<c10::ivalue::Future>> futures(4);
+    for (int i = 0; i < 4; i++) {
+      samples.push_back(at::rand({2, 3}));
+    }
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++) {
+      threads.emplace_back(
+          [&, i] { futures[i] = batcher.submit(samples[i]); });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    for (int i = 0; i < 4; i++) {
+      futures[i]->wait();
+      ASSERT_TRUE(
+          futures[i]->value().toTensor().allclose(samples[i] * 2));
+    }
+    ASSERT_EQ(forward_calls.load(), 1);
+  }
+
+  // A partial batch is flushed once the timeout elapses.
+  {
+    DynamicBatcherOptions options;
+    options.max_batch_size = 16;
+    options.batch_timeout = std::chrono::milliseconds(1);
+    DynamicBatcher batcher(
+        [](const at::Tensor& batch) -> at::Tensor { return batch + 1; },
+        options);
+    auto sample = at::rand({3});
+    auto future = batcher.submit(sample);
+    future->wait();
+    ASSERT_TRUE(future->value().toTensor().allclose(sample + 1));
+  }
+
+  // A throwing forward completes every future in the batch with the error.
+  {
+    DynamicBatcherOptions options;
+    options.max_batch_size = 2;
+    DynamicBatcher batcher(
+        [](const at::Tensor&) -> at::Tensor {
+          TORCH_CHECK(false, "model failure");
+        },
+        options);
+    auto f0 = batcher.submit(at::rand({3}));
+    auto f1 = batcher.submit(at::rand({3}));
+    f0->wait();
+    f1->wait();
+    ASSERT_ANY_THROW(f0->value());
+    ASSERT_ANY_THROW(f1->value());
+  }
+
+  // Destruction flushes requests still queued.
+  {
+    at::Tensor sample = at::rand({3});
+    c10::intrusive_ptr<c10::ivalue::Future> future;
+    {
+      DynamicBatcherOptions options;
+      options.max_batch_size = 16;
+      options.batch_timeout = std::chrono::milliseconds(1000);
+      DynamicBatcher batcher(
+          [](const at::Tensor& batch) -> at::Tensor { return batch; },
+          options);
+      future = batcher.submit(sample);
+    }
+    ASSERT_TRUE(future->completed());
+    ASSERT_TRUE(future->value().toTensor().allclose(sample));
+  }
+}
+
+} // namespace jit
+} // namespace torch
@@ -35,6 +35,33 @@ void testLiteInterpreterUpsampleNearest2d() {
   ASSERT_TRUE(resd.equal(refd));
 }
 
+void testLiteInterpreterStripDebug() {
+  Module m("m");
+  m.register_parameter("foo", torch::ones({}), false);
+  m.define(R"(
+    def forward(self, x):
+      b = 4
+      return self.foo + x + b
+  )");
+
+  std::vector<IValue> inputs;
+  auto minput = 5 * torch::ones({});
+  inputs.emplace_back(minput);
+  auto ref = m.forward(inputs);
+
+  std::stringstream full;
+  m._save_for_mobile(full);
+  std::stringstream stripped;
+  m._save_for_mobile(stripped, ExtraFilesMap(), /*strip_debug_info=*/true);
+  // the stripped archive has no code sections or source ranges
+  ASSERT_TRUE(stripped.str().size() < full.str().size());
+
+  mobile::Module bc = _load_for_mobile(stripped);
+  auto bcinputs = inputs;
+  auto res = bc.forward(bcinputs);
+  AT_ASSERT(res.toTensor().item<float>() == ref.toTensor().item<float>());
+}
+
 void testLiteInterpreterAdd() {
   Module m("m");
   m.register_parameter("foo", torch::ones({}), false);
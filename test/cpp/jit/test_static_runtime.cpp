@@ -0,0 +1,49 @@
+#include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/ir/irparser.h>
+#include <torch/csrc/jit/runtime/static_runtime.h>
+#include "test/cpp/jit/test_base.h"
+
+namespace torch {
+namespace jit {
+
+void testStaticRuntime() {
+  const std::string graph_string = R"IR(
+    graph(%a : Tensor,
+          %b : Tensor):
+      %c : int = prim::Constant[value=1]()
+      %d : Tensor = aten::add(%a, %b, %c)
+      %e : Tensor = aten::mul(%d, %b)
+      return (%e))IR";
+  auto graph = std::make_shared<Graph>();
+  parseIR(graph_string, &*graph);
+
+  StaticRuntime runtime(graph);
+
+  auto a = at::rand({2, 3});
+  auto b = at::rand({2, 3});
+  auto expected = (a + b) * b;
+
+  // the register file is reused across calls
+  for (int i = 0; i < 2; i++) {
+    auto outputs = runtime.run({a, b});
+    ASSERT_EQ(outputs.size(), 1);
+    ASSERT_TRUE(outputs[0].toTensor().allclose(expected));
+  }
+
+  // control flow is rejected at construction
+  const std::string if_graph_string = R"IR(
+    graph(%a : Tensor,
+          %cond : bool):
+      %b : Tensor = prim::If(%cond)
+        block0():
+          -> (%a)
+        block1():
+          -> (%a)
+      return (%b))IR";
+  auto if_graph = std::make_shared<Graph>();
+  parseIR(if_graph_string, &*if_graph);
+  ASSERT_ANY_THROW(StaticRuntime{if_graph});
+}
+
+} // namespace jit
+} // namespace torch
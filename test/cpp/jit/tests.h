@@ -86,7 +86,10 @@ namespace jit {
   _(LiteInterpreterWrongMethodName)    \
   _(LiteInterpreterParams)             \
   _(LiteInterpreterSetState)           \
-  _(TorchbindIValueAPI)
+  _(LiteInterpreterStripDebug)         \
+  _(TorchbindIValueAPI)                \
+  _(StaticRuntime)                     \
+  _(DynamicBatcher)
 
 #define TH_FORALL_TESTS_CUDA(_) \
   _(ArgumentSpec)               \
@@ -790,6 +790,32 @@ class ProcessGroupGlooTest(MultiProcessTestCase):
     def test_allreduce_basics(self):
         self._test_allreduce_basics(lambda t: t.clone())
 
+    def test_allreduce_busy_poll(self):
+        store = c10d.FileStore(self.file_name, self.world_size)
+        opts = self.opts()
+        opts.busy_poll_wait = True
+        pg = c10d.ProcessGroupGloo(store, self.rank, self.world_size, opts)
+
+        # Small collective: busy-polled completion.
+        tensor = torch.tensor([self.rank + 1.0])
+        pg.allreduce(tensor).wait()
+        self.assertEqual(
+            torch.tensor([float(self.world_size * (self.world_size + 1) / 2)]),
+            tensor)
+
+        # Above the size threshold: falls back to the blocking wait.
+        opts.busy_poll_size_threshold = 8
+        pg = c10d.ProcessGroupGloo(
+            c10d.PrefixStore("fallback", store),
+            self.rank,
+            self.world_size,
+            opts)
+        tensor = torch.full([1024], float(self.rank + 1))
+        pg.allreduce(tensor).wait()
+        self.assertEqual(
+            torch.full([1024], float(self.world_size * (self.world_size + 1) / 2)),
+            tensor)
+
     @skip_if_not_multigpu
     @skip_if_rocm
     def test_allreduce_basics_cuda(self):
@@ -3065,6 +3091,34 @@ class ReducerTest(TestCase):
         # is considered being globally unused, it will be kept untouched as None.
         self.assertEqual(None, model.fc3.weight.grad)
 
+    def test_forward_backward_bucket_ready_hook(self):
+        batch_size = 10
+        model = self._create_mixed_precision_model()
+        parameters = [list(model.parameters())]
+        group_by_type = groupby(
+            range(len(parameters[0])),
+            key=lambda i: parameters[0][i].type())
+        buckets = [list(indices) for _, indices in group_by_type]
+        reducer = dist.Reducer(parameters, buckets, self.process_group)
+
+        ready_buckets = []
+        reducer.register_bucket_ready_hook(
+            lambda variable_indices: ready_buckets.append(list(variable_indices)))
+
+        loss = nn.CrossEntropyLoss()
+        input = torch.rand([batch_size, 2], dtype=torch.double)
+        target = torch.LongTensor([random.randrange(4) for _ in range(batch_size)])
+        output = loss(model(input), target)
+        reducer.prepare_for_backward(output)
+        output.backward()
+
+        # The hook fires once per bucket, in reduction order, and together
+        # the calls cover every parameter exactly once.
+        self.assertEqual(len(ready_buckets), len(buckets))
+        self.assertEqual(
+            sorted(index for bucket in ready_buckets for index in bucket),
+            list(range(len(parameters[0]))))
+
     def test_forward_backward_optimizer(self):
         batch_size = 10
         model = self._create_mixed_precision_model()
@@ -478,6 +478,25 @@ class TestCuda(TestCase):
         y = torch.ones(10000000, dtype=torch.uint8).cuda()
         _test_copy_non_blocking(x, y)
 
+    @unittest.skipIf(not TEST_MULTIGPU, "only one GPU detected")
+    def test_copy_device_chunked(self):
+        # large enough to take the chunked multi-stream path, with a ragged
+        # tail chunk
+        x = torch.randn(24 * 1024 * 1024 + 12345, device='cuda:0')
+        y = x.to(device='cuda:1')
+        self.assertEqual(x.cpu(), y.cpu())
+        y.zero_()
+        y.copy_(x, non_blocking=True)
+        torch.cuda.synchronize()
+        self.assertEqual(x.cpu(), y.cpu())
+
+    @unittest.skipIf(not TEST_MULTIGPU, "only one GPU detected")
+    def test_setup_peer_access(self):
+        torch.cuda.setup_peer_access()
+        x = torch.randn(5, 5, device='cuda:0')
+        y = x.to(device='cuda:1')
+        self.assertEqual(x.cpu(), y.cpu())
+
     def test_serialization_array_with_storage(self):
         x = torch.randn(5, 5).cuda()
         y = torch.IntTensor(2, 5).fill_(0).cuda()
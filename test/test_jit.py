@@ -4469,6 +4469,24 @@ graph(%Ra, %Rb):
         expected = ['aten::add.Tensor', 'aten::mul.Scalar']
         self.assertEqual(ops, expected)
 
+    def test_warmup(self):
+        class M(torch.nn.Module):
+            def __init__(self):
+                super(M, self).__init__()
+                self.weight = torch.nn.Parameter(torch.rand(3, 3))
+
+            def forward(self, x):
+                return torch.mm(x, self.weight)
+
+        m = torch.jit.script(M())
+        times = torch.jit._warmup(m, [(torch.rand(2, 3),), (torch.rand(5, 3),)])
+        self.assertEqual(len(times), 2)
+        for t in times:
+            self.assertGreaterEqual(t, 0)
+        # warmup must not have executed the method, only compiled it
+        x = torch.rand(2, 3)
+        self.assertEqual(m(x), torch.mm(x, m.weight))
+
     def test_pytorch_jit_env_off(self):
         import subprocess
         env = os.environ.copy()
@@ -13262,6 +13280,26 @@ a")
             self.assertEqual(torch.autograd.grad(sout.sum(), inputs),
                              torch.autograd.grad(out.sum(), inputs))
 
+    def test_mm_batching_stacked(self):
+        # shape-identical mms with unrelated operands and separate outputs:
+        # not a tree of adds and no shared side, so only the stacked phase
+        # of BatchMM can group them
+        def many_mms(x, w0, w1, w2, w3, w4, w5, w6, w7):
+            outs = [torch.mm(x[0], w0), torch.mm(x[1], w1),
+                    torch.mm(x[2], w2), torch.mm(x[3], w3),
+                    torch.mm(x[4], w4), torch.mm(x[5], w5),
+                    torch.mm(x[6], w6), torch.mm(x[7], w7)]
+            return torch.stack(outs)
+
+        smany = torch.jit.script(many_mms)
+
+        x = torch.randn(8, 16, 16)
+        ws = [torch.randn(16, 16) for _ in range(8)]
+        out = smany(x, *ws)
+        if GRAPH_EXECUTOR == ProfilingMode.LEGACY:
+            self.assertTrue('prim::MMBatchStacked' in str(smany.graph_for(x, *ws)))
+        self.assertEqual(out, many_mms(x, *ws))
+
     def test_loop_unrolling(self):
         def fn(x):
             y = 0
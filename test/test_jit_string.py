@@ -164,7 +164,7 @@ class TestScript(JitTestCase):
         self.checkScript(test_expandtabs, ())
 
         def test_rfind():
-            # type: () -> Tuple[int, int, int, int, int, int, int, int, int]
+            # type: () -> Tuple[int, int, int, int, int, int, int, int, int, int, int]
             return (
                 "hello123abc".rfind("llo"),
                 "hello123abc".rfind("12"),
@@ -175,11 +175,13 @@ class TestScript(JitTestCase):
                 "hello123abc".rfind("ll", -1, 8),
                 "hello123abc".rfind("12", 4, -4),
                 "hello123abc".rfind("ab", -7, -20),
+                "hello123abc".rfind("", 3, 2),
+                "hello123abc".rfind("abcd", 8),
             )
         self.checkScript(test_rfind, ())
 
         def test_find():
-            # type: () -> Tuple[int, int, int, int, int, int, int, int, int]
+            # type: () -> Tuple[int, int, int, int, int, int, int, int, int, int, int]
             return (
                 "hello123abc".find("llo"),
                 "hello123abc".find("12"),
@@ -190,6 +192,8 @@ class TestScript(JitTestCase):
                 "hello123abc".find("ll", -1, 8),
                 "hello123abc".find("12", 4, -4),
                 "hello123abc".find("ab", -7, -20),
+                "hello123abc".find("", 3, 2),
+                "hello123abc".find("abcd", 8),
             )
         self.checkScript(test_find, ())
 
@@ -218,9 +222,11 @@ class TestScript(JitTestCase):
         self.checkScript(test_rindex, ())
 
         def test_replace():
-            # type: () -> Tuple[str, str, str, str, str, str, str]
+            # type: () -> Tuple[str, str, str, str, str, str, str, str, str]
             return (
                 "hello123abc".replace("llo", "sdf"),
+                "abc".replace("", "-"),
+                "abc".replace("", "-", 2),
                 "ff".replace("f", "ff"),
                 "abc123".replace("a", "testing"),
                 "aaaaaa".replace("a", "testing", 3),
@@ -668,6 +668,38 @@ if __name__ == "__main__":
         self._test_empty_tensor_sharing(torch.float32, torch.device('cpu'))
         self._test_empty_tensor_sharing(torch.int64, torch.device('cpu'))
 
+    def test_coalesce_shared_tensors(self):
+        floats = [torch.rand(3, 4) for _ in range(10)]
+        longs = [torch.randint(10, (5,)) for _ in range(10)]
+        item = {'floats': floats, 'longs': tuple(longs), 'meta': 42}
+        coalesced = mp.coalesce_shared_tensors(item)
+        self.assertEqual(coalesced['meta'], 42)
+        # values are preserved and everything lives in shared memory
+        for orig, out in zip(floats, coalesced['floats']):
+            self.assertEqual(orig, out)
+            self.assertTrue(out.is_shared())
+        for orig, out in zip(longs, coalesced['longs']):
+            self.assertEqual(orig, out)
+            self.assertTrue(out.is_shared())
+        # one segment per dtype: all same-dtype views share one storage
+        float_ptrs = {t.storage().data_ptr() for t in coalesced['floats']}
+        long_ptrs = {t.storage().data_ptr() for t in coalesced['longs']}
+        self.assertEqual(len(float_ptrs), 1)
+        self.assertEqual(len(long_ptrs), 1)
+        # the originals are untouched
+        self.assertFalse(floats[0].is_shared())
+
+        # a queue round trip preserves values and sharing
+        q = mp.Queue()
+        q.put(coalesced)
+        out = q.get(timeout=1)
+        for orig, received in zip(floats, out['floats']):
+            self.assertEqual(orig, received)
+
+        # tensors already in shared memory are passed through unchanged
+        shared = torch.rand(2, 2).share_memory_()
+        self.assertIs(mp.coalesce_shared_tensors([shared])[0], shared)
+
     @unittest.skipIf(not torch.cuda.is_available(), 'CUDA not available')
     def test_empty_tensor_sharing_cuda(self):
         self._test_empty_tensor_sharing(torch.float32, torch.device('cuda'))
@@ -3546,6 +3546,26 @@ class TestNN(NNTestCase):
                 output = module(input)
                 self.assertEqual(output.size(), (4,) + (2,) * (numel - 1) + (4,))
 
+    def test_adaptive_pooling_avg_nhwc_cpu(self):
+        input = torch.randint(1, 10, (4, 8, 8, 8), dtype=torch.float32)
+        input = input.contiguous(memory_format=torch.channels_last).requires_grad_()
+        grad = torch.randint(1, 10, (4, 8, 7, 7), dtype=torch.float32)
+        pool = torch.nn.AdaptiveAvgPool2d((7, 7))
+
+        ref_input = input.detach().clone().contiguous().requires_grad_(True)
+        ref_grad = grad.detach().clone().contiguous()
+        ref_pool = torch.nn.AdaptiveAvgPool2d((7, 7))
+
+        out = pool(input)
+        out.backward(grad)
+        ref_out = ref_pool(ref_input)
+        ref_out.backward(ref_grad)
+
+        self.assertTrue(out.is_contiguous(memory_format=torch.channels_last))
+        self.assertTrue(ref_out.is_contiguous())
+        self.assertEqual(out, ref_out)
+        self.assertEqual(input.grad, ref_input.grad)
+
     @unittest.skipIf(not TEST_CUDA, "CUDA unavailable")
     def test_adaptive_pooling_avg_nhwc(self):
         input = torch.randint(1, 10, (4, 8, 8, 8), dtype=torch.float32, device="cuda")
@@ -9207,6 +9227,58 @@ class TestNNDeviceType(NNTestCase):
         if self.device_type == 'cuda':
             self._test_LayerNorm_cuda_half(device)
 
+    def test_residual_layer_norm(self, device):
+        x = torch.randn(4, 3, 16, device=device)
+        res = torch.randn(4, 3, 16, device=device)
+        weight = torch.randn(16, device=device)
+        bias = torch.randn(16, device=device)
+
+        # eval mode: dropout is the identity
+        expected = F.layer_norm(x + res, [16], weight, bias)
+        actual = torch._residual_layer_norm(x, res, [16], weight, bias)
+        self.assertEqual(expected, actual)
+
+        # no affine params, multi-dim normalized_shape
+        expected = F.layer_norm(x + res, [3, 16])
+        actual = torch._residual_layer_norm(x, res, [3, 16])
+        self.assertEqual(expected, actual)
+
+        # p=1 drops the input entirely, leaving the normalized residual
+        expected = F.layer_norm(res, [16], weight, bias)
+        actual = torch._residual_layer_norm(
+            x, res, [16], weight, bias, dropout_p=1.0, train=True)
+        self.assertEqual(expected, actual)
+
+        if self.device_type == 'cpu':
+            # the mask is sampled with the same bernoulli_ path as
+            # F.dropout, so under the same seed the results must agree
+            torch.manual_seed(1234)
+            expected = F.layer_norm(
+                F.dropout(x, 0.5, training=True) + res, [16], weight, bias)
+            torch.manual_seed(1234)
+            actual = torch._residual_layer_norm(
+                x, res, [16], weight, bias, dropout_p=0.5, train=True)
+            self.assertEqual(expected, actual)
+
+    def test_embedding_layer_norm(self, device):
+        weight = torch.randn(10, 16, device=device)
+        pos = torch.randn(8, 16, device=device)
+        gamma = torch.randn(16, device=device)
+        beta = torch.randn(16, device=device)
+        idx = torch.randint(10, (4, 3), device=device)
+
+        # only the first L rows of the positional table are used
+        expected = F.layer_norm(
+            F.embedding(idx, weight) + pos[:3], [16], gamma, beta)
+        actual = torch._embedding_layer_norm(weight, idx, pos, gamma, beta)
+        self.assertEqual(expected, actual)
+
+        # no positional table, no affine params, 1-d indices
+        idx = torch.randint(10, (5,), device=device)
+        expected = F.layer_norm(F.embedding(idx, weight), [16])
+        actual = torch._embedding_layer_norm(weight, idx)
+        self.assertEqual(expected, actual)
+
     def test_GroupNorm_general(self, device):
         self._test_GroupNorm_general(device)
 
@@ -1488,6 +1488,75 @@ class TestQuantizedOps(TestCase):
             quantize_ref = torch.quantize_per_tensor(float_ref, Y_scale, Y_zero_point, dtype_x)
             self.assertEqual(qy.int_repr().numpy(), quantize_ref.int_repr().numpy())
 
+class TestQuantizedEmbeddingBag(TestCase):
+    """Tests the sub-byte packed embedding_bag prepack and lookup ops."""
+
+    @staticmethod
+    def _dequantize_packed(packed, num_cols, bit_width, group_size):
+        # see NOTE [ Sub-byte packed embedding tables ] in
+        # aten/src/ATen/native/quantized/cpu/qembeddingbag.cpp
+        elems_per_byte = 8 // bit_width
+        mask = (1 << bit_width) - 1
+        data = packed.numpy()
+        num_rows, row_bytes = data.shape
+        if group_size == -1:
+            group_size = num_cols
+        num_groups = num_cols // group_size
+        group_bytes = group_size // elems_per_byte + 4
+        out = np.zeros((num_rows, num_cols), dtype=np.float32)
+        for r in range(num_rows):
+            for g in range(num_groups):
+                group_data = data[r, g * group_bytes:(g + 1) * group_bytes]
+                params = np.frombuffer(group_data[-4:].tobytes(), dtype=np.float16)
+                scale, min_val = params.astype(np.float32)
+                for j in range(group_size):
+                    byte = int(group_data[j // elems_per_byte])
+                    q = (byte >> ((j % elems_per_byte) * bit_width)) & mask
+                    out[r, g * group_size + j] = q * scale + min_val
+        return torch.from_numpy(out)
+
+    def _test_embedding_bag(self, bit_width, group_size):
+        prepack = getattr(
+            torch.ops.quantized, 'embedding_bag_%dbit_prepack' % bit_width)
+        lookup = getattr(
+            torch.ops.quantized,
+            'embedding_bag_%dbit_rowwise_offsets' % bit_width)
+        num_rows, num_cols = 20, 16
+        weight = torch.randn(num_rows, num_cols)
+        packed = prepack(weight, group_size)
+        self.assertEqual(packed.dtype, torch.uint8)
+
+        dequantized = self._dequantize_packed(
+            packed, num_cols, bit_width, group_size)
+        # quantization error is bounded by half a step per group
+        max_q = (1 << bit_width) - 1
+        groups = weight.reshape(
+            num_rows, -1, group_size if group_size != -1 else num_cols)
+        step = (groups.max(dim=2, keepdim=True)[0] -
+                groups.min(dim=2, keepdim=True)[0]) / max_q
+        self.assertTrue(
+            ((dequantized.reshape_as(groups) - groups).abs() <=
+             0.51 * step + 1e-2).all())
+
+        indices = torch.randint(0, num_rows, (30,), dtype=torch.int64)
+        offsets = torch.tensor([0, 5, 5, 17], dtype=torch.int64)
+        result = lookup(packed, indices, offsets, group_size)
+        expected = torch.zeros(offsets.numel(), num_cols)
+        ends = offsets.tolist()[1:] + [indices.numel()]
+        for bag, (begin, end) in enumerate(zip(offsets.tolist(), ends)):
+            for i in range(begin, end):
+                expected[bag] += dequantized[indices[i]]
+        self.assertEqual(result, expected)
+
+    def test_embedding_bag_4bit(self):
+        self._test_embedding_bag(4, -1)
+        self._test_embedding_bag(4, 8)
+
+    def test_embedding_bag_2bit(self):
+        self._test_embedding_bag(2, -1)
+        self._test_embedding_bag(2, 4)
+
+
 @unittest.skipUnless('fbgemm' in torch.backends.quantized.supported_engines,
                      " Quantized operations require FBGEMM. FBGEMM is only optimized for CPUs"
                      " with instruction set support avx2 or newer.")
@@ -505,6 +505,24 @@ class _TestTorchMixin(object):
                 return inf
         self._test_math(torch.exp, exp)
 
+    def test_foreach_ops(self):
+        tensors = [torch.randn(5, 5) for _ in range(10)]
+        for res, t in zip(torch._foreach_add(tensors, 2.5), tensors):
+            self.assertEqual(res, t.add(2.5))
+        for res, t in zip(torch._foreach_mul(tensors, -3), tensors):
+            self.assertEqual(res, t.mul(-3))
+        for res, t in zip(torch._foreach_exp(tensors), tensors):
+            self.assertEqual(res, t.exp())
+        # mixed sizes and a non-contiguous member exercise the flattened
+        # element mapping and the slow-path fallback respectively
+        mixed = [torch.randn(3), torch.randn(17, 9), torch.randn(1)]
+        for res, t in zip(torch._foreach_add(mixed, 1), mixed):
+            self.assertEqual(res, t.add(1))
+        strided = [torch.randn(4, 4).t(), torch.randn(4, 4)]
+        for res, t in zip(torch._foreach_mul(strided, 2), strided):
+            self.assertEqual(res, t.mul(2))
+        self.assertEqual(torch._foreach_exp([]), [])
+
     def test_expm1(self):
         def expm1(x):
             try:
@@ -869,6 +887,25 @@ class _TestTorchMixin(object):
             lambda t, d: t.sum(d),
             lambda n, d: n.sum(d))
 
+    def test_deterministic_cpu_reduction(self):
+        self.assertFalse(torch.get_deterministic_cpu_reduction())
+        x = torch.randn(1000000)
+        try:
+            torch.set_deterministic_cpu_reduction(True)
+            self.assertTrue(torch.get_deterministic_cpu_reduction())
+            expected_sum = x.sum()
+            expected_norm = x.norm()
+            for _ in range(5):
+                self.assertEqual(x.sum().item(), expected_sum.item(), 0)
+                self.assertEqual(x.norm().item(), expected_norm.item(), 0)
+            # the deterministic tree must still agree with the default path
+            # up to reduction reordering
+            torch.set_deterministic_cpu_reduction(False)
+            self.assertEqual(x.sum(), expected_sum)
+            self.assertEqual(x.norm(), expected_norm)
+        finally:
+            torch.set_deterministic_cpu_reduction(False)
+
     @unittest.skipIf(not TEST_NUMPY, 'Numpy not found')
     def test_mean_dim(self):
         self._test_dim_ops(
@@ -1057,6 +1094,53 @@ class _TestTorchMixin(object):
         self.assertEqual(y[:, 0], range(100))
         self.assertEqual(y[:, 40], range(4000, 4100))
 
+        # Sizes that are not a multiple of the transpose tile, across dtypes
+        # with different element sizes.
+        for dtype in (torch.float, torch.double, torch.int, torch.uint8):
+            x = torch.arange(131 * 77).reshape(131, 77).to(dtype).t()
+            y = torch.empty(77, 131, dtype=dtype)
+            y.copy_(x)
+            self.assertEqual(y, x, 0)
+
+        # Batched: permute(0, 2, 1) of a contiguous 3-D tensor.
+        x = torch.randn(7, 83, 65).permute(0, 2, 1)
+        y = torch.empty(7, 65, 83)
+        y.copy_(x)
+        self.assertEqual(y, x, 0)
+
+    def test_inference_mode(self):
+        self.assertFalse(torch._C.is_inference_mode_enabled())
+        pre = torch.ones(5)
+        try:
+            torch._C.set_inference_mode_enabled(True)
+            self.assertTrue(torch._C.is_inference_mode_enabled())
+            # grad mode reports disabled on every thread
+            self.assertFalse(torch.is_grad_enabled())
+
+            # tensors created under inference mode carry no version counter
+            x = torch.ones(5)
+            x.add_(1)
+            x.mul_(2)
+            self.assertEqual(x._version, 0)
+            self.assertEqual(x, torch.full((5,), 4.0))
+
+            # views share the (absent) counter
+            self.assertEqual(x[:2]._version, 0)
+
+            # tensors that predate the switch keep their counters
+            v = pre._version
+            pre.add_(1)
+            self.assertEqual(pre._version, v + 1)
+
+            # escape hatch: opting back into autograd materializes a counter
+            x.requires_grad_(True)
+            x.add_(1)
+            self.assertEqual(x._version, 1)
+        finally:
+            torch._C.set_inference_mode_enabled(False)
+        self.assertFalse(torch._C.is_inference_mode_enabled())
+        self.assertTrue(torch.is_grad_enabled())
+
     def test_device(self):
         cpu = torch.device('cpu')
         self.assertEqual('cpu', str(cpu))
@@ -2113,6 +2197,20 @@ class _TestTorchMixin(object):
         torch.rand(SIZE, SIZE, out=res2)
         self.assertEqual(res1, res2)
 
+    def test_rand_large_deterministic(self):
+        # large contiguous fills take the parallel philox path; the result
+        # must be reproducible from the seed and respect the range bounds
+        for dtype in (torch.float, torch.double):
+            torch.manual_seed(123456)
+            res1 = torch.empty(100000, dtype=dtype).uniform_(-2, 2)
+            torch.manual_seed(123456)
+            res2 = torch.empty(100000, dtype=dtype).uniform_(-2, 2)
+            self.assertEqual(res1, res2)
+            self.assertTrue((res1 >= -2).all().item())
+            self.assertTrue((res1 < 2).all().item())
+            # consecutive fills under one seed must not repeat
+            self.assertNotEqual(res1, torch.empty(100000, dtype=dtype).uniform_(-2, 2))
+
     def test_randint(self):
         def seed(generator):
             if generator is None:
@@ -2297,6 +2395,35 @@ class _TestTorchMixin(object):
     def test_fft_ifft_rfft_irfft(self):
         self._test_fft_ifft_rfft_irfft(self)
 
+    @unittest.skipIf(not TEST_MKL, "PyTorch is built without MKL support")
+    def test_mkl_fft_plan_cache(self):
+        plan_cache = torch.backends.mkl.fft_plan_cache
+        original_max_size = plan_cache.max_size
+        try:
+            plan_cache.clear()
+            self.assertEqual(plan_cache.size, 0)
+            x = torch.randn(4, 8, 2)
+            torch.fft(x, 1)
+            self.assertEqual(plan_cache.size, 1)
+            # same configuration reuses the cached plan
+            torch.fft(x, 1)
+            self.assertEqual(plan_cache.size, 1)
+            # different configurations get their own plans
+            torch.ifft(x, 1)
+            self.assertEqual(plan_cache.size, 2)
+            # shrinking the capacity evicts least recently used plans
+            plan_cache.max_size = 1
+            self.assertEqual(plan_cache.max_size, 1)
+            self.assertEqual(plan_cache.size, 1)
+            # capacity zero disables caching but transforms still work
+            plan_cache.max_size = 0
+            self.assertEqual(plan_cache.size, 0)
+            self.assertEqual(torch.ifft(torch.fft(x, 1), 1), x, prec=1e-5)
+            with self.assertRaisesRegex(RuntimeError, "read-only property"):
+                plan_cache.size = 1
+        finally:
+            plan_cache.max_size = original_max_size
+
     @unittest.skip("Not implemented yet")
     def test_conv2(self):
         x = torch.rand(math.floor(torch.uniform(50, 100)), math.floor(torch.uniform(50, 100)))
@@ -6484,6 +6611,23 @@ class TestTorchDeviceType(TestCase):
         with self.assertRaisesRegex(RuntimeError, error_msg):
             m1.clamp_()
 
+    def test_clamp_where(self, device):
+        for cond_dtype in (torch.bool, torch.uint8):
+            cond = (torch.rand(100, device=device) > 0.5).to(cond_dtype)
+            x = torch.randn(100, device=device)
+            y = torch.randn(100, device=device)
+            expected = torch.where(cond.bool(), x, y).clamp(-0.5, 0.5)
+            actual = torch._clamp_where(cond, x, y, -0.5, 0.5)
+            self.assertEqual(expected, actual)
+
+        # broadcasting condition, integral dtype
+        cond = torch.tensor([True, False], device=device).unsqueeze(1)
+        x = torch.randint(-10, 10, (2, 5), device=device)
+        y = torch.randint(-10, 10, (2, 5), device=device)
+        expected = torch.where(cond, x, y).clamp(-3, 3)
+        actual = torch._clamp_where(cond, x, y, -3, 3)
+        self.assertEqual(expected, actual)
+
     def test_cat_empty_legacy(self, device):
         # FIXME: this is legacy behavior and should be removed
         # when we support empty tensors with arbitrary sizes
@@ -10217,6 +10361,52 @@ class TestTorchDeviceType(TestCase):
                                r"For integral input tensors, argument alpha must not be a floating point number\.",
                                lambda: torch.add(m1, m2, alpha=1.0))
 
+    @onlyCPU
+    def test_stochastic_round_add(self, device):
+        # deterministic for a fixed seed
+        a = torch.randn(100, device=device).bfloat16()
+        b = torch.randn(100, device=device).bfloat16()
+        torch.manual_seed(42)
+        res1 = torch._stochastic_round_add_(a.clone(), b)
+        torch.manual_seed(42)
+        res2 = torch._stochastic_round_add_(a.clone(), b)
+        self.assertEqual(res1, res2)
+        self.assertEqual(res1.dtype, torch.bfloat16)
+
+        # values exactly representable in bfloat16 are never perturbed
+        a = torch.full((100,), 2., dtype=torch.bfloat16, device=device)
+        b = torch.full((100,), 1., dtype=torch.bfloat16, device=device)
+        torch._stochastic_round_add_(a, b)
+        self.assertEqual(a, torch.full((100,), 3., dtype=torch.bfloat16, device=device))
+
+        # repeatedly adding an increment far below the rounding step of the
+        # accumulator would vanish under round-to-nearest, but survives in
+        # expectation under stochastic rounding
+        acc = torch.zeros(10000, dtype=torch.bfloat16, device=device)
+        inc = torch.full((10000,), 1e-3, dtype=torch.float, device=device)
+        for _ in range(1000):
+            torch._stochastic_round_add_(acc, inc)
+        self.assertEqual(acc.float().mean().item(), 1., prec=0.05)
+
+        # non-finite values are preserved
+        a = torch.tensor([float('inf'), float('-inf'), float('nan')],
+                         dtype=torch.bfloat16, device=device)
+        b = torch.zeros(3, dtype=torch.bfloat16, device=device)
+        torch._stochastic_round_add_(a, b)
+        self.assertEqual(a[0].item(), float('inf'))
+        self.assertEqual(a[1].item(), float('-inf'))
+        self.assertTrue(math.isnan(a[2].item()))
+
+        # shape and dtype checks
+        self.assertRaisesRegex(
+            RuntimeError, "BFloat16 tensor for self",
+            lambda: torch._stochastic_round_add_(torch.zeros(3, device=device),
+                                                 torch.zeros(3, device=device)))
+        self.assertRaisesRegex(
+            RuntimeError, "same shape",
+            lambda: torch._stochastic_round_add_(
+                torch.zeros(3, dtype=torch.bfloat16, device=device),
+                torch.zeros(4, dtype=torch.bfloat16, device=device)))
 
     def test_sub_typing(self, device):
         m1 = torch.tensor([True, False, False, True, False, False], dtype=torch.bool, device=device)
@@ -10425,6 +10615,34 @@ class TestTorchDeviceType(TestCase):
                                                        [0, 0, 0],
                                                        [0, 0, 0]]), expected_out)
 
+    @onlyCPU
+    def test_aminmax(self, device):
+        for dtype in [torch.float, torch.double, torch.int, torch.long]:
+            if dtype.is_floating_point:
+                x = torch.rand(100, 50, 20, device=device, dtype=dtype)
+            else:
+                x = torch.randint(-100, 100, (100, 50, 20), device=device, dtype=dtype)
+            min1, max1 = torch._aminmax(x)
+            self.assertEqual(min1, x.min())
+            self.assertEqual(max1, x.max())
+            for dim in range(x.dim()):
+                for keepdim in [False, True]:
+                    min1, max1 = torch._aminmax(x, dim=dim, keepdim=keepdim)
+                    min2 = x.min(dim=dim, keepdim=keepdim)[0]
+                    max2 = x.max(dim=dim, keepdim=keepdim)[0]
+                    self.assertEqual(min1, min2)
+                    self.assertEqual(max1, max2)
+
+        # NaN propagates to both outputs
+        x = torch.tensor([1., float('nan'), 3.], device=device)
+        min1, max1 = torch._aminmax(x)
+        self.assertTrue(math.isnan(min1.item()))
+        self.assertTrue(math.isnan(max1.item()))
+
+        self.assertRaisesRegex(
+            RuntimeError, "identity",
+            lambda: torch._aminmax(torch.empty(0, device=device)))
+
     def test_std_mean(self, device):
         x = torch.rand(100, 50, 20, device=device)
         for dim in range(x.dim()):
@@ -13174,6 +13392,11 @@ class TestTorchDeviceType(TestCase):
         big_exp[1] = 1000000
         big_out = torch.ones(1000000, dtype=torch.int8, device=device).bincount()
         self.assertEqual(big_exp, big_out)
+        # test large weighted input against an index_add_ reference
+        big_idx = torch.randint(100, (100000,), device=device)
+        big_w = torch.rand(100000, device=device)
+        big_exp = torch.zeros(100, device=device).index_add_(0, big_idx, big_w)
+        self.assertEqual(big_exp, big_idx.bincount(big_w))
 
     @dtypes(torch.float, torch.double, torch.half)
     def test_multinomial(self, device, dtype):
@@ -14528,6 +14751,27 @@ scipy_lobpcg  | {:10.2e}  | {:10.2e}  | {:6} | N/A
             self.assertRaises(RuntimeError, lambda: torch.bmm(b1, b2.cuda()))
             self.assertRaises(RuntimeError, lambda: torch.bmm(b1.cuda(), b2))
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double)
+    def test_grouped_mm(self, device, dtype):
+        # small sizes hit the fused microkernel, large ones the bmm fallback
+        for b, m, n, p in [(4, 5, 6, 7), (6, 16, 12, 24)]:
+            b1 = torch.randn(b, m, n, dtype=dtype, device=device)
+            b2 = torch.randn(b, n, p, dtype=dtype, device=device)
+            bias = torch.randn(p, dtype=dtype, device=device)
+            ref = torch.bmm(b1, b2)
+            self.assertEqual(torch._grouped_mm(b1, b2), ref)
+            self.assertEqual(torch._grouped_mm(b1, b2, bias), ref + bias)
+            self.assertEqual(torch._grouped_mm(b1, b2, bias, relu=True),
+                             (ref + bias).relu())
+            # non-contiguous batch items take the copying path
+            b1_t = b1.transpose(1, 2)
+            self.assertEqual(torch._grouped_mm(b1_t, b2[:, :m, :]),
+                             torch.bmm(b1_t, b2[:, :m, :]))
+        self.assertRaises(RuntimeError,
+                          lambda: torch._grouped_mm(torch.randn(2, 3, 4),
+                                                    torch.randn(2, 5, 6)))
+
     @onlyCPU
     @dtypes(torch.float)
     def test_addbmm(self, device, dtype):
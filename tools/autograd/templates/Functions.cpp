@@ -983,6 +983,50 @@ Tensor binary_cross_entropy_double_backward_grad_output(const Tensor & grad, con
   return ggO;
 }
 
+Tensor cross_entropy_loss_double_backward(const Tensor & grad, const Tensor & grad_output, const Tensor & input, const Tensor & target, const Tensor & logsumexp, const Tensor & weight, int64_t reduction, int64_t ignore_index, const Tensor & total_weight) {
+  // gradient wrt input: per row the backward is
+  // coeff * w[target] * (softmax(x) - onehot(target)), whose derivative
+  // contracted with grad is coeff * w[target] * p * (grad - <grad, p>)
+  auto p = (input - logsumexp.unsqueeze(-1)).exp();
+  auto gI = p * (grad - (grad * p).sum(-1, true));
+  // per-row scale: the class weight of the picked target, zero for ignored
+  // rows (the fill value only keeps index_select in bounds)
+  auto valid = target.ne(ignore_index);
+  Tensor row_scale;
+  if (weight.defined()) {
+    row_scale = at::where(
+        valid,
+        weight.index_select(0, target.masked_fill(target.eq(ignore_index), 0)),
+        at::zeros({}, input.options()));
+  } else {
+    row_scale = valid.to(input.scalar_type());
+  }
+  if (reduction == at::Reduction::None) {
+    row_scale = row_scale * grad_output;
+  } else if (reduction == at::Reduction::Mean) {
+    row_scale = row_scale * (grad_output / total_weight);
+  } else {
+    row_scale = row_scale * grad_output;
+  }
+  return gI * row_scale.unsqueeze(-1);
+}
+
+Tensor cross_entropy_loss_double_backward_grad_output(const Tensor & grad, const Tensor & input, const Tensor & target, const Tensor & logsumexp, const Tensor & weight, int64_t reduction, int64_t ignore_index, const Tensor & total_weight) {
+  // gradient wrt grad_output: contract grad with the per-sample backward
+  // for a unit upstream gradient
+  auto unit = at::ones({}, input.options());
+  auto unit_grad_input = at::_cross_entropy_loss_backward(
+      unit, input, target, logsumexp, weight, at::Reduction::Sum, ignore_index, total_weight);
+  if (reduction == at::Reduction::None) {
+    return (grad * unit_grad_input).sum(-1);
+  }
+  auto ggO = (grad * unit_grad_input).sum();
+  if (reduction == at::Reduction::Mean) {
+    ggO = ggO / total_weight;
+  }
+  return ggO;
+}
+
 Tensor l1_loss_double_backward_grad_output(const Tensor & grad, const Tensor & input, const Tensor & target, int64_t reduction) {
   auto output = l1_loss_backward(grad, input, target, at::Reduction::None);
   if (reduction == at::Reduction::Mean) {
@@ -43,6 +43,7 @@ libtorch_sources = [
     "torch/csrc/autograd/function_hook.cpp",
     "torch/csrc/autograd/functions/accumulate_grad.cpp",
     "torch/csrc/autograd/functions/basic_ops.cpp",
+    "torch/csrc/autograd/functions/checkpoint.cpp",
     "torch/csrc/autograd/functions/tensor.cpp",
     "torch/csrc/autograd/functions/utils.cpp",
     "torch/csrc/autograd/input_buffer.cpp",
@@ -87,6 +88,7 @@ libtorch_sources = [
     "torch/csrc/jit/ir/type_hashing.cpp",
     "torch/csrc/jit/serialization/export.cpp",
     "torch/csrc/jit/serialization/export_module.cpp",
+    "torch/csrc/jit/serialization/async_save.cpp",
     "torch/csrc/jit/passes/pass_manager.cpp",
     "torch/csrc/jit/serialization/pickler.cpp",
     "torch/csrc/jit/serialization/unpickler.cpp",
@@ -95,6 +97,7 @@ libtorch_sources = [
     "torch/csrc/jit/serialization/import_legacy.cpp",
     "torch/csrc/jit/serialization/pickle.cpp",
     "torch/csrc/jit/serialization/import_export_helpers.cpp",
+    "torch/csrc/jit/runtime/dynamic_batcher.cpp",
     "torch/csrc/jit/runtime/instruction.cpp",
     "torch/csrc/jit/runtime/interpreter.cpp",
     "torch/csrc/jit/ir/ir.cpp",
@@ -102,6 +105,7 @@ libtorch_sources = [
     "torch/csrc/jit/jit_log.cpp",
     "torch/csrc/jit/runtime/register_c10_ops.cpp",
     "torch/csrc/jit/ir/subgraph_matcher.cpp",
+    "torch/csrc/jit/runtime/static_runtime.cpp",
     "torch/csrc/jit/runtime/symbolic_script.cpp",
     "torch/csrc/jit/runtime/profiling_graph_executor_impl.cpp",
     "torch/csrc/jit/runtime/profiling_record.cpp",
@@ -117,6 +121,7 @@ libtorch_sources = [
     "torch/csrc/jit/passes/constant_propagation.cpp",
     "torch/csrc/jit/passes/constant_pooling.cpp",
     "torch/csrc/jit/passes/create_autodiff_subgraphs.cpp",
+    "torch/csrc/jit/passes/create_stream_subgraphs.cpp",
     "torch/csrc/jit/passes/dead_code_elimination.cpp",
     "torch/csrc/jit/passes/erase_number_types.cpp",
     "torch/csrc/jit/passes/fixup_trace_scope_blocks.cpp",
@@ -135,6 +140,7 @@ libtorch_sources = [
     "torch/csrc/jit/passes/lower_grad_of.cpp",
     "torch/csrc/jit/passes/lower_graph.cpp",
     "torch/csrc/jit/passes/lower_tuples.cpp",
+    "torch/csrc/jit/passes/memory_planning.cpp",
     "torch/csrc/jit/passes/peephole.cpp",
     "torch/csrc/jit/serialization/python_print.cpp",
     "torch/csrc/jit/passes/quantization.cpp",
@@ -142,6 +148,8 @@ libtorch_sources = [
     "torch/csrc/jit/passes/xnnpack_rewrite.cpp",
     "torch/csrc/jit/passes/fuse_linear.cpp",
     "torch/csrc/jit/passes/freeze_module.cpp",
+    "torch/csrc/jit/passes/frozen_conv_fusion.cpp",
+    "torch/csrc/jit/passes/frozen_linear_prepack.cpp",
     "torch/csrc/jit/passes/remove_expands.cpp",
     "torch/csrc/jit/passes/requires_grad_analysis.cpp",
     "torch/csrc/jit/passes/shape_analysis.cpp",
@@ -228,6 +236,7 @@ libtorch_cuda_sources = [
 torch_cpp_srcs = [
     "torch/csrc/api/src/cuda.cpp",  # this just forwards stuff, no real CUDA
     "torch/csrc/api/src/data/datasets/mnist.cpp",
+    "torch/csrc/api/src/data/detail/shared_memory_arena.cpp",
     "torch/csrc/api/src/data/samplers/distributed.cpp",
     "torch/csrc/api/src/data/samplers/random.cpp",
     "torch/csrc/api/src/data/samplers/sequential.cpp",
@@ -269,6 +278,7 @@ torch_cpp_srcs = [
     "torch/csrc/api/src/nn/options/pooling.cpp",
     "torch/csrc/api/src/nn/options/rnn.cpp",
     "torch/csrc/api/src/nn/options/vision.cpp",
+    "torch/csrc/api/src/nn/utils/inference_workspace.cpp",
     "torch/csrc/api/src/optim/adagrad.cpp",
     "torch/csrc/api/src/optim/adam.cpp",
     "torch/csrc/api/src/optim/lbfgs.cpp",
@@ -377,6 +387,7 @@ def add_torch_libs():
         "torch/csrc/jit/python/python_sugared_value.cpp",
         "torch/csrc/jit/python/python_tree_views.cpp",
         "torch/csrc/jit/runtime/register_distributed_ops.cpp",
+        "torch/csrc/multiprocessing/cuda_ipc_ring_buffer.cpp",
         "torch/csrc/multiprocessing/init.cpp",
         "torch/csrc/onnx/init.cpp",
         "torch/csrc/serialization.cpp",
@@ -25,6 +25,7 @@ __all__ = [
     'set_rng_state', 'get_rng_state', 'manual_seed', 'initial_seed', 'seed',
     'save', 'load', 'set_printoptions', 'chunk', 'split', 'stack', 'matmul',
     'no_grad', 'enable_grad', 'rand', 'randn',
+    'set_deterministic_cpu_reduction', 'get_deterministic_cpu_reduction',
     'DoubleStorage', 'FloatStorage', 'LongStorage', 'IntStorage',
     'ShortStorage', 'CharStorage', 'ByteStorage', 'BoolStorage',
     'DoubleTensor', 'FloatTensor', 'LongTensor', 'IntTensor',
@@ -218,6 +219,25 @@ def set_default_dtype(d):
     """
     _C._set_default_dtype(d)
 
+def set_deterministic_cpu_reduction(mode):
+    r"""Sets whether multi-threaded CPU reductions use a fixed chunk
+    decomposition with a canonical combination order. When enabled,
+    floating point reductions such as :func:`torch.sum` return bitwise
+    identical results from run to run regardless of the number of intra-op
+    threads, at a small cost in throughput.
+
+    Args:
+        mode (bool): if True, reductions are made deterministic.
+    """
+    _C._set_deterministic_cpu_reduction(mode)
+
+def get_deterministic_cpu_reduction():
+    r"""Returns True if deterministic CPU reductions are enabled. Refer to
+    :func:`torch.set_deterministic_cpu_reduction` documentation for more
+    details.
+    """
+    return _C._get_deterministic_cpu_reduction()
+
 # If you edit these imports, please update torch/__init__.py.in as well
 from .random import set_rng_state, get_rng_state, manual_seed, initial_seed, seed
 from .serialization import save, load
@@ -133,8 +133,10 @@ class EventList(list):
                         '"args": {}}, ' % (evt.name, evt.cpu_interval.start,
                                            evt.cpu_interval.elapsed_us(), evt.thread))
                 for k in evt.kernels:
-                    # 's' and 'f' draw Flow arrows from
-                    # the CPU launch to the GPU kernel
+                    # GPU intervals get one timeline row per stream so that
+                    # overlap (or the lack of it) across streams is visible;
+                    # 's' and 'f' draw Flow arrows from the CPU launch to the
+                    # GPU kernel
                     f.write('{"name": "%s", '
                             '"ph": "s", '
                             '"ts": %s, '
@@ -147,19 +149,21 @@ class EventList(list):
                     f.write('{"name": "%s", '
                             '"ph": "f", '
                             '"ts": %s, '
-                            '"tid": %s, '
-                            '"pid": "CUDA functions", '
+                            '"tid": "stream %s", '
+                            '"pid": "CUDA functions (device %s)", '
                             '"id": %s, '
                             '"cat": "cpu_to_cuda", '
-                            '"args": {}}, ' % (k.name, k.interval.start, k.device, next_id))
+                            '"args": {}}, ' % (k.name, k.interval.start,
+                                               k.stream, k.device, next_id))
                     f.write('{"name": "%s", '
                             '"ph": "X", '
                             '"ts": %s, '
                             '"dur": %s, '
-                            '"tid": %s, '
-                            '"pid": "CUDA functions", '
+                            '"tid": "stream %s", '
+                            '"pid": "CUDA functions (device %s)", '
                             '"args": {}}, ' % (k.name, k.interval.start,
-                                               k.interval.elapsed_us(), k.device))
+                                               k.interval.elapsed_us(),
+                                               k.stream, k.device))
                     next_id += 1
 
             # remove trailing whitespace and comma
@@ -230,6 +234,13 @@ class profile(object):
             self cpu time might be artificially increased because of the shape
             collection.
 
+        record_intensity (bool, optional): If set, ops built on TensorIterator
+            additionally report their planned memory traffic (bytes read and
+            written) and an estimated FLOP count, exposed as ``bytes_read``,
+            ``bytes_written`` and ``flops`` on each FunctionEvent. This lets
+            one classify ops as bandwidth- or compute-bound (roofline analysis)
+            without doing the operand math by hand.
+
     .. warning:
         This context managers should not be called recursively, i.e. at most one
         instance should be enabled at any given time.
@@ -259,7 +270,7 @@ class profile(object):
         -----------------------------------  ---------------  ---------------  ---------------
 
     """
-    def __init__(self, enabled=True, use_cuda=False, record_shapes=False):
+    def __init__(self, enabled=True, use_cuda=False, record_shapes=False, record_intensity=False):
         self.enabled = enabled
         self.use_cuda = use_cuda
         self.function_events = None
@@ -267,6 +278,7 @@ class profile(object):
             return
         self.entered = False
         self.record_shapes = record_shapes
+        self.record_intensity = record_intensity
 
     def __enter__(self):
         if not self.enabled:
@@ -277,7 +289,8 @@ class profile(object):
         profiler_kind = torch.autograd.ProfilerState.CUDA if self.use_cuda \
             else torch.autograd.ProfilerState.CPU
         torch.autograd._enable_profiler(
-            torch.autograd.ProfilerConfig(profiler_kind, self.record_shapes))
+            torch.autograd.ProfilerConfig(
+                profiler_kind, self.record_shapes, self.record_intensity))
         return self
 
     def __exit__(self, exc_type, exc_val, exc_tb):
@@ -548,13 +561,14 @@ class Interval(object):
         return self.end - self.start
 
 
-Kernel = namedtuple('Kernel', ['name', 'device', 'interval'])
+Kernel = namedtuple('Kernel', ['name', 'device', 'stream', 'interval'])
 
 
 # TODO: record TID too
 class FunctionEvent(FormattedTimesMixin):
     """Profiling information about a single function."""
-    def __init__(self, id, name, thread, cpu_start, cpu_end, input_shapes=None):
+    def __init__(self, id, name, thread, cpu_start, cpu_end, input_shapes=None,
+                 bytes_read=-1, bytes_written=-1, flops=-1):
         self.id = id
         self.name = name
         self.cpu_interval = Interval(cpu_start, cpu_end)
@@ -563,9 +577,14 @@ class FunctionEvent(FormattedTimesMixin):
         self.count = 1
         self.cpu_children = []
         self.input_shapes = input_shapes
+        # arithmetic-intensity counts (see profile's record_intensity);
+        # -1 when tracking was off
+        self.bytes_read = bytes_read
+        self.bytes_written = bytes_written
+        self.flops = flops
 
-    def append_kernel(self, name, device, start, end):
-        self.kernels.append(Kernel(name, device, Interval(start, end)))
+    def append_kernel(self, name, device, stream, start, end):
+        self.kernels.append(Kernel(name, device, stream, Interval(start, end)))
 
     def append_cpu_child(self, child):
         """Append a CPU child of type FunctionEvent.
@@ -702,18 +721,31 @@ def parse_cpu_trace(thread_records):
             next_id += 1
         elif record.kind() == 'pop':
             function_id, start = record_stack.pop()
+            # the recorded totals are monotonic per-thread counters, so the
+            # push/pop difference is the traffic attributable to this op
+            # (including its children); -1 means tracking was off
+            if start.bytes_read() >= 0 and record.bytes_read() >= 0:
+                bytes_read = record.bytes_read() - start.bytes_read()
+                bytes_written = record.bytes_written() - start.bytes_written()
+                flops = record.flops() - start.flops()
+            else:
+                bytes_read, bytes_written, flops = -1, -1, -1
             fe = FunctionEvent(
                 id=function_id,
                 name=string_table[start.name()],
                 thread=start.thread_id(),
                 cpu_start=start_record.cpu_elapsed_us(start),
                 cpu_end=start_record.cpu_elapsed_us(record),
-                input_shapes=start.shapes())
+                input_shapes=start.shapes(),
+                bytes_read=bytes_read,
+                bytes_written=bytes_written,
+                flops=flops)
             if start.has_cuda():
                 cuda_start = adjusted_time(start)
                 cuda_end = adjusted_time(record)
                 fe.append_kernel(start.name(),
                                  start.device(),
+                                 start.stream_id(),
                                  cuda_start,
                                  cuda_end)
             functions.append(fe)
@@ -774,7 +806,8 @@ def parse_nvprof_trace(path):
     SELECT
         start.id AS marker_id, start.name, start.timestamp, end.timestamp,
         runtime._id_ AS runtime_id, runtime.cbid, runtime.start AS runtime_start, runtime.end AS runtime_end,
-        kernel.start AS kernel_start, kernel.end AS kernel_end, kernel.name AS kernel_name
+        kernel.start AS kernel_start, kernel.end AS kernel_end, kernel.name AS kernel_name,
+        kernel.streamId AS kernel_streamId
     FROM
         CUPTI_ACTIVITY_KIND_MARKER AS start
         INNER JOIN CUPTI_ACTIVITY_KIND_MARKER AS end
@@ -792,6 +825,7 @@ def parse_nvprof_trace(path):
         evt = functions_map[row['marker_id']]
         evt.append_kernel(row['kernel_name'],
                           0,
+                          row['kernel_streamId'],
                           row['kernel_start'],
                           row['kernel_end'])
 
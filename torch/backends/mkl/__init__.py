@@ -1,6 +1,57 @@
+import sys
 import torch
 
 
 def is_available():
     r"""Returns whether PyTorch is built with MKL support."""
     return torch._C.has_mkl
+
+
+class MklFFTPlanCache(object):
+    r"""
+    Represents the MKL FFT plan cache. The attributes `size` and `max_size`,
+    and method `clear`, can fetch and/or change properties of the C++ MKL FFT
+    plan cache. Unlike the cuFFT plan caches, there is a single cache shared
+    by all CPU transforms.
+
+    A plan for a given transform configuration is built and cached on first
+    use, so a workload can warm the cache up front simply by running each
+    transform shape once. To pin a working set of plans, set `max_size` to at
+    least the number of distinct transform configurations used.
+    """
+
+    @property
+    def size(self):
+        return torch._mkl_fft_get_plan_cache_size()
+
+    @size.setter
+    def size(self, value):
+        raise RuntimeError(
+            '.size is a read-only property showing the number of plans currently in the '
+            'cache. To change the cache capacity, set fft_plan_cache.max_size.')
+
+    @property
+    def max_size(self):
+        return torch._mkl_fft_get_plan_cache_max_size()
+
+    @max_size.setter
+    def max_size(self, value):
+        torch._mkl_fft_set_plan_cache_max_size(value)
+
+    def clear(self):
+        return torch._mkl_fft_clear_plan_cache()
+
+
+class MklModule(object):
+    def __init__(self, m):
+        self.__dict__ = m.__dict__
+        # You have to retain the old module, otherwise it will
+        # get GC'ed and a lot of things will break.  See:
+        # https://stackoverflow.com/questions/47540722/how-do-i-use-the-sys-modules-replacement-trick-in-init-py-on-python-2
+        self.__old_mod = m
+
+    fft_plan_cache = MklFFTPlanCache()
+
+# This is the sys.modules replacement trick, see
+# https://stackoverflow.com/questions/2447353/getattr-on-a-module/7668273#7668273
+sys.modules[__name__] = MklModule(sys.modules[__name__])
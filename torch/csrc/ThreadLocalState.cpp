@@ -23,6 +23,15 @@ ThreadLocalState::ThreadLocalState(
     : grad_mode_enabled_(grad_mode_enabled) {}
 #endif
 
+bool operator==(const ThreadLocalState& lhs, const ThreadLocalState& rhs) {
+#ifdef USE_DISTRIBUTED
+  if (lhs.dist_autograd_context_id_ != rhs.dist_autograd_context_id_) {
+    return false;
+  }
+#endif
+  return lhs.grad_mode_enabled_ == rhs.grad_mode_enabled_;
+}
+
 ThreadLocalState ThreadLocalState::getThreadLocalState() {
   int64_t dist_autograd_context_id = -1;
 #ifdef USE_DISTRIBUTED
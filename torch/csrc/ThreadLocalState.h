@@ -13,27 +13,45 @@ class ThreadLocalState {
   static void setThreadLocalState(const ThreadLocalState& state);
 
  private:
+  friend bool operator==(
+      const ThreadLocalState& lhs,
+      const ThreadLocalState& rhs);
+
   bool grad_mode_enabled_;
 #ifdef USE_DISTRIBUTED
   int64_t dist_autograd_context_id_;
 #endif
 };
 
+// Returns true if the two snapshots would restore identical thread local
+// values, i.e. setting one while the other is active is a no-op.
+bool operator==(const ThreadLocalState& lhs, const ThreadLocalState& rhs);
+
 // Guard to set and reset the appropriate thread local state for JIT
 // interpreter continuations.
 class ThreadLocalStateGuard {
  public:
   explicit ThreadLocalStateGuard(const ThreadLocalState& state)
-      : prev_state_(ThreadLocalState::getThreadLocalState()) {
-    ThreadLocalState::setThreadLocalState(state);
+      : prev_state_(ThreadLocalState::getThreadLocalState()),
+        // In the common case the thread picking up a task already agrees
+        // with the launching thread on all tracked thread locals (grad mode
+        // enabled, no distributed autograd context), so both setting the
+        // state here and restoring it in the destructor are skipped.
+        need_restore_(!(prev_state_ == state)) {
+    if (need_restore_) {
+      ThreadLocalState::setThreadLocalState(state);
+    }
   }
 
   ~ThreadLocalStateGuard() {
-    ThreadLocalState::setThreadLocalState(prev_state_);
+    if (need_restore_) {
+      ThreadLocalState::setThreadLocalState(prev_state_);
+    }
   }
 
  private:
   ThreadLocalState prev_state_;
+  bool need_restore_;
 };
 
 } // namespace torch
@@ -4,6 +4,7 @@
 #include <torch/csrc/utils/memory.h>
 #include <torch/data/datasets/stateful.h>
 #include <torch/data/samplers.h>
+#include <deque>
 #include <queue>
 #include <thread>
 
@@ -64,6 +65,13 @@ class BatchDataBuffer {
   /// thread.
   BatchType get_batch() {
     std::unique_lock<std::mutex> lock(queue_mutex_);
+    // A miss means the consumer is about to stall on chunk loading; the
+    // hit/miss ratio tells how well prefetching keeps up with consumption.
+    if (total_example_count_in_queue_ >= batch_size_ || stop_) {
+      ++cache_hits_;
+    } else {
+      ++cache_misses_;
+    }
     cv_read_.wait(lock, [this] {
       // wait till there is available data in the queue or if all chunks are
       // loaded (i.e. the dataset is exhausted for this epoch)
@@ -105,6 +113,37 @@ class BatchDataBuffer {
       return;
     }
 
+    add_chunk_data_under_lock(std::move(data));
+    lock.unlock();
+    cv_read_.notify_all();
+  }
+
+  /// Non-blocking variant of add_chunk_data. Returns false without touching
+  /// the queue when it is at capacity (or contended), so the caller can keep
+  /// the chunk locally and read ahead instead of blocking on the consumer.
+  /// Called from the ChunkDataset worker threads.
+  bool try_add_chunk_data(UnwrappedBatchType& data) {
+    std::unique_lock<std::mutex> lock(queue_mutex_, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      return false;
+    }
+    if (stop_) {
+      // The chunk is discarded, matching the blocking path on stop.
+      return true;
+    }
+    if (total_example_count_in_queue_ >= queue_capacity_) {
+      return false;
+    }
+
+    add_chunk_data_under_lock(std::move(data));
+    lock.unlock();
+    cv_read_.notify_all();
+    return true;
+  }
+
+  /// Splits chunk data into batches and appends them to the queue. The
+  /// caller must hold queue_mutex_ and notify cv_read_ afterwards.
+  void add_chunk_data_under_lock(UnwrappedBatchType data) {
     auto data_size = data.size();
     auto remaining_size = data_size;
     example_sampler_.reset(data_size);
@@ -147,8 +186,6 @@ class BatchDataBuffer {
       batch_queue_.emplace(std::move(current_batch));
     }
     total_example_count_in_queue_ += data_size;
-    lock.unlock();
-    cv_read_.notify_all();
   }
 
   /// Push exceptions thrown during preloading into batch queue. Called from
@@ -195,6 +232,17 @@ class BatchDataBuffer {
     // notify all readers too.
     cv_read_.notify_all();
   }
+
+  /// Number of get_batch calls that found enough data already buffered.
+  size_t cache_hits() const {
+    return cache_hits_.load();
+  }
+
+  /// Number of get_batch calls that had to wait on chunk loading.
+  size_t cache_misses() const {
+    return cache_misses_.load();
+  }
+
   /// The batch size is needed to create batches from the chunk data. Similar to
   /// regular dataloader where the batches are created with prefetches,
   /// BatchDataBuffer perform the batch creation using the provided batch size.
@@ -233,6 +281,10 @@ class BatchDataBuffer {
   // configurable maximun number of elements the queue can hold at one time.
   size_t queue_capacity_;
 
+  // prefetch effectiveness counters, see cache_hits()/cache_misses().
+  std::atomic<size_t> cache_hits_{0};
+  std::atomic<size_t> cache_misses_{0};
+
   // When set to true, it wakes the writer threads from the wait and exit current
   // function call. This is needed when ChunkDataSet.Reset is called while the
   // previous epoch is not exhausted yet. When ChunkDataset is waiting its
@@ -250,11 +302,13 @@ struct ChunkDatasetOptions {
       size_t preloader_count,
       size_t batch_size,
       size_t cache_size = 2048,
-      size_t cross_chunk_shuffle_count = 1)
+      size_t cross_chunk_shuffle_count = 1,
+      size_t preload_depth = 2)
       : preloader_count_(preloader_count),
         batch_size_(batch_size),
         cache_size_(cache_size),
-        cross_chunk_shuffle_count_(cross_chunk_shuffle_count) {
+        cross_chunk_shuffle_count_(cross_chunk_shuffle_count),
+        preload_depth_(preload_depth) {
     TORCH_CHECK(
         preloader_count_ > 0,
         "Preloader count is 0. At least one preloader needs to be specified.");
@@ -271,6 +325,9 @@ struct ChunkDatasetOptions {
     TORCH_CHECK(
         cross_chunk_shuffle_count_ > 0,
         "cross_chunk_shuffle_count needs to be greater than 0.");
+    TORCH_CHECK(
+        preload_depth_ > 0,
+        "preload_depth needs to be greater than 0.");
   }
 
   /// The number of worker thread to preload chunk data.
@@ -292,6 +349,14 @@ struct ChunkDatasetOptions {
   // penalty when this value is greater than 1, as we need to do extra merge
   // between multiple chunks before performing example sampling.
   TORCH_ARG(size_t, cross_chunk_shuffle_count) = 1;
+
+  // The number of chunk loads each preloader may have in flight ahead of the
+  // consumer. With the default of 2, a worker whose finished chunk does not
+  // yet fit into the batch buffer keeps reading the next chunk (chunk N+2
+  // while N is consumed) instead of blocking on the buffer; larger values
+  // hide longer storage stalls at the cost of holding more chunks in memory
+  // per worker.
+  TORCH_ARG(size_t, preload_depth) = 2;
 };
 
 /// A stateful dataset that support hierarchical sampling and prefetching of
@@ -410,6 +475,19 @@ class ChunkDataset final
     return chunk_sampler_;
   }
 
+  /// Number of get_batch calls in the current epoch that were served from
+  /// already-buffered data.
+  size_t cache_hits() const {
+    return batch_buffer_ ? batch_buffer_->cache_hits() : 0;
+  }
+
+  /// Number of get_batch calls in the current epoch that had to wait on
+  /// chunk loading. A high miss count means chunk reads are not keeping up
+  /// with consumption; raise preloader_count or preload_depth.
+  size_t cache_misses() const {
+    return batch_buffer_ ? batch_buffer_->cache_misses() : 0;
+  }
+
   void save(serialize::OutputArchive& archive) const override {
     std::lock_guard<std::mutex> lock(chunk_index_guard_);
     chunk_sampler_.save(archive);
@@ -424,28 +502,53 @@ class ChunkDataset final
  private:
   /// running on worker thread to preload chunk data.
   void preloader(size_t id) {
+    // Chunks this worker has finished reading but not yet handed to the
+    // batch buffer. The worker owns this list exclusively (no locking), so
+    // a full batch buffer does not block the next read: finished chunks are
+    // parked here and the worker keeps reading ahead from (possibly slow)
+    // storage, up to options_.preload_depth() chunks in flight.
+    std::deque<UnwrappedBatchType> pending;
+    bool chunks_remaining = true;
     while (!quit_worker_.load()) {
       try {
-        std::vector<size_t> chunk_idx;
-        {
-          std::lock_guard<std::mutex> lock(chunk_index_guard_);
-          if (auto chunk_sampler_result = chunk_sampler_.next(this->options_.cross_chunk_shuffle_count())) {
-            chunk_idx = chunk_sampler_result.value();
-          } else {
-            break;
-          }
-        }
-        UnwrappedBatchType data = chunk_reader_.read_chunk(chunk_idx[0]);
-        for (size_t i = 1; i < chunk_idx.size(); ++i) {
-          auto chunk_data = chunk_reader_.read_chunk(chunk_idx[i]);
-          std::move(
-              chunk_data.begin(), chunk_data.end(), std::back_inserter(data));
-        }
-        if (preprocessing_policy_) {
-          preprocessing_policy_(data);
+        // Opportunistically hand over finished chunks the consumer has made
+        // room for, without blocking the read-ahead.
+        while (!pending.empty() &&
+               batch_buffer_->try_add_chunk_data(pending.front())) {
+          pending.pop_front();
         }
-        if (!data.empty()) { // skip empty chunks.
-          batch_buffer_->add_chunk_data(std::move(data));
+        if (chunks_remaining && pending.size() < options_.preload_depth()) {
+          // Sample and read the next chunk while earlier ones are consumed.
+          std::vector<size_t> chunk_idx;
+          {
+            std::lock_guard<std::mutex> lock(chunk_index_guard_);
+            if (auto chunk_sampler_result = chunk_sampler_.next(this->options_.cross_chunk_shuffle_count())) {
+              chunk_idx = chunk_sampler_result.value();
+            } else {
+              chunks_remaining = false;
+              continue;
+            }
+          }
+          UnwrappedBatchType data = chunk_reader_.read_chunk(chunk_idx[0]);
+          for (size_t i = 1; i < chunk_idx.size(); ++i) {
+            auto chunk_data = chunk_reader_.read_chunk(chunk_idx[i]);
+            std::move(
+                chunk_data.begin(), chunk_data.end(), std::back_inserter(data));
+          }
+          if (preprocessing_policy_) {
+            preprocessing_policy_(data);
+          }
+          if (!data.empty()) { // skip empty chunks.
+            pending.push_back(std::move(data));
+          }
+        } else if (!pending.empty()) {
+          // The read-ahead budget is exhausted (or no chunks are left to
+          // read); block until the consumer makes room for the oldest chunk.
+          batch_buffer_->add_chunk_data(std::move(pending.front()));
+          pending.pop_front();
+        } else {
+          // Nothing left to read and nothing pending.
+          break;
         }
       } catch (...) {
         batch_buffer_->add_chunk_data(std::current_exception());
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <torch/types.h>
+
+#include <c10/core/Allocator.h>
+
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// An allocator that hands out CPU memory backed by named, refcounted
+/// shared-memory segments — the same kind of segment `Tensor.share_memory_()`
+/// moves a storage into.
+///
+/// Batches that DataLoader workers produce into this memory can be handed to
+/// other processes on the same machine (through `torch.multiprocessing` or
+/// the RPC shared-memory transport) by segment handle rather than by copying
+/// the bytes, since the storage already lives in a named segment. A segment
+/// stays alive until the last attachment, local or remote, drops.
+///
+/// Segments are deliberately not pooled for reuse: a remote process may still
+/// be attached to a segment after the producer releases it, and that is not
+/// observable from here, so recycling a segment could clobber bytes a
+/// consumer is still reading.
+class TORCH_API SharedMemoryArena : public c10::Allocator {
+ public:
+  /// Returns the process-wide arena instance.
+  static SharedMemoryArena& get();
+
+  /// Maps a fresh shared-memory segment of `n` bytes.
+  at::DataPtr allocate(size_t n) const override;
+};
+
+/// Returns an uninitialized, contiguous CPU tensor of the given shape whose
+/// storage is allocated from the `SharedMemoryArena`.
+TORCH_API Tensor empty_shared_memory(
+    at::IntArrayRef sizes,
+    const at::TensorOptions& options = {});
+
+/// Stacks `tensors` along a new leading dimension into a tensor allocated
+/// from the `SharedMemoryArena`. All tensors must be CPU tensors of the same
+/// shape and dtype.
+TORCH_API Tensor stack_shared_memory(const std::vector<Tensor>& tensors);
+
+} // namespace detail
+} // namespace data
+} // namespace torch
@@ -0,0 +1,261 @@
+#pragma once
+
+#include <torch/arg.h>
+#include <torch/data/example.h>
+#include <torch/data/iterator.h>
+#include <torch/types.h>
+
+#include <torch/csrc/utils/memory.h>
+
+#include <c10/core/Event.h>
+#include <c10/core/Stream.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace torch {
+namespace data {
+namespace detail {
+
+/// Moves a tensor to `device` with an asynchronous copy. CPU sources are
+/// pinned first, since only page-locked memory makes the copy truly
+/// asynchronous with respect to the host.
+inline Tensor to_device_async(Tensor tensor, Device device) {
+  if (!tensor.defined() || tensor.device() == device) {
+    return tensor;
+  }
+  if (tensor.device().is_cpu() && !tensor.is_pinned()) {
+    tensor = tensor.pin_memory();
+  }
+  return tensor.to(device, /*non_blocking=*/true);
+}
+
+inline Example<> to_device_async(Example<> example, Device device) {
+  return {to_device_async(std::move(example.data), device),
+          to_device_async(std::move(example.target), device)};
+}
+
+inline TensorExample to_device_async(TensorExample example, Device device) {
+  return TensorExample(to_device_async(std::move(example.data), device));
+}
+
+template <typename T>
+std::vector<T> to_device_async(std::vector<T> batch, Device device) {
+  for (auto& item : batch) {
+    item = to_device_async(std::move(item), device);
+  }
+  return batch;
+}
+} // namespace detail
+
+/// Options to configure a `DevicePrefetcher`.
+struct DevicePrefetchOptions {
+  DevicePrefetchOptions() = default;
+
+  /// The number of batches to keep resident on the device ahead of
+  /// consumption.
+  TORCH_ARG(size_t, depth) = 2;
+
+  /// The stream the host-to-device copies are issued on. Pass a stream from
+  /// the device's pool (e.g. `at::cuda::getStreamFromPool()`) so that copies
+  /// overlap with compute on the main stream; defaults to the prefetch
+  /// thread's current stream.
+  TORCH_ARG(optional<c10::Stream>, stream);
+};
+
+/// A pipeline stage that wraps a `DataLoader` and keeps a configurable number
+/// of batches resident on a target device ahead of the training loop.
+///
+/// A background thread pulls batches from the wrapped loader, pins their
+/// tensors, and issues asynchronous copies on the configured stream, recording
+/// an event per batch. `next()` makes the consumer's current stream wait on
+/// that event, so compute enqueued afterwards overlaps with the copies of the
+/// batches behind it.
+///
+/// Like the `DataLoader` itself, a new iteration may only be started once the
+/// previous one is exhausted.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto loader = torch::data::make_data_loader(std::move(dataset), options);
+///   auto prefetcher =
+///       torch::data::make_device_prefetcher(*loader, torch::kCUDA);
+///   for (auto& batch : *prefetcher) {
+///     // batch.data / batch.target already live on the GPU.
+///   }
+/// \endrst
+template <typename DataLoader>
+class DevicePrefetcher {
+ public:
+  using BatchType = typename DataLoader::BatchType;
+
+  DevicePrefetcher(
+      DataLoader& loader,
+      Device device,
+      DevicePrefetchOptions options = {})
+      : loader_(loader), device_(device), options_(std::move(options)) {
+    TORCH_CHECK(
+        this->options_.depth() > 0, "DevicePrefetcher depth must be positive");
+  }
+
+  ~DevicePrefetcher() {
+    join();
+  }
+
+  /// Starts the prefetch thread and returns an iterator over device-resident
+  /// batches. The iterator has the same semantics as the `DataLoader`'s own.
+  Iterator<BatchType> begin() {
+    join();
+    worker_ = std::thread([this] { this->worker_thread(); });
+    return Iterator<BatchType>(
+        torch::make_unique<detail::ValidIterator<BatchType>>(
+            [this] { return this->next(); }));
+  }
+
+  /// Returns a sentinel iterator that compares equal with a non-sentinel
+  /// iterator once the wrapped `DataLoader` is exhausted.
+  Iterator<BatchType> end() {
+    return Iterator<BatchType>(
+        torch::make_unique<detail::SentinelIterator<BatchType>>());
+  }
+
+  /// Stops the prefetch thread and discards any batches in flight. Copies of
+  /// discarded batches may still be executing on the copy stream; their
+  /// events keep the underlying memory alive until they complete.
+  void join() {
+    if (!worker_.joinable()) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+      buffer_.clear();
+    }
+    not_full_.notify_all();
+    worker_.join();
+    std::lock_guard<std::mutex> lock(mutex_);
+    quit_ = false;
+    buffer_.clear();
+  }
+
+ private:
+  /// A transferred batch together with the event marking the completion of
+  /// its copies, or an end-of-epoch/exception marker.
+  struct Result {
+    Result() = default;
+    Result(BatchType&& b, optional<c10::Event>&& e)
+        : batch(std::move(b)), event(std::move(e)) {}
+    optional<BatchType> batch;
+    optional<c10::Event> event;
+    std::exception_ptr exception;
+  };
+
+  optional<BatchType> next() {
+    Result result = pop();
+    if (result.exception) {
+      join();
+      std::rethrow_exception(result.exception);
+    }
+    if (!result.batch) {
+      join();
+      return nullopt;
+    }
+    if (result.event) {
+      // Compute enqueued on the consumer's stream after this point runs only
+      // once the batch's copies are done, without a host synchronization.
+      c10::impl::VirtualGuardImpl impl(device_.type());
+      result.event->block(impl.getStream(device_));
+    }
+    return std::move(result.batch);
+  }
+
+  void worker_thread() {
+    try {
+      auto iterator = loader_.begin();
+      auto sentinel = loader_.end();
+      while (!quit_.load() && iterator != sentinel) {
+        push(transfer(std::move(*iterator)));
+        ++iterator;
+      }
+      push(Result());
+    } catch (...) {
+      Result result;
+      result.exception = std::current_exception();
+      push(std::move(result));
+    }
+  }
+
+  Result transfer(BatchType batch) {
+    if (device_.is_cpu()) {
+      // Nothing to copy; pass the batch through without pinning or events.
+      return {std::move(batch), nullopt};
+    }
+    c10::impl::VirtualGuardImpl impl(device_.type());
+    const auto stream = options_.stream().value_or(impl.getStream(device_));
+    c10::StreamGuard guard(stream);
+    batch = detail::to_device_async(std::move(batch), device_);
+    c10::Event event(device_.type());
+    event.record(stream);
+    return {std::move(batch), std::move(event)};
+  }
+
+  /// Blocks while `depth` many batches are already in flight, bounding the
+  /// device memory held by prefetched batches.
+  void push(Result result) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] {
+      return buffer_.size() < options_.depth() || quit_.load();
+    });
+    if (quit_.load()) {
+      return;
+    }
+    buffer_.push_back(std::move(result));
+    lock.unlock();
+    not_empty_.notify_one();
+  }
+
+  Result pop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !buffer_.empty(); });
+    Result result = std::move(buffer_.front());
+    buffer_.pop_front();
+    lock.unlock();
+    not_full_.notify_one();
+    return result;
+  }
+
+  DataLoader& loader_;
+  const Device device_;
+  const DevicePrefetchOptions options_;
+
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::deque<Result> buffer_;
+  std::atomic<bool> quit_{false};
+  std::thread worker_;
+};
+
+/// Creates a `DevicePrefetcher` for the given `DataLoader`, deducing the
+/// loader type. The prefetcher holds a reference to the loader, which must
+/// outlive it.
+template <typename DataLoader>
+std::unique_ptr<DevicePrefetcher<DataLoader>> make_device_prefetcher(
+    DataLoader& loader,
+    Device device,
+    DevicePrefetchOptions options = {}) {
+  return torch::make_unique<DevicePrefetcher<DataLoader>>(
+      loader, device, std::move(options));
+}
+} // namespace data
+} // namespace torch
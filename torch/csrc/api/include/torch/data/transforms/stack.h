@@ -1,5 +1,6 @@
 #pragma once
 
+#include <torch/data/detail/shared_memory_arena.h>
 #include <torch/data/example.h>
 #include <torch/data/transforms/collate.h>
 #include <torch/types.h>
@@ -44,6 +45,43 @@ struct Stack<TensorExample>
     return torch::stack(data);
   }
 };
+
+template <typename T = Example<>>
+struct SharedMemoryStack;
+
+/// Like `Stack`, but collates into tensors whose storage is allocated from
+/// the `detail::SharedMemoryArena`. Within one process this behaves exactly
+/// like `Stack` — batches already move across the DataLoader queues without
+/// copies — but a batch collated this way can be handed to other processes on
+/// the same machine by segment handle instead of by copying the bytes.
+template <>
+struct SharedMemoryStack<Example<>> : public Collation<Example<>> {
+  Example<> apply_batch(std::vector<Example<>> examples) override {
+    std::vector<torch::Tensor> data, targets;
+    data.reserve(examples.size());
+    targets.reserve(examples.size());
+    for (auto& example : examples) {
+      data.push_back(std::move(example.data));
+      targets.push_back(std::move(example.target));
+    }
+    return {detail::stack_shared_memory(data),
+            detail::stack_shared_memory(targets)};
+  }
+};
+
+/// A `SharedMemoryStack` for `Example<Tensor, NoTarget>` types.
+template <>
+struct SharedMemoryStack<TensorExample>
+    : public Collation<Example<Tensor, example::NoTarget>> {
+  TensorExample apply_batch(std::vector<TensorExample> examples) override {
+    std::vector<torch::Tensor> data;
+    data.reserve(examples.size());
+    for (auto& example : examples) {
+      data.push_back(std::move(example.data));
+    }
+    return detail::stack_shared_memory(data);
+  }
+};
 } // namespace transforms
 } // namespace data
 } // namespace torch
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <c10/core/Allocator.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace torch {
+namespace nn {
+namespace utils {
+
+/// Serves the CPU tensor allocations of an inference forward from one
+/// preallocated arena instead of hitting the allocator per intermediate.
+///
+/// A recorded warmup forward measures the peak number of live bytes; the
+/// workspace then preallocates a slab of that size and later guarded
+/// forwards bump-allocate from it, resetting the cursor once all arena
+/// tensors from the previous forward have been released. Allocations that
+/// do not fit (e.g. after a shape change) silently fall back to the
+/// regular CPU allocator, so a guarded forward is always correct, just
+/// not always allocator-free. See NOTE [ Inference workspace arena ] in
+/// inference_workspace.cpp.
+///
+/// The guards swap the process-wide CPU allocator, so they assume the
+/// usual single-threaded inference loop; hold any tensor that must
+/// outlive the next forward (such as the output) via `.clone()` taken
+/// outside the guard, or release it before the next guard is entered.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   torch::NoGradGuard no_grad;
+///   torch::nn::utils::InferenceWorkspace workspace;
+///   {
+///     torch::nn::utils::InferenceWorkspace::RecordGuard record(workspace);
+///     model->forward(input);  // warmup, captures the peak size
+///   }
+///   for (;;) {
+///     torch::nn::utils::InferenceWorkspace::Guard guard(workspace);
+///     auto output = model->forward(input);
+///     consume(output);  // before the next guard
+///   }
+/// \endrst
+class TORCH_API InferenceWorkspace {
+ public:
+  InferenceWorkspace();
+  ~InferenceWorkspace();
+
+  InferenceWorkspace(const InferenceWorkspace&) = delete;
+  InferenceWorkspace& operator=(const InferenceWorkspace&) = delete;
+
+  /// Whether a warmup forward has been recorded.
+  bool recorded() const noexcept;
+
+  /// Size of the preallocated arena in bytes; zero before recording.
+  size_t capacity() const noexcept;
+
+  /// Installs the workspace allocator in recording mode; on destruction
+  /// the arena is sized to the observed peak and preallocated.
+  class TORCH_API RecordGuard {
+   public:
+    explicit RecordGuard(InferenceWorkspace& workspace);
+    ~RecordGuard();
+    RecordGuard(const RecordGuard&) = delete;
+    RecordGuard& operator=(const RecordGuard&) = delete;
+
+   private:
+    InferenceWorkspace& workspace_;
+    at::Allocator* previous_;
+  };
+
+  /// Installs the workspace allocator in serving mode for one forward.
+  class TORCH_API Guard {
+   public:
+    explicit Guard(InferenceWorkspace& workspace);
+    ~Guard();
+    Guard(const Guard&) = delete;
+    Guard& operator=(const Guard&) = delete;
+
+   private:
+    InferenceWorkspace& workspace_;
+    at::Allocator* previous_;
+  };
+
+ private:
+  friend struct WorkspaceAllocator;
+
+  enum class Mode { Idle, Recording, Serving };
+
+  std::atomic<Mode> mode_{Mode::Idle};
+
+  // recording state: live bytes and their high-water mark
+  std::atomic<size_t> live_bytes_{0};
+  std::atomic<size_t> peak_bytes_{0};
+
+  // serving state: the slab, the bump cursor and the number of arena
+  // allocations still alive
+  void* slab_ = nullptr;
+  size_t capacity_ = 0;
+  std::atomic<size_t> offset_{0};
+  std::atomic<size_t> arena_live_{0};
+
+  std::unique_ptr<at::Allocator> allocator_;
+};
+
+} // namespace utils
+} // namespace nn
+} // namespace torch
@@ -0,0 +1,87 @@
+#include <torch/data/detail/shared_memory_arena.h>
+
+#include <TH/THAllocator.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace torch {
+namespace data {
+namespace detail {
+namespace {
+// Mirrors the handle scheme of torch.multiprocessing's file_system sharing
+// strategy: unique per process and per allocation.
+std::string newSegmentHandle() {
+  static std::atomic<uint64_t> counter{0};
+  std::string handle = "/torch_data_";
+#ifdef _WIN32
+  handle += std::to_string(GetCurrentProcessId());
+#else
+  handle += std::to_string(getpid());
+#endif
+  handle += "_";
+  handle += std::to_string(counter++);
+  return handle;
+}
+} // namespace
+
+SharedMemoryArena& SharedMemoryArena::get() {
+  static SharedMemoryArena arena;
+  return arena;
+}
+
+at::DataPtr SharedMemoryArena::allocate(size_t n) const {
+  const auto handle = newSegmentHandle();
+  return THRefcountedMapAllocator::makeDataPtr(
+      handle.c_str(),
+      TH_ALLOCATOR_MAPPED_SHAREDMEM | TH_ALLOCATOR_MAPPED_EXCLUSIVE,
+      n,
+      /*actual_size_out=*/nullptr);
+}
+
+Tensor empty_shared_memory(
+    at::IntArrayRef sizes,
+    const at::TensorOptions& options) {
+  TORCH_CHECK(
+      options.device().is_cpu(),
+      "empty_shared_memory only supports CPU tensors, got device ",
+      options.device());
+  int64_t numel = 1;
+  std::vector<int64_t> strides(sizes.size());
+  for (int64_t i = static_cast<int64_t>(sizes.size()) - 1; i >= 0; --i) {
+    strides[i] = numel;
+    numel *= sizes[i];
+  }
+  const auto dtype = options.dtype();
+  auto& arena = SharedMemoryArena::get();
+  c10::Storage storage(
+      dtype,
+      numel,
+      arena.allocate(numel * dtype.itemsize()),
+      &arena,
+      /*resizable=*/false);
+  return torch::empty({0}, options).set_(std::move(storage), 0, sizes, strides);
+}
+
+Tensor stack_shared_memory(const std::vector<Tensor>& tensors) {
+  TORCH_CHECK(
+      !tensors.empty(), "stack_shared_memory expects a non-empty tensor list");
+  std::vector<int64_t> sizes;
+  sizes.reserve(tensors.front().dim() + 1);
+  sizes.push_back(static_cast<int64_t>(tensors.size()));
+  for (auto size : tensors.front().sizes()) {
+    sizes.push_back(size);
+  }
+  auto batch = empty_shared_memory(sizes, tensors.front().options());
+  torch::stack_out(batch, tensors, /*dim=*/0);
+  return batch;
+}
+
+} // namespace detail
+} // namespace data
+} // namespace torch
@@ -0,0 +1,200 @@
+#include <torch/nn/utils/inference_workspace.h>
+
+#include <c10/core/CPUAllocator.h>
+#include <c10/util/Exception.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace torch {
+namespace nn {
+namespace utils {
+
+// NOTE [ Inference workspace arena ]
+//
+// A fixed-shape inference forward allocates the same set of intermediate
+// activations every time, and at a 3ms-per-forward scale the allocator
+// traffic for them is measurable. The workspace removes it in two phases:
+//
+//  - Recording: allocations go through alloc_cpu as usual, but every
+//    allocation carries a small header so frees can be attributed, and
+//    the workspace tracks live bytes and their high-water mark. When the
+//    RecordGuard ends, a slab of the peak size is preallocated.
+//
+//  - Serving: allocations are bump-allocated from the slab. The cursor
+//    resets at Guard entry once every arena allocation from the previous
+//    forward has been freed; if some still live (e.g. the caller kept the
+//    output tensor), or a request does not fit (shape change), the
+//    allocation falls back to alloc_cpu. Guarded forwards are therefore
+//    always correct and at worst only as fast as unguarded ones.
+//
+// Every block -- arena or fallback -- is preceded by a kHeaderBytes
+// header holding the owning workspace, the block size and its origin, so
+// a single deleter can route frees without any lookup table. kHeaderBytes
+// is one allocator alignment unit, which keeps the data pointer aligned
+// exactly as alloc_cpu would.
+namespace {
+
+constexpr size_t kAlignment = 64;
+constexpr size_t kHeaderBytes = kAlignment;
+
+struct Header {
+  InferenceWorkspace* workspace;
+  size_t size;
+  bool from_arena;
+};
+
+static_assert(sizeof(Header) <= kHeaderBytes, "Header must fit its slot");
+
+size_t align_up(size_t n) {
+  return (n + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+} // namespace
+
+struct WorkspaceAllocator final : public at::Allocator {
+  explicit WorkspaceAllocator(InferenceWorkspace* workspace)
+      : workspace_(workspace) {}
+
+  static void deleter(void* ctx) {
+    if (ctx == nullptr) {
+      return;
+    }
+    auto* header = static_cast<Header*>(ctx);
+    InferenceWorkspace* workspace = header->workspace;
+    if (header->from_arena) {
+      workspace->arena_live_.fetch_sub(1, std::memory_order_acq_rel);
+    } else {
+      workspace->live_bytes_.fetch_sub(
+          header->size, std::memory_order_relaxed);
+      c10::free_cpu(ctx);
+    }
+  }
+
+  at::DataPtr allocate(size_t n) const override {
+    if (n == 0) {
+      return at::DataPtr(nullptr, nullptr, &deleter, at::DeviceType::CPU);
+    }
+    const auto mode = workspace_->mode_.load(std::memory_order_relaxed);
+    if (mode == InferenceWorkspace::Mode::Serving) {
+      const size_t bytes = kHeaderBytes + align_up(n);
+      size_t begin =
+          workspace_->offset_.fetch_add(bytes, std::memory_order_relaxed);
+      if (begin + bytes <= workspace_->capacity_) {
+        auto* header = reinterpret_cast<Header*>(
+            static_cast<char*>(workspace_->slab_) + begin);
+        header->workspace = workspace_;
+        header->size = n;
+        header->from_arena = true;
+        workspace_->arena_live_.fetch_add(1, std::memory_order_acq_rel);
+        return at::DataPtr(
+            reinterpret_cast<char*>(header) + kHeaderBytes,
+            header,
+            &deleter,
+            at::DeviceType::CPU);
+      }
+      // Does not fit (shape change or previous forward's tensors still
+      // alive); undo the bump and fall through to the regular allocator.
+      workspace_->offset_.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+    auto* header = static_cast<Header*>(c10::alloc_cpu(kHeaderBytes + n));
+    header->workspace = workspace_;
+    header->size = n;
+    header->from_arena = false;
+    const size_t live = workspace_->live_bytes_.fetch_add(
+                            n, std::memory_order_relaxed) +
+        n;
+    if (mode == InferenceWorkspace::Mode::Recording) {
+      size_t peak = workspace_->peak_bytes_.load(std::memory_order_relaxed);
+      while (live > peak &&
+             !workspace_->peak_bytes_.compare_exchange_weak(
+                 peak, live, std::memory_order_relaxed)) {
+      }
+    }
+    return at::DataPtr(
+        reinterpret_cast<char*>(header) + kHeaderBytes,
+        header,
+        &deleter,
+        at::DeviceType::CPU);
+  }
+
+  at::DeleterFnPtr raw_deleter() const override {
+    return &deleter;
+  }
+
+ private:
+  InferenceWorkspace* workspace_;
+};
+
+InferenceWorkspace::InferenceWorkspace()
+    : allocator_(new WorkspaceAllocator(this)) {}
+
+InferenceWorkspace::~InferenceWorkspace() {
+  if (slab_ != nullptr) {
+    TORCH_CHECK(
+        arena_live_.load() == 0,
+        "InferenceWorkspace destroyed while tensors allocated from its "
+        "arena are still alive");
+    c10::free_cpu(slab_);
+  }
+}
+
+bool InferenceWorkspace::recorded() const noexcept {
+  return capacity_ != 0;
+}
+
+size_t InferenceWorkspace::capacity() const noexcept {
+  return capacity_;
+}
+
+InferenceWorkspace::RecordGuard::RecordGuard(InferenceWorkspace& workspace)
+    : workspace_(workspace) {
+  TORCH_CHECK(
+      workspace_.mode_.load() == Mode::Idle,
+      "InferenceWorkspace guards cannot be nested");
+  workspace_.live_bytes_.store(0);
+  workspace_.peak_bytes_.store(0);
+  previous_ = c10::GetCPUAllocator();
+  workspace_.mode_.store(Mode::Recording);
+  c10::SetCPUAllocator(workspace_.allocator_.get());
+}
+
+InferenceWorkspace::RecordGuard::~RecordGuard() {
+  c10::SetCPUAllocator(previous_);
+  workspace_.mode_.store(Mode::Idle);
+  if (workspace_.slab_ != nullptr) {
+    c10::free_cpu(workspace_.slab_);
+    workspace_.slab_ = nullptr;
+  }
+  // Per-allocation headers and bump alignment make the served blocks a
+  // little larger than the raw bytes observed, so leave room for them.
+  const size_t peak = workspace_.peak_bytes_.load();
+  workspace_.capacity_ = align_up(peak + peak / 8) + kHeaderBytes;
+  workspace_.slab_ = c10::alloc_cpu(workspace_.capacity_);
+  workspace_.offset_.store(0);
+}
+
+InferenceWorkspace::Guard::Guard(InferenceWorkspace& workspace)
+    : workspace_(workspace) {
+  TORCH_CHECK(
+      workspace_.recorded(),
+      "InferenceWorkspace must record a warmup forward before serving");
+  TORCH_CHECK(
+      workspace_.mode_.load() == Mode::Idle,
+      "InferenceWorkspace guards cannot be nested");
+  if (workspace_.arena_live_.load(std::memory_order_acquire) == 0) {
+    workspace_.offset_.store(0, std::memory_order_relaxed);
+  }
+  previous_ = c10::GetCPUAllocator();
+  workspace_.mode_.store(Mode::Serving);
+  c10::SetCPUAllocator(workspace_.allocator_.get());
+}
+
+InferenceWorkspace::Guard::~Guard() {
+  c10::SetCPUAllocator(previous_);
+  workspace_.mode_.store(Mode::Idle);
+}
+
+} // namespace utils
+} // namespace nn
+} // namespace torch
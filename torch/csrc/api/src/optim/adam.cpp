@@ -68,6 +68,28 @@ Tensor Adam::step(LossClosure closure)  {
     loss = closure();
   }
   for (auto& group : param_groups_) {
+    auto& options = static_cast<AdamOptions&>(group.options());
+    auto beta1 = std::get<0>(options.betas());
+    auto beta2 = std::get<1>(options.betas());
+
+    // Bucket the parameters by device, dtype and step count so that each
+    // bucket can be updated with a handful of _foreach_* calls over whole
+    // tensor lists instead of several elementwise ops per parameter. The
+    // step count is part of the key because the bias corrections depend on
+    // it, and it can differ between parameters (e.g. a parameter whose
+    // gradient was undefined in an earlier step).
+    struct Bucket {
+      at::Device device;
+      at::ScalarType dtype;
+      int64_t step;
+      std::vector<Tensor> params;
+      std::vector<Tensor> grads;
+      std::vector<Tensor> exp_avgs;
+      std::vector<Tensor> exp_avg_sqs;
+      std::vector<Tensor> max_exp_avg_sqs;
+    };
+    std::vector<Bucket> buckets;
+
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
@@ -75,7 +97,6 @@ Tensor Adam::step(LossClosure closure)  {
       auto grad = p.grad();
       TORCH_CHECK(!grad.is_sparse(), "Adam does not support sparse gradients"/*, please consider SparseAdam instead*/);
       auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
-      auto& options = static_cast<AdamOptions&>(group.options());
 
       // State initialization
       if(param_state == state_.end()) {
@@ -93,37 +114,63 @@ Tensor Adam::step(LossClosure closure)  {
       }
 
       auto& state = static_cast<AdamParamState&>(*state_[c10::guts::to_string(p.unsafeGetTensorImpl())]);
-      auto& exp_avg = state.exp_avg();
-      auto& exp_avg_sq = state.exp_avg_sq();
-      auto& max_exp_avg_sq = state.max_exp_avg_sq();
-
       state.step(state.step()+1);
-      auto beta1 = std::get<0>(options.betas());
-      auto beta2 = std::get<1>(options.betas());
 
-      auto bias_correction1 = 1 - std::pow(beta1, state.step());
-      auto bias_correction2 = 1 - std::pow(beta2, state.step());
+      Bucket* bucket = nullptr;
+      for (auto& entry : buckets) {
+        if (entry.device == p.device() && entry.dtype == p.scalar_type() &&
+            entry.step == state.step()) {
+          bucket = &entry;
+          break;
+        }
+      }
+      if (bucket == nullptr) {
+        buckets.push_back({p.device(), p.scalar_type(), state.step(), {}, {}, {}, {}, {}});
+        bucket = &buckets.back();
+      }
+      bucket->params.push_back(p);
+      bucket->grads.push_back(grad);
+      bucket->exp_avgs.push_back(state.exp_avg());
+      bucket->exp_avg_sqs.push_back(state.exp_avg_sq());
+      bucket->max_exp_avg_sqs.push_back(state.max_exp_avg_sq());
+    }
+
+    for (auto& bucket : buckets) {
+      auto bias_correction1 = 1 - std::pow(beta1, bucket.step);
+      auto bias_correction2 = 1 - std::pow(beta2, bucket.step);
 
+      auto grads = bucket.grads;
       if(options.weight_decay() != 0) {
-        grad = grad.add(p, options.weight_decay());
+        grads = torch::_foreach_add(grads, bucket.params, options.weight_decay());
       }
 
       // Decay the first and second moment running average coefficient
-      exp_avg.mul_(beta1).add_(grad, 1 - beta1);
-      exp_avg_sq.mul_(beta2).addcmul_(grad, grad, 1 - beta2);
+      torch::_foreach_mul_(bucket.exp_avgs, beta1);
+      torch::_foreach_add_(bucket.exp_avgs, grads, 1 - beta1);
+      torch::_foreach_mul_(bucket.exp_avg_sqs, beta2);
+      torch::_foreach_addcmul_(bucket.exp_avg_sqs, grads, grads, 1 - beta2);
 
-      Tensor denom;
+      std::vector<Tensor> denoms;
       if(options.amsgrad()) {
         // Maintains the maximum of all 2nd moment running avg. till now
-        torch::max_out(max_exp_avg_sq, exp_avg_sq, max_exp_avg_sq);
+        for (size_t i = 0; i < bucket.params.size(); i++) {
+          torch::max_out(bucket.max_exp_avg_sqs[i], bucket.exp_avg_sqs[i], bucket.max_exp_avg_sqs[i]);
+        }
         // Use the max. for normalizing running avg. of gradient
-        denom = (max_exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
+        denoms = torch::_foreach_sqrt(bucket.max_exp_avg_sqs);
       } else {
-        denom = (exp_avg_sq.sqrt() / sqrt(bias_correction2)).add_(options.eps());
+        denoms = torch::_foreach_sqrt(bucket.exp_avg_sqs);
       }
+      torch::_foreach_div_(denoms, sqrt(bias_correction2));
+      torch::_foreach_add_(denoms, options.eps());
 
       auto step_size = options.lr() / bias_correction1;
-      p.addcdiv_(exp_avg, denom, -step_size);
+      torch::_foreach_addcdiv_(bucket.params, bucket.exp_avgs, denoms, -step_size);
+      // The _foreach_ ops do not go through per-tensor VariableType wrappers,
+      // so bump the version counters ourselves like Tensor::addcdiv_ would.
+      for (const auto& p : bucket.params) {
+        torch::autograd::impl::bump_version(p);
+      }
     }
   }
   return loss;
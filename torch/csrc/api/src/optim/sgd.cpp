@@ -66,33 +66,82 @@ Tensor SGD::step(LossClosure closure)  {
     auto dampening = options.dampening();
     auto nesterov = options.nesterov();
 
+    // Bucket the parameters by device and dtype so that each bucket can be
+    // updated with a handful of _foreach_* calls over whole tensor lists
+    // instead of several elementwise ops per parameter.
+    std::vector<std::pair<std::pair<at::Device, at::ScalarType>, std::vector<Tensor>>> buckets;
+    auto bucket_for = [&buckets](const Tensor& p) -> std::vector<Tensor>& {
+      for (auto& entry : buckets) {
+        if (entry.first.first == p.device() && entry.first.second == p.scalar_type()) {
+          return entry.second;
+        }
+      }
+      buckets.emplace_back(
+          std::make_pair(p.device(), p.scalar_type()), std::vector<Tensor>());
+      return buckets.back().second;
+    };
     for (auto& p : group.params()) {
       if (!p.grad().defined()) {
         continue;
       }
-      auto d_p = p.grad().data();
+      bucket_for(p).push_back(p);
+    }
+
+    for (auto& entry : buckets) {
+      auto& params = entry.second;
+      std::vector<Tensor> params_data, d_ps;
+      params_data.reserve(params.size());
+      d_ps.reserve(params.size());
+      for (const auto& p : params) {
+        params_data.push_back(p.data());
+        d_ps.push_back(p.grad().data());
+      }
       if (weight_decay != 0) {
-        d_p = d_p.add(p.data(), weight_decay);
+        d_ps = torch::_foreach_add(d_ps, params_data, weight_decay);
       }
       if (momentum != 0) {
-        Tensor buf;
-        auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
-        if(param_state == state_.end()) {
-          buf = torch::clone(d_p).detach();
-          auto state = std::make_unique<SGDParamState>();
-          state->momentum_buffer(buf);
-          state_[c10::guts::to_string(p.unsafeGetTensorImpl())] = std::move(state);
-        } else {
-          buf = static_cast<SGDParamState&>(*param_state->second).momentum_buffer();
-          buf.mul_(momentum).add_(d_p, 1 - dampening);
+        std::vector<Tensor> bufs;
+        // Parameters whose momentum buffer already existed; freshly created
+        // buffers are initialized to d_p and must not be decayed below.
+        std::vector<size_t> with_state;
+        bufs.reserve(params.size());
+        for (size_t i = 0; i < params.size(); i++) {
+          const auto& p = params[i];
+          auto param_state = state_.find(c10::guts::to_string(p.unsafeGetTensorImpl()));
+          if(param_state == state_.end()) {
+            auto buf = torch::clone(d_ps[i]).detach();
+            auto state = std::make_unique<SGDParamState>();
+            state->momentum_buffer(buf);
+            state_[c10::guts::to_string(p.unsafeGetTensorImpl())] = std::move(state);
+            bufs.push_back(buf);
+          } else {
+            with_state.push_back(i);
+            bufs.push_back(static_cast<SGDParamState&>(*param_state->second).momentum_buffer());
+          }
+        }
+        if (!with_state.empty()) {
+          std::vector<Tensor> state_bufs, state_d_ps;
+          state_bufs.reserve(with_state.size());
+          state_d_ps.reserve(with_state.size());
+          for (auto i : with_state) {
+            state_bufs.push_back(bufs[i]);
+            state_d_ps.push_back(d_ps[i]);
+          }
+          torch::_foreach_mul_(state_bufs, momentum);
+          torch::_foreach_add_(state_bufs, state_d_ps, 1 - dampening);
         }
         if (nesterov) {
-          d_p = d_p.add(buf, momentum);
+          d_ps = torch::_foreach_add(d_ps, bufs, momentum);
         } else {
-          d_p = buf;
+          d_ps = std::move(bufs);
         }
       }
-      p.data().add_(d_p, -1 * options.lr());
+      torch::_foreach_add_(params_data, d_ps, -1 * options.lr());
+      // The _foreach_ ops do not go through per-tensor VariableType wrappers,
+      // so bump the version counters ourselves like Tensor::add_ would.
+      for (const auto& p : params) {
+        torch::autograd::impl::bump_version(p);
+      }
     }
   }
   return loss;
@@ -17,9 +17,15 @@
 #include <c10/util/Optional.h>
 #include <c10/core/StreamGuard.h>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -51,6 +57,32 @@ static void track_bad_autograd_forks() {
       flag, [&] { pthread_atfork(nullptr, nullptr, forked_autograd_child); });
 #endif
 }
+
+// Optionally pins each engine worker to a fixed CPU core so that a worker's
+// hot state (ready queue, input buffers) stays in one core's cache instead
+// of migrating under the kernel scheduler. Opt-in via
+// TORCH_AUTOGRAD_THREAD_AFFINITY=1 because a fixed core is the wrong choice
+// when the engine thread itself fans out intra-op work.
+static void maybe_pin_worker_thread(int queue_index) {
+#ifdef __linux__
+  const char* val = std::getenv("TORCH_AUTOGRAD_THREAD_AFFINITY");
+  if (val == nullptr || std::string(val) == "0") {
+    return;
+  }
+  unsigned num_cores = std::thread::hardware_concurrency();
+  if (num_cores == 0) {
+    return;
+  }
+  // CPU workers go on the first cores, device workers on successive ones
+  unsigned core = static_cast<unsigned>(queue_index) % num_cores;
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  CPU_SET(core, &cpuset);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuset);
+#else
+  (void)queue_index;
+#endif
+}
 }
 
 // Threads spawned by the engine are assigned a constant 'worker_device'
@@ -59,6 +91,11 @@ static void track_bad_autograd_forks() {
 // handling reentrant backwards calls; see Note [Reentrant backwards]
 static thread_local int worker_device = NO_DEVICE;
 
+// Index into ready_queues_ of the queue this worker thread services. Device
+// threads service the queue at num_cpu_queues_ + device; each CPU worker
+// thread services one CPU shard. See Note [CPU ready queue sharding]
+static thread_local int worker_queue_index = -1;
+
 // This variable is true if ALL invocations in the stack of re-entrant engine
 // invocations are imperative backwards. This special variable is needed for the
 // gradient checkpointing feature only.
@@ -100,6 +137,13 @@ struct ReadyQueue {
   std::condition_variable not_empty_;
   // To protect read and writes to heap_
   mutable std::mutex mutex_;
+  // Approximate heap size published outside the lock; lets a popping worker
+  // spin on an atomic load for a short while before falling back to the
+  // condition variable, and lets push skip the notify syscall when the
+  // consumer is known to be spinning.
+  std::atomic<size_t> approx_size_{0};
+  // Number of consumers currently in the spin phase of pop()
+  std::atomic<int> num_spinning_{0};
 
   // incrementOutstandingTasks indicates whether or not we should increment
   // 'outstanding_tasks_' for the associated GraphTask. This should mostly
@@ -197,16 +241,24 @@ auto ReadyQueue::push(NodeTask item, bool incrementOutstandingTasks) -> void {
       ++graph_task->outstanding_tasks_;
     }
     heap_.push(std::move(item));
+    approx_size_.store(heap_.size(), std::memory_order_release);
+  }
+  // A spinning consumer will observe approx_size_ without any syscall; the
+  // notify is only needed for consumers blocked on the condition variable.
+  // This is race-free: a consumer only blocks after re-checking the heap
+  // under the mutex.
+  if (num_spinning_.load(std::memory_order_acquire) == 0) {
+    not_empty_.notify_one();
   }
-  not_empty_.notify_one();
 }
 
 auto ReadyQueue::pushShutdownTask() -> void {
   {
     std::lock_guard<std::mutex> lock(mutex_);
     heap_.push(NodeTask({}, nullptr, InputBuffer(0), true));
+    approx_size_.store(heap_.size(), std::memory_order_release);
   }
-  not_empty_.notify_one();
+  not_empty_.notify_all();
 }
 
 size_t ReadyQueue::size() const {
@@ -216,11 +268,31 @@ size_t ReadyQueue::size() const {
 }
 
 auto ReadyQueue::pop() -> NodeTask {
+  // Spin briefly on the atomic size before blocking; backward passes that
+  // keep the queue busy hand tasks between producer and consumer without a
+  // futex round trip per task.
+  constexpr int kSpinLimit = 10000;
+  num_spinning_.fetch_add(1, std::memory_order_acq_rel);
+  for (int spin = 0; spin < kSpinLimit; spin++) {
+    if (approx_size_.load(std::memory_order_acquire) > 0) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!heap_.empty()) {
+        num_spinning_.fetch_sub(1, std::memory_order_acq_rel);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        auto task = std::move(const_cast<NodeTask&>(heap_.top())); heap_.pop();
+        approx_size_.store(heap_.size(), std::memory_order_release);
+        return task;
+      }
+    }
+  }
+  num_spinning_.fetch_sub(1, std::memory_order_acq_rel);
+
   // Lock mutex for accesses to heap_
   std::unique_lock<std::mutex> lock(mutex_);
   not_empty_.wait(lock, [this]{ return !heap_.empty(); });
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
   auto task = std::move(const_cast<NodeTask&>(heap_.top())); heap_.pop();
+  approx_size_.store(heap_.size(), std::memory_order_release);
   return task;
 }
 
@@ -279,7 +351,7 @@ void Engine::set_device(int device) {
   worker_device = device;
 }
 
-auto Engine::thread_init(int device) -> void {
+auto Engine::thread_init(int device, int queue_index) -> void {
   at::init_num_threads();
   // Note [Allocating GPUs to autograd threads]
   // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -299,6 +371,8 @@ auto Engine::thread_init(int device) -> void {
   // arbitrarily picked to colocate devices.  Maybe the other approach is
   // better.
   set_device(device);
+  maybe_pin_worker_thread(queue_index);
+  worker_queue_index = queue_index;
   std::shared_ptr<GraphTask> graph_task = nullptr;
   thread_main(graph_task, /* reentrant_thread */ false);
   // Notify about shutdown
@@ -330,7 +404,7 @@ auto Engine::thread_main(
   // graph_task.
   TORCH_INTERNAL_ASSERT(reentrant_thread != (graph_task == nullptr));
 
-  auto queue = ready_queues_[worker_device + 1];
+  auto queue = ready_queues_[worker_queue_index];
   // Why the test on graph_task->outstanding_tasks_?  See
   // Note [Reentrant backwards]
   while (!reentrant_thread || graph_task->outstanding_tasks_ > 0) {
@@ -389,7 +463,7 @@ auto Engine::thread_main(
         gt_completed) {
       // Synchronize outstanding_tasks_ with queue mutex
       std::atomic_thread_fence(std::memory_order_release);
-      ready_queue_by_index(base_owner)
+      ready_queue_by_index(local_graph_task, base_owner)
           .push(NodeTask(local_graph_task, nullptr, InputBuffer(0)));
     }
   }
@@ -412,6 +486,11 @@ void Engine::reentrant_thread_init() {
       continue;
     }
     set_device(graph_task->owner_);
+    // Service the queue the blocked owner thread was popping from; for a CPU
+    // owner that is the graph task's own shard.
+    worker_queue_index = graph_task->owner_ == CPU_DEVICE
+        ? cpu_queue_index(graph_task)
+        : num_cpu_queues_ + graph_task->owner_;
     total_depth = graph_task->reentrant_depth_;
     thread_main(graph_task, /* reentrant thread*/ true);
   }
@@ -670,7 +749,7 @@ void Engine::evaluate_function(
                        opt_next_stream);
 
       if (is_ready) {
-        auto& queue = ready_queue(input_buffer.device());
+        auto& queue = ready_queue(graph_task, input_buffer.device());
         queue.push(
             NodeTask(graph_task, next.function, std::move(input_buffer)));
       } else {
@@ -687,7 +766,7 @@ void Engine::evaluate_function(
                        opt_parent_stream,
                        opt_next_stream);
       if (is_ready) {
-        auto& queue = ready_queue(input_buffer.device());
+        auto& queue = ready_queue(graph_task, input_buffer.device());
         queue.push(
             NodeTask(graph_task, next.function, std::move(input_buffer)));
         not_ready.erase(not_ready_it);
@@ -717,6 +796,135 @@ auto Engine::compute_dependencies(Node* root, GraphTask& task) -> void {
   }
 }
 
+// Note [Backward execution templates]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Training loops typically run backward() over the same graph topology every
+// iteration, and with retain_graph=True they run it over literally the same
+// Node objects. The discovery pass (compute_dependencies +
+// GraphTask::init_to_execute) walks every node to rebuild information that is
+// identical across such calls: the dependency counts and the exec_info
+// needed-bits and captures. On large graphs that walk is a measurable slice
+// of the whole backward call, so we memoize its result, keyed by a
+// fingerprint of the (roots, outputs) edges.
+//
+// A template is only recorded when keep_graph is true: that is the only case
+// where the Node objects survive the call, and it is exactly the
+// repeated-iteration scenario. Validity is checked by comparing weak
+// references to the recorded root and output nodes against the incoming
+// edges: next_edges are fixed at Node construction time and interior nodes
+// are owned through them, so if the same root and output objects are still
+// alive the reachable graph is unchanged. An expired weak_ptr (or a recycled
+// address, which lock() also detects) evicts the entry. The cache holds no
+// strong references, so it can never keep a graph or its saved variables
+// alive.
+
+namespace {
+
+size_t exec_template_key(const edge_list& roots, const edge_list& outputs) {
+  size_t seed = roots.size();
+  for (const auto& edge : roots) {
+    seed = torch::hash_combine(seed, std::hash<Edge>()(edge));
+  }
+  seed = torch::hash_combine(seed, outputs.size());
+  for (const auto& edge : outputs) {
+    seed = torch::hash_combine(seed, std::hash<Edge>()(edge));
+  }
+  return seed;
+}
+
+bool exec_template_edges_match(
+    const std::vector<std::pair<std::weak_ptr<Node>, uint32_t>>& recorded,
+    const edge_list& edges) {
+  if (recorded.size() != edges.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < edges.size(); ++i) {
+    if (recorded[i].second != edges[i].input_nr ||
+        recorded[i].first.lock() != edges[i].function) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+bool Engine::try_apply_exec_template(
+    const edge_list& roots,
+    const edge_list& outputs,
+    Node* graph_root,
+    GraphTask& task) {
+  const auto key = exec_template_key(roots, outputs);
+  std::lock_guard<std::mutex> lock(exec_templates_mutex_);
+  auto it = exec_templates_.find(key);
+  if (it == exec_templates_.end()) {
+    return false;
+  }
+  auto& tmpl = it->second;
+  if (!exec_template_edges_match(tmpl.roots_, roots) ||
+      !exec_template_edges_match(tmpl.outputs_, outputs)) {
+    // The recorded graph is gone (or this is a hash collision); recompute.
+    exec_templates_.erase(it);
+    return false;
+  }
+  task.dependencies_ = tmpl.dependencies_;
+  if (!outputs.empty()) {
+    // The GraphRoot is created afresh per call, so its entry is not part of
+    // the template; mirror what init_to_execute does for it.
+    task.exec_info_[graph_root].needed_ = true;
+    for (const auto& entry : tmpl.exec_info_) {
+      auto& info = task.exec_info_[entry.fn_];
+      info.needed_ = entry.needed_;
+      if (!entry.captures_.empty()) {
+        info.captures_ =
+            make_unique<std::vector<GraphTask::ExecInfo::Capture>>(
+                entry.captures_);
+      }
+    }
+    task.captured_vars_.resize(outputs.size());
+  }
+  return true;
+}
+
+void Engine::record_exec_template(
+    const edge_list& roots,
+    const edge_list& outputs,
+    Node* graph_root,
+    GraphTask& task) {
+  ExecTemplate tmpl;
+  tmpl.roots_.reserve(roots.size());
+  for (const auto& edge : roots) {
+    tmpl.roots_.emplace_back(edge.function, edge.input_nr);
+  }
+  tmpl.outputs_.reserve(outputs.size());
+  for (const auto& edge : outputs) {
+    tmpl.outputs_.emplace_back(edge.function, edge.input_nr);
+  }
+  tmpl.dependencies_ = task.dependencies_;
+  tmpl.exec_info_.reserve(task.exec_info_.size());
+  for (const auto& item : task.exec_info_) {
+    if (item.first == graph_root) {
+      continue; // per-call object, see try_apply_exec_template
+    }
+    ExecTemplate::ExecInfoEntry entry;
+    entry.fn_ = item.first;
+    entry.needed_ = item.second.needed_;
+    if (item.second.captures_) {
+      entry.captures_ = *item.second.captures_;
+    }
+    tmpl.exec_info_.push_back(std::move(entry));
+  }
+
+  const auto key = exec_template_key(roots, outputs);
+  std::lock_guard<std::mutex> lock(exec_templates_mutex_);
+  if (exec_templates_.size() >= kMaxExecTemplates &&
+      exec_templates_.count(key) == 0) {
+    // Evict an arbitrary entry; stale entries are also dropped on lookup.
+    exec_templates_.erase(exec_templates_.begin());
+  }
+  exec_templates_[key] = std::move(tmpl);
+}
+
 struct ClearCallbacks {
   ClearCallbacks(std::vector<std::function<void()>>& callbacks,
                  std::mutex &callbacks_lock)
@@ -754,10 +962,17 @@ auto Engine::execute(const edge_list& roots,
 
   // Now compute the dependencies for all executable functions and queue the root
   auto graph_root = std::make_shared<GraphRoot>(roots, inputs);
-  compute_dependencies(graph_root.get(), *graph_task);
+  // See Note [Backward execution templates]
+  if (!try_apply_exec_template(roots, outputs, graph_root.get(), *graph_task)) {
+    compute_dependencies(graph_root.get(), *graph_task);
 
-  if (!outputs.empty()) {
-    graph_task->init_to_execute(*graph_root, outputs);
+    if (!outputs.empty()) {
+      graph_task->init_to_execute(*graph_root, outputs);
+    }
+
+    if (keep_graph) {
+      record_exec_template(roots, outputs, graph_root.get(), *graph_task);
+    }
   }
 
   return execute_with_graph_task(graph_task, graph_root)->wait();
@@ -773,7 +988,9 @@ void Engine::initialize_threads_pool() {
 
 void Engine::enqueue_blocked_task_on_cpu(NodeTask task) {
   initialize_threads_pool();
-  ready_queue(at::kCPU).push(
+  auto graph_task = task.base_.lock();
+  TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
+  ready_queue(graph_task, at::kCPU).push(
       std::move(task), /* incrementOutstandingTasks */ false);
 }
 
@@ -784,7 +1001,7 @@ std::shared_ptr<FutureVariableList> Engine::execute_with_graph_task(
   // Lock mutex for GraphTask.
   std::unique_lock<std::mutex> lock(graph_task->mutex_);
 
-  ready_queue(at::kCPU).push(
+  ready_queue(graph_task, at::kCPU).push(
       NodeTask(graph_task, std::move(graph_root), InputBuffer(0)));
 
   // Not a worker
@@ -913,23 +1130,83 @@ size_t Engine::ready_queue_size(at::Device device) {
     // out of bound error.
     return 0;
   }
-  return ready_queue(device).size();
+  if (device.type() == at::kCPU) {
+    // CPU work is spread over the shards; report the total.
+    size_t size = 0;
+    for (int i = 0; i < num_cpu_queues_; ++i) {
+      size += ready_queues_.at(i)->size();
+    }
+    return size;
+  }
+  return ready_queues_.at(num_cpu_queues_ + device.index())->size();
 }
 
-auto Engine::ready_queue(at::Device device) -> ReadyQueue& {
+// Note [CPU ready queue sharding]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Historically the engine had exactly one CPU ready queue and one CPU worker
+// thread, so every backward pass in the process funneled its CPU work through
+// the same thread. That is fine for a single training loop, but it serializes
+// independent backward passes running concurrently in one process — most
+// notably distributed autograd, where one worker may execute backward passes
+// for many autograd contexts at once (see dist_engine.cpp).
+//
+// TORCH_AUTOGRAD_CPU_QUEUES=N (default 1, i.e. the historical behavior)
+// splits the CPU tier into N ready queues, each serviced by its own worker
+// thread. A graph task is assigned one shard — round robin on first CPU push
+// — and all of its CPU work stays on that shard, so within one backward pass
+// the single-CPU-thread invariant still holds; only *independent* graph tasks
+// run concurrently. A reentrant backward started from a CPU worker thread is
+// pinned to that thread's own shard, since the blocked parent services its
+// own queue while waiting (see thread_main) and would otherwise never see the
+// child's tasks.
+//
+// With more than one shard, graph tasks that share Nodes (e.g. AccumulateGrad
+// for a parameter used by several autograd contexts) can reach the same Node
+// concurrently; AccumulateGrad serializes on a per-Node mutex for this case.
+int Engine::cpu_queue_index(const std::shared_ptr<GraphTask>& graph_task) {
+  int index = graph_task->cpu_queue_index_.load();
+  if (index != -1) {
+    return index;
+  }
+  int assigned;
+  if (worker_device == CPU_DEVICE) {
+    // Reentrant backward from a CPU worker thread; see
+    // Note [CPU ready queue sharding]
+    assigned = worker_queue_index;
+  } else {
+    static std::atomic<uint32_t> next_cpu_queue{0};
+    assigned = next_cpu_queue++ % num_cpu_queues_;
+  }
+  int expected = -1;
+  if (graph_task->cpu_queue_index_.compare_exchange_strong(
+          expected, assigned)) {
+    return assigned;
+  }
+  // Another thread raced us to the assignment; use theirs.
+  return expected;
+}
+
+auto Engine::ready_queue(
+    const std::shared_ptr<GraphTask>& graph_task,
+    at::Device device) -> ReadyQueue& {
   // See Note [Allocating GPUs to autograd threads]
   if (device.type() == at::kCPU) {
-    return *ready_queues_.at(0);
+    return *ready_queues_.at(cpu_queue_index(graph_task));
   } else {
-    return *ready_queues_.at(device.index() + 1);
+    return *ready_queues_.at(num_cpu_queues_ + device.index());
   }
 }
 
 // See Note [Allocating GPUs to autograd threads]
 // NB: This would become obsolete if we truly allocated a CPU thread
 // per device, rather than colocate.
-auto Engine::ready_queue_by_index(int device_index) -> ReadyQueue& {
-  return *ready_queues_.at(device_index + 1);
+auto Engine::ready_queue_by_index(
+    const std::shared_ptr<GraphTask>& graph_task,
+    int device_index) -> ReadyQueue& {
+  if (device_index == CPU_DEVICE) {
+    return *ready_queues_.at(cpu_queue_index(graph_task));
+  }
+  return *ready_queues_.at(num_cpu_queues_ + device_index);
 }
 
 auto Engine::start_threads() -> void {
@@ -942,9 +1219,15 @@ auto Engine::start_threads() -> void {
     }
   }
 
-  // One for CPU, plus one for every GPU device (but colocate GPUs of different
-  // types)
-  int num_threads = num_devices + 1;
+  // See Note [CPU ready queue sharding]
+  num_cpu_queues_ = 1;
+  if (const char* val = std::getenv("TORCH_AUTOGRAD_CPU_QUEUES")) {
+    num_cpu_queues_ = std::max(1, std::atoi(val));
+  }
+
+  // One queue (and thread) per CPU shard, plus one for every GPU device (but
+  // colocate GPUs of different types)
+  int num_threads = num_cpu_queues_ + num_devices;
   ready_queues_ = std::vector<std::shared_ptr<ReadyQueue>>(num_threads);
   for (auto& queue : ready_queues_)
     queue.reset(new ReadyQueue());
@@ -952,8 +1235,12 @@ auto Engine::start_threads() -> void {
   thread_pool_shared_ = std::make_shared<ThreadPoolShared>();
 
   non_reentrant_thread_count_.store(num_threads);
-  for (int i = 0; i < num_threads; ++i) {
-    std::thread t(&Engine::thread_init, this, i - 1);
+  for (int i = 0; i < num_cpu_queues_; ++i) {
+    std::thread t(&Engine::thread_init, this, CPU_DEVICE, i);
+    t.detach();
+  }
+  for (int i = 0; i < num_devices; ++i) {
+    std::thread t(&Engine::thread_init, this, i, num_cpu_queues_ + i);
     t.detach();
   }
 }
@@ -36,6 +36,7 @@ void validate_outputs(
 
 // NB: -1 indicates the CPU worker!
 static constexpr int NO_DEVICE = -2;
+static constexpr int CPU_DEVICE = -1;
 
 // GraphTask holds metadata needed for a single execution of backward()
 struct GraphTask {
@@ -92,6 +93,13 @@ struct GraphTask {
   // The number of parent graph tasks for this graph task
   const int reentrant_depth_;
 
+  // Index of the CPU ready queue shard all CPU work of this task is pushed
+  // to. Assigned on the first CPU push and constant afterwards, so a single
+  // backward pass still runs on one CPU worker thread while independent graph
+  // tasks can run on different shards. -1 means not assigned yet.
+  // See Note [CPU ready queue sharding]
+  std::atomic<int> cpu_queue_index_{-1};
+
   bool can_checkpoint() {
     return exec_info_.empty();
   }
@@ -215,14 +223,54 @@ struct TORCH_API Engine {
  protected:
   Engine();
   void compute_dependencies(Node* root, GraphTask& task);
+
+  // A memoized result of the discovery pass (compute_dependencies +
+  // GraphTask::init_to_execute) for one (roots, outputs) pair.
+  // See Note [Backward execution templates]
+  struct ExecTemplate {
+    struct ExecInfoEntry {
+      Node* fn_;
+      bool needed_;
+      std::vector<GraphTask::ExecInfo::Capture> captures_;
+    };
+    // The edges the template was recorded for. Held as weak references so
+    // the cache never extends the lifetime of a graph; a template is only
+    // valid while every one of these is still the original Node object.
+    std::vector<std::pair<std::weak_ptr<Node>, uint32_t>> roots_;
+    std::vector<std::pair<std::weak_ptr<Node>, uint32_t>> outputs_;
+    dependencies_type dependencies_;
+    std::vector<ExecInfoEntry> exec_info_;
+  };
+
+  // Populates task from a recorded template if one matches (roots, outputs);
+  // returns false when the discovery pass needs to run.
+  // See Note [Backward execution templates]
+  bool try_apply_exec_template(
+      const edge_list& roots,
+      const edge_list& outputs,
+      Node* graph_root,
+      GraphTask& task);
+  void record_exec_template(
+      const edge_list& roots,
+      const edge_list& outputs,
+      Node* graph_root,
+      GraphTask& task);
+
   void evaluate_function(
       std::shared_ptr<GraphTask>& graph_task,
       Node* func,
       InputBuffer& inputs);
-  ReadyQueue& ready_queue(at::Device device);
-  ReadyQueue& ready_queue_by_index(int device_index);
+  ReadyQueue& ready_queue(
+      const std::shared_ptr<GraphTask>& graph_task,
+      at::Device device);
+  ReadyQueue& ready_queue_by_index(
+      const std::shared_ptr<GraphTask>& graph_task,
+      int device_index);
+  // Returns the CPU shard index for the given graph task, assigning one on
+  // first use. See Note [CPU ready queue sharding]
+  int cpu_queue_index(const std::shared_ptr<GraphTask>& graph_task);
   void start_threads();
-  virtual void thread_init(int device);
+  virtual void thread_init(int device, int queue_index);
   virtual void thread_on_exception(
       std::shared_ptr<GraphTask> graph_task,
       const std::shared_ptr<Node>& fn,
@@ -239,9 +287,21 @@ struct TORCH_API Engine {
   std::once_flag start_threads_flag_;
   // Safe to read ready_queues_ without synchronization after intialization
   std::vector<std::shared_ptr<ReadyQueue>> ready_queues_;
+  // Number of CPU ready queue shards at the front of ready_queues_; device
+  // queues follow at [num_cpu_queues_ + device]. Written once in
+  // start_threads, safe to read without synchronization afterwards.
+  // See Note [CPU ready queue sharding]
+  int num_cpu_queues_ = 1;
   std::vector<std::function<void()>> final_callbacks_;
   // To protect reads and writes to final_callbacks_
   std::mutex post_callbacks_lock_;
+  // Recorded discovery passes, keyed by a fingerprint of the (roots, outputs)
+  // edges. Bounded; stale entries are evicted on lookup.
+  // See Note [Backward execution templates]
+  std::unordered_map<size_t, ExecTemplate> exec_templates_;
+  static constexpr size_t kMaxExecTemplates = 16;
+  // To protect reads and writes to exec_templates_
+  std::mutex exec_templates_mutex_;
   // How many nested reentrant calls are allowed until a new thread is used
   int max_recursion_depth_;
 
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -348,6 +349,14 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
   const uint64_t sequence_nr_;
 
   edge_list next_edges_;
+
+  // With a single CPU worker thread the engine never enters one Node
+  // concurrently, but with sharded CPU ready queues (see
+  // Note [CPU ready queue sharding] in engine.cpp) independent graph tasks
+  // that share a Node may reach it at the same time. Nodes that mutate
+  // shared state in apply() (e.g. AccumulateGrad) serialize on this mutex.
+  std::mutex mutex_;
+
   PyObject* pyobj_ = nullptr; // weak reference
   std::unique_ptr<AnomalyMetadata> anomaly_metadata_ = nullptr;
   std::vector<std::unique_ptr<FunctionPreHook>> pre_hooks_;
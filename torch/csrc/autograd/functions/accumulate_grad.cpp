@@ -6,6 +6,7 @@
 #include <torch/csrc/autograd/functions/tensor.h>
 #include <torch/csrc/autograd/functions/utils.h>
 
+#include <atomic>
 #include <cstdint>
 #include <stdexcept>
 #include <utility>
@@ -14,6 +15,26 @@ using at::Tensor;
 
 namespace torch { namespace autograd {
 
+namespace {
+// ScalarType::Undefined means "accumulate at the gradient's dtype".
+std::atomic<at::ScalarType> accumulate_dtype{at::ScalarType::Undefined};
+}
+
+c10::optional<at::ScalarType> AccumulateGrad::accumulateDtype() {
+  const auto dtype = accumulate_dtype.load();
+  if (dtype == at::ScalarType::Undefined) {
+    return c10::nullopt;
+  }
+  return dtype;
+}
+
+void AccumulateGrad::setAccumulateDtype(c10::optional<at::ScalarType> dtype) {
+  TORCH_CHECK(!dtype || *dtype == at::ScalarType::BFloat16,
+      "AccumulateGrad only supports BFloat16 as an accumulation dtype, got ",
+      dtype ? toString(*dtype) : "none");
+  accumulate_dtype.store(dtype.value_or(at::ScalarType::Undefined));
+}
+
 // AccumulateGrad sets sequence_nr to the max value so it's always called
 // ASAP during backwards.
 AccumulateGrad::AccumulateGrad(Variable variable_)
@@ -23,9 +44,13 @@ AccumulateGrad::AccumulateGrad(Variable variable_)
 }
 
 auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
-  // XXX: this method is not thread-safe!
   check_input_variables("AccumulateGrad", grads, 1, 0);
 
+  // The same parameter may receive gradients from several concurrent graph
+  // tasks when the CPU ready queues are sharded; serialize the accumulation.
+  // See Note [CPU ready queue sharding] in engine.cpp.
+  std::lock_guard<std::mutex> lock(mutex_);
+
   if (!grads[0].defined())
     return {};
   if (variable.grad_fn())
@@ -11,6 +11,16 @@ struct TORCH_API AccumulateGrad : public Node {
 
   variable_list apply(variable_list&& grads) override;
 
+  // Optional dtype used for the accumulated gradient buffer. When set to
+  // kBFloat16, gradients of CPU floating-point leaves are kept in bfloat16
+  // and new contributions are added with stochastic rounding (see
+  // at::_stochastic_round_add_), which preserves fp32-level accuracy in
+  // expectation while halving gradient memory relative to fp32. Gradients
+  // that can't use this path (sparse, CUDA, double-backward) fall back to
+  // accumulation at the gradient's dtype. Affects all AccumulateGrad nodes.
+  static c10::optional<at::ScalarType> accumulateDtype();
+  static void setAccumulateDtype(c10::optional<at::ScalarType> dtype);
+
   // Given a variable with its current grad as variable_grad, accumulates
   // new_grad into variable_grad if in place accumulation is possible.
   // Otherwise, uses 'update_grad' to update the grad for the variable.
@@ -36,6 +46,27 @@ struct TORCH_API AccumulateGrad : public Node {
       new_grad = (*hook)({new_grad})[0];
     }
 
+    if (accumulateDtype() == at::ScalarType::BFloat16 &&
+        !GradMode::is_enabled() && !new_grad.is_sparse() &&
+        new_grad.device().type() == at::kCPU &&
+        (new_grad.scalar_type() == at::kFloat ||
+         new_grad.scalar_type() == at::kBFloat16) &&
+        (!variable_grad.defined() ||
+         (variable_grad.scalar_type() == at::kBFloat16 &&
+          variable_grad.is_contiguous()))) {
+      if (!variable_grad.defined()) {
+        // Start from a zero bfloat16 buffer so the first gradient is
+        // stochastically rounded as well.
+        auto buffer =
+            at::zeros(new_grad.sizes(), new_grad.options().dtype(at::kBFloat16));
+        at::_stochastic_round_add_(buffer, new_grad);
+        update_grad(std::move(buffer));
+      } else {
+        at::_stochastic_round_add_(variable_grad, new_grad);
+      }
+      return;
+    }
+
     if (!variable_grad.defined()) {
       // under following condition, we can avoid clone()
       if (!GradMode::is_enabled() && !new_grad.is_sparse() &&
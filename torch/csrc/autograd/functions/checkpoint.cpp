@@ -0,0 +1,120 @@
+#include <torch/csrc/autograd/functions/checkpoint.h>
+
+#include <torch/csrc/autograd/autograd.h>
+#include <torch/csrc/autograd/functions/utils.h>
+#include <torch/csrc/autograd/grad_mode.h>
+
+#include <utility>
+
+namespace torch { namespace autograd {
+
+CheckpointNode::CheckpointNode(checkpoint_fn_t fn, const variable_list& inputs)
+  : fn_(std::move(fn)) {
+  saved_inputs_.reserve(inputs.size());
+  input_requires_grad_.reserve(inputs.size());
+  for (const auto& input : inputs) {
+    saved_inputs_.emplace_back(input, /*is_output=*/false);
+    input_requires_grad_.push_back(input.defined() && input.requires_grad());
+  }
+}
+
+variable_list CheckpointNode::apply(variable_list&& grads) {
+  TORCH_CHECK(fn_,
+      "CheckpointNode: trying to recompute a segment a second time, but the "
+      "saved inputs have been freed. Specify retain_graph=True if you need "
+      "to backward through the graph twice.");
+
+  // Rebuild the segment inputs as leaves of the recomputed subgraph. The
+  // detach keeps the recomputation from backpropagating past the segment
+  // boundary; gradients flow into the outer graph through next_edges instead.
+  variable_list detached_inputs;
+  detached_inputs.reserve(saved_inputs_.size());
+  for (size_t i = 0; i < saved_inputs_.size(); ++i) {
+    auto var = saved_inputs_[i].unpack();
+    if (var.defined()) {
+      var = var.detach();
+      var.set_requires_grad(input_requires_grad_[i]);
+    }
+    detached_inputs.push_back(std::move(var));
+  }
+
+  variable_list outputs;
+  {
+    // Recompute the segment, recording the graph this time.
+    AutoGradMode grad_mode(true);
+    outputs = fn_(detached_inputs);
+  }
+  TORCH_CHECK(outputs.size() == grads.size(),
+      "CheckpointNode: function returned ", outputs.size(),
+      " outputs during recomputation, but ", grads.size(),
+      " outputs were recorded in the forward pass");
+
+  variable_list outputs_with_grad;
+  variable_list grad_outputs;
+  for (size_t i = 0; i < outputs.size(); ++i) {
+    if (outputs[i].defined() && outputs[i].requires_grad() && grads[i].defined()) {
+      outputs_with_grad.push_back(outputs[i]);
+      grad_outputs.push_back(grads[i]);
+    }
+  }
+  TORCH_CHECK(!outputs_with_grad.empty(),
+      "CheckpointNode: none of the recomputed outputs requires grad; "
+      "this checkpoint() is unnecessary");
+
+  variable_list inputs_with_grad;
+  std::vector<size_t> input_positions;
+  for (size_t i = 0; i < detached_inputs.size(); ++i) {
+    if (detached_inputs[i].defined() && input_requires_grad_[i]) {
+      inputs_with_grad.push_back(detached_inputs[i]);
+      input_positions.push_back(i);
+    }
+  }
+
+  // This is a reentrant backward: the engine either runs it inline on this
+  // worker thread or hands it to the reentrant thread pool, so segments on
+  // independent branches recompute concurrently with each other's gradient
+  // computation.
+  auto grad_inputs = grad(outputs_with_grad, inputs_with_grad, grad_outputs,
+                          /*retain_graph=*/false, /*create_graph=*/false,
+                          /*allow_unused=*/true);
+
+  variable_list results(saved_inputs_.size());
+  for (size_t i = 0; i < input_positions.size(); ++i) {
+    results[input_positions[i]] = std::move(grad_inputs[i]);
+  }
+  return results;
+}
+
+void CheckpointNode::release_variables() {
+  saved_inputs_.clear();
+  fn_ = nullptr;
+}
+
+variable_list checkpoint(checkpoint_fn_t fn, const variable_list& inputs) {
+  TORCH_CHECK(fn, "checkpoint: expected a function, but got an empty std::function");
+  bool requires_grad = compute_requires_grad(inputs);
+  variable_list outputs;
+  {
+    AutoGradMode grad_mode(false);
+    outputs = fn(inputs);
+  }
+  if (!requires_grad) {
+    return outputs;
+  }
+  for (const auto& output : outputs) {
+    // Everything computed inside the segment has grad mode off, so an output
+    // that requires grad can only be an input passed through unchanged, which
+    // we cannot hook to the CheckpointNode without corrupting the input.
+    TORCH_CHECK(!output.defined() || !output.requires_grad(),
+        "checkpoint: the checkpointed function must not return an input "
+        "unchanged; return a view or clone of it instead");
+  }
+  auto node = std::make_shared<CheckpointNode>(std::move(fn), inputs);
+  node->set_next_edges(collect_next_edges(inputs));
+  for (auto& output : outputs) {
+    set_history(output, node);
+  }
+  return outputs;
+}
+
+}} // namespace torch::autograd
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/saved_variable.h>
+#include <torch/csrc/autograd/variable.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace torch { namespace autograd {
+
+using checkpoint_fn_t = std::function<variable_list(const variable_list&)>;
+
+// Backward node for a checkpointed segment. The forward pass of the segment
+// runs with grad mode disabled, so none of its intermediate activations are
+// saved; only the segment inputs are. During backward, apply() re-runs the
+// forward function under GradMode on the engine worker thread and
+// differentiates the recomputed subgraph to produce the input gradients.
+// Because this is a reentrant backward, recomputation of one segment
+// naturally overlaps with gradient computation of whatever other branches of
+// the outer graph are still executing.
+struct TORCH_API CheckpointNode : public Node {
+  CheckpointNode(checkpoint_fn_t fn, const variable_list& inputs);
+
+  variable_list apply(variable_list&& grads) override;
+
+  std::string name() const override {
+    return "CheckpointNode";
+  }
+
+  void release_variables() override;
+
+  checkpoint_fn_t fn_;
+  std::vector<SavedVariable> saved_inputs_;
+  std::vector<bool> input_requires_grad_;
+};
+
+// Runs `fn` on `inputs` without recording an autograd graph for the segment
+// body. If any input requires grad, the outputs are hooked to a
+// CheckpointNode that recomputes the segment during backward. Like
+// torch.utils.checkpoint, `fn` is run a second time during backward, so it
+// must be side-effect free and may not return any of its inputs unchanged;
+// unlike the Python version, RNG state is not restored for the
+// recomputation, and double backward through the segment is not supported.
+TORCH_API variable_list checkpoint(checkpoint_fn_t fn, const variable_list& inputs);
+
+}} // namespace torch::autograd
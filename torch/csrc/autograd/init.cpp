@@ -1,5 +1,6 @@
 #include <torch/csrc/python_headers.h>
 
+#include <c10/core/InferenceMode.h>
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/utils/pybind.h>
 #include <torch/csrc/autograd/grad_mode.h>
@@ -36,22 +37,45 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject *unused) {
       .value("NVTX", ProfilerState::NVTX);
 
   py::class_<ProfilerConfig>(m, "ProfilerConfig")
-      .def(py::init<ProfilerState, bool>());
+      .def(py::init<ProfilerState, bool>())
+      .def(py::init<ProfilerState, bool, bool>());
 
   py::class_<Event>(m, "ProfilerEvent")
       .def("kind", &Event::kind)
       .def("name", [](const Event& e) { return e.name(); })
       .def("thread_id", &Event::thread_id)
       .def("device", &Event::device)
+      .def("stream_id", &Event::stream_id)
       .def("cpu_elapsed_us", &Event::cpu_elapsed_us)
       .def("cuda_elapsed_us", &Event::cuda_elapsed_us)
       .def("has_cuda", &Event::has_cuda)
-      .def("shapes", &Event::shapes);
+      .def("shapes", &Event::shapes)
+      .def("bytes_read", &Event::bytes_read)
+      .def("bytes_written", &Event::bytes_written)
+      .def("flops", &Event::flops);
 
   m.def("_enable_profiler", enableProfiler);
   m.def("_disable_profiler", disableProfiler);
   m.def("_profiler_enabled", profilerEnabled);
 
+  py::class_<OpHistogram>(m, "_OpHistogram")
+      .def_readonly("name", &OpHistogram::name)
+      .def_readonly("count", &OpHistogram::count)
+      .def_readonly("total_ns", &OpHistogram::total_ns)
+      .def_readonly("buckets", &OpHistogram::buckets);
+
+  m.def(
+      "_enable_continuous_profiler",
+      [](size_t ring_buffer_size, int64_t sample_period) {
+        enableContinuousProfiler(
+            ContinuousProfilerConfig(ring_buffer_size, sample_period));
+      },
+      py::arg("ring_buffer_size") = 8192,
+      py::arg("sample_period") = 1);
+  m.def("_disable_continuous_profiler", disableContinuousProfiler);
+  m.def("_continuous_profiler_enabled", continuousProfilerEnabled);
+  m.def("_collect_continuous_profile", collectContinuousProfile);
+
   m.def("_run_before_callbacks", runBeforeCallbacks);
 
   py::class_<RecordFunction, std::shared_ptr<RecordFunction>>(m, "_RecordFunction")
@@ -102,12 +126,34 @@ static PyObject * is_anomaly_mode_enabled(PyObject* _unused, PyObject *arg) {
   END_HANDLE_TH_ERRORS
 }
 
+static PyObject * set_inference_mode_enabled(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (!PyBool_Check(arg)) {
+    throw TypeError("enabled must be a bool (got %s)", Py_TYPE(arg)->tp_name);
+  }
+  c10::InferenceMode::set_enabled(arg == Py_True);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject * is_inference_mode_enabled(PyObject* _unused, PyObject *arg) {
+  HANDLE_TH_ERRORS
+  if (c10::InferenceMode::is_enabled()) {
+    Py_RETURN_TRUE;
+  } else {
+    Py_RETURN_FALSE;
+  }
+  END_HANDLE_TH_ERRORS
+}
+
 // autograd methods on torch._C
 static PyMethodDef methods[] = {
   {"set_grad_enabled", (PyCFunction)set_grad_enabled, METH_O, nullptr},
   {"is_grad_enabled", (PyCFunction)is_grad_enabled, METH_NOARGS, nullptr},
   {"set_anomaly_enabled", (PyCFunction)set_anomaly_mode_enabled, METH_O, nullptr},
   {"is_anomaly_enabled", (PyCFunction)is_anomaly_mode_enabled, METH_NOARGS, nullptr},
+  {"set_inference_mode_enabled", (PyCFunction)set_inference_mode_enabled, METH_O, nullptr},
+  {"is_inference_mode_enabled", (PyCFunction)is_inference_mode_enabled, METH_NOARGS, nullptr},
   {nullptr, nullptr, 0, nullptr}
 };
 
@@ -1,5 +1,6 @@
 #include <torch/csrc/autograd/input_buffer.h>
 
+#include <ATen/detail/CUDAHooksInterface.h>
 #include <c10/core/DeviceGuard.h>
 #include <c10/core/StreamGuard.h>
 #include <c10/core/Event.h>
@@ -11,6 +12,22 @@
 
 namespace torch { namespace autograd {
 
+  // Tells the CUDA caching allocator that var is used on stream, so its
+  // blocks are not handed out again while that use may still be pending.
+  // Event waits order the kernels, but the allocator tracks lifetimes per
+  // allocation stream; any use on another stream has to be recorded or a
+  // freed gradient can be re-issued while a cross-stream kernel still
+  // reads it.
+  static void record_stream(const Variable& var, const c10::Stream& stream) {
+    const auto& hooks = at::detail::getCUDAHooks();
+    if (var.is_sparse()) {
+      hooks.recordStreamOnDataPtr(var._indices().storage().data_ptr(), stream);
+      hooks.recordStreamOnDataPtr(var._values().storage().data_ptr(), stream);
+    } else {
+      hooks.recordStreamOnDataPtr(var.storage().data_ptr(), stream);
+    }
+  }
+
   static void accumulate(std::vector<Variable>& buffer,
                          const size_t pos,
                          Variable&& var) {
@@ -43,80 +60,94 @@ namespace torch { namespace autograd {
     return;
   }
 
-  // Switches to accumulate device
-  // The device (and stream) chosen for accumulation is:
-  //  (1) var is not a CUDA variable. Accumulation happens on var's device.
-  //  (2) var is a CUDA variable and it, the consumer, and the producer share the same device:
-  //       (2a) Uses the consumer's stream as the accumulation stream
-  //       (2b) Syncs the accumulation stream with the producer's stream (if different)
-  //       (2c) Accumulates.
-  //  (3) var is a CUDA variable and it shares a device with the consumer but not the producer:
-  //       (3a) Uses the consumer's stream as the accumulation stream
-  //       (3b) Syncs the accumulation stream with the consumer device's default stream
-  //       (3c) Accumulates.
-  //  (4) var is a CUDA variable and it shares a device with the producer but not the consumer:
-  //       (4a) Uses the producer device's default stream as the accumulation stream
-  //       (4b) Syncs the accumulation stream with the the producer's stream
-  //       (4c) Accumulates.
-  //  (5) var is a CUDA variable and it does not share a device with the consumer or producer.
-  //      Accumulation happens on the var device's default stream.
-
   TORCH_INTERNAL_ASSERT(device_of(var));
-  c10::optional<c10::Stream> opt_accumulate_stream = c10::nullopt;
-  if (device_of(var)->is_cuda()) {
-    const auto on_producer = opt_producer_stream
-                        && device_of(var) == opt_producer_stream->device();
-    const auto on_consumer = opt_consumer_stream
-                        && device_of(var) == opt_consumer_stream->device();
-    if (on_producer && on_consumer) {
-      // (2a)
-      opt_accumulate_stream = opt_consumer_stream;
-      if (opt_accumulate_stream != opt_producer_stream) {
-        // (2b)
-        auto event = c10::Event{c10::DeviceType::CUDA};
-        event.record(*opt_producer_stream);
-        opt_accumulate_stream->wait(event);
-      }
+  if (!device_of(var)->is_cuda()) {
+    // (1) var is not a CUDA variable. The first gradient is stolen without
+    //     touching a guard, and accumulation happens on var's device.
+    if (!buffer[pos].defined()) {
+      buffer[pos] = std::move(var);
     } else {
-      c10::optional<c10::Stream> opt_sync_stream = c10::nullopt;
-      const auto guard = c10::impl::VirtualGuardImpl{c10::DeviceType::CUDA};
-      if (on_consumer && !on_producer) {
-        // (3a)
-        opt_accumulate_stream = opt_consumer_stream;
-        opt_sync_stream = guard.getDefaultStream(opt_consumer_stream->device());
-        TORCH_INTERNAL_ASSERT(opt_sync_stream == guard.getStream(*device_of(var)));
-      } else if (on_producer && !on_consumer) {
-        // (4a)
-        opt_accumulate_stream = guard.getDefaultStream(opt_producer_stream->device());
-        opt_sync_stream = opt_producer_stream;
-      } else {
-        // (5)
-        opt_accumulate_stream = guard.getDefaultStream(*device_of(var));
-      }
-      if (opt_sync_stream && (opt_accumulate_stream != opt_sync_stream)) {
-        // (3b), (4b)
-        c10::OptionalDeviceGuard device_guard{opt_sync_stream->device()};
-        auto event = c10::Event{c10::DeviceType::CUDA};
-        event.record(*opt_sync_stream);
-        opt_accumulate_stream->wait(event);
-      }
+      c10::OptionalDeviceGuard device_guard{device_of(var)};
+      accumulate(buffer, pos, std::move(var));
     }
+    return;
+  }
+
+  // The streams chosen for a CUDA variable are:
+  //  (2) var, the consumer, and the producer share the same device:
+  //       var is ready on the producer's stream and is consumed from the
+  //       consumer's stream.
+  //  (3) var shares a device with the consumer but not the producer:
+  //       var is ready on its device's default stream and is consumed from
+  //       the consumer's stream.
+  //  (4) var shares a device with the producer but not the consumer:
+  //       var is ready on the producer's stream and is consumed from its
+  //       device's default stream.
+  //  (5) var does not share a device with the consumer or producer:
+  //       var is both ready and consumed on its device's default stream.
+  // The first gradient for a position is stolen as-is after syncing the
+  // consumer stream with the ready stream (if different). Later gradients
+  // are accumulated on a stream acquired from the device's pool and
+  // dedicated to this position, chained by events so accumulations for
+  // different positions may overlap, and the consumer stream is synced
+  // with the accumulation stream after each add.
+
+  const auto device = *device_of(var);
+  const auto guard = c10::impl::VirtualGuardImpl{c10::DeviceType::CUDA};
+  const auto on_producer = opt_producer_stream
+                      && device == opt_producer_stream->device();
+  const auto on_consumer = opt_consumer_stream
+                      && device == opt_consumer_stream->device();
+  // Stream on which the incoming gradient is known to be ready
+  const auto ready_stream = on_producer ? *opt_producer_stream
+                                        : guard.getDefaultStream(device);
+  // Stream from which the buffered gradient will be consumed
+  const auto consumer_stream = on_consumer ? *opt_consumer_stream
+                                           : guard.getDefaultStream(device);
+  if (on_consumer && !on_producer) {
+    // (3) cross-device producers hand gradients off on the default stream
+    TORCH_INTERNAL_ASSERT(ready_stream == guard.getStream(device));
   }
 
   auto& old_var = buffer[pos];
   if (!old_var.defined()) {
-    buffer[pos] = std::move(var);
-  } else {
-    if (opt_accumulate_stream) {
-      c10::OptionalStreamGuard stream_guard{opt_accumulate_stream};
-      accumulate(buffer, pos, std::move(var));
-    } else {
-      // (1) non-CUDA variable
-      //     Accumulation happens on variable's device
-      c10::OptionalDeviceGuard device_guard{device_of(var)};
-      accumulate(buffer, pos, std::move(var));
+    if (consumer_stream != ready_stream) {
+      // (2), (3), (4)
+      auto event = c10::Event{c10::DeviceType::CUDA};
+      event.record(ready_stream);
+      consumer_stream.wait(event);
+      record_stream(var, consumer_stream);
     }
+    buffer[pos] = std::move(var);
+    return;
+  }
+
+  auto& opt_accum_stream = accum_streams[pos];
+  if (!opt_accum_stream) {
+    opt_accum_stream = guard.getStreamFromGlobalPool(device);
+    // The buffered gradient is ready on the consumer stream (see above)
+    auto event = c10::Event{c10::DeviceType::CUDA};
+    event.record(consumer_stream);
+    opt_accum_stream->wait(event);
+  }
+  if (*opt_accum_stream != ready_stream) {
+    auto event = c10::Event{c10::DeviceType::CUDA};
+    event.record(ready_stream);
+    opt_accum_stream->wait(event);
+  }
+  // Both operands are used on the accumulation stream, and the summed
+  // gradient it allocates is consumed (and later freed) from the consumer
+  // stream; record each cross-stream use with the caching allocator.
+  record_stream(var, *opt_accum_stream);
+  record_stream(old_var, *opt_accum_stream);
+  {
+    c10::StreamGuard stream_guard{*opt_accum_stream};
+    accumulate(buffer, pos, std::move(var));
   }
+  record_stream(buffer[pos], consumer_stream);
+  auto event = c10::Event{c10::DeviceType::CUDA};
+  event.record(*opt_accum_stream);
+  consumer_stream.wait(event);
 }
 
 auto InputBuffer::device() const -> at::Device {
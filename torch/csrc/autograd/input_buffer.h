@@ -18,7 +18,8 @@ namespace torch { namespace autograd {
 
 struct InputBuffer {
   explicit InputBuffer(size_t size)
-    : buffer(size) {}
+    : buffer(size)
+    , accum_streams(size) {}
   InputBuffer(const InputBuffer& other) = delete;
   InputBuffer(InputBuffer&& other) = default;
   InputBuffer& operator=(InputBuffer&& other) = default;
@@ -40,6 +41,9 @@ struct InputBuffer {
 
 private:
   std::vector<Variable> buffer;
+  // Pool streams on which CUDA gradients are accumulated, one per position
+  // (acquired lazily on the second gradient for a position)
+  std::vector<c10::optional<c10::Stream>> accum_streams;
 };
 
 }}  // namespace torch::autograd
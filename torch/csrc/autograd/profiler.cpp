@@ -1,11 +1,18 @@
 #include <torch/csrc/autograd/profiler.h>
 #include <torch/csrc/jit/frontend/code_template.h>
 
+#include <ATen/native/TensorIterator.h>
+
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <list>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace torch { namespace autograd { namespace profiler {
@@ -25,6 +32,112 @@ std::unordered_map<uint16_t, std::shared_ptr<RangeEventList>>
     all_event_lists_map;
 thread_local std::shared_ptr<RangeEventList> event_list;
 thread_local uint16_t thread_id;
+// Whether this enableProfiler call turned on the TensorIterator intensity
+// counters, so disableProfiler only turns them back off in that case.
+bool enabled_intensity_tracking = false;
+
+// Continuous profiling mode state.
+
+struct ContinuousSample {
+  const char* name;
+  int64_t duration_ns;
+};
+static_assert(
+    std::is_trivially_copyable<ContinuousSample>::value,
+    "ContinuousSample must be trivially copyable for seqlock-style reads");
+
+// Fixed-size ring of completed-op samples. There is exactly one writer (the
+// owning thread); readers validate each slot with its sequence counter and
+// skip slots that were mid-write or overwritten while being copied.
+struct ContinuousRing {
+  explicit ContinuousRing(size_t size) : slots_(size), seq_(size) {
+    for (auto& s : seq_) {
+      s.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Writer thread only.
+  void record(const char* name, int64_t duration_ns) {
+    const size_t idx = head_++ % slots_.size();
+    auto& seq = seq_[idx];
+    const uint64_t s = seq.load(std::memory_order_relaxed);
+    // odd sequence marks the slot as mid-write
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slots_[idx].name = name;
+    slots_[idx].duration_ns = duration_ns;
+    seq.store(s + 2, std::memory_order_release);
+  }
+
+  // Writer thread only. Op names reaching the ring may be backed by
+  // temporary strings, so they are interned here; the set's node storage is
+  // stable, which lets readers keep dereferencing previously interned names
+  // while new ones are added.
+  const char* intern(const char* name) {
+    return interned_.insert(name).first->c_str();
+  }
+
+  // Any thread.
+  std::vector<ContinuousSample> snapshot() const {
+    std::vector<ContinuousSample> result;
+    result.reserve(slots_.size());
+    for (size_t i = 0; i < slots_.size(); ++i) {
+      const uint64_t s1 = seq_[i].load(std::memory_order_acquire);
+      if (s1 == 0 || (s1 & 1) != 0) {
+        continue; // never written, or write in flight
+      }
+      ContinuousSample sample = slots_[i];
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq_[i].load(std::memory_order_relaxed) != s1) {
+        continue; // overwritten while copying
+      }
+      result.push_back(sample);
+    }
+    return result;
+  }
+
+ private:
+  std::vector<ContinuousSample> slots_;
+  std::vector<std::atomic<uint64_t>> seq_;
+  size_t head_ = 0;
+  std::unordered_set<std::string> interned_;
+};
+
+std::atomic<bool> continuous_profiler_enabled{false};
+std::atomic<int64_t> continuous_sample_period{1};
+std::atomic<size_t> continuous_ring_buffer_size{8192};
+// Protects access to continuous_rings. Rings outlive disable so that a final
+// collectContinuousProfile() can still export them.
+std::mutex continuous_rings_mutex;
+std::unordered_map<uint16_t, std::shared_ptr<ContinuousRing>> continuous_rings;
+thread_local std::shared_ptr<ContinuousRing> continuous_ring;
+// Start times of sampled ops still in flight on this thread.
+thread_local std::vector<std::pair<const RecordFunction*, int64_t>>
+    continuous_starts;
+thread_local int64_t continuous_countdown = 0;
+
+ContinuousRing& getContinuousRing() {
+  if (!continuous_ring) {
+    std::lock_guard<std::mutex> guard(continuous_rings_mutex);
+    continuous_ring = std::make_shared<ContinuousRing>(
+        continuous_ring_buffer_size.load(std::memory_order_relaxed));
+    continuous_rings[RecordFunction::getCurrentThreadId()] = continuous_ring;
+  }
+  return *continuous_ring;
+}
+
+bool shouldSampleContinuousOp() {
+  const int64_t period =
+      continuous_sample_period.load(std::memory_order_relaxed);
+  if (period <= 1) {
+    return true;
+  }
+  if (C10_LIKELY(--continuous_countdown > 0)) {
+    return false;
+  }
+  continuous_countdown = period;
+  return true;
+}
 
 } // namespace
 
@@ -189,6 +302,12 @@ void enableProfiler(ProfilerConfig config) {
       config.report_input_shapes);
   state = new_state;
 
+  if (config.report_arithmetic_intensity &&
+      !at::op_intensity_tracking_enabled()) {
+    at::set_op_intensity_tracking_enabled(true);
+    enabled_intensity_tracking = true;
+  }
+
   if(state == ProfilerState::CUDA) {
     // event recording appears to have some startup overhead, so we need to
     // to generate some dummy events first before recording synchronization events
@@ -219,6 +338,11 @@ thread_event_lists disableProfiler() {
   popCallback();
   state = ProfilerState::Disabled;
 
+  if (enabled_intensity_tracking) {
+    at::set_op_intensity_tracking_enabled(false);
+    enabled_intensity_tracking = false;
+  }
+
   if (old_state == ProfilerState::NVTX) {
     return thread_event_lists();
   } else {
@@ -240,9 +364,113 @@ thread_event_lists disableProfiler() {
   }
 }
 
+void enableContinuousProfiler(const ContinuousProfilerConfig& config) {
+  TORCH_CHECK(
+      !continuous_profiler_enabled.load(),
+      "continuous profiler is already enabled");
+  TORCH_CHECK(
+      config.ring_buffer_size > 0, "ring_buffer_size must be positive");
+  TORCH_CHECK(config.sample_period > 0, "sample_period must be positive");
+  continuous_ring_buffer_size.store(config.ring_buffer_size);
+  continuous_sample_period.store(config.sample_period);
+
+  pushCallback(
+      [](const RecordFunction& fn) {
+        if (!shouldSampleContinuousOp()) {
+          return;
+        }
+        continuous_starts.emplace_back(&fn, getTime());
+      },
+      [](const RecordFunction& fn) {
+        if (fn.getStartCallbacksThreadId() !=
+            RecordFunction::getCurrentThreadId()) {
+          // The start entry lives on another thread's stack; it is dropped
+          // there when an enclosing op pops through it.
+          return;
+        }
+        auto& starts = continuous_starts;
+        auto it = std::find_if(
+            starts.rbegin(),
+            starts.rend(),
+            [&](const std::pair<const RecordFunction*, int64_t>& entry) {
+              return entry.first == &fn;
+            });
+        if (it == starts.rend()) {
+          // not sampled
+          return;
+        }
+        const int64_t duration_ns = getTime() - it->second;
+        // this also drops deeper entries whose pop never ran on this thread
+        starts.erase(std::next(it).base(), starts.end());
+        auto& ring = getContinuousRing();
+        ring.record(ring.intern(fn.name().str()), duration_ns);
+      },
+      /* needs_inputs */ false);
+  continuous_profiler_enabled.store(true);
+}
+
+void disableContinuousProfiler() {
+  TORCH_CHECK(
+      continuous_profiler_enabled.load(),
+      "can't disable continuous profiler when it's not running");
+  popCallback();
+  continuous_profiler_enabled.store(false);
+}
+
+bool continuousProfilerEnabled() {
+  return continuous_profiler_enabled.load();
+}
+
+std::vector<OpHistogram> collectContinuousProfile() {
+  std::vector<std::shared_ptr<ContinuousRing>> rings;
+  {
+    std::lock_guard<std::mutex> guard(continuous_rings_mutex);
+    rings.reserve(continuous_rings.size());
+    for (const auto& kv : continuous_rings) {
+      rings.push_back(kv.second);
+    }
+  }
+
+  std::unordered_map<std::string, OpHistogram> histograms;
+  for (const auto& ring : rings) {
+    for (const auto& sample : ring->snapshot()) {
+      auto& histogram = histograms[sample.name];
+      if (histogram.count == 0) {
+        histogram.name = sample.name;
+      }
+      histogram.count += 1;
+      histogram.total_ns += sample.duration_ns;
+      size_t bucket = 0;
+      int64_t v = sample.duration_ns;
+      while (v > 1 && bucket < kContinuousProfileBuckets - 1) {
+        v >>= 1;
+        ++bucket;
+      }
+      histogram.buckets[bucket] += 1;
+    }
+  }
+
+  std::vector<OpHistogram> result;
+  result.reserve(histograms.size());
+  for (auto& kv : histograms) {
+    result.push_back(std::move(kv.second));
+  }
+  std::sort(
+      result.begin(), result.end(), [](const OpHistogram& a, const OpHistogram& b) {
+        return a.total_ns > b.total_ns;
+      });
+  return result;
+}
+
 void Event::record(bool record_cuda) {
+  if (at::op_intensity_tracking_enabled()) {
+    const auto counters = at::thread_op_intensity_counters();
+    bytes_read_ = counters.bytes_read;
+    bytes_written_ = counters.bytes_written;
+    flops_ = counters.flops;
+  }
   if (record_cuda) {
-    cuda_stubs->record(&device_, &event, &cpu_ns_);
+    cuda_stubs->record(&device_, &event, &cpu_ns_, &stream_id_);
     return;
   }
   cpu_ns_ = getTime();
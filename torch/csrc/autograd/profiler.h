@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <mutex>
 #include <memory>
@@ -26,7 +27,11 @@ struct Node;
 namespace profiler {
 
 struct TORCH_API CUDAStubs {
-  virtual void record(int* device, CUDAEventStub* event, int64_t* cpu_ns) {
+  virtual void record(
+      int* device,
+      CUDAEventStub* event,
+      int64_t* cpu_ns,
+      int64_t* stream_id) {
     fail();
   }
   virtual float elapsed(CUDAEventStub event, CUDAEventStub event2) {
@@ -105,11 +110,21 @@ enum class TORCH_API ProfilerState {
 };
 
 struct TORCH_API ProfilerConfig {
-  ProfilerConfig(ProfilerState state, bool report_input_shapes)
-      : state(state), report_input_shapes(report_input_shapes) {}
+  ProfilerConfig(
+      ProfilerState state,
+      bool report_input_shapes,
+      bool report_arithmetic_intensity = false)
+      : state(state),
+        report_input_shapes(report_input_shapes),
+        report_arithmetic_intensity(report_arithmetic_intensity) {}
   ~ProfilerConfig();
   ProfilerState state;
   bool report_input_shapes;
+  // When set, ops built on TensorIterator report their planned memory
+  // traffic and estimated FLOPs through the recorded events, so consumers
+  // can classify ops by roofline position.
+  // See Note [Arithmetic intensity counters] in ATen/native/TensorIterator.h
+  bool report_arithmetic_intensity;
 };
 
 enum class TORCH_API EventKind : uint16_t {
@@ -163,6 +178,26 @@ struct TORCH_API Event final {
   int device() const {
     return device_;
   }
+  // id of the CUDA stream current when the event was recorded, or -1 for
+  // CPU-only events; lets trace export place kernel intervals on per-stream
+  // timelines instead of one row per device.
+  int64_t stream_id() const {
+    return stream_id_;
+  }
+  // Monotonic per-thread arithmetic-intensity totals sampled when the event
+  // was recorded, or -1 when tracking was off.  Like cpu_ns_, these are
+  // absolute values; consumers diff a push/pop pair on the same thread to
+  // get the bytes and FLOPs attributable to that op.
+  // See Note [Arithmetic intensity counters] in ATen/native/TensorIterator.h
+  int64_t bytes_read() const {
+    return bytes_read_;
+  }
+  int64_t bytes_written() const {
+    return bytes_written_;
+  }
+  int64_t flops() const {
+    return flops_;
+  }
 private:
   // signed to allow for negative intervals, initialized for safety.
   int64_t cpu_ns_ = 0;
@@ -171,6 +206,10 @@ private:
   uint16_t thread_id_;
   std::vector<std::vector<int64_t>> shapes_;
   int device_ = -1;
+  int64_t stream_id_ = -1;
+  int64_t bytes_read_ = -1;
+  int64_t bytes_written_ = -1;
+  int64_t flops_ = -1;
   struct CUevent_st* event = nullptr;
 };
 
@@ -240,6 +279,46 @@ TORCH_API void enableProfiler(ProfilerConfig);
 TORCH_API thread_event_lists disableProfiler();
 TORCH_API bool profilerEnabled();
 
+// Continuous profiling mode.
+//
+// Unlike enableProfiler, which accumulates unbounded RangeEventLists and is
+// meant to bracket a region of interest, continuous mode keeps a fixed-size
+// per-thread ring buffer of completed-op samples that newer samples simply
+// overwrite, so it can stay enabled on a live service. Ring writes are
+// lock-free (one writer per ring; readers validate slots with a sequence
+// counter and skip torn ones) and only every sample_period-th op per thread
+// is recorded. collectContinuousProfile() may be called from any thread at
+// any time; it aggregates the current ring contents - a sliding window over
+// recent traffic - into per-op duration histograms.
+//
+// Both modes share the global RecordFunction callback stack, so enable/
+// disable calls must nest correctly with enableProfiler/disableProfiler.
+constexpr size_t kContinuousProfileBuckets = 32;
+
+struct TORCH_API ContinuousProfilerConfig {
+  /* implicit */ ContinuousProfilerConfig(
+      size_t ring_buffer_size = 8192,
+      int64_t sample_period = 1)
+      : ring_buffer_size(ring_buffer_size), sample_period(sample_period) {}
+  size_t ring_buffer_size; // samples kept per thread
+  int64_t sample_period; // record every Nth op per thread
+};
+
+struct TORCH_API OpHistogram {
+  std::string name;
+  int64_t count = 0;
+  int64_t total_ns = 0;
+  // bucket i counts samples with duration in [2^i, 2^(i+1)) ns; the last
+  // bucket absorbs everything longer
+  std::array<int64_t, kContinuousProfileBuckets> buckets{{}};
+};
+
+TORCH_API void enableContinuousProfiler(
+    const ContinuousProfilerConfig& config = ContinuousProfilerConfig());
+TORCH_API void disableContinuousProfiler();
+TORCH_API bool continuousProfilerEnabled();
+TORCH_API std::vector<OpHistogram> collectContinuousProfile();
+
 
 // Usage:
 //   {
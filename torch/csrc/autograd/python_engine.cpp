@@ -46,13 +46,13 @@ Engine& PythonEngine::get_python_engine() {
   return engine;
 }
 
-void PythonEngine::thread_init(int device) {
+void PythonEngine::thread_init(int device, int queue_index) {
   // Create a PyThreadState, but release the GIL. This lets pybind11::gil_scoped_acquire calls
   // inside thread_main acquire the GIL without having to create a new
   // PyThreadState each time.
   pybind11::gil_scoped_acquire gil;
   pybind11::gil_scoped_release no_gil;
-  Engine::thread_init(device);
+  Engine::thread_init(device, queue_index);
 }
 
 void PythonEngine::thread_on_exception(
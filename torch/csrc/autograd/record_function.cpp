@@ -2,6 +2,7 @@
 #include <torch/csrc/autograd/function.h>
 #include <torch/csrc/autograd/profiler.h>
 #include <torch/csrc/utils/memory.h>
+#include <algorithm>
 #include <cstdlib>
 #include <random>
 
@@ -36,7 +37,13 @@ class CallbackManager {
       RecordFunctionCallback start,
       RecordFunctionCallback end,
       bool needs_inputs,
-      bool sampled) {
+      bool sampled,
+      double sampling_prob,
+      std::unordered_set<std::string> op_filter) {
+    TORCH_CHECK(
+        sampling_prob > 0.0 && sampling_prob <= 1.0,
+        "invalid callback sampling probability: ",
+        sampling_prob);
     start_callbacks.push_back(std::move(start));
     end_callbacks.push_back(std::move(end));
     if (callback_needs_inputs > 0 || needs_inputs) {
@@ -46,6 +53,8 @@ class CallbackManager {
     if (sampled) {
       ++num_sampled_callbacks;
     }
+    callback_sampling_prob.push_back(sampling_prob);
+    callback_op_filter.push_back(std::move(op_filter));
   }
 
   void popCallback() {
@@ -61,6 +70,20 @@ class CallbackManager {
       --num_sampled_callbacks;
     }
     is_callback_sampled.pop_back();
+    callback_sampling_prob.pop_back();
+    callback_op_filter.pop_back();
+  }
+
+  // Decides whether callback idx runs for an op with the given name; called
+  // once per RecordFunction (in before()) so that the end callback replays
+  // the same decision as the start callback.
+  bool shouldRunCallback(size_t idx, const char* name) {
+    const double prob = callback_sampling_prob[idx];
+    if (prob < 1.0 && sample_zero_one() >= prob) {
+      return false;
+    }
+    const auto& filter = callback_op_filter[idx];
+    return filter.empty() || filter.count(name) != 0;
   }
 
   bool hasCallbacks() {
@@ -78,6 +101,8 @@ class CallbackManager {
   std::vector<RecordFunctionCallback> start_callbacks;
   std::vector<RecordFunctionCallback> end_callbacks;
   std::vector<bool> is_callback_sampled;
+  std::vector<double> callback_sampling_prob;
+  std::vector<std::unordered_set<std::string>> callback_op_filter;
   size_t num_sampled_callbacks = 0;
   size_t callback_needs_inputs = 0;
   bool sampling_prop_set = false;
@@ -120,9 +145,16 @@ void pushCallback(
     RecordFunctionCallback start,
     RecordFunctionCallback end,
     bool needs_inputs,
-    bool sampled) {
+    bool sampled,
+    double sampling_prob,
+    std::unordered_set<std::string> op_filter) {
   manager().pushCallback(
-      std::move(start), std::move(end), needs_inputs, sampled);
+      std::move(start),
+      std::move(end),
+      needs_inputs,
+      sampled,
+      sampling_prob,
+      std::move(op_filter));
 }
 
 void popCallback() {
@@ -209,8 +241,19 @@ void RecordFunction::before(Node* fn, int64_t sequence_nr) {
 
 void RecordFunction::processCallbacks() {
   threadId_ = getCurrentThreadId();
+  // Precompute which callbacks run for this op, according to their
+  // per-callback sampling probability and op-name filter; end() reuses the
+  // mask so unsampled invocations skip the end callback as well.
+  const size_t mask_bits =
+      std::min<size_t>(manager().start_callbacks.size(), 64);
+  for (size_t idx = 0; idx < mask_bits; ++idx) {
+    if (!manager().shouldRunCallback(idx, name_.str())) {
+      callbacks_mask_ &= ~(uint64_t(1) << idx);
+    }
+  }
   for (size_t idx = 0; idx < manager().start_callbacks.size(); ++idx) {
-    if (!manager().is_callback_sampled[idx] || run_sampled_) {
+    if ((!manager().is_callback_sampled[idx] || run_sampled_) &&
+        (idx >= 64 || ((callbacks_mask_ >> idx) & 1))) {
       try {
         manager().start_callbacks[idx](*this);
       } catch (const std::exception &e) {
@@ -227,7 +270,8 @@ RecordFunction::~RecordFunction() {
 void RecordFunction::end() {
   if (initialized_) {
     for (size_t idx = 0; idx < manager().end_callbacks.size(); ++idx) {
-      if (!manager().is_callback_sampled[idx] || run_sampled_) {
+      if ((!manager().is_callback_sampled[idx] || run_sampled_) &&
+          (idx >= 64 || ((callbacks_mask_ >> idx) & 1))) {
         try {
           manager().end_callbacks[idx](*this);
         } catch (const std::exception &e) {
@@ -4,6 +4,8 @@
 #include <c10/util/SmallVector.h>
 #include <torch/csrc/WindowsTorchApiMacro.h>
 
+#include <unordered_set>
+
 namespace torch { namespace autograd {
 
 struct Node;
@@ -135,6 +137,13 @@ struct TORCH_API RecordFunction {
   bool initialized_ = false;
   bool run_sampled_ = false;
 
+  // Bitset of callbacks that run for this particular RecordFunction, as
+  // decided by their per-callback sampling probability and op-name filter.
+  // Computed once in before() so the end callbacks replay exactly the
+  // decisions of the start callbacks; callbacks past the bitset width
+  // always run.
+  uint64_t callbacks_mask_ = ~uint64_t(0);
+
   // is_current_ true means that this record function updates thread local
   // current record function pointer;
   // true only in case of scope-based record functions, i.e.
@@ -177,12 +186,21 @@ TORCH_API void runBeforeCallbacks(
 
 // WARNING: all calls to pushCallback/popCallback are not thread safe and
 // must not overlap with other code execution
+//
+// sampling_prob - probability that a given op invocation runs this callback
+// pair; unsampled invocations skip both the start and the end callback.
+// Unlike the global setSamplingProbability, the coin is tossed per callback,
+// so a 1-in-N telemetry observer can coexist with an always-on one.
+// op_filter - when non-empty, the callback pair only runs for ops whose
+// name is in the set.
 using RecordFunctionCallback = std::function<void(const RecordFunction&)>;
 TORCH_API void pushCallback(
     RecordFunctionCallback start,
     RecordFunctionCallback end = [](const RecordFunction&){},
     bool needs_inputs = false,
-    bool sampled = false);
+    bool sampled = false,
+    double sampling_prob = 1.0,
+    std::unordered_set<std::string> op_filter = {});
 TORCH_API void popCallback();
 
 } // namespace profiler
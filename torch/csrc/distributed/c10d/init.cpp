@@ -17,9 +17,11 @@
 #endif
 
 #include <c10d/PrefixStore.hpp>
+#include <c10d/ProcessGroupHierarchical.hpp>
 #include <c10d/ProcessGroupRoundRobin.hpp>
 #include <c10d/TCPStore.hpp>
 #include <pybind11/chrono.h>
+#include <pybind11/functional.h>
 
 #include <torch/csrc/Exceptions.h>
 #include <torch/csrc/distributed/c10d/comm.h>
@@ -122,11 +124,13 @@ PyObject* c10d_init(PyObject* _unused) {
               std::vector<std::vector<torch::autograd::Variable>>,
               std::vector<std::vector<size_t>>,
               std::shared_ptr<::c10d::ProcessGroup>,
-              std::vector<std::vector<bool>>>(),
+              std::vector<std::vector<bool>>,
+              bool>(),
           py::arg("replicas"),
           py::arg("bucket_indices"),
           py::arg("process_group"),
-          py::arg("expect_sparse_gradients") = std::vector<std::vector<bool>>())
+          py::arg("expect_sparse_gradients") = std::vector<std::vector<bool>>(),
+          py::arg("gradient_as_bucket_view") = false)
       .def(
           "initialize_buckets",
           &::c10d::Reducer::initialize_buckets,
@@ -140,6 +144,14 @@ PyObject* c10d_init(PyObject* _unused) {
           [](::c10d::Reducer& reducer, const torch::autograd::Variable& output)
               -> void { reducer.prepare_for_backward({output}); },
           py::call_guard<py::gil_scoped_release>())
+      .def(
+          "register_builtin_fp16_comm_hook",
+          &::c10d::Reducer::register_builtin_fp16_comm_hook,
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "register_bucket_ready_hook",
+          &::c10d::Reducer::register_bucket_ready_hook,
+          py::call_guard<py::gil_scoped_release>())
       .def("get_backward_stats", &::c10d::Reducer::get_backward_stats);
 
   py::enum_<::c10d::ReduceOp>(module, "ReduceOp", R"(
@@ -250,6 +262,10 @@ They are used in specifying strategies for reduction collectives, e.g.,
                  const std::chrono::milliseconds& timeout) {
                 store.wait(keys, timeout);
               },
+              py::call_guard<py::gil_scoped_release>())
+          .def(
+              "wait_for_key_count",
+              &::c10d::Store::waitForKeyCount,
               py::call_guard<py::gil_scoped_release>());
 
   shared_ptr_class_<::c10d::FileStore>(module, "FileStore", store)
@@ -504,6 +520,20 @@ They are used in specifying strategies for reduction collectives, e.g.,
       py::arg("process_groups"),
       py::call_guard<py::gil_scoped_release>());
 
+  module.def(
+      "_hierarchical_process_group",
+      [](std::shared_ptr<::c10d::ProcessGroup> intraGroup,
+         std::shared_ptr<::c10d::ProcessGroup> interGroup,
+         int rank) -> std::shared_ptr<::c10d::ProcessGroup> {
+        const auto size = intraGroup->getSize() * interGroup->getSize();
+        return std::make_shared<::c10d::ProcessGroupHierarchical>(
+            rank, size, std::move(intraGroup), std::move(interGroup));
+      },
+      py::arg("intra_group"),
+      py::arg("inter_group"),
+      py::arg("rank"),
+      py::call_guard<py::gil_scoped_release>());
+
 #ifdef USE_C10D_GLOO
   auto processGroupGloo = shared_ptr_class_<::c10d::ProcessGroupGloo>(
       module, "ProcessGroupGloo", processGroup);
@@ -515,7 +545,16 @@ They are used in specifying strategies for reduction collectives, e.g.,
       .def(py::init<>())
       .def_readwrite("devices", &::c10d::ProcessGroupGloo::Options::devices)
       .def_readwrite("timeout", &::c10d::ProcessGroupGloo::Options::timeout)
-      .def_readwrite("threads", &::c10d::ProcessGroupGloo::Options::threads);
+      .def_readwrite("threads", &::c10d::ProcessGroupGloo::Options::threads)
+      .def_readwrite(
+          "max_allreduce_segment_size",
+          &::c10d::ProcessGroupGloo::Options::maxAllreduceSegmentSize)
+      .def_readwrite(
+          "busy_poll_wait",
+          &::c10d::ProcessGroupGloo::Options::busyPollWait)
+      .def_readwrite(
+          "busy_poll_size_threshold",
+          &::c10d::ProcessGroupGloo::Options::busyPollSizeThreshold);
 
   processGroupGloo.def_static(
       "create_device",
@@ -585,7 +624,24 @@ They are used in specifying strategies for reduction collectives, e.g.,
           py::arg("rank"),
           py::arg("size"),
           py::arg("timeout") = std::chrono::milliseconds(
-              ::c10d::ProcessGroupNCCL::kProcessGroupNCCLOpTimeoutMillis));
+              ::c10d::ProcessGroupNCCL::kProcessGroupNCCLOpTimeoutMillis))
+      .def(
+          "_split",
+          &::c10d::ProcessGroupNCCL::split,
+          py::arg("store"),
+          py::arg("ranks"),
+          py::call_guard<py::gil_scoped_release>())
+      .def(
+          "_get_collective_timing_stats",
+          [](::c10d::ProcessGroupNCCL& pg) {
+            const auto stats = pg.getCollectiveTimingStats();
+            py::dict dict;
+            dict["histogram"] = stats.histogram;
+            dict["count"] = stats.count;
+            dict["total_ms"] = stats.totalMs;
+            dict["max_ms"] = stats.maxMs;
+            return dict;
+          });
 #endif
 
 #ifdef USE_C10D_MPI
@@ -43,10 +43,12 @@ Reducer::Reducer(
     std::vector<std::vector<torch::autograd::Variable>> replicas,
     std::vector<std::vector<size_t>> bucket_indices,
     std::shared_ptr<c10d::ProcessGroup> process_group,
-    std::vector<std::vector<bool>> expect_sparse_gradients)
+    std::vector<std::vector<bool>> expect_sparse_gradients,
+    bool gradient_as_bucket_view)
     : replicas_(std::move(replicas)),
       process_group_(std::move(process_group)),
       expect_sparse_gradients_(std::move(expect_sparse_gradients)),
+      gradient_as_bucket_view_(gradient_as_bucket_view),
       expect_autograd_hooks_(false),
       require_finalize_(false),
       next_bucket_(0),
@@ -223,6 +225,12 @@ void Reducer::mark_variable_ready_dense(VariableIndex index) {
   auto bucket_view = replica.contents.narrow(0, offset, length);
   auto& grad = variable.grad();
   if (grad.defined()) {
+    // If the gradient was pointed at the bucket on a previous iteration
+    // (see `gradient_as_bucket_view_`), autograd already accumulated into
+    // the bucket and there is nothing to copy.
+    if (gradient_as_bucket_view_ && grad.is_alias_of(bucket_view)) {
+      return;
+    }
     // Ensure that the gradient type matches the bucket type.
     TORCH_CHECK(
         grad.options().type_equal(bucket_view.options()),
@@ -232,12 +240,19 @@ void Reducer::mark_variable_ready_dense(VariableIndex index) {
         grad.toString());
     // Assert that the grad tensor and the bucket don't share storage.
     // If they did, we could avoid the copy altogether.
-    // The reason for not doing this is that existing code calls
+    // The reason for not doing this by default is that existing code calls
     // `detach_` from `zero_grad`, which is incompatible with views.
     TORCH_INTERNAL_ASSERT(!grad.is_alias_of(bucket_view));
     TORCH_INTERNAL_ASSERT(grad.device() == bucket_view.device());
     TORCH_INTERNAL_ASSERT(grad.numel() == bucket_view.numel());
     bucket_view.copy_(grad.view({-1}), /* non_blocking */ true);
+    if (gradient_as_bucket_view_) {
+      // From now on let the gradient alias the bucket so the next backward
+      // pass accumulates directly into it. If user code later calls
+      // `detach_` on the grad, the aliasing is broken and re-established
+      // (with a copy) on the following iteration.
+      grad = bucket_view.view(variable.sizes());
+    }
   } else {
     bucket_view.zero_();
   }
@@ -398,8 +413,10 @@ void Reducer::mark_bucket_ready(size_t bucket_index) {
   for (; next_bucket_ < buckets_.size() && buckets_[next_bucket_].pending == 0;
        next_bucket_++) {
     auto& bucket = buckets_[next_bucket_];
+    const bool use_comm_hook = comm_hook_ && !bucket.expect_sparse_gradient;
     std::vector<at::Tensor> tensors;
     tensors.reserve(bucket.replicas.size());
+    bucket.compressed.clear();
     for (const auto& replica : bucket.replicas) {
       // TODO(@pietern): Ensure proper synchronization with the CUDA events
       // that recorded copies into this contents tensor. If these copies are
@@ -410,7 +427,15 @@ void Reducer::mark_bucket_ready(size_t bucket_index) {
       // these operations are implicitly sequenced, and we don't need to
       // do any extra synchronization here.
       //
-      tensors.push_back(replica.contents);
+      if (use_comm_hook) {
+        // The collective reduces the compressed tensors; they are held on
+        // the bucket so finalize_bucket_dense can decompress them back into
+        // the contents once the work completes.
+        bucket.compressed.push_back(comm_hook_->compress(replica.contents));
+        tensors.push_back(bucket.compressed.back());
+      } else {
+        tensors.push_back(replica.contents);
+      }
     }
     bucket.work = process_group_->allreduce(tensors);
   }
@@ -621,6 +646,19 @@ void Reducer::prepare_for_backward(
 
 // A bucket with one or more dense tensors needs to be unflattened.
 void Reducer::finalize_bucket_dense(Bucket& bucket) {
+  // If a communication hook compressed this bucket, write the reduced
+  // values back into the full-precision contents before unflattening.
+  if (!bucket.compressed.empty()) {
+    TORCH_INTERNAL_ASSERT(comm_hook_);
+    TORCH_INTERNAL_ASSERT(bucket.compressed.size() == bucket.replicas.size());
+    for (size_t replica_index = 0; replica_index < bucket.replicas.size();
+         replica_index++) {
+      comm_hook_->decompress(
+          bucket.compressed[replica_index],
+          bucket.replicas[replica_index].contents);
+    }
+    bucket.compressed.clear();
+  }
   for (size_t replica_index = 0; replica_index < bucket.replicas.size();
        replica_index++) {
     auto& replica = bucket.replicas[replica_index];
@@ -671,10 +709,18 @@ void Reducer::finalize_bucket_dense(Bucket& bucket) {
 
       // If a parameter is globally unused, we keep its grad untouched.
       if (!global_unused) {
-        if (!grad.defined()) {
-          grad = at::empty(bucket_view.sizes(), bucket_view.options());
+        if (gradient_as_bucket_view_) {
+          // The gradient either already is (or becomes) a view into the
+          // bucket, so the reduced values are visible without a copy.
+          if (!grad.defined() || !grad.is_alias_of(bucket_view)) {
+            grad = bucket_view;
+          }
+        } else {
+          if (!grad.defined()) {
+            grad = at::empty(bucket_view.sizes(), bucket_view.options());
+          }
+          grad.copy_(bucket_view);
         }
-        grad.copy_(bucket_view);
       }
     }
   }
@@ -706,6 +752,9 @@ void Reducer::finalize_backward() {
   TORCH_INTERNAL_ASSERT(next_bucket_ == buckets_.size());
 
   // Wait for asynchronous reduction to complete and unflatten contents.
+  // Buckets are waited on in their reduction order, so while we finalize
+  // (and run the bucket ready hook for) bucket i, the allreduces for
+  // buckets i+1 and later are still in flight.
   for (auto& bucket : buckets_) {
     TORCH_INTERNAL_ASSERT(bucket.work);
     bucket.work->wait();
@@ -714,6 +763,11 @@ void Reducer::finalize_backward() {
     } else {
       finalize_bucket_dense(bucket);
     }
+    // This bucket's gradients are final; the hook can start updating its
+    // parameters while the remaining communication overlaps.
+    if (bucket_ready_hook_) {
+      bucket_ready_hook_(bucket.variable_indices);
+    }
   }
 
   // Reset unused parameter accounting.
@@ -732,6 +786,44 @@ void Reducer::finalize_backward() {
   local_used_maps_reduced_ = false;
 }
 
+void Reducer::register_bucket_ready_hook(
+    std::function<void(const std::vector<size_t>&)> hook) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(
+      !expect_autograd_hooks_,
+      "`register_bucket_ready_hook` must NOT be called during autograd "
+      "execution.");
+  TORCH_CHECK(hook, "Expected a callable bucket ready hook.");
+  bucket_ready_hook_ = std::move(hook);
+}
+
+void Reducer::register_comm_hook(CommHook hook) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  TORCH_CHECK(
+      !expect_autograd_hooks_,
+      "`register_comm_hook` must NOT be called during autograd execution.");
+  TORCH_CHECK(
+      hook.compress && hook.decompress,
+      "A communication hook requires both a compress and a decompress "
+      "function.");
+  comm_hook_ = std::move(hook);
+}
+
+void Reducer::register_builtin_fp16_comm_hook() {
+  CommHook hook;
+  hook.compress = [](const at::Tensor& contents) {
+    // One elementwise pass over the flat bucket; the result is half the
+    // bytes on the wire.  The bucket was already divided by the world size,
+    // which keeps the half-precision sum away from overflow.
+    return contents.to(at::kHalf);
+  };
+  hook.decompress = [](const at::Tensor& reduced, at::Tensor& contents) {
+    // copy_ upcasts back to the contents dtype.
+    contents.copy_(reduced);
+  };
+  register_comm_hook(std::move(hook));
+}
+
 namespace {
 
 // Tensors may be coalesced into buckets. Buckets must contain tensors of
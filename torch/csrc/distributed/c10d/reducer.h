@@ -13,17 +13,36 @@
 
 namespace c10d {
 
+// A communication hook intercepts each dense bucket around its allreduce.
+// `compress` receives the flat bucket contents and returns the tensor that
+// is handed to the collective; `decompress` receives the reduced tensor and
+// writes the result back into the bucket contents in place.  Both run on
+// the bucket's device and must behave identically across processes, since
+// the compressed tensors are what the collective operates on.
+struct CommHook {
+  std::function<at::Tensor(const at::Tensor& contents)> compress;
+  std::function<void(const at::Tensor& reduced, at::Tensor& contents)>
+      decompress;
+};
+
 class Reducer {
  public:
   // The constructor takes a list of variables for every model replica.
   // The bucket assignment for this reducer is specified as a list of
   // buckets, each of which is specified as a list of indices into the
   // variables list for **a single replica** (i.e. `variables[0]`).
+  // If `gradient_as_bucket_view` is true, gradients are pointed at views
+  // into the flat bucket tensor after the first backward pass, which
+  // eliminates the grad-to-bucket copy on subsequent iterations. Note that
+  // with this option the allreduced (and pre-divided) values are what the
+  // gradients alias, and calling `detach_` on a grad (e.g. zero_grad) simply
+  // re-establishes the copy on the next iteration.
   explicit Reducer(
       std::vector<std::vector<torch::autograd::Variable>> replicas,
       std::vector<std::vector<size_t>> bucket_indices,
       std::shared_ptr<c10d::ProcessGroup> process_group,
-      std::vector<std::vector<bool>> expect_sparse_gradients);
+      std::vector<std::vector<bool>> expect_sparse_gradients,
+      bool gradient_as_bucket_view = false);
 
   ~Reducer() noexcept(false);
 
@@ -47,6 +66,30 @@ class Reducer {
     return backward_stats_;
   }
 
+  // Registers a communication hook that compresses dense buckets before the
+  // allreduce and decompresses them after it completes.  Must not be called
+  // while a backward pass is in flight.  Sparse gradients are not affected.
+  void register_comm_hook(CommHook hook);
+
+  // Registers the built-in fp16 compression hook: bucket contents are cast
+  // to half precision before the allreduce and cast-copied back afterwards,
+  // halving the bytes on the wire at the cost of one extra elementwise pass
+  // per direction.  The prescale by world size that the reducer already does
+  // doubles as the overflow guard for the half-precision sum.
+  void register_builtin_fp16_comm_hook();
+
+  // Registers a hook that fires once per bucket, as soon as that bucket's
+  // allreduce has completed and its gradients have been written back.  The
+  // hook receives the indices of the variables in the bucket (indices into
+  // the `variables[0]` list the reducer was constructed with).  Buckets
+  // complete in their predetermined reduction order, while the allreduces
+  // of the remaining buckets are still in flight, so the hook can start
+  // optimizer updates for the finished parameters and hide the optimizer
+  // walk behind the remaining communication.  Must not be called while a
+  // backward pass is in flight.
+  void register_bucket_ready_hook(
+      std::function<void(const std::vector<size_t>&)> hook);
+
  protected:
   // Forward declaration.
   struct Bucket;
@@ -61,6 +104,7 @@ class Reducer {
   std::vector<std::vector<torch::autograd::Variable>> replicas_;
   std::shared_ptr<c10d::ProcessGroup> process_group_;
   std::vector<std::vector<bool>> expect_sparse_gradients_;
+  const bool gradient_as_bucket_view_;
 
   std::vector<std::vector<std::shared_ptr<torch::autograd::Node>>>
       grad_accumulators_;
@@ -92,6 +136,12 @@ class Reducer {
   // Work handle for allreduce on local_used_maps_
   std::shared_ptr<c10d::ProcessGroup::Work> local_used_work_;
 
+  // Optional communication hook; see register_comm_hook.
+  c10::optional<CommHook> comm_hook_;
+
+  // Optional per-bucket completion hook; see register_bucket_ready_hook.
+  std::function<void(const std::vector<size_t>&)> bucket_ready_hook_;
+
   void mark_variable_ready_dense(VariableIndex index);
 
   void mark_variable_ready_sparse(VariableIndex index);
@@ -160,6 +210,11 @@ class Reducer {
     // Keep work handle around when this set of buckets is being reduced.
     std::shared_ptr<c10d::ProcessGroup::Work> work;
 
+    // Compressed replica contents while a communication hook is in flight
+    // (one tensor per replica); these are what the collective reduces, and
+    // what gets decompressed back into the contents once it completes.
+    std::vector<at::Tensor> compressed;
+
     // If this bucket should expect a single sparse gradient.
     // Implies: replicas[i].variables.size() == 1.
     bool expect_sparse_gradient = false;
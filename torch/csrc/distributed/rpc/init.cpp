@@ -395,6 +395,19 @@ If the future completes with an error, an exception is thrown.
     return RRefContext::getInstance().getDebugInfo();
   });
 
+  module.def(
+      "_set_rref_value_cache_enabled",
+      [](bool enabled) {
+        RRefContext::getInstance().setValueCacheEnabled(enabled);
+      },
+      py::arg("enabled"));
+
+  module.def(
+      "_prefetch_rrefs",
+      &PyRRef::prefetch,
+      py::arg("rrefs"),
+      py::call_guard<py::gil_scoped_release>());
+
   module.def(
       "_cleanup_python_rpc_handler",
       []() { PythonRpcHandler::getInstance().cleanup(); },
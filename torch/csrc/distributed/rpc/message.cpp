@@ -79,6 +79,7 @@ bool Message::isRequest() const {
       // RRef related internal messages
       MessageType::SCRIPT_RREF_FETCH_CALL == type_ ||
       MessageType::PYTHON_RREF_FETCH_CALL == type_ ||
+      MessageType::RREF_BATCH_FETCH_CALL == type_ ||
       MessageType::RREF_USER_DELETE == type_ ||
       MessageType::RREF_CHILD_ACCEPT == type_ ||
       MessageType::RREF_FORK_REQUEST == type_ ||
@@ -95,6 +96,7 @@ bool Message::isResponse() const {
       MessageType::REMOTE_RET == type_ || // ret of dist.remote
       MessageType::SCRIPT_RREF_FETCH_RET == type_ || // ret on RRef::toHere()
       MessageType::PYTHON_RREF_FETCH_RET == type_ || // ret on RRef::toHere()
+      MessageType::RREF_BATCH_FETCH_RET == type_ || // ret of RRef prefetch
       MessageType::EXCEPTION == type_ || // propagate back exceptions
       MessageType::RREF_ACK == type_ || // ret of other types
       // Autograd response
@@ -44,6 +44,10 @@ enum MessageType {
   CLEANUP_AUTOGRAD_CONTEXT_REQ = 19,
   CLEANUP_AUTOGRAD_CONTEXT_RESP = 20,
 
+  // Messages to batch-fetch the values of several RRefs from one owner
+  RREF_BATCH_FETCH_CALL = 21, // A user revalidates/fetches a list of RRefs
+  RREF_BATCH_FETCH_RET = 22, // Owner sends versions and stale values back
+
   // Other internal message types
   EXCEPTION = 55,
   UNKNOWN = 60
@@ -7,6 +7,14 @@
 
 #include <Python.h>
 
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 namespace torch {
 namespace distributed {
 namespace rpc {
@@ -45,6 +53,31 @@ double ProcessGroupAgent::AverageMetricsTracker::computeAverage() {
   return currentCount_ == 0 ? 0 : currentSum_ / (double)currentCount_;
 }
 
+std::shared_ptr<std::string> ProcessGroupAgent::SendBufferPool::acquire() {
+  std::unique_ptr<std::string> buf;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!free_.empty()) {
+      buf = std::move(free_.back());
+      free_.pop_back();
+    }
+  }
+  if (!buf) {
+    buf = std::make_unique<std::string>();
+  }
+  return std::shared_ptr<std::string>(buf.release(), [this](std::string* s) {
+    std::unique_ptr<std::string> holder(s);
+    if (holder->capacity() > kMaxPooledCapacity) {
+      return;
+    }
+    holder->clear();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_.size() < kMaxPooledBuffers) {
+      free_.push_back(std::move(holder));
+    }
+  });
+}
+
 ////////////////////////  ProcessGroupAgent  /////////////////////////////////
 
 const ProcessGroupAgent::steady_clock_time_point
@@ -58,6 +91,34 @@ const std::string kClientActiveCalls = "agent.client_active_calls";
 const std::string kServerActiveCalls = "agent.server_active_calls";
 const std::string kServerActiveAsyncCalls = "agent.server_active_async_calls";
 
+// Note [RPC send batching]
+//
+// Every message normally costs a preamble send plus a payload send on the
+// underlying ProcessGroup, which dominates the cost of workloads that issue
+// thousands of tiny RPCs (e.g. embedding lookups). When
+// TORCH_RPC_BATCH_WINDOW_US is set to a non-zero number of microseconds,
+// outbound messages smaller than TORCH_RPC_BATCH_MAX_BYTES (default 64KB)
+// are parked in a per-destination queue instead of being sent immediately; a
+// background thread flushes each queue after the window elapses, sending the
+// accumulated messages as one concatenated buffer that the receiver splits
+// back into individual messages. Batching trades up to one window of added
+// latency per message for a fraction of the per-send overhead, so it is off
+// by default.
+//
+// A batch travels with kMessageBatchType in the preamble type field (a value
+// no MessageType uses) and the sub-message count in the id field. Inside the
+// buffer every sub-message is framed as {type, id, size} followed by its
+// serialized bytes.
+constexpr int64_t kMessageBatchType = -1;
+
+static size_t approxMessageSize(const Message& message) {
+  size_t size = message.payload().size();
+  for (const auto& tensor : message.tensors()) {
+    size += tensor.element_size() * tensor.numel();
+  }
+  return size;
+}
+
 void ProcessGroupAgent::collectNames() {
   const std::string& workerName = workerInfo_.name_;
   const auto worldSize = pg_->getSize();
@@ -89,6 +150,74 @@ void ProcessGroupAgent::collectNames() {
   }
 }
 
+// Identifier that two processes share iff they can reach each other's
+// shared-memory segments: the hostname plus the kernel boot id. Containers
+// that share a kernel but not /dev/shm are expected to carry distinct
+// hostnames, the same assumption torch.multiprocessing relies on. Returns
+// an empty string (disabling the shared-memory path) on platforms without
+// these facilities or when TORCH_RPC_DISABLE_SHM is set.
+static std::string hostFingerprint() {
+#ifdef _WIN32
+  return std::string();
+#else
+  auto disabled = std::getenv("TORCH_RPC_DISABLE_SHM");
+  if (disabled && strcmp(disabled, "0") != 0) {
+    return std::string();
+  }
+  char hostname[256];
+  if (gethostname(hostname, sizeof(hostname)) != 0) {
+    return std::string();
+  }
+  hostname[sizeof(hostname) - 1] = '\0';
+  std::string fingerprint(hostname);
+  std::ifstream bootIdFile("/proc/sys/kernel/random/boot_id");
+  std::string bootId;
+  if (bootIdFile && std::getline(bootIdFile, bootId)) {
+    fingerprint.append("/").append(bootId);
+  }
+  return fingerprint;
+#endif
+}
+
+void ProcessGroupAgent::collectSameHostPeers() {
+  const auto worldSize = pg_->getSize();
+  sameHostPeers_.assign(worldSize, false);
+
+  // Fixed-size buffer for the allgather; a fingerprint that does not fit is
+  // treated like an empty one. Every rank must run the collective, even the
+  // ones that locally disable the shared-memory path, since receiving
+  // shared-memory messages stays supported either way.
+  constexpr int64_t kMaxFingerprintLen = 512;
+  std::string fingerprint = hostFingerprint();
+  if (fingerprint.size() >= static_cast<size_t>(kMaxFingerprintLen)) {
+    fingerprint.clear();
+  }
+
+  torch::Tensor fingerprintTensor =
+      torch::zeros({kMaxFingerprintLen}, torch::kChar);
+  memcpy(
+      fingerprintTensor.storage().data(),
+      fingerprint.c_str(),
+      fingerprint.length());
+  std::vector<torch::Tensor> inputFingerprint = {fingerprintTensor};
+  std::vector<std::vector<torch::Tensor>> outputFingerprints(1);
+  for (int i = 0; i < worldSize; ++i) {
+    outputFingerprints[0].emplace_back(
+        torch::empty({kMaxFingerprintLen}, {torch::kChar}));
+  }
+  pg_->allgather(outputFingerprints, inputFingerprint)->wait();
+
+  if (fingerprint.empty()) {
+    return;
+  }
+  for (int i = 0; i < worldSize; ++i) {
+    torch::Tensor& tensor = outputFingerprints[0][i];
+    std::string peerFingerprint(
+        (const char*)tensor.storage().data<signed char>());
+    sameHostPeers_[i] = (peerFingerprint == fingerprint);
+  }
+}
+
 ProcessGroupAgent::ProcessGroupAgent(
     std::string workerName,
     std::shared_ptr<c10d::ProcessGroup> pg,
@@ -109,6 +238,14 @@ ProcessGroupAgent::ProcessGroupAgent(
   metrics_[ProcessGroupAgentMetrics::GIL_WAIT_TIME] =
       std::make_unique<AverageMetricsTracker>(kGilAverageWaitTime);
   collectNames();
+  collectSameHostPeers();
+  // See Note [RPC send batching]
+  if (auto windowEnv = std::getenv("TORCH_RPC_BATCH_WINDOW_US")) {
+    sendBatchWindow_ = std::chrono::microseconds(std::atoll(windowEnv));
+  }
+  if (auto maxBytesEnv = std::getenv("TORCH_RPC_BATCH_MAX_BYTES")) {
+    sendBatchMaxBytes_ = std::atoll(maxBytesEnv);
+  }
   TORCH_CHECK(
       nameMap_.size() > 1,
       "ProcessGroupAgent requires world_size to "
@@ -226,6 +363,9 @@ void ProcessGroupAgent::sync() {
   pg_->barrier()->wait();
   // block until all peers agree that all sent messages have been processed.
   do {
+    // Push out any messages still waiting in the batching window, so they
+    // are covered by the completion counts checked below.
+    flushBatchedSends();
     // Finish all send/recv tasks in the thread pool
     threadPool_.waitWorkComplete();
     // As there could be nested RPC calls, or response callback could also
@@ -242,6 +382,9 @@ void ProcessGroupAgent::start() {
   listenerThread_ = std::thread(&ProcessGroupAgent::listenLoop, this);
   futureTimeoutThread_ =
       std::thread(&ProcessGroupAgent::pollTimedOutRPCs, this);
+  if (sendBatchWindow_.count() > 0) {
+    batchFlushThread_ = std::thread(&ProcessGroupAgent::batchFlushLoop, this);
+  }
 }
 
 void ProcessGroupAgent::shutdown() {
@@ -254,6 +397,42 @@ void ProcessGroupAgent::shutdown() {
   lock.unlock();
   futureTimeoutCV_.notify_one();
   futureTimeoutThread_.join();
+  if (batchFlushThread_.joinable()) {
+    {
+      // batchFlushLoop checks rpcRunning_ under batchMutex_; notify while
+      // holding it so the flag flip above cannot land between the loop's
+      // predicate check and its block, which would lose the wakeup and hang
+      // the join below.
+      std::lock_guard<std::mutex> batchGuard{batchMutex_};
+      batchCV_.notify_all();
+    }
+    batchFlushThread_.join();
+  }
+  // Fail any messages still parked in the batching window. They will never
+  // be sent now, and their callers would otherwise block on the futures
+  // until they time out.
+  {
+    std::unordered_map<worker_id_t, std::vector<SendWork>> batches;
+    {
+      std::lock_guard<std::mutex> batchGuard{batchMutex_};
+      batches.swap(pendingBatches_);
+    }
+    for (auto& entry : batches) {
+      for (auto& work : entry.second) {
+        // Responses are dropped; the remote end's future times out.
+        if (work.message_.isRequest()) {
+          markFutureWithError(
+              work.message_.id(),
+              c10::str(
+                  "RPC agent on rank ",
+                  pg_->getRank(),
+                  " was shut down before the batched send to rank ",
+                  entry.first,
+                  " was flushed."));
+        }
+      }
+    }
+  }
   {
     std::unique_lock<std::mutex> lock(recvWorkMutex_);
     if (recvWork_) {
@@ -357,12 +536,13 @@ std::shared_ptr<FutureMessage> ProcessGroupAgent::send(
     threadPool_.run(std::bind(
         [this, future](const Message& message) {
           // Unlike the other cases, need to add a tensor deleter, since the
-          // data outlives the scope of this function. It's shared_ptr<> due
-          // to c++11 lambda capture limitations with unique_ptr<>.
-          std::unique_ptr<std::string> payload;
+          // data outlives the scope of this function. The pooled buffer
+          // goes back to the pool when the deleter drops the last
+          // reference.
+          std::shared_ptr<std::string> payload;
           try {
-            payload = std::make_unique<std::string>(
-                wireSerialize(message.payload(), message.tensors()));
+            payload = sendBufferPool_.acquire();
+            wireSerialize(message.payload(), message.tensors(), *payload);
             // only increment sendCounts when the message is indeed added into
             // local recv.
             sendCounts_.increment(pg_->getRank());
@@ -372,7 +552,6 @@ std::shared_ptr<FutureMessage> ProcessGroupAgent::send(
           }
           const char* data = payload->data();
           size_t len = payload->length();
-          std::string* delete_when_done = payload.release();
           enqueueRecv(RecvWork(
               getWorkerInfo(pg_->getRank()),
               message.type(),
@@ -380,7 +559,7 @@ std::shared_ptr<FutureMessage> ProcessGroupAgent::send(
               torch::from_blob(
                   (void*)data,
                   len,
-                  [delete_when_done](void*) { delete delete_when_done; },
+                  [payload](void*) {},
                   {torch::kChar})));
         },
         std::move(message)));
@@ -401,28 +580,75 @@ std::shared_ptr<FutureMessage> ProcessGroupAgent::send(
 }
 
 void ProcessGroupAgent::handleSend(const SendWork& work) {
-  std::string serializedPayload =
-      wireSerialize(work.message_.payload(), work.message_.tensors());
+  // For peers on this machine, large tensor storages travel through shared
+  // memory; only their segment names are copied into the wire payload.
+  // sendPayload is synchronous, so the pooled buffer is recycled as soon
+  // as this function returns.
+  auto serializedPayload = sendBufferPool_.acquire();
+  wireSerialize(
+      work.message_.payload(),
+      work.message_.tensors(),
+      *serializedPayload,
+      sameHostPeers_[work.to_.id_]);
+
+  sendCounts_.increment(work.to_.id_);
+  sendPayload(
+      work.to_.id_,
+      *serializedPayload,
+      (int64_t)work.message_.type(),
+      work.message_.id());
+}
 
+void ProcessGroupAgent::handleBatchedSend(
+    worker_id_t dst,
+    std::vector<SendWork>& works) {
+  // See Note [RPC send batching] for the buffer layout. Each sub-message
+  // is serialized directly into the pooled batch buffer after a
+  // placeholder header, whose size field is patched once the length is
+  // known; this avoids a per-message scratch string and recopy.
+  auto batch = sendBufferPool_.acquire();
+  for (const auto& work : works) {
+    int64_t header[3] = {
+        (int64_t)work.message_.type(), work.message_.id(), 0 /* patched */};
+    const size_t headerPos = batch->size();
+    batch->append(reinterpret_cast<const char*>(header), sizeof(header));
+    const size_t bodyPos = batch->size();
+    wireSerialize(
+        work.message_.payload(),
+        work.message_.tensors(),
+        *batch,
+        sameHostPeers_[dst]);
+    const int64_t bodySize = (int64_t)(batch->size() - bodyPos);
+    std::memcpy(
+        &(*batch)[headerPos + 2 * sizeof(int64_t)],
+        &bodySize,
+        sizeof(bodySize));
+    sendCounts_.increment(dst);
+  }
+  sendPayload(dst, *batch, kMessageBatchType, (int64_t)works.size());
+}
+
+void ProcessGroupAgent::sendPayload(
+    worker_id_t dst,
+    const std::string& serializedPayload,
+    int64_t type,
+    int64_t idOrCount) {
   std::vector<torch::Tensor> preamble = {torch::tensor(
       {(int64_t)pg_->getRank(),
        (int64_t)serializedPayload.length(),
-       (int64_t)work.message_.type(),
-       (int64_t)work.message_.id()},
+       type,
+       idOrCount},
       {torch::kInt64})};
 
   // ProcessGroup is not thread-safe when sending with the same tag,
   // hence the lock
   std::vector<std::shared_ptr<c10d::ProcessGroup::Work>> pendingSends;
-  const auto dst = work.to_.id_;
   std::vector<torch::Tensor> payload = {torch::from_blob(
       (void*)serializedPayload.c_str(),
       serializedPayload.length(),
       {torch::kChar})};
   pendingSends.reserve(2);
 
-  sendCounts_.increment(dst);
-
   {
     std::lock_guard<std::mutex> guard(sendMutexes_[dst]);
     pendingSends.emplace_back(pg_->send(preamble, dst, dst /* channelTag */));
@@ -457,6 +683,17 @@ void ProcessGroupAgent::handleSend(const SendWork& work) {
 }
 
 void ProcessGroupAgent::enqueueSend(SendWork work) {
+  // Small messages are parked for the batching window instead of being sent
+  // one by one; see Note [RPC send batching].
+  if (sendBatchWindow_.count() > 0 &&
+      approxMessageSize(work.message_) <= sendBatchMaxBytes_) {
+    {
+      std::lock_guard<std::mutex> guard(batchMutex_);
+      pendingBatches_[work.to_.id_].emplace_back(std::move(work));
+    }
+    batchCV_.notify_one();
+    return;
+  }
   // NB: this can be changed to use a native move capture when moved to C++14
   threadPool_.run(std::bind(
       [this](const SendWork& work) {
@@ -484,9 +721,63 @@ void ProcessGroupAgent::enqueueSend(SendWork work) {
       std::move(work)));
 }
 
+void ProcessGroupAgent::flushBatchedSends() {
+  std::unordered_map<worker_id_t, std::vector<SendWork>> batches;
+  {
+    std::lock_guard<std::mutex> guard(batchMutex_);
+    batches.swap(pendingBatches_);
+  }
+  for (auto& entry : batches) {
+    const auto dst = entry.first;
+    // shared_ptr due to c++11 lambda capture limitations with move-only types
+    auto works =
+        std::make_shared<std::vector<SendWork>>(std::move(entry.second));
+    threadPool_.run([this, dst, works]() {
+      try {
+        handleBatchedSend(dst, *works);
+      } catch (std::exception& e) {
+        // Mirror enqueueSend: route the error to each sub-message's future,
+        // or try to send it along for responses.
+        for (auto& work : *works) {
+          auto errorStr = c10::str(
+              "Encountered exception in ProcessGroupAgent::flushBatchedSends: ",
+              e.what());
+          auto exceptionMsg =
+              rpc::createExceptionResponse(errorStr, work.message_.id());
+          if (work.message_.isRequest()) {
+            markFutureWithError(exceptionMsg);
+          } else if (work.message_.isResponse()) {
+            handleSend(SendWork(work.to_, std::move(exceptionMsg)));
+          }
+        }
+      }
+    });
+  }
+}
+
+void ProcessGroupAgent::batchFlushLoop() {
+  std::unique_lock<std::mutex> lock(batchMutex_);
+  while (rpcRunning_.load()) {
+    if (pendingBatches_.empty()) {
+      batchCV_.wait(lock, [this] {
+        return !pendingBatches_.empty() || !rpcRunning_.load();
+      });
+      continue;
+    }
+    // Let the window elapse so later messages can pile onto the batch the
+    // first one opened.
+    lock.unlock();
+    std::this_thread::sleep_for(sendBatchWindow_);
+    flushBatchedSends();
+    lock.lock();
+  }
+}
+
 int ProcessGroupAgent::handleRecv(RecvWork& work) {
   torch::Tensor& payload = work.payload_;
-  auto data = wireDeserialize(payload.storage().data(), payload.numel());
+  // NB: data_ptr(), not storage().data(): batched messages arrive as narrowed
+  // views into the batch buffer, with a non-zero storage offset.
+  auto data = wireDeserialize(payload.data_ptr(), payload.numel());
   Message message(
       std::move(data.first), std::move(data.second), work.type_, work.id_);
   if (message.isRequest()) {
@@ -700,14 +991,40 @@ void ProcessGroupAgent::listenLoopInternal() {
 
     auto srcRank = preamble_items[0];
     auto size = preamble_items[1];
-    MessageType type = MessageType(preamble_items[2]);
+    int64_t type = preamble_items[2];
     int64_t id = preamble_items[3];
 
     std::vector<torch::Tensor> tensors = {torch::empty({size}, {torch::kChar})};
     pg_->recv(tensors, srcRank, pg_->getRank())->wait();
 
-    enqueueRecv(
-        RecvWork(allWorkerInfo_[srcRank], type, id, std::move(tensors[0])));
+    if (type == kMessageBatchType) {
+      // A batched send; `id` carries the sub-message count and the buffer
+      // holds {type, id, size}-framed messages back to back. Each RecvWork
+      // gets a narrowed view into the buffer, so no bytes are copied here;
+      // see Note [RPC send batching].
+      torch::Tensor& buffer = tensors[0];
+      const char* data = (const char*)buffer.data_ptr();
+      int64_t offset = 0;
+      for (int64_t i = 0; i < id; ++i) {
+        int64_t header[3];
+        memcpy(header, data + offset, sizeof(header));
+        offset += sizeof(header);
+        enqueueRecv(RecvWork(
+            allWorkerInfo_[srcRank],
+            MessageType(header[0]),
+            header[1],
+            buffer.narrow(0, offset, header[2])));
+        offset += header[2];
+      }
+      TORCH_INTERNAL_ASSERT(
+          offset == size, "malformed batched RPC buffer from rank ", srcRank);
+    } else {
+      enqueueRecv(RecvWork(
+          allWorkerInfo_[srcRank],
+          MessageType(type),
+          id,
+          std::move(tensors[0])));
+    }
   }
 }
 
@@ -6,7 +6,9 @@
 #include <torch/csrc/distributed/rpc/rpc_agent.h>
 
 #include <atomic>
+#include <condition_variable>
 #include <thread>
+#include <unordered_map>
 
 namespace torch {
 namespace distributed {
@@ -123,6 +125,40 @@ class ProcessGroupAgent : public RpcAgent {
     double computeAverage();
   };
 
+  // Note [RPC send buffer pool]
+  // ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Every outbound message used to serialize into a freshly allocated
+  // std::string that was thrown away after the send; at tens of thousands
+  // of messages per second the allocator traffic from those short-lived
+  // buffers dominates agent CPU. The pool hands out reference-counted
+  // buffers instead: the returned shared_ptr's deleter clears the buffer
+  // and puts it back on the free list when the last holder (the send path,
+  // or a from_blob deleter on the loopback path) drops it, so a
+  // steady-state sender keeps reusing the same few allocations.
+  // wireSerialize() gathers header, pickled body and tensor bytes into the
+  // recycled buffer in one exactly-reserved pass. The underlying
+  // ProcessGroup transport sends a single contiguous tensor, so the
+  // sections cannot be handed over iovec-style; the recycled capacity
+  // makes that gather the only per-message copy.
+  class SendBufferPool {
+   public:
+    // Returns an empty pooled buffer. Dropping the last reference returns
+    // the buffer to the pool.
+    std::shared_ptr<std::string> acquire();
+
+   private:
+    // Buffers above this capacity are freed rather than pooled, so one
+    // outsized message does not pin its footprint for the process
+    // lifetime.
+    static constexpr size_t kMaxPooledCapacity = 4 * 1024 * 1024;
+    // Upper bound on idle pooled buffers; sized for the send/recv thread
+    // pool.
+    static constexpr size_t kMaxPooledBuffers = 16;
+
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<std::string>> free_;
+  };
+
   // The FutureInfo struct stores a shared_ptr to the future, as well as
   // additional information to manage timeouts and destination information,
   // which is needed for termination detection.
@@ -144,12 +180,34 @@ class ProcessGroupAgent : public RpcAgent {
   };
 
   void collectNames();
-  // put SendWork into a queue and notify the worker thread
+  // allgather a host fingerprint from every peer and record which of them
+  // share this machine, so sends to those peers can pass tensor storages
+  // through shared memory instead of copying them into the wire payload.
+  void collectSameHostPeers();
+  // put SendWork into a queue and notify the worker thread; when batching is
+  // enabled, small messages are parked in pendingBatches_ instead (see
+  // Note [RPC send batching] in the .cpp)
   void enqueueSend(SendWork work);
   // handle a SendWork request. This serializes the payload inside the work
   // object, and sends the message to the receiver using the underlying
   // ProcessGroup.
   void handleSend(const SendWork& work);
+  // sends one framed buffer to dst: the four-field preamble followed by the
+  // payload bytes, with the bookkeeping that lets ::shutdown() interrupt the
+  // sends. type is either a MessageType or kMessageBatchType, in which case
+  // idOrCount carries the number of sub-messages rather than a message id.
+  void sendPayload(
+      worker_id_t dst,
+      const std::string& serializedPayload,
+      int64_t type,
+      int64_t idOrCount);
+  // serializes the accumulated messages for one destination and sends them
+  // as a single concatenated buffer
+  void handleBatchedSend(worker_id_t dst, std::vector<SendWork>& works);
+  // hands every non-empty pending batch to the thread pool
+  void flushBatchedSends();
+  // background loop that flushes pending batches once their window elapses
+  void batchFlushLoop();
   // put RecvWork into a queue and notify the worker thread
   void enqueueRecv(RecvWork work);
   // handle a RecvWork request. Return 1 if we should increment recvCounts, 0 if
@@ -211,6 +269,18 @@ class ProcessGroupAgent : public RpcAgent {
   // worker name -> rank
   std::unordered_map<std::string, int> nameMap_;
   std::vector<WorkerInfo> allWorkerInfo_;
+  // rank -> whether that peer runs on this machine (see collectSameHostPeers)
+  std::vector<bool> sameHostPeers_;
+  // send-batching configuration and state; a zero window disables batching.
+  // See Note [RPC send batching] in the .cpp.
+  std::chrono::microseconds sendBatchWindow_{0};
+  size_t sendBatchMaxBytes_{64 * 1024};
+  std::mutex batchMutex_;
+  std::condition_variable batchCV_;
+  std::unordered_map<worker_id_t, std::vector<SendWork>> pendingBatches_;
+  std::thread batchFlushThread_;
+  // recycled serialization buffers, see Note [RPC send buffer pool]
+  SendBufferPool sendBufferPool_;
   // record the number of messages sent to and received from each peer. The recv
   // counter is only marked after the message is processed. Join uses allgather
   // to collect all counts from all peers, uses these counters to detect global
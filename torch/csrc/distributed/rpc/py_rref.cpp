@@ -205,6 +205,15 @@ c10::IValue PyRRef::toIValue() {
   return IValue(rrefPtr);
 }
 
+void PyRRef::prefetch(const std::vector<PyRRef>& rrefs) {
+  std::vector<c10::intrusive_ptr<RRef>> rrefPtrs;
+  rrefPtrs.reserve(rrefs.size());
+  for (const auto& rref : rrefs) {
+    rrefPtrs.push_back(rref.rref_);
+  }
+  RRefContext::getInstance().prefetchValues(rrefPtrs);
+}
+
 } // namespace rpc
 } // namespace distributed
 } // namespace torch
@@ -26,6 +26,12 @@ class PyRRef {
   static PyRRef unpickle(const py::tuple& t);
   c10::IValue toIValue();
 
+  // Batch-fetches the values of the given UserRRefs into the RRef value
+  // cache, one message per owner; see Note [RRef Value Cache] in
+  // rref_context.h. Should be called without GIL as it blocks on network
+  // round trips.
+  static void prefetch(const std::vector<PyRRef>& rrefs);
+
  private:
   c10::intrusive_ptr<RRef> rref_;
 };
@@ -316,6 +316,31 @@ void RequestCallbackImpl::processRpc(
           });
       return;
     }
+    case MessageType::RREF_BATCH_FETCH_CALL: {
+      auto& bfc = static_cast<RRefBatchFetchCall&>(rpc);
+      auto& ctx = RRefContext::getInstance();
+      std::vector<RRefBatchFetchRet::Entry> entries;
+      entries.reserve(bfc.entries().size());
+      for (const auto& requested : bfc.entries()) {
+        c10::intrusive_ptr<OwnerRRef> rref = ctx.getOwnerRRef(requested.first);
+        // NB: unlike the single fetch above, this blocks the callback
+        // thread if a value is not set yet. Batch fetches are issued by
+        // RRefContext::prefetchValues() against RRefs that typically
+        // already hold values (e.g. parameter shards).
+        auto valueAndVersion = rref->getValueAndVersion();
+        if (requested.second == valueAndVersion.second) {
+          // The caller's cached copy is still valid; only echo the
+          // version back.
+          entries.push_back(RRefBatchFetchRet::Entry{
+              valueAndVersion.second, false, at::IValue()});
+        } else {
+          entries.push_back(RRefBatchFetchRet::Entry{
+              valueAndVersion.second, true, std::move(valueAndVersion.first)});
+        }
+      }
+      markComplete(RRefBatchFetchRet(std::move(entries)).toMessage());
+      return;
+    }
     case MessageType::RREF_USER_DELETE: {
       auto& rud = static_cast<RRefUserDelete&>(rpc);
       auto& ctx = RRefContext::getInstance();
@@ -1,5 +1,6 @@
 #include <torch/csrc/distributed/rpc/rref_context.h>
 #include <torch/csrc/distributed/rpc/rref_proto.h>
+#include <torch/csrc/distributed/rpc/utils.h>
 
 #include <sstream>
 
@@ -102,6 +103,93 @@ std::unordered_map<std::string, std::string> RRefContext::getDebugInfo() {
   return info;
 }
 
+void RRefContext::setValueCacheEnabled(bool enabled) {
+  valueCacheEnabled_ = enabled;
+  if (!enabled) {
+    std::lock_guard<std::mutex> lock(valueCacheMutex_);
+    valueCache_.clear();
+  }
+}
+
+bool RRefContext::isValueCacheEnabled() const {
+  return valueCacheEnabled_;
+}
+
+c10::optional<IValue> RRefContext::getCachedValue(const RRefId& rrefId) const {
+  if (!valueCacheEnabled_) {
+    return c10::nullopt;
+  }
+  std::lock_guard<std::mutex> lock(valueCacheMutex_);
+  auto iter = valueCache_.find(rrefId);
+  if (iter == valueCache_.end()) {
+    return c10::nullopt;
+  }
+  return iter->second.value;
+}
+
+void RRefContext::prefetchValues(
+    const std::vector<c10::intrusive_ptr<RRef>>& rrefs) {
+  TORCH_CHECK(
+      valueCacheEnabled_,
+      "prefetchValues() requires the RRef value cache to be enabled.");
+
+  // Group requested RRefs by owner so that every owner receives a single
+  // message, and attach the cached version of each entry so the owner can
+  // skip payloads whose cached copy is still valid.
+  std::unordered_map<worker_id_t, std::vector<std::pair<RRefId, int64_t>>>
+      perOwner;
+  for (const auto& rref : rrefs) {
+    if (rref->isOwner() || rref->isPyObj()) {
+      continue;
+    }
+    int64_t version = kUnsetRRefVersion;
+    {
+      std::lock_guard<std::mutex> lock(valueCacheMutex_);
+      auto iter = valueCache_.find(rref->rrefId());
+      if (iter != valueCache_.end()) {
+        version = iter->second.version;
+      }
+    }
+    perOwner[rref->owner()].emplace_back(rref->rrefId(), version);
+  }
+
+  // Send all batch fetch calls before waiting on any response, so the
+  // owners process them concurrently.
+  std::vector<std::pair<
+      std::vector<std::pair<RRefId, int64_t>>,
+      std::shared_ptr<FutureMessage>>>
+      pendingResponses;
+  pendingResponses.reserve(perOwner.size());
+  for (auto& entry : perOwner) {
+    auto fm = agent_->send(
+        agent_->getWorkerInfo(entry.first),
+        RRefBatchFetchCall(getWorkerId(), entry.second).toMessage());
+    pendingResponses.emplace_back(std::move(entry.second), std::move(fm));
+  }
+
+  for (auto& pending : pendingResponses) {
+    const Message& message = pending.second->wait();
+    MessageType msgType = message.type();
+    auto response = deserializeResponse(message, msgType);
+    TORCH_INTERNAL_ASSERT(
+        msgType == MessageType::RREF_BATCH_FETCH_RET,
+        "Message type should be RREF_BATCH_FETCH_RET");
+    auto& ret = static_cast<RRefBatchFetchRet&>(*response);
+    const auto& requested = pending.first;
+    TORCH_INTERNAL_ASSERT(
+        ret.entries().size() == requested.size(),
+        "RRefBatchFetchRet should carry one entry per requested RRef");
+    std::lock_guard<std::mutex> lock(valueCacheMutex_);
+    for (size_t i = 0; i < requested.size(); ++i) {
+      const auto& entry = ret.entries()[i];
+      if (entry.hasValue) {
+        valueCache_[requested[i].first] =
+            CachedValue{entry.value, entry.version};
+      }
+    }
+  }
+}
+
 void RRefContext::checkRRefLeaks(bool ignoreRRefLeak) {
   if (!forks_.empty()) {
     std::stringstream ss;
@@ -184,6 +184,36 @@ class TORCH_API RRefContext {
 
   std::unordered_map<std::string, std::string> getDebugInfo();
 
+  // Note [RRef Value Cache]
+  // ~~~~~~~~~~~~~~~~~~~~~~~
+  // An optional consumer-side cache for RRef values. When enabled,
+  // prefetchValues() batch-fetches the values of a list of UserRRefs with
+  // one RREF_BATCH_FETCH_CALL message per owner and stores them here, and
+  // UserRRef::toHere() serves cached values without a round trip.
+  //
+  // Invalidation is version driven: the owner increments a version counter
+  // on every OwnerRRef::setValue(), and every prefetchValues() call sends
+  // the cached versions along, so the owner only resends payloads for
+  // entries whose cached copy went stale. Cached values can thus be stale
+  // for up to one prefetch interval; callers that need the latest value
+  // should re-run prefetchValues() (e.g. once per training step) or leave
+  // the cache disabled. Only RRefs holding IValues are cached; py::object
+  // RRefs always take the regular fetch path.
+
+  // Enables or disables the value cache. Disabling drops all entries.
+  void setValueCacheEnabled(bool enabled);
+  bool isValueCacheEnabled() const;
+
+  // Returns the cached value for rrefId, or nullopt when the cache is
+  // disabled or has no entry for it.
+  c10::optional<IValue> getCachedValue(const RRefId& rrefId) const;
+
+  // Batch-fetches the values of the given UserRRefs, grouping them into
+  // one message per owner worker, and populates the value cache. Blocks
+  // until all responses arrive. RRefs owned by this worker or holding
+  // py::objects are skipped.
+  void prefetchValues(const std::vector<c10::intrusive_ptr<RRef>>& rrefs);
+
  private:
   struct PendingUserState {
     PendingUserState(c10::intrusive_ptr<RRef> rref) : rref_(std::move(rref)) {}
@@ -270,6 +300,15 @@ class TORCH_API RRefContext {
   std::unordered_map<ForkId, c10::intrusive_ptr<RRef>, ForkId::Hash>
       pendingChildren_;
 
+  // See Note [RRef Value Cache].
+  struct CachedValue {
+    IValue value;
+    int64_t version;
+  };
+  std::atomic<bool> valueCacheEnabled_{false};
+  mutable std::mutex valueCacheMutex_;
+  std::unordered_map<RRefId, CachedValue, RRefId::Hash> valueCache_;
+
   std::mutex destroyedMutex_;
   bool destroyed_;
 
@@ -116,6 +116,16 @@ IValue UserRRef::toHere() {
       forkId(),
       " has been deleted. Cannot call to_here() on it after deletion.");
 
+  if (!isPyObj()) {
+    // Serve the value from the consumer-side cache when enabled and
+    // populated by a previous prefetchValues() call; see the note on the
+    // value cache in RRefContext.
+    auto cached = RRefContext::getInstance().getCachedValue(rrefId());
+    if (cached.has_value()) {
+      return std::move(*cached);
+    }
+  }
+
   auto agent = RpcAgent::getCurrentRpcAgent();
 
   // ScriptRRefFetchCall message always carries autograd context id even if
@@ -194,6 +204,12 @@ const IValue& OwnerRRef::getValue() const {
   return value_.value();
 }
 
+std::pair<IValue, int64_t> OwnerRRef::getValueAndVersion() const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  valueCV_.wait(lock, [this] { return value_.has_value(); });
+  return std::make_pair(value_.value(), version_);
+}
+
 bool OwnerRRef::hasValue() const {
   std::lock_guard<std::mutex> lock(mutex_);
   return value_.has_value();
@@ -216,6 +232,7 @@ std::shared_ptr<FutureMessage> OwnerRRef::getFuture() {
 void OwnerRRef::setValue(IValue&& value) {
   std::unique_lock<std::mutex> lock(mutex_);
   value_ = std::move(value);
+  ++version_;
   std::shared_ptr<FutureMessage> future;
   future.swap(future_);
   lock.unlock();
@@ -350,10 +350,18 @@ class TORCH_API OwnerRRef final : public RRef {
   // Gets a future that is satisfied when the value is set.
   std::shared_ptr<FutureMessage> getFuture();
 
+  // Get a copy of the value together with its version. The version is
+  // incremented on every setValue() call and lets consumers revalidate
+  // cached copies of the value (see RRefContext::prefetchValues()). This
+  // method will block if the value is not ready.
+  std::pair<IValue, int64_t> getValueAndVersion() const;
+
  private:
   friend class RRefContext;
 
   c10::optional<IValue> value_;
+  // Incremented every time value_ is set.
+  int64_t version_{0};
   mutable std::mutex mutex_;
   mutable std::condition_variable valueCV_;
   std::shared_ptr<FutureMessage> future_;
@@ -153,6 +153,80 @@ std::unique_ptr<PythonRRefFetchRet> PythonRRefFetchRet::fromMessage(
       toIValues(message, MessageType::PYTHON_RREF_FETCH_RET));
 }
 
+const std::vector<std::pair<RRefId, int64_t>>& RRefBatchFetchCall::entries()
+    const {
+  return entries_;
+}
+
+Message RRefBatchFetchCall::toMessageImpl() && {
+  // Flat layout: [fromWorkerId, rrefId_0, version_0, rrefId_1, version_1, ...]
+  std::vector<at::IValue> ivalues;
+  ivalues.reserve(1 + 2 * entries_.size());
+  ivalues.emplace_back(fromWorkerId_);
+  for (const auto& entry : entries_) {
+    ivalues.emplace_back(entry.first.toIValue());
+    ivalues.emplace_back(entry.second);
+  }
+  return fromIValues(std::move(ivalues), MessageType::RREF_BATCH_FETCH_CALL);
+}
+
+std::unique_ptr<RRefBatchFetchCall> RRefBatchFetchCall::fromMessage(
+    const Message& message) {
+  auto values = toIValues(message, MessageType::RREF_BATCH_FETCH_CALL);
+  TORCH_INTERNAL_ASSERT(
+      values.size() >= 1 && values.size() % 2 == 1,
+      "RRefBatchFetchCall expects an odd number of IValues from message, got ",
+      values.size());
+  auto id = values[0].toInt();
+  TORCH_INTERNAL_ASSERT(
+      id >= std::numeric_limits<worker_id_t>::min() &&
+          id <= std::numeric_limits<worker_id_t>::max(),
+      "RRefBatchFetchCall fromWorkerId exceeds worker_id_t limit.")
+  std::vector<std::pair<RRefId, int64_t>> entries;
+  entries.reserve((values.size() - 1) / 2);
+  for (size_t i = 1; i < values.size(); i += 2) {
+    entries.emplace_back(
+        RRefId::fromIValue(values[i]), values[i + 1].toInt());
+  }
+  return std::make_unique<RRefBatchFetchCall>(
+      worker_id_t(id), std::move(entries));
+}
+
+const std::vector<RRefBatchFetchRet::Entry>& RRefBatchFetchRet::entries()
+    const {
+  return entries_;
+}
+
+Message RRefBatchFetchRet::toMessageImpl() && {
+  // Flat layout: [version_0, hasValue_0, value_0, ...]; value is None for
+  // entries whose cached copy on the caller is still valid.
+  std::vector<at::IValue> ivalues;
+  ivalues.reserve(3 * entries_.size());
+  for (auto& entry : entries_) {
+    ivalues.emplace_back(entry.version);
+    ivalues.emplace_back(entry.hasValue);
+    ivalues.emplace_back(
+        entry.hasValue ? std::move(entry.value) : at::IValue());
+  }
+  return fromIValues(std::move(ivalues), MessageType::RREF_BATCH_FETCH_RET);
+}
+
+std::unique_ptr<RRefBatchFetchRet> RRefBatchFetchRet::fromMessage(
+    const Message& message) {
+  auto values = toIValues(message, MessageType::RREF_BATCH_FETCH_RET);
+  TORCH_INTERNAL_ASSERT(
+      values.size() % 3 == 0,
+      "RRefBatchFetchRet expects a multiple of 3 IValues from message, got ",
+      values.size());
+  std::vector<Entry> entries;
+  entries.reserve(values.size() / 3);
+  for (size_t i = 0; i < values.size(); i += 3) {
+    entries.push_back(Entry{
+        values[i].toInt(), values[i + 1].toBool(), std::move(values[i + 2])});
+  }
+  return std::make_unique<RRefBatchFetchRet>(std::move(entries));
+}
+
 std::unique_ptr<RRefUserDelete> RRefUserDelete::fromMessage(
     const Message& message) {
   auto pair =
@@ -113,6 +113,62 @@ class TORCH_API PythonRRefFetchRet final : public RRefFetchRet {
       const Message& message);
 };
 
+// Version tag carried by batch fetch entries for callers that have no
+// cached value yet. The owner treats it as always-stale and sends the
+// value unconditionally.
+constexpr int64_t kUnsetRRefVersion = -1;
+
+// A user sends this message to fetch the values of several RRefs living on
+// the same owner in one round trip. Each entry carries the version of the
+// value the caller has cached (or kUnsetRRefVersion); the owner only sends
+// payloads for entries whose cached version is stale. Only used for RRefs
+// holding IValues, see RRefContext::prefetchValues().
+class TORCH_API RRefBatchFetchCall final : public RpcCommandBase {
+ public:
+  RRefBatchFetchCall(
+      worker_id_t fromWorkerId,
+      std::vector<std::pair<RRefId, int64_t>> entries)
+      : fromWorkerId_(fromWorkerId), entries_(std::move(entries)) {}
+
+  inline worker_id_t fromWorkerId() const {
+    return fromWorkerId_;
+  }
+
+  const std::vector<std::pair<RRefId, int64_t>>& entries() const;
+
+  Message toMessageImpl() && override;
+  static std::unique_ptr<RRefBatchFetchCall> fromMessage(
+      const Message& message);
+
+ private:
+  const worker_id_t fromWorkerId_;
+  const std::vector<std::pair<RRefId, int64_t>> entries_;
+};
+
+// The owner's reply to RRefBatchFetchCall. For every requested RRef it
+// carries the current value version; the value itself is only included
+// when the caller's cached version was stale.
+class TORCH_API RRefBatchFetchRet final : public RpcCommandBase {
+ public:
+  struct Entry {
+    int64_t version;
+    bool hasValue;
+    at::IValue value;
+  };
+
+  explicit RRefBatchFetchRet(std::vector<Entry> entries)
+      : entries_(std::move(entries)) {}
+
+  const std::vector<Entry>& entries() const;
+
+  Message toMessageImpl() && override;
+  static std::unique_ptr<RRefBatchFetchRet> fromMessage(
+      const Message& message);
+
+ private:
+  std::vector<Entry> entries_;
+};
+
 // UserRRef (regardless it's the creator or not) uses this message to notiify
 // OwnerRRef on delete.
 class TORCH_API RRefUserDelete final : public ForkMessageBase {
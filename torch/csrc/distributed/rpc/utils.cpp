@@ -16,6 +16,15 @@
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/jit/serialization/unpickler.h>
 
+#include <TH/THAllocator.h>
+
+#include <atomic>
+#include <sstream>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
 namespace torch {
 namespace distributed {
 namespace rpc {
@@ -40,6 +49,9 @@ std::unique_ptr<RpcCommandBase> deserializeRequest(const Message& request) {
     case MessageType::PYTHON_RREF_FETCH_CALL: {
       return PythonRRefFetchCall::fromMessage(request);
     }
+    case MessageType::RREF_BATCH_FETCH_CALL: {
+      return RRefBatchFetchCall::fromMessage(request);
+    }
     case MessageType::RREF_USER_DELETE: {
       return RRefUserDelete::fromMessage(request);
     }
@@ -84,6 +96,9 @@ std::unique_ptr<RpcCommandBase> deserializeResponse(
     case MessageType::PYTHON_RREF_FETCH_RET: {
       return PythonRRefFetchRet::fromMessage(response);
     }
+    case MessageType::RREF_BATCH_FETCH_RET: {
+      return RRefBatchFetchRet::fromMessage(response);
+    }
     case MessageType::RREF_ACK: {
       return RRefAck::fromMessage(response);
     }
@@ -212,6 +227,51 @@ parseWireSections(const void* data, size_t data_size) {
 
 static const char* kMeta = "meta";
 static const char* kPayload = "payload";
+// Maps tensor record numbers to shared-memory segment names; present only
+// when the sender put tensor storages in shared memory (see wireSerialize).
+static const char* kShm = "shm";
+
+// Sharing a storage only pays for itself above some size; below this the
+// segment setup and page faults cost more than the copy we avoid.
+constexpr size_t kMinShmTensorBytes = 64 * 1024;
+
+bool isShmEligible(const at::Tensor& tensor) {
+  if (!tensor.has_storage() || tensor.is_sparse() ||
+      !tensor.device().is_cpu()) {
+    return false;
+  }
+  return tensor.storage().elementSize() * tensor.storage().numel() >=
+      kMinShmTensorBytes;
+}
+
+std::string newShmHandle() {
+  static std::atomic<uint64_t> counter{0};
+  std::ostringstream handle;
+  handle << "/torch_rpc_" << getpid() << "_" << counter++;
+  return handle.str();
+}
+
+// Moves the tensor's storage into a named shared-memory segment, unless it
+// lives in one already, and returns the segment name. This is the same
+// in-place move that Tensor.share_memory_() performs: the sender's tensor
+// aliases the segment afterwards, so the storage stays mapped for as long
+// as the sender holds the tensor.
+std::string shareStorage(const at::Tensor& tensor) {
+  auto* storage = tensor.storage().unsafeGetStorageImpl();
+  if (auto* ctx = THRefcountedMapAllocator::fromDataPtr(storage->data_ptr())) {
+    return ctx->filename();
+  }
+  const size_t size = storage->itemsize() * storage->numel();
+  std::string handle = newShmHandle();
+  at::DataPtr data_ptr = THRefcountedMapAllocator::makeDataPtr(
+      handle.c_str(),
+      TH_ALLOCATOR_MAPPED_SHAREDMEM | TH_ALLOCATOR_MAPPED_EXCLUSIVE,
+      size,
+      nullptr);
+  memcpy(data_ptr.get(), storage->data(), size);
+  storage->set_data_ptr(std::move(data_ptr));
+  return handle;
+}
 }; // namespace
 
 c10::List<at::Tensor> cloneSparseTensors(
@@ -240,7 +300,18 @@ c10::List<at::Tensor> cloneSparseTensors(
 
 std::string wireSerialize(
     const std::vector<char>& payload,
-    const std::vector<at::Tensor>& tensors) {
+    const std::vector<at::Tensor>& tensors,
+    bool tensorsViaShm) {
+  std::string out;
+  wireSerialize(payload, tensors, out, tensorsViaShm);
+  return out;
+}
+
+void wireSerialize(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors,
+    std::string& out,
+    bool tensorsViaShm) {
   for (const auto& tensor : tensors) {
     TORCH_CHECK(
         tensor.device().is_cpu(),
@@ -257,6 +328,7 @@ std::string wireSerialize(
   };
   std::vector<Ent> entries;
   std::string metaEntry;
+  std::string shmEntry;
   std::vector<jit::WriteableTensorData> tensorData;
 
   if (!payload.empty()) {
@@ -277,9 +349,24 @@ std::string wireSerialize(
     tensorData = pickler.tensorData();
     entries.push_back({kMeta, metaEntry.data(), metaEntry.size()});
     for (size_t i = 0; i < tensorData.size(); i++) {
-      entries.push_back({c10::to_string(i),
-                         tensorData[i].data(),
-                         tensorData[i].sizeInBytes()});
+      if (tensorsViaShm && isShmEligible(tensorData[i].tensor())) {
+        // Ship the storage by name rather than by value: move it into a
+        // shared-memory segment and record "<index> <segment> <nbytes>" so
+        // the receiver can map the same pages (see wireDeserialize).
+        shmEntry.append(c10::to_string(i))
+            .append(" ")
+            .append(shareStorage(tensorData[i].tensor()))
+            .append(" ")
+            .append(c10::to_string(tensorData[i].sizeInBytes()))
+            .append("\n");
+      } else {
+        entries.push_back({c10::to_string(i),
+                           tensorData[i].data(),
+                           tensorData[i].sizeInBytes()});
+      }
+    }
+    if (!shmEntry.empty()) {
+      entries.push_back({kShm, shmEntry.data(), shmEntry.size()});
     }
   }
 
@@ -294,13 +381,14 @@ std::string wireSerialize(
   }
   header.push_back('\n');
 
-  std::string out;
-  out.reserve(header.size() + tot);
+  // Gather all sections into the output buffer with a single reservation;
+  // when out is a recycled pool buffer this is the only copy the message
+  // pays on the way to the transport.
+  out.reserve(out.size() + header.size() + tot);
   out.append(header);
   for (const auto& e : entries) {
     out.append(e.data, e.size);
   }
-  return out;
 }
 
 std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
@@ -319,6 +407,21 @@ std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
   std::vector<at::Tensor> tensors;
   auto metaIt = sections.find(kMeta);
   if (metaIt != sections.end()) {
+    // Tensor records the sender placed in shared memory, keyed by record
+    // name, each mapping to the segment name and storage byte size.
+    std::unordered_map<std::string, std::pair<std::string, size_t>>
+        shmRecords;
+    auto shmIt = sections.find(kShm);
+    if (shmIt != sections.end()) {
+      std::istringstream in(
+          std::string(shmIt->second.first, shmIt->second.second));
+      std::string record, segment;
+      size_t nbytes;
+      while (in >> record >> segment >> nbytes) {
+        shmRecords[std::move(record)] = {std::move(segment), nbytes};
+      }
+    }
+
     const auto& metaData = metaIt->second;
     size_t metaDataPos = 0;
     auto metaDataReadFunc = [&](char* buf, size_t n) -> size_t {
@@ -331,6 +434,18 @@ std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
       return toCopy;
     };
     auto sectionReadFunc = [&](const std::string& ename) -> at::DataPtr {
+      auto shmRecordIt = shmRecords.find(ename);
+      if (shmRecordIt != shmRecords.end()) {
+        // Map the sender's segment instead of copying the bytes. Attaching
+        // bumps the segment's refcount, so it outlives the sender's release,
+        // and the resulting tensor aliases the sender's storage the same way
+        // tensors shared through torch.multiprocessing do.
+        return THRefcountedMapAllocator::makeDataPtr(
+            shmRecordIt->second.first.c_str(),
+            TH_ALLOCATOR_MAPPED_SHAREDMEM | TH_ALLOCATOR_MAPPED_NOCREATE,
+            shmRecordIt->second.second,
+            nullptr);
+      }
       auto it = sections.find(ename);
       if (it == sections.end()) {
         throw std::runtime_error("Couldn't find entity " + ename);
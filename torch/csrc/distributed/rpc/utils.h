@@ -31,9 +31,30 @@ TORCH_API IValue deserializeRespToIValue(const Message& message);
 
 // Note: format is subject to change and intended for RPCs.
 // For saving persistently to disk, use torch::save().
+//
+// When `tensorsViaShm` is set, dense CPU tensor storages above a size
+// threshold are moved into named shared-memory segments (the same in-place
+// move as Tensor.share_memory_()) and only the segment names travel in the
+// message; wireDeserialize on the receiving end maps the same segments
+// instead of copying the bytes. This is only valid when sender and receiver
+// run on the same machine and share /dev/shm, and — exactly like tensors
+// passed through torch.multiprocessing — the deserialized tensors alias the
+// sender's storages.
 TORCH_API std::string wireSerialize(
     const std::vector<char>& payload,
-    const std::vector<at::Tensor>& tensors);
+    const std::vector<at::Tensor>& tensors,
+    bool tensorsViaShm = false);
+
+// Variant that appends the serialized message to a caller-provided buffer
+// in a single exactly-reserved pass, instead of allocating a fresh string.
+// Callers typically pass a recycled buffer from the agent's send buffer
+// pool (see Note [RPC send buffer pool] in process_group_agent.h), so a
+// steady-state sender pays no per-message allocation.
+TORCH_API void wireSerialize(
+    const std::vector<char>& payload,
+    const std::vector<at::Tensor>& tensors,
+    std::string& out,
+    bool tensorsViaShm = false);
 
 TORCH_API std::pair<std::vector<char>, std::vector<at::Tensor>> wireDeserialize(
     const void* data,
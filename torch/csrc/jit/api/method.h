@@ -31,6 +31,12 @@ struct TORCH_API Method {
       std::vector<c10::IValue> stack,
       const Kwargs& kwargs = Kwargs());
 
+  // Compiles the executor's specialization for these example inputs without
+  // running the method, and returns the time spent compiling in
+  // milliseconds. Used to warm up a freshly loaded module before it starts
+  // serving traffic.
+  double warmup(std::vector<c10::IValue> stack);
+
   std::shared_ptr<Graph> graph() const {
     return function_->graph();
   }
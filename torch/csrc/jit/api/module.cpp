@@ -9,6 +9,8 @@
 #include <torch/csrc/jit/frontend/ir_emitter.h>
 #include <torch/csrc/jit/frontend/schema_matching.h>
 
+#include <chrono>
+
 namespace torch {
 namespace jit {
 
@@ -115,6 +117,28 @@ IValue Method::operator()(std::vector<IValue> stack, const Kwargs& kwargs) {
   return (*function_)(std::move(stack), kwargs);
 }
 
+double Method::warmup(std::vector<IValue> stack) {
+  stack.insert(stack.begin(), owner()._ivalue());
+  function_->getSchema().checkAndNormalizeInputs(stack, Kwargs());
+  const auto start = std::chrono::steady_clock::now();
+  function_->get_executor().getPlanFor(
+      stack, GraphExecutor::getDefaultNumBailOuts());
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+std::vector<double> Module::warmup(
+    const std::string& method_name,
+    const std::vector<std::vector<IValue>>& example_inputs) {
+  auto method = get_method(method_name);
+  std::vector<double> compile_times_ms;
+  compile_times_ms.reserve(example_inputs.size());
+  for (const auto& inputs : example_inputs) {
+    compile_times_ms.push_back(method.warmup(inputs));
+  }
+  return compile_times_ms;
+}
+
 void Module::clone_method(
     const Module& orig,
     const Function& method,
@@ -112,6 +112,13 @@ struct TORCH_API Module : public Object {
     return get_method("forward")(std::move(inputs));
   }
 
+  // Compiles the executor specializations of `method_name` for each example
+  // input list, ahead of the first real call. Returns the time spent
+  // compiling each specialization, in milliseconds.
+  std::vector<double> warmup(
+      const std::string& method_name,
+      const std::vector<std::vector<IValue>>& example_inputs);
+
   // In script modules, buffers are Tensors attribute that are _not_ registered
   // as parameters. This is different than in nn.Module where there is a special
   // register_buffer method. With this simplification, we only need to track
@@ -213,13 +220,18 @@ struct TORCH_API Module : public Object {
       const std::string& filename,
       const ExtraFilesMap& extra_files = ExtraFilesMap()) const;
 
+  // With `strip_debug_info`, the archive omits code sections and source
+  // ranges for bytecode-only deployment; the filename overload writes them
+  // to a `<filename>.debug` sidecar archive instead (see ExportModule).
   void _save_for_mobile(
       std::ostream& out,
-      const ExtraFilesMap& extra_files = ExtraFilesMap()) const;
+      const ExtraFilesMap& extra_files = ExtraFilesMap(),
+      bool strip_debug_info = false) const;
 
   void _save_for_mobile(
       const std::string& filename,
-      const ExtraFilesMap& extra_files = ExtraFilesMap()) const;
+      const ExtraFilesMap& extra_files = ExtraFilesMap(),
+      bool strip_debug_info = false) const;
 
   // Clones both the underlying `ClassType` and the module instance(data), this
   // function creates a new `ClassType` and returns a new instance that has the
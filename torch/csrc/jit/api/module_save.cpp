@@ -15,14 +15,16 @@ void Module::save(const std::string& filename, const ExtraFilesMap& extra_files)
 
 void Module::_save_for_mobile(
     std::ostream& out,
-    const ExtraFilesMap& extra_files) const {
-  ExportModule(*this, out, extra_files, true);
+    const ExtraFilesMap& extra_files,
+    bool strip_debug_info) const {
+  ExportModule(*this, out, extra_files, true, strip_debug_info);
 }
 
 void Module::_save_for_mobile(
     const std::string& filename,
-    const ExtraFilesMap& extra_files) const {
-  ExportModule(*this, filename, extra_files, true);
+    const ExtraFilesMap& extra_files,
+    bool strip_debug_info) const {
+  ExportModule(*this, filename, extra_files, true, strip_debug_info);
 }
 
 } // namespace jit
@@ -326,11 +326,24 @@ std::string generateKernel(
       "IndexType",
       "unsigned int"); // Note: not uint32_t to avoid including cstdint
 
-  std::stringstream body;
+  // The kernel body is kept in three sections (input loads, compute, output
+  // stores) so the CUDA path below can emit a vectorized variant that reuses
+  // the compute section with vector loads and stores swapped in.
+  std::stringstream load_section;
+  std::stringstream compute_section;
+  std::stringstream store_section;
   std::stringstream tensorOffsets;
   std::vector<std::string> formals;
   std::vector<std::string> argument_loads;
 
+  // Sections of the vectorized CUDA kernel (see
+  // cuda::cuda_vectorized_kernel_template)
+  std::stringstream vector_loads;
+  std::stringstream vector_lane_loads;
+  std::stringstream vector_decls;
+  std::stringstream vector_lane_stores;
+  std::stringstream vector_stores;
+
   // Lambda for writing arguments
   auto emitFormal = [&](const Value* n, const TensorDesc& desc) {
     env.d(
@@ -388,6 +401,27 @@ std::string generateKernel(
     emitFormal(output.first, output.second);
   }
 
+  // A vectorized variant of the kernel is emitted (CUDA only) when every
+  // tensor collapses to a single contiguous run, so that a linear index
+  // addresses all of them directly. Types wider than 4 bytes are excluded
+  // because Vec4 of them would require more than 16-byte alignment, which
+  // is the widest access the hardware provides. Whether the variant can be
+  // used for a particular launch additionally depends on the runtime
+  // alignment of the data pointers; see FusedKernelCUDA::launch_raw.
+  bool can_vectorize = use_cuda;
+  for (const auto& input : inputs) {
+    if (input.second.has_value()) {
+      can_vectorize = can_vectorize && (*input.second).nDim() == 1 &&
+          (*input.second).lastIsContiguous() &&
+          at::elementSize((*input.second).scalar_type) <= 4;
+    }
+  }
+  for (const auto& output : outputs) {
+    can_vectorize = can_vectorize && output.second.nDim() == 1 &&
+        output.second.lastIsContiguous() &&
+        at::elementSize(output.second.scalar_type) <= 4;
+  }
+
   // Acquires input values
   bool has_half_tensor = false;
   size_t formal_count = 0;
@@ -420,11 +454,27 @@ std::string generateKernel(
         env.s("access", format("t${formal}.data[t${formal}_offset]", env));
       }
       env.s("lhs_type", calcScalarTypeName(input.second.value().scalar_type));
+      if (can_vectorize) {
+        env.s("scalar_type", scalarTypeName((*input.second).scalar_type));
+        vector_loads << format(
+            "const Vec4<${scalar_type}> t${formal}_vec = *reinterpret_cast<const Vec4<${scalar_type}>*>(t${formal}.data + vecBase);\n",
+            env);
+        if (is_half) {
+          env.s(
+              "vec_access", format("__half2float(t${formal}_vec.v[vecLane])", env));
+        } else {
+          env.s("vec_access", format("t${formal}_vec.v[vecLane]", env));
+        }
+        vector_lane_loads << format("${lhs_type} ${node} = ${vec_access};\n", env);
+      }
     } else {
       env.s("access", format("s${formal}", env));
       env.s("lhs_type", variableType(input.first->type()));
+      if (can_vectorize) {
+        vector_lane_loads << format("${lhs_type} ${node} = ${access};\n", env);
+      }
     }
-    body << format("${lhs_type} ${node} = ${access};\n", env);
+    load_section << format("${lhs_type} ${node} = ${access};\n", env);
   }
 
   bool has_random = false;
@@ -470,7 +520,13 @@ std::string generateKernel(
       env.s("lhs_type", variableType(n->output()->type()));
     }
 
-    body << format("${lhs_type} ${node} = ${rhs};\n", env);
+    compute_section << format("${lhs_type} ${node} = ${rhs};\n", env);
+  }
+
+  // The vectorized kernel has no Philox preamble, so random fusions only get
+  // the scalar kernel.
+  if (has_random) {
+    can_vectorize = false;
   }
 
   // Generates writes to output tensors
@@ -484,10 +540,25 @@ std::string generateKernel(
     const auto is_half = (output.second.scalar_type == at::ScalarType::Half);
     if (is_half) {
       AT_ASSERT(use_cuda);
-      body << format("${access} = __float2half(${node});\n", env);
+      store_section << format("${access} = __float2half(${node});\n", env);
       has_half_tensor = true;
     } else {
-      body << format("${access} = ${node};\n", env);
+      store_section << format("${access} = ${node};\n", env);
+    }
+
+    if (can_vectorize) {
+      env.s("scalar_type", scalarTypeName(output.second.scalar_type));
+      vector_decls << format("Vec4<${scalar_type}> t${formal}_vec;\n", env);
+      if (is_half) {
+        vector_lane_stores << format(
+            "t${formal}_vec.v[vecLane] = __float2half(${node});\n", env);
+      } else {
+        vector_lane_stores << format(
+            "t${formal}_vec.v[vecLane] = ${node};\n", env);
+      }
+      vector_stores << format(
+          "*reinterpret_cast<Vec4<${scalar_type}>*>(t${formal}.data + vecBase) = t${formal}_vec;\n",
+          env);
     }
   }
 
@@ -511,13 +582,26 @@ std::string generateKernel(
 
   // Instantiates the CUDA or CPU-specific templates
   env.s("tensorOffsets", tensorOffsets.str());
-  env.s("kernelBody", body.str());
+  env.s(
+      "kernelBody",
+      load_section.str() + compute_section.str() + store_section.str());
   env.v("formals", formals);
   env.v("argument_loads", argument_loads);
   std::string code_string;
   if (use_cuda) {
     env.s("type_declarations", cuda::type_declarations_template.format(env));
     code_string = cuda::cuda_compilation_unit_template.format(env);
+    if (can_vectorize) {
+      env.s("kernelLoads", load_section.str());
+      env.s("kernelCompute", compute_section.str());
+      env.s("kernelStores", store_section.str());
+      env.s("vectorLoads", vector_loads.str());
+      env.s("vectorLaneLoads", vector_lane_loads.str());
+      env.s("vectorDecls", vector_decls.str());
+      env.s("vectorLaneStores", vector_lane_stores.str());
+      env.s("vectorStores", vector_stores.str());
+      code_string += cuda::cuda_vectorized_kernel_template.format(env);
+    }
   } else {
     env.s("type_declarations", cpu::type_declarations_template.format(env));
     code_string = cpu::cpu_compilation_unit_template.format(env);
@@ -7,12 +7,17 @@
 #include <ATen/CUDAGenerator.h>
 #include <THC/THC.h>
 #include <c10/cuda/CUDAGuard.h>
+#include <torch/csrc/jit/codegen/fuser/tensor_info.h>
 #include <torch/csrc/jit/resource_guard.h>
 
 #include <cuda_runtime.h>
 
 #include <algorithm>
 #include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <tuple>
@@ -64,6 +69,80 @@ static void getMajorMinor(
   }
 }
 
+// NOTE [ Persistent fusion cache ]
+//
+// NVRTC compilation of a fusion group takes on the order of a hundred
+// milliseconds, which adds up to a long warmup for processes running models
+// with many fusion groups. When PYTORCH_FUSION_CACHE_DIR points at a
+// writable directory, the PTX produced for each kernel is stored there,
+// keyed by the kernel source (hash and length), the compute architecture it
+// was compiled for and the NVRTC version; restarted workers then load the
+// PTX directly and skip NVRTC entirely. The cache is best effort: any read
+// or write failure silently falls back to compilation. To pre-populate it
+// at deployment time, run a warmup pass of the model on the target machine
+// with the environment variable set; the cache files are independent of the
+// producing process.
+
+namespace {
+
+const char* fusionCacheDir() {
+  static const char* cache_dir = std::getenv("PYTORCH_FUSION_CACHE_DIR");
+  return cache_dir;
+}
+
+std::string fusionCacheFile(
+    const std::string& code,
+    const int major,
+    const int minor,
+    const int nvrtc_major,
+    const int nvrtc_minor) {
+  const size_t code_hash = std::hash<std::string>{}(code);
+  std::stringstream ss;
+  ss << fusionCacheDir() << "/fusion_" << std::hex << code_hash << std::dec
+     << '_' << code.size() << "_sm" << major << minor << "_nvrtc"
+     << nvrtc_major << '.' << nvrtc_minor << ".ptx";
+  return ss.str();
+}
+
+bool loadCachedPtx(const std::string& path, std::vector<char>& ptx) {
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  if (!file) {
+    return false;
+  }
+  const auto size = file.tellg();
+  if (size <= 0) {
+    return false;
+  }
+  ptx.resize(static_cast<size_t>(size));
+  file.seekg(0);
+  file.read(ptx.data(), size);
+  return static_cast<bool>(file);
+}
+
+void storeCachedPtx(const std::string& path, const std::vector<char>& ptx) {
+  // Write to a unique temporary file and rename it into place so concurrent
+  // workers never observe a partially written entry.
+  std::stringstream tmp;
+  tmp << path << ".tmp." << std::random_device{}();
+  const std::string tmp_path = tmp.str();
+  {
+    std::ofstream file(tmp_path, std::ios::binary);
+    if (!file) {
+      return;
+    }
+    file.write(ptx.data(), ptx.size());
+    if (!file) {
+      std::remove(tmp_path.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+    std::remove(tmp_path.c_str());
+  }
+}
+
+} // namespace
+
 // Compiles the specified kernel and stores the metadata required to run it
 FusedKernelCUDA::FusedKernelCUDA(
     int16_t device,
@@ -103,42 +182,68 @@ FusedKernelCUDA::FusedKernelCUDA(
   int major, minor;
   getMajorMinor(prop_, major, minor);
 
-  // Creates the NVRTC program
-  nvrtcProgram program;
-  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcCreateProgram(
-      &program, code_.c_str(), nullptr, 0, nullptr, nullptr));
+  // Checks the persistent cache before invoking NVRTC; see
+  // NOTE [ Persistent fusion cache ].
+  std::string cache_file;
+  bool cached = false;
+  if (fusionCacheDir() != nullptr) {
+    int nvrtc_major, nvrtc_minor;
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcVersion(&nvrtc_major, &nvrtc_minor));
+    cache_file = fusionCacheFile(code_, major, minor, nvrtc_major, nvrtc_minor);
+    cached = loadCachedPtx(cache_file, ptx_);
+  }
+
+  if (!cached) {
+    // Creates the NVRTC program
+    nvrtcProgram program;
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcCreateProgram(
+        &program, code_.c_str(), nullptr, 0, nullptr, nullptr));
 
 #ifdef __HIP_PLATFORM_HCC__
-  std::vector<const char*> args = {};
+    std::vector<const char*> args = {};
 #else
-  const std::string compute = "--gpu-architecture=compute_" +
-      std::to_string(major) + std::to_string(minor);
-  const std::vector<const char*> args = {
-      "--std=c++14", compute.c_str(), "-default-device"};
+    const std::string compute = "--gpu-architecture=compute_" +
+        std::to_string(major) + std::to_string(minor);
+    const std::vector<const char*> args = {
+        "--std=c++14", compute.c_str(), "-default-device"};
 #endif
-  const auto result =
-      nvrtc().nvrtcCompileProgram(program, args.size(), args.data());
-  if (result != NVRTC_SUCCESS) {
-    size_t logsize;
-    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLogSize(program, &logsize));
-    std::vector<char> log(logsize);
-    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLog(program, log.data()));
-    std::stringstream cu;
-    cu << log.data();
-    throw std::runtime_error(cu.str());
+    const auto result =
+        nvrtc().nvrtcCompileProgram(program, args.size(), args.data());
+    if (result != NVRTC_SUCCESS) {
+      size_t logsize;
+      AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLogSize(program, &logsize));
+      std::vector<char> log(logsize);
+      AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetProgramLog(program, log.data()));
+      std::stringstream cu;
+      cu << log.data();
+      throw std::runtime_error(cu.str());
+    }
+    ResourceGuard holdProgram(
+        [&] { AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcDestroyProgram(&program)); });
+    AT_CUDA_NVRTC_CHECK(result);
+    size_t ptx_size;
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTXSize(program, &ptx_size));
+    ptx_.resize(ptx_size);
+    AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTX(program, ptx_.data()));
+
+    if (!cache_file.empty()) {
+      storeCachedPtx(cache_file, ptx_);
+    }
   }
-  ResourceGuard holdProgram(
-      [&] { AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcDestroyProgram(&program)); });
-  AT_CUDA_NVRTC_CHECK(result);
-  size_t ptx_size;
-  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTXSize(program, &ptx_size));
-  ptx_.resize(ptx_size);
-  AT_CUDA_NVRTC_CHECK(nvrtc().nvrtcGetPTX(program, ptx_.data()));
 
   AT_CUDA_DRIVER_CHECK(nvrtc().cuModuleLoadData(&module_, ptx_.data()));
   AT_CUDA_DRIVER_CHECK(
       nvrtc().cuModuleGetFunction(&function_, module_, name_.c_str()));
 
+  // The codegen emits a vectorized variant next to the scalar kernel when
+  // all tensors are contiguous (see generateKernel); probe for it. A missing
+  // entry just means this fusion always runs the scalar kernel.
+  const std::string vec_name = name_ + "_vec";
+  if (nvrtc().cuModuleGetFunction(&vec_function_, module_, vec_name.c_str()) !=
+      CUDA_SUCCESS) {
+    vec_function_ = nullptr;
+  }
+
   // Computes max blocks
 #ifdef __HIP_PLATFORM_HCC__
   // XXX HIP function signature is not compatible yet
@@ -160,15 +265,59 @@ static int ceilDiv(const int a, const int b) {
   return (a + b - 1) / b;
 }
 
+// Vec4 accesses require data pointers aligned to the vector width. 16 bytes
+// is the widest vector the codegen emits (Vec4<float>); checking every
+// pointer against it keeps the test independent of per-tensor dtypes.
+bool FusedKernelCUDA::tensorArgumentsAligned(
+    const std::vector<void*>& arguments) const {
+  constexpr uintptr_t kVectorAlignment = 16;
+  size_t flat_inputs_size = 0;
+  for (const auto& c : chunk_desc_)
+    flat_inputs_size += c.nSubTensors();
+  size_t flat_outputs_size = 0;
+  for (const auto& c : concat_desc_)
+    flat_outputs_size += c.nSubTensors();
+  const auto aligned = [](const void* ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % kVectorAlignment == 0;
+  };
+  // arguments is (&numel, *flat_inputs, *scalars, *flat_outputs); see
+  // launchFusion in executor.cpp
+  for (size_t i = 1; i <= flat_inputs_size; ++i) {
+    if (!aligned(static_cast<const TensorInfo*>(arguments[i])->data)) {
+      return false;
+    }
+  }
+  for (size_t i = arguments.size() - flat_outputs_size; i < arguments.size();
+       ++i) {
+    if (!aligned(static_cast<const TensorInfo*>(arguments[i])->data)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void FusedKernelCUDA::launch_raw(
     const uint32_t numel,
     std::vector<void*>& arguments) const {
-  at::cuda::CUDAGuard{device_};
-  // Hacked at::DeviceGuard (see note above)
+  // Hacked at::DeviceGuard (see note above). Launches from loops (e.g. RNN
+  // cells fused per timestep) hit this path once per step, so skip the
+  // cudaSetDevice round trip when we are already on the right device.
   const auto prior_device = at::cuda::current_device();
-  at::cuda::set_device(device_);
+  if (prior_device != device_) {
+    at::cuda::set_device(device_);
+  }
 
-  const auto nBlocks = std::min(maxBlocks_, ceilDiv(numel, kBlockSize));
+  // Picks the vectorized kernel when it was compiled (all tensors
+  // contiguous) and this launch's data pointers allow its wide accesses; it
+  // covers four elements per thread iteration, the scalar one covers one.
+  CUfunction function = function_;
+  uint32_t work_items = numel;
+  if (vec_function_ != nullptr && tensorArgumentsAligned(arguments)) {
+    function = vec_function_;
+    work_items = (numel + 3) / 4;
+  }
+
+  const auto nBlocks = std::min(maxBlocks_, ceilDiv(work_items, kBlockSize));
 
   // Adds random state to arguments if necessary
   // Note: philox_engine_inputs defined here so its lifetime extends to the launch
@@ -189,7 +338,7 @@ void FusedKernelCUDA::launch_raw(
   // Launches kernel on current stream (device was set by executor)
   auto stream = at::cuda::getCurrentCUDAStream();
   AT_CUDA_DRIVER_CHECK(nvrtc().cuLaunchKernel(
-      function_,
+      function,
       nBlocks,
       1,
       1,
@@ -202,7 +351,9 @@ void FusedKernelCUDA::launch_raw(
       nullptr));
 
   // Resets device (see at::DeviceGuard notes above)
-  at::cuda::set_device(prior_device);
+  if (prior_device != device_) {
+    at::cuda::set_device(prior_device);
+  }
 }
 
 FusedKernelCUDA::~FusedKernelCUDA() {
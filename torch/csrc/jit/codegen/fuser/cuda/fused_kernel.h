@@ -42,6 +42,10 @@ struct TORCH_CUDA_API FusedKernelCUDA : public ::torch::jit::fuser::FusedKernel
  private:
   static constexpr auto kBlockSize = 128;
 
+  // True if every tensor argument is aligned for the vectorized kernel's
+  // Vec4 accesses (see cuda_vectorized_kernel_template).
+  bool tensorArgumentsAligned(const std::vector<void*>& arguments) const;
+
   // Note: per device to store device properties and compute launch heuristics
   //  Acquiring these values at launch time would be too slow
   int16_t device_;
@@ -50,6 +54,11 @@ struct TORCH_CUDA_API FusedKernelCUDA : public ::torch::jit::fuser::FusedKernel
   std::vector<char> ptx_;
   CUmodule module_;
   CUfunction function_;
+
+  // Vectorized variant of function_; only present when the codegen could
+  // emit it (all tensors contiguous, see generateKernel), and only used for
+  // launches whose data pointers are 16-byte aligned.
+  CUfunction vec_function_ = nullptr;
 };
 
 } // namespace cuda
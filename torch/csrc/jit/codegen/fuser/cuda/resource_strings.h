@@ -182,6 +182,51 @@ void ${kernelName}(IndexType totalElements, ${formals} ${RandParam}) {
 }
 )");
 
+// Vectorized variant of the kernel above, emitted alongside it when every
+// tensor is fully contiguous (see generateKernel). Each thread handles four
+// consecutive elements per iteration through Vec4<T>, whose alignment makes
+// the compiler issue a single wide load/store per tensor (16 bytes for
+// float, 8 bytes for half) instead of four scalar transactions. Whether it
+// can actually be used for a given launch depends on the runtime alignment
+// of the data pointers, so the scalar kernel is always compiled too and the
+// launcher picks between them (see FusedKernelCUDA::launch_raw). The
+// trailing totalElements % 4 elements are handled by a scalar grid-stride
+// tail loop.
+static auto cuda_vectorized_kernel_template = CodeTemplate(R"(
+template<typename T>
+struct alignas(4 * sizeof(T)) Vec4 {
+  T v[4];
+};
+
+extern "C" __global__
+void ${kernelName}_vec(IndexType totalElements, ${formals}) {
+  const IndexType totalVecs = totalElements / 4;
+  for (IndexType vecIndex = blockIdx.x * blockDim.x + threadIdx.x;
+        vecIndex < totalVecs;
+        vecIndex += gridDim.x * blockDim.x) {
+      const IndexType vecBase = vecIndex * 4;
+      ${vectorLoads}
+      ${vectorDecls}
+      #pragma unroll
+      for (int vecLane = 0; vecLane < 4; ++vecLane) {
+        ${vectorLaneLoads}
+        ${kernelCompute}
+        ${vectorLaneStores}
+      }
+      ${vectorStores}
+    }
+  // scalar tail for the trailing totalElements % 4 elements
+  for (IndexType linearIndex = totalVecs * 4 + blockIdx.x * blockDim.x + threadIdx.x;
+        linearIndex < totalElements;
+        linearIndex += gridDim.x * blockDim.x) {
+      ${tensorOffsets}
+      ${kernelLoads}
+      ${kernelCompute}
+      ${kernelStores}
+    }
+}
+)");
+
 // This snippet enables half support in the jit. Following the pattern for
 // reductions, fp16 input data is immediately upconverted to float
 // with __half2float(). All mathematical operations are done on float
@@ -5,6 +5,7 @@
 #include <ATen/core/functional.h>
 #include <ATen/core/stack.h>
 #include <c10/util/Optional.h>
+#include <c10/util/SmallVector.h>
 #include <torch/csrc/jit/codegen/fuser/compiler.h>
 #include <torch/csrc/jit/codegen/fuser/interface.h>
 #include <torch/csrc/jit/codegen/fuser/kernel_cache.h>
@@ -224,7 +225,10 @@ void launchFusion(
   }
 
   // compute number of scalar inputs and convert them to float
-  std::vector<double> scalar_inputs;
+  // Note: SmallVector is used here (and for the TensorInfo buffer below) to
+  // keep the per-launch bookkeeping off the heap; this path runs once per
+  // kernel launch, e.g. once per timestep for a fused RNN cell.
+  c10::SmallVector<double, 8> scalar_inputs;
   scalar_inputs.reserve(all_inputs.size());
   for (auto const &input: all_inputs){
     if (input.isDouble()) scalar_inputs.push_back(input.to<float>());
@@ -237,7 +241,7 @@ void launchFusion(
       sizeof(TensorInfo) + 2 * sizeof(uint32_t) * uncompressedDim;
   size_t maxPossibleBufferSize =
       maxPossibleTensorInfoSize * (flat_inputs_size + flat_outputs_size);
-  std::vector<char> buffer(maxPossibleBufferSize);
+  c10::SmallVector<char, 512> buffer(maxPossibleBufferSize);
   char* buffer_next = buffer.data();
 
   // A vector of arguments to the kernel (numel, *input_desc_s, *output_desc_s)
@@ -328,6 +328,7 @@ void AliasDb::analyzeImpl(Node* node) {
     case prim::FusionGroup:
     case prim::CudaFusionGroup:
     case prim::DifferentiableGraph:
+    case prim::StreamSubgraph:
       return analyzeSubgraph(node);
     case prim::fork:
       return analyzeFork(node);
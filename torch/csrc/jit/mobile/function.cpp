@@ -5,6 +5,8 @@
 #include <torch/custom_class_detail.h>
 #include "interpreter.h"
 
+#include <limits>
+
 namespace torch{
 namespace jit{
 
@@ -35,13 +37,86 @@ bool Function::append_operator(const std::string& name,
   }
   // TODO: operator.h now does not depend on Node* so we can also look up operators from
   // that registry for use in mobile as a way to share implementations.
-  auto fn = [op](Stack& stack) {
-    c10::Dispatcher::singleton().callBoxed(*op, &stack);
-  };
-  code_->operators_.emplace_back(fn);
+  if (const c10::KernelFunction* kernel = op->singleCatchallKernel()) {
+    // The dispatch table holds a single catch-all kernel, so resolution
+    // cannot depend on the arguments: bind the kernel now and skip the
+    // per-call dispatch key extraction. Mobile op registrations are
+    // static, so the kernel outlives the loaded module.
+    auto handle = *op;
+    code_->operators_.emplace_back([kernel, handle](Stack& stack) {
+      kernel->callBoxed(handle, &stack);
+    });
+  } else {
+    auto fn = [op](Stack& stack) {
+      c10::Dispatcher::singleton().callBoxed(*op, &stack);
+    };
+    code_->operators_.emplace_back(fn);
+  }
   return true;
 }
 
+void Function::fuse_constant_loads() {
+  auto& instructions = code_->instructions_;
+  const int64_t size = instructions.size();
+
+  // A jump landing on the OP of a candidate pair must still execute only
+  // the call, so record every jump target first.
+  std::vector<bool> is_jump_target(size, false);
+  for (int64_t i = 0; i < size; ++i) {
+    const Instruction& inst = instructions[i];
+    if (inst.op == JF || inst.op == JMP || inst.op == LOOP) {
+      int64_t target = i + inst.X;
+      if (target >= 0 && target < size) {
+        is_jump_target[target] = true;
+      }
+    }
+  }
+
+  std::vector<bool> removed(size, false);
+  bool any_fused = false;
+  for (int64_t i = 0; i + 1 < size; ++i) {
+    const Instruction& load = instructions[i];
+    const Instruction& call = instructions[i + 1];
+    if (load.op != LOADC || call.op != OP) {
+      continue;
+    }
+    // The constant index has to fit OPC's 16-bit N field.
+    if (is_jump_target[i + 1] || load.X < 0 ||
+        load.X > std::numeric_limits<uint16_t>::max()) {
+      continue;
+    }
+    // The fused instruction takes the LOADC's slot, so a jump landing on
+    // the LOADC still runs both halves of the pair.
+    instructions[i] = Instruction(OPC, call.X, load.X);
+    removed[i + 1] = true;
+    any_fused = true;
+  }
+  if (!any_fused) {
+    return;
+  }
+
+  // Compact the stream and retarget jump offsets.
+  std::vector<int32_t> new_index(size);
+  std::vector<Instruction> compacted;
+  compacted.reserve(size);
+  for (int64_t i = 0; i < size; ++i) {
+    new_index[i] = compacted.size();
+    if (!removed[i]) {
+      compacted.push_back(instructions[i]);
+    }
+  }
+  for (int64_t i = 0; i < size; ++i) {
+    if (removed[i]) {
+      continue;
+    }
+    Instruction& inst = compacted[new_index[i]];
+    if (inst.op == JF || inst.op == JMP || inst.op == LOOP) {
+      inst.X = new_index[i + inst.X] - new_index[i];
+    }
+  }
+  instructions = std::move(compacted);
+}
+
 void Function::append_constant(const c10::IValue& constant) {
   code_->constants_.push_back(constant);
 }
@@ -54,7 +129,22 @@ void Function::set_register_size(size_t size) {
   code_->register_size_ = size;
 }
 
+void Function::set_lazy_initializer(std::function<void()> initializer) {
+  lazy_initializer_ = std::move(initializer);
+}
+
+void Function::materialize() const {
+  if (lazy_initializer_) {
+    // Clear the initializer before running it so a recursive lookup of this
+    // function does not re-enter it.
+    auto initializer = std::move(lazy_initializer_);
+    lazy_initializer_ = nullptr;
+    initializer();
+  }
+}
+
 bool Function::run(Stack& stack) const {
+  materialize();
   InterpreterState interp_state(code_);
   return interp_state.run(stack);
 }
@@ -1,6 +1,7 @@
 #pragma once
 #include <ATen/core/ivalue.h>
 //#include <aten/src/Aten/core/operator_name.h>
+#include <functional>
 #include <vector>
 
 namespace torch{
@@ -25,9 +26,24 @@ class Function{
 
   void set_register_size(size_t size);
 
+  // Bytecode-level peephole: folds each LOADC directly followed by a plain
+  // OP into one fused OPC instruction and retargets jump offsets to the
+  // compacted stream. Called by the importer once a method's tables are
+  // fully parsed.
+  void fuse_constant_loads();
+
+  // Defers building this function's Code until its first run. The importer
+  // uses this so that loading a module only pays bytecode parsing and
+  // operator resolution for the methods that are actually invoked
+  // (see import.cpp).
+  void set_lazy_initializer(std::function<void()> initializer);
+
  private:
+  void materialize() const;
+
   c10::QualifiedName name_;
   std::shared_ptr<Code> code_;
+  mutable std::function<void()> lazy_initializer_;
 };
 
 } // namespace mobile
@@ -62,6 +62,52 @@ void print_unsupported_ops_and_throw(const std::unordered_set<std::string>& unsu
   TORCH_CHECK(false, "Following ops cannot be found:", error_message);
 }
 
+void parseMethodTable(const IValue& table, mobile::Function* function) {
+  const auto& ins_list = expect_field(table, "instructions", 0).toTuple()->elements();
+  const auto& ops_list = expect_field(table, "operators", 1).toTuple()->elements();
+  const auto& consts_list = expect_field(table, "constants", 2).toTuple()->elements();
+  const auto& types_list = expect_field(table, "types", 3).toTuple()->elements();
+  const auto& register_size = expect_field(table, "register_size", 4).toInt();
+
+  for (const auto& ins : ins_list) {
+    auto ins_item = ins.toTuple()->elements();
+    TORCH_CHECK(ins_item.size() == 3,
+                "There should be three parts in an instruction.");
+    OpCode op_code = parseOpCode(ins_item[0].toString()->string().c_str());
+    int X = ins_item[1].toInt();
+    int N = ins_item[2].toInt();
+    function->append_instruction(op_code, X, N);
+  }
+
+  std::unordered_set<std::string> unsupported_op_names;
+  for (const auto& op : ops_list) {
+    auto op_item = op.toTuple()->elements();
+    TORCH_CHECK(op_item.size() == 2,
+                "There should be two parts in an operator name.");
+    auto op_found = function->append_operator(op_item[0].toString()->string(),
+                         op_item[1].toString()->string());
+    if (!op_found) {
+      unsupported_op_names.emplace(op_item[0].toString()->string() + "." + op_item[1].toString()->string());
+    }
+  }
+
+  if (!unsupported_op_names.empty()) {
+    print_unsupported_ops_and_throw(unsupported_op_names);
+  };
+
+  for (const auto& constant : consts_list) {
+    function->append_constant(constant);
+  }
+
+  for (const auto& t : types_list) {
+    function->append_type(c10::parseType(t.toStringRef()));
+  }
+
+  function->set_register_size(register_size);
+
+  function->fuse_constant_loads();
+}
+
 void parseMethods(
     const std::vector<IValue>& vals,
     mobile::CompilationUnit& mcu) {
@@ -73,47 +119,16 @@ void parseMethods(
     auto function = std::unique_ptr<mobile::Function>(
         new mobile::Function(c10::QualifiedName(function_name)));
 
-    const auto& ins_list = expect_field(table, "instructions", 0).toTuple()->elements();
-    const auto& ops_list = expect_field(table, "operators", 1).toTuple()->elements();
-    const auto& consts_list = expect_field(table, "constants", 2).toTuple()->elements();
-    const auto& types_list = expect_field(table, "types", 3).toTuple()->elements();
-    const auto& register_size = expect_field(table, "register_size", 4).toInt();
-
-    for (const auto& ins : ins_list) {
-      auto ins_item = ins.toTuple()->elements();
-      TORCH_CHECK(ins_item.size() == 3,
-                  "There should be three parts in an instruction.");
-      OpCode op_code = parseOpCode(ins_item[0].toString()->string().c_str());
-      int X = ins_item[1].toInt();
-      int N = ins_item[2].toInt();
-      function->append_instruction(op_code, X, N);
-    }
-
-    std::unordered_set<std::string> unsupported_op_names;
-    for (const auto& op : ops_list) {
-      auto op_item = op.toTuple()->elements();
-      TORCH_CHECK(op_item.size() == 2,
-                  "There should be two parts in an operator name.");
-      auto op_found = function->append_operator(op_item[0].toString()->string(),
-                           op_item[1].toString()->string());
-      if (!op_found) {
-        unsupported_op_names.emplace(op_item[0].toString()->string() + "." + op_item[1].toString()->string());
-      }
-    }
-
-    if (!unsupported_op_names.empty()) {
-      print_unsupported_ops_and_throw(unsupported_op_names);
-    };
-
-    for (const auto& constant : consts_list) {
-      function->append_constant(constant);
-    }
-
-    for (const auto& t : types_list) {
-      function->append_type(c10::parseType(t.toStringRef()));
-    }
-
-    function->set_register_size(register_size);
+    // Materializing a method parses instruction strings, resolves every
+    // operator against the dispatcher and parses type strings, which
+    // dominates module load time. Defer that work to the method's first
+    // invocation, so cold start only pays for the entry method actually
+    // used. The bytecode table IValues stay alive in the closure until the
+    // method is materialized. Note that this also moves unsupported-operator
+    // errors from load time to the first call of the affected method.
+    mobile::Function* raw_function = function.get();
+    function->set_lazy_initializer(
+        [table, raw_function]() { parseMethodTable(table, raw_function); });
 
     mcu.register_function(std::move(function));
   }
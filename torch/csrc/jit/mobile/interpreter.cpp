@@ -56,6 +56,20 @@ bool InterpreterState::run(Stack& stack) {
         code_->operators_[inst.X](stack);
         ++pc;
       } break;
+      case OPC: {
+#if defined(PYTORCH_MOBILE_OPERATOR_OBSERVER)
+        if (auto debug_info = at::getThreadLocalDebugInfo()) {
+          if (auto* mobile_debug_info = dynamic_cast<MobileDebugInfo*>(
+            debug_info.get())) {
+            mobile_debug_info->setOpIdx(pc);
+          }
+        }
+        RECORD_FUNCTION(code_->op_names_[inst.X].name, stack);
+#endif
+        stack.emplace_back(code_->constants_[inst.N]);
+        code_->operators_[inst.X](stack);
+        ++pc;
+      } break;
       case INTERFACE_CALL: {
         torch::jit::Function* method =
             peek(stack, 0, inst.N)
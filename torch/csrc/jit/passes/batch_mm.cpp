@@ -455,6 +455,136 @@ void BatchMMSide(Block* block, AliasDb& alias_db) {
   }
 }
 
+bool shape_is_fast_for_stacked(const at::Tensor& lhs, const at::Tensor& rhs) {
+  // Stacking copies every operand, so batching into one bmm only pays off
+  // while the individual mms are small enough to be overhead-bound. Cutoff
+  // in line with the one for MMBatchSide.
+  return lhs.numel() <= 1024 * 2048 && rhs.numel() <= 1024 * 2048;
+}
+
+RegisterOperators mm_batch_stacked_reg({Operator(
+    prim::MMBatchStacked,
+    [](const Node* node) -> Operation {
+      size_t num_mms = node->inputs().size() / 2;
+      return [num_mms](Stack& stack) {
+        std::vector<at::Tensor> inputs;
+        inputs.reserve(2 * num_mms);
+        for (auto it = stack.end() - 2 * num_mms; it != stack.end(); ++it) {
+          inputs.push_back(std::move(*it).toTensor());
+        }
+        drop(stack, 2 * num_mms);
+
+        auto lhs_inputs = at::TensorList(inputs).slice(0, num_mms);
+        auto rhs_inputs = at::TensorList(inputs).slice(num_mms);
+        // the pass groups by profiled shape where it can, but unprofiled
+        // operands share a group on the assumption they match; verify here
+        // and run the mms one by one when they don't
+        if (have_same_shape(lhs_inputs) && have_same_shape(rhs_inputs) &&
+            shape_is_fast_for_stacked(lhs_inputs[0], rhs_inputs[0])) {
+          auto bmm_out =
+              at::bmm(at::stack(lhs_inputs, 0), at::stack(rhs_inputs, 0));
+          auto outputs = bmm_out.unbind(0);
+          stack.insert(
+              stack.end(),
+              std::make_move_iterator(outputs.begin()),
+              std::make_move_iterator(outputs.end()));
+        } else {
+          for (size_t i = 0; i < num_mms; ++i) {
+            stack.emplace_back(lhs_inputs[i].mm(rhs_inputs[i]));
+          }
+        }
+        return 0;
+      };
+    },
+    aliasAnalysisIsSpecialCase())});
+
+// key under which an mm node is grouped for stacking: the concrete operand
+// shapes and dtype when profiling has filled them in, otherwise a shared
+// "unknown" bucket that leans on the runtime same-shape check
+std::string stackedGroupKey(Node* mm) {
+  std::string key;
+  for (Value* input : mm->inputs()) {
+    auto tt = input->type()->cast<TensorType>();
+    auto sizes = tt ? tt->sizes().concrete_sizes() : c10::nullopt;
+    auto scalar_type = tt ? tt->scalarType() : c10::nullopt;
+    if (!sizes || !scalar_type) {
+      return "?";
+    }
+    for (auto s : *sizes) {
+      key += std::to_string(s);
+      key += 'x';
+    }
+    key += toString(*scalar_type);
+    key += '|';
+  }
+  return key;
+}
+
+// Groups shape-identical mms with unrelated operands (mixture-of-experts
+// style graphs) into one stacked bmm; the phases above only fire when the
+// mms share an operand or feed a tree of adds.
+void BatchMMStacked(Block* block, AliasDb& alias_db) {
+  // same batching threshold as MMBatchSide; below it the stack/unbind
+  // traffic costs more than the saved dispatches
+  static constexpr size_t how_many_is_many = 8;
+
+  std::vector<std::vector<Node*>> groups;
+  std::unordered_map<std::string, size_t> group_index;
+  for (Node* node : block->nodes()) {
+    if (node->matches("aten::mm(Tensor self, Tensor mat2) -> Tensor")) {
+      auto emplaced =
+          group_index.emplace(stackedGroupKey(node), groups.size());
+      if (emplaced.second) {
+        groups.emplace_back();
+      }
+      groups[emplaced.first->second].push_back(node);
+    } else {
+      for (Block* subblock : node->blocks()) {
+        BatchMMStacked(subblock, alias_db);
+      }
+    }
+  }
+
+  for (auto& mms : groups) {
+    // drop mms that depend on an earlier member of the group; the nodes are
+    // already in topological order since blocks iterate that way
+    for (size_t i = 0; i < mms.size(); ++i) {
+      if (mms[i] == nullptr)
+        continue;
+      for (size_t j = i + 1; j < mms.size(); ++j) {
+        if (mms[j] == nullptr)
+          continue;
+        if (!alias_db.couldMoveBeforeTopologically(mms[j], mms[i])) {
+          mms[j] = nullptr;
+        }
+      }
+    }
+    mms = c10::filter(mms, [](Node* n) { return n != nullptr; });
+    if (mms.size() < how_many_is_many) {
+      continue;
+    }
+
+    for (int64_t i = static_cast<int64_t>(mms.size()) - 2; i >= 0; --i) {
+      bool move_ok = alias_db.moveBeforeTopologicallyValid(mms[i], mms[i + 1]);
+      AT_ASSERT(move_ok);
+    }
+    WithInsertPoint insert_guard{mms[0]};
+    Graph* graph = mms[0]->owningGraph();
+    Node* batch_mm = graph->create(
+        prim::MMBatchStacked,
+        /*inputs=*/{},
+        /*num_outputs=*/mms.size());
+    graph->insertNode(batch_mm);
+    for (Node* mm : mms) {
+      batch_mm->addInput(mm->inputs().at(0));
+    }
+    for (size_t i = 0; i < mms.size(); ++i) {
+      batch_mm->addInput(mms[i]->inputs().at(1));
+      mms[i]->output()->replaceAllUsesWith(batch_mm->outputs().at(i));
+    }
+  }
+}
+
 bool hasMutableOperators(Block* block) {
   for (auto n : block->nodes()) {
     if (n->kind().is_aten() && n->schema().is_mutable())
@@ -475,6 +605,12 @@ void BatchMM(std::shared_ptr<Graph>& graph) {
   AliasDb alias_db(graph);
   BatchMMTreeReduce(graph->block());
   BatchMMSide(graph->block(), alias_db);
+  // clear out the mms the first two phases consumed, then give the stacked
+  // phase a fresh view of what is left (it also moves nodes around, which
+  // the original alias db has not seen)
+  EliminateDeadCode(graph);
+  AliasDb stacked_alias_db(graph);
+  BatchMMStacked(graph->block(), stacked_alias_db);
   EliminateDeadCode(graph);
   // It's possible that transpose rearrangements have created sequences of
   // consecutive transposes that didn't exist before.
@@ -0,0 +1,266 @@
+#include <torch/csrc/jit/passes/create_stream_subgraphs.h>
+
+#include <ATen/core/stack.h>
+#include <ATen/detail/CUDAHooksInterface.h>
+#include <c10/core/Event.h>
+#include <c10/core/StreamGuard.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/passes/utils/subgraph_utils.h>
+#include <torch/csrc/jit/runtime/graph_executor.h>
+#include <torch/csrc/jit/runtime/operator.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+c10::AliasAnalysisKind aliasAnalysisInternalSpecialCase() {
+  return AliasAnalysisKind::INTERNAL_SPECIAL_CASE;
+}
+
+// Builds prim::StreamSubgraph groups by merging producers into consumers
+// along data edges, following the structure of SubgraphSlicer in
+// create_autodiff_subgraphs.cpp. Nodes connected through (non-constant)
+// dataflow end up in the same group, so the surviving groups are exactly
+// the independent chains that may overlap on separate streams; chains that
+// later turn out to share a producer collapse into a single group when one
+// group consumes the output of another.
+class StreamSubgraphSlicer {
+ public:
+  StreamSubgraphSlicer(
+      Block* block,
+      std::shared_ptr<Graph> graph,
+      size_t minSubgraphSize)
+      : block_(block),
+        graph_(std::move(graph)),
+        minSubgraphSize_(minSubgraphSize) {}
+
+  void run() {
+    // Like SubgraphSlicer, iterate to fixpoint because
+    // moveBeforeTopologicallyValid may reorder nodes to be after the
+    // current iteration point.
+    bool any_changed = true;
+    while (any_changed) {
+      any_changed = false;
+      AliasDb aliasDb(graph_);
+      for (auto it = block_->nodes().rbegin(); it != block_->nodes().rend();) {
+        bool changed;
+        std::tie(it, changed) = scanNode(*it, aliasDb);
+        any_changed |= changed;
+      }
+    }
+
+    std::vector<Node*> groups;
+    for (Node* n : block_->nodes()) {
+      if (n->kind() == prim::StreamSubgraph) {
+        groups.push_back(n);
+      }
+    }
+
+    // A lone group has nothing to overlap with, and undersized groups are
+    // not worth the executor round-trip; inline them back.
+    size_t viable = 0;
+    for (Node* group : groups) {
+      if (!isTooSmall(group)) {
+        ++viable;
+      }
+    }
+    for (Node* group : groups) {
+      if (viable < 2 || isTooSmall(group)) {
+        SubgraphUtils::unmergeSubgraph(group);
+      }
+    }
+  }
+
+ private:
+  bool isTooSmall(Node* group) {
+    AT_ASSERT(group->kind() == prim::StreamSubgraph);
+    auto subgraph = SubgraphUtils::getSubgraph(group);
+    size_t num_nodes = 0;
+    for (auto it = subgraph->nodes().begin(); it != subgraph->nodes().end();
+         ++it) {
+      if (it->kind() != prim::Constant && ++num_nodes >= minSubgraphSize_) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool shouldConsiderForMerge(Node* node, AliasDb& aliasDb) {
+    if (node->kind() == prim::StreamSubgraph) {
+      return true;
+    }
+    // Constants are copied into subgraphs by the merge utilities rather
+    // than acting as dependencies, so they must not seed groups.
+    if (node->kind() == prim::Constant) {
+      return false;
+    }
+    if (!node->blocks().empty() || node->hasSideEffects()) {
+      return false;
+    }
+    // A side stream runs concurrently with the rest of the graph, so only
+    // nodes free of mutation (in either direction) are eligible.
+    if (aliasDb.hasWriters(node)) {
+      return false;
+    }
+    return true;
+  }
+
+  std::vector<Value*> sortReverseTopological(ArrayRef<Value*> inputs) {
+    std::vector<Value*> result;
+    for (auto i : inputs) {
+      if (i->node()->owningBlock() == block_) {
+        result.push_back(i);
+      }
+    }
+    std::sort(result.begin(), result.end(), [&](Value* a, Value* b) {
+      return a->node()->isAfter(b->node());
+    });
+    return result;
+  }
+
+  std::pair<graph_node_list::iterator, bool> scanNode(
+      Node* consumer,
+      AliasDb& aliasDb) {
+    if (shouldConsiderForMerge(consumer, aliasDb)) {
+      if (consumer->kind() != prim::StreamSubgraph) {
+        consumer = SubgraphUtils::createSingletonSubgraph(
+            consumer, prim::StreamSubgraph);
+      }
+      auto inputs = sortReverseTopological(consumer->inputs());
+      for (auto input : inputs) {
+        if (auto group = tryMerge(consumer, input->node(), aliasDb)) {
+          // The new group's inputs may have changed, so rescan it.
+          return std::make_pair(group.value()->reverseIterator(), true);
+        }
+      }
+    }
+
+    return std::make_pair(++consumer->reverseIterator(), false);
+  }
+
+  c10::optional<Node*> tryMerge(
+      Node* consumer,
+      Node* producer,
+      AliasDb& aliasDb) {
+    AT_ASSERT(consumer->kind() == prim::StreamSubgraph);
+    bool canMerge = shouldConsiderForMerge(producer, aliasDb) &&
+        aliasDb.moveBeforeTopologicallyValid(producer, consumer);
+
+    if (!canMerge) {
+      return c10::nullopt;
+    }
+
+    SubgraphUtils::mergeNodeIntoSubgraph(producer, consumer);
+
+    return consumer;
+  }
+
+  Block* block_;
+  std::shared_ptr<Graph> graph_;
+  size_t minSubgraphSize_;
+};
+
+// Runs one prim::StreamSubgraph on a side stream. The CPU never blocks:
+// kernels are enqueued on the side stream and the parent stream is ordered
+// after them with an event, so sibling StreamSubgraph nodes keep enqueueing
+// work that overlaps on the device.
+struct StreamSubgraphOp {
+  StreamSubgraphOp(std::shared_ptr<Graph> graph)
+      : executor(graph, "<StreamSubgraph>"),
+        num_inputs(graph->inputs().size()),
+        num_outputs(graph->outputs().size()) {}
+
+  int operator()(Stack& stack) {
+    c10::optional<c10::Device> device = findCudaDevice(stack);
+    if (!device) {
+      // Nothing to overlap; run on the current stream.
+      executor.run(stack);
+      return 0;
+    }
+
+    const auto& hooks = at::detail::getCUDAHooks();
+    c10::impl::VirtualGuardImpl impl(device->type());
+    c10::Stream parent = impl.getStream(*device);
+    c10::Stream side = hooks.getStreamFromPool(device->index());
+
+    // The side stream may only start once everything already enqueued on
+    // the parent stream is done.
+    c10::Event ready(device->type());
+    ready.record(parent);
+    ready.block(side);
+
+    {
+      c10::StreamGuard guard(side);
+      // Inputs were allocated on the parent stream; tell the caching
+      // allocator they now have pending uses on the side stream.
+      for (size_t i = 0; i < num_inputs; ++i) {
+        recordStreamFor(peek(stack, i, num_inputs), side, hooks);
+      }
+      executor.run(stack);
+    }
+
+    // Event-based join: the parent stream waits for this branch, and
+    // outputs produced on the side stream are marked as used on the
+    // parent stream.
+    c10::Event done(device->type());
+    done.record(side);
+    done.block(parent);
+    for (size_t i = 0; i < num_outputs; ++i) {
+      recordStreamFor(peek(stack, i, num_outputs), parent, hooks);
+    }
+    return 0;
+  }
+
+ private:
+  static c10::optional<c10::Device> findCudaDevice(const Stack& stack) {
+    if (!at::detail::getCUDAHooks().hasCUDA()) {
+      return c10::nullopt;
+    }
+    for (const IValue& v : stack) {
+      if (v.isTensor()) {
+        const auto& t = v.toTensor();
+        if (t.defined() && t.is_cuda()) {
+          return t.device();
+        }
+      }
+    }
+    return c10::nullopt;
+  }
+
+  static void recordStreamFor(
+      const IValue& v,
+      c10::Stream stream,
+      const at::CUDAHooksInterface& hooks) {
+    if (!v.isTensor()) {
+      return;
+    }
+    const auto& t = v.toTensor();
+    if (t.defined() && t.is_cuda()) {
+      hooks.recordStreamOnDataPtr(t.storage().data_ptr(), stream);
+    }
+  }
+
+  GraphExecutor executor;
+  size_t num_inputs;
+  size_t num_outputs;
+};
+
+RegisterOperators StreamSubgraphOps({Operator(
+    prim::StreamSubgraph,
+    [](const Node* node) -> Operation {
+      return StreamSubgraphOp(node->g(attr::Subgraph));
+    },
+    aliasAnalysisInternalSpecialCase())});
+
+} // namespace
+
+void CreateStreamSubgraphs(
+    const std::shared_ptr<Graph>& graph,
+    size_t min_subgraph_size) {
+  StreamSubgraphSlicer(graph->block(), graph, min_subgraph_size).run();
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+#include <cstddef>
+
+namespace torch {
+namespace jit {
+
+// Groups independent chains of pure operator nodes in the top-level block
+// into prim::StreamSubgraph nodes. At runtime each subgraph runs on a side
+// stream drawn from the CUDA stream pool, with event-based joins against
+// the surrounding stream, so independent branches of a model overlap on
+// the GPU instead of serializing on the current stream. Without CUDA, or
+// when a subgraph receives no CUDA tensors, it runs inline on the current
+// stream.
+//
+// The pass is opt-in and applied per module, e.g. via
+// torch._C._jit_pass_create_stream_subgraphs on a method's graph.
+// min_subgraph_size - smallest group worth diverting to a side stream;
+// smaller groups are inlined back. If fewer than two groups survive there
+// is nothing to overlap and the pass leaves the graph unchanged.
+TORCH_API void CreateStreamSubgraphs(
+    const std::shared_ptr<Graph>& graph,
+    size_t min_subgraph_size = 2);
+
+} // namespace jit
+} // namespace torch
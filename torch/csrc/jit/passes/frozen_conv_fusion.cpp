@@ -0,0 +1,169 @@
+#include <torch/csrc/jit/passes/frozen_conv_fusion.h>
+
+#include <ATen/Context.h>
+#include <ATen/native/mkldnn/Conv.h>
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+#include <torch/csrc/jit/passes/subgraph_rewrite.h>
+#include <torch/csrc/jit/runtime/custom_operator.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Returns the tensor held by a constant Value, or nullopt if the Value is
+// not a constant tensor (e.g. still a module attribute in an unfrozen
+// graph).
+c10::optional<at::Tensor> constantTensor(Value* v) {
+  if (v->node()->kind() != prim::Constant) {
+    return c10::nullopt;
+  }
+  auto ivalue = toIValue(v);
+  if (!ivalue || !ivalue->isTensor()) {
+    return c10::nullopt;
+  }
+  return ivalue->toTensor();
+}
+
+// As above, but for Tensor? arguments: a constant None yields an undefined
+// tensor, a non-constant yields nullopt.
+c10::optional<at::Tensor> constantOptionalTensor(Value* v) {
+  if (v->node()->kind() != prim::Constant) {
+    return c10::nullopt;
+  }
+  auto ivalue = toIValue(v);
+  if (!ivalue) {
+    return c10::nullopt;
+  }
+  if (ivalue->isNone()) {
+    return at::Tensor();
+  }
+  if (ivalue->isTensor()) {
+    return ivalue->toTensor();
+  }
+  return c10::nullopt;
+}
+
+void FoldFrozenConvBatchnormInBlock(
+    Block* block,
+    std::shared_ptr<Graph>& graph) {
+  // collect first; folding mutates the node list
+  std::vector<Node*> batchnorms;
+  for (Node* n : block->nodes()) {
+    for (Block* b : n->blocks()) {
+      FoldFrozenConvBatchnormInBlock(b, graph);
+    }
+    if (n->kind() == aten::batch_norm) {
+      batchnorms.push_back(n);
+    }
+  }
+
+  for (Node* bn : batchnorms) {
+    Node* conv = bn->input(0)->node();
+    if (conv->kind() != aten::conv2d ||
+        conv->output()->uses().size() != 1) {
+      continue;
+    }
+    // only eval-mode batch norms with constant parameters can be folded
+    auto training = toIValue(bn->input(5));
+    if (!training || !training->isBool() || training->toBool()) {
+      continue;
+    }
+    auto eps = toIValue(bn->input(7));
+    auto conv_w = constantTensor(conv->input(1));
+    auto conv_b = constantOptionalTensor(conv->input(2));
+    auto bn_w = constantOptionalTensor(bn->input(1));
+    auto bn_b = constantOptionalTensor(bn->input(2));
+    auto mean = constantTensor(bn->input(3));
+    auto var = constantTensor(bn->input(4));
+    if (!eps || !conv_w || !conv_b || !bn_w || !bn_b || !mean || !var) {
+      continue;
+    }
+
+    at::Tensor scale = at::rsqrt(*var + eps->toDouble());
+    if (bn_w->defined()) {
+      scale = scale * *bn_w;
+    }
+    at::Tensor new_w = *conv_w * scale.reshape({-1, 1, 1, 1});
+    at::Tensor new_b =
+        (conv_b->defined() ? *conv_b - *mean : -*mean) * scale;
+    if (bn_b->defined()) {
+      new_b = new_b + *bn_b;
+    }
+
+    WithInsertPoint guard(conv);
+    conv->replaceInput(
+        1, graph->insertConstant(new_w.to(conv_w->scalar_type())));
+    conv->replaceInput(
+        2, graph->insertConstant(new_b.to(conv_w->scalar_type())));
+    bn->output()->replaceAllUsesWith(conv->output());
+    bn->destroy();
+  }
+}
+
+// The fused kernel; kept out of native_functions.yaml since only this pass
+// emits it. Argument order follows aten::conv2d so the rewrite is a plain
+// renaming.
+RegisterOperators mkldnn_conv_relu_reg({Operator(
+    "mkldnn::conv2d_relu(Tensor input, Tensor weight, Tensor? bias, int[2] stride, int[2] padding, int[2] dilation, int groups) -> Tensor",
+    [](Stack& stack) {
+      const int64_t groups = pop(stack).toInt();
+      auto dilation = pop(stack).toIntVector();
+      auto padding = pop(stack).toIntVector();
+      auto stride = pop(stack).toIntVector();
+      auto bias_ivalue = pop(stack);
+      at::Tensor bias;
+      if (!bias_ivalue.isNone()) {
+        bias = bias_ivalue.toTensor();
+      }
+      auto weight = pop(stack).toTensor();
+      auto input = pop(stack).toTensor();
+      push(
+          stack,
+          at::native::mkldnn_convolution_relu(
+              input.contiguous(),
+              weight.contiguous(),
+              bias,
+              padding,
+              stride,
+              dilation,
+              groups));
+      return 0;
+    },
+    aliasAnalysisFromSchema())});
+
+} // namespace
+
+void FoldFrozenConvBatchnorm(std::shared_ptr<Graph>& graph) {
+  FoldFrozenConvBatchnormInBlock(graph->block(), graph);
+  EliminateDeadCode(graph);
+}
+
+void FuseFrozenConvRelu(std::shared_ptr<Graph>& graph) {
+  if (!at::hasMKLDNN()) {
+    return;
+  }
+  std::string conv_relu = R"IR(
+    graph(%input, %weight, %bias, %stride, %padding, %dilation, %groups):
+        %conv = aten::conv2d(%input, %weight, %bias, %stride, %padding, %dilation, %groups)
+        %res = aten::relu(%conv)
+        return (%res))IR";
+  std::string conv_relu_inplace = R"IR(
+    graph(%input, %weight, %bias, %stride, %padding, %dilation, %groups):
+        %conv = aten::conv2d(%input, %weight, %bias, %stride, %padding, %dilation, %groups)
+        %res = aten::relu_(%conv)
+        return (%res))IR";
+  std::string fused_conv_relu = R"IR(
+    graph(%input, %weight, %bias, %stride, %padding, %dilation, %groups):
+        %res = mkldnn::conv2d_relu(%input, %weight, %bias, %stride, %padding, %dilation, %groups)
+        return (%res))IR";
+
+  SubgraphRewriter rewriter;
+  rewriter.RegisterRewritePattern(conv_relu, fused_conv_relu);
+  rewriter.RegisterRewritePattern(conv_relu_inplace, fused_conv_relu);
+  rewriter.runOnGraph(graph);
+}
+
+} // namespace jit
+} // namespace torch
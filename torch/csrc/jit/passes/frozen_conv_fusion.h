@@ -0,0 +1,33 @@
+/** \brief Conv fusions for frozen inference graphs.
+ *
+ * After freeze_module has inlined attributes as constants, conv2d ->
+ * batch_norm -> relu chains still execute as three dispatched ops. These
+ * passes fold the batch norm parameters into the conv weights and emit a
+ * single MKL-DNN conv-with-post-op call for the relu.
+ */
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+/** \brief Fold batch_norm into a preceding conv2d.
+ *
+ * Applies when the conv weights and all batch norm parameters are constants
+ * (i.e. the module has been frozen) and the batch norm runs in eval mode;
+ * the conv weight and bias constants are recomputed and the batch_norm node
+ * removed.
+ */
+TORCH_API void FoldFrozenConvBatchnorm(std::shared_ptr<Graph>& graph);
+
+/** \brief Rewrite conv2d followed by relu into mkldnn::conv2d_relu.
+ *
+ * The fused op runs the relu as an MKL-DNN post-op inside the conv kernel.
+ * Only valid for float CPU inference graphs; the pass is a no-op when ATen
+ * was built without MKL-DNN.
+ */
+TORCH_API void FuseFrozenConvRelu(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
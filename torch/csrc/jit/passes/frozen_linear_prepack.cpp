@@ -0,0 +1,101 @@
+#include <torch/csrc/jit/passes/frozen_linear_prepack.h>
+
+#include <ATen/Context.h>
+#include <ATen/native/mkldnn/Linear.h>
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+#include <torch/csrc/jit/passes/fuse_linear.h>
+#include <torch/csrc/jit/runtime/custom_operator.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// Returns the tensor held by a constant Value, or nullopt if the Value is
+// not a constant tensor.
+c10::optional<at::Tensor> constantTensor(Value* v) {
+  if (v->node()->kind() != prim::Constant) {
+    return c10::nullopt;
+  }
+  auto ivalue = toIValue(v);
+  if (!ivalue || !ivalue->isTensor()) {
+    return c10::nullopt;
+  }
+  return ivalue->toTensor();
+}
+
+// A weight can only be packed up front if it is a frozen constant of the
+// kind mkldnn_reorder_linear_weight accepts.
+bool isPackableWeight(const at::Tensor& weight) {
+  return weight.defined() && !weight.is_mkldnn() &&
+      weight.device().is_cpu() && weight.layout() == c10::kStrided &&
+      weight.scalar_type() == at::ScalarType::Float && weight.dim() == 2;
+}
+
+void PrepackFrozenLinearInBlock(Block* block, std::shared_ptr<Graph>& graph) {
+  // collect first; rewriting mutates the node list
+  std::vector<Node*> linears;
+  for (Node* n : block->nodes()) {
+    for (Block* b : n->blocks()) {
+      PrepackFrozenLinearInBlock(b, graph);
+    }
+    if (n->kind() == aten::linear) {
+      linears.push_back(n);
+    }
+  }
+
+  for (Node* n : linears) {
+    auto weight = constantTensor(n->input(1));
+    if (!weight || !isPackableWeight(*weight)) {
+      continue;
+    }
+
+    WithInsertPoint guard(n);
+    Value* packed_weight = graph->insertConstant(
+        at::native::mkldnn_reorder_linear_weight(*weight));
+    Node* prepacked = graph->create(
+        Symbol::fromQualString("mkldnn::prepacked_linear"),
+        {n->input(0), packed_weight, n->input(2)});
+    prepacked->output()->setType(n->output()->type());
+    graph->insertNode(prepacked);
+    n->output()->replaceAllUsesWith(prepacked->output());
+    n->destroy();
+  }
+}
+
+// The prepacked kernel; kept out of native_functions.yaml since only this
+// pass emits it. Argument order follows aten::linear with the weight
+// replaced by its packed form.
+RegisterOperators mkldnn_prepacked_linear_reg({Operator(
+    "mkldnn::prepacked_linear(Tensor input, Tensor packed_weight, Tensor? bias) -> Tensor",
+    [](Stack& stack) {
+      auto bias_ivalue = pop(stack);
+      at::Tensor bias;
+      if (!bias_ivalue.isNone()) {
+        bias = bias_ivalue.toTensor();
+      }
+      auto packed_weight = pop(stack).toTensor();
+      auto input = pop(stack).toTensor();
+      push(
+          stack,
+          at::native::mkldnn_prepacked_linear(input, packed_weight, bias));
+      return 0;
+    },
+    aliasAnalysisFromSchema())});
+
+} // namespace
+
+void PrepackFrozenLinear(std::shared_ptr<Graph>& graph) {
+  if (!at::hasMKLDNN()) {
+    return;
+  }
+  // the script frontend emits F.linear as addmm or matmul(+add); fold those
+  // back into aten::linear so one rewrite covers all of them
+  FuseLinear(graph);
+  PrepackFrozenLinearInBlock(graph->block(), graph);
+  EliminateDeadCode(graph);
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,29 @@
+/** \brief Weight prepacking for linear layers in frozen inference graphs.
+ *
+ * Frozen linear layers still run through addmm/matmul, and the BLAS packs
+ * the (constant) weight matrix into its internal blocked format on every
+ * call. This pass packs each constant weight once at optimization time and
+ * rewrites the layer to a GEMM that consumes the packed matrix directly.
+ */
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+/** \brief Rewrite frozen linear layers to use prepacked MKL-DNN weights.
+ *
+ * Normalizes the addmm / matmul(+add) forms the script frontend emits for
+ * F.linear back into aten::linear, then replaces every aten::linear whose
+ * weight is a constant dense fp32 CPU tensor with
+ * mkldnn::prepacked_linear, inserting the blocked weight as a graph
+ * constant. Numerics stay fp32 throughout. The pass is a no-op when ATen
+ * was built without MKL-DNN. Note the packed constant is an mkldnn-layout
+ * tensor, so graphs rewritten by this pass are meant for in-memory
+ * inference rather than re-serialization.
+ */
+TORCH_API void PrepackFrozenLinear(std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
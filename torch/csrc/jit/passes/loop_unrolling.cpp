@@ -14,6 +14,9 @@ namespace {
 static constexpr int64_t kUnrollFactor = 8;
 static constexpr int64_t kMaxBodySize = 32;
 static constexpr int64_t kMaxBodyRepeats = 64;
+// float lanes of a Vec256 register; factors are kept multiples of this so
+// fused bodies come out full-width
+static constexpr int64_t kVectorWidth = 8;
 
 bool isTrueConstant(Value* val) {
   c10::optional<bool> maybe_value = constant_as<bool>(val);
@@ -182,6 +185,34 @@ void unroll(Node* loop) {
     return;
   }
 
+  // The profiling executor annotates for-loops whose trip count input it
+  // observed to be stable (see ProfilingRecord::insertTripCountProfile).
+  // The count is an observation, not a guarantee, so the loop structure has
+  // to stay; but sizing the unroll factor from it makes the profiled count
+  // run entirely inside the unrolled body with an empty epilogue.
+  int64_t unroll_factor = kUnrollFactor;
+  if (loop->hasAttribute(attr::profiled_trip_count)) {
+    int64_t profiled = loop->i(attr::profiled_trip_count);
+    if (profiled <= 1) {
+      // the body runs at most once per call; unrolling only bloats the graph
+      return;
+    }
+    if (profiled <= kMaxBodyRepeats) {
+      unroll_factor = profiled;
+    } else {
+      // prefer the largest vector-width multiple that divides the profiled
+      // count, so downstream fusion sees full-width bodies and the profiled
+      // count leaves no epilogue iterations
+      for (int64_t candidate :
+           {4 * kVectorWidth, 2 * kVectorWidth, kVectorWidth}) {
+        if (profiled % candidate == 0) {
+          unroll_factor = candidate;
+          break;
+        }
+      }
+    }
+  }
+
   WithInsertPoint insert_point_guard{loop};
 
   // Clone the loop before we unroll it. The clone will become the epilogue.
@@ -193,21 +224,21 @@ void unroll(Node* loop) {
   }
 
   Block* dest = loop->addBlock();
-  repeatBody(body, kUnrollFactor, dest);
+  repeatBody(body, unroll_factor, dest);
   loop->eraseBlock(0);
   body = dest;
 
   // Change the iteration counts of both loops
   Value* iter_count = loop->inputs().at(0);
   Value* unrolled_iter_count = graph->insert(
-      aten::__round_to_zero_floordiv, {iter_count, kUnrollFactor});
+      aten::__round_to_zero_floordiv, {iter_count, unroll_factor});
   loop->replaceInput(0, unrolled_iter_count);
   loop_epilogue->replaceInput(
       0,
       graph->insert(
           aten::sub,
           {iter_count,
-           graph->insert(aten::mul, {unrolled_iter_count, kUnrollFactor})}));
+           graph->insert(aten::mul, {unrolled_iter_count, unroll_factor})}));
 }
 
 void UnrollLoops(Block* block) {
@@ -0,0 +1,193 @@
+#include <torch/csrc/jit/passes/memory_planning.h>
+
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <algorithm>
+#include <limits>
+#include <unordered_set>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// matches the alignment every CPU allocator in this tree hands out, so an
+// offset computed here can be served from a single aligned slab
+constexpr size_t kAllocationAlignment = 64;
+
+size_t align_up(size_t n) {
+  return (n + kAllocationAlignment - 1) & ~(kAllocationAlignment - 1);
+}
+
+// payload bytes for a value with a complete tensor type; nullopt when the
+// type is missing sizes, dtype or a concrete CPU device
+c10::optional<size_t> tensorBytes(const Value* v) {
+  auto tt = v->type()->cast<TensorType>();
+  if (!tt) {
+    return c10::nullopt;
+  }
+  auto sizes = tt->sizes().concrete_sizes();
+  auto scalar_type = tt->scalarType();
+  auto device = tt->device();
+  if (!sizes || !scalar_type || !device || !device->is_cpu()) {
+    return c10::nullopt;
+  }
+  size_t nbytes = c10::elementSize(*scalar_type);
+  for (auto s : *sizes) {
+    if (s < 0) {
+      return c10::nullopt;
+    }
+    nbytes *= static_cast<size_t>(s);
+  }
+  return nbytes;
+}
+
+// the index a use inside a nested block contributes is the index of the
+// owning top-level node (an If or Loop executes entirely at its own index,
+// so that is the last point the value can be read from)
+Node* topLevelNode(Node* n, Block* top) {
+  while (n->owningBlock() != top) {
+    n = n->owningBlock()->owningNode();
+  }
+  return n;
+}
+
+struct Candidate {
+  Value* value;
+  size_t size; // aligned payload bytes
+  size_t first; // index of the defining node
+  size_t last; // index of the last node that may read the value
+};
+
+} // namespace
+
+MemoryPlan PlanMemory(const std::shared_ptr<Graph>& graph) {
+  AliasDb alias_db(graph);
+  Block* top = graph->block();
+
+  std::unordered_map<Node*, size_t> node_index;
+  size_t index = 0;
+  for (Node* n : top->nodes()) {
+    node_index[n] = index++;
+  }
+  // the Return node reads the graph outputs after every other node
+  node_index[top->return_node()] = index;
+
+  auto last_use = [&](const Value* v) {
+    size_t last = node_index.at(topLevelNode(v->node(), top));
+    for (const Use& use : v->uses()) {
+      last = std::max(last, node_index.at(topLevelNode(use.user, top)));
+    }
+    return last;
+  };
+
+  // every top-level tensor value takes part in lifetime extension, even the
+  // ones we cannot plan: a view of a planned value keeps its slot alive
+  std::vector<Value*> tensor_values;
+  for (Node* n : top->nodes()) {
+    for (Value* v : n->outputs()) {
+      if (v->type()->cast<TensorType>()) {
+        tensor_values.push_back(v);
+      }
+    }
+  }
+
+  std::vector<Candidate> candidates;
+  for (Value* v : tensor_values) {
+    auto nbytes = tensorBytes(v);
+    if (!nbytes || *nbytes == 0) {
+      continue;
+    }
+    // a value that may alias (or be contained in) an input or output has a
+    // lifetime we do not control; leave it to the regular allocator
+    if (alias_db.mayContainAlias(v, graph->inputs()) ||
+        alias_db.mayContainAlias(v, graph->outputs())) {
+      continue;
+    }
+    candidates.push_back(
+        Candidate{v, align_up(*nbytes), node_index.at(v->node()), last_use(v)});
+  }
+
+  // extend each candidate's lifetime over the uses of everything it may
+  // alias; if the alias is itself a candidate, drop it from planning (its
+  // bytes live in the slot of the value it aliases)
+  std::unordered_set<const Value*> dropped;
+  for (auto& c : candidates) {
+    if (dropped.count(c.value)) {
+      continue;
+    }
+    for (Value* other : tensor_values) {
+      if (other == c.value || !alias_db.mayAlias(c.value, other)) {
+        continue;
+      }
+      c.first = std::min(c.first, node_index.at(other->node()));
+      c.last = std::max(c.last, last_use(other));
+      dropped.insert(other);
+    }
+  }
+  candidates.erase(
+      std::remove_if(
+          candidates.begin(),
+          candidates.end(),
+          [&](const Candidate& c) { return dropped.count(c.value); }),
+      candidates.end());
+
+  // greedy best-fit: place the largest values first, and put each one into
+  // the smallest offset gap that fits among the placements whose lifetimes
+  // overlap its own
+  std::stable_sort(
+      candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.size > b.size;
+      });
+
+  MemoryPlan plan;
+  struct Placement {
+    size_t offset;
+    const Candidate* candidate;
+  };
+  std::vector<Placement> placements;
+  for (const auto& c : candidates) {
+    std::vector<Placement> live;
+    for (const auto& p : placements) {
+      if (p.candidate->first <= c.last && c.first <= p.candidate->last) {
+        live.push_back(p);
+      }
+    }
+    std::sort(live.begin(), live.end(), [](const Placement& a, const Placement& b) {
+      return a.offset < b.offset;
+    });
+    size_t prev_end = 0;
+    size_t best_offset = 0;
+    size_t best_gap = std::numeric_limits<size_t>::max();
+    bool found = false;
+    for (const auto& p : live) {
+      if (p.offset > prev_end) {
+        size_t gap = p.offset - prev_end;
+        if (gap >= c.size && gap < best_gap) {
+          best_gap = gap;
+          best_offset = prev_end;
+          found = true;
+        }
+      }
+      prev_end = std::max(prev_end, p.offset + p.candidate->size);
+    }
+    size_t offset = found ? best_offset : prev_end;
+    placements.push_back(Placement{offset, &c});
+    plan.allocations.emplace(c.value, MemoryAllocation{offset, c.size});
+    plan.planned_bytes += c.size;
+    plan.arena_size = std::max(plan.arena_size, offset + c.size);
+  }
+
+  GRAPH_DEBUG(
+      "PlanMemory: packed ",
+      plan.planned_bytes,
+      " bytes of intermediates into a ",
+      plan.arena_size,
+      " byte arena");
+  return plan;
+}
+
+} // namespace jit
+} // namespace torch
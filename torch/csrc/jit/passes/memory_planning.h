@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ATen/core/jit_type.h>
+#include <torch/csrc/WindowsTorchApiMacro.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+#include <unordered_map>
+
+namespace torch {
+namespace jit {
+
+// A planned placement for one intermediate tensor: a byte range inside a
+// single shared arena.
+struct TORCH_API MemoryAllocation {
+  size_t offset;
+  size_t size;
+};
+
+// Result of PlanMemory. `arena_size` is the number of bytes one arena needs
+// so that every planned value fits at its assigned offset for its whole
+// lifetime; `planned_bytes` is what the same values would occupy if each
+// were allocated privately, so the ratio of the two is the memory saved by
+// offset aliasing.
+struct TORCH_API MemoryPlan {
+  size_t arena_size = 0;
+  size_t planned_bytes = 0;
+  std::unordered_map<const Value*, MemoryAllocation> allocations;
+};
+
+// Plans arena offsets for the intermediate tensors of an inference graph.
+// Lifetimes are computed over the linearized top-level block and extended
+// across may-alias relationships; values are then packed greedily
+// (largest first, best-fit into lifetime-compatible gaps). Only values with
+// complete tensor types (sizes, dtype, CPU device) that cannot alias graph
+// inputs or outputs participate; everything else keeps its regular
+// allocation. Run this after profiling has specialized the tensor types.
+TORCH_API MemoryPlan PlanMemory(const std::shared_ptr<Graph>& graph);
+
+} // namespace jit
+} // namespace torch
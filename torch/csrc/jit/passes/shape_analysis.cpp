@@ -16,6 +16,9 @@
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -65,6 +68,66 @@ bool containsTensorType(const TypePtr& t) {
   return false;
 }
 
+// NOTE [ Shape inference cache ]
+//
+// Propagating a shape by running the op materializes representative input
+// tensors and executes a real kernel, which dominates the cost of this pass
+// on large graphs and is repeated from scratch on every executor
+// respecialization. The result is a pure function of the operator schema,
+// the input tensor metadata and the non-tensor constant inputs, so we
+// memoize the inferred output types in a process-wide table shared by all
+// executor instances. Nodes with constant tensor inputs skip the cache: an
+// op's output shapes may depend on the contents of such a constant, and
+// fingerprinting the data would cost more than the run.
+
+std::mutex& shapeCacheMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+// maps fingerprint -> output types; entries are nullptr for non-tensor
+// outputs, whose types propagation leaves untouched
+std::unordered_map<std::string, std::vector<TypePtr>>& shapeCache() {
+  static std::unordered_map<std::string, std::vector<TypePtr>> cache;
+  return cache;
+}
+
+constexpr size_t kShapeCacheMaxSize = 8192;
+
+c10::optional<std::string> shapeCacheKey(Node* node) {
+  auto schema = node->maybeSchema();
+  if (!schema) {
+    return c10::nullopt;
+  }
+  std::ostringstream key;
+  key << *schema;
+  for (Value* input : node->inputs()) {
+    key << ";";
+    if (auto iv = toIValue(input)) {
+      if (iv->isTensor() || containsTensorType(input->type())) {
+        return c10::nullopt;
+      }
+      key << "c" << *iv;
+    } else if (auto tt = input->type()->cast<TensorType>()) {
+      if (!tt->isComplete() || !tt->device() || !tt->scalarType()) {
+        return c10::nullopt;
+      }
+      key << "t" << static_cast<int>(*tt->scalarType()) << "/"
+          << *tt->device() << "/";
+      for (int64_t s : *tt->sizes().concrete_sizes()) {
+        key << s << ",";
+      }
+      key << "/";
+      for (int64_t s : *tt->strides().concrete_sizes()) {
+        key << s << ",";
+      }
+    } else {
+      key << "v" << input->type()->str();
+    }
+  }
+  return key.str();
+}
+
 class ShapePropagator {
  public:
   explicit ShapePropagator(std::shared_ptr<Graph> graph) : aliasDb_(graph) {
@@ -397,6 +460,24 @@ class ShapePropagator {
   bool PropagateShapeOnNodeByRunningIt(Node* node) {
     if (!canPropagateShapeByRunningIt(node))
       return false;
+
+    // See NOTE [ Shape inference cache ]
+    auto cache_key = shapeCacheKey(node);
+    if (cache_key) {
+      std::lock_guard<std::mutex> lock(shapeCacheMutex());
+      auto& cache = shapeCache();
+      auto it = cache.find(*cache_key);
+      if (it != cache.end()) {
+        AT_ASSERT(it->second.size() == node->outputs().size());
+        for (size_t i = 0; i < it->second.size(); ++i) {
+          if (it->second[i]) {
+            node->outputs()[i]->setType(it->second[i]);
+          }
+        }
+        return true;
+      }
+    }
+
     auto op = node->getOperation();
     Stack stack;
 
@@ -418,6 +499,21 @@ class ShapePropagator {
       if (stack[i].isTensor())
         node->outputs()[i]->inferTypeFrom(stack[i].toTensor());
     }
+
+    if (cache_key) {
+      std::vector<TypePtr> output_types;
+      output_types.reserve(stack.size());
+      for (size_t i = 0; i < stack.size(); ++i) {
+        output_types.push_back(
+            stack[i].isTensor() ? node->outputs()[i]->type() : nullptr);
+      }
+      std::lock_guard<std::mutex> lock(shapeCacheMutex());
+      auto& cache = shapeCache();
+      if (cache.size() >= kShapeCacheMaxSize) {
+        cache.clear();
+      }
+      cache.emplace(std::move(*cache_key), std::move(output_types));
+    }
     return true;
   }
 
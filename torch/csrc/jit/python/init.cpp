@@ -15,10 +15,13 @@
 #include <torch/csrc/jit/passes/constant_pooling.h>
 #include <torch/csrc/jit/passes/constant_propagation.h>
 #include <torch/csrc/jit/passes/create_autodiff_subgraphs.h>
+#include <torch/csrc/jit/passes/create_stream_subgraphs.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/decompose_ops.h>
 #include <torch/csrc/jit/passes/erase_number_types.h>
 #include <torch/csrc/jit/passes/fuse_linear.h>
+#include <torch/csrc/jit/passes/frozen_conv_fusion.h>
+#include <torch/csrc/jit/passes/frozen_linear_prepack.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
 #include <torch/csrc/jit/passes/cuda_graph_fuser.h>
 #include <torch/csrc/jit/passes/inline_fork_wait.h>
@@ -26,6 +29,7 @@
 #include <torch/csrc/jit/passes/loop_unrolling.h>
 #include <torch/csrc/jit/passes/lower_graph.h>
 #include <torch/csrc/jit/passes/lower_tuples.h>
+#include <torch/csrc/jit/passes/memory_planning.h>
 #include <torch/csrc/jit/passes/onnx.h>
 #include <torch/csrc/jit/passes/onnx/cast_all_constant_to_floating.h>
 #include <torch/csrc/jit/passes/onnx/constant_fold.h>
@@ -208,6 +212,9 @@ void initJITBindings(PyObject* module) {
           },
           py::arg("module"))
       .def("_jit_pass_fuse_linear", &FuseLinear)
+      .def("_jit_pass_fold_frozen_conv_bn", &FoldFrozenConvBatchnorm)
+      .def("_jit_pass_fuse_frozen_conv_relu", &FuseFrozenConvRelu)
+      .def("_jit_pass_prepack_frozen_linear", &PrepackFrozenLinear)
       .def(
           "_jit_pass_fold_quantize",
           [](Module& module, const std::string& method_name) {
@@ -300,6 +307,21 @@ void initJITBindings(PyObject* module) {
             return LowerGraph(*graph, self._ivalue());
           })
       .def("_jit_pass_loop_unrolling", UnrollLoops)
+      .def(
+          "_jit_plan_memory",
+          [](std::shared_ptr<Graph>& g) {
+            auto plan = PlanMemory(g);
+            py::dict allocations;
+            for (const auto& kv : plan.allocations) {
+              allocations[py::str(kv.first->debugName())] =
+                  py::make_tuple(kv.second.offset, kv.second.size);
+            }
+            py::dict result;
+            result["arena_size"] = plan.arena_size;
+            result["planned_bytes"] = plan.planned_bytes;
+            result["allocations"] = allocations;
+            return result;
+          })
       .def(
           "_jit_pass_constant_propagation",
           [](std::shared_ptr<Graph>& g) { return ConstantPropagation(g); })
@@ -307,6 +329,13 @@ void initJITBindings(PyObject* module) {
       .def(
           "_jit_pass_create_autodiff_subgraphs",
           [](std::shared_ptr<Graph> graph) { CreateAutodiffSubgraphs(graph); })
+      .def(
+          "_jit_pass_create_stream_subgraphs",
+          [](std::shared_ptr<Graph> graph, size_t min_subgraph_size) {
+            CreateStreamSubgraphs(graph, min_subgraph_size);
+          },
+          py::arg("graph"),
+          py::arg("min_subgraph_size") = 2)
 #if defined(BUILDING_TESTS) && !defined(__HIP_PLATFORM_HCC__)
       .def(
           "_jit_run_cpp_tests",
@@ -394,6 +423,22 @@ void initJITBindings(PyObject* module) {
             getBailoutDepth() = depth;
             return old_depth;
           })
+      .def(
+          "_jit_get_constant_dedup_stats",
+          []() {
+            auto stats = getConstantDedupStats();
+            py::dict result;
+            result["shared_bytes"] = stats.shared_bytes;
+            result["private_bytes"] = stats.private_bytes;
+            return result;
+          })
+      .def(
+          "_jit_set_background_compilation",
+          [](bool background_flag) {
+            bool oldState = getBackgroundCompilationMode();
+            getBackgroundCompilationMode() = background_flag;
+            return oldState;
+          })
       .def(
           "_jit_set_inline_everything_mode",
           [](bool enabled) { getInlineEverythingMode() = enabled; })
@@ -453,6 +498,18 @@ void initJITBindings(PyObject* module) {
             using namespace torch::jit::tensorexpr;
             return getTECudaPointwiseBlockSize() = block_size;
           })
+      .def(
+          "_jit_get_te_dynamic_shapes",
+          []() -> bool {
+            using namespace torch::jit::tensorexpr;
+            return getTEDynamicShapes();
+          })
+      .def(
+          "_jit_set_te_dynamic_shapes",
+          [](bool dynamic_shapes) {
+            using namespace torch::jit::tensorexpr;
+            return getTEDynamicShapes() = dynamic_shapes;
+          })
       .def("_jit_set_texpr_fuser_enabled", &setTensorExprFuserEnabled)
       .def(
           "_jit_fuser_get_fused_kernel_code",
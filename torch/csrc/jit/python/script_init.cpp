@@ -11,6 +11,7 @@
 #include <torch/csrc/jit/testing/file_check.h>
 
 #include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/serialization/async_save.h>
 #include <torch/csrc/jit/serialization/export.h>
 #include <torch/csrc/jit/runtime/graph_executor.h>
 #include <torch/csrc/jit/testing/hooks_for_testing.h>
@@ -812,6 +813,18 @@ void initJitScriptBindings(PyObject* module) {
             throw std::runtime_error(err.str());
           }));
 
+  // Handle returned by ScriptModule.save_async; see
+  // NOTE [ Asynchronous module save ] in serialization/async_save.cpp.
+  py::class_<AsyncSaveRequest, std::unique_ptr<AsyncSaveRequest>>(
+      m, "AsyncSaveRequest")
+      .def(
+          "wait",
+          [](AsyncSaveRequest& r) {
+            py::gil_scoped_release release;
+            r.wait();
+          })
+      .def("completed", &AsyncSaveRequest::completed);
+
   // torch.jit.ScriptModule is a subclass of this C++ object.
   // Methods here are prefixed with _ since they should not be
   // public.
@@ -835,14 +848,25 @@ void initJitScriptBindings(PyObject* module) {
           },
           py::arg("_extra_files") = ExtraFilesMap())
       .def(
-          "_save_for_mobile",
+          "save_async",
           [](Module& m,
              const std::string& filename,
              const ExtraFilesMap& _extra_files = ExtraFilesMap()) {
-            m._save_for_mobile(filename, _extra_files);
+            return AsyncExportModule(m, filename, _extra_files);
           },
           py::arg("filename"),
           py::arg("_extra_files") = ExtraFilesMap())
+      .def(
+          "_save_for_mobile",
+          [](Module& m,
+             const std::string& filename,
+             const ExtraFilesMap& _extra_files = ExtraFilesMap(),
+             bool _strip_debug_info = false) {
+            m._save_for_mobile(filename, _extra_files, _strip_debug_info);
+          },
+          py::arg("filename"),
+          py::arg("_extra_files") = ExtraFilesMap(),
+          py::arg("_strip_debug_info") = false)
       .def("_set_optimized", &Module::set_optimized)
       .def(
           "dump",
@@ -1043,6 +1067,23 @@ void initJitScriptBindings(PyObject* module) {
                 method, tuple_slice(std::move(args), 1), std::move(kwargs));
             END_HANDLE_TH_ERRORS_PYBIND
           })
+      .def(
+          "_warmup",
+          [](py::args args, py::kwargs kwargs) {
+            // see: [pybind11 varargs]
+            HANDLE_TH_ERRORS
+            Method& method = py::cast<Method&>(args[0]);
+            auto stack = createStackForSchema(
+                method.function().getSchema(),
+                tuple_slice(std::move(args), 1),
+                kwargs,
+                method.owner()._ivalue());
+            // createStackForSchema pushed self; Method::warmup prepends it
+            // itself, so drop it here
+            stack.erase(stack.begin());
+            return method.warmup(std::move(stack));
+            END_HANDLE_TH_ERRORS_PYBIND
+          })
       .def_property_readonly("graph", &Method::graph)
       .def_property_readonly(
           "inlined_graph",
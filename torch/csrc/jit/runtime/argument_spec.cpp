@@ -96,6 +96,15 @@ ArgumentSpecCreator::ArgumentSpecCreator(Graph& graph)
   for (Value* input : graph.inputs()) {
     scan(input->type(), 0, written_slots);
   }
+  // Graphs that take only loose tensor arguments (common for exported
+  // inference graphs with many feature inputs) compile to a flat run of
+  // SPECIALIZE_TENSOR/SKIP with no nesting. With hundreds of inputs the
+  // interpreter's stack bookkeeping is measurable, so remember this and
+  // let create() take a direct single-pass path.
+  flat_tensor_inputs_ = std::all_of(
+      instructions_.begin(), instructions_.end(), [](Inst inst) {
+        return inst == SPECIALIZE_TENSOR || inst == SKIP;
+      });
 }
 
 void ArgumentSpecCreator::dump() const {
@@ -130,6 +139,19 @@ void ArgumentSpecCreator::dump() const {
 ArgumentSpec ArgumentSpecCreator::create(bool with_grad, const Stack& input)
     const {
   ArgumentSpec spec(num_tensors_, num_optionals_);
+  if (flat_tensor_inputs_) {
+    // One instruction per input and nothing to descend into: read each
+    // input's bits straight into the preallocated spec, combining the
+    // hash as we go.
+    const IValue* arg = last(input, num_inputs_).begin();
+    for (Inst inst : instructions_) {
+      if (inst == SPECIALIZE_TENSOR) {
+        spec.addTensor(*arg, with_grad);
+      }
+      ++arg;
+    }
+    return spec;
+  }
   const IValue* stack[ARG_SPEC_DEPTH_LIMIT]; // The stack of IValue lists
   // The stack gets initialized with the input list
   stack[0] = last(input, num_inputs_).begin();
@@ -198,9 +198,28 @@ struct TORCH_API ArgumentSpecCreator {
   size_t num_inputs_;
   size_t num_tensors_ = 0;
   size_t num_optionals_ = 0;
+  // true when the program is a flat run of SPECIALIZE_TENSOR/SKIP (one
+  // instruction per graph input, no nesting); create() then walks the
+  // inputs in a single pass without the instruction stack.
+  bool flat_tensor_inputs_ = false;
   std::vector<Inst> instructions_;
 };
 
+// Rounds a dimension (or stride) up to its power-of-two "shape class".
+// Used when constructing a bucketed CompleteArgumentSpec so that one
+// specialization can serve a whole family of dynamic shapes (e.g. variable
+// sequence lengths) instead of producing a new entry per exact size.
+inline int64_t bucketDimension(int64_t size) {
+  if (size <= 1) {
+    return size;
+  }
+  int64_t bucket = 1;
+  while (bucket < size) {
+    bucket *= 2;
+  }
+  return bucket;
+}
+
 // CompleteArgumentSpec represents one particular specialization.
 // It is designed so that it can be created, hashed, and compared quickly
 // since it is used along the hot-path of the JIT to check if the code
@@ -231,7 +250,16 @@ static_assert(
 struct CompleteArgumentInfo;
 
 struct CompleteArgumentSpec {
-  CompleteArgumentSpec(bool with_grad, at::ArrayRef<IValue> inputs)
+  // If `bucket_dims` is set, sizes and strides are rounded up to their
+  // power-of-two shape class (see bucketDimension) before being recorded, so
+  // specs for a whole family of dynamic shapes hash and compare as equal.
+  // In that mode the recorded sizes/strides are upper bounds for the class,
+  // not the exact values, so consumers keying a cache on a bucketed spec
+  // must only rely on class-level properties of the inputs.
+  CompleteArgumentSpec(
+      bool with_grad,
+      at::ArrayRef<IValue> inputs,
+      bool bucket_dims = false)
       : hash_code(0), ninputs(inputs.size()) {
     int32_t all_dims = 0;
     const int32_t num_inputs = inputs.size();
@@ -260,12 +288,16 @@ struct CompleteArgumentSpec {
           pod.requires_grad =
               with_grad && autograd::as_variable_ref(t).requires_grad();
           total_dims += t.ndimension();
-          auto sizes = t.sizes();
-          std::copy(sizes.begin(), sizes.end(), next_dim);
-          next_dim += sizes.size();
-          auto strides = t.strides();
-          std::copy(strides.begin(), strides.end(), next_dim);
-          next_dim += strides.size();
+          auto copy_dims = [&](at::IntArrayRef src) {
+            if (bucket_dims) {
+              next_dim = std::transform(
+                  src.begin(), src.end(), next_dim, bucketDimension);
+            } else {
+              next_dim = std::copy(src.begin(), src.end(), next_dim);
+            }
+          };
+          copy_dims(t.sizes());
+          copy_dims(t.strides());
         }
       }
       // each POD has a running tally of all dimensions including its own
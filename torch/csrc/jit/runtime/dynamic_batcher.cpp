@@ -0,0 +1,99 @@
+#include <torch/csrc/jit/runtime/dynamic_batcher.h>
+
+#include <ATen/ATen.h>
+#include <ATen/core/jit_type.h>
+
+namespace torch {
+namespace jit {
+
+DynamicBatcher::DynamicBatcher(ForwardFn forward, DynamicBatcherOptions options)
+    : forward_(std::move(forward)), options_(options) {
+  TORCH_CHECK(forward_, "DynamicBatcher requires a forward callable");
+  TORCH_CHECK(
+      options_.max_batch_size > 0, "max_batch_size must be positive, got ",
+      options_.max_batch_size);
+  worker_ = std::thread([this] { worker_loop(); });
+}
+
+DynamicBatcher::~DynamicBatcher() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  cv_.notify_all();
+  worker_.join();
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> DynamicBatcher::submit(
+    at::Tensor sample) {
+  auto future = c10::make_intrusive<c10::ivalue::Future>(TensorType::get());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TORCH_CHECK(!shutdown_, "submit called on a shut down DynamicBatcher");
+    queue_.push_back(
+        {std::move(sample), future, std::chrono::steady_clock::now()});
+  }
+  cv_.notify_all();
+  return future;
+}
+
+void DynamicBatcher::worker_loop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    cv_.wait(lock, [&] { return shutdown_ || !queue_.empty(); });
+    if (queue_.empty()) {
+      // shutdown_ with nothing left to flush
+      return;
+    }
+    if (queue_.size() < options_.max_batch_size && !shutdown_) {
+      // Wait out the remainder of the oldest request's timeout budget; a
+      // full batch or shutdown flushes early.
+      const auto deadline = queue_.front().enqueued + options_.batch_timeout;
+      cv_.wait_until(lock, deadline, [&] {
+        return shutdown_ || queue_.size() >= options_.max_batch_size;
+      });
+    }
+    std::vector<Request> batch;
+    const size_t batch_size = std::min(queue_.size(), options_.max_batch_size);
+    batch.reserve(batch_size);
+    for (size_t i = 0; i < batch_size; i++) {
+      batch.push_back(std::move(queue_.front()));
+      queue_.pop_front();
+    }
+    lock.unlock();
+    run_batch(std::move(batch));
+    lock.lock();
+  }
+}
+
+void DynamicBatcher::run_batch(std::vector<Request> batch) {
+  try {
+    std::vector<at::Tensor> samples;
+    samples.reserve(batch.size());
+    for (const Request& request : batch) {
+      samples.push_back(request.sample);
+    }
+    const at::Tensor output =
+        forward_(at::stack(samples, options_.batch_dim));
+    TORCH_CHECK(
+        output.size(options_.batch_dim) ==
+            static_cast<int64_t>(batch.size()),
+        "forward returned ", output.size(options_.batch_dim),
+        " results along dim ", options_.batch_dim, " for a batch of ",
+        batch.size());
+    for (size_t i = 0; i < batch.size(); i++) {
+      batch[i].future->markCompleted(
+          output.select(options_.batch_dim, static_cast<int64_t>(i)));
+    }
+  } catch (const std::exception& e) {
+    for (Request& request : batch) {
+      if (!request.future->completed()) {
+        request.future->markCompleted(
+            c10::ivalue::Future::FutureError(std::string(e.what())));
+      }
+    }
+  }
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <ATen/core/ivalue.h>
+#include <torch/csrc/WindowsTorchApiMacro.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace torch {
+namespace jit {
+
+struct TORCH_API DynamicBatcherOptions {
+  // Run the forward as soon as this many requests are queued.
+  size_t max_batch_size = 8;
+  // ...or once the oldest queued request has waited this long, whichever
+  // comes first. Partial batches are flushed on timeout.
+  std::chrono::milliseconds batch_timeout{2};
+  // Dimension along which samples are stacked into a batch. Samples do not
+  // carry this dimension; it is inserted on the way in and removed again
+  // when results are scattered back.
+  int64_t batch_dim = 0;
+};
+
+// Cross-request batching for inference serving.
+//
+// Many serving threads each hold a single sample; running the model once
+// per sample wastes the throughput that a batched forward would give.
+// DynamicBatcher collects samples submitted from any thread, stacks them
+// along batch_dim when either max_batch_size is reached or the oldest
+// request has waited batch_timeout, runs the forward once on its own
+// worker thread, and completes each caller's future with that caller's
+// slice of the output. If the forward throws, every future in the batch
+// is completed with the error instead.
+//
+// The forward callable typically wraps a GraphExecutor or a module's
+// forward method; it must accept the stacked batch and return a tensor
+// with the same extent along batch_dim.
+class TORCH_API DynamicBatcher {
+ public:
+  using ForwardFn = std::function<at::Tensor(const at::Tensor&)>;
+
+  DynamicBatcher(ForwardFn forward, DynamicBatcherOptions options = {});
+
+  // Completes all outstanding futures (running at most one more forward
+  // per max_batch_size requests still queued) before returning.
+  ~DynamicBatcher();
+
+  // Thread-safe. The returned future completes with this sample's slice
+  // of the batched output, or with the forward's error.
+  c10::intrusive_ptr<c10::ivalue::Future> submit(at::Tensor sample);
+
+ private:
+  struct Request {
+    at::Tensor sample;
+    c10::intrusive_ptr<c10::ivalue::Future> future;
+    std::chrono::steady_clock::time_point enqueued;
+  };
+
+  void worker_loop();
+  void run_batch(std::vector<Request> batch);
+
+  ForwardFn forward_;
+  DynamicBatcherOptions options_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<Request> queue_;
+  bool shutdown_ = false;
+  std::thread worker_;
+};
+
+} // namespace jit
+} // namespace torch
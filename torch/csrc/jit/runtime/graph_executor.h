@@ -78,6 +78,11 @@ TORCH_API std::atomic<bool> &getProfilingMode();
 TORCH_API std::atomic<bool>& getExecutorMode();
 TORCH_API std::atomic<size_t>& getNumProfiledRuns();
 TORCH_API std::atomic<size_t>& getBailoutDepth();
+// When set, the profiling executor compiles optimized plans on a dedicated
+// background thread and serves an unspecialized fallback plan in the
+// meantime, so a bailout never stalls the request thread for a full
+// recompilation.
+TORCH_API std::atomic<bool>& getBackgroundCompilationMode();
 
 struct TORCH_API GraphOptimizerEnabledGuard {
   GraphOptimizerEnabledGuard(bool state)
@@ -48,7 +48,8 @@ const size_t autodiffSubgraphInlineThreshold = 5;
 // and different requires_grad states, and handles specializations for each
 // situation. GraphExecutor is completely unaware of tracing or module
 // parameters to keep the tracing concerns separated.
-struct GraphExecutorImplBase {
+struct GraphExecutorImplBase
+    : public std::enable_shared_from_this<GraphExecutorImplBase> {
   static std::shared_ptr<Graph> prepareGraph(
       const std::shared_ptr<Graph>& graph) {
     auto copy = graph->copy();
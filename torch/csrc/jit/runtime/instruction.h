@@ -17,10 +17,12 @@ namespace jit {
 // T - index into the type table, used for guard instructions
 // S - index into object slots
 // C - index into code table
+// B - index into builtin call table
 
 #define FORALL_OPCODES(_)                                                   \
   _(OP, "O") /* invoke operator X */                                        \
   _(OPN, "OI") /* invoke vararg operator X with N arguments */              \
+  _(OPC, "OC") /* push the constant N, then invoke operator X */            \
   _(LOAD, "R") /* push a value from a register X */                         \
   _(MOVE, "R") /* push a value from register X, clearing the register */    \
   _(STOREN, "RI") /* store N values to registers [X, X+N) */                \
@@ -36,6 +38,8 @@ namespace jit {
   _(CALL, "F") /* call function X */                                        \
   _(GUARD, "T") /* check a guard against type_table, true if passes */      \
   _(FAIL_GUARD, "T") /* fail a guard, patch back to GUARD */                \
+  _(GUARD_N, "TI") /* check guards on top N values against types[X:X+N) */  \
+  _(FAIL_GUARD_N, "TI") /* fail a fused guard, patch back to GUARD_N */     \
   _(TAIL_CALL, "F") /* replace current frame with function F */             \
   _(INTERFACE_CALL, "CI") /* call method X on the first argument (of N) */  \
   _(GET_ATTR, "S") /* get attribute from slot X in an Object */             \
@@ -50,7 +54,8 @@ namespace jit {
   _(ISINSTANCE, "TI") /* check object is one of  types[X:X+N]  */           \
   _(TUPLE_SLICE, "II") /* slice tup[X:(X+N)] */                             \
   _(FORK, "CN") /* launch a thread to run code entry x with N inputs  */    \
-  _(WARN, "") /* emit a warning with line information */
+  _(WARN, "") /* emit a warning with line information */                    \
+  _(CALL_BUILTIN, "B") /* invoke devirtualized builtin callee at slot X */
 
 enum OpCode : uint8_t {
 #define DEFINE_OP(op, _) op,
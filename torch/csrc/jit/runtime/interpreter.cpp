@@ -1,7 +1,9 @@
 #include <torch/csrc/jit/runtime/interpreter.h>
 
 #include <ATen/Parallel.h>
+#include <ATen/core/builtin_function.h>
 #include <ATen/core/ivalue.h>
+#include <c10/core/CPUAllocator.h>
 #include <c10/core/thread_pool.h>
 #include <c10/util/Exception.h>
 #include <torch/csrc/autograd/edge.h>
@@ -17,9 +19,12 @@
 #include <torch/csrc/jit/runtime/graph_executor.h>
 #include <torch/csrc/jit/runtime/instruction.h>
 #include <torch/csrc/jit/runtime/jit_exception.h>
+#include <torch/csrc/jit/runtime/logging.h>
 #include <torch/csrc/jit/runtime/operator.h>
 #include <torch/csrc/jit/runtime/vararg_functions.h>
 
+#include <atomic>
+#include <chrono>
 #include <exception>
 #include <iostream>
 #include <memory>
@@ -343,6 +348,18 @@ struct BailoutBlock {
   std::vector<Instruction> instructions; // ends in a TAIL_CALL
 };
 
+// Cost model for prim::fork granularity. A forked task only profits from
+// the interop thread pool when it outlives the pool handoff (queue lock,
+// condition variable wakeup, cache refill on the worker); below that,
+// at::launch is pure overhead. Each fork site compiles its own forked Code
+// object, so run times sampled there profile exactly one site: after
+// kForkProfileWarmup samples, sites whose mean run time is under
+// kForkInlineThresholdNs execute inline on the parent thread instead of
+// being offloaded. The future protocol is unchanged - an inlined fork just
+// pushes an already-completed future.
+constexpr uint64_t kForkProfileWarmup = 8;
+constexpr uint64_t kForkInlineThresholdNs = 50 * 1000;
+
 struct CodeImpl {
   friend struct InterpreterState;
   std::vector<Instruction> instructions_;
@@ -355,6 +372,9 @@ struct CodeImpl {
   std::vector<IValue> constant_table_;
   std::vector<Operation> operator_table_;
   std::vector<Function*> function_table_;
+  // per-callsite cache for CALL_BUILTIN: the callee's stack callable,
+  // resolved once at emit time (see emitCall)
+  std::vector<std::function<void(Stack&)>> builtin_call_table_;
   std::vector<TypePtr> type_table_;
   std::vector<Code> code_table_;
 
@@ -390,6 +410,29 @@ struct CodeImpl {
   std::vector<std::unique_ptr<Function>> bailout_functions_;
   size_t remaining_bailout_depth_;
 
+  // Profiled run time of this code when it is the target of a prim::fork.
+  // Relaxed atomics: the numbers only steer a heuristic, a lost or torn
+  // update just delays the inline decision by a sample. If the forked graph
+  // suspends (e.g. it contains a fork/wait of its own), only the first run
+  // segment is timed, which still tracks the cost the launching thread
+  // would have paid inline.
+  std::atomic<uint64_t> fork_samples_{0};
+  std::atomic<uint64_t> fork_time_ns_{0};
+
+  void recordForkTime(uint64_t ns) {
+    fork_time_ns_.fetch_add(ns, std::memory_order_relaxed);
+    fork_samples_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  bool shouldInlineFork() const {
+    uint64_t samples = fork_samples_.load(std::memory_order_relaxed);
+    if (samples < kForkProfileWarmup) {
+      return false;
+    }
+    uint64_t total = fork_time_ns_.load(std::memory_order_relaxed);
+    return total / samples < kForkInlineThresholdNs;
+  }
+
   CodeImpl(
       const std::shared_ptr<Graph>& graph,
       std::string function_name,
@@ -424,18 +467,28 @@ struct CodeImpl {
     auto count = index;
     for (size_t instr_index = 0; instr_index < instructions_.size();
          instr_index++) {
-      if (instructions_[instr_index].op == GUARD || instructions_[instr_index].op == FAIL_GUARD) {
-        if (count-- == 0) {
-          // patching GUARD to FAIL_GUARD
-          instructions_[instr_index].op = FAIL_GUARD;
-          GRAPH_DEBUG(
-              "Added a bailout request for ",
-              index,
-              " at instruction ",
-              instr_index);
-          break;
-        }
+      auto& inst = instructions_[instr_index];
+      // a GUARD_N instruction covers N logical guards
+      size_t guards = 0;
+      if (inst.op == GUARD || inst.op == FAIL_GUARD) {
+        guards = 1;
+      } else if (inst.op == GUARD_N || inst.op == FAIL_GUARD_N) {
+        guards = inst.N;
       }
+      if (guards > 0 && count < guards) {
+        // patching GUARD to FAIL_GUARD (failing any guard of a fused run
+        // takes the run's shared bailout)
+        inst.op = (inst.op == GUARD || inst.op == FAIL_GUARD)
+            ? FAIL_GUARD
+            : FAIL_GUARD_N;
+        GRAPH_DEBUG(
+            "Added a bailout request for ",
+            index,
+            " at instruction ",
+            instr_index);
+        break;
+      }
+      count -= guards;
     }
   }
 
@@ -605,8 +658,18 @@ struct CodeImpl {
       Function* func,
       at::ArrayRef<Value*> inputs) {
     emitLoadInputs(inputs);
-    insertInstruction(CALL, function_table_.size());
-    function_table_.emplace_back(std::move(func));
+    if (!func->isGraphFunction()) {
+      // The only non-graph functions are BuiltinOpFunctions (custom class
+      // methods bound from C++). The callee of this instruction never
+      // changes, so cache its stack callable here instead of paying two
+      // virtual dispatches and a graph-function test on every call.
+      insertInstruction(CALL_BUILTIN, builtin_call_table_.size());
+      builtin_call_table_.emplace_back(
+          static_cast<BuiltinOpFunction*>(func)->getCallable());
+    } else {
+      insertInstruction(CALL, function_table_.size());
+      function_table_.emplace_back(std::move(func));
+    }
   }
 
   void emitNodeAtBlockLevel(Node* node) {
@@ -643,8 +706,7 @@ struct CodeImpl {
     return instructions_.size() - 1;
   }
 
-  void emitBailOut(Node* node) {
-    auto jf_index = emitGuard(node);
+  void emitBailOutContinuation(Node* node, size_t jf_index) {
     auto unoptimized_graph = node->inputs().at(0)->node()->g(attr::Subgraph);
     // note, guaded input is already loaded onto the stack
     // for GUARD instruction
@@ -668,6 +730,46 @@ struct CodeImpl {
     createBailoutBlock(jf_index);
   }
 
+  void emitBailOut(Node* node) {
+    auto jf_index = emitGuard(node);
+    emitBailOutContinuation(node, jf_index);
+  }
+
+  // Emits one GUARD_N instruction for a run of adjacent prim::BailOut nodes
+  // (after guard hoisting and coalescing, graphs typically start with one
+  // such run covering the inputs). All the guarded values are checked by a
+  // single instruction; if any check fails we take the first node's bailout,
+  // which resumes unoptimized execution at the earliest of the fused guard
+  // points and therefore re-establishes the later ones as well.
+  void emitFusedBailOuts(const std::vector<Node*>& run) {
+    WithCurrentNode guard(&current_node_, run.front());
+    for (Node* node : run) {
+      emitLoadInputs(node->inputs().slice(1, 1));
+    }
+    // the types of a fused run occupy consecutive slots in the type table
+    size_t type_index = emitType(run.front()->outputs().at(0)->type());
+    for (size_t i = 1; i < run.size(); i++) {
+      emitType(run[i]->outputs().at(0)->type());
+    }
+    insertInstruction(GUARD_N, type_index, run.size());
+    insertInstruction(JF, 0 /* to be patched */);
+    size_t jf_index = instructions_.size() - 1;
+
+    // on failure, drop every guarded value except the first, which is the
+    // leading argument of the first node's bailout continuation
+    for (size_t i = 1; i < run.size(); i++) {
+      insertInstruction(DROP);
+    }
+    emitBailOutContinuation(run.front(), jf_index);
+
+    // on success the guarded values are still on the stack in emission
+    // order; store them to the nodes' output registers from the top down
+    for (auto rit = run.rbegin(); rit != run.rend(); ++rit) {
+      WithCurrentNode store_guard(&current_node_, *rit);
+      emitStoreOutputs(*rit);
+    }
+  }
+
   void emitGetAttr(Node* node) {
     emitLoadInputs(node->inputs());
     const auto type = node->input()->type()->expect<ClassType>();
@@ -835,10 +937,37 @@ struct CodeImpl {
     }
   }
 
+  // Collects the maximal run of adjacent prim::BailOut nodes starting at
+  // `it` that can be checked by one fused guard: a node joins the run only
+  // if its guarded value is not produced inside the run (its register would
+  // not be stored yet when the fused check loads it).
+  std::vector<Node*> gatherBailOutRun(graph_node_list_iterator& it, Block* block) {
+    std::vector<Node*> run;
+    std::unordered_set<Node*> in_run;
+    while (it != block->nodes().end() && (*it)->kind() == prim::BailOut &&
+           !in_run.count((*it)->inputs().at(1)->node())) {
+      run.push_back(*it);
+      in_run.insert(*it);
+      ++it;
+    }
+    return run;
+  }
+
   void emitCodeForBlock(Block* block) {
     emitNodeAtBlockLevel(block->param_node());
-    for (auto node : block->nodes()) {
+    for (auto it = block->nodes().begin(); it != block->nodes().end();) {
+      Node* node = *it;
+      if (node->kind() == prim::BailOut) {
+        auto run = gatherBailOutRun(it, block);
+        if (run.size() == 1) {
+          emitNodeAtBlockLevel(run.front());
+        } else {
+          emitFusedBailOuts(run);
+        }
+        continue;
+      }
       emitNodeAtBlockLevel(node);
+      ++it;
     }
     emitNodeAtBlockLevel(block->return_node());
   }
@@ -857,7 +986,8 @@ struct CodeImpl {
 
   void dump(std::ostream& out, size_t i) const {
     out << i << " " << instructions_[i];
-    if (instructions_[i].op == OP || instructions_[i].op == CALL || instructions_[i].op == OPN) {
+    if (instructions_[i].op == OP || instructions_[i].op == CALL ||
+        instructions_[i].op == CALL_BUILTIN || instructions_[i].op == OPN) {
       out << " # " << *instructions_source_[i];
     } else {
       out << "\n";
@@ -872,6 +1002,37 @@ struct CodeImpl {
   }
 };
 
+namespace {
+
+// Sampled per-node stats (see setNodeStatsSamplePeriod in interpreter.h).
+// The period is read with a single relaxed load per OP/OPN instruction; the
+// per-thread countdown keeps sampled executions spread across interpreter
+// threads without any shared writes on the fast path.
+std::atomic<int64_t> node_stats_sample_period{0};
+thread_local int64_t node_stats_countdown = 0;
+
+bool shouldSampleNodeStats() {
+  int64_t period = node_stats_sample_period.load(std::memory_order_relaxed);
+  if (C10_LIKELY(period <= 0)) {
+    return false;
+  }
+  if (--node_stats_countdown > 0) {
+    return false;
+  }
+  node_stats_countdown = period;
+  return true;
+}
+
+} // namespace
+
+void setNodeStatsSamplePeriod(int64_t period) {
+  node_stats_sample_period.store(period, std::memory_order_relaxed);
+}
+
+int64_t getNodeStatsSamplePeriod() {
+  return node_stats_sample_period.load(std::memory_order_relaxed);
+}
+
 // InterpreterState state that and used to compute a Code
 struct InterpreterStateImpl : c10::intrusive_ptr_target {
   InterpreterStateImpl(const Code& code) {
@@ -921,6 +1082,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     IValue* constants;
     Operation* operators;
     Function** functions;
+    std::function<void(Stack&)>* builtin_calls;
     TypePtr* types;
 
     ActiveFrame(const Frame& frame)
@@ -929,6 +1091,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
           constants(frame.function->constant_table_.data()),
           operators(frame.function->operator_table_.data()),
           functions(frame.function->function_table_.data()),
+          builtin_calls(frame.function->builtin_call_table_.data()),
           types(frame.function->type_table_.data()) {}
   };
 
@@ -974,6 +1137,21 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     ++af->pc;
   }
 
+  // Slow path for sampled operator executions: wraps the call with a timer
+  // and the cumulative CPU allocation counter and feeds both into the active
+  // logger, keyed by the source node's operator.
+  void runOpWithNodeStats(Stack& stack, const ActiveFrame& af, int op_index) {
+    Node* node = frames.back().function->instructions_source()[af.pc];
+    size_t start_bytes = c10::cpu_allocated_bytes_total();
+    auto tp = logging::timePoint();
+    af.operators[op_index](stack);
+    std::string key = node->kind().toQualString();
+    logging::recordDurationSince("pytorch_runtime.node_time_ns." + key, tp);
+    logging::getLogger()->addStatValue(
+        "pytorch_runtime.node_mem_bytes." + key,
+        static_cast<int64_t>(c10::cpu_allocated_bytes_total() - start_bytes));
+  }
+
   void runGraphFunction(Stack &stack, Function *fn, ActiveFrame *af) {
     const Code& code =
         // consider passing
@@ -991,6 +1169,36 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     *af = ActiveFrame(frames.back());
   }
 
+// NOTE [ Computed-goto dispatch ]
+//
+// The interpreter loop below supports two dispatch strategies. With plain
+// switch dispatch every instruction goes through one shared indirect jump,
+// which the branch predictor has to disambiguate for all opcodes at once.
+// When the compiler supports GNU's labels-as-values extension we instead
+// dispatch each handler directly to the next one (direct threading): every
+// handler ends in its own table-indexed goto, so the predictor sees
+// per-opcode branch history and the shared jump stops being a bottleneck.
+// Handlers are written once and annotated with INST/INST_NEXT, which expand
+// to case labels and `break` under switch dispatch, and to goto labels and
+// a dispatch-table goto under computed goto.
+#if defined(__GNUC__) || defined(__clang__)
+#define JIT_USE_COMPUTED_GOTO
+#endif
+
+#if defined(JIT_USE_COMPUTED_GOTO)
+#define INST(x) \
+  case x:       \
+  x##_label
+#define INST_NEXT                      \
+  do {                                 \
+    inst = af.instructions[af.pc];     \
+    goto* dispatch_table[inst.op];     \
+  } while (0)
+#else
+#define INST(x) case x
+#define INST_NEXT break
+#endif
+
   bool runImpl(Stack& stack) {
     // if we have never run before, then we might have to return the
     // stack when we suspend, record where it starts so we return the right
@@ -1005,70 +1213,98 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     }
 
     ActiveFrame af(frames.back());
+#if defined(JIT_USE_COMPUTED_GOTO)
+    // one label per opcode, in FORALL_OPCODES order, so Instruction.op
+    // indexes the table directly
+    static const void* dispatch_table[] = {
+#define DISPATCH_TABLE_ENTRY(op, _) &&op##_label,
+        FORALL_OPCODES(DISPATCH_TABLE_ENTRY)
+#undef DISPATCH_TABLE_ENTRY
+    };
+#endif
     try {
+      Instruction inst;
       while (true) {
         // std::cout << "RUNNING ";
         // frames.back().function->dump(std::cout, af.pc);
-        Instruction inst = af.instructions[af.pc];
+        inst = af.instructions[af.pc];
         switch (inst.op) {
-          case OP:
-            af.operators[inst.X](stack);
+          INST(OP):
+            if (C10_UNLIKELY(shouldSampleNodeStats())) {
+              runOpWithNodeStats(stack, af, inst.X);
+            } else {
+              af.operators[inst.X](stack);
+            }
             ++af.pc;
-            break;
-          case OPN:
+            INST_NEXT;
+          INST(OPN):
             stack.push_back(inst.N);
-            af.operators[inst.X](stack);
+            if (C10_UNLIKELY(shouldSampleNodeStats())) {
+              runOpWithNodeStats(stack, af, inst.X);
+            } else {
+              af.operators[inst.X](stack);
+            }
             ++af.pc;
-            break;
-          case LOAD:
+            INST_NEXT;
+          INST(OPC):
+            // fused LOADC + OP; only the mobile importer emits this today
+            stack.emplace_back(af.constants[inst.N]);
+            if (C10_UNLIKELY(shouldSampleNodeStats())) {
+              runOpWithNodeStats(stack, af, inst.X);
+            } else {
+              af.operators[inst.X](stack);
+            }
+            ++af.pc;
+            INST_NEXT;
+          INST(LOAD):
             stack.emplace_back(reg(inst.X));
             ++af.pc;
-            break;
-          case MOVE:
+            INST_NEXT;
+          INST(MOVE):
             stack.emplace_back(std::move(reg(inst.X)));
             ++af.pc;
-            break;
-          case STORE:
+            INST_NEXT;
+          INST(STORE):
             reg(inst.X) = pop(stack);
             ++af.pc;
-            break;
-          case STOREN:
+            INST_NEXT;
+          INST(STOREN):
             for (size_t i = inst.N; i > 0; --i) {
               reg(inst.X + i - 1) = pop(stack);
             }
             ++af.pc;
-            break;
-          case DROP:
+            INST_NEXT;
+          INST(DROP):
             pop(stack);
             ++af.pc;
-            break;
-          case DROPR:
+            INST_NEXT;
+          INST(DROPR):
             reg(inst.X) = IValue();
             ++af.pc;
-            break;
-          case LOADC:
+            INST_NEXT;
+          INST(LOADC):
             stack.emplace_back(af.constants[inst.X]);
             ++af.pc;
-            break;
-          case GET_ATTR: {
+            INST_NEXT;
+          INST(GET_ATTR): {
             auto userObj = pop(stack).toObject();
             auto value = userObj->getSlot(inst.X);
             push(stack, std::move(value));
             ++af.pc;
-          } break;
-          case SET_ATTR: {
+          } INST_NEXT;
+          INST(SET_ATTR): {
             auto v = pop(stack);
             auto userObj = pop(stack).toObject();
             userObj->setSlot(inst.X, std::move(v));
             ++af.pc;
-          } break;
-          case JF:
+          } INST_NEXT;
+          INST(JF):
             af.pc += (pop(stack).toBool()) ? 1 : inst.X;
-            break;
-          case JMP:
+            INST_NEXT;
+          INST(JMP):
             af.pc += inst.X;
-            break;
-          case LOOP: {
+            INST_NEXT;
+          INST(LOOP): {
             // stack: iteration_count, max_iter, cond, loop_carried_deps...
             auto frame = stack.end() - (inst.N + 1);
             int64_t trip_count = frame[0].toInt();
@@ -1086,16 +1322,21 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
               drop(stack, 3); // iteration_count, max_iter, cond
               af.pc += inst.X;
             }
-          } break;
-          case CALL: {
+          } INST_NEXT;
+          INST(CALL): {
             Function* fn = af.functions[inst.X];
             if (!fn->isGraphFunction()) {
               runBuiltinFunction(stack, fn, &af);
             } else {
               runGraphFunction(stack, fn, &af);
             }
-          } break;
-          case INTERFACE_CALL: {
+          } INST_NEXT;
+          INST(CALL_BUILTIN): {
+            // callee resolved at emit time; see emitCall
+            af.builtin_calls[inst.X](stack);
+            ++af.pc;
+          } INST_NEXT;
+          INST(INTERFACE_CALL): {
             // note the hash table lookup to find the function
             // this can be more optimized if necessary, caching parts
             // of the hashing computation or storing the offset when
@@ -1117,12 +1358,12 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             } else {
               runGraphFunction(stack, function, &af);
             }
-          } break;
-          case RET:
+          } INST_NEXT;
+          INST(RET):
             if (frames.size() > 1) {
               leaveFrame();
               af = ActiveFrame(frames.back());
-              break;
+              INST_NEXT;
             }
             if (future_) {
               auto num_outputs = frames.back().function->n_outputs;
@@ -1134,7 +1375,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
               }
             }
             return false;
-          case WAIT: {
+          INST(WAIT): {
             auto future = stack.back().toFuture();
             if (!future->completed()) {
               getOrCreateFuture();
@@ -1181,17 +1422,17 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             stack.pop_back();
             stack.emplace_back(future->value());
             ++af.pc;
-          } break;
-          case FAIL_GUARD: {
+          } INST_NEXT;
+          INST(FAIL_GUARD): {
             // patch FAIL_GUARD back to GUARD
             GRAPH_DEBUG(
                 "Bailout ", inst.X, " triggered via bailout_requests_!");
             af.instructions[af.pc].op = GUARD;
             push(stack, false);
             ++af.pc;
-            break;
+            INST_NEXT;
           }
-          case GUARD: {
+          INST(GUARD): {
             if (!stack.back().isTensor()) {
               // stack.back() is an Uninitialized IValue and this is a guard
               // on a block output. Uninitialized IValues are never used
@@ -1205,8 +1446,39 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
               push(stack, comp);
             }
             ++af.pc;
-          } break;
-          case TAIL_CALL: {
+          } INST_NEXT;
+          INST(FAIL_GUARD_N): {
+            // patch FAIL_GUARD_N back to GUARD_N
+            GRAPH_DEBUG(
+                "Bailout ", inst.X, " triggered via bailout_requests_!");
+            af.instructions[af.pc].op = GUARD_N;
+            push(stack, false);
+            ++af.pc;
+            INST_NEXT;
+          }
+          INST(GUARD_N): {
+            // fused guard: checks the top N stack entries against
+            // types[X:X+N) and pushes a single bool (see emitFusedBailOuts)
+            bool comp = true;
+            size_t base = stack.size() - inst.N;
+            for (size_t i = 0; i < inst.N; i++) {
+              const IValue& v = stack[base + i];
+              if (!v.isTensor()) {
+                // Uninitialized IValues are never used so the check passes
+                continue;
+              }
+              const TypePtr& expected = af.types[inst.X + i];
+              if (!expected->cast<TensorType>()
+                       ->isCompatibleWithInCurrentExecutionContext(
+                           v.toTensor())) {
+                comp = false;
+                break;
+              }
+            }
+            push(stack, comp);
+            ++af.pc;
+          } INST_NEXT;
+          INST(TAIL_CALL): {
             GRAPH_DEBUG("running TAIL_CALL for ", inst.X);
             af.functions[inst.X]->ensure_defined();
             size_t remaining_bailout_depth =
@@ -1229,59 +1501,79 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             leaveFrame();
             enterFrame(code, base_pointer);
             af = ActiveFrame(frames.back());
-          } break;
-         case LIST_UNPACK: {
+          } INST_NEXT;
+         INST(LIST_UNPACK): {
             listUnpack(stack, inst.X);
             ++af.pc;
-          } break;
-          case TUPLE_CONSTRUCT: {
+          } INST_NEXT;
+          INST(TUPLE_CONSTRUCT): {
             tupleConstruct(stack, inst.X);
             ++af.pc;
-          } break;
-          case TUPLE_SLICE: {
+          } INST_NEXT;
+          INST(TUPLE_SLICE): {
             tupleSlice(stack, inst.X, inst.X + inst.N);
             ++af.pc;
-          } break;
-          case NAMED_TUPLE_CONSTRUCT: {
+          } INST_NEXT;
+          INST(NAMED_TUPLE_CONSTRUCT): {
             auto type = af.types[inst.X]->expect<TupleType>();
             namedTupleConstruct(stack, type, inst.N);
             ++af.pc;
-          } break;
-          case LIST_CONSTRUCT: {
+          } INST_NEXT;
+          INST(LIST_CONSTRUCT): {
             auto type = af.types[inst.X]->expect<ListType>();
             listConstruct(stack, type, inst.N);
             ++af.pc;
-          } break;
-          case DICT_CONSTRUCT: {
+          } INST_NEXT;
+          INST(DICT_CONSTRUCT): {
             auto type = af.types[inst.X]->expect<DictType>();
             dictConstruct(stack, type, inst.N);
             ++af.pc;
-          } break;
-          case CREATE_OBJECT: {
+          } INST_NEXT;
+          INST(CREATE_OBJECT): {
             auto type = af.types[inst.X]->expect<ClassType>();
             createObject(stack, type);
             ++af.pc;
-          } break;
-          case ISINSTANCE: {
+          } INST_NEXT;
+          INST(ISINSTANCE): {
             at::ArrayRef<TypePtr> types(
                 af.types + inst.X, af.types + inst.X + inst.N);
             isinstance(stack, types);
             ++af.pc;
-          } break;
-          case FORK: {
+          } INST_NEXT;
+          INST(FORK): {
             // Move inputs to a separate stack
-            InterpreterState forked_interpreter(
-                frames.back().function->code_table_.at(inst.X));
+            Code& forked_code = frames.back().function->code_table_.at(inst.X);
+            auto forked_impl = forked_code.pImpl;
+            InterpreterState forked_interpreter(forked_code);
             InterpreterContinuation continuation(
                 forked_interpreter,
                 Stack(stack.end() - inst.N, stack.end()),
                 torch::ThreadLocalState::getThreadLocalState());
             drop(stack, inst.N);
             push(stack, forked_interpreter.getFuture());
-            at::launch(std::move(continuation));
+            if (forked_impl->shouldInlineFork()) {
+              // Profiling shows this fork is cheaper than a pool handoff;
+              // run it here. Waiters see an already-completed future.
+              auto start = std::chrono::steady_clock::now();
+              continuation();
+              forked_impl->recordForkTime(
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count());
+            } else {
+              at::launch([forked_impl,
+                          continuation = std::move(continuation)]() mutable {
+                auto start = std::chrono::steady_clock::now();
+                continuation();
+                forked_impl->recordForkTime(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+              });
+            }
             ++af.pc;
-          } break;
-          case WARN: {
+          } INST_NEXT;
+          INST(WARN): {
             Node* node = frames.back().function->instructions_source_.at(af.pc);
             auto range = node->sourceRange().source();
             if (range->filename()) {
@@ -1295,7 +1587,7 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
               TORCH_WARN(pop(stack).toStringRef());
             }
             ++af.pc;
-          } break;
+          } INST_NEXT;
         }
       }
     } catch (std::exception& e) {
@@ -1306,6 +1598,9 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
     }
   }
 
+#undef INST
+#undef INST_NEXT
+
   void formatStackTrace(std::ostream& out) {
     std::vector<StackEntry> entries;
     for (size_t i = 0; i < frames.size(); ++i) {
@@ -109,6 +109,17 @@ struct InterpreterContinuation {
   torch::ThreadLocalState thread_local_state;
 };
 
+// Sampled per-node runtime stats.  With period N > 0, every Nth operator
+// executed on a thread is timed and its CPU allocation volume measured; the
+// samples accumulate in the active logging::LoggerBase under
+// "pytorch_runtime.node_time_ns.<op>" and "pytorch_runtime.node_mem_bytes.<op>"
+// and can be queried at runtime via LockingLogger::getCounterValue.  Unlike
+// the autograd profiler this costs one relaxed atomic load per instruction
+// when enabled and nothing is recorded for unsampled executions.  Period 0
+// (the default) disables sampling entirely.
+TORCH_API void setNodeStatsSamplePeriod(int64_t period);
+TORCH_API int64_t getNodeStatsSamplePeriod();
+
 // what is the tensors type, including state from the current execution context
 // that modifies how the tensor behaves. For instance if no_grad is enabled
 // this will cause the TensorType to have requires_grad=False.
@@ -21,6 +21,8 @@
 #include <torch/csrc/jit/passes/specialize_autogradzero.h>
 #include <torch/csrc/jit/runtime/profiling_graph_executor_impl.h>
 
+#include <c10/core/thread_pool.h>
+
 namespace torch {
 namespace jit {
 
@@ -34,6 +36,7 @@ static std::atomic<bool> profiling_mode{true};
 
 static std::atomic<size_t> num_profiled_runs{1};
 static std::atomic<size_t> bailout_depth{1};
+static std::atomic<bool> background_compilation{false};
 
 std::atomic<bool>& getProfilingMode() {
   return profiling_mode;
@@ -50,6 +53,23 @@ std::atomic<size_t>& getBailoutDepth() {
   return bailout_depth;
 }
 
+std::atomic<bool>& getBackgroundCompilationMode() {
+  return background_compilation;
+}
+
+namespace {
+
+// A dedicated pool for background compilations. A single thread keeps
+// recompilations from competing with inter-op tasks for pool slots and
+// serializes the compilations triggered by concurrent bailouts, so a burst
+// of new shape classes costs one optimization pipeline run at a time.
+c10::TaskThreadPool& compilationPool() {
+  static c10::TaskThreadPool pool(1);
+  return pool;
+}
+
+} // namespace
+
 static bool needsGradientInProfilingMode(Block* b) {
   for (auto n : b->nodes()) {
     if (n->kind() == prim::BailOut) {
@@ -163,6 +183,13 @@ ExecutionPlan ProfilingGraphExecutorImpl::getPlanFor(
     auto copy = graph->copy();
     runProfilingInsensitiveOptimizations(copy);
     pr_ = ProfilingRecord::instrumentGraph(copy);
+    // a previous deployment may have exported its observations with the
+    // module archive; seeding them skips the profiling runs entirely
+    if (auto types = getRegisteredProfiledTypes(function_name_)) {
+      if (pr_->preloadProfiledTypes(*types)) {
+        GRAPH_DEBUG("Preloaded profiled types for ", function_name_);
+      }
+    }
     auto pr_copy = pr_->graph()->copy();
     GRAPH_DUMP("Profiled Graph: ", pr_copy);
     profiling_plan_ = ExecutionPlan(pr_copy, function_name_);
@@ -174,6 +201,22 @@ ExecutionPlan ProfilingGraphExecutorImpl::getPlanFor(
     return *profiling_plan_;
   }
 
+  if (getBackgroundCompilationMode()) {
+    // serve the unspecialized fallback plan while the optimized plan
+    // compiles on the dedicated pool; once it is published the check at
+    // the top of this function picks it up
+    if (!compilation_in_flight_) {
+      compilation_in_flight_ = true;
+      // publish the observations so ExportModule can persist them
+      registerProfiledTypes(function_name_, pr_->dumpProfiledTypes());
+      compileInBackground(remaining_bailout_depth);
+    }
+    return getFallbackPlan();
+  }
+
+  // publish the observations so ExportModule can persist them
+  registerProfiledTypes(function_name_, pr_->dumpProfiledTypes());
+
   auto copy = pr_->graph()->copy();
   runProfilingOptimizations(copy);
   // cache
@@ -181,6 +224,44 @@ ExecutionPlan ProfilingGraphExecutorImpl::getPlanFor(
   return *optimized_plan_;
 }
 
+const ExecutionPlan& ProfilingGraphExecutorImpl::getFallbackPlan() {
+  if (!fallback_plan_) {
+    auto copy = graph->copy();
+    runProfilingInsensitiveOptimizations(copy);
+    GRAPH_DUMP("Fallback Graph : ", copy);
+    fallback_plan_ = ExecutionPlan(copy, function_name_);
+  }
+  return *fallback_plan_;
+}
+
+void ProfilingGraphExecutorImpl::compileInBackground(
+    size_t remaining_bailout_depth) {
+  // the shared_ptr keeps the executor alive until the compilation lands,
+  // even if the owning function is destroyed in the meantime (bailout
+  // functions are owned by the code object that spawned them)
+  auto self =
+      std::static_pointer_cast<ProfilingGraphExecutorImpl>(shared_from_this());
+  auto copy = pr_->graph()->copy();
+  compilationPool().run([self, copy, remaining_bailout_depth]() mutable {
+    try {
+      self->runProfilingOptimizations(copy);
+      std::lock_guard<std::mutex> lock(self->compile_mutex);
+      self->optimized_plan_ =
+          ExecutionPlan(copy, self->function_name_, remaining_bailout_depth);
+    } catch (const std::exception& e) {
+      // serving must not die with the compilation thread; pin the fallback
+      // plan as the final one rather than retrying a failing pipeline
+      TORCH_WARN(
+          "background compilation of ",
+          self->function_name_,
+          " failed, falling back to the unoptimized graph: ",
+          e.what());
+      std::lock_guard<std::mutex> lock(self->compile_mutex);
+      self->optimized_plan_ = self->getFallbackPlan();
+    }
+  });
+}
+
 GraphExecutorState ProfilingGraphExecutorImpl::getDebugState() {
   GraphExecutorState state;
   TORCH_INTERNAL_ASSERT(optimized_plan_);
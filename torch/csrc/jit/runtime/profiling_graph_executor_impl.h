@@ -15,10 +15,18 @@ struct ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
  private:
   void runProfilingInsensitiveOptimizations(std::shared_ptr<Graph>& graph);
   void runProfilingOptimizations(std::shared_ptr<Graph>& graph);
+  const ExecutionPlan& getFallbackPlan();
+  void compileInBackground(size_t remaining_bailout_depth);
   std::unique_ptr<ProfilingRecord> pr_;
   c10::optional<ExecutionPlan>
       profiling_plan_; // plan to run in order to profiling the code
   c10::optional<ExecutionPlan> optimized_plan_;
+  // plan served while an optimized plan compiles in the background; built
+  // from the unprofiled graph with profiling-insensitive optimizations only
+  c10::optional<ExecutionPlan> fallback_plan_;
+  // guarded by compile_mutex; true while a background compilation for this
+  // executor is queued or running
+  bool compilation_in_flight_ = false;
 };
 
 } // namespace jit
@@ -84,6 +84,38 @@ void ProfilingRecord::insertShapeProfile(Node *n, Value *i) {
   n->replaceInputWith(i, pn->output());
 }
 
+// Records the observed trip count of a loop as a profiled_trip_count
+// attribute on the loop node. The attribute survives the optimization
+// copies, so passes downstream of profiling (notably the loop unroller) can
+// specialize for the count actually seen; it is an observation rather than
+// a guarantee, so consumers must keep the loop correct for other counts. A
+// count that varies between runs removes the annotation for good.
+void ProfilingRecord::insertTripCountProfile(Node* loop) {
+  Value* trip_count = loop->inputs().at(0);
+  // constant trip counts are already visible to every pass
+  if (trip_count->node()->kind() == prim::Constant) {
+    return;
+  }
+  std::function<void(Stack&)> trip_count_profiler = [this, loop](Stack& stack) {
+    int64_t count = pop(stack).toInt();
+    std::lock_guard<std::mutex> lock(this->mutex_);
+    if (this->varying_trip_counts_.count(loop)) {
+      return;
+    }
+    if (loop->hasAttribute(attr::profiled_trip_count)) {
+      if (loop->i(attr::profiled_trip_count) != count) {
+        loop->removeAttribute(attr::profiled_trip_count);
+        this->varying_trip_counts_.insert(loop);
+      }
+      return;
+    }
+    loop->i_(attr::profiled_trip_count, count);
+  };
+
+  auto pn = createProfileNode(trip_count_profiler, {trip_count});
+  pn->insertBefore(loop);
+}
+
 void ProfilingRecord::instrumentBlock(Block *block) {
   for (auto it = block->nodes().begin(); it != block->nodes().end(); ++it) {
     auto n = *it;
@@ -96,6 +128,10 @@ void ProfilingRecord::instrumentBlock(Block *block) {
       insertShapeProfile(n, i);
     }
 
+    if (n->kind() == prim::Loop) {
+      insertTripCountProfile(n);
+    }
+
     for (auto b : n->blocks()) {
       instrumentBlock(b);
     }
@@ -135,5 +171,131 @@ std::unique_ptr<ProfilingRecord> ProfilingRecord::instrumentGraph(
   return pr;
 }
 
+// collects profile nodes in the same depth-first order instrumentBlock
+// created them in, so dumps and preloads of the same graph line up
+static void collectProfileNodes(Block* block, std::vector<Node*>& nodes) {
+  for (auto n : block->nodes()) {
+    // the trailing run counter is a profile node without outputs; skip it
+    if (n->kind() == prim::profile && n->outputs().size() > 0) {
+      nodes.push_back(n);
+    }
+    for (auto b : n->blocks()) {
+      collectProfileNodes(b, nodes);
+    }
+  }
+}
+
+IValue ProfilingRecord::dumpProfiledTypes() const {
+  std::vector<Node*> profile_nodes;
+  collectProfileNodes(profiled_graph_->block(), profile_nodes);
+
+  std::vector<IValue> observations;
+  observations.reserve(profile_nodes.size());
+  for (auto n : profile_nodes) {
+    auto type = n->output()->type()->cast<TensorType>();
+    c10::optional<std::vector<int64_t>> sizes;
+    c10::optional<std::vector<int64_t>> strides;
+    if (type) {
+      sizes = type->sizes().concrete_sizes();
+      strides = type->strides().concrete_sizes();
+    }
+    if (!type || !sizes || !strides || !type->scalarType() ||
+        !type->device()) {
+      observations.emplace_back();
+      continue;
+    }
+    // requires_grad may legitimately be unknown; encode it as a tri-state
+    int64_t requires_grad =
+        type->requiresGrad() ? (*type->requiresGrad() ? 1 : 0) : -1;
+    observations.push_back(c10::ivalue::Tuple::create(
+        {IValue(*sizes),
+         IValue(*strides),
+         static_cast<int64_t>(*type->scalarType()),
+         type->device()->str(),
+         requires_grad}));
+  }
+  return c10::ivalue::Tuple::create(std::move(observations));
+}
+
+bool ProfilingRecord::preloadProfiledTypes(const IValue& types) {
+  if (!types.isTuple()) {
+    return false;
+  }
+  const auto& observations = types.toTuple()->elements();
+
+  std::vector<Node*> profile_nodes;
+  collectProfileNodes(profiled_graph_->block(), profile_nodes);
+  if (observations.size() != profile_nodes.size()) {
+    // the graph doesn't match the one the observations were collected on
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < observations.size(); i++) {
+    const auto& obs = observations[i];
+    if (obs.isNone()) {
+      continue;
+    }
+    if (!obs.isTuple() || obs.toTuple()->elements().size() != 5) {
+      return false;
+    }
+    const auto& elems = obs.toTuple()->elements();
+    auto sizes = elems[0].toIntVector();
+    auto strides = elems[1].toIntVector();
+    auto scalar_type = static_cast<at::ScalarType>(elems[2].toInt());
+    auto device = at::Device(elems[3].toStringRef());
+    auto requires_grad_code = elems[4].toInt();
+    c10::optional<bool> requires_grad;
+    if (requires_grad_code >= 0) {
+      requires_grad = requires_grad_code > 0;
+    }
+    profile_nodes[i]->output()->setType(TensorType::create(
+        scalar_type,
+        device,
+        c10::VaryingShape(sizes),
+        c10::VaryingShape(strides),
+        requires_grad));
+  }
+  profiling_count_ = 0;
+  return true;
+}
+
+namespace {
+
+struct ProfiledTypeRegistry {
+  std::mutex mutex;
+  std::unordered_map<std::string, IValue> types;
+};
+
+ProfiledTypeRegistry& getProfiledTypeRegistry() {
+  static ProfiledTypeRegistry registry;
+  return registry;
+}
+
+} // namespace
+
+void registerProfiledTypes(const std::string& function_name, IValue types) {
+  auto& registry = getProfiledTypeRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.types[function_name] = std::move(types);
+}
+
+c10::optional<IValue> getRegisteredProfiledTypes(
+    const std::string& function_name) {
+  auto& registry = getProfiledTypeRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto it = registry.types.find(function_name);
+  if (it == registry.types.end()) {
+    return c10::nullopt;
+  }
+  return it->second;
+}
+
+std::unordered_map<std::string, IValue> getAllRegisteredProfiledTypes() {
+  auto& registry = getProfiledTypeRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.types;
+}
+
 } // namespace jit
 } // namespace torch
@@ -8,6 +8,8 @@
 #include <torch/csrc/jit/ir/ir.h>
 
 #include <list>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace torch {
@@ -33,14 +35,43 @@ struct ProfilingRecord {
   std::shared_ptr<Graph> graph() const {
     return profiled_graph_;
   }
+  // Serializes the tensor-type observations collected on this record's
+  // profile nodes into a plain IValue (a tuple with one entry per profile
+  // node, in graph order), suitable for pickling into a module archive.
+  // Nodes without a complete observation are recorded as None.
+  TORCH_API IValue dumpProfiledTypes() const;
+  // Applies observations previously produced by dumpProfiledTypes and marks
+  // this record ready, skipping the profiling runs. Returns false (leaving
+  // the record in profiling mode) if the observations don't line up with
+  // this graph's profile nodes, e.g. because the module changed.
+  TORCH_API bool preloadProfiledTypes(const IValue& types);
  private:
   ProfileOp* createProfileNode(
       const std::function<void(Stack&)>& fp,
       at::ArrayRef<Value*> inputs);
   void instrumentBlock(Block* block);
   void insertShapeProfile(Node *n, Value *i);
+  void insertTripCountProfile(Node* loop);
+  // loops whose observed trip count changed between runs; they never get
+  // (or keep) a profiled_trip_count annotation
+  std::unordered_set<Node*> varying_trip_counts_;
   ProfilingRecord(std::shared_ptr<Graph> g);
 };
 
+// Process-wide registry of profiled type observations, keyed by function
+// name. The profiling graph executor publishes observations here once
+// profiling completes and consults the registry before profiling a fresh
+// graph; module export/import persist the registry with the archive so a
+// restarted process starts with warm specialized plans instead of
+// re-profiling from scratch. Names are unqualified (e.g. "forward"), so
+// the last module profiled under a given name wins.
+TORCH_API void registerProfiledTypes(
+    const std::string& function_name,
+    IValue types);
+TORCH_API c10::optional<IValue> getRegisteredProfiledTypes(
+    const std::string& function_name);
+TORCH_API std::unordered_map<std::string, IValue>
+getAllRegisteredProfiledTypes();
+
 } // namespace jit
 } // namespace torch
@@ -2207,8 +2207,24 @@ RegisterOperators reg2({
 
     DEFINE_STRING_OP(aten::eq, a == b, bool),
     DEFINE_STRING_OP(aten::ne, a != b, bool),
-    DEFINE_STRING_OP(aten::add, a + b, str),
 #undef DEFINE_STRING_OP
+    Operator(
+        "aten::add(str a, str b) -> str",
+        [](Stack& stack) {
+          IValue b_val = pop(stack);
+          IValue a_val = pop(stack);
+          const std::string& a = a_val.toStringRef();
+          const std::string& b = b_val.toStringRef();
+          // Concatenate through a single exactly-sized allocation, reading
+          // the operands in place instead of copying them off the stack.
+          std::string result;
+          result.reserve(a.size() + b.size());
+          result.append(a);
+          result.append(b);
+          push(stack, std::move(result));
+          return 0;
+        },
+        aliasAnalysisFromSchema()),
     Operator(
         "aten::len.str(str s) -> int",
         [](Stack& stack) {
@@ -37,9 +37,12 @@ std::string stringSlice(std::string string, int64_t start, int64_t end, int64_t
   return result;
 }
 
+// Searches within [start, end) without copying the window out of `string`.
+// std::string::find/rfind scan through the libc memchr/memcmp fast paths,
+// which is as vectorized as the platform provides.
 int64_t stringFindImpl(
-    std::string string,
-    std::string substr,
+    const std::string& string,
+    const std::string& substr,
     int64_t start,
     int64_t end,
     bool reverse = false) {
@@ -50,27 +53,26 @@ int64_t stringFindImpl(
   if (end < 0) {
     end = std::max(int64_t(0), int64_t(size + end + 1));
   }
-  if (end > start) {
-    string = string.substr(start, end - start);
-  } else {
-    string = "";
-  }
+  start = std::min(start, size);
+  end = std::min(end, size);
 
-  int64_t result = -1;
-  if (string.size() >= substr.size()) {
-    auto pos = string.find(substr, 0);
-    if (reverse) {
-      auto rpos = pos;
-      do {
-        pos = rpos;
-        rpos = string.find(substr, pos + 1);
-      } while (rpos != std::string::npos);
-    }
-    if (pos != std::string::npos) {
-      result = pos + start;
+  // The match must lie entirely within the window.
+  if (end - start < int64_t(substr.size())) {
+    return -1;
+  }
+  if (reverse) {
+    // Last admissible starting offset within the window.
+    auto pos = string.rfind(substr, end - substr.size());
+    if (pos == std::string::npos || int64_t(pos) < start) {
+      return -1;
     }
+    return pos;
   }
-  return result;
+  auto pos = string.find(substr, start);
+  if (pos == std::string::npos || int64_t(pos + substr.size()) > end) {
+    return -1;
+  }
+  return pos;
 }
 
 RegisterOperators reg_str_ops({
@@ -103,11 +105,13 @@ RegisterOperators reg_str_ops({
       #op_name "(str self) -> str",                 \
       [](Stack& stack) {                            \
         auto string = pop(stack).toStringRef();     \
-        std::stringstream ss;                       \
+        std::string result;                         \
+        result.reserve(string.size());              \
         for (char c : string) {                     \
-          ss << static_cast<char>(char_op(c));      \
+          result.push_back(                         \
+              static_cast<char>(char_op(c)));       \
         }                                           \
-        push(stack, ss.str());                      \
+        push(stack, std::move(result));             \
         return 0;                                   \
       },                                            \
       aliasAnalysisFromSchema())
@@ -592,18 +596,41 @@ auto reg_str_ops_2 =
                                    std::string old_str,
                                    std::string new_str,
                                    int64_t max) {
+                  // Build the result in one pass instead of splicing into
+                  // `string` per match, which re-shifts the whole tail each
+                  // time (quadratic for many occurrences).
+                  std::string result;
+                  result.reserve(string.size());
                   int64_t occurrences = 0;
+                  if (old_str.empty()) {
+                    // Python semantics: interleave `new` between characters.
+                    for (char c : string) {
+                      if (max < 0 || occurrences < max) {
+                        result.append(new_str);
+                        ++occurrences;
+                      }
+                      result.push_back(c);
+                    }
+                    if (max < 0 || occurrences < max) {
+                      result.append(new_str);
+                    }
+                    return result;
+                  }
+                  std::string::size_type prev_pos = 0;
                   std::string::size_type pos = 0;
                   while ((pos = string.find(old_str, pos)) !=
                          std::string::npos) {
                     if (max >= 0 && ++occurrences > max) {
                       break;
                     }
-                    string = string.replace(pos, old_str.length(), new_str);
-                    pos += new_str.length();
+                    result.append(string, prev_pos, pos - prev_pos);
+                    result.append(new_str);
+                    pos += old_str.length();
+                    prev_pos = pos;
                   }
+                  result.append(string, prev_pos, std::string::npos);
 
-                  return string;
+                  return result;
                 }))
 
         .op("aten::partition(str self, str separator) -> (str, str, str)",
@@ -681,9 +708,12 @@ auto reg_str_ops_2 =
                       std::reverse(separator.begin(), separator.end());
                       std::reverse(string.begin(), string.end());
 
+                      // Collect in scan order and emit backwards; inserting
+                      // at the front of the list shifts every prior element
+                      // on each split.
                       std::string::size_type prev_pos = 0;
                       std::string::size_type pos = 0;
-                      c10::List<std::string> splits;
+                      std::vector<std::string> pieces;
                       auto count = 0;
                       while ((pos = string.find(separator, pos)) !=
                              std::string::npos) {
@@ -693,7 +723,7 @@ auto reg_str_ops_2 =
                         } else {
                           auto substr = string.substr(prev_pos, pos - prev_pos);
                           std::reverse(substr.begin(), substr.end());
-                          splits.emplace(splits.begin(), substr);
+                          pieces.emplace_back(std::move(substr));
                         }
                         pos += separator.size();
                         prev_pos = pos;
@@ -701,7 +731,14 @@ auto reg_str_ops_2 =
                       auto substr =
                           string.substr(prev_pos, string.size() - prev_pos);
                       std::reverse(substr.begin(), substr.end());
-                      splits.emplace(splits.begin(), substr);
+                      pieces.emplace_back(std::move(substr));
+
+                      c10::List<std::string> splits;
+                      splits.reserve(pieces.size());
+                      for (auto it = pieces.rbegin(); it != pieces.rend();
+                           ++it) {
+                        splits.emplace_back(std::move(*it));
+                      }
                       return splits;
                     }))
 
@@ -710,14 +747,16 @@ auto reg_str_ops_2 =
                 .aliasAnalysis(AliasAnalysisKind::FROM_SCHEMA)
                 .catchAllKernel([](const std::string& string,
                                    const c10::List<std::string>& values) {
-                  std::stringstream ss;
+                  // Append into one growing buffer; unlike stringstream
+                  // each piece is bulk-copied and growth is amortized.
+                  std::string result;
                   for (auto it = values.begin(); it != values.end(); ++it) {
-                    ss << static_cast<std::string>(*it);
+                    result.append(static_cast<std::string>(*it));
                     if (it != values.end() - 1) {
-                      ss << string;
+                      result.append(string);
                     }
                   }
-                  return ss.str();
+                  return result;
                 }));
 } // namespace
 } // namespace jit
@@ -0,0 +1,131 @@
+#include <torch/csrc/jit/runtime/static_runtime.h>
+
+#include <torch/csrc/jit/ir/constants.h>
+#include <torch/csrc/jit/passes/canonicalize.h>
+#include <torch/csrc/jit/passes/freeze_module.h>
+#include <torch/csrc/jit/passes/inliner.h>
+#include <torch/csrc/jit/runtime/operator.h>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+void check_supported(const std::shared_ptr<Graph>& graph) {
+  for (Node* node : graph->nodes()) {
+    TORCH_CHECK(
+        node->blocks().empty(),
+        "StaticRuntime does not support control flow, found: ",
+        node->kind().toQualString());
+    TORCH_CHECK(
+        node->kind() != prim::fork && node->kind() != aten::wait,
+        "StaticRuntime does not support fork/wait");
+  }
+}
+
+} // namespace
+
+ProcessedNode::ProcessedNode(
+    Node* node,
+    std::vector<size_t> inputs,
+    std::vector<size_t> outputs)
+    : node_(node),
+      op_(node->getOperator().getOperation(node)),
+      input_regs_(std::move(inputs)),
+      output_regs_(std::move(outputs)) {}
+
+void ProcessedNode::run(std::vector<IValue>& registers, Stack& stack) const {
+  stack.clear();
+  for (size_t reg : input_regs_) {
+    stack.emplace_back(registers[reg]);
+  }
+  op_(stack);
+  TORCH_INTERNAL_ASSERT(stack.size() == output_regs_.size());
+  for (size_t i = output_regs_.size(); i > 0; i--) {
+    registers[output_regs_[i - 1]] = std::move(stack.back());
+    stack.pop_back();
+  }
+}
+
+StaticRuntime::StaticRuntime(const Module& module) {
+  Module frozen = freeze_module(module);
+  Method method = frozen.get_method("forward");
+  graph_ = method.graph();
+  Inline(*graph_);
+  graph_ = Canonicalize(graph_);
+  init();
+  // Method graphs still take the module object as their first input; bind
+  // the frozen module once so callers only pass the tensor arguments.
+  TORCH_INTERNAL_ASSERT(!input_regs_.empty());
+  registers_[input_regs_.front()] = frozen._ivalue();
+  input_regs_.erase(input_regs_.begin());
+}
+
+StaticRuntime::StaticRuntime(std::shared_ptr<Graph> graph)
+    : graph_(std::move(graph)) {
+  init();
+}
+
+size_t StaticRuntime::get_register(Value* value) {
+  auto it = value_to_reg_.find(value);
+  if (it != value_to_reg_.end()) {
+    return it->second;
+  }
+  size_t reg = registers_.size();
+  registers_.emplace_back();
+  value_to_reg_.emplace(value, reg);
+  return reg;
+}
+
+void StaticRuntime::init() {
+  check_supported(graph_);
+
+  for (Value* input : graph_->inputs()) {
+    input_regs_.push_back(get_register(input));
+  }
+  for (Node* node : graph_->nodes()) {
+    if (node->kind() == prim::Constant) {
+      // Constants are materialized once; their registers are read-only
+      // afterwards.
+      size_t reg = get_register(node->output());
+      registers_[reg] = *toIValue(node->output());
+      continue;
+    }
+    std::vector<size_t> inputs;
+    for (Value* input : node->inputs()) {
+      inputs.push_back(get_register(input));
+    }
+    std::vector<size_t> outputs;
+    for (Value* output : node->outputs()) {
+      outputs.push_back(get_register(output));
+    }
+    nodes_.emplace_back(node, std::move(inputs), std::move(outputs));
+  }
+  for (Value* output : graph_->outputs()) {
+    output_regs_.push_back(get_register(output));
+  }
+}
+
+std::vector<IValue> StaticRuntime::run(const std::vector<IValue>& inputs) {
+  TORCH_CHECK(
+      inputs.size() == input_regs_.size(),
+      "StaticRuntime expected ",
+      input_regs_.size(),
+      " inputs but got ",
+      inputs.size());
+  for (size_t i = 0; i < inputs.size(); i++) {
+    registers_[input_regs_[i]] = inputs[i];
+  }
+  for (const ProcessedNode& node : nodes_) {
+    node.run(registers_, stack_);
+  }
+  std::vector<IValue> outputs;
+  outputs.reserve(output_regs_.size());
+  for (size_t reg : output_regs_) {
+    outputs.emplace_back(registers_[reg]);
+  }
+  return outputs;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch {
+namespace jit {
+
+// Interpreter-free execution for frozen, control-flow-free graphs.
+//
+// StaticRuntime resolves every node's Operation once at construction time
+// and pre-allocates a flat register file of IValues, so a call is just a
+// loop over (operation, register indices) pairs: no instruction decoding,
+// no stack growth, no GraphExecutor re-entry. This trades generality for
+// latency: graphs with control flow (prim::If / prim::Loop), closures or
+// prim::fork are rejected at construction.
+//
+// A StaticRuntime instance owns its register file and is therefore NOT
+// thread-safe; use one instance per serving thread.
+
+class ProcessedNode {
+ public:
+  ProcessedNode(Node* node, std::vector<size_t> inputs, std::vector<size_t> outputs);
+
+  void run(std::vector<IValue>& registers, Stack& stack) const;
+
+  Node* node() const {
+    return node_;
+  }
+
+ private:
+  Node* node_;
+  Operation op_;
+  std::vector<size_t> input_regs_;
+  std::vector<size_t> output_regs_;
+};
+
+class TORCH_API StaticRuntime {
+ public:
+  // Freezes and inlines the module's forward method.
+  explicit StaticRuntime(const Module& module);
+
+  // The graph must already be inlined and frozen (no free variables other
+  // than graph inputs).
+  explicit StaticRuntime(std::shared_ptr<Graph> graph);
+
+  std::vector<IValue> run(const std::vector<IValue>& inputs);
+
+  const std::shared_ptr<Graph>& graph() const {
+    return graph_;
+  }
+
+ private:
+  void init();
+  size_t get_register(Value* value);
+
+  std::shared_ptr<Graph> graph_;
+  std::vector<ProcessedNode> nodes_;
+  // Flat register file; constants are materialized once at init and their
+  // registers are never overwritten.
+  std::vector<IValue> registers_;
+  std::vector<size_t> input_regs_;
+  std::vector<size_t> output_regs_;
+  std::unordered_map<Value*, size_t> value_to_reg_;
+  // Reused operand stack so op calls do not allocate.
+  Stack stack_;
+};
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,103 @@
+#include <torch/csrc/jit/serialization/async_save.h>
+
+#include <torch/csrc/jit/serialization/export.h>
+
+#include <utility>
+
+namespace torch {
+namespace jit {
+
+namespace {
+
+// NOTE [ Asynchronous module save ]
+//
+// ExportModule runs the pickler and the zip writer synchronously, so saving
+// a large checkpoint stalls the calling (training) thread for the whole
+// serialization. AsyncExportModule splits the work in two:
+//
+//  1. Snapshot, on the calling thread: clone_instance() gives a fresh
+//     object tree whose slots still alias the original tensors, then every
+//     tensor slot is replaced with a private copy. CUDA tensors are copied
+//     straight into pinned host memory (one DMA per tensor, no pickling in
+//     between); CPU tensors are cloned. This is the only part that has to
+//     finish before the caller may mutate its parameters again.
+//
+//  2. Serialize, on a background thread: plain ExportModule over the
+//     snapshot, which by now holds only host tensors.
+//
+// Only direct tensor attributes are snapshotted, which covers parameters
+// and buffers; tensors nested inside container attributes are shared with
+// the original module and must not be mutated before wait() returns.
+Module snapshot_for_save(const Module& module) {
+  Module snapshot = module.clone_instance();
+  for (Module m : snapshot.modules()) {
+    const size_t N = m.type()->numAttributes();
+    for (size_t i = 0; i < N; ++i) {
+      IValue s = m._ivalue()->getSlot(i);
+      if (!s.isTensor()) {
+        continue;
+      }
+      at::Tensor t = s.toTensor();
+      if (!t.defined()) {
+        continue;
+      }
+      at::Tensor copy;
+      if (t.is_cuda()) {
+        copy = at::empty(
+            t.sizes(), t.options().device(at::kCPU).pinned_memory(true));
+        copy.copy_(t);
+      } else {
+        copy = t.clone();
+      }
+      m._ivalue()->setSlot(i, std::move(copy));
+    }
+  }
+  return snapshot;
+}
+
+} // namespace
+
+AsyncSaveRequest::~AsyncSaveRequest() {
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void AsyncSaveRequest::wait() {
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  if (error_) {
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+bool AsyncSaveRequest::completed() const {
+  return done_.load(std::memory_order_acquire);
+}
+
+std::unique_ptr<AsyncSaveRequest> AsyncExportModule(
+    const Module& module,
+    const std::string& filename,
+    const ExtraFilesMap& extra_files,
+    bool bytecode_format) {
+  Module snapshot = snapshot_for_save(module);
+  // no make_unique: the constructor is private
+  std::unique_ptr<AsyncSaveRequest> request(new AsyncSaveRequest());
+  AsyncSaveRequest* raw = request.get();
+  request->thread_ = std::thread(
+      [snapshot, filename, extra_files, bytecode_format, raw]() {
+        try {
+          ExportModule(snapshot, filename, extra_files, bytecode_format);
+        } catch (...) {
+          raw->error_ = std::current_exception();
+        }
+        raw->done_.store(true, std::memory_order_release);
+      });
+  return request;
+}
+
+} // namespace jit
+} // namespace torch
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <torch/csrc/jit/api/module.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+namespace torch {
+namespace jit {
+
+/// Handle for an in-flight asynchronous module save started by
+/// AsyncExportModule. The destructor blocks until the save finishes;
+/// call wait() instead to also observe any error the writer thread hit.
+class TORCH_API AsyncSaveRequest {
+ public:
+  AsyncSaveRequest(const AsyncSaveRequest&) = delete;
+  AsyncSaveRequest& operator=(const AsyncSaveRequest&) = delete;
+  ~AsyncSaveRequest();
+
+  /// Blocks until the background save completes and rethrows any
+  /// exception it raised.
+  void wait();
+
+  /// True once the background save has finished (successfully or not);
+  /// never blocks.
+  bool completed() const;
+
+ private:
+  AsyncSaveRequest() = default;
+  friend TORCH_API std::unique_ptr<AsyncSaveRequest> AsyncExportModule(
+      const Module& module,
+      const std::string& filename,
+      const ExtraFilesMap& extra_files,
+      bool bytecode_format);
+
+  std::thread thread_;
+  std::atomic<bool> done_{false};
+  std::exception_ptr error_;
+};
+
+/// Saves a module without stalling the calling thread for the full
+/// serialization. Tensor attributes are snapshotted on the calling thread
+/// with an immediate copy (device-to-pinned-host for CUDA tensors), so the
+/// caller may keep mutating parameters as soon as this returns; pickling
+/// and PyTorchStreamWriter I/O then run on a background thread. See
+/// NOTE [ Asynchronous module save ] in async_save.cpp.
+TORCH_API std::unique_ptr<AsyncSaveRequest> AsyncExportModule(
+    const Module& module,
+    const std::string& filename,
+    const ExtraFilesMap& extra_files = ExtraFilesMap(),
+    bool bytecode_format = false);
+
+} // namespace jit
+} // namespace torch
@@ -35,7 +35,12 @@ void writeArchiveAndTensors(
   size_t i = 0;
   for (const auto& td : tensors) {
     std::string fname = prefix + std::to_string(i++);
+    // td.data() points straight at the storage bytes (staged on CPU for CUDA
+    // tensors) and the writer pads every record to kFieldAlignment, so the
+    // saved file is directly mmap-loadable. Releasing the staging copy after
+    // each record bounds extra memory to the largest storage being saved.
     out.writeRecord(fname, td.data(), td.sizeInBytes());
+    td.releaseStagedData();
   }
   std::string fname = archive_name + ".pkl";
   out.writeRecord(fname, data, size);
@@ -51,23 +51,31 @@ TORCH_API std::string pretty_print_onnx(
     const std::map<std::string, int>& custom_opsets = {},
     bool add_node_names = true);
 
+// When `strip_debug_info` is set (bytecode_format only), the archive omits
+// the code sections and the pickled source ranges, leaving a bytecode-only
+// deployment artifact. The filename overload writes the stripped sections to
+// a `<filename>.debug` sidecar archive instead, so crashes can still be
+// symbolicated offline against the matching build.
 TORCH_API void ExportModule(
     const Module& module,
     std::ostream& out,
     const ExtraFilesMap& metadata = ExtraFilesMap(),
-    bool bytecode_format = false);
+    bool bytecode_format = false,
+    bool strip_debug_info = false);
 
 TORCH_API void ExportModule(
     const Module& module,
     const std::string& filename,
     const ExtraFilesMap& metadata = ExtraFilesMap(),
-    bool bytecode_format = false);
+    bool bytecode_format = false,
+    bool strip_debug_info = false);
 
 TORCH_API void ExportModule(
     const Module& module,
     const std::function<size_t(const void*, size_t)>& writer_func,
     const ExtraFilesMap& metadata = ExtraFilesMap(),
-    bool bytecode_format = false);
+    bool bytecode_format = false,
+    bool strip_debug_info = false);
 
 // Write the bytes of a pickle archive and the tensors referenced inside that
 // archive
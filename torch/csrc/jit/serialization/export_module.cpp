@@ -6,6 +6,7 @@
 #include <torch/csrc/jit/serialization/pickle.h>
 #include <torch/csrc/jit/serialization/source_range_serialization.h>
 #include <torch/csrc/jit/runtime/instruction.h>
+#include <torch/csrc/jit/runtime/profiling_record.h>
 #include <torch/csrc/jit/passes/inliner.h>
 
 #include <caffe2/serialize/inline_container.h>
@@ -54,12 +55,12 @@ c10::IValue getFunctionTuple(const Function& func) {
       auto node = code.instructions_source()[i];
       opnames.emplace_back(node->schema().operator_name());
     }
-    // CALL nodes at this point represent built-in (i.e. non-Graph)
-    // functions that were not inlined. Here we convert the CALL
-    // instructions for these functions into INTERFACE_CALL instructions
-    // s.t. at runtime, we will look up the Function* on the Type of the
-    // 0th argument in the stack and call that directly.
-    if (ins.op == CALL) {
+    // CALL/CALL_BUILTIN nodes at this point represent built-in (i.e.
+    // non-Graph) functions that were not inlined. Here we convert these
+    // instructions into INTERFACE_CALL instructions s.t. at runtime, we
+    // will look up the Function* on the Type of the 0th argument in the
+    // stack and call that directly.
+    if (ins.op == CALL || ins.op == CALL_BUILTIN) {
       auto node = code.instructions_source()[i];
       if (node->kind() == prim::CallMethod) {
         // NB: replacing instruction
@@ -164,21 +165,42 @@ class ScriptModuleSerializer {
   void serialize(
       const Module& module,
       const ExtraFilesMap& extra_files,
-      bool bytecode_format) {
+      bool bytecode_format,
+      bool strip_debug_info = false) {
     C10_LOG_API_USAGE_ONCE("torch.script.save");
+    TORCH_CHECK(
+        !strip_debug_info || bytecode_format,
+        "strip_debug_info produces a bytecode-only archive, so it requires "
+        "bytecode_format");
     writeExtraFiles(module, extra_files);
     // Serialize the model object
     writeArchive("data", module._ivalue());
-    // Then we werialize all code info.
+    if (!strip_debug_info) {
+      // Then we werialize all code info.
+      writeCode(module.type());
+      // The tensor constants from the code are written to a separate archive
+      // so loading the code does not depend on loading the data
+      std::vector<IValue> ivalue_constants(
+          constant_table_.begin(), constant_table_.end());
+      writeArchive("constants", c10::ivalue::Tuple::create(ivalue_constants));
+      // Persist any profiled tensor-type observations collected for this
+      // module's methods, so a fresh process can skip the profiling runs
+      // (see ProfilingRecord::preloadProfiledTypes).
+      writeProfiledTypes(module);
+    }
+    if (bytecode_format) {
+      writeByteCode(module);
+    }
+  }
+
+  // Writes only the sources, their pickled source ranges and the tensor
+  // constants they reference: the sidecar debug-symbol archive that
+  // accompanies a strip_debug_info export (see ExportModule).
+  void serializeDebugSymbols(const Module& module) {
     writeCode(module.type());
-    // The tensor constants from the code are written to a separate archive
-    // so loading the code does not depend on loading the data
     std::vector<IValue> ivalue_constants(
         constant_table_.begin(), constant_table_.end());
     writeArchive("constants", c10::ivalue::Tuple::create(ivalue_constants));
-    if (bytecode_format) {
-      writeByteCode(module);
-    }
   }
 
  private:
@@ -200,6 +222,9 @@ class ScriptModuleSerializer {
     for (const auto& td : data_pickle.tensorData()) {
       std::string fname = prefix + c10::to_string(i++);
       writer_.writeRecord(fname, td.data(), td.sizeInBytes());
+      // Drop the CPU staging copy (if any) so that saving a model with many
+      // CUDA tensors only ever holds one storage's worth of extra memory.
+      td.releaseStagedData();
     }
     std::string fname = archive_name + ".pkl";
     writer_.writeRecord(fname, data.data(), data.size());
@@ -265,6 +290,19 @@ class ScriptModuleSerializer {
     }
   }
 
+  void writeProfiledTypes(const Module& module) {
+    std::vector<IValue> entries;
+    for (const auto& method : module.get_methods()) {
+      if (auto types = getRegisteredProfiledTypes(method.name())) {
+        entries.push_back(Tup({method.name(), *types}));
+      }
+    }
+    if (entries.empty()) {
+      return;
+    }
+    writeArchive("profiled_types", Tup(std::move(entries)));
+  }
+
   void writeByteCode(const Module& module) {
     std::vector<c10::IValue> elements;
     moduleMethodsTuple(module, elements);
@@ -302,31 +340,41 @@ void ExportModule(
     const Module& module,
     std::ostream& out,
     const ExtraFilesMap& extra_files,
-    bool bytecode_format) {
+    bool bytecode_format,
+    bool strip_debug_info) {
   ScriptModuleSerializer serializer(
     [&](const void* buf, size_t nbytes) -> size_t {
       out.write(static_cast<const char *>(buf), nbytes);
       return !out ? 0 : nbytes;
     });
-  serializer.serialize(module, extra_files, bytecode_format);
+  serializer.serialize(module, extra_files, bytecode_format, strip_debug_info);
 }
 
 void ExportModule(
     const Module& module,
     const std::string& filename,
     const ExtraFilesMap& extra_files,
-    bool bytecode_format) {
+    bool bytecode_format,
+    bool strip_debug_info) {
   ScriptModuleSerializer serializer(filename);
-  serializer.serialize(module, extra_files, bytecode_format);
+  serializer.serialize(module, extra_files, bytecode_format, strip_debug_info);
+  if (strip_debug_info) {
+    // The stripped sections still exist, in a sidecar archive next to the
+    // model, keyed to this export by nothing but its path: ship the model,
+    // keep the sidecar for offline symbolication.
+    ScriptModuleSerializer debug_serializer(filename + ".debug");
+    debug_serializer.serializeDebugSymbols(module);
+  }
 }
 
 void ExportModule(
     const Module& module,
     const std::function<size_t(const void*, size_t)>& writer_func,
     const ExtraFilesMap& extra_files,
-    bool bytecode_format) {
+    bool bytecode_format,
+    bool strip_debug_info) {
   ScriptModuleSerializer serializer(writer_func);
-  serializer.serialize(module, extra_files, bytecode_format);
+  serializer.serialize(module, extra_files, bytecode_format, strip_debug_info);
 }
 
 } // namespace jit
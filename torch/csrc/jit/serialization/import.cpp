@@ -7,6 +7,7 @@
 #endif
 #include <torch/csrc/jit/serialization/import_source.h>
 #include <torch/csrc/jit/ir/ir.h>
+#include <torch/csrc/jit/runtime/profiling_record.h>
 #include <torch/csrc/jit/serialization/pickle.h>
 #include <torch/csrc/jit/serialization/unpickler.h>
 #include <torch/csrc/jit/frontend/script_type_parser.h>
@@ -17,8 +18,11 @@
 #include "caffe2/serialize/istream_adapter.h"
 
 #include <ATen/ATen.h>
+#include <ATen/Parallel.h>
 
+#include <cstring>
 #include <fstream>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -80,8 +84,43 @@ IValue readArchiveAndTensors(
   };
 
   std::string archive_name_plus_slash = archive_name + "/";
+
+  // Tensor-heavy archives are latency-bound on resolving one storage record
+  // at a time from inside the unpickler. The set of tensor payloads for this
+  // archive is known up front (records under `<archive_name>/`), so load
+  // them all concurrently on the intra-op pool first; the unpickler then
+  // picks storages out of the prefetched map.
+  std::vector<std::string> tensor_records;
+  for (const auto& record : stream_reader.getAllRecords()) {
+    // Records are prefixed with the top-level archive folder; strip it
+    // before matching against this archive's subdirectory.
+    auto pos = record.find_first_of('/');
+    if (pos == std::string::npos) {
+      continue;
+    }
+    std::string suffix = record.substr(pos + 1);
+    if (suffix.compare(0, archive_name_plus_slash.size(), archive_name_plus_slash) == 0) {
+      tensor_records.push_back(std::move(suffix));
+    }
+  }
+  std::unordered_map<std::string, at::DataPtr> prefetched_records;
+  std::mutex prefetched_records_mutex;
+  at::parallel_for(0, tensor_records.size(), 1, [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; ++i) {
+      at::DataPtr ptr = std::get<0>(stream_reader.getRecord(tensor_records[i]));
+      std::lock_guard<std::mutex> guard(prefetched_records_mutex);
+      prefetched_records.emplace(tensor_records[i], std::move(ptr));
+    }
+  });
+
   auto read_record = [&](const std::string& name) {
     std::string ss = archive_name_plus_slash + name;
+    auto it = prefetched_records.find(ss);
+    if (it != prefetched_records.end()) {
+      at::DataPtr ptr = std::move(it->second);
+      prefetched_records.erase(it);
+      return ptr;
+    }
     return std::get<0>(stream_reader.getRecord(ss));
   };
 
@@ -97,6 +136,106 @@ IValue readArchiveAndTensors(
 
 namespace {
 
+// NOTE [ Constant tensor deduplication ]
+// Hosts that load many variants of the same base model end up holding one
+// copy of every frozen weight per module, even when the payloads are
+// byte-identical. Constants are immutable once imported, so identical
+// tensors can be shared freely: after the constants archive is unpickled,
+// each tensor is looked up in a process-wide cache keyed by a hash of its
+// metadata and payload, and a hit replaces the freshly read copy with the
+// already-resident tensor. The cache holds weak references only, so
+// unloading the last module that uses a constant frees its memory just as
+// before. Only dense CPU tensors are deduplicated; confirming a match on
+// device memory would cost a sync and a copy per constant.
+class ConstantTensorCache {
+ public:
+  static ConstantTensorCache& get() {
+    static ConstantTensorCache cache;
+    return cache;
+  }
+
+  at::Tensor dedup(const at::Tensor& tensor) {
+    if (tensor.device().type() != at::DeviceType::CPU ||
+        tensor.layout() != at::kStrided || !tensor.is_contiguous() ||
+        tensor.is_quantized()) {
+      return tensor;
+    }
+    size_t h = hash(tensor);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto range = cache_.equal_range(h);
+    for (auto it = range.first; it != range.second;) {
+      IValue locked = it->second.lock();
+      if (locked.isNone()) {
+        it = cache_.erase(it);
+        continue;
+      }
+      at::Tensor candidate = locked.toTensor();
+      if (equal(candidate, tensor)) {
+        shared_bytes_ += payloadBytes(tensor);
+        return candidate;
+      }
+      ++it;
+    }
+    cache_.emplace(h, c10::WeakIValue(IValue(tensor)));
+    return tensor;
+  }
+
+  ConstantDedupStats stats() {
+    ConstantDedupStats result;
+    std::lock_guard<std::mutex> lock(mutex_);
+    result.shared_bytes = shared_bytes_;
+    for (auto it = cache_.begin(); it != cache_.end();) {
+      IValue locked = it->second.lock();
+      if (locked.isNone()) {
+        it = cache_.erase(it);
+        continue;
+      }
+      result.private_bytes += payloadBytes(locked.toTensor());
+      ++it;
+    }
+    return result;
+  }
+
+ private:
+  static size_t payloadBytes(const at::Tensor& tensor) {
+    return tensor.numel() * tensor.element_size();
+  }
+
+  // FNV-1a over the payload, seeded with the metadata that has to match for
+  // two constants to be interchangeable (strides are implied by sizes since
+  // only contiguous tensors get here)
+  static size_t hash(const at::Tensor& tensor) {
+    size_t h = 0xcbf29ce484222325ULL;
+    auto mix = [&h](size_t value) { h = (h ^ value) * 0x100000001b3ULL; };
+    mix(static_cast<size_t>(tensor.scalar_type()));
+    for (auto s : tensor.sizes()) {
+      mix(static_cast<size_t>(s));
+    }
+    size_t nbytes = payloadBytes(tensor);
+    const auto* data = static_cast<const uint8_t*>(tensor.data_ptr());
+    size_t i = 0;
+    for (; i + sizeof(size_t) <= nbytes; i += sizeof(size_t)) {
+      size_t word;
+      std::memcpy(&word, data + i, sizeof(size_t));
+      mix(word);
+    }
+    for (; i < nbytes; ++i) {
+      mix(data[i]);
+    }
+    return h;
+  }
+
+  // full byte comparison guards against hash collisions
+  static bool equal(const at::Tensor& a, const at::Tensor& b) {
+    return a.scalar_type() == b.scalar_type() && a.sizes().equals(b.sizes()) &&
+        std::memcmp(a.data_ptr(), b.data_ptr(), payloadBytes(a)) == 0;
+  }
+
+  std::mutex mutex_;
+  std::unordered_multimap<size_t, c10::WeakIValue> cache_;
+  // monotonic count of bytes that loads avoided duplicating
+  size_t shared_bytes_ = 0;
+};
 
 // This is a deserializer class which loads script modules from pt files.
 // Content of the file is written using PyTorchStreamWriter, for details please
@@ -206,13 +345,28 @@ Module ScriptModuleDeserializer::deserialize(
   }
   auto tuple = readArchive("constants").toTuple();
   for (auto constant : tuple->elements()) {
-    constants_table_.push_back(constant.toTensor());
+    // see NOTE [ Constant tensor deduplication ]
+    constants_table_.push_back(
+        ConstantTensorCache::get().dedup(constant.toTensor()));
+  }
+  // Preload profiled tensor-type observations, if the archive carries any,
+  // so the profiling executor can start with warm specialized plans.
+  if (reader_->hasRecord("profiled_types.pkl")) {
+    auto entries = readArchive("profiled_types").toTuple()->elements();
+    for (const auto& entry : entries) {
+      const auto& kv = entry.toTuple()->elements();
+      registerProfiledTypes(kv.at(0).toStringRef(), kv.at(1));
+    }
   }
   return Module(readArchive("data").toObject());
 }
 
 } // namespace
 
+ConstantDedupStats getConstantDedupStats() {
+  return ConstantTensorCache::get().stats();
+}
+
 Module import_ir_module(
     std::shared_ptr<CompilationUnit> cu,
     std::istream& in,
@@ -65,6 +65,17 @@ TORCH_API Module load(
     c10::optional<c10::Device> device = c10::nullopt,
     ExtraFilesMap& extra_files = default_extra_files);
 
+/// Running totals for NOTE [ Constant tensor deduplication ] in import.cpp.
+/// `private_bytes` counts the payload bytes of unique constant tensors still
+/// alive; `shared_bytes` counts the payload bytes that loads avoided holding
+/// by reusing an already-resident identical constant.
+struct TORCH_API ConstantDedupStats {
+  size_t shared_bytes = 0;
+  size_t private_bytes = 0;
+};
+
+TORCH_API ConstantDedupStats getConstantDedupStats();
+
 TORCH_API IValue readArchiveAndTensors(
     const std::string& archive_name,
     c10::optional<TypeResolver> type_resolver,
@@ -603,25 +603,33 @@ WriteableTensorData getWriteableTensorData(const at::Tensor& tensor) {
   WriteableTensorData result;
   result.tensor_ = tensor;
   result.size_ = tensor.element_size() * tensor.storage().size();
+  return result;
+}
+
+const at::Tensor& WriteableTensorData::cpuTensor() const {
   // TODO HIP support
-  if (tensor.storage().device_type() == at::DeviceType::CUDA) {
+  if (tensor_.storage().device_type() != at::DeviceType::CUDA) {
+    return tensor_;
+  }
+  if (!staged_.defined()) {
     // NB: This new tensor is created to support cuda tensors.
     // Storages can be mutated when converting tensors from cuda to cpu,
-    // and we need a cpu tensor to copy data from.
-    result.tensor_ = at::empty({0}, tensor.options())
-                         .set_(
-                             tensor.storage(),
-                             /* storage_offset = */ 0,
-                             /* size = */
-                             {static_cast<int64_t>(tensor.storage().size())},
-                             /* stride = */ {1})
-                         .cpu();
+    // and we need a cpu tensor to copy data from. The copy is made lazily,
+    // when the bytes are first requested, so that callers writing storages
+    // out one at a time never hold more than one staging copy at once.
+    staged_ = at::empty({0}, tensor_.options())
+                  .set_(
+                      tensor_.storage(),
+                      /* storage_offset = */ 0,
+                      /* size = */
+                      {static_cast<int64_t>(tensor_.storage().size())},
+                      /* stride = */ {1})
+                  .cpu();
     TORCH_CHECK(
-        result.tensor_.element_size() * result.tensor_.storage().size() ==
-            result.size_,
+        staged_.element_size() * staged_.storage().size() == size_,
         "Storage tensor size did not match record size");
   }
-  return result;
+  return staged_;
 }
 
 bool checkHasValidSetGetState(const std::shared_ptr<c10::ClassType>& cls) {
@@ -90,8 +90,12 @@ enum class PickleOpCode : char {
 using ::c10::IValue;
 
 struct WriteableTensorData {
+  // Pointer to the raw storage bytes, on CPU. For CPU tensors this is the
+  // storage's own data pointer (no copy is made); for CUDA tensors a CPU
+  // staging copy is created on first use and kept alive until this object
+  // is destroyed or releaseStagedData() is called.
   const char* data() const {
-    return static_cast<const char*>(tensor_.storage().data());
+    return static_cast<const char*>(cpuTensor().storage().data());
   }
   size_t sizeInBytes() const {
     return size_;
@@ -100,12 +104,26 @@ struct WriteableTensorData {
     return tensor_.storage().numel();
   }
   bool storageHasDeleter() const {
-    return tensor_.storage().data_ptr().get_context() != nullptr;
+    return cpuTensor().storage().data_ptr().get_context() != nullptr;
+  }
+  // The tensor whose storage this record describes (possibly on CUDA).
+  const at::Tensor& tensor() const {
+    return tensor_;
+  }
+  // Frees the CPU staging copy of a CUDA storage, invalidating any pointer
+  // previously returned by data(). Callers that write storages out one at a
+  // time should call this after each write so that at most one staging copy
+  // is alive at any moment, instead of one per tensor in the archive.
+  void releaseStagedData() const {
+    staged_ = at::Tensor();
   }
 
  private:
+  const at::Tensor& cpuTensor() const;
   friend WriteableTensorData getWriteableTensorData(const at::Tensor& tensor);
   at::Tensor tensor_;
+  // Lazily created CPU copy of a CUDA storage; see cpuTensor().
+  mutable at::Tensor staged_;
   uint64_t size_;
 };
 
@@ -6,6 +6,10 @@
 #include <torch/csrc/jit/tensorexpr/ir_simplifier.h>
 #include <torch/csrc/jit/tensorexpr/loopnest.h>
 
+#ifdef TORCH_ENABLE_LLVM
+#include <torch/csrc/jit/tensorexpr/llvm_codegen.h>
+#endif
+
 using namespace torch::jit;
 using namespace torch::jit::tensorexpr;
 
@@ -16,6 +20,7 @@ namespace tensorexpr {
 static int te_cuda_pointwise_loop_levels = -1;
 static int te_cuda_pointwise_block_count = -1;
 static int te_cuda_pointwise_block_size = -1;
+static bool te_dynamic_shapes = false;
 
 int& getTECudaPointwiseLoopLevels() {
   return te_cuda_pointwise_loop_levels;
@@ -29,6 +34,10 @@ int& getTECudaPointwiseBlockSize() {
   return te_cuda_pointwise_block_size;
 }
 
+bool& getTEDynamicShapes() {
+  return te_dynamic_shapes;
+}
+
 } // namespace tensorexpr
 } // namespace jit
 } // namespace torch
@@ -37,15 +46,34 @@ static at::ScalarType tensorType(Tensor* t) {
   return static_cast<at::ScalarType>(t->body()->dtype().scalar_type());
 }
 
-static std::vector<ExprHandle> texprSizes(const c10::VaryingShape& shape) {
+VarHandle TensorExprKernel::sizeVar(int64_t extent) {
+  auto it = shapeVars_.find(extent);
+  if (it == shapeVars_.end()) {
+    VarHandle v("size_c" + std::to_string(extent), kInt);
+    it = shapeVars_.emplace(extent, v).first;
+  }
+  return it->second;
+}
+
+ExprHandle TensorExprKernel::dimExpr(int64_t extent) {
+  // Extents of one stay constant so broadcasting decisions, which only
+  // distinguish one from not-one, are unaffected by dynamic-shape mode.
+  if (!dynamicShapeMode_ || extent <= 1) {
+    return IntImm::make(extent);
+  }
+  return sizeVar(extent);
+}
+
+std::vector<ExprHandle> TensorExprKernel::texprSizes(
+    const c10::VaryingShape& shape) {
   std::vector<ExprHandle> dims;
   for (size_t i = 0; i < *shape.size(); i++) {
-    dims.push_back(IntImm::make(*shape[i]));
+    dims.push_back(dimExpr(*shape[i]));
   }
   return dims;
 }
 
-static std::vector<DimArg> texprDims(const torch::jit::Value* v) {
+std::vector<DimArg> TensorExprKernel::texprDims(const torch::jit::Value* v) {
   if (v->type()->kind() != TypeKind::TensorType) {
     throw malformed_input();
   }
@@ -1093,20 +1121,26 @@ void TensorExprKernel::lowerToBackend(BackendType backendType) {
       }
     }
 
-    // Vectorize inner loops.
+    // Vectorize inner loops, splitting at the host's preferred vector width
+    // so an AVX512 machine gets 16-lane bodies rather than 8-lane ones.
+#ifdef TORCH_ENABLE_LLVM
+    const int vectorWidth = LLVMCodeGen::preferredVectorWidth();
+#else
+    const int vectorWidth = 8;
+#endif
     for (For* loop : innerLoops) {
       For* outer1;
       For* split1;
       For* tail1;
 
-      l.SplitWithTail(loop, 8, &outer1, &split1, &tail1);
+      l.SplitWithTail(loop, vectorWidth, &outer1, &split1, &tail1);
       l.Vectorize(split1);
 
-      if (tail1) {
+      if (tail1 && vectorWidth > 4) {
         For* outer2;
         For* split2;
         For* tail2;
-        l.SplitWithTail(tail1, 4, &outer2, &split2, &tail2);
+        l.SplitWithTail(tail1, vectorWidth / 2, &outer2, &split2, &tail2);
         l.Vectorize(split2);
       }
     }
@@ -1161,7 +1195,8 @@ static bool isValidPrimProperty(const c10::optional<T>& a, T b) {
 
 static bool isValidVaryingShape(
     const c10::VaryingShape& vs,
-    at::IntArrayRef sz) {
+    at::IntArrayRef sz,
+    bool exact) {
   if (!vs.size().has_value()) {
     // TODO: does it make sense to have kernels with completely unspecified
     // shapes/strides
@@ -1172,6 +1207,13 @@ static bool isValidVaryingShape(
     return false;
   }
 
+  // In dynamic-shape mode the extents (and hence strides) are runtime
+  // kernel parameters, so only the rank has to match; runKernel() checks
+  // that dimensions sharing a size var agree.
+  if (!exact) {
+    return true;
+  }
+
   for (size_t i = 0; i < sz.size(); i++) {
     if (!isValidPrimProperty(vs[i], sz[i])) {
       return false;
@@ -1182,7 +1224,8 @@ static bool isValidVaryingShape(
 
 static void checkInputs(
     const at::ArrayRef<IValue>& inputs,
-    std::vector<TypePtr>& inputTypes) {
+    std::vector<TypePtr>& inputTypes,
+    bool exactShapes) {
   TORCH_INTERNAL_ASSERT(
       inputs.size() == inputTypes.size(),
       "number of actual inputs don't match with the number of inputs to a subgraph");
@@ -1213,12 +1256,12 @@ static void checkInputs(
           i,
           " device types don't match");
       TORCH_INTERNAL_ASSERT(
-          isValidVaryingShape(tt->sizes(), t.sizes()),
+          isValidVaryingShape(tt->sizes(), t.sizes(), exactShapes),
           "input ",
           i,
           " sizes don't match");
       TORCH_INTERNAL_ASSERT(
-          isValidVaryingShape(tt->strides(), t.strides()),
+          isValidVaryingShape(tt->strides(), t.strides(), exactShapes),
           "input ",
           i,
           " strides don't match");
@@ -1237,7 +1280,7 @@ static void checkInputs(
 
 void TensorExprKernel::pickAndCheckBackendType(
     const at::ArrayRef<IValue>& inputs) {
-  checkInputs(inputs, inputTypes_);
+  checkInputs(inputs, inputTypes_, !dynamicShapeMode_);
 
   at::Device device = [&inputs]() {
     for (auto const& input : inputs) {
@@ -1324,18 +1367,17 @@ ExprHandle TensorExprKernel::createInputIndexExpr(
       stride = v;
     }
 
-    // If size is dynamic (indicated by negative value) create a size param.
+    // If the size is dynamic - either marked with a negative value or
+    // generalized to a size var in dynamic-shape mode - create a size param.
     ExprHandle size;
     auto sizeVal = *sizes[n - i];
-    if (sizeVal < 0) {
-      auto it = sizeVars.find(sizeVal);
-      if (it == sizeVars.end()) {
-        throw malformed_input();
-      }
-
+    auto it = sizeVars.find(sizeVal);
+    if (it != sizeVars.end()) {
       auto const& v = it->second;
       sizeArgs.emplace_back(n - i, v);
       size = v;
+    } else if (sizeVal < 0) {
+      throw malformed_input();
     } else {
       size = static_cast<int32_t>(sizeVal);
     }
@@ -1361,7 +1403,11 @@ void TensorExprKernel::bindInput(const torch::jit::Value* input) {
       std::unordered_map<int64_t, VarHandle> sizeVars;
       for (size_t i = 0; i < *tt->sizes().size(); i++) {
         auto const& size = *tt->sizes()[i];
-        if (size < 0) {
+        if (dynamicShapeMode_ && size > 1) {
+          VarHandle v = sizeVar(size);
+          sizeVars.emplace(size, v);
+          inputTensorDims.emplace_back(v);
+        } else if (size < 0) {
           VarHandle v(
               "size_" + std::to_string(input->unique()) + "_" +
                   std::to_string(i),
@@ -1373,38 +1419,38 @@ void TensorExprKernel::bindInput(const torch::jit::Value* input) {
               DimArg(IntImm::make(size), "i" + std::to_string(i)));
         }
       }
-#ifdef DYNAMIC_SHAPES
-      tensors_.emplace(
-          input->unique(),
-          Compute(
-              "input",
-              inputTensorDims,
-              [&](const std::vector<VarHandle>& axes) {
-                return createInputIndexExpr(
-                    inBuffer,
-                    axes,
-                    tt->sizes(),
-                    tt->strides(),
-                    tt->contiguity(),
-                    sizeVars);
-              }));
-#else
-      auto const& strides = tt->strides();
-      tensors_.emplace(
-          input->unique(),
-          Compute(
-              "input",
-              inputTensorDims,
-              [&](const std::vector<VarHandle>& axes) {
-                ExprHandle idx = 0;
-                for (size_t i = 0; i < axes.size(); i++) {
-                  idx = idx + axes[i] * IntImm::make(*strides[i]);
-                }
-                return inBuffer(idx);
-              }));
-      kernelArgs_.emplace_back(
-          inBuffer, std::vector<ShapeArg>(), std::vector<ShapeArg>());
-#endif
+      if (!sizeVars.empty()) {
+        tensors_.emplace(
+            input->unique(),
+            Compute(
+                "input",
+                inputTensorDims,
+                [&](const std::vector<VarHandle>& axes) {
+                  return createInputIndexExpr(
+                      inBuffer,
+                      axes,
+                      tt->sizes(),
+                      tt->strides(),
+                      tt->contiguity(),
+                      sizeVars);
+                }));
+      } else {
+        auto const& strides = tt->strides();
+        tensors_.emplace(
+            input->unique(),
+            Compute(
+                "input",
+                inputTensorDims,
+                [&](const std::vector<VarHandle>& axes) {
+                  ExprHandle idx = 0;
+                  for (size_t i = 0; i < axes.size(); i++) {
+                    idx = idx + axes[i] * IntImm::make(*strides[i]);
+                  }
+                  return inBuffer(idx);
+                }));
+        kernelArgs_.emplace_back(
+            inBuffer, std::vector<ShapeArg>(), std::vector<ShapeArg>());
+      }
       break;
     }
     case TypeKind::FloatType: {
@@ -1429,6 +1475,20 @@ void TensorExprKernel::bindInput(const torch::jit::Value* input) {
 void TensorExprKernel::compile() {
   KernelScope kernelScope(&kernelArena_);
 
+  dynamicShapeMode_ = getTEDynamicShapes();
+  if (dynamicShapeMode_) {
+    for (auto const& n : graph_->nodes()) {
+      // These ops fold extents into the emitted expressions (cat offsets,
+      // chunk steps, slice bounds), so they pin the shapes they were
+      // compiled with and cannot take extents as runtime parameters.
+      if (n->kind() == aten::cat || n->kind() == aten::slice ||
+          n->kind() == prim::ConstantChunk) {
+        dynamicShapeMode_ = false;
+        break;
+      }
+    }
+  }
+
   // Bind inputs to buffers.
   nInputs_ = graph_->inputs().size();
   for (auto const& input : graph_->inputs()) {
@@ -1506,7 +1566,12 @@ void TensorExprKernel::runKernel(Stack& stack) {
       for (auto const& size : kernelArgs_[i].sizes()) {
         int32_t s = tensor.sizes()[size.idx];
         runArgs.emplace_back(s);
-        varToSize[size.var.node()] = s;
+        auto inserted = varToSize.emplace(size.var.node(), s);
+        if (!inserted.second && inserted.first->second != s) {
+          // Dimensions that shared an extent at compile time share a size
+          // var and must still agree; fall back to the interpreter if not.
+          throw std::runtime_error("dynamic shape class mismatch");
+        }
       }
       for (auto const& stride : kernelArgs_[i].strides()) {
         int32_t s = tensor.strides()[stride.idx];
@@ -95,6 +95,20 @@ class TensorExprKernel {
     return t->call(indices);
   }
 
+  // Returns the shared size var for the given extent, creating it on first
+  // use.  Dimensions with equal extents at compile time share one var, so a
+  // single compiled kernel serves any input lengths that preserve those
+  // equalities.
+  VarHandle sizeVar(int64_t extent);
+
+  // Returns the expression for a dimension of the given extent: the shared
+  // size var in dynamic-shape mode, a constant otherwise.
+  ExprHandle dimExpr(int64_t extent);
+
+  std::vector<ExprHandle> texprSizes(const c10::VaryingShape& shape);
+
+  std::vector<DimArg> texprDims(const torch::jit::Value* v);
+
   std::vector<ExprHandle> valueShape(const torch::jit::Value* v);
 
   void promoteInputs(std::vector<ExprHandle>& inputs);
@@ -206,6 +220,10 @@ class TensorExprKernel {
   };
 
   int64_t nInputs_ = 0;
+  // When true, extents of dimensions larger than one are compiled as
+  // runtime kernel parameters instead of constants; see getTEDynamicShapes.
+  bool dynamicShapeMode_ = false;
+  std::unordered_map<int64_t, VarHandle> shapeVars_;
   std::vector<KernelArg> kernelArgs_;
   std::vector<Tensor*> tensorOutputs_;
   std::unordered_map<int64_t, Tensor*> tensors_;
@@ -225,6 +243,10 @@ class TensorExprKernel {
 TORCH_API int& getTECudaPointwiseLoopLevels();
 TORCH_API int& getTECudaPointwiseBlockCount();
 TORCH_API int& getTECudaPointwiseBlockSize();
+// When enabled, kernels are compiled with runtime extent parameters for
+// dimensions larger than one, so one compiled kernel serves a range of
+// input lengths instead of one kernel per observed shape signature.
+TORCH_API bool& getTEDynamicShapes();
 
 } // namespace tensorexpr
 } // namespace jit
@@ -183,6 +183,27 @@ static void* argToPtr(
   return nullptr;
 }
 
+int LLVMCodeGen::preferredVectorWidth() {
+  // The JIT already compiles with the full host feature set (see
+  // makeTargetMachineBuilder); this reports the matching float lane count so
+  // the loop nest can split inner loops to fill the widest vector unit
+  // instead of assuming 256 bits.
+  static const int width = []() {
+    llvm::StringMap<bool> features;
+    if (llvm::sys::getHostCPUFeatures(features)) {
+      if (features.lookup("avx512f")) {
+        return 16;
+      }
+      if (features.lookup("avx2") || features.lookup("avx")) {
+        return 8;
+      }
+    }
+    // 128-bit baseline (SSE et al.)
+    return 4;
+  }();
+  return width;
+}
+
 void LLVMCodeGen::call(const std::vector<CallArg>& args) {
   if (args.size() != buffer_args().size()) {
     throw malformed_input();
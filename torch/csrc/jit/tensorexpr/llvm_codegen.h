@@ -30,6 +30,11 @@ class TORCH_API LLVMCodeGen : public CodeGen {
 
   TORCH_API void call(const std::vector<CallArg>& args) override;
 
+  // Number of float lanes in the host's widest vector unit; the loop nest
+  // uses this to pick the split width for vectorized inner loops so the
+  // JIT-ed code is specialized to AVX512/AVX2/SSE at runtime.
+  TORCH_API static int preferredVectorWidth();
+
   template <typename T>
   T value() {
     std::vector<void*> args;
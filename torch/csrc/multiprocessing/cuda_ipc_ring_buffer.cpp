@@ -0,0 +1,282 @@
+#include <torch/csrc/multiprocessing/cuda_ipc_ring_buffer.h>
+
+#if defined(USE_CUDA) && !defined(_WIN32)
+
+#include <ATen/cuda/CUDAContext.h>
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <cuda_runtime_api.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+namespace torch {
+namespace multiprocessing {
+
+namespace {
+
+constexpr uint64_t kRingBufferMagic = 0x7263697063616475; // "udacpcir"
+
+std::string shmName(const std::string& name) {
+  return "/torch_cuda_ipc_ring_" + name;
+}
+
+[[noreturn]] void throwSystemError(const char* what) {
+  throw std::system_error(errno, std::system_category(), what);
+}
+
+} // namespace
+
+// Lives at the start of the shared memory segment; see
+// NOTE [ CUDA IPC ring buffer ]. head_ counts pushes and tail_ counts pops,
+// both monotonically; slot i of a cursor value c is c % num_slots_. The
+// producer publishes a slot with a release store to head_ after the device
+// copy has completed, so a consumer that observes the new head_ with an
+// acquire load also observes the slot header and the device data.
+struct CudaIPCRingBuffer::ControlBlock {
+  struct SlotHeader {
+    int16_t scalar_type;
+    int16_t ndim;
+    int64_t sizes[kMaxDims];
+  };
+
+  uint64_t magic_;
+  int64_t slot_bytes_;
+  int64_t num_slots_;
+  int32_t device_index_;
+  cudaIpcMemHandle_t mem_handle_;
+  std::atomic<uint64_t> head_;
+  std::atomic<uint64_t> tail_;
+  SlotHeader slots_[1]; // num_slots_ entries follow
+
+  static size_t byte_size(int64_t num_slots) {
+    return sizeof(ControlBlock) + (num_slots - 1) * sizeof(SlotHeader);
+  }
+};
+
+std::unique_ptr<CudaIPCRingBuffer> CudaIPCRingBuffer::producer(
+    const std::string& name,
+    int64_t slot_bytes,
+    int64_t num_slots,
+    at::Device device) {
+  TORCH_CHECK(device.is_cuda(), "ring buffer device must be a CUDA device");
+  TORCH_CHECK(slot_bytes > 0, "slot_bytes must be positive");
+  TORCH_CHECK(num_slots > 0, "num_slots must be positive");
+
+  std::unique_ptr<CudaIPCRingBuffer> ring(new CudaIPCRingBuffer());
+  ring->shm_name_ = shmName(name);
+  ring->is_producer_ = true;
+  ring->device_index_ = device.index();
+  ring->control_size_ = ControlBlock::byte_size(num_slots);
+
+  const int fd =
+      shm_open(ring->shm_name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    throwSystemError("shm_open");
+  }
+  if (ftruncate(fd, ring->control_size_) != 0) {
+    close(fd);
+    shm_unlink(ring->shm_name_.c_str());
+    throwSystemError("ftruncate");
+  }
+  void* mapped = mmap(
+      nullptr,
+      ring->control_size_,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED,
+      fd,
+      0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    shm_unlink(ring->shm_name_.c_str());
+    throwSystemError("mmap");
+  }
+  ring->control_ = static_cast<ControlBlock*>(mapped);
+
+  at::cuda::CUDAGuard device_guard(ring->device_index_);
+  C10_CUDA_CHECK(cudaMalloc(
+      &ring->device_base_, static_cast<size_t>(slot_bytes) * num_slots));
+
+  ControlBlock* control = ring->control_;
+  std::memset(control, 0, ring->control_size_);
+  control->slot_bytes_ = slot_bytes;
+  control->num_slots_ = num_slots;
+  control->device_index_ = ring->device_index_;
+  C10_CUDA_CHECK(
+      cudaIpcGetMemHandle(&control->mem_handle_, ring->device_base_));
+  control->head_.store(0);
+  control->tail_.store(0);
+  // The magic is written last so a consumer racing with creation never
+  // observes a partially initialized header.
+  std::atomic_thread_fence(std::memory_order_release);
+  control->magic_ = kRingBufferMagic;
+
+  return ring;
+}
+
+std::unique_ptr<CudaIPCRingBuffer> CudaIPCRingBuffer::consumer(
+    const std::string& name) {
+  std::unique_ptr<CudaIPCRingBuffer> ring(new CudaIPCRingBuffer());
+  ring->shm_name_ = shmName(name);
+  ring->is_producer_ = false;
+
+  const int fd = shm_open(ring->shm_name_.c_str(), O_RDWR, 0600);
+  if (fd < 0) {
+    throwSystemError("shm_open");
+  }
+
+  // Map the fixed header first to learn num_slots_, then remap the full
+  // control block including the slot headers.
+  void* mapped =
+      mmap(nullptr, sizeof(ControlBlock), PROT_READ, MAP_SHARED, fd, 0);
+  if (mapped == MAP_FAILED) {
+    close(fd);
+    throwSystemError("mmap");
+  }
+  const auto* header = static_cast<const ControlBlock*>(mapped);
+  TORCH_CHECK(
+      header->magic_ == kRingBufferMagic,
+      "shared memory segment ", ring->shm_name_,
+      " is not an initialized CUDA IPC ring buffer");
+  const int64_t num_slots = header->num_slots_;
+  munmap(mapped, sizeof(ControlBlock));
+
+  ring->control_size_ = ControlBlock::byte_size(num_slots);
+  mapped = mmap(
+      nullptr,
+      ring->control_size_,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED,
+      fd,
+      0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    throwSystemError("mmap");
+  }
+  ring->control_ = static_cast<ControlBlock*>(mapped);
+  ring->device_index_ = ring->control_->device_index_;
+
+  at::cuda::CUDAGuard device_guard(ring->device_index_);
+  C10_CUDA_CHECK(cudaIpcOpenMemHandle(
+      &ring->device_base_,
+      ring->control_->mem_handle_,
+      cudaIpcMemLazyEnablePeerAccess));
+
+  return ring;
+}
+
+CudaIPCRingBuffer::~CudaIPCRingBuffer() {
+  if (device_base_ != nullptr) {
+    at::cuda::CUDAGuard device_guard(device_index_);
+    if (is_producer_) {
+      cudaFree(device_base_);
+    } else {
+      cudaIpcCloseMemHandle(device_base_);
+    }
+  }
+  if (control_ != nullptr) {
+    munmap(control_, control_size_);
+  }
+  if (is_producer_) {
+    shm_unlink(shm_name_.c_str());
+  }
+}
+
+bool CudaIPCRingBuffer::push(const at::Tensor& tensor) {
+  TORCH_CHECK(is_producer_, "push called on the consumer side of the ring");
+  TORCH_CHECK(
+      tensor.is_cuda() && tensor.get_device() == device_index_,
+      "expected a CUDA tensor on device ", device_index_);
+  TORCH_CHECK(
+      tensor.dim() <= kMaxDims,
+      "ring buffer tensors may have at most ", kMaxDims, " dimensions");
+
+  ControlBlock* control = control_;
+  const uint64_t head = control->head_.load(std::memory_order_relaxed);
+  if (head - control->tail_.load(std::memory_order_acquire) ==
+      static_cast<uint64_t>(control->num_slots_)) {
+    return false; // full
+  }
+
+  at::Tensor src = tensor.contiguous();
+  const int64_t nbytes = src.numel() * src.element_size();
+  TORCH_CHECK(
+      nbytes <= control->slot_bytes_,
+      "tensor of ", nbytes, " bytes does not fit in a ", control->slot_bytes_,
+      " byte ring buffer slot");
+
+  auto& slot = control->slots_[head % control->num_slots_];
+  slot.scalar_type = static_cast<int16_t>(src.scalar_type());
+  slot.ndim = static_cast<int16_t>(src.dim());
+  for (int64_t i = 0; i < src.dim(); ++i) {
+    slot.sizes[i] = src.size(i);
+  }
+
+  at::cuda::CUDAGuard device_guard(device_index_);
+  auto stream = at::cuda::getCurrentCUDAStream();
+  void* dst = static_cast<char*>(device_base_) +
+      (head % control->num_slots_) * control->slot_bytes_;
+  C10_CUDA_CHECK(cudaMemcpyAsync(
+      dst, src.data_ptr(), nbytes, cudaMemcpyDeviceToDevice, stream));
+  // The copy must have completed before the slot is published; the consumer
+  // is another process, so stream ordering cannot be used across the ring.
+  C10_CUDA_CHECK(cudaStreamSynchronize(stream));
+
+  control->head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+c10::optional<at::Tensor> CudaIPCRingBuffer::pop() {
+  TORCH_CHECK(!is_producer_, "pop called on the producer side of the ring");
+
+  ControlBlock* control = control_;
+  const uint64_t tail = control->tail_.load(std::memory_order_relaxed);
+  if (control->head_.load(std::memory_order_acquire) == tail) {
+    return c10::nullopt; // empty
+  }
+
+  const auto& slot = control->slots_[tail % control->num_slots_];
+  const auto scalar_type = static_cast<at::ScalarType>(slot.scalar_type);
+  at::Tensor result = at::empty(
+      at::IntArrayRef(slot.sizes, slot.ndim),
+      at::device(at::Device(at::kCUDA, device_index_)).dtype(scalar_type));
+
+  at::cuda::CUDAGuard device_guard(device_index_);
+  auto stream = at::cuda::getCurrentCUDAStream();
+  const void* src = static_cast<const char*>(device_base_) +
+      (tail % control->num_slots_) * control->slot_bytes_;
+  C10_CUDA_CHECK(cudaMemcpyAsync(
+      result.data_ptr(),
+      src,
+      result.numel() * result.element_size(),
+      cudaMemcpyDeviceToDevice,
+      stream));
+  // The slot may be overwritten as soon as it is released below, so the
+  // copy out of it must have completed first.
+  C10_CUDA_CHECK(cudaStreamSynchronize(stream));
+
+  control->tail_.store(tail + 1, std::memory_order_release);
+  return result;
+}
+
+int64_t CudaIPCRingBuffer::slot_bytes() const {
+  return control_->slot_bytes_;
+}
+
+int64_t CudaIPCRingBuffer::num_slots() const {
+  return control_->num_slots_;
+}
+
+} // namespace multiprocessing
+} // namespace torch
+
+#endif // defined(USE_CUDA) && !defined(_WIN32)
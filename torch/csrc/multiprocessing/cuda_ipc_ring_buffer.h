@@ -0,0 +1,87 @@
+#pragma once
+
+#if defined(USE_CUDA) && !defined(_WIN32)
+
+#include <ATen/ATen.h>
+#include <c10/util/Optional.h>
+
+#include <memory>
+#include <string>
+
+namespace torch {
+namespace multiprocessing {
+
+// NOTE [ CUDA IPC ring buffer ]
+//
+// The regular CUDA tensor sharing path (CudaIPCTypes.cpp, driven by Python
+// multiprocessing reduction) opens an IPC memory handle and allocates a
+// refcounting slot per shared tensor, which dominates the cost of streaming
+// many small tensors between processes on one node. This ring buffer maps
+// everything once instead: the producer cudaMallocs a single device region
+// carved into fixed-size slots and publishes its cudaIpcMemHandle together
+// with the slot metadata and head/tail cursors in a POSIX shared memory
+// segment; the consumer maps both at startup. After that, moving a tensor is
+// a device-to-device copy into (out of) a slot plus one atomic cursor store
+// -- no handle opens, no allocations in the control path.
+//
+// The queue is single-producer/single-consumer: exactly one process may
+// push and exactly one may pop. push() fails (returns false) when the ring
+// is full and pop() returns nullopt when it is empty; callers decide
+// whether to retry, sleep or drop. Tensors are copied through the slots, so
+// the producer may free or overwrite its tensor as soon as push() returns
+// and popped tensors own ordinary caching-allocator storage.
+class CudaIPCRingBuffer {
+ public:
+  // Sizes and strides are stored inline in a slot header.
+  static constexpr int64_t kMaxDims = 8;
+
+  // Creates the ring: allocates the device region on `device`, creates and
+  // maps the shared memory control segment under `name`, which must not
+  // already exist. Each slot holds one tensor of at most slot_bytes bytes.
+  static std::unique_ptr<CudaIPCRingBuffer> producer(
+      const std::string& name,
+      int64_t slot_bytes,
+      int64_t num_slots,
+      at::Device device);
+
+  // Attaches to a ring created by producer() under the same name; maps the
+  // control segment and opens the device region's IPC handle once.
+  static std::unique_ptr<CudaIPCRingBuffer> consumer(const std::string& name);
+
+  ~CudaIPCRingBuffer();
+
+  CudaIPCRingBuffer(const CudaIPCRingBuffer&) = delete;
+  CudaIPCRingBuffer& operator=(const CudaIPCRingBuffer&) = delete;
+
+  // Producer side: copies `tensor` into the next free slot and publishes
+  // it. Returns false without blocking when the ring is full. The tensor
+  // must be a CUDA tensor on the producer device, at most kMaxDims
+  // dimensional and at most slot_bytes bytes (non-contiguous input is
+  // copied to contiguous first).
+  bool push(const at::Tensor& tensor);
+
+  // Consumer side: copies the oldest published slot into a fresh tensor and
+  // releases the slot. Returns nullopt without blocking when the ring is
+  // empty.
+  c10::optional<at::Tensor> pop();
+
+  int64_t slot_bytes() const;
+  int64_t num_slots() const;
+
+ private:
+  struct ControlBlock;
+
+  CudaIPCRingBuffer() = default;
+
+  std::string shm_name_;
+  bool is_producer_ = false;
+  ControlBlock* control_ = nullptr;
+  size_t control_size_ = 0;
+  void* device_base_ = nullptr;
+  int device_index_ = -1;
+};
+
+} // namespace multiprocessing
+} // namespace torch
+
+#endif // defined(USE_CUDA) && !defined(_WIN32)
@@ -1,4 +1,5 @@
 #include <torch/csrc/python_headers.h>
+#include <torch/csrc/multiprocessing/cuda_ipc_ring_buffer.h>
 #include <torch/csrc/utils/object_ptr.h>
 #include <torch/csrc/utils/pybind.h>
 
@@ -34,6 +35,34 @@ PyObject* multiprocessing_init(PyObject* _unused, PyObject *noargs) {
 #endif
   });
 
+#if defined(USE_CUDA) && !defined(_WIN32)
+  // Same-node streaming of CUDA tensors without per-tensor IPC handle
+  // opens; see NOTE [ CUDA IPC ring buffer ].
+  py::class_<CudaIPCRingBuffer>(module, "_CudaIPCRingBuffer")
+      .def_static(
+          "producer",
+          [](const std::string& name,
+             int64_t slot_bytes,
+             int64_t num_slots,
+             int64_t device) {
+            return CudaIPCRingBuffer::producer(
+                name, slot_bytes, num_slots, at::Device(at::kCUDA, device));
+          })
+      .def_static("consumer", &CudaIPCRingBuffer::consumer)
+      .def("push", &CudaIPCRingBuffer::push)
+      .def(
+          "pop",
+          [](CudaIPCRingBuffer& self) -> py::object {
+            auto tensor = self.pop();
+            if (!tensor) {
+              return py::none();
+            }
+            return py::cast(*tensor);
+          })
+      .def("slot_bytes", &CudaIPCRingBuffer::slot_bytes)
+      .def("num_slots", &CudaIPCRingBuffer::num_slots);
+#endif
+
   Py_RETURN_TRUE;
 }
 
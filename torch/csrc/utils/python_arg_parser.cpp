@@ -609,6 +609,12 @@ bool FunctionSignature::parse(PyObject* args, PyObject* kwargs, PyObject* dst[],
   ssize_t arg_pos = 0;
   bool allow_varargs_intlist = false;
 
+  if (remaining_kwargs == 0) {
+    // all-positional calls (the common case for small ops) skip every
+    // keyword lookup below
+    kwargs = nullptr;
+  }
+
   // if there is a single positional IntArrayRef argument, i.e. expand(..), view(...),
   // allow a var-args style IntArrayRef, so expand(5,3) behaves as expand((5,3))
   if (max_pos_args == 1 && params[0].type_ == ParameterType::INT_LIST) {
@@ -627,6 +633,62 @@ bool FunctionSignature::parse(PyObject* args, PyObject* kwargs, PyObject* dst[],
     overloaded_args.clear();
   }
 
+  // Match keyword arguments to parameters up front in a single pass over
+  // the dict. Parameter names are interned at parser construction and
+  // CPython interns keyword names at call sites, so a key usually matches
+  // by pointer identity; the string-equality fallback only runs for keys
+  // built elsewhere (e.g. f(**d) with a computed dict). This avoids one
+  // hashed PyDict_GetItem per parameter per overload attempt.
+  // Keys that match no parameter are left unconsumed and are reported
+  // through the remaining_kwargs check at the end, as before.
+  at::SmallVector<PyObject*, 16> kwarg_values;
+  if (kwargs) {
+    kwarg_values.resize(params.size(), nullptr);
+    PyObject *key, *value;
+    ssize_t pos = 0;
+    while (PyDict_Next(kwargs, &pos, &key, &value)) {
+      bool matched = false;
+      for (size_t j = 0; j < params.size() && !matched; j++) {
+        auto& param = params[j];
+        if (key == param.python_name) {
+          matched = true;
+        } else {
+          for (PyObject* numpy_name : param.numpy_python_names) {
+            if (key == numpy_name) {
+              matched = true;
+              break;
+            }
+          }
+        }
+        if (matched) {
+          kwarg_values[j] = value;
+        }
+      }
+      for (size_t j = 0; j < params.size() && !matched; j++) {
+        auto& param = params[j];
+        int cmp = PyObject_RichCompareBool(key, param.python_name, Py_EQ);
+        if (cmp < 0) {
+          throw python_error();
+        }
+        if (!cmp) {
+          for (PyObject* numpy_name : param.numpy_python_names) {
+            cmp = PyObject_RichCompareBool(key, numpy_name, Py_EQ);
+            if (cmp < 0) {
+              throw python_error();
+            }
+            if (cmp) {
+              break;
+            }
+          }
+        }
+        if (cmp) {
+          matched = true;
+          kwarg_values[j] = value;
+        }
+      }
+    }
+  }
+
   int i = 0;
   for (auto& param : params) {
     PyObject* obj = nullptr;
@@ -641,13 +703,7 @@ bool FunctionSignature::parse(PyObject* args, PyObject* kwargs, PyObject* dst[],
       }
       obj = PyTuple_GET_ITEM(args, arg_pos);
     } else if (kwargs) {
-      obj = PyDict_GetItem(kwargs, param.python_name);
-      for (PyObject *numpy_name: param.numpy_python_names) {
-        if (obj) {
-          break;
-        }
-        obj = PyDict_GetItem(kwargs, numpy_name);
-      }
+      obj = kwarg_values[i];
       is_kwd = true;
     }
 
@@ -357,6 +357,19 @@ def ipc_collect():
     return torch._C._cuda_ipc_collect()
 
 
+def setup_peer_access():
+    r"""Eagerly enables peer-to-peer access between all visible device pairs.
+
+    Cross-device copies normally enable peer access lazily, so the first
+    copy between each pair of GPUs pays the (potentially multi-millisecond)
+    driver enablement cost. Calling this once at startup enables and caches
+    peer access for the whole topology up front, keeping the first training
+    step free of that hiccup.
+    """
+    _lazy_init()
+    torch._C._cuda_setupPeerToPeerAccess()
+
+
 def current_stream(device=None):
     r"""Returns the currently selected :class:`Stream` for a given device.
 
@@ -86,6 +86,31 @@ def empty_cache():
         torch._C._cuda_emptyCache()
 
 
+def host_empty_cache():
+    r"""Releases all unoccupied cached pinned (page-locked) host memory
+    currently held by the caching host allocator used by
+    :meth:`~torch.Tensor.pin_memory`.
+    """
+    if is_initialized():
+        torch._C._cuda_hostEmptyCache()
+
+
+def host_memory_stats():
+    r"""Returns a dictionary of statistics for the caching host allocator
+    used by :meth:`~torch.Tensor.pin_memory`.
+
+    Statistics:
+
+    - ``"num_allocs"``: total pinned allocation requests.
+    - ``"num_cache_hits"``: requests served from a cached block.
+    - ``"inuse_bytes"`` / ``"inuse_blocks"``: memory currently handed out.
+    - ``"cached_bytes"`` / ``"cached_blocks"``: memory held for reuse.
+    """
+    if not is_initialized():
+        return {}
+    return torch._C._cuda_hostMemoryStats()
+
+
 def memory_stats(device=None):
     r"""Returns a dictionary of CUDA memory allocator statistics for a
     given device.
@@ -244,6 +244,16 @@ def export_opnames(m):
     """
     return torch._C._export_opnames(m._c)
 
+def _warmup(mod, example_inputs, method_name='forward'):
+    r"""
+        Compiles ``method_name`` of a script module ahead of time, once for
+        each tuple of example inputs in ``example_inputs``, so the first real
+        calls do not pay graph optimization and kernel compilation costs.
+        Returns the time spent compiling each specialization, in milliseconds.
+    """
+    method = mod._c._get_method(method_name)
+    return [method._warmup(*make_tuple(inputs)) for inputs in example_inputs]
+
 def _get_trace_graph(f, args=(), kwargs=None, _force_outplace=False,
                      return_inputs=False, _return_inputs_states=False):
     """
@@ -334,4 +334,38 @@ void FileStore::wait(
   }
 }
 
+void FileStore::waitForKeyCount(const std::string& prefix, int64_t count) {
+  std::string regPrefix = regularPrefix_ + prefix;
+  const auto start = std::chrono::steady_clock::now();
+  while (true) {
+    {
+      std::unique_lock<std::mutex> l(activeFileOpLock_);
+      File file(path_, O_RDONLY, timeout_);
+      auto lock = file.lockShared();
+      // Only re-parse the file when it grew since the last refresh.
+      if (file.size() != pos_) {
+        pos_ = refresh(file, pos_, cache_);
+      }
+      int64_t numKeys = 0;
+      for (const auto& kv : cache_) {
+        if (kv.first.compare(0, regPrefix.size(), regPrefix) == 0) {
+          numKeys++;
+        }
+      }
+      if (numKeys >= count) {
+        return;
+      }
+    }
+    const auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now() - start);
+    if (timeout_ != kNoTimeout && elapsed > timeout_) {
+      throw std::runtime_error(
+          "Timeout waiting for " + std::to_string(count) +
+          " keys with prefix: " + prefix);
+    }
+    /* sleep override */
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
 } // namespace c10d
@@ -29,6 +29,8 @@ class FileStore : public Store {
       const std::vector<std::string>& keys,
       const std::chrono::milliseconds& timeout) override;
 
+  void waitForKeyCount(const std::string& prefix, int64_t count) override;
+
  protected:
   int64_t addHelper(const std::string& key, int64_t i);
 
@@ -2,6 +2,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <memory>
 #include <mutex>
@@ -17,6 +18,16 @@
 #define ENABLE_NCCL_ERROR_CHECKING
 #endif
 
+// ncclCommSplit() is only available in NCCL versions 2.18+. It lets a
+// subgroup communicator be derived from an existing one without repeating
+// the full bootstrap (unique id exchange, ring discovery).
+#if defined(NCCL_MAJOR) && (NCCL_MAJOR == 2) && defined(NCCL_MINOR) && \
+    (NCCL_MINOR >= 18)
+#define ENABLE_NCCL_COMM_SPLIT
+#elif defined(NCCL_MAJOR) && (NCCL_MAJOR >= 3)
+#define ENABLE_NCCL_COMM_SPLIT
+#endif
+
 // Macro to throw on a non-successful NCCL return value.
 #define C10D_NCCL_CHECK(cmd)                                                 \
   do {                                                                       \
@@ -88,6 +99,27 @@ class NCCLComm {
     return ncclId_;
   }
 
+#ifdef ENABLE_NCCL_COMM_SPLIT
+  // Derives a new communicator from `source` without a fresh bootstrap.
+  // This is a collective over the source communicator: every rank of the
+  // source must call split(), and ranks that should not be part of the
+  // new communicator pass NCCL_SPLIT_NOCOLOR as the color (split() then
+  // returns nullptr for them). `rank` is the caller's rank within the new
+  // communicator.
+  static std::shared_ptr<NCCLComm> split(NCCLComm* source, int color, int rank) {
+    auto comm = std::make_shared<NCCLComm>();
+    C10D_NCCL_CHECK(ncclCommSplit(
+        source->getNcclComm(), color, rank, &(comm->ncclComm_), nullptr));
+    if (color == NCCL_SPLIT_NOCOLOR) {
+      return nullptr;
+    }
+    // Split communicators have no unique id of their own; leave a zeroed
+    // id so that store keys derived from it are at least deterministic.
+    memset(&(comm->ncclId_), 0, sizeof(ncclUniqueId));
+    return comm;
+  }
+#endif
+
   // Must not be copyable
   NCCLComm(const NCCLComm&) = delete;
   NCCLComm& operator=(const NCCLComm&) = delete;
@@ -52,4 +52,8 @@ void PrefixStore::wait(
   store_->wait(joinedKeys, timeout);
 }
 
+void PrefixStore::waitForKeyCount(const std::string& prefix, int64_t count) {
+  store_->waitForKeyCount(joinKey(prefix), count);
+}
+
 } // namespace c10d
@@ -25,6 +25,8 @@ class PrefixStore : public Store {
       const std::vector<std::string>& keys,
       const std::chrono::milliseconds& timeout) override;
 
+  void waitForKeyCount(const std::string& prefix, int64_t count) override;
+
  protected:
   std::string prefix_;
   std::shared_ptr<Store> store_;
@@ -48,12 +48,31 @@ void ProcessGroup::Work::abort() {
   TORCH_CHECK(false, "ProcessGroup::Work::abort not implemented.")
 }
 
+void ProcessGroup::Work::then(std::function<void()> callback) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!completed_) {
+      callbacks_.emplace_back(std::move(callback));
+      return;
+    }
+  }
+  // The work already completed; run inline on the calling thread.
+  callback();
+}
+
 void ProcessGroup::Work::finish(std::exception_ptr exception) {
+  std::vector<std::function<void()>> callbacks;
   std::unique_lock<std::mutex> lock(mutex_);
   completed_ = true;
   exception_ = exception;
+  callbacks.swap(callbacks_);
   lock.unlock();
   cv_.notify_all();
+  // Run continuations outside the lock so they can query this work
+  // (and so a callback registering further work cannot deadlock).
+  for (auto& callback : callbacks) {
+    callback();
+  }
 }
 
 ProcessGroup::ProcessGroup(int rank, int size) : rank_(rank), size_(size) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <condition_variable>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
@@ -87,6 +88,23 @@ class ProcessGroup {
 
     virtual void abort();
 
+    // Registers a continuation that runs exactly once when this work
+    // completes, so "launch collective, then launch dependent work" can be
+    // expressed without blocking a host thread in wait().
+    //
+    // The callback runs on the thread that completes the work (or inline
+    // on the calling thread if the work already completed); it must not
+    // block, should check isSuccess() if it cares about the outcome, and
+    // should call synchronize() itself if it needs the output tensors to
+    // be ordered on its streams (a nop for CPU backends).
+    //
+    // For CUDA-based backends (NCCL) the callback instead runs inline on
+    // the calling thread after the caller's current streams have been made
+    // to wait on the collective's CUDA events; kernels it launches are
+    // sequenced after the collective on the device without any host thread
+    // blocking.
+    virtual void then(std::function<void()> callback);
+
    protected:
     void finish(std::exception_ptr exception = nullptr);
 
@@ -94,6 +112,7 @@ class ProcessGroup {
     std::condition_variable cv_;
     bool completed_ = false;
     std::exception_ptr exception_;
+    std::vector<std::function<void()>> callbacks_;
   };
 
   explicit ProcessGroup(int rank, int size);
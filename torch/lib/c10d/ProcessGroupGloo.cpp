@@ -339,13 +339,13 @@ bool ProcessGroupGloo::SendWork::wait() {
   } catch (...) {
     exception = std::current_exception();
   }
-  // Lock to write completed_ and exception_, and throw if there is an
-  // exception.
-  std::lock_guard<std::mutex> lock(mutex_);
-  completed_ = true;
-  exception_ = exception;
-  if (exception_) {
-    std::rethrow_exception(exception_);
+
+  // Completes the work object and runs any then() continuations. Unlike
+  // AsyncWork, point-to-point work has no worker thread driving it, so
+  // completion (and the continuations) happen on the waiting thread.
+  finish(exception);
+  if (exception) {
+    std::rethrow_exception(exception);
   }
   return sendCompleted;
 }
@@ -372,13 +372,13 @@ bool ProcessGroupGloo::RecvWork::wait() {
   } catch (...) {
     exception = std::current_exception();
   }
-  // Lock to write completed_ and exception_, and throw if there is an
-  // exception.
-  std::lock_guard<std::mutex> lock(mutex_);
-  completed_ = true;
-  exception_ = exception;
-  if (exception_) {
-    std::rethrow_exception(exception_);
+
+  // Completes the work object and runs any then() continuations. Unlike
+  // AsyncWork, point-to-point work has no worker thread driving it, so
+  // completion (and the continuations) happen on the waiting thread.
+  finish(exception);
+  if (exception) {
+    std::rethrow_exception(exception);
   }
   return recvCompleted;
 }
@@ -388,7 +388,39 @@ void ProcessGroupGloo::RecvWork::abort() {
 }
 
 ProcessGroupGloo::Options::Options()
-    : timeout(std::chrono::milliseconds(10 * 1000)), threads(2) {}
+    : timeout(std::chrono::milliseconds(10 * 1000)),
+      threads(2),
+      maxAllreduceSegmentSize(0),
+      busyPollWait(false),
+      busyPollSizeThreshold(64 * 1024) {}
+
+bool ProcessGroupGloo::AsyncWork::wait() {
+  // Busy-poll for completion of latency-critical small collectives; see
+  // Options::busyPollWait. Polling isCompleted() takes an uncontended mutex
+  // per iteration, which doubles as a pause between loads. Once the worker
+  // thread has published completion, the base class wait returns without
+  // blocking and takes care of exception rethrow and synchronization.
+  if (busyPollWait_) {
+    while (!isCompleted()) {
+    }
+  }
+  return ProcessGroup::Work::wait();
+}
+
+namespace {
+
+// Total payload of a collective, used together with
+// Options::busyPollSizeThreshold to decide between busy-poll and blocking
+// completion waits.
+size_t tensorBytes(const std::vector<at::Tensor>& tensors) {
+  size_t bytes = 0;
+  for (const auto& tensor : tensors) {
+    bytes += tensor.numel() * tensor.element_size();
+  }
+  return bytes;
+}
+
+} // namespace
 
 namespace {
 
@@ -506,6 +538,9 @@ ProcessGroupGloo::ProcessGroupGloo(
     : ProcessGroup(rank, size),
       store_(new GlooStore(store)),
       stop_(false),
+      maxAllreduceSegmentSize_(options.maxAllreduceSegmentSize),
+      busyPollWait_(options.busyPollWait),
+      busyPollSizeThreshold_(options.busyPollSizeThreshold),
       collectiveCounter_(0) {
   auto& devices = options.devices;
   if (devices.empty()) {
@@ -595,7 +630,10 @@ void ProcessGroupGloo::runLoop(int workerIndex) {
   }
 }
 
-void ProcessGroupGloo::enqueue(std::shared_ptr<AsyncWork> work) {
+void ProcessGroupGloo::enqueue(std::shared_ptr<AsyncWork> work, size_t bytes) {
+  // Small collectives busy-poll for completion, larger ones fall back to
+  // the blocking condition-variable wait; see Options::busyPollWait.
+  work->busyPollWait_ = busyPollWait_ && bytes <= busyPollSizeThreshold_;
   std::unique_lock<std::mutex> lock(workMutex_);
   workQueue_.push_back(std::move(work));
   lock.unlock();
@@ -748,7 +786,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::broadcast(
     throw std::runtime_error("Invalid backend");
   }
 
-  enqueue(work);
+  enqueue(work, tensorBytes(inputs));
   return work;
 }
 
@@ -760,19 +798,31 @@ class AsyncAllreduceWork : public ProcessGroupGloo::AsyncWork {
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       ReduceOp reduceOp,
-      uint32_t tag)
-      : context(context), inputs(inputs), reduceOp(reduceOp), tag(tag) {}
+      uint32_t tag,
+      size_t maxSegmentSize)
+      : context(context),
+        inputs(inputs),
+        reduceOp(reduceOp),
+        tag(tag),
+        maxSegmentSize(maxSegmentSize) {}
 
   std::shared_ptr<gloo::Context> context;
   std::vector<at::Tensor> inputs;
   const ReduceOp reduceOp;
   const uint32_t tag;
+  const size_t maxSegmentSize;
 
   void allreduce(std::vector<at::Tensor>& tensors) {
     const auto& scalarType = tensors[0].scalar_type();
     gloo::AllreduceOptions opts(context);
     opts.setReduceFunction(getFunction(scalarType, reduceOp));
     opts.setTag(tag);
+    // Capping the segment size makes Gloo's ring algorithm split a large
+    // tensor into multiple segments that are pipelined through the ring,
+    // overlapping local reduction with network transfer.
+    if (maxSegmentSize > 0) {
+      opts.setMaxSegmentSize(maxSegmentSize);
+    }
     GENERATE_ALL_TYPES(scalarType, setOutputs, opts, tensors);
     gloo::allreduce(opts);
   }
@@ -809,8 +859,9 @@ class AsyncAllreduceCoalescedWork : public AsyncAllreduceWork {
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       ReduceOp reduceOp,
-      uint32_t tag)
-      : AsyncAllreduceWork(context, inputs, reduceOp, tag) {}
+      uint32_t tag,
+      size_t maxSegmentSize)
+      : AsyncAllreduceWork(context, inputs, reduceOp, tag, maxSegmentSize) {}
 
   void run() override {
     allreduceCoalesced(inputs);
@@ -1118,8 +1169,9 @@ class AsyncAllreduceCUDAWork : public AsyncAllreduceWork {
       const std::shared_ptr<gloo::Context>& context,
       std::vector<at::Tensor>& inputs,
       ReduceOp reduceOp,
-      uint32_t tag)
-      : AsyncAllreduceWork(context, inputs, reduceOp, tag) {
+      uint32_t tag,
+      size_t maxSegmentSize)
+      : AsyncAllreduceWork(context, inputs, reduceOp, tag, maxSegmentSize) {
     initializeStreamsEvents(inputs, streams, events);
 
     // Kick off copy from CUDA tensors to pinned CPU tensors.
@@ -1269,7 +1321,11 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce(
   if (device.type() == at::kCPU) {
     if (layout == c10::kStrided) {
       work = std::make_shared<AsyncAllreduceWork>(
-          std::move(context), inputs, opts.reduceOp, tag);
+          std::move(context),
+          inputs,
+          opts.reduceOp,
+          tag,
+          maxAllreduceSegmentSize_);
     } else if (layout == c10::kSparse) {
       work = std::make_shared<AsyncSparseAllreduceWork>(
           std::move(context), inputs, tag);
@@ -1280,7 +1336,11 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce(
   } else if (device.type() == at::kCUDA) {
     if (layout == c10::kStrided) {
       work = std::make_shared<AsyncAllreduceCUDAWork>(
-          std::move(context), inputs, opts.reduceOp, tag);
+          std::move(context),
+          inputs,
+          opts.reduceOp,
+          tag,
+          maxAllreduceSegmentSize_);
     } else if (layout == c10::kSparse) {
       work = std::make_shared<AsyncSparseAllreduceCUDAWork>(
           std::move(context), inputs, tag);
@@ -1292,7 +1352,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce(
     throw std::runtime_error("Invalid backend");
   }
 
-  enqueue(work);
+  enqueue(work, tensorBytes(inputs));
   return work;
 }
 
@@ -1345,14 +1405,18 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::allreduce_coalesced(
   if (device.type() == c10::kCPU) {
     if (layout == c10::kStrided) {
       work = std::make_shared<AsyncAllreduceCoalescedWork>(
-          std::move(context), tensors, opts.reduceOp, tag);
+          std::move(context),
+          tensors,
+          opts.reduceOp,
+          tag,
+          maxAllreduceSegmentSize_);
     } else {
       invalidArgument("unsupported layout");
     }
   } else {
     throw std::runtime_error("Invalid backend");
   }
-  enqueue(work);
+  enqueue(work, tensorBytes(tensors));
   return work;
 }
 
@@ -1518,7 +1582,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::reduce(
   } else {
     throw std::runtime_error("Invalid backend");
   }
-  enqueue(work);
+  enqueue(work, tensorBytes(inputs));
   return work;
 }
 
@@ -1715,7 +1779,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::allgather(
   } else {
     throw std::runtime_error("Invalid backend");
   }
-  enqueue(work);
+  enqueue(work, tensorBytes(inputs));
   return work;
 }
 
@@ -1835,7 +1899,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::allgather_coalesced(
   auto context = getContext(tag);
   auto work = std::make_shared<AsyncAllgatherCoalescedWork>(
       std::move(context), output_lists, input_list, tag);
-  enqueue(work);
+  enqueue(work, tensorBytes(input_list));
   return work;
 }
 
@@ -2047,7 +2111,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::gather(
   } else {
     throw std::runtime_error("Invalid backend");
   }
-  enqueue(work);
+  enqueue(work, tensorBytes(inputs));
   return work;
 }
 
@@ -2233,7 +2297,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::scatter(
   } else {
     throw std::runtime_error("Invalid backend");
   }
-  enqueue(work);
+  enqueue(work, tensorBytes(outputs));
   return work;
 }
 
@@ -2380,7 +2444,7 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupGloo::barrier(
   auto context = getContext(tag);
   auto work = std::make_shared<AsyncBarrierWork>(
       std::move(context), std::move(priorWork), tag);
-  enqueue(work);
+  enqueue(work, 0);
   return work;
 }
 
@@ -0,0 +1,194 @@
+#include <c10d/ProcessGroupHierarchical.hpp>
+
+#include <c10d/Utils.hpp>
+
+namespace c10d {
+
+ProcessGroupHierarchical::ProcessGroupHierarchical(
+    int rank,
+    int size,
+    std::shared_ptr<ProcessGroup> intraGroup,
+    std::shared_ptr<ProcessGroup> interGroup)
+    : ProcessGroup(rank, size),
+      intraGroup_(std::move(intraGroup)),
+      interGroup_(std::move(interGroup)) {
+  TORCH_CHECK(intraGroup_ != nullptr && interGroup_ != nullptr);
+  TORCH_CHECK(
+      intraGroup_->getSize() * interGroup_->getSize() == size_,
+      "Intra- and inter-node group sizes must multiply to the global size");
+  // Verify the block rank layout the hierarchical steps rely on.
+  TORCH_CHECK(
+      interGroup_->getRank() * intraGroup_->getSize() +
+              intraGroup_->getRank() ==
+          rank_,
+      "Global rank must equal node * intraSize + localRank");
+}
+
+ProcessGroupHierarchical::~ProcessGroupHierarchical() {}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::broadcast(
+    std::vector<at::Tensor>& tensors,
+    const BroadcastOptions& opts) {
+  const auto intraSize = intraGroup_->getSize();
+  const auto rootNode = opts.rootRank / intraSize;
+  const auto rootLocal = opts.rootRank % intraSize;
+
+  // The ranks sharing the root's local index forward across nodes first,
+  // then every node broadcasts from its local copy.
+  if (intraGroup_->getRank() == rootLocal && interGroup_->getSize() > 1) {
+    BroadcastOptions interOpts;
+    interOpts.rootRank = rootNode;
+    interOpts.rootTensor = opts.rootTensor;
+    interGroup_->broadcast(tensors, interOpts)->wait();
+  }
+  BroadcastOptions intraOpts;
+  intraOpts.rootRank = rootLocal;
+  intraOpts.rootTensor = opts.rootTensor;
+  return intraGroup_->broadcast(tensors, intraOpts);
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::allreduce(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  if (tensors.size() != 1) {
+    throw std::runtime_error(
+        "ProcessGroupHierarchical only supports a single tensor per rank");
+  }
+  const auto intraSize = intraGroup_->getSize();
+  if (intraSize == 1) {
+    return interGroup_->allreduce(tensors, opts);
+  }
+  if (interGroup_->getSize() == 1) {
+    return intraGroup_->allreduce(tensors, opts);
+  }
+
+  auto& tensor = tensors[0];
+  const auto numel = tensor.numel();
+  const auto shardSize = (numel + intraSize - 1) / intraSize;
+
+  // Pad the flattened tensor so it splits into equal shards; the padding
+  // reduces along with the payload and is dropped on the way back out.
+  at::Tensor buffer = at::zeros({shardSize * intraSize}, tensor.options());
+  buffer.narrow(0, 0, numel).copy_(tensor.reshape({numel}));
+  std::vector<at::Tensor> shard = {at::empty({shardSize}, tensor.options())};
+  std::vector<std::vector<at::Tensor>> chunks = {buffer.chunk(intraSize)};
+
+  // Each wait() orders the next step behind the previous one; for CUDA
+  // process groups it blocks the current stream rather than the host, so
+  // the three steps pipeline on the GPU.
+  ReduceScatterOptions reduceScatterOpts;
+  reduceScatterOpts.reduceOp = opts.reduceOp;
+  intraGroup_->reduce_scatter(shard, chunks, reduceScatterOpts)->wait();
+
+  AllreduceOptions allreduceOpts;
+  allreduceOpts.reduceOp = opts.reduceOp;
+  interGroup_->allreduce(shard, allreduceOpts)->wait();
+
+  auto work = intraGroup_->allgather(chunks, shard);
+  work->wait();
+  tensor.copy_(buffer.narrow(0, 0, numel).reshape(tensor.sizes()));
+  return work;
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::
+    allreduce_coalesced(
+        std::vector<at::Tensor>& tensors,
+        const AllreduceCoalescedOptions& opts) {
+  if (tensors.empty()) {
+    throw std::runtime_error("Tensor list must be nonempty");
+  }
+  std::vector<at::Tensor> flat = {flattenDenseTensors(tensors)};
+  AllreduceOptions allreduceOpts;
+  allreduceOpts.reduceOp = opts.reduceOp;
+  auto work = allreduce(flat, allreduceOpts);
+  int64_t offset = 0;
+  for (auto& t : tensors) {
+    t.copy_(flat[0].narrow(0, offset, t.numel()).view(t.sizes()));
+    offset += t.numel();
+  }
+  return work;
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::reduce(
+    std::vector<at::Tensor>& /* unused */,
+    const ReduceOptions& /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support reduce");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::allgather(
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    std::vector<at::Tensor>& /* unused */,
+    const AllgatherOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support allgather");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::allgather_base(
+    at::Tensor& /* unused */,
+    at::Tensor& /* unused */,
+    const AllgatherOptions& /* unused */) {
+  throw std::runtime_error(
+      "no support for allgather_base in Hierarchical process group");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::
+    allgather_coalesced(
+        std::vector<std::vector<at::Tensor>>& /* unused */,
+        std::vector<at::Tensor>& /* unused */,
+        const AllgatherOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support allgather_coalesced");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::gather(
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    std::vector<at::Tensor>& /* unused */,
+    const GatherOptions& /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support gather");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::scatter(
+    std::vector<at::Tensor>& /* unused */,
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    const ScatterOptions& /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support scatter");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::reduce_scatter(
+    std::vector<at::Tensor>& /* unused */,
+    std::vector<std::vector<at::Tensor>>& /* unused */,
+    const ReduceScatterOptions& /* unused */) {
+  throw std::runtime_error(
+      "ProcessGroupHierarchical does not support reduce_scatter");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::send(
+    std::vector<at::Tensor>& /* unused */,
+    int /* unused */,
+    int /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support send");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::recv(
+    std::vector<at::Tensor>& /* unused */,
+    int /* unused */,
+    int /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support recv");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::recvAnysource(
+    std::vector<at::Tensor>& /* unused */,
+    int /* unused */) {
+  throw std::runtime_error("ProcessGroupHierarchical does not support recv");
+}
+
+std::shared_ptr<ProcessGroup::Work> ProcessGroupHierarchical::barrier(
+    const BarrierOptions& opts) {
+  // inter then intra gives a global barrier: a rank only leaves the intra
+  // barrier after its node peers left their inter barriers, which in turn
+  // requires every rank to have entered.
+  interGroup_->barrier(opts)->wait();
+  return intraGroup_->barrier(opts);
+}
+
+} // namespace c10d
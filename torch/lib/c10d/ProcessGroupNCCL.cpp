@@ -1,5 +1,6 @@
 #include <c10d/ProcessGroupNCCL.hpp>
 
+#include <algorithm>
 #include <map>
 #include <tuple>
 #include <unordered_set>
@@ -126,11 +127,18 @@ std::string getNcclAbortedCommStoreKey(const std::string ncclIdStr) {
   return std::string(kNCCLAbortedCommStoreKey) + ":" + ncclIdStr;
 }
 
+std::string getDesyncStoreKey(uint64_t seq, int rank) {
+  return std::string("NCCLDESYNC:") + std::to_string(seq) + ":" +
+      std::to_string(rank);
+}
+
 } // namespace
 
 const int64_t ProcessGroupNCCL::kWatchdogThreadSleepMillis = 10000;
 constexpr int64_t kWaitForAbortCommStoreKey = 1000;
 constexpr int64_t kSynchronizeBusyWaitMillis = 10;
+constexpr int64_t kTimingHistogramBuckets = 16;
+constexpr uint64_t kDesyncSampleInterval = 16;
 const int64_t ProcessGroupNCCL::kProcessGroupNCCLOpTimeoutMillis = 10 * 1000;
 
 ProcessGroupNCCL::WorkNCCL::WorkNCCL(const std::vector<at::Device>& devices)
@@ -253,6 +261,21 @@ bool ProcessGroupNCCL::WorkNCCL::wait() {
   return true;
 }
 
+// The NCCL collective was already enqueued on its own stream when this work
+// was returned, so completion ordering can be delegated to the device: block
+// the caller's current streams on the collective's events and run the
+// callback immediately. Anything the callback launches on those streams is
+// then sequenced after the collective without a waiter thread.
+void ProcessGroupNCCL::WorkNCCL::then(std::function<void()> callback) {
+  checkAndThrowException();
+  for (size_t i = 0; i < devices_.size(); ++i) {
+    auto currentStream = at::cuda::getCurrentCUDAStream(devices_[i].index());
+    // Block the current stream on the NCCL stream
+    cudaEvents_[i].block(currentStream);
+  }
+  callback();
+}
+
 void ProcessGroupNCCL::WorkNCCL::abort() {
   TORCH_CHECK(false, "ProcessGroupNCCL::WorkNCCL::abort not implemented.");
 }
@@ -286,13 +309,62 @@ ProcessGroupNCCL::ProcessGroupNCCL(
         std::string(NCCL_BLOCKING_WAIT));
   }
 
+  char* collectiveTiming = getenv(NCCL_COLLECTIVE_TIMING);
+  if (collectiveTiming != nullptr) {
+    try {
+      collectiveTiming_ = std::stoi(collectiveTiming) != 0;
+    } catch (std::exception& e) {
+      throw std::runtime_error(
+          "Invalid value for environment variable: " +
+          std::string(NCCL_COLLECTIVE_TIMING));
+    }
+  }
+
+  char* desyncThreshold = getenv(NCCL_DESYNC_THRESHOLD_MS);
+  if (desyncThreshold != nullptr) {
+    try {
+      desyncThresholdMs_ = std::stoi(desyncThreshold);
+    } catch (std::exception& e) {
+      throw std::runtime_error(
+          "Invalid value for environment variable: " +
+          std::string(NCCL_DESYNC_THRESHOLD_MS));
+    }
+  }
+
+  timingStats_.histogram.assign(kTimingHistogramBuckets, 0);
+
 #ifdef ENABLE_NCCL_ERROR_CHECKING
   ncclCommWatchdogThread_ =
       std::thread(&ProcessGroupNCCL::ncclCommWatchdog, this);
 #endif
+
+  char* eagerInit = getenv(NCCL_EAGER_INIT);
+  if (eagerInit != nullptr) {
+    bool eager = false;
+    try {
+      eager = std::stoi(eagerInit) != 0;
+    } catch (std::exception& e) {
+      throw std::runtime_error(
+          "Invalid value for environment variable: " +
+          std::string(NCCL_EAGER_INIT));
+    }
+    if (eager && at::cuda::getNumGPUs() > 0) {
+      // Bootstrap the communicator for the current device on a background
+      // thread so that rendezvous overlaps with model construction instead
+      // of being paid inside the first collective. If the first collective
+      // arrives before the bootstrap finishes, getNCCLComm serializes on
+      // commCreateMutex_ and simply waits for it.
+      const auto deviceIndex = at::cuda::current_device();
+      eagerInitThread_ =
+          std::thread(&ProcessGroupNCCL::eagerInitComms, this, deviceIndex);
+    }
+  }
 }
 
 ProcessGroupNCCL::~ProcessGroupNCCL() {
+  if (eagerInitThread_.joinable()) {
+    eagerInitThread_.join();
+  }
   terminateWatchdog_.store(true);
   watchdogCV_.notify_one();
 #ifdef ENABLE_NCCL_ERROR_CHECKING
@@ -300,6 +372,18 @@ ProcessGroupNCCL::~ProcessGroupNCCL() {
 #endif
 }
 
+void ProcessGroupNCCL::eagerInitComms(at::DeviceIndex deviceIndex) {
+  std::vector<at::Device> devices = {
+      at::Device(at::DeviceType::CUDA, deviceIndex)};
+  try {
+    getNCCLComm(getKeyFromDevices(devices), devices);
+  } catch (std::exception& e) {
+    // Leave the cache untouched; the first collective retries the
+    // bootstrap and surfaces the error on the user's thread.
+    LOG(INFO) << "NCCL eager initialization failed: " << e.what();
+  }
+}
+
 void ProcessGroupNCCL::ncclCommWatchdog() {
   try {
     ncclCommWatchdogInternal();
@@ -477,6 +561,20 @@ std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getNCCLComm(
     }
   }
 
+  // Serialize communicator creation: the eager init thread and the first
+  // collective may race here, and concurrent rendezvous through the store
+  // would desynchronize ncclCommCounter_ across ranks.
+  std::lock_guard<std::mutex> createLock(commCreateMutex_);
+
+  {
+    // Re-check the cache; another thread may have finished the bootstrap
+    // while we waited for the creation lock.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (devNCCLCommMap_.find(devicesKey) != devNCCLCommMap_.end()) {
+      return devNCCLCommMap_[devicesKey];
+    }
+  }
+
   // NCCL communicator not cached, create a new entry
   std::vector<std::shared_ptr<NCCLComm>> ncclComms;
   ncclComms.resize(devices.size());
@@ -535,6 +633,59 @@ std::vector<std::shared_ptr<NCCLComm>>& ProcessGroupNCCL::getNCCLComm(
   return devNCCLCommMap_[devicesKey];
 }
 
+std::shared_ptr<ProcessGroupNCCL> ProcessGroupNCCL::split(
+    const std::shared_ptr<Store>& store,
+    const std::vector<int>& ranks) {
+  auto it = std::find(ranks.begin(), ranks.end(), rank_);
+  const bool inGroup = it != ranks.end();
+  const int groupRank = inGroup ? it - ranks.begin() : -1;
+
+#ifdef ENABLE_NCCL_COMM_SPLIT
+  // Derive the subgroup communicator from this group's communicator for
+  // the current device, reusing the parent bootstrap. This is collective
+  // over the parent communicator, so ranks outside the subgroup take part
+  // in the split as well (with NCCL_SPLIT_NOCOLOR) before returning.
+  std::vector<at::Device> devices = {
+      at::Device(at::DeviceType::CUDA, at::cuda::current_device())};
+  const auto key = getKeyFromDevices(devices);
+  auto& parentComms = getNCCLComm(key, devices);
+
+  const int color = inGroup ? 0 : NCCL_SPLIT_NOCOLOR;
+  auto splitComm = NCCLComm::split(parentComms[0].get(), color, groupRank);
+  if (!inGroup) {
+    return nullptr;
+  }
+
+  auto pg = std::make_shared<ProcessGroupNCCL>(
+      store, groupRank, static_cast<int>(ranks.size()), opTimeout_);
+
+  // Seed the subgroup's cache with the derived communicator so its first
+  // collective on the current device skips the bootstrap entirely.
+  std::vector<std::shared_ptr<NCCLComm>> splitComms = {std::move(splitComm)};
+  std::vector<at::cuda::CUDAStream> streamVal;
+  streamVal.push_back(at::cuda::getStreamFromPool());
+  pg->ncclStreams_.emplace(key, std::move(streamVal));
+  pg->ncclEvents_.emplace(
+      std::piecewise_construct, std::make_tuple(key), std::make_tuple(1));
+  {
+    std::lock_guard<std::mutex> lock(pg->mutex_);
+    pg->ncclIdToCommMap_.emplace(
+        buildNcclUniqueIdStr(splitComms[0]->getNcclId()), splitComms);
+    pg->devNCCLCommMap_.emplace(key, std::move(splitComms));
+  }
+  pg->usedDeviceIdxs_.insert(devices[0].index());
+  return pg;
+#else
+  // Without ncclCommSplit support the subgroup bootstraps lazily through
+  // the store like any other process group.
+  if (!inGroup) {
+    return nullptr;
+  }
+  return std::make_shared<ProcessGroupNCCL>(
+      store, groupRank, static_cast<int>(ranks.size()), opTimeout_);
+#endif
+}
+
 namespace {
 
 // Check that all `tensors' have the same type and shape and are distributed
@@ -640,6 +791,16 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::collective(
   // Work itself will create the CUDA events on all GPUs of tensors
   auto work = initWork(devices);
 
+  if (collectiveTiming_) {
+    // The default events carry cudaEventDisableTiming (see getNCCLComm),
+    // so recreate both ends of each pair with timing enabled.
+    work->cudaStartEvents_.reserve(devices.size());
+    for (size_t i = 0; i < devices.size(); ++i) {
+      work->cudaStartEvents_.emplace_back(cudaEventDefault);
+      work->cudaEvents_[i] = at::cuda::CUDAEvent(cudaEventDefault);
+    }
+  }
+
   at::cuda::OptionalCUDAGuard gpuGuard;
 
   pre(ncclStreams_[key]);
@@ -660,6 +821,12 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::collective(
         inputs[i].storage().data_ptr(), ncclStream);
   }
 
+  if (collectiveTiming_) {
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      work->cudaStartEvents_[i].record(ncclStreams_[key][i]);
+    }
+  }
+
   {
     AutoNcclGroup nccl_group_guard;
     for (size_t i = 0; i < inputs.size(); ++i) {
@@ -682,6 +849,18 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::collective(
     work->store_ = store_;
   }
 
+  if (collectiveTiming_ || desyncThresholdMs_ > 0) {
+    std::lock_guard<std::mutex> lock(timingMutex_);
+    ++collectiveSeq_;
+    if (collectiveTiming_) {
+      collectFinishedTimings();
+      pendingTimedWorks_.push_back(work);
+    }
+    if (desyncThresholdMs_ > 0) {
+      checkDesync();
+    }
+  }
+
   return work;
 }
 
@@ -698,6 +877,106 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::collective(
       [](std::vector<at::cuda::CUDAStream>&) {});
 }
 
+void ProcessGroupNCCL::collectFinishedTimings() {
+  auto it = pendingTimedWorks_.begin();
+  while (it != pendingTimedWorks_.end()) {
+    auto& work = *it;
+    if (!work->finishedGPUExecutionInternal()) {
+      ++it;
+      continue;
+    }
+    // The collective's GPU time is the slowest of its per-device kernels.
+    float elapsedMs = 0;
+    for (size_t i = 0; i < work->devices_.size(); ++i) {
+      elapsedMs = std::max(
+          elapsedMs,
+          work->cudaStartEvents_[i].elapsed_time(work->cudaEvents_[i]));
+    }
+    size_t bucket = 0;
+    while (bucket + 1 < timingStats_.histogram.size() &&
+           elapsedMs >= static_cast<float>(int64_t(1) << bucket)) {
+      ++bucket;
+    }
+    timingStats_.histogram[bucket]++;
+    timingStats_.count++;
+    timingStats_.totalMs += elapsedMs;
+    timingStats_.maxMs = std::max(timingStats_.maxMs, double(elapsedMs));
+    it = pendingTimedWorks_.erase(it);
+  }
+}
+
+ProcessGroupNCCL::CollectiveTimingStats ProcessGroupNCCL::
+    getCollectiveTimingStats() {
+  std::lock_guard<std::mutex> lock(timingMutex_);
+  collectFinishedTimings();
+  return timingStats_;
+}
+
+// NOTE [ NCCL desync detection ]
+//
+// When one rank straggles, every other rank stalls inside the collective
+// with no indication of who was late. To find the straggler, every
+// kDesyncSampleInterval-th collective is sampled: each rank publishes the
+// wall-clock time at which it entered the collective to the store, and
+// rank 0 scores a sample once all ranks have reported, warning about any
+// rank whose entry time lagged the median by more than the configured
+// threshold. Rank 0 only scores the sample one full interval after taking
+// it and skips it if some rank still has not reported -- so no rank ever
+// blocks on the store in the collective path; a rank missing at scoring
+// time is itself reported, since it is at least a full interval behind.
+// Comparing wall-clock times across hosts assumes the cluster keeps its
+// clocks in sync (e.g. via NTP), which holds far more tightly than the
+// thresholds of interest here.
+void ProcessGroupNCCL::checkDesync() {
+  if (collectiveSeq_ % kDesyncSampleInterval != 0) {
+    return;
+  }
+  const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::system_clock::now().time_since_epoch())
+                            .count();
+  const std::string now = std::to_string(nowMs);
+  store_->set(
+      getDesyncStoreKey(collectiveSeq_, rank_),
+      std::vector<uint8_t>(now.begin(), now.end()));
+
+  if (rank_ != 0 || collectiveSeq_ < 2 * kDesyncSampleInterval) {
+    return;
+  }
+  const uint64_t prevSeq = collectiveSeq_ - kDesyncSampleInterval;
+  std::vector<std::string> keys;
+  keys.reserve(size_);
+  for (int r = 0; r < size_; ++r) {
+    keys.push_back(getDesyncStoreKey(prevSeq, r));
+  }
+  std::vector<int64_t> entryTimes;
+  entryTimes.reserve(size_);
+  for (int r = 0; r < size_; ++r) {
+    if (!store_->check({keys[r]})) {
+      LOG(WARNING) << "Desync detector: rank " << r
+                   << " has not reached collective #" << prevSeq
+                   << " while rank 0 is at collective #" << collectiveSeq_;
+      return;
+    }
+    auto value = store_->get(keys[r]);
+    entryTimes.push_back(
+        std::stoll(std::string(value.begin(), value.end())));
+  }
+  std::vector<int64_t> sorted = entryTimes;
+  std::nth_element(
+      sorted.begin(), sorted.begin() + sorted.size() / 2, sorted.end());
+  const int64_t median = sorted[sorted.size() / 2];
+  for (int r = 0; r < size_; ++r) {
+    const int64_t lagMs = entryTimes[r] - median;
+    if (lagMs > desyncThresholdMs_) {
+      LOG(WARNING) << "Desync detector: rank " << r
+                   << " entered collective #" << prevSeq << " " << lagMs
+                   << "ms after the median rank (threshold "
+                   << desyncThresholdMs_ << "ms, set via "
+                   << NCCL_DESYNC_THRESHOLD_MS << ")";
+    }
+  }
+}
+
 std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce(
     std::vector<at::Tensor>& tensors,
     const AllreduceOptions& opts) {
@@ -724,8 +1003,57 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce(
 std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allreduce_coalesced(
     std::vector<at::Tensor>& tensors,
     const AllreduceCoalescedOptions& opts) {
-  throw std::runtime_error(
-      "allreduce_coalesced is currently not supported with NCCL");
+  if (tensors.empty()) {
+    throw std::runtime_error("Tensor list must be nonempty");
+  }
+  // The tensors are packed into a single flat buffer and reduced with one
+  // NCCL call, so they must share a device, type and a dense layout.
+  const auto& first = tensors.front();
+  for (const auto& t : tensors) {
+    if (!t.is_cuda() || t.is_sparse()) {
+      throw std::runtime_error("Tensors must be CUDA and dense");
+    }
+    if (t.device() != first.device()) {
+      throw std::runtime_error(
+          "Tensors to coalesce must all reside on the same device");
+    }
+    if (t.scalar_type() != first.scalar_type()) {
+      throw std::runtime_error(
+          "Tensors to coalesce must all have the same type");
+    }
+  }
+
+  std::vector<at::Tensor> flat = {flattenDenseTensors(tensors)};
+
+  return collective(
+      flat,
+      flat,
+      [&](at::Tensor& input,
+          at::Tensor& output,
+          ncclComm_t comm,
+          at::cuda::CUDAStream& stream) {
+        return ncclAllReduce(
+            input.data_ptr(),
+            output.data_ptr(),
+            input.numel(),
+            getNcclDataType(input.scalar_type()),
+            ncclOp[opts.reduceOp],
+            comm,
+            stream.stream());
+      },
+      [&](std::vector<at::cuda::CUDAStream>& ncclStreams) {},
+      [&](std::vector<at::cuda::CUDAStream>& ncclStreams) {
+        // Scatter the reduced flat buffer back into the caller's tensors.
+        at::cuda::CUDAStreamGuard guard(ncclStreams[0]);
+        int64_t offset = 0;
+        for (auto& t : tensors) {
+          // See [Sync Streams].
+          c10::cuda::CUDACachingAllocator::recordStream(
+              t.storage().data_ptr(), ncclStreams[0]);
+          t.copy_(flat[0].narrow(0, offset, t.numel()).view(t.sizes()), true);
+          offset += t.numel();
+        }
+      });
 }
 
 std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::broadcast(
@@ -820,11 +1148,77 @@ std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allgather(
 }
 
 std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::allgather_coalesced(
-    std::vector<std::vector<at::Tensor>>& /* unused */,
-    std::vector<at::Tensor>& /* unused */,
+    std::vector<std::vector<at::Tensor>>& outputTensorLists,
+    std::vector<at::Tensor>& inputTensors,
     const AllgatherOptions& /* unused */) {
-  throw std::runtime_error(
-      "ProcessGroupNCCL does not support allgather_coalesced");
+  if (inputTensors.empty()) {
+    throw std::runtime_error("Tensor list must be nonempty");
+  }
+  if (outputTensorLists.size() != static_cast<size_t>(size_)) {
+    throw std::runtime_error("Output lists should be equal to world size");
+  }
+  // Same packing requirements as allreduce_coalesced: one flat buffer, one
+  // NCCL call.
+  const auto& first = inputTensors.front();
+  for (const auto& t : inputTensors) {
+    if (!t.is_cuda() || t.is_sparse()) {
+      throw std::runtime_error("Tensors must be CUDA and dense");
+    }
+    if (t.device() != first.device()) {
+      throw std::runtime_error(
+          "Tensors to coalesce must all reside on the same device");
+    }
+    if (t.scalar_type() != first.scalar_type()) {
+      throw std::runtime_error(
+          "Tensors to coalesce must all have the same type");
+    }
+  }
+  for (const auto& outputs : outputTensorLists) {
+    if (outputs.size() != inputTensors.size()) {
+      throw std::runtime_error(
+          "Each output list must have the same length as the input list");
+    }
+  }
+
+  std::vector<at::Tensor> flatInput = {flattenDenseTensors(inputTensors)};
+  // rank-major flat output covering all ranks' inputs
+  std::vector<at::Tensor> flatOutput = {
+      at::empty({flatInput[0].numel() * size_}, flatInput[0].options())};
+
+  return collective(
+      flatInput,
+      flatOutput,
+      [&](at::Tensor& input,
+          at::Tensor& output,
+          ncclComm_t comm,
+          at::cuda::CUDAStream& stream) {
+        c10::cuda::CUDACachingAllocator::recordStream(
+            output.storage().data_ptr(), stream);
+        return ncclAllGather(
+            input.data_ptr(),
+            output.data_ptr(),
+            input.numel(),
+            getNcclDataType(input.scalar_type()),
+            comm,
+            stream.stream());
+      },
+      [&](std::vector<at::cuda::CUDAStream>& ncclStreams) {},
+      [&](std::vector<at::cuda::CUDAStream>& ncclStreams) {
+        // Unpack the rank-major flat output into the output lists.
+        at::cuda::CUDAStreamGuard guard(ncclStreams[0]);
+        int64_t offset = 0;
+        for (auto& outputs : outputTensorLists) {
+          for (auto& t : outputs) {
+            // See [Sync Streams].
+            c10::cuda::CUDACachingAllocator::recordStream(
+                t.storage().data_ptr(), ncclStreams[0]);
+            t.copy_(
+                flatOutput[0].narrow(0, offset, t.numel()).view(t.sizes()),
+                true);
+            offset += t.numel();
+          }
+        }
+      });
 }
 
 std::shared_ptr<ProcessGroup::Work> ProcessGroupNCCL::reduce_scatter(
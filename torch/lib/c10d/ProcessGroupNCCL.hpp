@@ -17,6 +17,24 @@ namespace c10d {
 // non-blocking.
 constexpr const char* NCCL_BLOCKING_WAIT = "NCCL_BLOCKING_WAIT";
 
+// Environment variable which enables per-collective GPU timing capture;
+// see ProcessGroupNCCL::getCollectiveTimingStats().
+constexpr const char* NCCL_COLLECTIVE_TIMING = "NCCL_COLLECTIVE_TIMING";
+
+// Environment variable holding the desync detector threshold in
+// milliseconds; unset or non-positive disables the detector. See
+// NOTE [ NCCL desync detection ] in ProcessGroupNCCL.cpp.
+constexpr const char* NCCL_DESYNC_THRESHOLD_MS = "NCCL_DESYNC_THRESHOLD_MS";
+
+// Environment variable which enables eager communicator initialization.
+// When set, the constructor kicks off the NCCL bootstrap for the current
+// CUDA device on a background thread, so that rendezvous and ring
+// discovery overlap with whatever the trainer does between creating the
+// process group and issuing its first collective (typically model
+// construction). Without it the full bootstrap cost is paid inside the
+// first collective.
+constexpr const char* NCCL_EAGER_INIT = "NCCL_EAGER_INIT";
+
 // ProcessGroupNCCL implements NCCL bindings for c10d.
 //
 // All functions of the class are expected to be called in the same order
@@ -77,6 +95,13 @@ class ProcessGroupNCCL : public ProcessGroup {
     // completion.
     void synchronize() override;
 
+    // Runs the callback inline after blocking the caller's current CUDA
+    // streams on this work's events. The wait happens on the device, so
+    // kernels the callback launches are sequenced after the collective
+    // without blocking any host thread. WorkNCCL never goes through
+    // finish(), so the base class implementation would never fire.
+    void then(std::function<void()> callback) override;
+
     // Helper function that checks if the NCCL kernels have finished
     // execution on the GPUs
     bool finishedGPUExecution();
@@ -88,6 +113,11 @@ class ProcessGroupNCCL : public ProcessGroup {
     // The CUDA events tracking this work item on multiple CUDA devices
     std::vector<at::cuda::CUDAEvent> cudaEvents_;
 
+    // Start events paired with cudaEvents_ for per-collective timing.
+    // Only populated when the process group runs with
+    // NCCL_COLLECTIVE_TIMING enabled.
+    std::vector<at::cuda::CUDAEvent> cudaStartEvents_;
+
     // The NCCL communicators used for this work item.
     std::vector<std::shared_ptr<NCCLComm>> ncclComms_;
 
@@ -228,6 +258,38 @@ class ProcessGroupNCCL : public ProcessGroup {
 
   static const int64_t kProcessGroupNCCLOpTimeoutMillis;
 
+  // Aggregated GPU timings of the collectives issued by this rank.
+  // Bucket i of the histogram counts collectives whose GPU time fell in
+  // [2^(i-1), 2^i) milliseconds; bucket 0 is everything below 1ms and the
+  // last bucket is unbounded. Only populated when the process group runs
+  // with NCCL_COLLECTIVE_TIMING enabled.
+  struct CollectiveTimingStats {
+    std::vector<int64_t> histogram;
+    int64_t count = 0;
+    double totalMs = 0.0;
+    double maxMs = 0.0;
+  };
+
+  // Returns a snapshot of the aggregated collective timings, folding in
+  // any collectives that completed since the last call.
+  CollectiveTimingStats getCollectiveTimingStats();
+
+  // Creates a subgroup containing `ranks` (given as ranks of this group).
+  // Returns nullptr on ranks that are not part of the subgroup.
+  //
+  // When built against a NCCL version with ncclCommSplit() support, the
+  // subgroup communicator for the caller's current CUDA device is derived
+  // from this group's communicator, reusing the parent bootstrap instead
+  // of repeating the full rendezvous per subgroup. ncclCommSplit() is a
+  // collective over the parent communicator, so in that case every rank
+  // of this group must call split() (with identical arguments), including
+  // ranks that end up outside the subgroup. With older NCCL versions the
+  // subgroup falls back to the regular lazy on-demand bootstrap through
+  // `store`.
+  std::shared_ptr<ProcessGroupNCCL> split(
+      const std::shared_ptr<Store>& store,
+      const std::vector<int>& ranks);
+
  protected:
   // Helper that broadcasts nccl unique ID to all ranks through the store
   void broadcastUniqueNCCLID(ncclUniqueId* ncclID);
@@ -245,6 +307,10 @@ class ProcessGroupNCCL : public ProcessGroup {
   virtual std::shared_ptr<ProcessGroupNCCL::WorkNCCL> initWork(
       std::vector<at::Device> devices);
 
+  // Body of the eager initialization thread; bootstraps the communicator
+  // for `deviceIndex` ahead of the first collective.
+  void eagerInitComms(at::DeviceIndex deviceIndex);
+
  private:
   // Helper that encapsulates work shared across all collective communication
   // primitives.  The callbacks have the following signatures:
@@ -283,6 +349,16 @@ class ProcessGroupNCCL : public ProcessGroup {
 
   void ncclCommWatchdogInternal();
 
+  // Folds the timings of timed collectives whose end events have fired
+  // into timingStats_. The caller must hold timingMutex_.
+  void collectFinishedTimings();
+
+  // Publishes this rank's collective entry time to the store and, on
+  // rank 0, flags ranks that lagged the median entry time of an earlier
+  // sampled collective by more than desyncThresholdMs_. The caller must
+  // hold timingMutex_. See NOTE [ NCCL desync detection ].
+  void checkDesync();
+
  protected:
   static const int64_t kWatchdogThreadSleepMillis;
 
@@ -323,6 +399,15 @@ class ProcessGroupNCCL : public ProcessGroup {
   // Mutex to guard maps like devNCCLCommMap_ and ncclIdToCommMap_.
   std::mutex mutex_;
 
+  // Serializes communicator creation in getNCCLComm. A separate mutex
+  // from mutex_ because creation involves a store rendezvous and must not
+  // block readers of the cache; it exists so that the eager init thread
+  // and the first collective cannot both bootstrap the same communicator.
+  std::mutex commCreateMutex_;
+
+  // Thread performing eager communicator initialization, if enabled.
+  std::thread eagerInitThread_;
+
   // Watchdog thread which looks for errors on the cached NCCL communicators.
   std::thread ncclCommWatchdogThread_;
 
@@ -372,6 +457,27 @@ class ProcessGroupNCCL : public ProcessGroup {
   // Timeout for operations. This is only used when blockingWait_ is enabled.
   std::chrono::milliseconds opTimeout_;
 
+  // Whether per-collective GPU timing capture is enabled.
+  bool collectiveTiming_ = false;
+
+  // Desync detector threshold in milliseconds; non-positive disables the
+  // detector.
+  int64_t desyncThresholdMs_ = 0;
+
+  // Guards the timing and desync state below.
+  std::mutex timingMutex_;
+
+  // Timed collectives whose end events may not have fired yet. Swept on
+  // every new collective and on getCollectiveTimingStats().
+  std::vector<std::shared_ptr<WorkNCCL>> pendingTimedWorks_;
+
+  // Aggregated per-collective timings of this rank.
+  CollectiveTimingStats timingStats_;
+
+  // Number of collectives issued by this process group, used to key the
+  // desync detector samples in the store.
+  uint64_t collectiveSeq_ = 0;
+
   // Set of communicators that this process group has aborted and their
   // ncclUniqueId has been written to the store. We don't need a lock
   // for this map since only the watchdog thread accesses this set. The
@@ -8,6 +8,13 @@ constexpr std::chrono::milliseconds Store::kNoTimeout;
 // Define destructor symbol for abstract base class.
 Store::~Store() {}
 
+void Store::waitForKeyCount(
+    const std::string& /* unused */,
+    int64_t /* unused */) {
+  throw std::runtime_error(
+      "waitForKeyCount is not supported by this store");
+}
+
 // Set timeout function
 void Store::setTimeout(const std::chrono::milliseconds& timeout) {
   timeout_ = timeout;
@@ -38,6 +38,13 @@ class Store {
       const std::vector<std::string>& keys,
       const std::chrono::milliseconds& timeout) = 0;
 
+  // Blocks until at least `count` keys whose names start with `prefix`
+  // exist, subject to the store timeout. Barrier-style patterns (every
+  // worker sets "<prefix><rank>", then waits for all of them) complete in
+  // a single call instead of naming all N keys. The default implementation
+  // throws; stores that can enumerate keys by prefix override it.
+  virtual void waitForKeyCount(const std::string& prefix, int64_t count);
+
   void setTimeout(const std::chrono::milliseconds& timeout);
 
  protected:
@@ -10,7 +10,7 @@ namespace c10d {
 
 namespace {
 
-enum class QueryType : uint8_t { SET, GET, ADD, CHECK, WAIT };
+enum class QueryType : uint8_t { SET, GET, ADD, CHECK, WAIT, WATCH };
 
 enum class CheckResponseType : uint8_t { READY, NOT_READY };
 
@@ -139,6 +139,14 @@ void TCPStoreDaemon::run() {
             ++it;
           }
         }
+        for (auto it = prefixWatchers_.begin();
+             it != prefixWatchers_.end();) {
+          if (it->socket == fds[fdIdx].fd) {
+            it = prefixWatchers_.erase(it);
+          } else {
+            ++it;
+          }
+        }
         fds.erase(fds.begin() + fdIdx);
         sockets_.erase(sockets_.begin() + fdIdx - 2);
         --fdIdx;
@@ -180,6 +188,9 @@ void TCPStoreDaemon::query(int socket) {
   } else if (qt == QueryType::WAIT) {
     waitHandler(socket);
 
+  } else if (qt == QueryType::WATCH) {
+    watchHandler(socket);
+
   } else {
     throw std::runtime_error("Unexpected query type");
   }
@@ -198,11 +209,25 @@ void TCPStoreDaemon::wakeupWaitingClients(const std::string& key) {
   }
 }
 
+void TCPStoreDaemon::wakeupWatchingClients(const std::string& key) {
+  for (auto it = prefixWatchers_.begin(); it != prefixWatchers_.end();) {
+    if (key.compare(0, it->prefix.size(), it->prefix) == 0 &&
+        countKeysWithPrefix(it->prefix) >= it->count) {
+      tcputil::sendValue<WaitResponseType>(
+          it->socket, WaitResponseType::STOP_WAITING);
+      it = prefixWatchers_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 void TCPStoreDaemon::setHandler(int socket) {
   std::string key = tcputil::recvString(socket);
   tcpStore_[key] = tcputil::recvVector<uint8_t>(socket);
   // On "set", wake up all clients that have been waiting
   wakeupWaitingClients(key);
+  wakeupWatchingClients(key);
 }
 
 void TCPStoreDaemon::addHandler(int socket) {
@@ -220,6 +245,7 @@ void TCPStoreDaemon::addHandler(int socket) {
   tcputil::sendValue<int64_t>(socket, addVal);
   // On "add", wake up all clients that have been waiting
   wakeupWaitingClients(key);
+  wakeupWatchingClients(key);
 }
 
 void TCPStoreDaemon::getHandler(int socket) const {
@@ -261,6 +287,27 @@ void TCPStoreDaemon::waitHandler(int socket) {
   }
 }
 
+void TCPStoreDaemon::watchHandler(int socket) {
+  std::string prefix = tcputil::recvString(socket);
+  int64_t count = tcputil::recvValue<int64_t>(socket);
+  if (countKeysWithPrefix(prefix) >= count) {
+    tcputil::sendValue<WaitResponseType>(
+        socket, WaitResponseType::STOP_WAITING);
+  } else {
+    prefixWatchers_.push_back(PrefixWatcher{prefix, count, socket});
+  }
+}
+
+int64_t TCPStoreDaemon::countKeysWithPrefix(const std::string& prefix) const {
+  return std::count_if(
+      tcpStore_.begin(),
+      tcpStore_.end(),
+      [&prefix](
+          const std::pair<const std::string, std::vector<uint8_t>>& kv) {
+        return kv.first.compare(0, prefix.size(), prefix) == 0;
+      });
+}
+
 bool TCPStoreDaemon::checkKeys(const std::vector<std::string>& keys) const {
   return std::all_of(keys.begin(), keys.end(), [this](const std::string& s) {
     return tcpStore_.count(s) > 0;
@@ -423,6 +470,29 @@ void TCPStore::waitHelper_(
   }
 }
 
+void TCPStore::waitForKeyCount(const std::string& prefix, int64_t count) {
+  // A single round trip: the daemon holds the reply until `count` keys
+  // with the prefix exist, so no client-side polling is needed.
+  if (timeout_ != kNoTimeout) {
+    struct timeval timeoutTV = {.tv_sec = timeout_.count() / 1000,
+                                .tv_usec = (timeout_.count() % 1000) * 1000};
+    SYSCHECK_ERR_RETURN_NEG1(::setsockopt(
+        storeSocket_,
+        SOL_SOCKET,
+        SO_RCVTIMEO,
+        reinterpret_cast<char*>(&timeoutTV),
+        sizeof(timeoutTV)));
+  }
+  std::string regPrefix = regularPrefix_ + prefix;
+  tcputil::sendValue<QueryType>(storeSocket_, QueryType::WATCH);
+  tcputil::sendString(storeSocket_, regPrefix, true);
+  tcputil::sendValue<int64_t>(storeSocket_, count);
+  auto waitResponse = tcputil::recvValue<WaitResponseType>(storeSocket_);
+  if (waitResponse != WaitResponseType::STOP_WAITING) {
+    throw std::runtime_error("Stop_waiting response is expected");
+  }
+}
+
 PortType TCPStore::getPort() {
   return tcpStorePort_;
 }
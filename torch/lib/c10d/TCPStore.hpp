@@ -27,9 +27,20 @@ class TCPStoreDaemon {
   void getHandler(int socket) const;
   void checkHandler(int socket) const;
   void waitHandler(int socket);
+  void watchHandler(int socket);
 
   bool checkKeys(const std::vector<std::string>& keys) const;
+  int64_t countKeysWithPrefix(const std::string& prefix) const;
   void wakeupWaitingClients(const std::string& key);
+  void wakeupWatchingClients(const std::string& key);
+
+  // A client blocked in waitForKeyCount until `count` keys starting with
+  // `prefix` exist.
+  struct PrefixWatcher {
+    std::string prefix;
+    int64_t count;
+    int socket;
+  };
 
   std::thread daemonThread_;
   std::unordered_map<std::string, std::vector<uint8_t>> tcpStore_;
@@ -37,6 +48,8 @@ class TCPStoreDaemon {
   std::unordered_map<std::string, std::vector<int>> waitingSockets_;
   // From socket -> number of keys awaited
   std::unordered_map<int, size_t> keysAwaited_;
+  // Clients blocked on a key-prefix count
+  std::vector<PrefixWatcher> prefixWatchers_;
 
   std::vector<int> sockets_;
   int storeListenSocket_;
@@ -69,6 +82,8 @@ class TCPStore : public Store {
       const std::vector<std::string>& keys,
       const std::chrono::milliseconds& timeout) override;
 
+  void waitForKeyCount(const std::string& prefix, int64_t count) override;
+
   // Waits for all workers to join.
   void waitForWorkers();
 
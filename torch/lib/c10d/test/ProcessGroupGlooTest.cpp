@@ -3,6 +3,7 @@
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <iostream>
 #include <mutex>
@@ -190,6 +191,46 @@ void testAllreduce(const std::string& path, const at::DeviceType b) {
   }
 }
 
+void testThen(const std::string& path) {
+  const auto size = 4;
+  auto tests = CollectiveTest::initialize(path, size);
+
+  // Generate inputs
+  std::vector<std::vector<at::Tensor>> inputs(size);
+  for (auto i = 0; i < size; i++) {
+    auto tensor = at::ones({16, 16}) * i;
+    inputs[i] = std::vector<at::Tensor>({tensor});
+  }
+
+  // Kick off work and register a continuation on each work before it
+  // completes; the continuation observes the allreduced result. The
+  // callbacks are not ordered with respect to wait(), so completion is
+  // signalled through the semaphore instead.
+  const auto expected = (size * (size - 1)) / 2;
+  std::atomic<int> numCorrect{0};
+  Semaphore done;
+  std::vector<std::shared_ptr<::c10d::ProcessGroup::Work>> work(size);
+  for (auto i = 0; i < size; i++) {
+    work[i] = tests[i].getProcessGroup().allreduce(inputs[i]);
+    work[i]->then([&, i] {
+      auto data = inputs[i][0].data_ptr<float>();
+      if (data[0] == expected) {
+        numCorrect++;
+      }
+      done.post();
+    });
+  }
+
+  // Wait for all continuations to run
+  done.wait(size);
+  EXPECT_EQ(numCorrect.load(), size);
+
+  // Registering on already completed work runs the callback inline.
+  bool ranInline = false;
+  work[0]->then([&] { ranInline = true; });
+  EXPECT_TRUE(ranInline);
+}
+
 void testBroadcast(const std::string& path, const at::DeviceType b) {
   const auto size = 2;
   const auto stride = 2;
@@ -345,6 +386,30 @@ void testRecv(const std::string& path) {
   EXPECT_TRUE(recvCompleted);
 }
 
+void testSendRecvThen(const std::string& path) {
+  const auto size = 2;
+  auto tests = CollectiveTest::initialize(path, size);
+  constexpr uint64_t tag = 0x1337;
+
+  // Register continuations on point-to-point work while it is still in
+  // flight. Unlike collectives there is no worker thread driving these
+  // work objects; completion happens in wait(), which must run the
+  // callbacks before returning.
+  std::vector<at::Tensor> sendTensors = {at::ones({16, 16})};
+  std::vector<at::Tensor> recvTensors = {at::zeros({16, 16})};
+  auto sendWork = tests[0].getProcessGroup().send(sendTensors, 1, tag);
+  auto recvWork = tests[1].getProcessGroup().recv(recvTensors, 0, tag);
+  std::atomic<int> numRan{0};
+  sendWork->then([&] { numRan++; });
+  recvWork->then([&] { numRan++; });
+
+  std::thread sendThread([&]() { sendWork->wait(); });
+  std::thread recvThread([&]() { recvWork->wait(); });
+  sendThread.join();
+  recvThread.join();
+  EXPECT_EQ(numRan.load(), 2);
+}
+
 TEST(ProcessGroupGlooTest, testSIGSTOPException) {
   // test SIGSTOP
   // Fork() and TSAN don't play well together, so skip the test if we're testing
@@ -382,6 +447,13 @@ TEST(ProcessGroupGlooTest, testAllReduceCPU) {
   }
 }
 
+TEST(ProcessGroupGlooTest, testThen) {
+  {
+    TemporaryFile file;
+    testThen(file.path);
+  }
+}
+
 TEST(ProcessGroupGlooTest, testBroadcastCPU) {
   {
     TemporaryFile file;
@@ -410,6 +482,13 @@ TEST(ProcessGroupGlooTest, testRecv) {
   }
 }
 
+TEST(ProcessGroupGlooTest, testSendRecvThen) {
+  {
+    TemporaryFile file;
+    testSendRecvThen(file.path);
+  }
+}
+
 #ifdef USE_CUDA
 // CUDA-only tests
 TEST(ProcessGroupGlooTest, testAllReduceCUDA) {
@@ -15,11 +15,11 @@ contents, and we recommend referring to very good docs of the original module.
 """
 import torch
 import sys
-from .reductions import init_reductions
+from .reductions import init_reductions, coalesce_shared_tensors
 import multiprocessing
 
 __all__ = ['set_sharing_strategy', 'get_sharing_strategy',
-           'get_all_sharing_strategies']
+           'get_all_sharing_strategies', 'coalesce_shared_tensors']
 
 
 from multiprocessing import *
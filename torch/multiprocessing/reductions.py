@@ -343,6 +343,85 @@ def reduce_storage(storage):
     return (rebuild, (type(storage),) + metadata)
 
 
+def _coalesce_tensor_group(tensors):
+    # Copies `tensors` (all of one dtype) into a single flat tensor whose
+    # storage is moved to shared memory, and returns offset-based views
+    # into it with the original shapes. Sending the views over a queue
+    # then transfers one file descriptor for the whole group, because the
+    # pickler memoizes the common storage.
+    total = 0
+    for t in tensors:
+        total += t.numel()
+    flat = torch.empty(total, dtype=tensors[0].dtype)
+    flat.storage().share_memory_()
+    views = []
+    offset = 0
+    for t in tensors:
+        chunk = flat.narrow(0, offset, t.numel())
+        chunk.copy_(t.contiguous().view(-1))
+        views.append(chunk.view(t.size()))
+        offset += t.numel()
+    return views
+
+
+def coalesce_shared_tensors(obj):
+    r"""Groups the tensors in ``obj`` into shared-memory segments.
+
+    Walks ``obj`` through lists, tuples and dicts, copies every dense CPU
+    tensor found into a single freshly allocated shared-memory segment per
+    dtype, and returns ``obj`` with each such tensor replaced by an
+    offset-based view into its segment. Sending the result through a
+    multiprocessing queue transfers one file descriptor per segment instead
+    of one per storage, which matters when a single queue item carries
+    hundreds of small tensors.
+
+    Tensors that are already in shared memory, CUDA tensors, sparse
+    tensors, empty tensors and tensors that require grad are left
+    untouched. Note that the eligible tensors are copied: in-place updates
+    made to the originals after this call are not visible through the
+    returned views.
+    """
+    groups = {}
+    seen = set()
+
+    def eligible(t):
+        return (not t.is_cuda and not t.is_sparse and not t.is_shared() and
+                not t.requires_grad and t.numel() > 0)
+
+    def collect(o):
+        if isinstance(o, torch.Tensor):
+            if eligible(o) and id(o) not in seen:
+                seen.add(id(o))
+                groups.setdefault(o.dtype, []).append(o)
+        elif isinstance(o, (list, tuple)):
+            for elem in o:
+                collect(elem)
+        elif isinstance(o, dict):
+            for elem in o.values():
+                collect(elem)
+
+    collect(obj)
+    replacements = {}
+    for tensors in groups.values():
+        for t, view in zip(tensors, _coalesce_tensor_group(tensors)):
+            replacements[id(t)] = view
+
+    def rebuild(o):
+        if isinstance(o, torch.Tensor):
+            return replacements.get(id(o), o)
+        if isinstance(o, (list, tuple)):
+            rebuilt = [rebuild(elem) for elem in o]
+            if isinstance(o, list):
+                return rebuilt
+            # preserve namedtuples
+            return type(o)(*rebuilt) if hasattr(o, '_fields') else tuple(rebuilt)
+        if isinstance(o, dict):
+            return type(o)((k, rebuild(v)) for k, v in o.items())
+        return o
+
+    return rebuild(obj)
+
+
 def init_reductions():
     ForkingPickler.register(torch.cuda.Event, reduce_event)
 
@@ -2314,6 +2314,12 @@ def cross_entropy(input, target, weight=None, size_average=None, ignore_index=-1
                 reduction=reduction)
     if size_average is not None or reduce is not None:
         reduction = _Reduction.legacy_get_string(size_average, reduce)
+    if input.dim() == 2:
+        # Fused kernel: computes max, logsumexp and the picked-class loss in
+        # a single pass over the logits, without materializing the [N, C]
+        # log-probability intermediate.
+        return torch._C._nn.cross_entropy_loss(
+            input, target, weight, _Reduction.get_enum(reduction), ignore_index)
     return nll_loss(log_softmax(input, 1), target, weight, None, ignore_index, None, reduction)
 
 
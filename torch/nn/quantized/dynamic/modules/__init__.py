@@ -2,8 +2,10 @@
 
 from .linear import Linear
 from .rnn import LSTM
+from .rnn import GRU
 
 __all__ = [
     'Linear',
     'LSTM',
+    'GRU',
 ]
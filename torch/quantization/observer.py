@@ -805,11 +805,17 @@ class HistogramObserver(_ObserverBase):
         min_val = self.min_val
         max_val = self.max_val
         if min_val.numel() == 0 or max_val.numel() == 0:
-            min_val = torch.min(x)
-            max_val = torch.max(x)
-            self.min_val = min_val
-            self.max_val = max_val
-            self.histogram = torch.histc(x, self.bins, min=min_val, max=max_val)
+            if x.device.type == 'cpu':
+                # Fused single kernel computing min, max and the histogram
+                # in one parallel pass over the data.
+                self.histogram, self.min_val, self.max_val = \
+                    torch._histogram_observe(x, self.bins)
+            else:
+                min_val = torch.min(x)
+                max_val = torch.max(x)
+                self.min_val = min_val
+                self.max_val = max_val
+                self.histogram = torch.histc(x, self.bins, min=min_val, max=max_val)
         else:
             new_min = torch.min(x)
             new_max = torch.max(x)
@@ -820,7 +826,11 @@ class HistogramObserver(_ObserverBase):
             # and then downsampling the histogram efficiently
             combined_min, combined_max, downsample_rate, start_idx = \
                 self._adjust_min_max(combined_min, combined_max, self.upsample_rate)
-            combined_histogram = torch.histc(x, self.bins, min=combined_min, max=combined_max)
+            if x.device.type == 'cpu':
+                combined_histogram = torch._histogram_observe(
+                    x, self.bins, combined_min, combined_max)[0]
+            else:
+                combined_histogram = torch.histc(x, self.bins, min=combined_min, max=combined_max)
             if combined_min == min_val and combined_max == max_val:
                 combined_histogram += self.histogram
             else:
@@ -909,6 +909,35 @@ class RpcTest(RpcAgentTestFixture):
         )
         self.assertEqual(rref.to_here(), torch.ones(n, n) * 2)
 
+    @dist_init
+    def test_prefetch_rrefs(self):
+        n = self.rank + 1
+        dst_rank = n % self.world_size
+        rrefs = [
+            rpc.remote(
+                worker_name(dst_rank),
+                torch.add,
+                args=(torch.ones(n, n), torch.ones(n, n) * i),
+            )
+            for i in range(4)
+        ]
+        expected = [torch.ones(n, n) * (i + 1) for i in range(4)]
+        rpc._set_rref_value_cache_enabled(True)
+        try:
+            rpc._prefetch_rrefs(rrefs)
+            for rref, value in zip(rrefs, expected):
+                self.assertEqual(rref.to_here(), value)
+            # A second prefetch only revalidates cached versions with the
+            # owner; cached values must remain intact.
+            rpc._prefetch_rrefs(rrefs)
+            for rref, value in zip(rrefs, expected):
+                self.assertEqual(rref.to_here(), value)
+        finally:
+            rpc._set_rref_value_cache_enabled(False)
+        # With the cache disabled, to_here() goes back to regular fetches.
+        for rref, value in zip(rrefs, expected):
+            self.assertEqual(rref.to_here(), value)
+
     @dist_init
     def test_builtin_remote_self(self):
         rref = rpc.remote(